@@ -0,0 +1,281 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _IMG_CONVERTERS_H_
+#define _IMG_CONVERTERS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_camera.h"
+#include "jpeg_decoder.h"
+
+typedef size_t (* jpg_out_cb)(void * arg, size_t index, const void* data, size_t len);
+
+/**
+ * @brief Region of interest rectangle in source image pixels
+ */
+typedef struct {
+    uint16_t x;                 /*!< Left edge */
+    uint16_t y;                 /*!< Top edge */
+    uint16_t w;                 /*!< Width */
+    uint16_t h;                 /*!< Height */
+} jpg_roi_rect_t;
+
+/**
+ * @brief Region of interest settings for JPEG encoding
+ *
+ * MCUs touching any rectangle are coded with the quality passed to the encoder.
+ * All other MCUs are coarsened per block by zeroing DCT coefficients.
+ */
+typedef struct {
+    const jpg_roi_rect_t *rects;    /*!< Rectangles that keep full quality */
+    size_t count;                   /*!< Number of rectangles */
+    uint8_t outside_coeffs;         /*!< Zigzag coefficients kept outside the ROI: 1 (DC only) - 64 (all) */
+    uint8_t outside_threshold;      /*!< AC coefficients with quantized magnitude <= this are zeroed outside the ROI */
+} jpg_roi_t;
+
+/**
+ * @brief Convert image buffer to JPEG
+ *
+ * @param src       Source buffer in RGB565, RGB888, YUYV or GRAYSCALE format
+ * @param src_len   Length in bytes of the source buffer
+ * @param width     Width in pixels of the source image
+ * @param height    Height in pixels of the source image
+ * @param format    Format of the source image
+ * @param quality   JPEG quality of the resulting image
+ * @param cp        Callback to be called to write the bytes of the output JPEG
+ * @param arg       Pointer to be passed to the callback
+ *
+ * @return true on success
+ */
+bool fmt2jpg_cb(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, jpg_out_cb cb, void * arg);
+
+/**
+ * @brief Convert camera frame buffer to JPEG
+ *
+ * @param fb        Source camera frame buffer
+ * @param quality   JPEG quality of the resulting image
+ * @param cp        Callback to be called to write the bytes of the output JPEG
+ * @param arg       Pointer to be passed to the callback
+ *
+ * @return true on success
+ */
+bool frame2jpg_cb(camera_fb_t * fb, uint8_t quality, jpg_out_cb cb, void * arg);
+
+/**
+ * @brief Convert image buffer to JPEG buffer
+ *
+ * @param src       Source buffer in RGB565, RGB888, YUYV or GRAYSCALE format
+ * @param src_len   Length in bytes of the source buffer
+ * @param width     Width in pixels of the source image
+ * @param height    Height in pixels of the source image
+ * @param format    Format of the source image
+ * @param quality   JPEG quality of the resulting image
+ * @param out       Pointer to be populated with the address of the resulting buffer.
+ *                  You MUST free the pointer once you are done with it.
+ * @param out_len   Pointer to be populated with the length of the output buffer
+ *
+ * @return true on success
+ */
+bool fmt2jpg(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, uint8_t ** out, size_t * out_len);
+
+/**
+ * @brief Convert camera frame buffer to JPEG buffer
+ *
+ * @param fb        Source camera frame buffer
+ * @param quality   JPEG quality of the resulting image
+ * @param out       Pointer to be populated with the address of the resulting buffer
+ * @param out_len   Pointer to be populated with the length of the output buffer
+ *
+ * @return true on success
+ */
+bool frame2jpg(camera_fb_t * fb, uint8_t quality, uint8_t ** out, size_t * out_len);
+
+/**
+ * @brief Convert image buffer to JPEG with region of interest quality
+ *
+ * @param src       Source buffer in RGB565, RGB888, YUYV or GRAYSCALE format
+ * @param src_len   Length in bytes of the source buffer
+ * @param width     Width in pixels of the source image
+ * @param height    Height in pixels of the source image
+ * @param format    Format of the source image
+ * @param quality   JPEG quality inside the region of interest
+ * @param roi       Region of interest settings, NULL encodes the whole image at quality
+ * @param cb        Callback to be called to write the bytes of the output JPEG
+ * @param arg       Pointer to be passed to the callback
+ *
+ * @return true on success
+ */
+bool fmt2jpg_roi_cb(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, const jpg_roi_t *roi, jpg_out_cb cb, void * arg);
+
+/**
+ * @brief Convert image buffer to JPEG buffer with region of interest quality
+ *
+ * @param src       Source buffer in RGB565, RGB888, YUYV or GRAYSCALE format
+ * @param src_len   Length in bytes of the source buffer
+ * @param width     Width in pixels of the source image
+ * @param height    Height in pixels of the source image
+ * @param format    Format of the source image
+ * @param quality   JPEG quality inside the region of interest
+ * @param roi       Region of interest settings, NULL encodes the whole image at quality
+ * @param out       Pointer to be populated with the address of the resulting buffer.
+ *                  You MUST free the pointer once you are done with it.
+ * @param out_len   Pointer to be populated with the length of the output buffer
+ *
+ * @return true on success
+ */
+bool fmt2jpg_roi(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, const jpg_roi_t *roi, uint8_t ** out, size_t * out_len);
+
+/**
+ * @brief Convert camera frame buffer to JPEG buffer with region of interest quality
+ *
+ * @param fb        Source camera frame buffer
+ * @param quality   JPEG quality inside the region of interest
+ * @param roi       Region of interest settings, NULL encodes the whole image at quality
+ * @param out       Pointer to be populated with the address of the resulting buffer
+ * @param out_len   Pointer to be populated with the length of the output buffer
+ *
+ * @return true on success
+ */
+bool frame2jpg_roi(camera_fb_t * fb, uint8_t quality, const jpg_roi_t *roi, uint8_t ** out, size_t * out_len);
+
+/**
+ * @brief Convert image buffer to BMP buffer
+ *
+ * @param src       Source buffer in JPEG, RGB565, RGB888, YUYV or GRAYSCALE format
+ * @param src_len   Length in bytes of the source buffer
+ * @param width     Width in pixels of the source image
+ * @param height    Height in pixels of the source image
+ * @param format    Format of the source image
+ * @param out       Pointer to be populated with the address of the resulting buffer
+ * @param out_len   Pointer to be populated with the length of the output buffer
+ *
+ * @return true on success
+ */
+bool fmt2bmp(uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t ** out, size_t * out_len);
+
+/**
+ * @brief Convert camera frame buffer to BMP buffer
+ *
+ * @param fb        Source camera frame buffer
+ * @param out       Pointer to be populated with the address of the resulting buffer
+ * @param out_len   Pointer to be populated with the length of the output buffer
+ *
+ * @return true on success
+ */
+bool frame2bmp(camera_fb_t * fb, uint8_t ** out, size_t * out_len);
+
+/**
+ * @brief Convert image buffer to RGB888 buffer (used for face detection)
+ *
+ * @param src       Source buffer in JPEG, RGB565, RGB888, YUYV or GRAYSCALE format
+ * @param src_len   Length in bytes of the source buffer
+ * @param format    Format of the source image
+ * @param rgb_buf   Pointer to the output buffer (width * height * 3)
+ *
+ * @return true on success
+ */
+bool fmt2rgb888(const uint8_t *src_buf, size_t src_len, pixformat_t format, uint8_t * rgb_buf);
+
+/**
+ * @brief Downscale and convert an image buffer in one pass
+ *
+ * Each output pixel is the box filtered average of the source pixels it covers,
+ * so any output size up to the source size works. Integer factors (1/2, 1/4, 1/8)
+ * use power of two boxes and shifts.
+ *
+ * @param src        Source buffer in YUV422 (YUYV) or RGB565 format
+ * @param src_len    Length in bytes of the source buffer
+ * @param width      Width in pixels of the source image
+ * @param height     Height in pixels of the source image
+ * @param format     Format of the source image
+ * @param out_width  Width in pixels of the output image
+ * @param out_height Height in pixels of the output image
+ * @param out_format PIXFORMAT_RGB888 (same byte order as fmt2rgb888), PIXFORMAT_RGB565 or PIXFORMAT_GRAYSCALE
+ * @param out        Output buffer, out_width * out_height * bytes per pixel
+ *
+ * @return true on success
+ */
+bool fmt2scaled(const uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format,
+                uint16_t out_width, uint16_t out_height, pixformat_t out_format, uint8_t *out);
+
+/**
+ * @brief Downscale and convert a camera frame buffer by an integer factor
+ *
+ * @param fb         Source camera frame buffer in YUV422 or RGB565 format
+ * @param scale_div  Scale divider, 2 for 1/2, 4 for 1/4 and so on
+ * @param out_format PIXFORMAT_RGB888, PIXFORMAT_RGB565 or PIXFORMAT_GRAYSCALE
+ * @param out        Output buffer, (width / scale_div) * (height / scale_div) * bytes per pixel
+ *
+ * @return true on success
+ */
+bool frame2scaled(camera_fb_t * fb, uint8_t scale_div, pixformat_t out_format, uint8_t *out);
+
+/**
+ * @brief Draw callback of jpg_patch()
+ *
+ * Called once per MCU that a rectangle touches, with its decoded pixels.
+ *
+ * @param arg   Pointer passed to jpg_patch()
+ * @param rgb   Pixels of the MCU, R, G, B bytes, w * 3 bytes per row, to be drawn on
+ * @param x     Left edge of the MCU in image pixels
+ * @param y     Top edge of the MCU in image pixels
+ * @param w     Width in pixels, the MCU width except at the right image edge
+ * @param h     Height in pixels, the MCU height except at the bottom image edge
+ */
+typedef void (* jpg_patch_draw_cb)(void * arg, uint8_t *rgb, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief Draw into a baseline JPEG, decoding and coding again only the MCUs drawn on
+ *
+ * The MCUs the rectangles touch are decoded and handed to the callback; the
+ * 8x8 blocks in which it changed pixels are coded again with the quantization
+ * and Huffman tables of the source. All other MCUs keep their coefficients,
+ * and before the first and after the last touched MCU the source bytes are
+ * copied, so the cost follows the area drawn on rather than the image size.
+ * A JPEG whose Huffman tables miss symbols (optimized tables) is coded again
+ * whole with the standard tables instead. Progressive, arithmetic coded and multi-scan JPEGs are not handled.
+ *
+ * @param src       Source JPEG
+ * @param src_len   Length in bytes of the source JPEG
+ * @param rects     Rectangles to draw in, in image pixels
+ * @param count     Number of rectangles
+ * @param draw      Callback drawing on the decoded MCUs
+ * @param arg       Pointer to be passed to the callback
+ * @param out       Output buffer, the output is about the source size
+ * @param out_cap   Size of the output buffer
+ * @param out_len   Pointer to be populated with the length of the output JPEG
+ *
+ * @return true on success, false for a JPEG that cannot be patched or an output buffer too small
+ */
+bool jpg_patch(const uint8_t *src, size_t src_len, const jpg_roi_rect_t *rects, size_t count,
+               jpg_patch_draw_cb draw, void * arg, uint8_t *out, size_t out_cap, size_t *out_len);
+
+// Macros for backwards compatibility
+#define JPG_SCALE_NONE JPEG_IMAGE_SCALE_0
+#define JPG_SCALE_2X   JPEG_IMAGE_SCALE_1_2
+#define JPG_SCALE_4X   JPEG_IMAGE_SCALE_1_4
+#define JPG_SCALE_8X   JPEG_IMAGE_SCALE_1_8
+#define JPG_SCALE_MAX  JPEG_IMAGE_SCALE_1_8
+bool jpg2rgb565(const uint8_t *src, size_t src_len, uint8_t * out, esp_jpeg_image_scale_t scale);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IMG_CONVERTERS_H_ */
@@ -0,0 +1,1023 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "img_converters.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#define TAG ""
+#else
+#include "esp_log.h"
+static const char* TAG = "jpg_patch";
+#endif
+
+/*
+ * Drawing into a baseline JPEG without decoding all of it.
+ *
+ * The scan is Huffman decoded MCU by MCU, which is cheap next to the inverse
+ * DCT and colour conversion of a full decode. Up to the first MCU a rectangle
+ * touches, the source bytes are copied as they are. From there the MCUs are
+ * Huffman coded again with the frame's own tables: untouched MCUs with their
+ * coefficients as they were, touched ones after an inverse DCT, the draw
+ * callback, and a forward DCT of the 8x8 blocks whose pixels it changed. Once
+ * past the last touched MCU, and with the DC predictions back in step with the
+ * source, the rest of the scan is copied bit shifted, or as it is as soon as
+ * the output is byte aligned again (at the latest at the next restart marker).
+ *
+ * Tables optimized for the source may have no code for a coefficient the
+ * drawing needs. For such a frame the DHT segments are replaced with the
+ * standard tables and every MCU is coded again.
+ */
+
+#define MAX_COMPS 3
+#define MAX_BLOCKS 10           // blocks per MCU, the limit of the standard
+#define LOOKUP_BITS 9           // Huffman codes up to this long decode with one lookup
+
+typedef struct {
+    uint16_t lookup[1 << LOOKUP_BITS];  // code length << 8 | symbol, 0 for longer codes
+    int32_t maxcode[17];                // largest code of each length, -1 for none
+    int32_t delta[17];                  // vals index of a code of each length, less the code
+    uint8_t vals[256];
+    uint16_t code[256];                 // code of each symbol, for coding blocks again
+    uint8_t size[256];                  // its length, 0 for symbols the table has no code for
+    bool defined;
+} huff_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t h;                  // sampling factors
+    uint8_t v;
+    uint8_t tq;                 // quantization table
+    uint8_t td;                 // DC and AC Huffman tables
+    uint8_t ta;
+    int dpred;                  // DC prediction of the source scan
+    int epred;                  // and of the output
+    const huff_t *edc;          // tables the output is coded with
+    const huff_t *eac;
+} comp_t;
+
+typedef struct {
+    const uint8_t *src;
+    const uint8_t *end;
+    uint16_t width;
+    uint16_t height;
+    uint8_t ncomp;
+    comp_t comp[MAX_COMPS];
+    uint8_t hmax;
+    uint8_t vmax;
+    uint8_t blocks;             // blocks per MCU
+    uint16_t restart;           // MCUs per restart interval, 0 without
+    const uint8_t *scan;        // first byte of the entropy coded data
+    uint16_t qt[4][64];         // zigzag order
+    huff_t dc[4];
+    huff_t ac[4];
+    bool std_tables;            // the source tables lack codes, the output gets the Annex K ones
+    huff_t std_dc[2];
+    huff_t std_ac[2];
+
+    // bit reader over the source scan, MSB first
+    const uint8_t *p;
+    uint32_t acc;
+    int bits;
+    bool at_marker;             // stopped at a marker, feeding zeros
+    const uint8_t *fed_at[8];   // source position of the last bytes fed, for copying from a bit position
+    uint32_t fed;
+
+    // bit writer
+    uint8_t *out;
+    uint8_t *o;
+    uint8_t *out_end;
+    uint32_t wacc;
+    int wbits;
+    bool overflow;
+} patch_t;
+
+static const uint8_t zigzag[64] = {
+    0,  1,  8, 16,  9,  2,  3, 10,
+   17, 24, 32, 25, 18, 11,  4,  5,
+   12, 19, 26, 33, 40, 48, 41, 34,
+   27, 20, 13,  6,  7, 14, 21, 28,
+   35, 42, 49, 56, 57, 50, 43, 36,
+   29, 22, 15, 23, 30, 37, 44, 51,
+   58, 59, 52, 45, 38, 31, 39, 46,
+   53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// Annex K tables in esp_jpeg, for frames without DHT (MJPEG from USB cameras)
+extern const unsigned char esp_jpeg_lum_dc_num_bits[], esp_jpeg_lum_dc_values[];
+extern const unsigned char esp_jpeg_chrom_dc_num_bits[], esp_jpeg_chrom_dc_values[];
+extern const unsigned char esp_jpeg_lum_ac_num_bits[], esp_jpeg_lum_ac_values[];
+extern const unsigned char esp_jpeg_chrom_ac_num_bits[], esp_jpeg_chrom_ac_values[];
+extern const unsigned esp_jpeg_lum_dc_codes_total, esp_jpeg_lum_ac_codes_total;
+extern const unsigned esp_jpeg_chrom_dc_codes_total, esp_jpeg_chrom_ac_codes_total;
+
+// Orthonormal DCT basis, dct_m[u][x] = c(u) cos((2x + 1) u pi / 16)
+static float dct_m[8][8];
+static bool dct_ready;
+
+static void *_malloc(size_t size)
+{
+    void * res = malloc(size);
+    if(res) {
+        return res;
+    }
+#if ((CONFIG_SPIRAM || CONFIG_SPIRAM_SUPPORT) && (CONFIG_SPIRAM_USE_CAPS_ALLOC || CONFIG_SPIRAM_USE_MALLOC))
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+    return NULL;
+}
+
+static inline uint8_t clamp_u8(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/*
+ * Header
+ */
+
+static bool build_huff(huff_t *t, const uint8_t *counts, const uint8_t *vals, int total)
+{
+    memset(t, 0, sizeof(*t));
+    memcpy(t->vals, vals, total);
+    int32_t code = 0;
+    int k = 0;
+    for (int l = 1; l <= 16; l++) {
+        t->maxcode[l] = -1;
+        if (counts[l - 1]) {
+            t->delta[l] = k - code;
+            for (int i = 0; i < counts[l - 1]; i++, k++, code++) {
+                const uint8_t sym = vals[k];
+                t->code[sym] = (uint16_t)code;
+                t->size[sym] = (uint8_t)l;
+                if (l <= LOOKUP_BITS) {
+                    const int shift = LOOKUP_BITS - l;
+                    for (int s = 0; s < (1 << shift); s++) {
+                        t->lookup[(code << shift) | s] = (uint16_t)(l << 8 | sym);
+                    }
+                }
+            }
+            t->maxcode[l] = code - 1;
+        }
+        if (code > (1 << l)) {
+            return false;       // more codes than fit the length
+        }
+        code <<= 1;
+    }
+    t->defined = true;
+    return true;
+}
+
+static bool parse_dht(patch_t *j, const uint8_t *s, int n)
+{
+    while (n >= 17) {
+        const uint8_t tc = s[0] >> 4, th = s[0] & 0x0f;
+        int total = 0;
+        for (int i = 0; i < 16; i++) {
+            total += s[1 + i];
+        }
+        if (tc > 1 || th > 3 || total > 256 || 17 + total > n) {
+            return false;
+        }
+        if (!build_huff(tc ? &j->ac[th] : &j->dc[th], s + 1, s + 17, total)) {
+            return false;
+        }
+        s += 17 + total;
+        n -= 17 + total;
+    }
+    return n == 0;
+}
+
+static bool parse_dqt(patch_t *j, const uint8_t *s, int n)
+{
+    while (n >= 65) {
+        const uint8_t pq = s[0] >> 4, tq = s[0] & 0x0f;
+        const int size = pq ? 129 : 65;
+        if (tq > 3 || n < size) {
+            return false;
+        }
+        for (int i = 0; i < 64; i++) {
+            j->qt[tq][i] = pq ? (uint16_t)(s[1 + 2 * i] << 8 | s[2 + 2 * i]) : s[1 + i];
+        }
+        s += size;
+        n -= size;
+    }
+    return n == 0;
+}
+
+static bool parse_sof(patch_t *j, const uint8_t *s, int n)
+{
+    if (n < 6 || s[0] != 8) {
+        return false;
+    }
+    j->height = (uint16_t)(s[1] << 8 | s[2]);
+    j->width = (uint16_t)(s[3] << 8 | s[4]);
+    j->ncomp = s[5];
+    if (!j->width || !j->height || (j->ncomp != 1 && j->ncomp != 3) || n < 6 + 3 * j->ncomp) {
+        return false;
+    }
+    j->hmax = j->vmax = 1;
+    j->blocks = 0;
+    for (int i = 0; i < j->ncomp; i++) {
+        comp_t *c = &j->comp[i];
+        c->id = s[6 + 3 * i];
+        c->h = s[7 + 3 * i] >> 4;
+        c->v = s[7 + 3 * i] & 0x0f;
+        c->tq = s[8 + 3 * i] & 3;
+        if (j->ncomp == 1) {
+            c->h = c->v = 1;    // a single component scan codes one block per MCU whatever the factors
+        }
+        if (c->h < 1 || c->h > 2 || c->v < 1 || c->v > 2) {
+            return false;
+        }
+        j->hmax = c->h > j->hmax ? c->h : j->hmax;
+        j->vmax = c->v > j->vmax ? c->v : j->vmax;
+        j->blocks += c->h * c->v;
+    }
+    return j->blocks <= MAX_BLOCKS;
+}
+
+static void load_default_huff(huff_t *dc, huff_t *ac)
+{
+    build_huff(&dc[0], esp_jpeg_lum_dc_num_bits, esp_jpeg_lum_dc_values, esp_jpeg_lum_dc_codes_total);
+    build_huff(&ac[0], esp_jpeg_lum_ac_num_bits, esp_jpeg_lum_ac_values, esp_jpeg_lum_ac_codes_total);
+    build_huff(&dc[1], esp_jpeg_chrom_dc_num_bits, esp_jpeg_chrom_dc_values, esp_jpeg_chrom_dc_codes_total);
+    build_huff(&ac[1], esp_jpeg_chrom_ac_num_bits, esp_jpeg_chrom_ac_values, esp_jpeg_chrom_ac_codes_total);
+}
+
+// Optimized tables only have codes for the symbols of the frame they were made for,
+// a changed block may need others
+static bool huff_complete(const huff_t *t, bool ac)
+{
+    if (!ac) {
+        for (int s = 0; s <= 11; s++) {
+            if (!t->size[s]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (!t->size[0x00] || !t->size[0xf0]) {
+        return false;
+    }
+    for (int r = 0; r < 16; r++) {
+        for (int s = 1; s <= 10; s++) {
+            if (!t->size[r << 4 | s]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool parse_sos(patch_t *j, const uint8_t *s, int n)
+{
+    if (n < 1 || s[0] != j->ncomp || n < 4 + 2 * j->ncomp) {
+        return false;           // one interleaved scan of every component only
+    }
+    for (int i = 0; i < j->ncomp; i++) {
+        comp_t *c = &j->comp[i];
+        if (s[1 + 2 * i] != c->id) {
+            return false;
+        }
+        c->td = s[2 + 2 * i] >> 4;
+        c->ta = s[2 + 2 * i] & 0x0f;
+        if (c->td > 3 || c->ta > 3 || !j->dc[c->td].defined || !j->ac[c->ta].defined) {
+            return false;
+        }
+        c->edc = &j->dc[c->td];
+        c->eac = &j->ac[c->ta];
+        j->std_tables |= !huff_complete(c->edc, false) || !huff_complete(c->eac, true);
+    }
+    if (j->std_tables) {
+        load_default_huff(j->std_dc, j->std_ac);
+        for (int i = 0; i < j->ncomp; i++) {
+            j->comp[i].edc = &j->std_dc[i ? 1 : 0];
+            j->comp[i].eac = &j->std_ac[i ? 1 : 0];
+        }
+    }
+    const uint8_t *e = s + 1 + 2 * j->ncomp;
+    return e[0] == 0 && e[1] == 63 && e[2] == 0;
+}
+
+static bool parse_header(patch_t *j)
+{
+    const uint8_t *p = j->src + 2;
+    bool frame = false, dht = false;
+    while (p + 4 <= j->end) {
+        if (p[0] != 0xff) {
+            return false;
+        }
+        const uint8_t marker = p[1];
+        if (marker == 0xff) {
+            p++;
+            continue;
+        }
+        const int len = p[2] << 8 | p[3];
+        const uint8_t *s = p + 4;
+        if (len < 2 || s + len - 2 > j->end) {
+            return false;
+        }
+        const int n = len - 2;
+        bool ok = true;
+        switch (marker) {
+        case 0xc0:
+        case 0xc1:
+            ok = parse_sof(j, s, n);
+            frame = ok;
+            break;
+        case 0xc4:
+            ok = parse_dht(j, s, n);
+            dht = true;
+            break;
+        case 0xdb:
+            ok = parse_dqt(j, s, n);
+            break;
+        case 0xdd:
+            ok = n >= 2;
+            j->restart = (uint16_t)(s[0] << 8 | s[1]);
+            break;
+        case 0xda:
+            if (!dht) {
+                load_default_huff(j->dc, j->ac);
+            }
+            if (!frame || !parse_sos(j, s, n)) {
+                return false;
+            }
+            j->scan = s + n;
+            return true;
+        default:
+            // progressive, lossless and arithmetic coded frames are not handled
+            ok = !(marker >= 0xc2 && marker <= 0xcf && marker != 0xc4 && marker != 0xc8 && marker != 0xcc);
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+        p = s + n;
+    }
+    return false;
+}
+
+/*
+ * Bit reader
+ */
+
+static inline void rd_fill(patch_t *j)
+{
+    while (j->bits <= 24) {
+        uint8_t b = 0;
+        const uint8_t *at = j->p;
+        if (!j->at_marker && j->p < j->end) {
+            b = *j->p;
+            if (b != 0xff) {
+                j->p++;
+            } else if (j->p + 1 < j->end && j->p[1] == 0) {
+                j->p += 2;
+            } else {
+                j->at_marker = true;
+                b = 0;
+            }
+        }
+        j->fed_at[j->fed++ & 7] = at;
+        j->acc |= (uint32_t)b << (24 - j->bits);
+        j->bits += 8;
+    }
+}
+
+static inline uint32_t rd_bits(patch_t *j, int n)
+{
+    rd_fill(j);
+    const uint32_t v = j->acc >> (32 - n);
+    j->acc <<= n;
+    j->bits -= n;
+    return v;
+}
+
+static inline int rd_huff(patch_t *j, const huff_t *t)
+{
+    rd_fill(j);
+    const uint16_t e = t->lookup[j->acc >> (32 - LOOKUP_BITS)];
+    if (e) {
+        const int l = e >> 8;
+        j->acc <<= l;
+        j->bits -= l;
+        return e & 0xff;
+    }
+    for (int l = LOOKUP_BITS + 1; l <= 16; l++) {
+        const int32_t code = (int32_t)(j->acc >> (32 - l));
+        if (code <= t->maxcode[l]) {
+            j->acc <<= l;
+            j->bits -= l;
+            return t->vals[t->delta[l] + code];
+        }
+    }
+    return -1;
+}
+
+// Source position of the next bit: the byte holding it and the bits of that byte already used
+static void rd_position(const patch_t *j, const uint8_t **at, int *used)
+{
+    const int k = (j->bits + 7) / 8;
+    if (!k) {
+        *at = j->p;
+        *used = 0;
+        return;
+    }
+    *at = j->fed_at[(j->fed - k) & 7];
+    *used = (8 - j->bits % 8) % 8;
+}
+
+// Past the restart marker that ends an interval, returns the marker
+static int rd_restart(patch_t *j)
+{
+    j->acc = 0;
+    j->bits = 0;
+    j->at_marker = false;
+    while (j->p + 1 < j->end && !(j->p[0] == 0xff && (j->p[1] & 0xf8) == 0xd0)) {
+        j->p++;
+    }
+    if (j->p + 1 >= j->end) {
+        return -1;
+    }
+    j->p += 2;
+    return j->p[-1];
+}
+
+static inline int extend(int v, int s)
+{
+    return v < (1 << (s - 1)) ? v - (1 << s) + 1 : v;
+}
+
+static bool decode_block(patch_t *j, comp_t *c, int16_t *zz)
+{
+    memset(zz, 0, 64 * sizeof(int16_t));
+    int s = rd_huff(j, &j->dc[c->td]);
+    if (s < 0 || s > 11) {
+        return false;
+    }
+    if (s) {
+        c->dpred += extend(rd_bits(j, s), s);
+    }
+    zz[0] = (int16_t)c->dpred;
+    for (int k = 1; k < 64; k++) {
+        const int rs = rd_huff(j, &j->ac[c->ta]);
+        if (rs < 0) {
+            return false;
+        }
+        s = rs & 0x0f;
+        if (!s) {
+            if (rs != 0xf0) {
+                break;          // EOB
+            }
+            k += 15;
+            continue;
+        }
+        k += rs >> 4;
+        if (k > 63 || s > 10) {
+            return false;
+        }
+        zz[k] = (int16_t)extend(rd_bits(j, s), s);
+    }
+    return true;
+}
+
+/*
+ * Bit writer
+ */
+
+static inline void wr_byte(patch_t *j, uint8_t b)
+{
+    if (j->o < j->out_end) {
+        *j->o++ = b;
+    } else {
+        j->overflow = true;
+    }
+}
+
+static inline void wr_bits(patch_t *j, uint32_t v, int n)
+{
+    if (!n) {
+        return;
+    }
+    j->wacc = (j->wacc << n) | (v & ((1u << n) - 1));
+    j->wbits += n;
+    while (j->wbits >= 8) {
+        const uint8_t b = (uint8_t)(j->wacc >> (j->wbits - 8));
+        j->wbits -= 8;
+        wr_byte(j, b);
+        if (b == 0xff) {
+            wr_byte(j, 0);
+        }
+    }
+}
+
+// Fill the last byte with 1 bits, as before a marker
+static inline void wr_pad(patch_t *j)
+{
+    if (j->wbits) {
+        wr_bits(j, 0xff, 8 - j->wbits);
+    }
+}
+
+static void wr_raw(patch_t *j, const uint8_t *s, size_t len)
+{
+    if (len > (size_t)(j->out_end - j->o)) {
+        j->overflow = true;
+        return;
+    }
+    memcpy(j->o, s, len);
+    j->o += len;
+}
+
+static inline int category(int v)
+{
+    v = v < 0 ? -v : v;
+    return v ? 32 - __builtin_clz((unsigned)v) : 0;
+}
+
+static bool encode_block(patch_t *j, comp_t *c, const int16_t *zz)
+{
+    const huff_t *dc = c->edc, *ac = c->eac;
+    const int diff = zz[0] - c->epred;
+    int s = category(diff);
+    if (!dc->size[s]) {
+        return false;
+    }
+    c->epred = zz[0];
+    wr_bits(j, dc->code[s], dc->size[s]);
+    if (s) {
+        wr_bits(j, diff < 0 ? diff + (1 << s) - 1 : diff, s);
+    }
+
+    int run = 0;
+    for (int k = 1; k < 64; k++) {
+        const int v = zz[k];
+        if (!v) {
+            run++;
+            continue;
+        }
+        for (; run >= 16; run -= 16) {
+            wr_bits(j, ac->code[0xf0], ac->size[0xf0]);
+        }
+        s = category(v);
+        const int rs = run << 4 | s;
+        if (s > 10 || !ac->size[rs]) {
+            return false;
+        }
+        wr_bits(j, ac->code[rs], ac->size[rs]);
+        wr_bits(j, v < 0 ? v + (1 << s) - 1 : v, s);
+        run = 0;
+    }
+    if (run) {
+        wr_bits(j, ac->code[0], ac->size[0]);
+    }
+    return true;
+}
+
+/*
+ * Pixels of a touched MCU
+ */
+
+static void dct_init(void)
+{
+    if (dct_ready) {
+        return;
+    }
+    for (int u = 0; u < 8; u++) {
+        for (int x = 0; x < 8; x++) {
+            dct_m[u][x] = (u ? 0.5f : 0.35355339f) * cosf((2 * x + 1) * u * 3.14159265f / 16);
+        }
+    }
+    dct_ready = true;
+}
+
+static void idct_block(const int16_t *zz, const uint16_t *q, uint8_t *out, int stride)
+{
+    float f[64], t[64];
+    bool ac = false;
+    for (int k = 1; k < 64; k++) {
+        ac |= zz[k] != 0;
+    }
+    if (!ac) {
+        const uint8_t dc = clamp_u8((int)lrintf(zz[0] * q[0] / 8.0f) + 128);
+        for (int y = 0; y < 8; y++) {
+            memset(out + y * stride, dc, 8);
+        }
+        return;
+    }
+    for (int k = 0; k < 64; k++) {
+        f[zigzag[k]] = (float)(zz[k] * q[k]);
+    }
+    for (int v = 0; v < 8; v++) {
+        for (int x = 0; x < 8; x++) {
+            float sum = 0;
+            for (int u = 0; u < 8; u++) {
+                sum += f[v * 8 + u] * dct_m[u][x];
+            }
+            t[v * 8 + x] = sum;
+        }
+    }
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            float sum = 0;
+            for (int v = 0; v < 8; v++) {
+                sum += t[v * 8 + x] * dct_m[v][y];
+            }
+            out[y * stride + x] = clamp_u8((int)lrintf(sum) + 128);
+        }
+    }
+}
+
+static void fdct_block(const uint8_t *in, int stride, const uint16_t *q, int16_t *zz)
+{
+    float t[64], f[64];
+    for (int y = 0; y < 8; y++) {
+        for (int u = 0; u < 8; u++) {
+            float sum = 0;
+            for (int x = 0; x < 8; x++) {
+                sum += (in[y * stride + x] - 128) * dct_m[u][x];
+            }
+            t[y * 8 + u] = sum;
+        }
+    }
+    for (int v = 0; v < 8; v++) {
+        for (int u = 0; u < 8; u++) {
+            float sum = 0;
+            for (int y = 0; y < 8; y++) {
+                sum += t[y * 8 + u] * dct_m[v][y];
+            }
+            f[v * 8 + u] = sum;
+        }
+    }
+    for (int k = 0; k < 64; k++) {
+        zz[k] = (int16_t)lrintf(f[zigzag[k]] / q[k]);
+    }
+}
+
+static inline void ycc2rgb(int y, int cb, int cr, uint8_t *rgb)
+{
+    cb -= 128;
+    cr -= 128;
+    rgb[0] = clamp_u8(y + ((91881 * cr + 32768) >> 16));
+    rgb[1] = clamp_u8(y + ((-22554 * cb - 46802 * cr + 32768) >> 16));
+    rgb[2] = clamp_u8(y + ((116130 * cb + 32768) >> 16));
+}
+
+static inline int rgb2ycc(const uint8_t *rgb, int c)
+{
+    const int r = rgb[0], g = rgb[1], b = rgb[2];
+    switch (c) {
+    case 0:
+        return (19595 * r + 38470 * g + 7471 * b + 32768) >> 16;
+    case 1:
+        return clamp_u8((-11059 * r - 21709 * g + 32768 * b + (128 << 16) + 32768) >> 16);
+    default:
+        return clamp_u8((32768 * r - 27439 * g - 5329 * b + (128 << 16) + 32768) >> 16);
+    }
+}
+
+// Decoded MCU to the callback and back, only blocks with changed pixels get new coefficients
+static void patch_mcu(patch_t *j, int16_t (*zz)[64], uint16_t x0, uint16_t y0, jpg_patch_draw_cb draw, void *arg)
+{
+    uint8_t plane[MAX_COMPS][16 * 16];
+    uint8_t rgb[16 * 16 * 3], before[16 * 16 * 3];
+    bool changed[16 * 16];
+    const int mw = j->hmax * 8, mh = j->vmax * 8;
+    const int w = x0 + mw > j->width ? j->width - x0 : mw;
+    const int h = y0 + mh > j->height ? j->height - y0 : mh;
+
+    int b = 0;
+    for (int c = 0; c < j->ncomp; c++) {
+        const comp_t *cp = &j->comp[c];
+        for (int by = 0; by < cp->v; by++) {
+            for (int bx = 0; bx < cp->h; bx++, b++) {
+                idct_block(zz[b], j->qt[cp->tq], &plane[c][by * 8 * cp->h * 8 + bx * 8], cp->h * 8);
+            }
+        }
+    }
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            uint8_t *px = &rgb[(y * w + x) * 3];
+            const comp_t *c0 = &j->comp[0];
+            const int yv = plane[0][(y * c0->v / j->vmax) * c0->h * 8 + x * c0->h / j->hmax];
+            if (j->ncomp == 1) {
+                px[0] = px[1] = px[2] = (uint8_t)yv;
+                continue;
+            }
+            int s[3];
+            for (int c = 1; c < 3; c++) {
+                const comp_t *cp = &j->comp[c];
+                s[c] = plane[c][(y * cp->v / j->vmax) * cp->h * 8 + x * cp->h / j->hmax];
+            }
+            ycc2rgb(yv, s[1], s[2], px);
+        }
+    }
+    memcpy(before, rgb, w * h * 3);
+    draw(arg, rgb, x0, y0, w, h);
+    bool any = false;
+    for (int i = 0; i < w * h; i++) {
+        changed[i] = memcmp(&rgb[i * 3], &before[i * 3], 3) != 0;
+        any |= changed[i];
+    }
+    if (!any) {
+        return;
+    }
+
+    b = 0;
+    for (int c = 0; c < j->ncomp; c++) {
+        const comp_t *cp = &j->comp[c];
+        const int sx = j->hmax / cp->h, sy = j->vmax / cp->v;   // pixels per sample
+        const int stride = cp->h * 8;
+        bool dirty[4] = { false };
+        for (int py = 0; py < cp->v * 8; py++) {
+            for (int px = 0; px < stride; px++) {
+                uint8_t *sample = &plane[c][py * stride + px];
+                int sum = 0, n = 0;
+                bool touched = false;
+                for (int dy = 0; dy < sy; dy++) {
+                    for (int dx = 0; dx < sx; dx++) {
+                        const int x = px * sx + dx, y = py * sy + dy;
+                        if (x >= w || y >= h) {
+                            continue;
+                        }
+                        const int i = y * w + x;
+                        touched |= changed[i];
+                        sum += changed[i] ? (j->ncomp == 1 ? rgb2ycc(&rgb[i * 3], 0) : rgb2ycc(&rgb[i * 3], c))
+                                          : *sample;
+                        n++;
+                    }
+                }
+                if (touched) {
+                    *sample = (uint8_t)((sum + n / 2) / n);
+                    dirty[(py / 8) * cp->h + px / 8] = true;
+                }
+            }
+        }
+        for (int by = 0; by < cp->v; by++) {
+            for (int bx = 0; bx < cp->h; bx++, b++) {
+                if (dirty[by * cp->h + bx]) {
+                    fdct_block(&plane[c][by * 8 * stride + bx * 8], stride, j->qt[cp->tq], zz[b]);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Scan
+ */
+
+static void wr_dht(patch_t *j, uint8_t tc_th, const unsigned char *counts, const unsigned char *vals, unsigned total)
+{
+    wr_byte(j, tc_th);
+    wr_raw(j, counts, 16);
+    wr_raw(j, vals, total);
+}
+
+// The source header with the Annex K tables in place of its own
+static void write_std_header(patch_t *j)
+{
+    wr_byte(j, 0xff);
+    wr_byte(j, 0xd8);
+    const uint8_t *p = j->src + 2;
+    while (p < j->scan) {
+        if (p[1] == 0xff) {
+            p++;
+            continue;
+        }
+        const int len = p[2] << 8 | p[3];
+        if (p[1] == 0xda) {
+            const int dht_len = 2 + 4 * 17 + esp_jpeg_lum_dc_codes_total + esp_jpeg_lum_ac_codes_total
+                                + esp_jpeg_chrom_dc_codes_total + esp_jpeg_chrom_ac_codes_total;
+            wr_byte(j, 0xff);
+            wr_byte(j, 0xc4);
+            wr_byte(j, (uint8_t)(dht_len >> 8));
+            wr_byte(j, (uint8_t)dht_len);
+            wr_dht(j, 0x00, esp_jpeg_lum_dc_num_bits, esp_jpeg_lum_dc_values, esp_jpeg_lum_dc_codes_total);
+            wr_dht(j, 0x10, esp_jpeg_lum_ac_num_bits, esp_jpeg_lum_ac_values, esp_jpeg_lum_ac_codes_total);
+            wr_dht(j, 0x01, esp_jpeg_chrom_dc_num_bits, esp_jpeg_chrom_dc_values, esp_jpeg_chrom_dc_codes_total);
+            wr_dht(j, 0x11, esp_jpeg_chrom_ac_num_bits, esp_jpeg_chrom_ac_values, esp_jpeg_chrom_ac_codes_total);
+            wr_raw(j, p, 5);
+            for (int i = 0; i < j->ncomp; i++) {
+                wr_byte(j, j->comp[i].id);
+                wr_byte(j, i ? 0x11 : 0x00);
+            }
+            wr_raw(j, j->scan - 3, 3);
+        } else if (p[1] != 0xc4) {
+            wr_raw(j, p, 2 + len);
+        }
+        p += 2 + len;
+    }
+}
+
+// The rest of the scan from a bit position, shifted to where the output is
+static void copy_tail(patch_t *j, const uint8_t *p, int used)
+{
+    if (used) {
+        const uint8_t b = *p;
+        p += b == 0xff ? 2 : 1;
+        wr_bits(j, b, 8 - used);
+    }
+    while (p < j->end) {
+        if (!j->wbits) {
+            wr_raw(j, p, j->end - p);   // aligned: the same bytes from here
+            return;
+        }
+        if (p[0] != 0xff) {
+            wr_bits(j, *p++, 8);
+        } else if (p + 1 < j->end && p[1] == 0) {
+            wr_bits(j, 0xff, 8);
+            p += 2;
+        } else {
+            wr_pad(j);                  // a marker, restart or end of the scan
+            wr_raw(j, p, j->end - p);
+            return;
+        }
+    }
+    wr_pad(j);
+}
+
+static bool patch_scan(patch_t *j, const uint8_t *touched, uint32_t first, uint32_t last,
+                       jpg_patch_draw_cb draw, void *arg)
+{
+    const uint32_t mcus_x = (j->width + j->hmax * 8 - 1) / (j->hmax * 8);
+    const uint32_t total = mcus_x * ((j->height + j->vmax * 8 - 1) / (j->vmax * 8));
+    int16_t zz[MAX_BLOCKS][64];
+    bool writing = false;
+    const uint8_t *at;
+    int used;
+
+    j->p = j->scan;
+    for (uint32_t m = 0; m < total; m++) {
+        if (j->restart && m && m % j->restart == 0) {
+            const int marker = rd_restart(j);
+            if (marker < 0) {
+                return false;
+            }
+            for (int c = 0; c < j->ncomp; c++) {
+                j->comp[c].dpred = j->comp[c].epred = 0;
+            }
+            if (writing) {
+                wr_pad(j);
+                wr_byte(j, 0xff);
+                wr_byte(j, (uint8_t)marker);
+            }
+        }
+        if (m == first && j->std_tables) {
+            write_std_header(j);
+            writing = true;
+        } else if (m == first) {
+            // the source as it is up to here
+            rd_position(j, &at, &used);
+            wr_raw(j, j->src, at - j->src);
+            wr_bits(j, *at >> (8 - used), used);
+            for (int c = 0; c < j->ncomp; c++) {
+                j->comp[c].epred = j->comp[c].dpred;
+            }
+            writing = true;
+        }
+        if (writing && m > last) {
+            bool in_step = true;
+            for (int c = 0; c < j->ncomp; c++) {
+                in_step &= j->comp[c].epred == j->comp[c].dpred;
+            }
+            if (in_step) {
+                rd_position(j, &at, &used);
+                copy_tail(j, at, used);
+                return !j->overflow;
+            }
+        }
+
+        int b = 0;
+        for (int c = 0; c < j->ncomp; c++) {
+            for (int i = 0; i < j->comp[c].h * j->comp[c].v; i++, b++) {
+                if (!decode_block(j, &j->comp[c], zz[b])) {
+                    ESP_LOGW(TAG, "Bad Huffman code in MCU %u", (unsigned)m);
+                    return false;
+                }
+            }
+        }
+        if (!writing) {
+            continue;
+        }
+        if (touched[m >> 3] & (1 << (m & 7))) {
+            patch_mcu(j, zz, (uint16_t)((m % mcus_x) * j->hmax * 8), (uint16_t)((m / mcus_x) * j->vmax * 8),
+                      draw, arg);
+        }
+        b = 0;
+        for (int c = 0; c < j->ncomp; c++) {
+            for (int i = 0; i < j->comp[c].h * j->comp[c].v; i++, b++) {
+                if (!encode_block(j, &j->comp[c], zz[b])) {
+                    return false;
+                }
+            }
+        }
+        if (j->overflow) {
+            return false;
+        }
+    }
+
+    // touched up to the last MCU: pad, then the markers after the scan
+    wr_pad(j);
+    rd_position(j, &at, &used);
+    while (at + 1 < j->end && !(at[0] == 0xff && at[1] != 0 && at[1] != 0xff)) {
+        at++;
+    }
+    if (at + 1 < j->end) {
+        wr_raw(j, at, j->end - at);
+    } else {
+        wr_byte(j, 0xff);
+        wr_byte(j, 0xd9);
+    }
+    return !j->overflow;
+}
+
+bool jpg_patch(const uint8_t *src, size_t src_len, const jpg_roi_rect_t *rects, size_t count,
+               jpg_patch_draw_cb draw, void *arg, uint8_t *out, size_t out_cap, size_t *out_len)
+{
+    if (!src || src_len < 4 || src[0] != 0xff || src[1] != 0xd8 || !draw || !out || !out_len) {
+        return false;
+    }
+    patch_t *j = (patch_t *)_malloc(sizeof(patch_t));
+    if (!j) {
+        ESP_LOGE(TAG, "Patch state alloc failed");
+        return false;
+    }
+    memset(j, 0, sizeof(*j));
+    j->src = src;
+    j->end = src + src_len;
+    j->out = j->o = out;
+    j->out_end = out + out_cap;
+    if (!parse_header(j)) {
+        ESP_LOGW(TAG, "Not a baseline JPEG this can patch");
+        free(j);
+        return false;
+    }
+
+    const uint32_t mw = j->hmax * 8, mh = j->vmax * 8;
+    const uint32_t mcus_x = (j->width + mw - 1) / mw;
+    const uint32_t total = mcus_x * ((j->height + mh - 1) / mh);
+    uint8_t *touched = (uint8_t *)_malloc((total + 7) / 8);
+    if (!touched) {
+        ESP_LOGE(TAG, "MCU map alloc failed");
+        free(j);
+        return false;
+    }
+    memset(touched, 0, (total + 7) / 8);
+    uint32_t first = total, last = 0;
+    for (size_t i = 0; i < count; i++) {
+        const jpg_roi_rect_t *r = &rects[i];
+        if (!r->w || !r->h || r->x >= j->width || r->y >= j->height) {
+            continue;
+        }
+        const uint32_t x1 = (r->x + r->w > j->width ? j->width : r->x + r->w) - 1;
+        const uint32_t y1 = (r->y + r->h > j->height ? j->height : r->y + r->h) - 1;
+        for (uint32_t my = r->y / mh; my <= y1 / mh; my++) {
+            for (uint32_t mx = r->x / mw; mx <= x1 / mw; mx++) {
+                const uint32_t m = my * mcus_x + mx;
+                touched[m >> 3] |= 1 << (m & 7);
+                first = m < first ? m : first;
+                last = m > last ? m : last;
+            }
+        }
+    }
+
+    bool ok;
+    if (first == total) {
+        ok = src_len <= out_cap;
+        if (ok) {
+            memcpy(out, src, src_len);
+            j->o = out + src_len;
+        }
+    } else {
+        if (j->std_tables) {
+            // every MCU is coded with the new tables
+            first = 0;
+            last = total;
+        }
+        dct_init();
+        ok = patch_scan(j, touched, first, last, draw, arg);
+    }
+    *out_len = j->o - out;
+    free(touched);
+    free(j);
+    return ok;
+}
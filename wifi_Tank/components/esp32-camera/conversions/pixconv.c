@@ -0,0 +1,118 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include "pixconv.h"
+#include "yuv.h"
+#include "esp_attr.h"
+
+// Compiles to MIN/MAX on Xtensa, no branches
+static inline uint8_t clamp_u8(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+/*
+ * One YUV422 macro pixel (Y0 U Y1 V) to two RGB triplets. The chroma terms are
+ * looked up once and shared by both pixels.
+ */
+#define YUV422_PAIR(src, r0, g0, b0, r1, g1, b1) do {                           \
+        const int y0_ = yuv_table[(src)[0]].vY;                                 \
+        const int y1_ = yuv_table[(src)[2]].vY;                                 \
+        const int rv_ = yuv_table[(src)[3]].vVr;                                \
+        const int guv_ = yuv_table[(src)[1]].vUg + yuv_table[(src)[3]].vVg;     \
+        const int bu_ = yuv_table[(src)[1]].vUb;                                \
+        r0 = clamp_u8(y0_ + rv_); g0 = clamp_u8(y0_ + guv_); b0 = clamp_u8(y0_ + bu_); \
+        r1 = clamp_u8(y1_ + rv_); g1 = clamp_u8(y1_ + guv_); b1 = clamp_u8(y1_ + bu_); \
+    } while (0)
+
+void IRAM_ATTR pixconv_yuv422_to_rgb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i += 2, src += 4, dst += 6) {
+        YUV422_PAIR(src, dst[0], dst[1], dst[2], dst[3], dst[4], dst[5]);
+    }
+}
+
+void IRAM_ATTR pixconv_yuv422_to_bgr888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i += 2, src += 4, dst += 6) {
+        YUV422_PAIR(src, dst[2], dst[1], dst[0], dst[5], dst[4], dst[3]);
+    }
+}
+
+void IRAM_ATTR pixconv_yuv422_to_rgb565(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    uint8_t r0, g0, b0, r1, g1, b1;
+    for (size_t i = 0; i < pixels; i += 2, src += 4, dst += 4) {
+        YUV422_PAIR(src, r0, g0, b0, r1, g1, b1);
+        dst[0] = (r0 & 0xF8) | (g0 >> 5);
+        dst[1] = ((g0 & 0x1C) << 3) | (b0 >> 3);
+        dst[2] = (r1 & 0xF8) | (g1 >> 5);
+        dst[3] = ((g1 & 0x1C) << 3) | (b1 >> 3);
+    }
+}
+
+void IRAM_ATTR pixconv_yuv422_to_y8(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i += 2, src += 4, dst += 2) {
+        dst[0] = src[0];
+        dst[1] = src[2];
+    }
+}
+
+void IRAM_ATTR pixconv_rgb565_to_rgb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++, src += 2, dst += 3) {
+        const uint8_t hb = src[0], lb = src[1];
+        dst[0] = hb & 0xF8;
+        dst[1] = (hb & 0x07) << 5 | (lb & 0xE0) >> 3;
+        dst[2] = (lb & 0x1F) << 3;
+    }
+}
+
+void IRAM_ATTR pixconv_rgb565_to_bgr888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++, src += 2, dst += 3) {
+        const uint8_t hb = src[0], lb = src[1];
+        dst[0] = (lb & 0x1F) << 3;
+        dst[1] = (hb & 0x07) << 5 | (lb & 0xE0) >> 3;
+        dst[2] = hb & 0xF8;
+    }
+}
+
+void IRAM_ATTR pixconv_rgb888_to_rgb565(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++, src += 3, dst += 2) {
+        dst[0] = (src[0] & 0xF8) | (src[1] >> 5);
+        dst[1] = ((src[1] & 0x1C) << 3) | (src[2] >> 3);
+    }
+}
+
+void IRAM_ATTR pixconv_y8_to_rgb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++, dst += 3) {
+        const uint8_t y = src[i];
+        dst[0] = y;
+        dst[1] = y;
+        dst[2] = y;
+    }
+}
+
+void IRAM_ATTR pixconv_swap_rb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++, src += 3, dst += 3) {
+        const uint8_t t = src[0];
+        dst[1] = src[1];
+        dst[0] = src[2];
+        dst[2] = t;
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _CONVERSIONS_PIXCONV_H_
+#define _CONVERSIONS_PIXCONV_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Row converters between the camera pixel formats.
+ *
+ * Every function converts `pixels` pixels from src to dst in one call, without
+ * per-pixel function calls. Byte orders follow the camera frame buffers:
+ *   RGB565 - big endian, high byte first
+ *   YUV422 - Y0 U Y1 V, pixels must be even
+ *   RGB888 - R G B
+ *   BGR888 - B G R (the order fmt2rgb888() and the BMP writer produce)
+ * Results are bit exact with the per-pixel code in to_bmp.c / to_jpg.cpp.
+ */
+
+void pixconv_yuv422_to_rgb888(const uint8_t *src, uint8_t *dst, size_t pixels);
+void pixconv_yuv422_to_bgr888(const uint8_t *src, uint8_t *dst, size_t pixels);
+void pixconv_yuv422_to_rgb565(const uint8_t *src, uint8_t *dst, size_t pixels);
+void pixconv_yuv422_to_y8(const uint8_t *src, uint8_t *dst, size_t pixels);
+
+void pixconv_rgb565_to_rgb888(const uint8_t *src, uint8_t *dst, size_t pixels);
+void pixconv_rgb565_to_bgr888(const uint8_t *src, uint8_t *dst, size_t pixels);
+void pixconv_rgb888_to_rgb565(const uint8_t *src, uint8_t *dst, size_t pixels);
+
+void pixconv_y8_to_rgb888(const uint8_t *src, uint8_t *dst, size_t pixels);
+
+// RGB888 <-> BGR888, src and dst may be the same buffer
+void pixconv_swap_rb888(const uint8_t *src, uint8_t *dst, size_t pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CONVERSIONS_PIXCONV_H_ */
@@ -0,0 +1,214 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include "img_converters.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "yuv.h"
+#include "sdkconfig.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#define TAG ""
+#else
+#include "esp_log.h"
+static const char* TAG = "to_scaled";
+#endif
+
+/*
+ * Box filter downscale fused with the pixel format conversion.
+ *
+ * Source rows are summed into per output column accumulators (Y/U/V for
+ * YUV422 sources, R/G/B for RGB565 sources), so the expensive part of the
+ * conversion runs once per output pixel instead of once per source pixel.
+ * Output column i averages source columns [i*w/ow, (i+1)*w/ow), rows likewise.
+ */
+
+typedef struct {
+    uint16_t x0;
+    uint16_t x1;
+} span_t;
+
+static void *_malloc(size_t size)
+{
+    void * res = malloc(size);
+    if(res) {
+        return res;
+    }
+#if ((CONFIG_SPIRAM || CONFIG_SPIRAM_SUPPORT) && (CONFIG_SPIRAM_USE_CAPS_ALLOC || CONFIG_SPIRAM_USE_MALLOC))
+    return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#endif
+    return NULL;
+}
+
+static inline uint8_t clamp_u8(int v)
+{
+    return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+// Rounded average, a shift for the power of two boxes of the 1/2, 1/4 and 1/8 scales
+static inline uint32_t box_avg(uint32_t sum, uint32_t count, int shift)
+{
+    if (shift >= 0) {
+        return (sum + (count >> 1)) >> shift;
+    }
+    return (sum + (count >> 1)) / count;
+}
+
+static int log2_exact(uint32_t v)
+{
+    if (!v || (v & (v - 1))) {
+        return -1;
+    }
+    int s = 0;
+    while (v >>= 1) {
+        s++;
+    }
+    return s;
+}
+
+static IRAM_ATTR void accumulate_yuv422_row(const uint8_t *row, const span_t *cols, uint16_t out_width, uint32_t *acc)
+{
+    for (int ox = 0; ox < out_width; ox++, acc += 3) {
+        uint32_t sy = 0, su = 0, sv = 0;
+        int x = cols[ox].x0;
+        // odd leading pixel, then whole Y0 U Y1 V macro pixels
+        if (x & 1) {
+            const uint8_t *p = row + (x - 1) * 2;
+            sy += p[2]; su += p[1]; sv += p[3];
+            x++;
+        }
+        for (; x + 1 < cols[ox].x1; x += 2) {
+            const uint8_t *p = row + x * 2;
+            sy += p[0] + p[2]; su += p[1] << 1; sv += p[3] << 1;
+        }
+        if (x < cols[ox].x1) {
+            const uint8_t *p = row + x * 2;
+            sy += p[0]; su += p[1]; sv += p[3];
+        }
+        acc[0] += sy; acc[1] += su; acc[2] += sv;
+    }
+}
+
+static IRAM_ATTR void accumulate_rgb565_row(const uint8_t *row, const span_t *cols, uint16_t out_width, uint32_t *acc)
+{
+    for (int ox = 0; ox < out_width; ox++, acc += 3) {
+        uint32_t sr = 0, sg = 0, sb = 0;
+        for (int x = cols[ox].x0; x < cols[ox].x1; x++) {
+            const uint8_t hb = row[x * 2], lb = row[x * 2 + 1];
+            sr += hb & 0xF8;
+            sg += (hb & 0x07) << 5 | (lb & 0xE0) >> 3;
+            sb += (lb & 0x1F) << 3;
+        }
+        acc[0] += sr; acc[1] += sg; acc[2] += sb;
+    }
+}
+
+static IRAM_ATTR void emit_row(const uint32_t *acc, const span_t *cols, uint16_t out_width, uint32_t rows, bool yuv,
+                               pixformat_t out_format, uint8_t *dst)
+{
+    for (int ox = 0; ox < out_width; ox++, acc += 3) {
+        const uint32_t count = (cols[ox].x1 - cols[ox].x0) * rows;
+        const int shift = log2_exact(count);
+        const uint8_t c0 = box_avg(acc[0], count, shift);
+        const uint8_t c1 = box_avg(acc[1], count, shift);
+        const uint8_t c2 = box_avg(acc[2], count, shift);
+        uint8_t r, g, b;
+
+        if (yuv) {
+            if (out_format == PIXFORMAT_GRAYSCALE) {
+                *dst++ = c0;
+                continue;
+            }
+            const int y = yuv_table[c0].vY;
+            r = clamp_u8(y + yuv_table[c2].vVr);
+            g = clamp_u8(y + yuv_table[c1].vUg + yuv_table[c2].vVg);
+            b = clamp_u8(y + yuv_table[c1].vUb);
+        } else {
+            r = c0; g = c1; b = c2;
+        }
+
+        if (out_format == PIXFORMAT_RGB888) {
+            // same byte order as fmt2rgb888()
+            *dst++ = b; *dst++ = g; *dst++ = r;
+        } else if (out_format == PIXFORMAT_RGB565) {
+            *dst++ = (r & 0xF8) | (g >> 5);
+            *dst++ = ((g & 0x1C) << 3) | (b >> 3);
+        } else {
+            *dst++ = (r * 77 + g * 150 + b * 29 + 128) >> 8;
+        }
+    }
+}
+
+bool fmt2scaled(const uint8_t *src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format,
+                uint16_t out_width, uint16_t out_height, pixformat_t out_format, uint8_t *out)
+{
+    if (format != PIXFORMAT_YUV422 && format != PIXFORMAT_RGB565) {
+        ESP_LOGE(TAG, "Unsupported source format %d", format);
+        return false;
+    }
+    if (out_format != PIXFORMAT_RGB888 && out_format != PIXFORMAT_RGB565 && out_format != PIXFORMAT_GRAYSCALE) {
+        ESP_LOGE(TAG, "Unsupported output format %d", out_format);
+        return false;
+    }
+    if (!out_width || !out_height || out_width > width || out_height > height || src_len < (size_t)width * height * 2) {
+        ESP_LOGE(TAG, "Invalid size %ux%u -> %ux%u", width, height, out_width, out_height);
+        return false;
+    }
+
+    const size_t out_bpp = out_format == PIXFORMAT_RGB888 ? 3 : (out_format == PIXFORMAT_RGB565 ? 2 : 1);
+    const bool yuv = format == PIXFORMAT_YUV422;
+    span_t *cols = (span_t *)_malloc(out_width * sizeof(span_t));
+    uint32_t *acc = (uint32_t *)_malloc(out_width * 3 * sizeof(uint32_t));
+    if (!cols || !acc) {
+        ESP_LOGE(TAG, "Scaler malloc failed");
+        free(cols);
+        free(acc);
+        return false;
+    }
+    for (int ox = 0; ox < out_width; ox++) {
+        cols[ox].x0 = (uint32_t)ox * width / out_width;
+        cols[ox].x1 = (uint32_t)(ox + 1) * width / out_width;
+    }
+
+    for (int oy = 0; oy < out_height; oy++) {
+        const uint32_t y0 = (uint32_t)oy * height / out_height;
+        const uint32_t y1 = (uint32_t)(oy + 1) * height / out_height;
+        memset(acc, 0, out_width * 3 * sizeof(uint32_t));
+        for (uint32_t y = y0; y < y1; y++) {
+            const uint8_t *row = src + (size_t)y * width * 2;
+            if (yuv) {
+                accumulate_yuv422_row(row, cols, out_width, acc);
+            } else {
+                accumulate_rgb565_row(row, cols, out_width, acc);
+            }
+        }
+        emit_row(acc, cols, out_width, y1 - y0, yuv, out_format, out + (size_t)oy * out_width * out_bpp);
+    }
+
+    free(cols);
+    free(acc);
+    return true;
+}
+
+bool frame2scaled(camera_fb_t * fb, uint8_t scale_div, pixformat_t out_format, uint8_t *out)
+{
+    if (!scale_div) {
+        return false;
+    }
+    return fmt2scaled(fb->buf, fb->len, fb->width, fb->height, fb->format,
+                      fb->width / scale_div, fb->height / scale_div, out_format, out);
+}
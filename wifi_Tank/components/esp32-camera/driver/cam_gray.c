@@ -0,0 +1,298 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "jpeg_decoder.h"
+#include "cam_hal.h"
+#include "cam_gray.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#define TAG ""
+#else
+#include "esp_log.h"
+static const char *TAG = "cam_gray";
+#endif
+
+#define CAM_GRAY_TASK_STACK (4*1024)
+
+#define CAM_GRAY_WORK_SIZE ESP_JPEG_WORK_BUF_SIZE
+
+typedef struct {
+    camera_fb_t *fbs;
+    uint8_t fb_count;
+    size_t fb_size;             // bytes of each grayscale buffer
+    QueueHandle_t free_queue;   // buffers to derive into
+    QueueHandle_t ready_queue;  // derived frames for cam_gray_take()
+    uint8_t *work;              // tjpgd work area
+    uint8_t *band;              // one band of RGB888 rows
+    size_t band_size;
+    esp_jpeg_image_scale_t scale;
+    TaskHandle_t task;
+    SemaphoreHandle_t done;     // given by the task as it ends
+    camera_gray_stats_t stats;
+} cam_gray_t;
+
+typedef struct {
+    uint8_t *buf;
+    size_t size;
+} cam_gray_out_t;
+
+static cam_gray_t *s_gray = NULL;
+static portMUX_TYPE g_gray_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void cam_gray_count(uint32_t *counter)
+{
+    portENTER_CRITICAL(&g_gray_lock);
+    (*counter)++;
+    portEXIT_CRITICAL(&g_gray_lock);
+}
+
+/* RGB888 band rows to Y8 with the weights of fmt2scaled() */
+static bool cam_gray_band(const esp_jpeg_band_t *band, void *arg)
+{
+    const cam_gray_out_t *out = arg;
+    for (int y = 0; y < band->height; y++) {
+        const size_t offset = (size_t)(band->y + y) * band->width;
+        if (offset + band->width > out->size) {
+            break;
+        }
+        const uint8_t *src = band->data + y * band->stride;
+        uint8_t *dst = out->buf + offset;
+        for (int x = 0; x < band->width; x++, src += 3) {
+            dst[x] = (src[0] * 77 + src[1] * 150 + src[2] * 29 + 128) >> 8;
+        }
+    }
+    return true;
+}
+
+static bool cam_gray_decode(const camera_fb_t *jpeg, camera_fb_t *fb)
+{
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = jpeg->buf,
+        .indata_size = jpeg->len,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888,
+        .out_scale = s_gray->scale,
+        .advanced.working_buffer = s_gray->work,
+        .advanced.working_buffer_size = CAM_GRAY_WORK_SIZE,
+    };
+    esp_jpeg_image_output_t img = {0};
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return false;
+    }
+    // a frame size above the one the buffers were sized for; width and height are the unscaled ones here
+    if (img.output_len / 3 > s_gray->fb_size ||
+        esp_jpeg_get_band_size(&cfg, NULL) > s_gray->band_size) {
+        ESP_LOGW(TAG, "Frame %ux%u does not fit", img.width, img.height);
+        return false;
+    }
+    cam_gray_out_t out = { fb->buf, s_gray->fb_size };
+    const esp_jpeg_band_cfg_t band_cfg = {
+        .callback = cam_gray_band,
+        .arg = &out,
+        .buffer = s_gray->band,
+        .buffer_size = s_gray->band_size,
+        .band_count = 1,
+    };
+    if (esp_jpeg_decode_bands(&cfg, &band_cfg, &img) != ESP_OK) {
+        return false;
+    }
+    fb->width = img.width;
+    fb->height = img.height;
+    fb->len = (size_t)img.width * img.height;
+    fb->timestamp = jpeg->timestamp;
+    fb->sequence = jpeg->sequence;
+    fb->capture_start_us = jpeg->capture_start_us;
+    fb->capture_end_us = jpeg->capture_end_us;
+    return true;
+}
+
+static void cam_gray_derive(const camera_fb_t *jpeg)
+{
+    camera_fb_t *fb = NULL;
+    cam_gray_count(&s_gray->stats.taken);
+    if (xQueueReceive(s_gray->free_queue, (void *)&fb, 0) != pdTRUE) {
+        // the oldest derived frame nobody took yet makes room for this one
+        if (xQueueReceive(s_gray->ready_queue, (void *)&fb, 0) != pdTRUE) {
+            cam_gray_count(&s_gray->stats.no_fb);
+            return;
+        }
+        cam_gray_count(&s_gray->stats.replaced);
+    }
+    if (!cam_gray_decode(jpeg, fb)) {
+        cam_gray_count(&s_gray->stats.decode_failed);
+        xQueueSend(s_gray->free_queue, (void *)&fb, 0);
+        return;
+    }
+    xQueueSend(s_gray->ready_queue, (void *)&fb, 0);
+    cam_gray_count(&s_gray->stats.derived);
+}
+
+static void cam_gray_task(void *arg)
+{
+    camera_fb_t *jpeg;
+    while ((jpeg = cam_tap_take(portMAX_DELAY)) != NULL) {
+        cam_gray_derive(jpeg);
+        cam_tap_give(jpeg);
+    }
+    xSemaphoreGive(s_gray->done);
+    vTaskDelete(NULL);
+}
+
+static void cam_gray_free(cam_gray_t *gray)
+{
+    if (gray->fbs) {
+        for (int i = 0; i < gray->fb_count; i++) {
+            heap_caps_free(gray->fbs[i].buf);
+        }
+        heap_caps_free(gray->fbs);
+    }
+    if (gray->free_queue) {
+        vQueueDelete(gray->free_queue);
+    }
+    if (gray->ready_queue) {
+        vQueueDelete(gray->ready_queue);
+    }
+    if (gray->done) {
+        vSemaphoreDelete(gray->done);
+    }
+    heap_caps_free(gray->work);
+    heap_caps_free(gray->band);
+    heap_caps_free(gray);
+}
+
+static esp_jpeg_image_scale_t cam_gray_scale(uint8_t scale_div)
+{
+    switch (scale_div) {
+    case 2: return JPEG_IMAGE_SCALE_1_2;
+    case 4: return JPEG_IMAGE_SCALE_1_4;
+    case 8: return JPEG_IMAGE_SCALE_1_8;
+    default: return JPEG_IMAGE_SCALE_0;
+    }
+}
+
+static void *cam_gray_alloc(cam_gray_t *gray, size_t size)
+{
+    void *p = heap_caps_malloc(size, MALLOC_CAP_8BIT);
+    if (p) {
+        gray->stats.memory += size;
+    }
+    return p;
+}
+
+esp_err_t cam_gray_start(const camera_gray_config_t *config, uint16_t max_width, uint16_t max_height)
+{
+    if (!config || !config->every || !config->fb_count || cam_gray_scale(config->scale_div) == JPEG_IMAGE_SCALE_0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_gray) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    cam_gray_t *gray = heap_caps_calloc(1, sizeof(cam_gray_t), MALLOC_CAP_8BIT);
+    if (!gray) {
+        return ESP_ERR_NO_MEM;
+    }
+    const uint16_t width = max_width / config->scale_div;
+    const uint16_t lines = config->scale_div < 16 ? 16 / config->scale_div : 1;   // MCUs are up to 16 rows
+    gray->scale = cam_gray_scale(config->scale_div);
+    gray->fb_size = (size_t)width * (max_height / config->scale_div);
+    gray->band_size = (size_t)width * lines * 3;
+    gray->work = cam_gray_alloc(gray, CAM_GRAY_WORK_SIZE);
+    gray->band = cam_gray_alloc(gray, gray->band_size);
+    gray->fbs = cam_gray_alloc(gray, config->fb_count * sizeof(camera_fb_t));
+    gray->free_queue = xQueueCreate(config->fb_count, sizeof(camera_fb_t *));
+    gray->ready_queue = xQueueCreate(config->fb_count, sizeof(camera_fb_t *));
+    gray->done = xSemaphoreCreateBinary();
+    if (!gray->work || !gray->band || !gray->fbs || !gray->free_queue || !gray->ready_queue || !gray->done) {
+        cam_gray_free(gray);
+        return ESP_ERR_NO_MEM;
+    }
+    memset(gray->fbs, 0, config->fb_count * sizeof(camera_fb_t));
+    for (gray->fb_count = 0; gray->fb_count < config->fb_count; gray->fb_count++) {
+        camera_fb_t *fb = &gray->fbs[gray->fb_count];
+        fb->buf = cam_gray_alloc(gray, gray->fb_size);
+        if (!fb->buf) {
+            cam_gray_free(gray);
+            return ESP_ERR_NO_MEM;
+        }
+        fb->format = PIXFORMAT_GRAYSCALE;
+        xQueueSend(gray->free_queue, (void *)&fb, 0);
+    }
+
+    s_gray = gray;
+    esp_err_t ret = cam_tap_start(config->every);
+    if (ret != ESP_OK) {
+        s_gray = NULL;
+        cam_gray_free(gray);
+        return ret;
+    }
+    const BaseType_t core = config->task_core < 0 ? tskNO_AFFINITY : config->task_core;
+    if (xTaskCreatePinnedToCore(cam_gray_task, "cam_gray", CAM_GRAY_TASK_STACK, NULL, config->task_priority,
+                                &gray->task, core) != pdPASS) {
+        cam_tap_stop();
+        s_gray = NULL;
+        cam_gray_free(gray);
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGI(TAG, "Every %u frames at 1/%u, %u buffers of %u bytes", config->every, config->scale_div,
+             config->fb_count, (unsigned)gray->fb_size);
+    return ESP_OK;
+}
+
+esp_err_t cam_gray_stop(void)
+{
+    if (!s_gray) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    cam_tap_stop();
+    xSemaphoreTake(s_gray->done, portMAX_DELAY);
+    cam_gray_free(s_gray);
+    s_gray = NULL;
+    return ESP_OK;
+}
+
+camera_fb_t *cam_gray_take(TickType_t timeout)
+{
+    camera_fb_t *fb = NULL;
+    if (!s_gray || xQueueReceive(s_gray->ready_queue, (void *)&fb, timeout) != pdTRUE) {
+        return NULL;
+    }
+    return fb;
+}
+
+void cam_gray_give(camera_fb_t *fb)
+{
+    if (!s_gray || fb < s_gray->fbs || fb >= s_gray->fbs + s_gray->fb_count) {
+        return;
+    }
+    xQueueSend(s_gray->free_queue, (void *)&fb, 0);
+}
+
+esp_err_t cam_gray_get_stats(camera_gray_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_gray) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&g_gray_lock);
+    *stats = s_gray->stats;
+    portEXIT_CRITICAL(&g_gray_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,954 @@
+// Copyright 2010-2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdalign.h>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ll_cam.h"
+#include "cam_hal.h"
+#include "cam_jpeg_scan.h"
+
+#if (ESP_IDF_VERSION_MAJOR == 3) && (ESP_IDF_VERSION_MINOR == 3)
+#include "rom/ets_sys.h"
+#else
+#include "esp_timer.h"
+#include "esp_cache.h"
+#include "hal/cache_hal.h"
+#include "hal/cache_ll.h"
+#include "esp_idf_version.h"
+#ifndef ESP_CACHE_MSYNC_FLAG_DIR_M2C
+#define ESP_CACHE_MSYNC_FLAG_DIR_M2C 0
+#endif
+#if CONFIG_IDF_TARGET_ESP32
+#include "esp32/rom/ets_sys.h"  // will be removed in idf v5.0
+#elif CONFIG_IDF_TARGET_ESP32S2
+#include "esp32s2/rom/ets_sys.h"
+#elif CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/ets_sys.h"
+#endif
+#endif // ESP_IDF_VERSION_MAJOR
+
+#if CONFIG_LOG_DEFAULT_LEVEL_NONE
+#define ESP_CAMERA_ETS_PRINTF(f, ...)
+#else
+#define ESP_CAMERA_ETS_PRINTF(f, ...) ets_printf(f, ##__VA_ARGS__)
+#endif
+
+#if CONFIG_CAMERA_TASK_STACK_SIZE
+#define CAM_TASK_STACK             CONFIG_CAMERA_TASK_STACK_SIZE
+#else
+#define CAM_TASK_STACK             (4*1024)
+#endif
+
+static const char *TAG = "cam_hal";
+static cam_obj_t *cam_obj = NULL;
+#if defined(CONFIG_CAMERA_PSRAM_DMA)
+#define CAMERA_PSRAM_DMA_ENABLED CONFIG_CAMERA_PSRAM_DMA
+#else
+#define CAMERA_PSRAM_DMA_ENABLED 0
+#endif
+
+static volatile bool g_psram_dma_mode = CAMERA_PSRAM_DMA_ENABLED;
+static portMUX_TYPE g_psram_dma_lock = portMUX_INITIALIZER_UNLOCKED;
+
+#if defined(CONFIG_CAMERA_JPEG_ZERO_COPY)
+#define CAMERA_JPEG_ZERO_COPY_ENABLED CONFIG_CAMERA_JPEG_ZERO_COPY
+#else
+#define CAMERA_JPEG_ZERO_COPY_ENABLED 0
+#endif
+
+/* JPEG zero copy: DMA descriptors point straight at the frame buffer slots
+ * wherever they live (the PSRAM DMA path, generalized to internal RAM), so
+ * no half buffer is ever copied by cam_task. */
+static volatile bool g_zero_copy_mode = CAMERA_JPEG_ZERO_COPY_ENABLED;
+
+/* Guards the frame reference counts and the free list, taken by cam_task and
+ * by every task that holds frames. */
+static portMUX_TYPE g_frame_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* At top of cam_hal.c – one switch for noisy ISR prints */
+#ifndef CAM_LOG_SPAM_EVERY_FRAME
+#define CAM_LOG_SPAM_EVERY_FRAME 0   /* set to 1 to restore old behaviour */
+#endif
+
+/*
+ * PSRAM DMA may bypass the CPU cache. Always call esp_cache_msync() on
+ * PSRAM regions that the CPU will read so cached reads see the data written
+ * by DMA.
+ */
+
+static inline size_t dcache_line_size(void)
+{
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0)
+    /* cache_hal_get_cache_line_size() added extra argument from IDF 5.2 */
+    return cache_hal_get_cache_line_size(CACHE_LL_LEVEL_EXT_MEM, CACHE_TYPE_DATA);
+#else
+    /* Older releases only expose the ROM helper, all current targets
+     * have a 32‑byte DCache line */
+    return 32;
+#endif
+}
+
+/*
+ * Invalidate CPU data cache lines that cover a region in PSRAM which
+ * has just been written by DMA. This guarantees subsequent CPU reads
+ * fetch the fresh data from PSRAM rather than stale cache contents.
+ * Both address and length are aligned to the data cache line size.
+ */
+static inline void cam_drop_psram_cache(void *addr, size_t len)
+{
+    if (!cam_obj->fb_in_psram) {
+        return; /* zero copy into internal RAM, DMA and CPU are coherent */
+    }
+    size_t line = dcache_line_size();
+    if (line == 0) {
+        line = 32; /* sane fallback */
+    }
+    uintptr_t start = (uintptr_t)addr & ~(line - 1);
+    size_t sync_len = (len + ((uintptr_t)addr - start) + line - 1) & ~(line - 1);
+    esp_cache_msync((void *)start, sync_len,
+                    ESP_CACHE_MSYNC_FLAG_DIR_M2C | ESP_CACHE_MSYNC_FLAG_INVALIDATE);
+}
+
+/* Throttle repeated warnings printed from tight loops / ISRs.
+ *
+ * counter – static DRAM/IRAM uint16_t you pass in
+ * first   – literal C string shown on first hit and as prefix of summaries
+ */
+#if CONFIG_LOG_DEFAULT_LEVEL >= 2
+#define CAM_WARN_THROTTLE(counter, first)                                  \
+    do {                                                                  \
+        if (++(counter) == 1) {                                           \
+            ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: %s\r\n"), first);        \
+        } else if ((counter) % 100 == 0) {                                \
+            ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: %s - 100 additional misses\r\n"), first); \
+        }                                                                 \
+        if ((counter) == 10000) (counter) = 1;                            \
+    } while (0)
+#else
+#define CAM_WARN_THROTTLE(counter, first) do { (void)(counter); } while (0)
+#endif
+
+/* Feed the JPEG bytes that just landed in the frame buffer to the marker
+ * scanner, so the frame length is known as soon as VSYNC arrives. Returns
+ * false if the frame must be dropped. */
+static bool cam_scan_jpeg(camera_fb_t *fb, size_t offset, size_t len, cam_jpeg_scan_t *scan)
+{
+    static uint16_t warn_soi_miss_cnt = 0;
+    static uint16_t warn_jpeg_bad_cnt = 0;
+
+    if (cam_obj->psram_mode) {
+        /* DMA wrote straight into the frame buffer */
+        cam_drop_psram_cache(fb->buf + offset, len);
+    }
+    switch (cam_jpeg_scan(scan, fb->buf + offset, len)) {
+    case CAM_JPEG_SCAN_NO_SOI:
+        CAM_WARN_THROTTLE(warn_soi_miss_cnt,
+                          "NO-SOI - JPEG start marker missing");
+        return false;
+    case CAM_JPEG_SCAN_BAD:
+        CAM_WARN_THROTTLE(warn_jpeg_bad_cnt,
+                          "JPEG-BAD - invalid marker in JPEG stream");
+        return false;
+    default:
+        return true;
+    }
+}
+
+/* Must be called with g_frame_lock held */
+static inline void cam_push_free_frame(int pos)
+{
+    cam_obj->frames[pos].next = cam_obj->free_head;
+    cam_obj->free_head = pos;
+}
+
+/* Frame slot of a buffer handed out by cam_take(), -1 if it is not one */
+static int cam_frame_index(const camera_fb_t *fb)
+{
+    if (!fb || !cam_obj) {
+        return -1;
+    }
+    const cam_frame_t *frame = (const cam_frame_t *)((const uint8_t *)fb - offsetof(cam_frame_t, fb));
+    ptrdiff_t pos = frame - cam_obj->frames;
+    if (pos < 0 || pos >= cam_obj->frame_cnt || &cam_obj->frames[pos].fb != fb) {
+        return -1;
+    }
+    return pos;
+}
+
+static bool cam_get_next_frame(int * frame_pos)
+{
+    bool ret = true;
+    portENTER_CRITICAL(&g_frame_lock);
+    // a dropped frame leaves its slot to be captured into again
+    if (cam_obj->capture_pos < 0) {
+        cam_obj->capture_pos = cam_obj->free_head;
+        if (cam_obj->capture_pos >= 0) {
+            cam_obj->free_head = cam_obj->frames[cam_obj->capture_pos].next;
+        }
+    }
+    if (cam_obj->capture_pos >= 0) {
+        *frame_pos = cam_obj->capture_pos;
+    } else {
+        ret = false;
+    }
+    portEXIT_CRITICAL(&g_frame_lock);
+    return ret;
+}
+
+/* Hand the captured slot to the frame queue, which holds the first reference.
+ * A due frame takes the tap's reference before anyone can return the first. */
+static bool cam_send_frame(camera_fb_t *fb, int frame_pos)
+{
+    portENTER_CRITICAL(&g_frame_lock);
+    const bool tap = cam_obj->tap_every && !cam_obj->tap_busy &&
+                     (int32_t)(fb->sequence - cam_obj->tap_next) >= 0;
+    portEXIT_CRITICAL(&g_frame_lock);
+    cam_obj->frames[frame_pos].ref = tap ? 2 : 1;
+    if (xQueueSend(cam_obj->frame_buffer_queue, (void *)&fb, 0) != pdTRUE) {
+        cam_obj->frames[frame_pos].ref = 0;
+        return false;
+    }
+    portENTER_CRITICAL(&g_frame_lock);
+    cam_obj->capture_pos = -1;
+    if (tap) {
+        cam_obj->tap_busy = true;
+        cam_obj->tap_next = fb->sequence + cam_obj->tap_every;
+    }
+    portEXIT_CRITICAL(&g_frame_lock);
+    // the queue is empty while no tapped frame is out
+    if (tap && xQueueSend(cam_obj->tap_queue, (void *)&fb, 0) != pdTRUE) {
+        cam_tap_give(fb);
+    }
+    return true;
+}
+
+/* Count a dropped frame. One whose events the ISR could not queue counts as
+ * that, whatever cam_task made of the part it did get. */
+static void cam_count_drop(uint32_t *counter)
+{
+    if (cam_obj->events_lost) {
+        cam_obj->events_lost = false;
+        counter = &cam_obj->stats.event_overflow;
+    }
+    (*counter)++;
+}
+
+/* Every frame started here takes a sequence number, whether it gets a slot or not */
+static bool cam_start_frame(int * frame_pos, int64_t vsync_us)
+{
+    uint32_t seq = ++cam_obj->stats.frames;
+    cam_obj->events_lost = false;
+    if (cam_get_next_frame(frame_pos)) {
+        if(ll_cam_start(cam_obj, *frame_pos)){
+            // Vsync the frame manually
+            ll_cam_do_vsync(cam_obj);
+            camera_fb_t *fb = &cam_obj->frames[*frame_pos].fb;
+            fb->timestamp.tv_sec = vsync_us / 1000000UL;
+            fb->timestamp.tv_usec = vsync_us % 1000000UL;
+            fb->sequence = seq;
+            fb->capture_start_us = vsync_us;
+            return true;
+        }
+    }
+    cam_obj->stats.no_fb++;
+    return false;
+}
+
+void IRAM_ATTR ll_cam_send_event(cam_obj_t *cam, cam_event_t cam_event, BaseType_t * HPTaskAwoken)
+{
+    cam_event_msg_t msg = {
+        .type = cam_event,
+        .time_us = cam_event == CAM_VSYNC_EVENT ? esp_timer_get_time() : 0,
+    };
+    if (xQueueSendFromISR(cam->event_queue, (void *)&msg, HPTaskAwoken) != pdTRUE) {
+        ll_cam_stop(cam);
+        cam->state = CAM_STATE_IDLE;
+        cam->events_lost = true;
+#if CAM_LOG_SPAM_EVERY_FRAME
+        ESP_DRAM_LOGD(TAG, "EV-%s-OVF", cam_event==CAM_IN_SUC_EOF_EVENT ? "EOF" : "VSYNC");
+#else
+        static uint16_t ovf_cnt = 0;
+        CAM_WARN_THROTTLE(ovf_cnt,
+                          cam_event==CAM_IN_SUC_EOF_EVENT ? "EV-EOF-OVF" : "EV-VSYNC-OVF");
+#endif
+    }
+}
+
+//Copy fram from DMA dma_buffer to fram dma_buffer
+static void cam_task(void *arg)
+{
+    int cnt = 0;
+    int frame_pos = 0;
+    cam_obj->state = CAM_STATE_IDLE;
+    cam_event_msg_t msg = { 0 };
+    cam_event_t cam_event = 0;
+    cam_jpeg_scan_t jpeg_scan;
+    static uint16_t warn_eoi_miss_cnt = 0;
+    /* a started frame that is neither delivered nor counted as dropped yet */
+    bool frame_open = false;
+    /* first reason the open frame is going to be dropped for, counted at VSYNC */
+    uint32_t *drop = NULL;
+
+    xQueueReset(cam_obj->event_queue);
+
+    while (1) {
+        xQueueReceive(cam_obj->event_queue, (void *)&msg, portMAX_DELAY);
+        cam_event = msg.type;
+        DBG_PIN_SET(1);
+        switch (cam_obj->state) {
+
+            case CAM_STATE_IDLE: {
+                if (cam_event == CAM_VSYNC_EVENT) {
+                    //DBG_PIN_SET(1);
+                    if (frame_open) {
+                        /* the ISR stopped the capture, its events were lost */
+                        cam_count_drop(&cam_obj->stats.event_overflow);
+                    }
+                    frame_open = cam_start_frame(&frame_pos, msg.time_us);
+                    if(frame_open){
+                        cam_obj->frames[frame_pos].fb.len = 0;
+                        cam_obj->state = CAM_STATE_READ_BUF;
+                    }
+                    drop = NULL;
+                    cnt = 0;
+                    cam_jpeg_scan_init(&jpeg_scan);
+                }
+            }
+            break;
+
+            case CAM_STATE_READ_BUF: {
+                camera_fb_t * frame_buffer_event = &cam_obj->frames[frame_pos].fb;
+                size_t pixels_per_dma = (cam_obj->dma_half_buffer_size * cam_obj->fb_bytes_per_pixel) / (cam_obj->dma_bytes_per_item * cam_obj->in_bytes_per_pixel);
+                /* nothing after the JPEG end marker is needed */
+                bool jpeg_done = cam_obj->jpeg_mode && jpeg_scan.result == CAM_JPEG_SCAN_END;
+
+                if (cam_event == CAM_IN_SUC_EOF_EVENT) {
+                    size_t scan_offset = frame_buffer_event->len;
+                    size_t scan_len = 0;
+                    if(!cam_obj->psram_mode){
+                        if (!jpeg_done) {
+                            if (cam_obj->fb_size < (frame_buffer_event->len + pixels_per_dma)) {
+                                ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: FB-OVF\r\n"));
+                                ll_cam_stop(cam_obj);
+                                drop = &cam_obj->stats.fb_overflow;
+                                continue;
+                            }
+                            scan_len = ll_cam_memcpy(cam_obj,
+                                &frame_buffer_event->buf[frame_buffer_event->len],
+                                &cam_obj->dma_buffer[(cnt % cam_obj->dma_half_buffer_cnt) * cam_obj->dma_half_buffer_size],
+                                cam_obj->dma_half_buffer_size);
+                            frame_buffer_event->len += scan_len;
+                        }
+                    } else {
+                        // stop if the next DMA copy would exceed the framebuffer slot
+                        // size, since we're called only after the copy occurs
+                        // This effectively reduces maximum usable frame buffer size
+                        // by one DMA operation, as we can't predict here, if the next
+                        // cam event will be a VSYNC
+                        if (cnt + 1 >= cam_obj->frame_copy_cnt) {
+                            ll_cam_stop(cam_obj);
+                            if (!jpeg_done) {
+                                ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: DMA overflow\r\n"));
+                                cam_count_drop(&cam_obj->stats.fb_overflow);
+                                frame_open = false;
+                                cam_obj->state = CAM_STATE_IDLE;
+                                continue;
+                            }
+                            // the JPEG already ended, keep it for VSYNC before the DMA wraps over it
+                        }
+                        if (!jpeg_done) {
+                            scan_offset = cnt * cam_obj->dma_half_buffer_size;
+                            scan_len = cam_obj->dma_half_buffer_size;
+                        }
+                    }
+
+                    //Check the JPEG markers as the data lands. stop if it is not JPEG
+                    if (cam_obj->jpeg_mode && scan_len &&
+                        !cam_scan_jpeg(frame_buffer_event, scan_offset, scan_len, &jpeg_scan)) {
+                        ll_cam_stop(cam_obj);
+                        cam_count_drop(jpeg_scan.result == CAM_JPEG_SCAN_NO_SOI ?
+                                       &cam_obj->stats.no_soi : &cam_obj->stats.jpeg_bad);
+                        frame_open = false;
+                        cam_obj->state = CAM_STATE_IDLE;
+                        continue;
+                    }
+
+                    cnt++;
+
+                } else if (cam_event == CAM_VSYNC_EVENT) {
+                    //DBG_PIN_SET(1);
+                    ll_cam_stop(cam_obj);
+
+                    if (cnt || !cam_obj->jpeg_mode || cam_obj->psram_mode) {
+                        if (cam_obj->jpeg_mode) {
+                            /* the last transfer is partial, bring it in and scan it */
+                            size_t scan_offset = frame_buffer_event->len;
+                            size_t scan_len = 0;
+                            if (jpeg_done) {
+                                /* already complete */
+                            } else if (!cam_obj->psram_mode) {
+                                if (cam_obj->fb_size < (frame_buffer_event->len + pixels_per_dma)) {
+                                    ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: FB-OVF\r\n"));
+                                    if (!drop) {
+                                        drop = &cam_obj->stats.fb_overflow;
+                                    }
+                                    cnt--;
+                                } else {
+                                    scan_len = ll_cam_memcpy(cam_obj,
+                                        &frame_buffer_event->buf[frame_buffer_event->len],
+                                        &cam_obj->dma_buffer[(cnt % cam_obj->dma_half_buffer_cnt) * cam_obj->dma_half_buffer_size],
+                                        cam_obj->dma_half_buffer_size);
+                                    frame_buffer_event->len += scan_len;
+                                }
+                            } else {
+                                scan_offset = cnt * cam_obj->dma_half_buffer_size;
+                                scan_len = cam_obj->dma_half_buffer_size;
+                            }
+                            if (scan_len) {
+                                cam_scan_jpeg(frame_buffer_event, scan_offset, scan_len, &jpeg_scan);
+                            }
+                            cnt++;
+                        }
+
+                        if (cam_obj->jpeg_mode) {
+                            if (jpeg_scan.result == CAM_JPEG_SCAN_END) {
+                                frame_buffer_event->len = jpeg_scan.length;
+                            } else if (!drop) {
+                                /* keep the slot, the frame never ended */
+                                drop = &cam_obj->stats.no_eoi;
+                                CAM_WARN_THROTTLE(warn_eoi_miss_cnt,
+                                                  "NO-EOI - JPEG end marker missing");
+                            }
+                        } else if (cam_obj->psram_mode) {
+                            frame_buffer_event->len = cam_obj->recv_size;
+                        } else if (frame_buffer_event->len != cam_obj->fb_size) {
+                            if (!drop) {
+                                drop = &cam_obj->stats.fb_size;
+                            }
+                            ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: FB-SIZE: %u != %u\r\n"), frame_buffer_event->len, (unsigned) cam_obj->fb_size);
+                        }
+                        frame_buffer_event->capture_end_us = msg.time_us;
+                        //send frame, a slot that is not sent is captured into again
+                        if(!drop && !cam_send_frame(frame_buffer_event, frame_pos)) {
+                            //pop frame buffer from the queue
+                            camera_fb_t * fb2 = NULL;
+                            if(xQueueReceive(cam_obj->frame_buffer_queue, &fb2, 0) == pdTRUE) {
+                                //push the new frame to the end of the queue
+                                if (!cam_send_frame(frame_buffer_event, frame_pos)) {
+                                    drop = &cam_obj->stats.queue_full;
+                                    ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: FBQ-SND\r\n"));
+                                }
+                                //drop the queue's reference to the popped buffer
+                                cam_give(fb2);
+                                cam_obj->stats.replaced++;
+                            } else {
+                                //queue is full and we could not pop a frame from it
+                                drop = &cam_obj->stats.queue_full;
+                                ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: FBQ-RCV\r\n"));
+                            }
+                        }
+                    } else if (!drop) {
+                        /* not a single transfer arrived */
+                        drop = &cam_obj->stats.no_eoi;
+                    }
+                    if (drop) {
+                        cam_count_drop(drop);
+                    } else {
+                        cam_obj->stats.delivered++;
+                    }
+                    drop = NULL;
+
+                    frame_open = cam_start_frame(&frame_pos, msg.time_us);
+                    if(!frame_open){
+                        cam_obj->state = CAM_STATE_IDLE;
+                    } else {
+                        cam_obj->frames[frame_pos].fb.len = 0;
+                    }
+                    cnt = 0;
+                    cam_jpeg_scan_init(&jpeg_scan);
+                }
+            }
+            break;
+        }
+        DBG_PIN_SET(0);
+    }
+}
+
+static lldesc_t * allocate_dma_descriptors(uint32_t count, uint16_t size, uint8_t * buffer)
+{
+    lldesc_t *dma = (lldesc_t *)heap_caps_malloc(count * sizeof(lldesc_t), MALLOC_CAP_DMA);
+    if (dma == NULL) {
+        return dma;
+    }
+
+    for (int x = 0; x < count; x++) {
+        dma[x].size = size;
+        dma[x].length = 0;
+        dma[x].sosf = 0;
+        dma[x].eof = 0;
+        dma[x].owner = 1;
+        dma[x].buf = (buffer + size * x);
+        dma[x].empty = (uint32_t)&dma[(x + 1) % count];
+    }
+    return dma;
+}
+
+static esp_err_t cam_dma_config(const camera_config_t *config)
+{
+    bool ret = ll_cam_dma_sizes(cam_obj);
+    if (0 == ret) {
+        return ESP_FAIL;
+    }
+
+    cam_obj->dma_node_cnt = (cam_obj->dma_buffer_size) / cam_obj->dma_node_buffer_size; // Number of DMA nodes
+    cam_obj->frame_copy_cnt = cam_obj->recv_size / cam_obj->dma_half_buffer_size; // Number of interrupted copies, ping-pong copy
+    if (cam_obj->psram_mode) {
+        cam_obj->frame_copy_cnt++;
+    }
+
+    ESP_LOGI(TAG, "buffer_size: %d, half_buffer_size: %d, node_buffer_size: %d, node_cnt: %d, total_cnt: %d",
+             (int) cam_obj->dma_buffer_size, (int) cam_obj->dma_half_buffer_size, (int) cam_obj->dma_node_buffer_size,
+             (int) cam_obj->dma_node_cnt, (int) cam_obj->frame_copy_cnt);
+
+    cam_obj->dma_buffer = NULL;
+    cam_obj->dma = NULL;
+
+    cam_obj->frames = (cam_frame_t *)heap_caps_aligned_calloc(alignof(cam_frame_t), 1, cam_obj->frame_cnt * sizeof(cam_frame_t), MALLOC_CAP_DEFAULT);
+    CAM_CHECK(cam_obj->frames != NULL, "frames malloc failed", ESP_FAIL);
+
+    uint8_t dma_align = 0;
+    size_t fb_size = cam_obj->fb_size;
+    if (cam_obj->psram_mode) {
+        dma_align = ll_cam_get_dma_align(cam_obj);
+        if (cam_obj->fb_size < cam_obj->recv_size) {
+            fb_size = cam_obj->recv_size;
+        }
+        fb_size += cam_obj->dma_half_buffer_size;
+    }
+
+    /* Allocate memory for frame buffer */
+    size_t alloc_size = fb_size * sizeof(uint8_t) + dma_align;
+    uint32_t _caps = MALLOC_CAP_8BIT;
+    if (CAMERA_FB_IN_DRAM == config->fb_location) {
+        _caps |= MALLOC_CAP_INTERNAL;
+    } else {
+        _caps |= MALLOC_CAP_SPIRAM;
+    }
+    for (int x = 0; x < cam_obj->frame_cnt; x++) {
+        cam_obj->frames[x].dma = NULL;
+        cam_obj->frames[x].fb_offset = 0;
+        cam_obj->frames[x].ref = 0;
+        ESP_LOGI(TAG, "Allocating %d Byte frame buffer in %s", alloc_size, _caps & MALLOC_CAP_SPIRAM ? "PSRAM" : "OnBoard RAM");
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 3, 0)
+        // In IDF v4.2 and earlier, memory returned by heap_caps_aligned_alloc must be freed using heap_caps_aligned_free.
+        // And heap_caps_aligned_free is deprecated on v4.3.
+        cam_obj->frames[x].fb.buf = (uint8_t *)heap_caps_aligned_alloc(16, alloc_size, _caps);
+#else
+        cam_obj->frames[x].fb.buf = (uint8_t *)heap_caps_malloc(alloc_size, _caps);
+#endif
+        CAM_CHECK(cam_obj->frames[x].fb.buf != NULL, "frame buffer malloc failed", ESP_FAIL);
+        if (cam_obj->psram_mode) {
+            //align PSRAM buffer. TODO: save the offset so proper address can be freed later
+            cam_obj->frames[x].fb_offset = dma_align - ((uint32_t)cam_obj->frames[x].fb.buf & (dma_align - 1));
+            cam_obj->frames[x].fb.buf += cam_obj->frames[x].fb_offset;
+            ESP_LOGI(TAG, "Frame[%d]: Offset: %u, Addr: 0x%08X", x, cam_obj->frames[x].fb_offset, (unsigned) cam_obj->frames[x].fb.buf);
+            cam_obj->frames[x].dma = allocate_dma_descriptors(cam_obj->dma_node_cnt, cam_obj->dma_node_buffer_size, cam_obj->frames[x].fb.buf);
+            CAM_CHECK(cam_obj->frames[x].dma != NULL, "frame dma malloc failed", ESP_FAIL);
+        }
+    }
+    // all slots start out free, the first one is captured into first
+    cam_obj->free_head = -1;
+    cam_obj->capture_pos = -1;
+    for (int x = cam_obj->frame_cnt - 1; x >= 0; x--) {
+        cam_push_free_frame(x);
+    }
+
+    if (!cam_obj->psram_mode) {
+        cam_obj->dma_buffer = (uint8_t *)heap_caps_malloc(cam_obj->dma_buffer_size * sizeof(uint8_t), MALLOC_CAP_DMA);
+        if(NULL == cam_obj->dma_buffer) {
+            ESP_LOGE(TAG,"%s(%d): DMA buffer %d Byte malloc failed, the current largest free block:%d Byte", __FUNCTION__, __LINE__,
+                     (int) cam_obj->dma_buffer_size, (int) heap_caps_get_largest_free_block(MALLOC_CAP_DMA));
+            return ESP_FAIL;
+        }
+
+        cam_obj->dma = allocate_dma_descriptors(cam_obj->dma_node_cnt, cam_obj->dma_node_buffer_size, cam_obj->dma_buffer);
+        CAM_CHECK(cam_obj->dma != NULL, "dma malloc failed", ESP_FAIL);
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t cam_init(const camera_config_t *config)
+{
+    CAM_CHECK(NULL != config, "config pointer is invalid", ESP_ERR_INVALID_ARG);
+
+    esp_err_t ret = ESP_OK;
+    cam_obj = (cam_obj_t *)heap_caps_calloc(1, sizeof(cam_obj_t), MALLOC_CAP_DMA);
+    CAM_CHECK(NULL != cam_obj, "lcd_cam object malloc error", ESP_ERR_NO_MEM);
+
+    cam_obj->swap_data = 0;
+    cam_obj->vsync_pin = config->pin_vsync;
+    cam_obj->vsync_invert = true;
+
+    ll_cam_set_pin(cam_obj, config);
+    ret = ll_cam_config(cam_obj, config);
+    CAM_CHECK_GOTO(ret == ESP_OK, "ll_cam initialize failed", err);
+
+#if CAMERA_DBG_PIN_ENABLE
+    PIN_FUNC_SELECT(GPIO_PIN_MUX_REG[DBG_PIN_NUM], PIN_FUNC_GPIO);
+    gpio_set_direction(DBG_PIN_NUM, GPIO_MODE_OUTPUT);
+    gpio_set_pull_mode(DBG_PIN_NUM, GPIO_FLOATING);
+#endif
+
+    ESP_LOGI(TAG, "cam init ok");
+    return ESP_OK;
+
+err:
+    free(cam_obj);
+    cam_obj = NULL;
+    return ESP_FAIL;
+}
+
+esp_err_t cam_config(const camera_config_t *config, framesize_t frame_size, uint16_t sensor_pid)
+{
+    CAM_CHECK(NULL != config, "config pointer is invalid", ESP_ERR_INVALID_ARG);
+    esp_err_t ret = ESP_OK;
+
+    ret = ll_cam_set_sample_mode(cam_obj, (pixformat_t)config->pixel_format, config->xclk_freq_hz, sensor_pid);
+    CAM_CHECK_GOTO(ret == ESP_OK, "ll_cam_set_sample_mode failed", err);
+    
+    cam_obj->jpeg_mode = config->pixel_format == PIXFORMAT_JPEG;
+#if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
+    cam_obj->psram_mode = g_psram_dma_mode || (g_zero_copy_mode && cam_obj->jpeg_mode);
+#else
+    /* I2S samples every JPEG byte into a 32 bit word, ll_cam_memcpy() must unpack it */
+    cam_obj->psram_mode = false;
+#endif
+    cam_obj->fb_in_psram = config->fb_location != CAMERA_FB_IN_DRAM;
+    ESP_LOGI(TAG, "DMA to frame buffer %s (%s)", cam_obj->psram_mode ? "enabled" : "disabled",
+             cam_obj->fb_in_psram ? "PSRAM" : "internal RAM");
+    CAM_CHECK_GOTO(config->fb_count <= INT8_MAX, "too many frame buffers", err);
+    cam_obj->frame_cnt = config->fb_count;
+    cam_obj->width = resolution[frame_size].width;
+    cam_obj->height = resolution[frame_size].height;
+
+    if(cam_obj->jpeg_mode){
+#ifdef CONFIG_CAMERA_JPEG_MODE_FRAME_SIZE_AUTO
+        cam_obj->recv_size = cam_obj->width * cam_obj->height / 5;
+#else
+        cam_obj->recv_size = CONFIG_CAMERA_JPEG_MODE_FRAME_SIZE;
+#endif
+        cam_obj->fb_size = cam_obj->recv_size;
+    } else {
+        cam_obj->recv_size = cam_obj->width * cam_obj->height * cam_obj->in_bytes_per_pixel;
+        cam_obj->fb_size = cam_obj->width * cam_obj->height * cam_obj->fb_bytes_per_pixel;
+    }
+
+    ret = cam_dma_config(config);
+    CAM_CHECK_GOTO(ret == ESP_OK, "cam_dma_config failed", err);
+
+    size_t queue_size = cam_obj->dma_half_buffer_cnt - 1;
+    if (queue_size == 0) {
+        queue_size = 1;
+    }
+    cam_obj->event_queue = xQueueCreate(queue_size, sizeof(cam_event_msg_t));
+    CAM_CHECK_GOTO(cam_obj->event_queue != NULL, "event_queue create failed", err);
+
+    size_t frame_buffer_queue_len = cam_obj->frame_cnt;
+    if (config->grab_mode == CAMERA_GRAB_LATEST && cam_obj->frame_cnt > 1) {
+        frame_buffer_queue_len = cam_obj->frame_cnt - 1;
+    }
+    cam_obj->frame_buffer_queue = xQueueCreate(frame_buffer_queue_len, sizeof(camera_fb_t*));
+    CAM_CHECK_GOTO(cam_obj->frame_buffer_queue != NULL, "frame_buffer_queue create failed", err);
+
+    ret = ll_cam_init_isr(cam_obj);
+    CAM_CHECK_GOTO(ret == ESP_OK, "cam intr alloc failed", err);
+
+
+#if CONFIG_CAMERA_CORE0
+    xTaskCreatePinnedToCore(cam_task, "cam_task", CAM_TASK_STACK, NULL, configMAX_PRIORITIES - 2, &cam_obj->task_handle, 0);
+#elif CONFIG_CAMERA_CORE1
+    xTaskCreatePinnedToCore(cam_task, "cam_task", CAM_TASK_STACK, NULL, configMAX_PRIORITIES - 2, &cam_obj->task_handle, 1);
+#else
+    xTaskCreate(cam_task, "cam_task", CAM_TASK_STACK, NULL, configMAX_PRIORITIES - 2, &cam_obj->task_handle);
+#endif
+
+    ESP_LOGI(TAG, "cam config ok");
+    return ESP_OK;
+
+err:
+    cam_deinit();
+    return ESP_FAIL;
+}
+
+esp_err_t cam_deinit(void)
+{
+    if (!cam_obj) {
+        return ESP_FAIL;
+    }
+
+    cam_stop();
+    if (cam_obj->task_handle) {
+        vTaskDelete(cam_obj->task_handle);
+    }
+    if (cam_obj->event_queue) {
+        vQueueDelete(cam_obj->event_queue);
+    }
+    if (cam_obj->frame_buffer_queue) {
+        vQueueDelete(cam_obj->frame_buffer_queue);
+    }
+    if (cam_obj->tap_queue) {
+        vQueueDelete(cam_obj->tap_queue);
+    }
+
+    ll_cam_deinit(cam_obj);
+
+    if (cam_obj->dma) {
+        free(cam_obj->dma);
+    }
+    if (cam_obj->dma_buffer) {
+        free(cam_obj->dma_buffer);
+    }
+    if (cam_obj->frames) {
+        for (int x = 0; x < cam_obj->frame_cnt; x++) {
+            free(cam_obj->frames[x].fb.buf - cam_obj->frames[x].fb_offset);
+            if (cam_obj->frames[x].dma) {
+                free(cam_obj->frames[x].dma);
+            }
+        }
+        free(cam_obj->frames);
+    }
+
+    free(cam_obj);
+    cam_obj = NULL;
+    return ESP_OK;
+}
+
+void cam_stop(void)
+{
+    ll_cam_vsync_intr_enable(cam_obj, false);
+    ll_cam_stop(cam_obj);
+}
+
+void cam_start(void)
+{
+    ll_cam_vsync_intr_enable(cam_obj, true);
+}
+
+camera_fb_t *cam_take(TickType_t timeout)
+{
+    camera_fb_t *dma_buffer = NULL;
+    const TickType_t start = xTaskGetTickCount();
+#if CONFIG_IDF_TARGET_ESP32S3
+    uint16_t dma_reset_counter = 0;
+    static const uint8_t MAX_GDMA_RESETS = 3;
+#else
+    /* throttle repeated NULL frame warnings */
+    static uint16_t warn_null_cnt = 0;
+#endif
+    for (;;)
+    {
+        TickType_t elapsed = xTaskGetTickCount() - start; /* TickType_t is unsigned so rollover is safe */
+        if (elapsed >= timeout) {
+            ESP_LOGW(TAG, "Failed to get frame: timeout");
+            return NULL;
+        }
+        TickType_t remaining = timeout - elapsed;
+
+        if (xQueueReceive(cam_obj->frame_buffer_queue, (void *)&dma_buffer, remaining) == pdFALSE) {
+            continue;
+        }
+
+        if (!dma_buffer) {
+            /* Work-around for ESP32-S3 GDMA freeze when Wi-Fi STA starts.
+             * See esp32-camera commit 984999f (issue #620). */
+#if CONFIG_IDF_TARGET_ESP32S3
+            if (dma_reset_counter < MAX_GDMA_RESETS) {
+                ll_cam_dma_reset(cam_obj);
+                dma_reset_counter++;
+                continue; /* retry with queue timeout */
+            }
+            if (dma_reset_counter == MAX_GDMA_RESETS) {
+                ESP_CAMERA_ETS_PRINTF(DRAM_STR("cam_hal: Giving up GDMA reset after %u tries\r\n"),
+                                     (unsigned) dma_reset_counter);
+                dma_reset_counter++; /* suppress further logs */
+            }
+#else
+            /* Early warning for misbehaving sensors on other chips */
+            CAM_WARN_THROTTLE(warn_null_cnt,
+                              "Unexpected NULL frame on " CONFIG_IDF_TARGET);
+#endif
+            vTaskDelay(1); /* immediate yield once resets are done */
+            continue;             /* go to top of loop */
+        }
+
+        /* JPEG frames arrive with their exact length, see cam_scan_jpeg() */
+        if (!cam_obj->jpeg_mode && cam_obj->psram_mode &&
+            cam_obj->in_bytes_per_pixel != cam_obj->fb_bytes_per_pixel) {
+            /* currently used only for YUV to GRAYSCALE */
+            dma_buffer->len = ll_cam_memcpy(cam_obj, dma_buffer->buf, dma_buffer->buf, dma_buffer->len);
+        }
+
+        if (cam_obj->psram_mode) {
+            /* DMA may bypass cache, ensure full frame is visible to the app */
+            cam_drop_psram_cache(dma_buffer->buf, dma_buffer->len);
+        }
+
+        return dma_buffer;
+    }
+}
+
+bool cam_ref(camera_fb_t *dma_buffer)
+{
+    int pos = cam_frame_index(dma_buffer);
+    if (pos < 0) {
+        return false;
+    }
+    bool ret = false;
+    portENTER_CRITICAL(&g_frame_lock);
+    // only a frame that is still held can gain a reference
+    if (cam_obj->frames[pos].ref && cam_obj->frames[pos].ref < UINT8_MAX) {
+        cam_obj->frames[pos].ref++;
+        ret = true;
+    }
+    portEXIT_CRITICAL(&g_frame_lock);
+    return ret;
+}
+
+void cam_give(camera_fb_t *dma_buffer)
+{
+    int pos = cam_frame_index(dma_buffer);
+    if (pos < 0) {
+        return;
+    }
+    portENTER_CRITICAL(&g_frame_lock);
+    // returning a free frame again is harmless
+    if (cam_obj->frames[pos].ref && --cam_obj->frames[pos].ref == 0) {
+        cam_push_free_frame(pos);
+    }
+    portEXIT_CRITICAL(&g_frame_lock);
+}
+
+void cam_give_all(void) {
+    portENTER_CRITICAL(&g_frame_lock);
+    cam_obj->free_head = -1;
+    for (int x = cam_obj->frame_cnt - 1; x >= 0; x--) {
+        cam_obj->frames[x].ref = 0;
+        if (x != cam_obj->capture_pos) {
+            cam_push_free_frame(x);
+        }
+    }
+    portEXIT_CRITICAL(&g_frame_lock);
+}
+
+esp_err_t cam_tap_start(uint8_t every)
+{
+    if (!every) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!cam_obj->jpeg_mode) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (!cam_obj->tap_queue) {
+        cam_obj->tap_queue = xQueueCreate(1, sizeof(camera_fb_t *));
+        if (!cam_obj->tap_queue) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    // a frame tapped as the last tap was stopped, or its wake up
+    camera_fb_t *fb = NULL;
+    while (xQueueReceive(cam_obj->tap_queue, (void *)&fb, 0) == pdTRUE) {
+        if (fb) {
+            cam_give(fb);
+        }
+    }
+    portENTER_CRITICAL(&g_frame_lock);
+    cam_obj->tap_busy = false;
+    cam_obj->tap_next = cam_obj->stats.frames;
+    cam_obj->tap_every = every;
+    portEXIT_CRITICAL(&g_frame_lock);
+    return ESP_OK;
+}
+
+void cam_tap_stop(void)
+{
+    if (!cam_obj->tap_queue) {
+        return;
+    }
+    portENTER_CRITICAL(&g_frame_lock);
+    cam_obj->tap_every = 0;
+    portEXIT_CRITICAL(&g_frame_lock);
+    camera_fb_t *wake = NULL;
+    xQueueSend(cam_obj->tap_queue, (void *)&wake, portMAX_DELAY);
+}
+
+camera_fb_t *cam_tap_take(TickType_t timeout)
+{
+    camera_fb_t *fb = NULL;
+    if (xQueueReceive(cam_obj->tap_queue, (void *)&fb, timeout) != pdTRUE) {
+        return NULL;
+    }
+    if (fb && cam_obj->psram_mode) {
+        cam_drop_psram_cache(fb->buf, fb->len);
+    }
+    return fb;
+}
+
+void cam_tap_give(camera_fb_t *dma_buffer)
+{
+    portENTER_CRITICAL(&g_frame_lock);
+    cam_obj->tap_busy = false;
+    portEXIT_CRITICAL(&g_frame_lock);
+    cam_give(dma_buffer);
+}
+
+bool cam_get_available_frames(void)
+{
+    return 0 < uxQueueMessagesWaiting(cam_obj->frame_buffer_queue);
+}
+
+void cam_get_stats(camera_stats_t *stats)
+{
+    // cam_task updates the counters without a lock, a copy may be one frame out of step
+    *stats = cam_obj->stats;
+}
+
+void cam_set_psram_mode(bool enable)
+{
+    portENTER_CRITICAL(&g_psram_dma_lock);
+    g_psram_dma_mode = enable;
+    portEXIT_CRITICAL(&g_psram_dma_lock);
+}
+
+bool cam_get_psram_mode(void)
+{
+    return g_psram_dma_mode;
+}
+
+void cam_set_zero_copy_mode(bool enable)
+{
+    portENTER_CRITICAL(&g_psram_dma_lock);
+    g_zero_copy_mode = enable;
+    portEXIT_CRITICAL(&g_psram_dma_lock);
+}
+
+bool cam_get_zero_copy_mode(void)
+{
+    return g_zero_copy_mode;
+}
@@ -0,0 +1,159 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <string.h>
+#include "cam_jpeg_scan.h"
+
+enum {
+    SCAN_SOI_FF = 0,    // first byte, FF
+    SCAN_SOI_D8,        // second byte, D8
+    SCAN_MARKER,        // FF of the next marker
+    SCAN_CODE,          // marker code after FF
+    SCAN_LEN_HI,        // segment length, high byte
+    SCAN_LEN_LO,        // segment length, low byte
+    SCAN_SKIP,          // segment payload
+    SCAN_SOS_SKIP,      // SOS header, entropy coded data follows
+    SCAN_ENTROPY,       // entropy coded data, looking for FF
+    SCAN_ENTROPY_FF,    // FF inside entropy coded data
+};
+
+#define JPEG_SOI  0xD8
+#define JPEG_EOI  0xD9
+#define JPEG_SOS  0xDA
+#define JPEG_TEM  0x01
+#define JPEG_RST0 0xD0
+#define JPEG_RST7 0xD7
+
+void cam_jpeg_scan_init(cam_jpeg_scan_t *scan)
+{
+    memset(scan, 0, sizeof(*scan));
+}
+
+static cam_jpeg_scan_result_t scan_finish(cam_jpeg_scan_t *scan, cam_jpeg_scan_result_t result)
+{
+    scan->result = result;
+    if (result == CAM_JPEG_SCAN_END) {
+        scan->length = scan->pos;
+    }
+    return result;
+}
+
+// Marker code after FF, outside entropy coded data
+static cam_jpeg_scan_result_t scan_code(cam_jpeg_scan_t *scan, uint8_t code)
+{
+    if (code == 0xFF) {
+        scan->state = SCAN_CODE;            // fill byte
+    } else if (code == JPEG_EOI) {
+        return scan_finish(scan, CAM_JPEG_SCAN_END);
+    } else if (code == JPEG_TEM || (code >= JPEG_RST0 && code <= JPEG_RST7)) {
+        scan->state = SCAN_MARKER;          // no length field
+    } else if (code == 0x00 || code == JPEG_SOI) {
+        return scan_finish(scan, CAM_JPEG_SCAN_BAD);
+    } else {
+        scan->state = SCAN_LEN_HI;
+        scan->skip = code == JPEG_SOS;      // remembered until the length is known
+    }
+    return CAM_JPEG_SCAN_MORE;
+}
+
+cam_jpeg_scan_result_t cam_jpeg_scan(cam_jpeg_scan_t *scan, const uint8_t *data, size_t len)
+{
+    if (scan->result != CAM_JPEG_SCAN_MORE) {
+        return scan->result;
+    }
+    const uint8_t *p = data;
+    const uint8_t *end = data + len;
+
+    while (p < end) {
+        switch (scan->state) {
+        case SCAN_ENTROPY: {
+            // Nearly all bytes are spent here, FF is rare in entropy coded data
+            const uint8_t *ff = memchr(p, 0xFF, end - p);
+            if (!ff) {
+                scan->pos += end - p;
+                return CAM_JPEG_SCAN_MORE;
+            }
+            scan->pos += ff - p + 1;
+            p = ff + 1;
+            scan->state = SCAN_ENTROPY_FF;
+            break;
+        }
+        case SCAN_ENTROPY_FF: {
+            const uint8_t b = *p++;
+            scan->pos++;
+            if (b == 0x00 || (b >= JPEG_RST0 && b <= JPEG_RST7)) {
+                scan->state = SCAN_ENTROPY;     // stuffed FF or restart marker
+            } else if (b != 0xFF && scan_code(scan, b) != CAM_JPEG_SCAN_MORE) {
+                return scan->result;
+            }
+            break;
+        }
+        case SCAN_SKIP:
+        case SCAN_SOS_SKIP: {
+            size_t n = end - p;
+            if (n > scan->skip) {
+                n = scan->skip;
+            }
+            p += n;
+            scan->pos += n;
+            scan->skip -= n;
+            if (!scan->skip) {
+                scan->state = scan->state == SCAN_SOS_SKIP ? SCAN_ENTROPY : SCAN_MARKER;
+            }
+            break;
+        }
+        default: {
+            const uint8_t b = *p++;
+            scan->pos++;
+            switch (scan->state) {
+            case SCAN_SOI_FF:
+            case SCAN_SOI_D8:
+                if (b != (scan->state == SCAN_SOI_FF ? 0xFF : JPEG_SOI)) {
+                    return scan_finish(scan, CAM_JPEG_SCAN_NO_SOI);
+                }
+                scan->state++;
+                break;
+            case SCAN_MARKER:
+                if (b != 0xFF) {
+                    // SOI must be followed by a marker, anything else means the data is not framed
+                    return scan_finish(scan, scan->pos == 3 ? CAM_JPEG_SCAN_NO_SOI : CAM_JPEG_SCAN_BAD);
+                }
+                scan->state = SCAN_CODE;
+                break;
+            case SCAN_CODE:
+                if (scan_code(scan, b) != CAM_JPEG_SCAN_MORE) {
+                    return scan->result;
+                }
+                break;
+            case SCAN_LEN_HI:
+                scan->seg_len = b << 8;
+                scan->state = SCAN_LEN_LO;
+                break;
+            case SCAN_LEN_LO:
+                scan->seg_len |= b;
+                if (scan->seg_len < 2) {
+                    return scan_finish(scan, CAM_JPEG_SCAN_BAD);
+                }
+                scan->state = scan->skip ? SCAN_SOS_SKIP : SCAN_SKIP;
+                scan->skip = scan->seg_len - 2;
+                if (!scan->skip) {
+                    scan->state = scan->state == SCAN_SOS_SKIP ? SCAN_ENTROPY : SCAN_MARKER;
+                }
+                break;
+            }
+            break;
+        }
+        }
+    }
+    return CAM_JPEG_SCAN_MORE;
+}
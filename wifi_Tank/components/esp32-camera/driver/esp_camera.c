@@ -0,0 +1,1162 @@
+// Copyright 2015-2016 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "time.h"
+#include "sys/time.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gpio.h"
+#include "esp_system.h"
+#include "esp_idf_version.h"
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include "esp_app_desc.h"
+#else
+#include "esp_ota_ops.h"
+#define esp_app_get_description esp_ota_get_app_description
+#endif
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "sensor.h"
+#include "sccb.h"
+#include "cam_hal.h"
+#include "cam_gray.h"
+#include "esp_camera.h"
+#include "xclk.h"
+#if CONFIG_OV2640_SUPPORT
+#include "ov2640.h"
+#endif
+#if CONFIG_OV7725_SUPPORT
+#include "ov7725.h"
+#endif
+#if CONFIG_OV3660_SUPPORT
+#include "ov3660.h"
+#endif
+#if CONFIG_OV5640_SUPPORT
+#include "ov5640.h"
+#endif
+#if CONFIG_NT99141_SUPPORT
+#include "nt99141.h"
+#endif
+#if CONFIG_OV7670_SUPPORT
+#include "ov7670.h"
+#endif
+#if CONFIG_GC2145_SUPPORT
+#include "gc2145.h"
+#endif
+#if CONFIG_GC032A_SUPPORT
+#include "gc032a.h"
+#endif
+#if CONFIG_GC0308_SUPPORT
+#include "gc0308.h"
+#endif
+#if CONFIG_BF3005_SUPPORT
+#include "bf3005.h"
+#endif
+#if CONFIG_BF20A6_SUPPORT
+#include "bf20a6.h"
+#endif
+#if CONFIG_SC101IOT_SUPPORT
+#include "sc101iot.h"
+#endif
+#if CONFIG_SC030IOT_SUPPORT
+#include "sc030iot.h"
+#endif
+#if CONFIG_SC031GS_SUPPORT
+#include "sc031gs.h"
+#endif
+#if CONFIG_MEGA_CCM_SUPPORT
+#include "mega_ccm.h"
+#endif
+#if CONFIG_HM1055_SUPPORT
+#include "hm1055.h"
+#endif
+#if CONFIG_HM0360_SUPPORT
+#include "hm0360.h"
+#endif
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#define TAG ""
+#else
+#include "esp_log.h"
+static const char *TAG = "camera";
+#endif
+
+typedef struct {
+    sensor_t sensor;
+    camera_fb_t fb;
+} camera_state_t;
+
+static const char *CAMERA_SENSOR_NVS_KEY = "sensor";
+static const char *CAMERA_PIXFORMAT_NVS_KEY = "pixformat";
+static const char *CAMERA_BOOT_NVS_KEY = "boot";
+static const char *CAMERA_PRESET_NVS_KEY = "presets";
+static camera_state_t *s_state = NULL;
+static camera_config_t s_saved_config;
+static struct camera_presets *s_presets;    // presets of s_presets_key, kept in RAM for switching
+static char s_presets_key[16];              // NVS namespace names are up to 15 characters
+
+#if CONFIG_IDF_TARGET_ESP32S3 // LCD_CAM module of ESP32-S3 will generate xclk
+#define CAMERA_ENABLE_OUT_CLOCK(v)
+#define CAMERA_DISABLE_OUT_CLOCK()
+#else
+#define CAMERA_ENABLE_OUT_CLOCK(v) camera_enable_out_clock((v))
+#define CAMERA_DISABLE_OUT_CLOCK() camera_disable_out_clock()
+#endif
+
+typedef struct {
+    int (*detect)(int slv_addr, sensor_id_t *id);
+    int (*init)(sensor_t *sensor);
+} sensor_func_t;
+
+static const sensor_func_t g_sensors[] = {
+#if CONFIG_OV7725_SUPPORT
+    {esp32_camera_ov7725_detect, esp32_camera_ov7725_init},
+#endif
+#if CONFIG_OV7670_SUPPORT
+    {esp32_camera_ov7670_detect, esp32_camera_ov7670_init},
+#endif
+#if CONFIG_OV2640_SUPPORT
+    {esp32_camera_ov2640_detect, esp32_camera_ov2640_init},
+#endif
+#if CONFIG_OV3660_SUPPORT
+    {esp32_camera_ov3660_detect, esp32_camera_ov3660_init},
+#endif
+#if CONFIG_OV5640_SUPPORT
+    {esp32_camera_ov5640_detect, esp32_camera_ov5640_init},
+#endif
+#if CONFIG_NT99141_SUPPORT
+    {esp32_camera_nt99141_detect, esp32_camera_nt99141_init},
+#endif
+#if CONFIG_GC2145_SUPPORT
+    {esp32_camera_gc2145_detect, esp32_camera_gc2145_init},
+#endif
+#if CONFIG_GC032A_SUPPORT
+    {esp32_camera_gc032a_detect, esp32_camera_gc032a_init},
+#endif
+#if CONFIG_GC0308_SUPPORT
+    {esp32_camera_gc0308_detect, esp32_camera_gc0308_init},
+#endif
+#if CONFIG_BF3005_SUPPORT
+    {esp32_camera_bf3005_detect, esp32_camera_bf3005_init},
+#endif
+#if CONFIG_BF20A6_SUPPORT
+    {esp32_camera_bf20a6_detect, esp32_camera_bf20a6_init},
+#endif
+#if CONFIG_SC101IOT_SUPPORT
+    {esp32_camera_sc101iot_detect, esp32_camera_sc101iot_init},
+#endif
+#if CONFIG_SC030IOT_SUPPORT
+    {esp32_camera_sc030iot_detect, esp32_camera_sc030iot_init},
+#endif
+#if CONFIG_SC031GS_SUPPORT
+    {esp32_camera_sc031gs_detect, esp32_camera_sc031gs_init},
+#endif
+#if CONFIG_MEGA_CCM_SUPPORT
+    {esp32_camera_mega_ccm_detect, esp32_camera_mega_ccm_init},
+#endif
+#if CONFIG_HM1055_SUPPORT
+    {esp32_camera_hm1055_detect, esp32_camera_hm1055_init},
+#endif
+#if CONFIG_HM0360_SUPPORT
+    {esp32_camera_hm0360_detect, esp32_camera_hm0360_init},
+#endif
+};
+
+#define CAMERA_BOOT_VERSION 2
+#define CAMERA_RESET_SETTLE_MS 10   // the register tables wait as long after a soft reset
+#define CAMERA_PRESET_VERSION 1
+#define CAMERA_PRESET_MAX 8
+
+// Configuration the cached sensor state was recorded with
+typedef struct {
+    int pin_sccb_sda;
+    int pin_sccb_scl;
+    int sccb_i2c_port;
+    int xclk_freq_hz;
+    pixformat_t pixel_format;
+    framesize_t frame_size;
+    int jpeg_quality;
+#if CONFIG_CAMERA_CONVERTER_ENABLED
+    camera_conv_mode_t conv_mode;
+#endif
+} camera_boot_config_t;
+
+// NVS blob of esp_camera_init_cached(): the sensor the full probe found and the writes that configured it
+typedef struct {
+    uint16_t version;
+    uint16_t count;             // recorded writes in regs
+    uint16_t reset;             // leading writes that soft reset the sensor
+    uint8_t slv_addr;
+    bool addr16;
+    uint8_t app_sha256[32];     // ELF hash of the firmware that recorded it, its setup and register tables
+    camera_boot_config_t config;
+    sensor_id_t id;
+    pixformat_t pixformat;
+    camera_status_t status;
+    uint16_t regs[][2];
+} camera_boot_cache_t;
+
+// Power, clock and SCCB bus for the sensor, s_state allocated
+static esp_err_t camera_power_up(const camera_config_t *config)
+{
+    esp_err_t ret = ESP_OK;
+    if (s_state != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    s_state = (camera_state_t *) calloc(1, sizeof(camera_state_t));
+    if (!s_state) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (config->pin_xclk >= 0) {
+        ESP_LOGD(TAG, "Enabling XCLK output");
+        CAMERA_ENABLE_OUT_CLOCK(config);
+    }
+
+    if (config->pin_sccb_sda != -1) {
+        ESP_LOGD(TAG, "Initializing SCCB");
+        ret = SCCB_Init(config->pin_sccb_sda, config->pin_sccb_scl);
+    } else {
+        ESP_LOGD(TAG, "Using existing I2C port");
+        ret = SCCB_Use_Port(config->sccb_i2c_port);
+    }
+
+    if(ret != ESP_OK) {
+        ESP_LOGE(TAG, "sccb init err");
+        goto err;
+    }
+
+    if (config->pin_pwdn >= 0) {
+        ESP_LOGD(TAG, "Resetting camera by power down line");
+        gpio_config_t conf = { 0 };
+        conf.pin_bit_mask = 1LL << config->pin_pwdn;
+        conf.mode = GPIO_MODE_OUTPUT;
+        gpio_config(&conf);
+
+        // carefull, logic is inverted compared to reset pin
+        gpio_set_level(config->pin_pwdn, 1);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+        gpio_set_level(config->pin_pwdn, 0);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+    }
+
+    if (config->pin_reset >= 0) {
+        ESP_LOGD(TAG, "Resetting camera");
+        gpio_config_t conf = { 0 };
+        conf.pin_bit_mask = 1LL << config->pin_reset;
+        conf.mode = GPIO_MODE_OUTPUT;
+        gpio_config(&conf);
+
+        gpio_set_level(config->pin_reset, 0);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+        gpio_set_level(config->pin_reset, 1);
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+    }
+    return ESP_OK;
+
+err :
+    CAMERA_DISABLE_OUT_CLOCK();
+    return ret;
+}
+
+static esp_err_t camera_probe(const camera_config_t *config, camera_model_t *out_camera_model)
+{
+    esp_err_t ret = ESP_OK;
+    *out_camera_model = CAMERA_NONE;
+    ret = camera_power_up(config);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ESP_LOGD(TAG, "Searching for camera address");
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+
+    int camera_model_id;
+    uint8_t slv_addr = 0x0;
+
+    /**
+     * This loop probes each known sensor until a supported camera is detected
+     */
+    for(camera_model_id = 0; *out_camera_model == CAMERA_NONE && camera_model_id < CAMERA_MODEL_MAX ; camera_model_id++) {
+        slv_addr = camera_sensor[camera_model_id].sccb_addr;
+
+        if (ESP_OK != SCCB_Probe(slv_addr)) {
+            continue;
+        }
+
+        s_state->sensor.slv_addr = slv_addr;
+        s_state->sensor.xclk_freq_hz = config->xclk_freq_hz;
+
+        /**
+         * Read sensor ID and then initialize sensor
+         * Attention: Some sensors have the same SCCB address. Therefore, several attempts may be made in the detection process
+         */
+        sensor_id_t *id = &s_state->sensor.id;
+
+        for (size_t i = 0; i < sizeof(g_sensors) / sizeof(sensor_func_t); i++) {
+            if (g_sensors[i].detect(slv_addr, id)) {
+                ESP_LOGI(TAG, "Camera PID=0x%02x VER=0x%02x MIDL=0x%02x MIDH=0x%02x",
+                    id->PID, id->VER, id->MIDH, id->MIDL);
+                camera_sensor_info_t *info = esp_camera_sensor_get_info(id);
+                if (NULL != info) {
+                    *out_camera_model = info->model;
+                    ESP_LOGI(TAG, "Detected %s camera", info->name);
+                    g_sensors[i].init(&s_state->sensor);
+                    break;
+                }
+            }
+        }
+    }
+
+    if (CAMERA_NONE == *out_camera_model) { //If no supported sensors are detected
+        ESP_LOGE(TAG, "Detected camera not supported.");
+        ret = ESP_ERR_NOT_SUPPORTED;
+        goto err;
+    }
+
+    ESP_LOGI(TAG, "Detected camera at address=0x%02x", slv_addr);
+
+    ESP_LOGD(TAG, "Doing SW reset of sensor");
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+
+    return s_state->sensor.reset(&s_state->sensor);
+err :
+    CAMERA_DISABLE_OUT_CLOCK();
+    return ret;
+}
+
+#if CONFIG_CAMERA_CONVERTER_ENABLED
+static pixformat_t get_output_data_format(camera_conv_mode_t conv_mode)
+{
+    pixformat_t format = PIXFORMAT_RGB565;
+    switch (conv_mode) {
+    case YUV422_TO_YUV420:
+        format = PIXFORMAT_YUV420;
+        break;
+    case YUV422_TO_RGB565: // default format is RGB565
+    default:
+        break;
+    }
+    ESP_LOGD(TAG, "Convert to %d format enabled", format);
+    return format;
+}
+#endif
+
+esp_err_t esp_camera_init(const camera_config_t *config)
+{
+    esp_err_t err;
+    s_saved_config = *config;
+    err = cam_init(config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Camera init failed with error 0x%x", err);
+        return err;
+    }
+
+    camera_model_t camera_model = CAMERA_NONE;
+    err = camera_probe(config, &camera_model);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Camera probe failed with error 0x%x(%s)", err, esp_err_to_name(err));
+        goto fail;
+    }
+
+    framesize_t frame_size = (framesize_t) config->frame_size;
+    pixformat_t pix_format = (pixformat_t) config->pixel_format;
+
+    if (PIXFORMAT_JPEG == pix_format && (!camera_sensor[camera_model].support_jpeg)) {
+        ESP_LOGE(TAG, "JPEG format is not supported on this sensor");
+        err = ESP_ERR_NOT_SUPPORTED;
+        goto fail;
+    }
+
+    if (frame_size > camera_sensor[camera_model].max_size) {
+        ESP_LOGW(TAG, "The frame size exceeds the maximum for this sensor, it will be forced to the maximum possible value");
+        frame_size = camera_sensor[camera_model].max_size;
+    }
+
+    err = cam_config(config, frame_size, s_state->sensor.id.PID);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Camera config failed with error 0x%x", err);
+        goto fail;
+    }
+
+    s_state->sensor.status.framesize = frame_size;
+    s_state->sensor.pixformat = pix_format;
+
+    ESP_LOGD(TAG, "Setting frame size to %dx%d", resolution[frame_size].width, resolution[frame_size].height);
+    if (s_state->sensor.set_framesize(&s_state->sensor, frame_size) != 0) {
+        ESP_LOGE(TAG, "Failed to set frame size");
+        err = ESP_ERR_CAMERA_FAILED_TO_SET_FRAME_SIZE;
+        goto fail;
+    }
+    s_state->sensor.set_pixformat(&s_state->sensor, pix_format);
+#if CONFIG_CAMERA_CONVERTER_ENABLED
+    if(config->conv_mode) {
+        s_state->sensor.pixformat = get_output_data_format(config->conv_mode); // If conversion enabled, change the out data format by conversion mode
+    }
+#endif
+
+    if (s_state->sensor.id.PID == OV2640_PID) {
+        s_state->sensor.set_gainceiling(&s_state->sensor, GAINCEILING_2X);
+        s_state->sensor.set_bpc(&s_state->sensor, false);
+        s_state->sensor.set_wpc(&s_state->sensor, true);
+        s_state->sensor.set_lenc(&s_state->sensor, true);
+    }
+
+    if (pix_format == PIXFORMAT_JPEG) {
+        s_state->sensor.set_quality(&s_state->sensor, config->jpeg_quality);
+    }
+    s_state->sensor.init_status(&s_state->sensor);
+
+    cam_start();
+
+    return ESP_OK;
+
+fail:
+    esp_camera_deinit();
+    return err;
+}
+
+static void camera_boot_config(const camera_config_t *config, camera_boot_config_t *out)
+{
+    memset(out, 0, sizeof(*out));   // compared with memcmp(), padding included
+    out->pin_sccb_sda = config->pin_sccb_sda;
+    out->pin_sccb_scl = config->pin_sccb_scl;
+    out->sccb_i2c_port = config->sccb_i2c_port;
+    out->xclk_freq_hz = config->xclk_freq_hz;
+    out->pixel_format = config->pixel_format;
+    out->frame_size = config->frame_size;
+    out->jpeg_quality = config->jpeg_quality;
+#if CONFIG_CAMERA_CONVERTER_ENABLED
+    out->conv_mode = config->conv_mode;
+#endif
+}
+
+// The cache for this configuration, NULL if there is none
+static camera_boot_cache_t *camera_boot_load(const char *key, const camera_config_t *config)
+{
+#if ESP_IDF_VERSION_MAJOR > 3
+    nvs_handle_t handle;
+#else
+    nvs_handle handle;
+#endif
+    if (nvs_open(key, NVS_READONLY, &handle) != ESP_OK) {
+        return NULL;
+    }
+    camera_boot_cache_t *cache = NULL;
+    size_t size = 0;
+    if (nvs_get_blob(handle, CAMERA_BOOT_NVS_KEY, NULL, &size) == ESP_OK && size >= sizeof(camera_boot_cache_t)) {
+        cache = (camera_boot_cache_t *) malloc(size);
+        if (cache && nvs_get_blob(handle, CAMERA_BOOT_NVS_KEY, cache, &size) != ESP_OK) {
+            free(cache);
+            cache = NULL;
+        }
+    }
+    nvs_close(handle);
+    if (!cache) {
+        return NULL;
+    }
+
+    camera_boot_config_t boot_config;
+    camera_boot_config(config, &boot_config);
+    if (cache->version != CAMERA_BOOT_VERSION || size != sizeof(camera_boot_cache_t) + cache->count * sizeof(cache->regs[0])
+        || cache->reset > cache->count || memcmp(&cache->config, &boot_config, sizeof(boot_config)) != 0) {
+        ESP_LOGI(TAG, "Cached sensor state is for another configuration");
+        free(cache);
+        return NULL;
+    }
+    if (memcmp(cache->app_sha256, esp_app_get_description()->app_elf_sha256, sizeof(cache->app_sha256)) != 0) {
+        ESP_LOGI(TAG, "Cached sensor state is from another firmware");
+        free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+// Stores what the full probe found and the writes since the sensor's soft reset
+static esp_err_t camera_boot_save(const char *key, const camera_config_t *config)
+{
+    const sensor_t *s = &s_state->sensor;
+    const uint16_t (*regs)[2];
+    size_t reset;
+    bool addr16;
+    const size_t count = SCCB_Shadow_Recorded(s->slv_addr, &regs, &reset, &addr16);
+    if (count == 0 || reset == 0) {
+        ESP_LOGW(TAG, "No sensor state recorded, the next boot probes again");
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    const size_t size = sizeof(camera_boot_cache_t) + count * sizeof(regs[0]);
+    camera_boot_cache_t *cache = (camera_boot_cache_t *) calloc(1, size);
+    if (!cache) {
+        return ESP_ERR_NO_MEM;
+    }
+    cache->version = CAMERA_BOOT_VERSION;
+    cache->count = count;
+    cache->reset = reset;
+    cache->slv_addr = s->slv_addr;
+    cache->addr16 = addr16;
+    memcpy(cache->app_sha256, esp_app_get_description()->app_elf_sha256, sizeof(cache->app_sha256));
+    camera_boot_config(config, &cache->config);
+    cache->id = s->id;
+    cache->pixformat = s->pixformat;
+    cache->status = s->status;
+    memcpy(cache->regs, regs, count * sizeof(regs[0]));
+
+#if ESP_IDF_VERSION_MAJOR > 3
+    nvs_handle_t handle;
+#else
+    nvs_handle handle;
+#endif
+    esp_err_t ret = nvs_open(key, NVS_READWRITE, &handle);
+    if (ret == ESP_OK) {
+        ret = nvs_set_blob(handle, CAMERA_BOOT_NVS_KEY, cache, size);
+        if (ret == ESP_OK) {
+            ret = nvs_commit(handle);
+        }
+        nvs_close(handle);
+    }
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Cached sensor state, %u register writes", (unsigned) count);
+    } else {
+        ESP_LOGW(TAG, "Error (%d) caching the sensor state in nvs namespace \"%s\"", ret, key);
+    }
+    free(cache);
+    return ret;
+}
+
+// The cached sensor at its address instead of the probe, then its registers instead of the driver tables
+static esp_err_t camera_boot_sensor(const camera_boot_cache_t *cache)
+{
+    sensor_t *s = &s_state->sensor;
+    if (SCCB_Probe(cache->slv_addr) != ESP_OK) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    s->slv_addr = cache->slv_addr;
+    s->xclk_freq_hz = s_saved_config.xclk_freq_hz;
+
+    const sensor_func_t *func = NULL;
+    for (size_t i = 0; func == NULL && i < sizeof(g_sensors) / sizeof(sensor_func_t); i++) {
+        if (g_sensors[i].detect(cache->slv_addr, &s->id) == cache->id.PID && s->id.VER == cache->id.VER
+            && s->id.MIDH == cache->id.MIDH && s->id.MIDL == cache->id.MIDL) {
+            func = &g_sensors[i];
+        }
+    }
+    if (func == NULL) {
+        return ESP_ERR_CAMERA_NOT_DETECTED;
+    }
+    ESP_LOGI(TAG, "Camera PID=0x%02x at address=0x%02x, cached state", s->id.PID, s->slv_addr);
+    func->init(s);
+
+    int ret = 0;
+    for (size_t i = 0; ret == 0 && i < cache->reset; i++) {
+        ret = cache->addr16 ? SCCB_Write16(s->slv_addr, cache->regs[i][0], cache->regs[i][1])
+                            : SCCB_Write(s->slv_addr, cache->regs[i][0], cache->regs[i][1]);
+    }
+    SCCB_Shadow_Invalidate(s->slv_addr);
+    if (ret == 0) {
+        vTaskDelay(CAMERA_RESET_SETTLE_MS / portTICK_PERIOD_MS);
+        const uint16_t (*regs)[2] = cache->regs + cache->reset;
+        const size_t count = cache->count - cache->reset;
+        ret = cache->addr16 ? SCCB_Write16_Regs(s->slv_addr, regs, count) : SCCB_Write_Regs(s->slv_addr, regs, count);
+    }
+    if (ret != 0) {
+        return ESP_FAIL;
+    }
+    s->status = cache->status;
+    s->pixformat = cache->pixformat;
+    return ESP_OK;
+}
+
+static esp_err_t camera_init_from_boot(const camera_config_t *config, const camera_boot_cache_t *cache)
+{
+    s_saved_config = *config;
+    esp_err_t err = cam_init(config);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = camera_power_up(config);
+    if (err == ESP_OK) {
+        err = camera_boot_sensor(cache);
+    }
+    if (err == ESP_OK) {
+        err = cam_config(config, cache->status.framesize, cache->id.PID);
+    }
+    if (err != ESP_OK) {
+        esp_camera_deinit();
+        return err;
+    }
+    cam_start();
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_init_cached(const camera_config_t *config, const char *key, camera_setup_cb_t setup)
+{
+    camera_boot_cache_t *cache = camera_boot_load(key, config);
+    if (cache) {
+        esp_err_t err = camera_init_from_boot(config, cache);
+        free(cache);
+        if (err == ESP_OK) {
+            return ESP_OK;
+        }
+        ESP_LOGW(TAG, "Cached sensor state not usable (0x%x), probing", err);
+    }
+
+    SCCB_Shadow_Record(true);
+    esp_err_t err = esp_camera_init(config);
+    if (err == ESP_OK && setup) {
+        err = setup(&s_state->sensor);
+    }
+    if (err == ESP_OK) {
+        camera_boot_save(key, config);
+    }
+    SCCB_Shadow_Record(false);
+    return err;
+}
+
+esp_err_t esp_camera_deinit()
+{
+    cam_gray_stop();
+    esp_err_t ret = cam_deinit();
+    CAMERA_DISABLE_OUT_CLOCK();
+    if (s_state) {
+        SCCB_Deinit();
+
+        free(s_state);
+        s_state = NULL;
+    }
+    free(s_presets);            // read again with the next sensor
+    s_presets = NULL;
+
+    return ret;
+}
+
+#define FB_GET_TIMEOUT (4000 / portTICK_PERIOD_MS)
+
+camera_fb_t *esp_camera_fb_get()
+{
+    if (s_state == NULL) {
+        return NULL;
+    }
+    camera_fb_t *fb = cam_take(FB_GET_TIMEOUT);
+    //set the frame properties
+    if (fb) {
+        fb->width = resolution[s_state->sensor.status.framesize].width;
+        fb->height = resolution[s_state->sensor.status.framesize].height;
+        fb->format = s_state->sensor.pixformat;
+    }
+    return fb;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb)
+{
+    if (s_state == NULL) {
+        return;
+    }
+    cam_give(fb);
+}
+
+camera_fb_t *esp_camera_fb_ref(camera_fb_t *fb)
+{
+    if (s_state == NULL || !cam_ref(fb)) {
+        return NULL;
+    }
+    return fb;
+}
+
+void esp_camera_fb_unref(camera_fb_t *fb)
+{
+    esp_camera_fb_return(fb);
+}
+
+esp_err_t esp_camera_get_stats(camera_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_state == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    cam_get_stats(stats);
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_gray_start(const camera_gray_config_t *config)
+{
+    if (s_state == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (s_state->sensor.pixformat != PIXFORMAT_JPEG) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    // the buffers take the largest frame the configuration allows
+    const resolution_info_t *res = &resolution[s_saved_config.frame_size];
+    return cam_gray_start(config, res->width, res->height);
+}
+
+esp_err_t esp_camera_gray_stop(void)
+{
+    return cam_gray_stop();
+}
+
+camera_fb_t *esp_camera_gray_get(uint32_t timeout_ms)
+{
+    return cam_gray_take(pdMS_TO_TICKS(timeout_ms));
+}
+
+void esp_camera_gray_return(camera_fb_t *fb)
+{
+    cam_gray_give(fb);
+}
+
+esp_err_t esp_camera_gray_get_stats(camera_gray_stats_t *stats)
+{
+    return cam_gray_get_stats(stats);
+}
+
+sensor_t *esp_camera_sensor_get()
+{
+    if (s_state == NULL) {
+        return NULL;
+    }
+    return &s_state->sensor;
+}
+
+// A sensor setting besides frame size and pixel format, with its setter
+typedef struct {
+    uint8_t offset;         // in camera_status_t
+    uint8_t size;
+    bool is_signed;
+    bool linked;            // shares registers with the other linked settings, see camera_apply_status()
+    uint16_t setter;        // in sensor_t, int (*)(sensor_t *, int)
+} camera_setting_t;
+
+#define CAMERA_SETTING(field, is_signed, setter) \
+    { offsetof(camera_status_t, field), sizeof(((camera_status_t *)0)->field), is_signed, false, offsetof(sensor_t, setter) }
+#define CAMERA_LINKED_SETTING(field, is_signed, setter) \
+    { offsetof(camera_status_t, field), sizeof(((camera_status_t *)0)->field), is_signed, true, offsetof(sensor_t, setter) }
+
+// In the order they are applied, enables before the values that depend on them.
+// Bump CAMERA_PRESET_VERSION when changing it.
+static const camera_setting_t camera_settings[] = {
+    CAMERA_SETTING(quality, false, set_quality),
+    CAMERA_LINKED_SETTING(brightness, true, set_brightness),
+    CAMERA_LINKED_SETTING(contrast, true, set_contrast),
+    CAMERA_LINKED_SETTING(saturation, true, set_saturation),
+    CAMERA_SETTING(sharpness, true, set_sharpness),
+    CAMERA_SETTING(denoise, false, set_denoise),
+    CAMERA_LINKED_SETTING(special_effect, false, set_special_effect),
+    CAMERA_SETTING(awb, false, set_whitebal),
+    CAMERA_SETTING(awb_gain, false, set_awb_gain),
+    CAMERA_SETTING(wb_mode, false, set_wb_mode),
+    CAMERA_SETTING(aec, false, set_exposure_ctrl),
+    CAMERA_SETTING(aec2, false, set_aec2),
+    CAMERA_SETTING(ae_level, true, set_ae_level),
+    CAMERA_SETTING(aec_value, false, set_aec_value),
+    CAMERA_SETTING(agc, false, set_gain_ctrl),
+    CAMERA_SETTING(agc_gain, false, set_agc_gain),
+    CAMERA_SETTING(gainceiling, false, set_gainceiling),    // takes a gainceiling_t, passed the same way
+    CAMERA_SETTING(bpc, false, set_bpc),
+    CAMERA_SETTING(wpc, false, set_wpc),
+    CAMERA_SETTING(raw_gma, false, set_raw_gma),
+    CAMERA_SETTING(lenc, false, set_lenc),
+    CAMERA_SETTING(hmirror, false, set_hmirror),
+    CAMERA_SETTING(vflip, false, set_vflip),
+    CAMERA_SETTING(dcw, false, set_dcw),
+    CAMERA_SETTING(colorbar, false, set_colorbar),
+};
+
+#define CAMERA_PRESET_SETTINGS 25
+#define CAMERA_PRESET_VALUES (CAMERA_PRESET_SETTINGS + 1)  // aec_value takes two bytes
+_Static_assert(sizeof(camera_settings) / sizeof(camera_settings[0]) == CAMERA_PRESET_SETTINGS, "camera_settings");
+
+// One preset as NVS keeps it, the settings packed in camera_settings[] order
+typedef struct {
+    char name[CAMERA_PRESET_NAME_LEN + 1];
+    uint8_t pixformat;
+    uint8_t framesize;
+    uint8_t values[CAMERA_PRESET_VALUES];
+} camera_preset_t;
+
+// All presets of a namespace in one blob, only count of them are stored
+typedef struct camera_presets {
+    uint8_t version;
+    uint8_t count;
+    uint8_t settings;       // CAMERA_PRESET_SETTINGS of the firmware that wrote it
+    camera_preset_t preset[CAMERA_PRESET_MAX];
+} camera_presets_t;
+
+static int camera_setting_get(const camera_status_t *st, const camera_setting_t *setting)
+{
+    const uint8_t *p = (const uint8_t *)st + setting->offset;
+    if (setting->size == 2) {
+        uint16_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+    return setting->is_signed ? (int8_t)*p : *p;
+}
+
+static void camera_preset_pack(camera_preset_t *preset, const camera_status_t *st, pixformat_t pixformat)
+{
+    uint8_t *v = preset->values;
+    preset->pixformat = pixformat;
+    preset->framesize = st->framesize;
+    for (size_t i = 0; i < CAMERA_PRESET_SETTINGS; i++) {
+        const int value = camera_setting_get(st, &camera_settings[i]);
+        *v++ = value;
+        if (camera_settings[i].size == 2) {
+            *v++ = value >> 8;
+        }
+    }
+}
+
+static void camera_preset_unpack(const camera_preset_t *preset, camera_status_t *st, pixformat_t *pixformat)
+{
+    const uint8_t *v = preset->values;
+    *pixformat = preset->pixformat;
+    st->framesize = preset->framesize;
+    for (size_t i = 0; i < CAMERA_PRESET_SETTINGS; i++) {
+        uint8_t *p = (uint8_t *)st + camera_settings[i].offset;
+        if (camera_settings[i].size == 2) {
+            const uint16_t value = v[0] | v[1] << 8;
+            memcpy(p, &value, sizeof(value));
+        } else {
+            *p = v[0];
+        }
+        v += camera_settings[i].size;
+    }
+}
+
+/**
+ * Brings the sensor to st and pf with the setters of what differs from its
+ * status. Frame size and pixel format go first, on their own since they
+ * reload register tables and wait for the sensor. The rest is batched on the
+ * register shadow, sensors with one get all their writes in one go.
+ *
+ * The linked settings overlap in the OV2640's indirect SDE registers, the
+ * last one set wins. When one of them changes all of them are set again, in
+ * table order, so the result does not depend on what was set before.
+ */
+static esp_err_t camera_apply_status(sensor_t *s, const camera_status_t *st, pixformat_t pf)
+{
+    int ret = 0;
+    if (st->framesize != s->status.framesize) {
+        ret |= s->set_framesize(s, st->framesize);
+    }
+    if (pf != s->pixformat) {
+        ret |= s->set_pixformat(s, pf);
+    }
+    bool linked = false;
+    for (size_t i = 0; i < CAMERA_PRESET_SETTINGS; i++) {
+        const camera_setting_t *setting = &camera_settings[i];
+        linked |= setting->linked && camera_setting_get(st, setting) != camera_setting_get(&s->status, setting);
+    }
+    SCCB_Shadow_Batch(s->slv_addr, true);   // sensors without a shadow get the writes right away
+    for (size_t i = 0; i < CAMERA_PRESET_SETTINGS; i++) {
+        const camera_setting_t *setting = &camera_settings[i];
+        const int value = camera_setting_get(st, setting);
+        if (value == camera_setting_get(&s->status, setting) && !(linked && setting->linked)) {
+            continue;
+        }
+        int (*set)(sensor_t *, int) = *(int (**)(sensor_t *, int))((uint8_t *)s + setting->setter);
+        if (set) {
+            ret |= set(s, value);
+        }
+    }
+    ret |= SCCB_Shadow_Batch(s->slv_addr, false);
+    return ret ? ESP_FAIL : ESP_OK;
+}
+
+esp_err_t esp_camera_save_to_nvs(const char *key)
+{
+#if ESP_IDF_VERSION_MAJOR > 3
+    nvs_handle_t handle;
+#else
+    nvs_handle handle;
+#endif
+    sensor_t *s = esp_camera_sensor_get();
+    if (s == NULL) {
+        return ESP_ERR_CAMERA_NOT_DETECTED;
+    }
+    esp_err_t ret = nvs_open(key, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_blob(handle, CAMERA_SENSOR_NVS_KEY, &s->status, sizeof(camera_status_t));
+    if (ret == ESP_OK) {
+        uint8_t pf = s->pixformat;
+        ret = nvs_set_u8(handle, CAMERA_PIXFORMAT_NVS_KEY, pf);
+    }
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return ret;
+}
+
+esp_err_t esp_camera_load_from_nvs(const char *key)
+{
+#if ESP_IDF_VERSION_MAJOR > 3
+    nvs_handle_t handle;
+#else
+    nvs_handle handle;
+#endif
+    camera_status_t st;
+    size_t size = sizeof(camera_status_t);
+    uint8_t pf;
+
+    sensor_t *s = esp_camera_sensor_get();
+    if (s == NULL) {
+        return ESP_ERR_CAMERA_NOT_DETECTED;
+    }
+    esp_err_t ret = nvs_open(key, NVS_READONLY, &handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Error (%d) opening nvs key \"%s\"", ret, key);
+        return ret;
+    }
+    ret = nvs_get_blob(handle, CAMERA_SENSOR_NVS_KEY, &st, &size);
+    if (ret == ESP_OK) {
+        ret = nvs_get_u8(handle, CAMERA_PIXFORMAT_NVS_KEY, &pf);
+    }
+    nvs_close(handle);
+    if (ret == ESP_OK) {
+        ret = camera_apply_status(s, &st, pf);
+    }
+    return ret;
+}
+
+static bool camera_preset_name_ok(const char *name)
+{
+    return name && name[0] && strlen(name) <= CAMERA_PRESET_NAME_LEN;
+}
+
+// The presets of key, read from NVS the first time. An unreadable store is an empty one.
+static camera_presets_t *camera_presets_load(const char *key)
+{
+    if (s_presets && strcmp(s_presets_key, key) == 0) {
+        return s_presets;
+    }
+    if (!s_presets) {
+        s_presets = malloc(sizeof(camera_presets_t));
+        if (!s_presets) {
+            return NULL;
+        }
+    }
+    snprintf(s_presets_key, sizeof(s_presets_key), "%s", key);
+    memset(s_presets, 0, sizeof(camera_presets_t));
+
+#if ESP_IDF_VERSION_MAJOR > 3
+    nvs_handle_t handle;
+#else
+    nvs_handle handle;
+#endif
+    if (nvs_open(key, NVS_READONLY, &handle) == ESP_OK) {
+        size_t size = sizeof(camera_presets_t);
+        if (nvs_get_blob(handle, CAMERA_PRESET_NVS_KEY, s_presets, &size) != ESP_OK ||
+            size < offsetof(camera_presets_t, preset) || s_presets->version != CAMERA_PRESET_VERSION ||
+            s_presets->settings != CAMERA_PRESET_SETTINGS || s_presets->count > CAMERA_PRESET_MAX ||
+            size != offsetof(camera_presets_t, preset) + s_presets->count * sizeof(camera_preset_t)) {
+            if (s_presets->version || s_presets->count) {
+                ESP_LOGW(TAG, "Presets in \"%s\" not usable, starting over", key);
+            }
+            memset(s_presets, 0, sizeof(camera_presets_t));
+        }
+        nvs_close(handle);
+    }
+    s_presets->version = CAMERA_PRESET_VERSION;
+    s_presets->settings = CAMERA_PRESET_SETTINGS;
+    return s_presets;
+}
+
+static esp_err_t camera_presets_store(const char *key, const camera_presets_t *presets)
+{
+#if ESP_IDF_VERSION_MAJOR > 3
+    nvs_handle_t handle;
+#else
+    nvs_handle handle;
+#endif
+    esp_err_t ret = nvs_open(key, NVS_READWRITE, &handle);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = nvs_set_blob(handle, CAMERA_PRESET_NVS_KEY, presets,
+                       offsetof(camera_presets_t, preset) + presets->count * sizeof(camera_preset_t));
+    if (ret == ESP_OK) {
+        ret = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return ret;
+}
+
+static camera_preset_t *camera_preset_find(camera_presets_t *presets, const char *name)
+{
+    for (int i = 0; i < presets->count; i++) {
+        if (strncmp(presets->preset[i].name, name, sizeof(presets->preset[i].name)) == 0) {
+            return &presets->preset[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_camera_preset_save(const char *key, const char *name, const camera_status_t *status, pixformat_t pixformat)
+{
+    if (!key || !status || !camera_preset_name_ok(name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    camera_presets_t *presets = camera_presets_load(key);
+    if (!presets) {
+        return ESP_ERR_NO_MEM;
+    }
+    camera_preset_t *preset = camera_preset_find(presets, name);
+    if (!preset) {
+        if (presets->count == CAMERA_PRESET_MAX) {
+            return ESP_ERR_NO_MEM;
+        }
+        preset = &presets->preset[presets->count++];
+    }
+    memset(preset, 0, sizeof(camera_preset_t));
+    snprintf(preset->name, sizeof(preset->name), "%s", name);
+    camera_preset_pack(preset, status, pixformat);
+
+    esp_err_t ret = camera_presets_store(key, presets);
+    if (ret != ESP_OK) {
+        s_presets_key[0] = 0;    // read the store again, it is not what NVS has
+    }
+    return ret;
+}
+
+esp_err_t esp_camera_preset_get(const char *key, const char *name, camera_status_t *status, pixformat_t *pixformat)
+{
+    if (!key || !status || !pixformat || !camera_preset_name_ok(name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    camera_presets_t *presets = camera_presets_load(key);
+    if (!presets) {
+        return ESP_ERR_NO_MEM;
+    }
+    const camera_preset_t *preset = camera_preset_find(presets, name);
+    if (!preset) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    memset(status, 0, sizeof(camera_status_t));
+    camera_preset_unpack(preset, status, pixformat);
+    return ESP_OK;
+}
+
+esp_err_t esp_camera_preset_apply(const char *key, const char *name)
+{
+    sensor_t *s = esp_camera_sensor_get();
+    if (s == NULL) {
+        return ESP_ERR_CAMERA_NOT_DETECTED;
+    }
+    camera_status_t st;
+    pixformat_t pf;
+    esp_err_t ret = esp_camera_preset_get(key, name, &st, &pf);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    st.scale = s->status.scale;
+    st.binning = s->status.binning;
+    return camera_apply_status(s, &st, pf);
+}
+
+esp_err_t esp_camera_preset_delete(const char *key, const char *name)
+{
+    if (!key || !camera_preset_name_ok(name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    camera_presets_t *presets = camera_presets_load(key);
+    if (!presets) {
+        return ESP_ERR_NO_MEM;
+    }
+    camera_preset_t *preset = camera_preset_find(presets, name);
+    if (!preset) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    const size_t index = preset - presets->preset;
+    memmove(preset, preset + 1, (presets->count - index - 1) * sizeof(camera_preset_t));
+    presets->count--;
+
+    esp_err_t ret = camera_presets_store(key, presets);
+    if (ret != ESP_OK) {
+        s_presets_key[0] = 0;
+    }
+    return ret;
+}
+
+void esp_camera_return_all(void) {
+    if (s_state == NULL) {
+        return;
+    }
+    cam_give_all();
+}
+
+bool esp_camera_available_frames(void)
+{
+    if (s_state == NULL) {
+        return false;
+    }
+    return cam_get_available_frames();
+}
+
+esp_err_t esp_camera_reconfigure(const camera_config_t *config)
+{
+    if (!config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (s_state) {
+        esp_err_t err = esp_camera_deinit();
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    s_saved_config = *config;
+    return esp_camera_init(&s_saved_config);
+}
+
+esp_err_t esp_camera_set_psram_mode(bool enable)
+{
+    cam_set_psram_mode(enable);
+    if (!s_state) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return esp_camera_reconfigure(&s_saved_config);
+}
+
+bool esp_camera_get_psram_mode(void)
+{
+    return cam_get_psram_mode();
+}
+
+esp_err_t esp_camera_set_zero_copy_mode(bool enable)
+{
+#if CONFIG_IDF_TARGET_ESP32S2 || CONFIG_IDF_TARGET_ESP32S3
+    if (!s_state) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    cam_set_zero_copy_mode(enable);
+    return esp_camera_reconfigure(&s_saved_config);
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+bool esp_camera_get_zero_copy_mode(void)
+{
+    return cam_get_zero_copy_mode();
+}
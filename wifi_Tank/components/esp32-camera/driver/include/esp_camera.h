@@ -0,0 +1,543 @@
+// Copyright 2015-2016 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/*
+ * Example Use
+ *
+    static camera_config_t camera_example_config = {
+        .pin_pwdn       = PIN_PWDN,
+        .pin_reset      = PIN_RESET,
+        .pin_xclk       = PIN_XCLK,
+        .pin_sccb_sda   = PIN_SIOD,
+        .pin_sccb_scl   = PIN_SIOC,
+        .pin_d7         = PIN_D7,
+        .pin_d6         = PIN_D6,
+        .pin_d5         = PIN_D5,
+        .pin_d4         = PIN_D4,
+        .pin_d3         = PIN_D3,
+        .pin_d2         = PIN_D2,
+        .pin_d1         = PIN_D1,
+        .pin_d0         = PIN_D0,
+        .pin_vsync      = PIN_VSYNC,
+        .pin_href       = PIN_HREF,
+        .pin_pclk       = PIN_PCLK,
+
+        .xclk_freq_hz   = 20000000,
+        .ledc_timer     = LEDC_TIMER_0,
+        .ledc_channel   = LEDC_CHANNEL_0,
+        .pixel_format   = PIXFORMAT_JPEG,
+        .frame_size     = FRAMESIZE_SVGA,
+        .jpeg_quality   = 10,
+        .fb_count       = 2,
+        .grab_mode      = CAMERA_GRAB_WHEN_EMPTY
+    };
+
+    esp_err_t camera_example_init(){
+        return esp_camera_init(&camera_example_config);
+    }
+
+    esp_err_t camera_example_capture(){
+        //capture a frame
+        camera_fb_t * fb = esp_camera_fb_get();
+        if (!fb) {
+            ESP_LOGE(TAG, "Frame buffer could not be acquired");
+            return ESP_FAIL;
+        }
+
+        //replace this with your own function
+        display_image(fb->width, fb->height, fb->pixformat, fb->buf, fb->len);
+
+        //return the frame buffer back to be reused
+        esp_camera_fb_return(fb);
+
+        return ESP_OK;
+    }
+*/
+
+#pragma once
+
+#include "esp_err.h"
+#include "driver/ledc.h"
+#include "sensor.h"
+#include "sys/time.h"
+#include "sdkconfig.h"
+
+/**
+ * @brief define for if chip supports camera
+ */
+#define ESP_CAMERA_SUPPORTED (CONFIG_IDF_TARGET_ESP32 | CONFIG_IDF_TARGET_ESP32S3 | \
+                             CONFIG_IDF_TARGET_ESP32S2)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration structure for camera initialization
+ */
+typedef enum {
+    CAMERA_GRAB_WHEN_EMPTY,         /*!< Fills buffers when they are empty. Less resources but first 'fb_count' frames might be old */
+    CAMERA_GRAB_LATEST              /*!< Except when 1 frame buffer is used, queue will always contain the last 'fb_count' frames */
+} camera_grab_mode_t;
+
+/**
+ * @brief Camera frame buffer location
+ */
+typedef enum {
+    CAMERA_FB_IN_PSRAM,         /*!< Frame buffer is placed in external PSRAM */
+    CAMERA_FB_IN_DRAM           /*!< Frame buffer is placed in internal DRAM */
+} camera_fb_location_t;
+
+#if CONFIG_CAMERA_CONVERTER_ENABLED
+/**
+ * @brief Camera RGB\YUV conversion mode
+ */
+typedef enum {
+    CONV_DISABLE,
+    RGB565_TO_YUV422,
+
+    YUV422_TO_RGB565,
+    YUV422_TO_YUV420
+} camera_conv_mode_t;
+#endif
+
+/**
+ * @brief Configuration structure for camera initialization
+ */
+typedef struct {
+    int pin_pwdn;                   /*!< GPIO pin for camera power down line */
+    int pin_reset;                  /*!< GPIO pin for camera reset line */
+    int pin_xclk;                   /*!< GPIO pin for camera XCLK line */
+    union {
+        int pin_sccb_sda;           /*!< GPIO pin for camera SDA line */
+        int pin_sscb_sda __attribute__((deprecated("please use pin_sccb_sda instead")));           /*!< GPIO pin for camera SDA line (legacy name) */
+    };
+    union {
+        int pin_sccb_scl;           /*!< GPIO pin for camera SCL line */
+        int pin_sscb_scl __attribute__((deprecated("please use pin_sccb_scl instead")));           /*!< GPIO pin for camera SCL line (legacy name) */
+    };
+    int pin_d7;                     /*!< GPIO pin for camera D7 line */
+    int pin_d6;                     /*!< GPIO pin for camera D6 line */
+    int pin_d5;                     /*!< GPIO pin for camera D5 line */
+    int pin_d4;                     /*!< GPIO pin for camera D4 line */
+    int pin_d3;                     /*!< GPIO pin for camera D3 line */
+    int pin_d2;                     /*!< GPIO pin for camera D2 line */
+    int pin_d1;                     /*!< GPIO pin for camera D1 line */
+    int pin_d0;                     /*!< GPIO pin for camera D0 line */
+    int pin_vsync;                  /*!< GPIO pin for camera VSYNC line */
+    int pin_href;                   /*!< GPIO pin for camera HREF line */
+    int pin_pclk;                   /*!< GPIO pin for camera PCLK line */
+
+    int xclk_freq_hz;               /*!< Frequency of XCLK signal, in Hz. */
+
+    ledc_timer_t ledc_timer;        /*!< LEDC timer to be used for generating XCLK  */
+    ledc_channel_t ledc_channel;    /*!< LEDC channel to be used for generating XCLK  */
+
+    pixformat_t pixel_format;       /*!< Format of the pixel data: PIXFORMAT_ + YUV422|GRAYSCALE|RGB565|JPEG  */
+    framesize_t frame_size;         /*!< Size of the output image: FRAMESIZE_ + QVGA|CIF|VGA|SVGA|XGA|SXGA|UXGA  */
+
+    int jpeg_quality;               /*!< Quality of JPEG output. 0-63 lower means higher quality  */
+    size_t fb_count;                /*!< Number of frame buffers to be allocated. If more than one, then each frame will be acquired (double speed)  */
+    camera_fb_location_t fb_location; /*!< The location where the frame buffer will be allocated */
+    camera_grab_mode_t grab_mode;   /*!< When buffers should be filled */
+#if CONFIG_CAMERA_CONVERTER_ENABLED
+    camera_conv_mode_t conv_mode;   /*!< RGB<->YUV Conversion mode */
+#endif
+
+    int sccb_i2c_port;              /*!< If pin_sccb_sda is -1, use the already configured I2C bus by number */
+} camera_config_t;
+
+/**
+ * @brief Data structure of camera frame buffer
+ */
+typedef struct {
+    uint8_t * buf;              /*!< Pointer to the pixel data */
+    size_t len;                 /*!< Length of the buffer in bytes */
+    size_t width;               /*!< Width of the buffer in pixels */
+    size_t height;              /*!< Height of the buffer in pixels */
+    pixformat_t format;         /*!< Format of the pixel data */
+    struct timeval timestamp;   /*!< Timestamp since boot of the first DMA buffer of the frame */
+    uint32_t sequence;          /*!< Capture sequence number, a gap means the driver lost frames in between */
+    int64_t capture_start_us;   /*!< esp_timer time of the VSYNC interrupt that started the frame */
+    int64_t capture_end_us;     /*!< esp_timer time of the VSYNC interrupt that ended it */
+} camera_fb_t;
+
+/**
+ * @brief Capture counters since the driver was initialized
+ *
+ * Every frame the capture task starts takes the next sequence number and ends
+ * up either delivered or in exactly one of the drop counters, so
+ * frames == delivered + all drops, plus the frame being captured.
+ */
+typedef struct {
+    uint32_t frames;            /*!< Sequence numbers handed out */
+    uint32_t delivered;         /*!< Frames put on the frame queue */
+    uint32_t replaced;          /*!< Delivered frames dropped from the queue for a newer one (CAMERA_GRAB_LATEST) */
+    uint32_t no_fb;             /*!< NO-FB: every frame buffer was held, the frame was not captured */
+    uint32_t fb_overflow;       /*!< FB-OVF, DMA overflow: frame larger than the frame buffer */
+    uint32_t no_soi;            /*!< NO-SOI: JPEG data without start marker */
+    uint32_t jpeg_bad;          /*!< JPEG-BAD: invalid marker in the JPEG stream */
+    uint32_t no_eoi;            /*!< NO-EOI: JPEG end marker missing at VSYNC */
+    uint32_t fb_size;           /*!< FB-SIZE: raw frame of the wrong size */
+    uint32_t queue_full;        /*!< FBQ-SND, FBQ-RCV: frame queue full */
+    uint32_t event_overflow;    /*!< EV-EOF-OVF, EV-VSYNC-OVF: capture events lost, the frame was abandoned */
+} camera_stats_t;
+
+/**
+ * @brief Configuration of the grayscale stream derived from the JPEG frames
+ */
+typedef struct {
+    uint8_t every;              /*!< Sequence numbers between two derived frames, 1 to derive from every frame */
+    uint8_t scale_div;          /*!< 2, 4 or 8: the grayscale frame is the JPEG frame size divided by it */
+    uint8_t fb_count;           /*!< Grayscale frame buffers, a second one lets the next frame be derived while the application holds one */
+    uint8_t task_priority;      /*!< Priority of the task that derives them, keep it below the capture task */
+    int8_t task_core;           /*!< Core of that task, -1 for either */
+} camera_gray_config_t;
+
+/**
+ * @brief Grayscale stream counters since esp_camera_gray_start()
+ *
+ * Every JPEG frame taken for the stream is either derived or in one of the
+ * skip counters.
+ */
+typedef struct {
+    uint32_t taken;             /*!< JPEG frames taken from the capture for deriving */
+    uint32_t derived;           /*!< Grayscale frames put on the grayscale queue */
+    uint32_t replaced;          /*!< Derived frames dropped from the queue for a newer one */
+    uint32_t no_fb;             /*!< Taken frames skipped, the application held every grayscale buffer */
+    uint32_t decode_failed;     /*!< Taken frames that did not decode or did not fit the grayscale buffers */
+    size_t memory;              /*!< Bytes allocated for the stream: frame buffers and their headers, decoder work area and band */
+} camera_gray_stats_t;
+
+#define ESP_ERR_CAMERA_BASE 0x20000
+#define ESP_ERR_CAMERA_NOT_DETECTED             (ESP_ERR_CAMERA_BASE + 1)
+#define ESP_ERR_CAMERA_FAILED_TO_SET_FRAME_SIZE (ESP_ERR_CAMERA_BASE + 2)
+#define ESP_ERR_CAMERA_FAILED_TO_SET_OUT_FORMAT (ESP_ERR_CAMERA_BASE + 3)
+#define ESP_ERR_CAMERA_NOT_SUPPORTED            (ESP_ERR_CAMERA_BASE + 4)
+
+/**
+ * @brief Initialize the camera driver
+ *
+ * This function detects and configures camera over I2C interface,
+ * allocates framebuffer and DMA buffers,
+ * initializes parallel I2S input, and sets up DMA descriptors.
+ *
+ * Currently this function can only be called once and there is
+ * no way to de-initialize this module.
+ *
+ * @param config  Camera configuration parameters
+ *
+ * @return ESP_OK on success
+ */
+esp_err_t esp_camera_init(const camera_config_t* config);
+
+/**
+ * @brief Sensor configuration applied once by esp_camera_init_cached()
+ *
+ * @param s  The detected sensor
+ *
+ * @return ESP_OK if the sensor state may be cached
+ */
+typedef esp_err_t (*camera_setup_cb_t)(sensor_t *s);
+
+/**
+ * @brief Initialize the camera driver from the sensor state cached in NVS
+ *
+ * The first boot runs esp_camera_init() and then setup, recording every
+ * register write from the sensor's soft reset on, and stores the detected
+ * sensor with the recorded writes under the namespace key. Later boots with
+ * the same configuration skip the probe of all sensor models and the driver
+ * register tables: the cached sensor is checked at its address, soft reset
+ * and the recorded writes replayed in one batch. Anything that does not match
+ * falls back to the full probe, which records a new cache. The cache holds the
+ * ELF hash of the firmware that recorded it, so the first boot after a
+ * firmware update, with maybe another setup or other register tables, probes
+ * again.
+ *
+ * Only sensors whose driver keeps a register shadow (OV2640, OV3660) can be
+ * cached, the others always take the full probe.
+ *
+ * @param config  Camera configuration parameters
+ * @param key     NVS namespace of the cache
+ * @param setup   Called after esp_camera_init() on a full probe, may be NULL
+ *
+ * @return ESP_OK on success, the error of esp_camera_init() or setup otherwise
+ */
+esp_err_t esp_camera_init_cached(const camera_config_t* config, const char *key, camera_setup_cb_t setup);
+
+/**
+ * @brief Deinitialize the camera driver
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_STATE if the driver hasn't been initialized yet
+ */
+esp_err_t esp_camera_deinit(void);
+
+/**
+ * @brief Obtain pointer to a frame buffer.
+ *
+ * @return pointer to the frame buffer
+ */
+camera_fb_t* esp_camera_fb_get(void);
+
+/**
+ * @brief Return the frame buffer to be reused again.
+ *
+ * Drops the reference esp_camera_fb_get() handed out. The buffer goes back to
+ * the capture pool once every reference taken with esp_camera_fb_ref() has
+ * been dropped as well.
+ *
+ * @param fb    Pointer to the frame buffer
+ */
+void esp_camera_fb_return(camera_fb_t * fb);
+
+/**
+ * @brief Take another reference to a frame buffer, e.g. to pass it to a second consumer.
+ *
+ * The buffer is not captured into again until every reference is dropped with
+ * esp_camera_fb_unref() or esp_camera_fb_return(). Capture continues into the
+ * other frame buffers meanwhile.
+ *
+ * @param fb    Frame buffer obtained from esp_camera_fb_get() and not yet returned
+ *
+ * @return fb, or NULL if it is not a held frame buffer
+ */
+camera_fb_t* esp_camera_fb_ref(camera_fb_t * fb);
+
+/**
+ * @brief Drop a reference to a frame buffer, same as esp_camera_fb_return().
+ *
+ * @param fb    Pointer to the frame buffer
+ */
+void esp_camera_fb_unref(camera_fb_t * fb);
+
+/**
+ * @brief Read the capture counters
+ *
+ * @param stats  Filled with the counters since esp_camera_init()
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if stats is NULL
+ *      - ESP_ERR_INVALID_STATE if the driver hasn't been initialized yet
+ */
+esp_err_t esp_camera_get_stats(camera_stats_t *stats);
+
+/**
+ * @brief Start a grayscale stream derived from the JPEG frames
+ *
+ * The JPEG frame with the next due sequence number gets another reference
+ * and is decoded in a task of its own, scaled down by config->scale_div, into
+ * a grayscale frame buffer on a queue of its own. The JPEG frame stays on the
+ * frame queue for esp_camera_fb_get() as usual. One JPEG frame is held while
+ * it is decoded, so fb_count needs one more buffer than without the stream.
+ * If the decoding is still busy when a frame is due, the next frame after it
+ * is taken. The buffers are sized for the frame size of the camera
+ * configuration, smaller frame sizes set later work as well.
+ *
+ * @param config  Cadence, scale, buffers and task of the stream
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG if config is NULL or out of range
+ *      - ESP_ERR_INVALID_STATE if the driver hasn't been initialized yet or the stream is running
+ *      - ESP_ERR_NOT_SUPPORTED if the pixel format is not JPEG
+ *      - ESP_ERR_NO_MEM if the buffers or the task could not be allocated
+ */
+esp_err_t esp_camera_gray_start(const camera_gray_config_t *config);
+
+/**
+ * @brief Stop the grayscale stream and free its buffers
+ *
+ * Every grayscale frame buffer must have been returned. esp_camera_deinit()
+ * stops the stream as well.
+ *
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE if the stream is not running
+ */
+esp_err_t esp_camera_gray_stop(void);
+
+/**
+ * @brief Wait for the next grayscale frame
+ *
+ * The frame carries the size, sequence number and capture times of the JPEG
+ * frame it was derived from, with the scaled down width and height.
+ *
+ * @param timeout_ms  Time to wait for a frame
+ *
+ * @return The frame, or NULL on timeout or if the stream is not running
+ */
+camera_fb_t* esp_camera_gray_get(uint32_t timeout_ms);
+
+/**
+ * @brief Return a grayscale frame buffer to be derived into again
+ *
+ * @param fb    Frame buffer obtained from esp_camera_gray_get()
+ */
+void esp_camera_gray_return(camera_fb_t * fb);
+
+/**
+ * @brief Read the grayscale stream counters
+ *
+ * @param stats  Filled with the counters since esp_camera_gray_start()
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if stats is NULL or ESP_ERR_INVALID_STATE if the stream is not running
+ */
+esp_err_t esp_camera_gray_get_stats(camera_gray_stats_t *stats);
+
+/**
+ * @brief Get a pointer to the image sensor control structure
+ *
+ * @return pointer to the sensor
+ */
+sensor_t * esp_camera_sensor_get(void);
+
+/**
+ * @brief Save camera settings to non-volatile-storage (NVS)
+ *
+ * @param key   A unique nvs key name for the camera settings
+ */
+esp_err_t esp_camera_save_to_nvs(const char *key);
+
+/**
+ * @brief Load camera settings from non-volatile-storage (NVS)
+ *
+ * Only the settings that differ from the current ones are set, the same way
+ * as esp_camera_preset_apply().
+ *
+ * @param key   A unique nvs key name for the camera settings
+ */
+esp_err_t esp_camera_load_from_nvs(const char *key);
+
+#define CAMERA_PRESET_NAME_LEN 15   /*!< Longest preset name */
+
+/**
+ * @brief Store sensor settings as a named preset
+ *
+ * All presets of a namespace live in one compact NVS blob, up to 8 of them,
+ * and are kept in RAM after the first access so that switching between them
+ * does not touch flash. A preset with the same name is replaced. Scale and
+ * binning are not part of a preset.
+ *
+ * @param key        NVS namespace of the presets
+ * @param name       Preset name, e.g. "night", up to CAMERA_PRESET_NAME_LEN characters
+ * @param status     Settings to store, &esp_camera_sensor_get()->status for the current ones
+ * @param pixformat  Pixel format to store
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_INVALID_ARG on a missing argument or a bad name
+ *      - ESP_ERR_NO_MEM if the namespace is full
+ *      - NVS errors from writing the presets
+ */
+esp_err_t esp_camera_preset_save(const char *key, const char *name, const camera_status_t *status, pixformat_t pixformat);
+
+/**
+ * @brief Read a preset without applying it
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG or ESP_ERR_NOT_FOUND
+ */
+esp_err_t esp_camera_preset_get(const char *key, const char *name, camera_status_t *status, pixformat_t *pixformat);
+
+/**
+ * @brief Switch the sensor to a preset
+ *
+ * Only the settings that differ from the current ones are set. Frame size
+ * and pixel format changes go first; the other register writes are sent as
+ * one batch on sensors with a register shadow (OV2640, OV3660).
+ *
+ * @return
+ *      - ESP_OK on success
+ *      - ESP_ERR_CAMERA_NOT_DETECTED without a sensor
+ *      - ESP_ERR_NOT_FOUND if there is no such preset
+ *      - ESP_FAIL if a setter failed
+ */
+esp_err_t esp_camera_preset_apply(const char *key, const char *name);
+
+/**
+ * @brief Remove a preset
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_FOUND or NVS errors from writing the presets
+ */
+esp_err_t esp_camera_preset_delete(const char *key, const char *name);
+
+/**
+ * @brief Return all frame buffers to be reused again.
+ */
+void esp_camera_return_all(void);
+
+/**
+ * @brief Check if there are available frames to be immediately acquired
+ */
+bool esp_camera_available_frames(void);
+
+/**
+ * @brief Enable or disable PSRAM DMA mode at runtime.
+ *
+ * @param enable  True to enable PSRAM DMA mode, false to disable it.
+ * @return
+ * - ESP_OK on success
+ * - ESP_ERR_INVALID_STATE if the camera is not initialized
+ * - Propagated error from reinitialization on failure
+ */
+esp_err_t esp_camera_set_psram_mode(bool enable);
+
+/**
+ * @brief Reinitialize the camera with a new configuration.
+ *
+ * @param config  Updated camera configuration structure
+ * @return
+ * - ESP_OK on success
+ * - ESP_ERR_INVALID_ARG if config is NULL
+ * - Propagated error from deinit or init if they fail
+ */
+esp_err_t esp_camera_reconfigure(const camera_config_t *config);
+
+/**
+ * @brief Get current PSRAM DMA mode state.
+ *
+ * @return True if PSRAM DMA is enabled, false otherwise.
+ */
+bool esp_camera_get_psram_mode(void);
+
+/**
+ * @brief Enable or disable JPEG zero copy capture at runtime.
+ *
+ * JPEG DMA writes straight into the frame buffer slots, in PSRAM or internal
+ * RAM, instead of a DMA buffer that is copied into the frame buffer. Each slot
+ * grows by one DMA transfer. Only ESP32-S2 and ESP32-S3 can capture JPEG this
+ * way.
+ *
+ * @param enable  True to capture JPEG without copying, false to copy.
+ * @return
+ * - ESP_OK on success
+ * - ESP_ERR_INVALID_STATE if the camera is not initialized, the mode is left as it was
+ * - ESP_ERR_NOT_SUPPORTED on other targets, the camera is not reconfigured
+ * - Propagated error from reinitialization on failure
+ */
+esp_err_t esp_camera_set_zero_copy_mode(bool enable);
+
+/**
+ * @brief Get current JPEG zero copy capture state.
+ *
+ * @return True if JPEG zero copy is enabled, false otherwise.
+ */
+bool esp_camera_get_zero_copy_mode(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "img_converters.h"
+
@@ -0,0 +1,59 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#pragma once
+
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Grayscale stream derived from the JPEG frames.
+ *
+ * The frame tap of cam_hal hands every config->every'th JPEG frame to a task
+ * that decodes it at 1/2, 1/4 or 1/8 scale with the banded decoder of
+ * esp_jpeg, turning each band into Y8 rows of a grayscale frame buffer. All
+ * memory is allocated when the stream starts: the buffers for the largest
+ * frame of the camera configuration, the decoder work area and one band.
+ */
+
+/**
+ * @brief Start the stream on a running camera
+ *
+ * @param config      Cadence, scale, buffers and task of the stream
+ * @param max_width   Width of the largest JPEG frame
+ * @param max_height  Height of the largest JPEG frame
+ *
+ * @return See esp_camera_gray_start()
+ */
+esp_err_t cam_gray_start(const camera_gray_config_t *config, uint16_t max_width, uint16_t max_height);
+
+/**
+ * @brief Stop the stream, wait for its task and free everything
+ *
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE if the stream is not running
+ */
+esp_err_t cam_gray_stop(void);
+
+camera_fb_t *cam_gray_take(TickType_t timeout);
+
+void cam_gray_give(camera_fb_t *fb);
+
+esp_err_t cam_gray_get_stats(camera_gray_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,110 @@
+// Copyright 2010-2020 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "esp_camera.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Uninitialize the lcd_cam module
+ *
+ * @param handle Provide handle pointer to release resources
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_FAIL Uninitialize fail
+ */
+esp_err_t cam_deinit(void);
+
+/**
+ * @brief Initialize the lcd_cam module
+ *
+ * @param config Configurations - see lcd_cam_config_t struct
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG Parameter error
+ *     - ESP_ERR_NO_MEM No memory to initialize lcd_cam
+ *     - ESP_FAIL Initialize fail
+ */
+esp_err_t cam_init(const camera_config_t *config);
+
+esp_err_t cam_config(const camera_config_t *config, framesize_t frame_size, uint16_t sensor_pid);
+
+void cam_stop(void);
+
+void cam_start(void);
+
+camera_fb_t *cam_take(TickType_t timeout);
+
+bool cam_ref(camera_fb_t *dma_buffer);
+
+void cam_give(camera_fb_t *dma_buffer);
+
+void cam_give_all(void);
+
+/**
+ * @brief Tap delivered JPEG frames for a second consumer
+ *
+ * From now on the first frame delivered at or after the next due sequence
+ * number also gets a reference for cam_tap_take(), and the one after it is
+ * due every frames later. Only one tapped frame is out at a time: while it
+ * is, due frames go to the frame queue alone and the next free one is tapped.
+ *
+ * @param every  Sequence numbers between two tapped frames, 1 for every frame
+ *
+ * @return
+ *     - ESP_OK Success
+ *     - ESP_ERR_INVALID_ARG every is 0
+ *     - ESP_ERR_NOT_SUPPORTED The camera is not in JPEG mode
+ *     - ESP_ERR_NO_MEM No memory for the tap queue
+ */
+esp_err_t cam_tap_start(uint8_t every);
+
+/**
+ * @brief Stop tapping frames and wake cam_tap_take() with NULL
+ */
+void cam_tap_stop(void);
+
+/**
+ * @brief Wait for the next tapped frame
+ *
+ * @return The frame, to be handed back with cam_tap_give(), or NULL on
+ *         timeout and after cam_tap_stop()
+ */
+camera_fb_t *cam_tap_take(TickType_t timeout);
+
+/**
+ * @brief Drop the reference of a tapped frame, the next due frame can be tapped
+ */
+void cam_tap_give(camera_fb_t *dma_buffer);
+
+bool cam_get_available_frames(void);
+
+void cam_get_stats(camera_stats_t *stats);
+
+void cam_set_psram_mode(bool enable);
+bool cam_get_psram_mode(void);
+
+void cam_set_zero_copy_mode(bool enable);
+bool cam_get_zero_copy_mode(void);
+
+#ifdef __cplusplus
+}
+#endif
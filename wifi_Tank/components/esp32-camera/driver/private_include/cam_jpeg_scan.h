@@ -0,0 +1,72 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _CAM_JPEG_SCAN_H_
+#define _CAM_JPEG_SCAN_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Incremental JPEG framing for the capture task.
+ *
+ * The stream is fed in whatever pieces the DMA delivers. The scanner checks
+ * that it starts with SOI, walks the marker segments by their lengths (so
+ * markers inside APPn payloads, e.g. an EXIF thumbnail, are skipped) and
+ * finds the EOI that ends the entropy coded data. All state needed across
+ * chunk boundaries, including a marker split between two chunks, lives in
+ * cam_jpeg_scan_t. Once the end is found the rest of the data is ignored.
+ */
+
+typedef enum {
+    CAM_JPEG_SCAN_MORE = 0, /*!< No EOI yet, feed the next chunk */
+    CAM_JPEG_SCAN_END,      /*!< EOI found, length is valid */
+    CAM_JPEG_SCAN_NO_SOI,   /*!< Stream does not start with FF D8 FF */
+    CAM_JPEG_SCAN_BAD,      /*!< Invalid marker or segment length */
+} cam_jpeg_scan_result_t;
+
+typedef struct {
+    uint8_t state;          /*!< Internal parser state */
+    uint8_t result;         /*!< cam_jpeg_scan_result_t, sticky once not MORE */
+    uint16_t seg_len;       /*!< Segment length being assembled */
+    uint32_t skip;          /*!< Segment payload bytes still to skip */
+    uint32_t pos;           /*!< Bytes consumed so far */
+    uint32_t length;        /*!< Frame length up to and including EOI */
+} cam_jpeg_scan_t;
+
+/**
+ * @brief Start a new frame
+ */
+void cam_jpeg_scan_init(cam_jpeg_scan_t *scan);
+
+/**
+ * @brief Feed the next piece of the stream
+ *
+ * @param scan   Scanner state
+ * @param data   Bytes following the ones fed before
+ * @param len    Number of bytes
+ *
+ * @return CAM_JPEG_SCAN_MORE until the frame ends or is found to be broken,
+ *         then the same final result for every further call
+ */
+cam_jpeg_scan_result_t cam_jpeg_scan(cam_jpeg_scan_t *scan, const uint8_t *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CAM_JPEG_SCAN_H_ */
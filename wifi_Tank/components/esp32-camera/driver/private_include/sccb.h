@@ -0,0 +1,51 @@
+/*
+ * This file is part of the OpenMV project.
+ * Copyright (c) 2013/2014 Ibrahim Abdelkader <i.abdalkader@gmail.com>
+ * This work is licensed under the MIT license, see the file LICENSE for details.
+ *
+ * SCCB (I2C like) driver.
+ *
+ */
+#ifndef __SCCB_H__
+#define __SCCB_H__
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+int SCCB_Init(int pin_sda, int pin_scl);
+int SCCB_Use_Port(int sccb_i2c_port);
+int SCCB_Deinit(void);
+int SCCB_Probe(uint8_t slv_addr);
+uint8_t SCCB_Read(uint8_t slv_addr, uint8_t reg);
+int SCCB_Write(uint8_t slv_addr, uint8_t reg, uint8_t data);
+uint8_t SCCB_Read16(uint8_t slv_addr, uint16_t reg);
+int SCCB_Write16(uint8_t slv_addr, uint16_t reg, uint8_t data);
+uint16_t SCCB_Read_Addr16_Val16(uint8_t slv_addr, uint16_t reg);
+int SCCB_Write_Addr16_Val16(uint8_t slv_addr, uint16_t reg, uint16_t data);
+// Register list of 16 bit addresses and 8 bit values: unchanged values are skipped
+// on the shadow of the sensor, consecutive addresses go out as one transaction
+int SCCB_Write16_Regs(uint8_t slv_addr, const uint16_t (*regs)[2], size_t count);
+// Register list of 8 bit addresses and 8 bit values, one transaction each: unchanged values are skipped
+int SCCB_Write_Regs(uint8_t slv_addr, const uint16_t (*regs)[2], size_t count);
+// Shadow of the values written to and read from a sensor. Reads of known registers
+// are served from it. Invalidate it when the sensor resets its registers.
+int SCCB_Shadow_Enable(uint8_t slv_addr, bool enable);
+void SCCB_Shadow_Invalidate(uint8_t slv_addr);
+// Register that selects the bank of an 8 bit address sensor, shadow addresses become bank << 8 | reg
+int SCCB_Shadow_Bank(uint8_t slv_addr, uint8_t bank_reg);
+// Ranges of {first, last} shadow addresses the sensor changes by itself, always read from the sensor.
+// The table must stay valid while the shadow is enabled.
+int SCCB_Shadow_Volatile(uint8_t slv_addr, const uint16_t (*ranges)[2], size_t count);
+// Value of a shadow address without touching the bus, false if it is not known
+bool SCCB_Shadow_Get(uint8_t slv_addr, uint16_t addr, uint8_t *value);
+// Queue the writes to a shadowed sensor while enabled, reads see the queued values. Disabling sends
+// them as one register list, a read the shadow cannot answer sends them first. -1 without a shadow
+// on enable, or when a queued write failed on disable.
+int SCCB_Shadow_Batch(uint8_t slv_addr, bool enable);
+// Keep the writes that change a register of a shadowed sensor from its last soft reset
+// (SCCB_Shadow_Invalidate) on, to replay a known-good configuration without the drivers
+void SCCB_Shadow_Record(bool enable);
+// The recorded writes as {register, value} in bus order, valid until the next write to the sensor.
+// The first reset entries are the soft reset, addr16 tells SCCB_Write16_Regs from SCCB_Write_Regs.
+// 0 when nothing was recorded or a write failed meanwhile.
+size_t SCCB_Shadow_Recorded(uint8_t slv_addr, const uint16_t (**regs)[2], size_t *reset, bool *addr16);
+#endif // __SCCB_H__
@@ -0,0 +1,111 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef _SCCB_SHADOW_H_
+#define _SCCB_SHADOW_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Register shadows and batched register list writes, shared by both SCCB
+ * drivers (sccb.c and sccb-ng.c).
+ *
+ * A shadow holds the last value written to or read from every register of
+ * one sensor, keyed by the 16 bit register address. 8 bit address sensors
+ * with a bank select register use bank << 8 | reg. Registers the sensor
+ * updates by itself (exposure, gains) are declared volatile and never held.
+ *
+ * The functions here take register addresses as they go over the bus, the
+ * bank is the one last written to the bank select register.
+ *
+ * While recording (SCCB_Shadow_Record()) every shadow also keeps the writes
+ * that changed a register since the sensor's last soft reset, in bus order.
+ * Replayed after the same reset they rebuild the same register state.
+ *
+ * While batching (SCCB_Shadow_Batch()) SCCB_Write() and SCCB_Write16() only
+ * queue the write. Writes of the value a register already has, after the
+ * queued ones, are dropped, bank selects included.
+ */
+
+#define SCCB_BURST_MAX 32   /*!< Most register values sccb_shadow_write16_regs() puts in one transaction */
+
+/**
+ * @brief Writes len register values starting at reg in one transaction,
+ *        relying on the sensor's address auto increment.
+ *
+ * @return 0 on success, -1 on a bus error
+ */
+typedef int (*sccb_write_run_t)(uint8_t slv_addr, uint16_t reg, const uint8_t *data, size_t len);
+
+/**
+ * @brief Last value written to or read from reg, if the sensor has a shadow and the register is known.
+ */
+bool sccb_shadow_get(uint8_t slv_addr, uint16_t reg, uint8_t *value);
+
+/**
+ * @brief Records a written or read value. Does nothing for sensors without a shadow and for volatile registers.
+ */
+void sccb_shadow_set(uint8_t slv_addr, uint16_t reg, uint8_t value);
+
+/**
+ * @brief Records a value written to the sensor, and the write itself while recording.
+ *        addr16 tells whether it went out with a 16 bit register address.
+ */
+void sccb_shadow_written(uint8_t slv_addr, uint16_t reg, uint8_t value, bool addr16);
+
+/**
+ * @brief Queues a write while the sensor is batching. addr16 as for sccb_shadow_written().
+ *
+ * @return false when the write has to go out now
+ */
+bool sccb_shadow_defer(uint8_t slv_addr, uint16_t reg, uint8_t value, bool addr16);
+
+/**
+ * @brief Sends the queued writes before a read goes to the sensor, the batch stays open.
+ */
+void sccb_shadow_sync(uint8_t slv_addr);
+
+/**
+ * @brief Marks count registers from reg unknown, e.g. after a failed write.
+ */
+void sccb_shadow_forget(uint8_t slv_addr, uint16_t reg, size_t count);
+
+/**
+ * @brief Frees all shadows, the sensors are gone with the bus.
+ */
+void sccb_shadow_deinit(void);
+
+/**
+ * @brief Writes a register list with as few transactions as possible.
+ *
+ * Entries are written in list order. Entries whose value equals the shadow
+ * are skipped, and runs of consecutive register addresses are handed to
+ * write_run as one transaction. A short stretch of unchanged registers inside
+ * a run is written again rather than splitting it, that costs less bus time
+ * than a new start condition and register address.
+ *
+ * @return 0 on success, -1 on the first failed transaction
+ */
+int sccb_shadow_write16_regs(uint8_t slv_addr, const uint16_t (*regs)[2], size_t count, sccb_write_run_t write_run);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SCCB_SHADOW_H_ */
@@ -0,0 +1,518 @@
+// Copyright 2015-2025 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <stdlib.h>
+#include <string.h>
+#include "sccb.h"
+#include "sccb_shadow.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#else
+#include "esp_log.h"
+static const char *TAG = "sccb_shadow";
+#endif
+
+#define SHADOW_DEVICES 2    // one sensor per bus in practice
+#define SHADOW_PAGES 256    // high byte of the register address
+#define SCCB_BURST_GAP 2    // unchanged registers written again to keep a run going
+#define SHADOW_RECORD_MAX 1024  // recorded writes per sensor, the largest init table is about 250
+#define SHADOW_BATCH_MAX 128    // queued writes per sensor, a full queue is sent and starts over
+
+// 256 registers, allocated the first time one of them is written
+typedef struct {
+    uint8_t value[256];
+    uint32_t valid[256 / 32];
+} shadow_page_t;
+
+// Writes queued by SCCB_Shadow_Batch()
+typedef struct {
+    uint16_t regs[SHADOW_BATCH_MAX][2];     // as they go over the bus
+    int32_t addr[SHADOW_BATCH_MAX];         // their shadow addresses, -1 for bank selects and unknown banks
+    size_t count;
+    int16_t bank;                           // selected bank after the queued writes
+    bool failed;                            // a part of the batch sent early failed
+} shadow_batch_t;
+
+typedef struct {
+    uint8_t slv_addr;
+    int16_t bank_reg;                       // bank select register, -1 without banks
+    int16_t bank;                           // selected bank, -1 while unknown
+    const uint16_t (*volatile_regs)[2];     // first and last shadow address of each range
+    size_t volatile_count;
+    shadow_page_t *page[SHADOW_PAGES];
+    uint16_t (*record)[2];                  // writes since the last soft reset, while recording
+    size_t record_count;
+    size_t record_reset;                    // leading entries that reset the sensor
+    bool record_broken;                     // a write failed or did not fit
+    bool addr16;
+    bool has_last_write;
+    uint16_t last_write[2];
+    shadow_batch_t *batch;                  // while batching
+} shadow_t;
+
+static shadow_t *shadows[SHADOW_DEVICES];
+static bool recording;
+
+static shadow_t *shadow_find(uint8_t slv_addr)
+{
+    for (int i = 0; i < SHADOW_DEVICES; i++) {
+        if (shadows[i] && shadows[i]->slv_addr == slv_addr) {
+            return shadows[i];
+        }
+    }
+    return NULL;
+}
+
+static void shadow_free(shadow_t *shadow)
+{
+    for (int p = 0; p < SHADOW_PAGES; p++) {
+        free(shadow->page[p]);
+    }
+    free(shadow->record);
+    free(shadow->batch);
+    free(shadow);
+}
+
+static void shadow_invalidate(shadow_t *shadow)
+{
+    for (int p = 0; p < SHADOW_PAGES; p++) {
+        if (shadow->page[p]) {
+            memset(shadow->page[p]->valid, 0, sizeof(shadow->page[p]->valid));
+        }
+    }
+}
+
+static void record_add(shadow_t *shadow, uint16_t reg, uint8_t value)
+{
+    if (!shadow->record) {
+        shadow->record = malloc(SHADOW_RECORD_MAX * sizeof(shadow->record[0]));
+    }
+    if (!shadow->record || shadow->record_count == SHADOW_RECORD_MAX) {
+        shadow->record_broken = true;
+        return;
+    }
+    shadow->record[shadow->record_count][0] = reg;
+    shadow->record[shadow->record_count][1] = value;
+    shadow->record_count++;
+}
+
+static void record_clear(shadow_t *shadow)
+{
+    shadow->record_count = 0;
+    shadow->record_reset = 0;
+    shadow->record_broken = false;
+    shadow->has_last_write = false;
+}
+
+// Shadow address of a register with the given bank selected, -1 while the bank is unknown
+static int shadow_addr_in(const shadow_t *shadow, int bank, uint16_t reg)
+{
+    if (shadow->bank_reg < 0) {
+        return reg;
+    }
+    if (bank < 0) {
+        return -1;
+    }
+    return bank << 8 | (reg & 0xff);
+}
+
+// Shadow address of a register as the bus sees it
+static int shadow_addr(const shadow_t *shadow, uint16_t reg)
+{
+    return shadow_addr_in(shadow, shadow->bank, reg);
+}
+
+static bool shadow_volatile(const shadow_t *shadow, uint16_t addr)
+{
+    for (size_t i = 0; i < shadow->volatile_count; i++) {
+        if (addr >= shadow->volatile_regs[i][0] && addr <= shadow->volatile_regs[i][1]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool page_get(const shadow_t *shadow, uint16_t addr, uint8_t *value)
+{
+    const shadow_page_t *page = shadow->page[addr >> 8];
+    const uint8_t r = addr & 0xff;
+    if (!page || !(page->valid[r / 32] & (1u << (r % 32)))) {
+        return false;
+    }
+    *value = page->value[r];
+    return true;
+}
+
+static void page_set(shadow_t *shadow, uint16_t addr, uint8_t value)
+{
+    shadow_page_t **page = &shadow->page[addr >> 8];
+    if (!*page) {
+        *page = calloc(1, sizeof(shadow_page_t));
+        if (!*page) {
+            return;     // stays unknown, the next batch writes it again
+        }
+    }
+    const uint8_t r = addr & 0xff;
+    (*page)->value[r] = value;
+    (*page)->valid[r / 32] |= 1u << (r % 32);
+}
+
+static void page_forget(shadow_t *shadow, uint16_t addr)
+{
+    shadow_page_t *page = shadow->page[addr >> 8];
+    if (page) {
+        const uint8_t r = addr & 0xff;
+        page->valid[r / 32] &= ~(1u << (r % 32));
+    }
+}
+
+// Sends the queued writes, the batch stays open
+static int batch_flush(shadow_t *shadow)
+{
+    shadow_batch_t *batch = shadow->batch;
+    if (!batch->count) {
+        return 0;
+    }
+    shadow->batch = NULL;   // the writes below go out
+    const int ret = shadow->addr16 ? SCCB_Write16_Regs(shadow->slv_addr, (const uint16_t (*)[2])batch->regs, batch->count)
+                                   : SCCB_Write_Regs(shadow->slv_addr, (const uint16_t (*)[2])batch->regs, batch->count);
+    shadow->batch = batch;
+    batch->count = 0;
+    batch->bank = shadow->bank;
+    if (ret) {
+        batch->failed = true;
+    }
+    return ret;
+}
+
+int SCCB_Shadow_Enable(uint8_t slv_addr, bool enable)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!enable) {
+        for (int i = 0; shadow && i < SHADOW_DEVICES; i++) {
+            if (shadows[i] == shadow) {
+                shadows[i] = NULL;
+                shadow_free(shadow);
+            }
+        }
+        return 0;
+    }
+    if (shadow) {
+        return 0;
+    }
+    for (int i = 0; i < SHADOW_DEVICES; i++) {
+        if (!shadows[i]) {
+            shadows[i] = calloc(1, sizeof(shadow_t));
+            if (!shadows[i]) {
+                ESP_LOGE(TAG, "no memory for the register shadow of 0x%02x", slv_addr);
+                return -1;
+            }
+            shadows[i]->slv_addr = slv_addr;
+            shadows[i]->bank_reg = -1;
+            shadows[i]->bank = -1;
+            return 0;
+        }
+    }
+    ESP_LOGE(TAG, "cannot shadow more than %d devices", SHADOW_DEVICES);
+    return -1;
+}
+
+int SCCB_Shadow_Bank(uint8_t slv_addr, uint8_t bank_reg)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return -1;
+    }
+    shadow_invalidate(shadow);
+    record_clear(shadow);
+    shadow->bank_reg = bank_reg;
+    shadow->bank = -1;
+    return 0;
+}
+
+int SCCB_Shadow_Volatile(uint8_t slv_addr, const uint16_t (*ranges)[2], size_t count)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return -1;
+    }
+    shadow->volatile_regs = ranges;
+    shadow->volatile_count = count;
+    for (size_t i = 0; i < count; i++) {
+        for (uint32_t addr = ranges[i][0]; addr <= ranges[i][1]; addr++) {
+            page_forget(shadow, addr);
+        }
+    }
+    return 0;
+}
+
+void SCCB_Shadow_Invalidate(uint8_t slv_addr)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return;
+    }
+    if (shadow->batch) {
+        batch_flush(shadow);
+    }
+    shadow_invalidate(shadow);
+    if (recording) {
+        // The recording starts over with the bank select and the write that reset the sensor
+        const bool has_last_write = shadow->has_last_write;
+        record_clear(shadow);
+        if (shadow->bank_reg >= 0 && shadow->bank >= 0) {
+            record_add(shadow, shadow->bank_reg, shadow->bank);
+        }
+        if (has_last_write && shadow->last_write[0] != shadow->bank_reg) {
+            record_add(shadow, shadow->last_write[0], shadow->last_write[1]);
+        }
+        shadow->record_reset = shadow->record_count;
+    }
+}
+
+int SCCB_Shadow_Batch(uint8_t slv_addr, bool enable)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return enable ? -1 : 0;
+    }
+    if (enable) {
+        if (!shadow->batch) {
+            shadow->batch = calloc(1, sizeof(shadow_batch_t));
+            if (!shadow->batch) {
+                return -1;
+            }
+            shadow->batch->bank = shadow->bank;
+        }
+        return 0;
+    }
+    if (!shadow->batch) {
+        return 0;
+    }
+    const int ret = batch_flush(shadow) || shadow->batch->failed ? -1 : 0;
+    free(shadow->batch);
+    shadow->batch = NULL;
+    return ret;
+}
+
+void SCCB_Shadow_Record(bool enable)
+{
+    recording = enable;
+    for (int i = 0; i < SHADOW_DEVICES; i++) {
+        if (shadows[i]) {
+            record_clear(shadows[i]);
+            if (!enable) {
+                free(shadows[i]->record);
+                shadows[i]->record = NULL;
+            }
+        }
+    }
+}
+
+size_t SCCB_Shadow_Recorded(uint8_t slv_addr, const uint16_t (**regs)[2], size_t *reset, bool *addr16)
+{
+    const shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow || !shadow->record || shadow->record_broken) {
+        return 0;
+    }
+    *regs = (const uint16_t (*)[2])shadow->record;
+    *reset = shadow->record_reset;
+    *addr16 = shadow->addr16;
+    return shadow->record_count;
+}
+
+bool SCCB_Shadow_Get(uint8_t slv_addr, uint16_t addr, uint8_t *value)
+{
+    const shadow_t *shadow = shadow_find(slv_addr);
+    return shadow && page_get(shadow, addr, value);
+}
+
+bool sccb_shadow_get(uint8_t slv_addr, uint16_t reg, uint8_t *value)
+{
+    const shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return false;
+    }
+    // Queued writes count as done
+    const shadow_batch_t *batch = shadow->batch;
+    const int bank = batch ? batch->bank : shadow->bank;
+    if (reg == shadow->bank_reg) {
+        *value = bank;
+        return bank >= 0;
+    }
+    const int addr = shadow_addr_in(shadow, bank, reg);
+    if (addr < 0 || shadow_volatile(shadow, addr)) {
+        return false;
+    }
+    for (size_t i = batch ? batch->count : 0; i > 0; i--) {
+        if (batch->addr[i - 1] == addr) {
+            *value = batch->regs[i - 1][1];
+            return true;
+        }
+    }
+    return page_get(shadow, addr, value);
+}
+
+void sccb_shadow_set(uint8_t slv_addr, uint16_t reg, uint8_t value)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return;
+    }
+    if (reg == shadow->bank_reg) {
+        shadow->bank = value;
+        return;
+    }
+    const int addr = shadow_addr(shadow, reg);
+    if (addr >= 0 && !shadow_volatile(shadow, addr)) {
+        page_set(shadow, addr, value);
+    }
+}
+
+void sccb_shadow_written(uint8_t slv_addr, uint16_t reg, uint8_t value, bool addr16)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow) {
+        return;
+    }
+    shadow->addr16 = addr16;
+    if (recording) {
+        uint8_t old;
+        shadow->has_last_write = true;
+        shadow->last_write[0] = reg;
+        shadow->last_write[1] = value;
+        if (!sccb_shadow_get(slv_addr, reg, &old) || old != value) {
+            record_add(shadow, reg, value);
+        }
+    }
+    sccb_shadow_set(slv_addr, reg, value);
+}
+
+bool sccb_shadow_defer(uint8_t slv_addr, uint16_t reg, uint8_t value, bool addr16)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (!shadow || !shadow->batch) {
+        return false;
+    }
+    shadow_batch_t *batch = shadow->batch;
+    shadow->addr16 = addr16;
+    uint8_t old;
+    if (sccb_shadow_get(slv_addr, reg, &old) && old == value) {
+        return true;
+    }
+    if (batch->count == SHADOW_BATCH_MAX) {
+        batch_flush(shadow);
+    }
+    batch->regs[batch->count][0] = reg;
+    batch->regs[batch->count][1] = value;
+    batch->addr[batch->count] = reg == shadow->bank_reg ? -1 : shadow_addr_in(shadow, batch->bank, reg);
+    batch->count++;
+    if (reg == shadow->bank_reg) {
+        batch->bank = value;
+    }
+    return true;
+}
+
+void sccb_shadow_sync(uint8_t slv_addr)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (shadow && shadow->batch) {
+        batch_flush(shadow);
+    }
+}
+
+void sccb_shadow_forget(uint8_t slv_addr, uint16_t reg, size_t count)
+{
+    shadow_t *shadow = shadow_find(slv_addr);
+    if (shadow && recording) {
+        shadow->record_broken = true;   // the sensor state is not known-good any more
+    }
+    for (size_t i = 0; shadow && i < count; i++, reg++) {
+        if (reg == shadow->bank_reg) {
+            shadow->bank = -1;
+            continue;
+        }
+        const int addr = shadow_addr(shadow, reg);
+        if (addr >= 0) {
+            page_forget(shadow, addr);
+        }
+    }
+}
+
+void sccb_shadow_deinit(void)
+{
+    for (int i = 0; i < SHADOW_DEVICES; i++) {
+        if (shadows[i]) {
+            shadow_free(shadows[i]);
+            shadows[i] = NULL;
+        }
+    }
+}
+
+static bool shadow_unchanged(uint8_t slv_addr, uint16_t reg, uint8_t value)
+{
+    uint8_t old;
+    return sccb_shadow_get(slv_addr, reg, &old) && old == value;
+}
+
+int sccb_shadow_write16_regs(uint8_t slv_addr, const uint16_t (*regs)[2], size_t count, sccb_write_run_t write_run)
+{
+    const shadow_t *shadow = shadow_find(slv_addr);
+    if (shadow && shadow->batch) {
+        for (size_t i = 0; i < count; i++) {
+            sccb_shadow_defer(slv_addr, regs[i][0], regs[i][1], true);
+        }
+        return 0;
+    }
+    size_t i = 0;
+    while (i < count) {
+        if (shadow_unchanged(slv_addr, regs[i][0], regs[i][1])) {
+            i++;
+            continue;
+        }
+        // Extend the run over consecutive addresses, end it after the last changed value
+        size_t last = i;
+        for (size_t n = i + 1; n < count && n - i < SCCB_BURST_MAX && regs[n][0] == regs[n - 1][0] + 1; n++) {
+            if (!shadow_unchanged(slv_addr, regs[n][0], regs[n][1])) {
+                last = n;
+            } else if (n - last > SCCB_BURST_GAP) {
+                break;
+            }
+        }
+        const size_t len = last - i + 1;
+        uint8_t data[SCCB_BURST_MAX];
+        for (size_t n = 0; n < len; n++) {
+            data[n] = regs[i + n][1];
+        }
+        if (write_run(slv_addr, regs[i][0], data, len)) {
+            sccb_shadow_forget(slv_addr, regs[i][0], len);
+            return -1;
+        }
+        for (size_t n = 0; n < len; n++) {
+            sccb_shadow_written(slv_addr, regs[i + n][0], data[n], true);
+        }
+        i += len;
+    }
+    return 0;
+}
+
+int SCCB_Write_Regs(uint8_t slv_addr, const uint16_t (*regs)[2], size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (!shadow_unchanged(slv_addr, regs[i][0], regs[i][1]) && SCCB_Write(slv_addr, regs[i][0], regs[i][1])) {
+            return -1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2022-2025 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Working buffer the configured decoder needs, what esp_jpeg_decode() allocates when none is given
+ *
+ * The table decoder levels (JD_FASTDECODE 2 and up) keep their Huffman lookup
+ * tables in it; the ROM decoder and the lower levels need a few kB only.
+ */
+#if !CONFIG_JD_USE_ROM && defined(CONFIG_JD_FASTDECODE) && (CONFIG_JD_FASTDECODE >= 2)
+#define ESP_JPEG_WORK_BUF_SIZE  65472
+#else
+#define ESP_JPEG_WORK_BUF_SIZE  3100    /* Recommended buffer size; Independent on the size of the image */
+#endif
+
+/**
+ * @brief Scale of output image
+ *
+ */
+typedef enum {
+    JPEG_IMAGE_SCALE_0 = 0, /*!< No scale */
+    JPEG_IMAGE_SCALE_1_2,   /*!< Scale 1:2 */
+    JPEG_IMAGE_SCALE_1_4,   /*!< Scale 1:4 */
+    JPEG_IMAGE_SCALE_1_8,   /*!< Scale 1:8 */
+} esp_jpeg_image_scale_t;
+
+/**
+ * @brief Format of output image
+ *
+ */
+typedef enum {
+    JPEG_IMAGE_FORMAT_RGB888 = 0,   /*!< Format RGB888 */
+    JPEG_IMAGE_FORMAT_RGB565,       /*!< Format RGB565 */
+} esp_jpeg_image_format_t;
+
+/**
+ * @brief JPEG Configuration Type
+ *
+ */
+typedef struct esp_jpeg_image_cfg_s {
+    uint8_t *indata;        /*!< Input JPEG image */
+    uint32_t indata_size;   /*!< Size of input image  */
+    uint8_t *outbuf;        /*!< Output buffer */
+    uint32_t outbuf_size;   /*!< Output buffer size */
+    esp_jpeg_image_format_t out_format; /*!< Output image format */
+    esp_jpeg_image_scale_t  out_scale; /*!< Output scale */
+
+    struct {
+        uint8_t swap_color_bytes: 1; /*!< Swap first and last color bytes */
+    } flags;
+
+    struct {
+        void *working_buffer;       /*!< If set to NULL, a working buffer will be allocated in esp_jpeg_decode().
+                                         Tjpgd does not use dynamic allocation, se we pass this buffer to Tjpgd that uses it as scratchpad */
+        size_t working_buffer_size; /*!< Size of the working buffer. Must be set it working_buffer != NULL.
+                                         Default size is ESP_JPEG_WORK_BUF_SIZE, 3.1kB or 65kB if JD_FASTDECODE >= 2 */
+    } advanced;
+
+    struct {
+        uint32_t read;  /*!< Internal count of read bytes */
+    } priv;
+} esp_jpeg_image_cfg_t;
+
+/**
+ * @brief JPEG output info
+ */
+typedef struct esp_jpeg_image_output_s {
+    uint16_t width;    /*!< Width of the output image */
+    uint16_t height;   /*!< Height of the output image */
+    size_t output_len; /*!< Length of the output image in bytes */
+} esp_jpeg_image_output_t;
+
+/**
+ * @brief Decode JPEG image
+ *
+ * @note This function is blocking.
+ *
+ * @param[in]  cfg: Configuration structure
+ * @param[out] img: Output image info
+ *
+ * @return
+ *      - ESP_OK            on success
+ *      - ESP_ERR_NO_MEM    if there is no memory for allocating main structure
+ *      - ESP_FAIL          if there is an error in decoding JPEG
+ */
+esp_err_t esp_jpeg_decode(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img);
+
+/**
+ * @brief Get information about the JPEG image
+ *
+ * Use this function to get the size of the JPEG image without decoding it.
+ * Allocate a buffer of size img->output_len to store the decoded image.
+ *
+ * @note cfg->outbuf and cfg->outbuf_size are not used in this function.
+ * @param[in]  cfg: Configuration structure
+ * @param[out] img: Output image info
+ *
+ * @return
+ *      - ESP_OK              on success
+ *      - ESP_ERR_INVALID_ARG if cfg or img is NULL
+ *      - ESP_FAIL            if there is an error in decoding JPEG
+ */
+esp_err_t esp_jpeg_get_image_info(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img);
+
+/**
+ * @brief Band of decoded image rows
+ *
+ * A band is one row of MCUs (8 or 16 image rows, divided by the output scale).
+ */
+typedef struct esp_jpeg_band_s {
+    uint8_t *data;      /*!< First pixel of the band, in the configured output format */
+    size_t stride;      /*!< Bytes between two rows of the band */
+    uint16_t width;     /*!< Width of the band (output image width) */
+    uint16_t y;         /*!< Output image row of the first band row */
+    uint16_t height;    /*!< Number of rows in the band */
+    uint16_t index;     /*!< Band number, counted from 0 at the top of the image */
+} esp_jpeg_band_t;
+
+/**
+ * @brief Band callback
+ *
+ * Called once for every completed band, top to bottom. The band data stays valid until the ring
+ * wraps around to the same slot, i.e. for band_count - 1 further bands.
+ *
+ * @param[in] band: Decoded band
+ * @param[in] arg:  User argument from esp_jpeg_band_cfg_t
+ *
+ * @return true to continue decoding, false to stop
+ */
+typedef bool (*esp_jpeg_band_cb_t)(const esp_jpeg_band_t *band, void *arg);
+
+/**
+ * @brief Banded decoding configuration
+ */
+typedef struct esp_jpeg_band_cfg_s {
+    esp_jpeg_band_cb_t callback;    /*!< Called for every completed band */
+    void *arg;                      /*!< User argument passed to the callback */
+    uint8_t *buffer;                /*!< Ring of band_count band buffers. If set to NULL, it will be allocated
+                                         in esp_jpeg_decode_bands() */
+    size_t buffer_size;             /*!< Size of the ring. Must be at least band_count * esp_jpeg_get_band_size() */
+    uint8_t band_count;             /*!< Number of band buffers in the ring, 0 is the same as 1 */
+} esp_jpeg_band_cfg_t;
+
+/**
+ * @brief Get the size of one band buffer
+ *
+ * Use this function to size the ring passed to esp_jpeg_decode_bands().
+ *
+ * @note cfg->outbuf and cfg->outbuf_size are not used in this function.
+ * @param[in]  cfg:   Configuration structure
+ * @param[out] lines: Optional, number of rows in a full band
+ *
+ * @return Size of one band buffer in bytes, 0 if the image header cannot be parsed
+ */
+size_t esp_jpeg_get_band_size(esp_jpeg_image_cfg_t *cfg, uint16_t *lines);
+
+/**
+ * @brief Decode JPEG image in bands
+ *
+ * Same as esp_jpeg_decode(), but instead of writing the whole image to cfg->outbuf, every row of MCUs
+ * is decoded into a small ring of band buffers and handed to band_cfg->callback. This keeps the
+ * output memory at a few rows of the image, e.g. 7.5 kB for a 160 x 120 RGB888 image with 16 row MCUs.
+ *
+ * @note This function is blocking, the callback runs in the caller's context.
+ * @note cfg->outbuf and cfg->outbuf_size are not used in this function.
+ *
+ * @param[in]  cfg:      Configuration structure
+ * @param[in]  band_cfg: Band configuration
+ * @param[out] img:      Output image info
+ *
+ * @return
+ *      - ESP_OK              on success
+ *      - ESP_ERR_INVALID_ARG if band_cfg has no callback or the band buffer is too small
+ *      - ESP_ERR_NO_MEM      if there is no memory for allocating the working or band buffer
+ *      - ESP_FAIL            if there is an error in decoding JPEG or the callback stopped the decoding
+ */
+esp_err_t esp_jpeg_decode_bands(esp_jpeg_image_cfg_t *cfg, const esp_jpeg_band_cfg_t *band_cfg,
+                                esp_jpeg_image_output_t *img);
+
+/**
+ * @brief Decode the luma DC map of a JPEG image
+ *
+ * Only the Huffman codes of the scan are decoded: the DC element of every 8x8 luma block gives
+ * its mean, the AC elements are skipped without de-quantizing or IDCT. The result is a grayscale
+ * image at 1/8 scale, one byte per block, the same values a 1/8 scaled decode has for Y. Much
+ * cheaper than decoding pixels, for analysis such as motion detection.
+ *
+ * @note This function is blocking. Needs the TJPGD outside the ROM code (JD_USE_ROM=n).
+ * @note cfg->outbuf receives img->width * img->height bytes, ((width + 7) / 8) * ((height + 7) / 8).
+ *       cfg->out_format, cfg->out_scale and cfg->flags are not used.
+ *
+ * @param[in]  cfg: Configuration structure
+ * @param[out] img: Size of the map in blocks and its length in bytes
+ *
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_NO_MEM        if there is no memory for the working buffer or the output buffer is too small
+ *      - ESP_ERR_NOT_SUPPORTED with the ROM decoder
+ *      - ESP_FAIL              if there is an error in decoding JPEG
+ */
+esp_err_t esp_jpeg_decode_dc_map(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,3 @@
+unsigned char logo_rgb888[] = {
+    0xe1, 0x3b, 0x1f, 0xdf, 0x33, 0x16, 0xe1, 0x2f, 0x14, 0xe2, 0x30, 0x16, 0xdf, 0x2e, 0x14, 0xe1, 0x32, 0x16, 0xdf, 0x30, 0x14, 0xe1, 0x30, 0x16, 0xe3, 0x2e, 0x17, 0xdd, 0x33, 0x15, 0xe1, 0x30, 0x16, 0xe1, 0x2f, 0x12, 0xdf, 0x30, 0x14, 0xdc, 0x32, 0x14, 0xdf, 0x30, 0x15, 0xe2, 0x30, 0x15, 0xe0, 0x2f, 0x15, 0xe1, 0x31, 0x15, 0xe0, 0x2f, 0x15, 0xe2, 0x32, 0x16, 0xde, 0x32, 0x13, 0xdf, 0x30, 0x14, 0xe0, 0x31, 0x18, 0xe1, 0x31, 0x15, 0xe2, 0x30, 0x13, 0xdd, 0x30, 0x17, 0xdf, 0x30, 0x17, 0xe2, 0x30, 0x13, 0xe2, 0x30, 0x15, 0xdf, 0x30, 0x14, 0xe1, 0x33, 0x14, 0xe0, 0x30, 0x14, 0xdd, 0x31, 0x15, 0xdf, 0x30, 0x15, 0xe0, 0x30, 0x14, 0xe2, 0x30, 0x15, 0xdf, 0x30, 0x15, 0xdd, 0x31, 0x12, 0xdf, 0x2f, 0x13, 0xe1, 0x30, 0x18, 0xe2, 0x30, 0x16, 0xe1, 0x2f, 0x14, 0xe0, 0x31, 0x16, 0xe1, 0x30, 0x16, 0xe0, 0x30, 0x12, 0xe3, 0x3e, 0x26, 0xe3, 0x24, 0x0d, 0xdf, 0x29, 0x0d, 0xdd, 0x29, 0x0a, 0xdf, 0x26, 0x0b, 0xdf, 0x29, 0x0d, 0xdd, 0x27, 0x0b, 0xdd, 0x24, 0x07, 0xdd, 0x29, 0x0c, 0xdc, 0x28, 0x09, 0xdf, 0x27, 0x07, 0xdc, 0x26, 0x08, 0xdf, 0x29, 0x0b, 0xde, 0x28, 0x0c, 0xdf, 0x24, 0x0d, 0xdf, 0x29, 0x0b, 0xde, 0x25, 0x08, 0xdd, 0x28, 0x07, 0xde, 0x28, 0x0c, 0xdc, 0x27, 0x0d, 0xdb, 0x25, 0x0b, 0xe0, 0x27, 0x0e, 0xe0, 0x27, 0x0a, 0xe1, 0x25, 0x09, 0xdd, 0x27, 0x0b, 0xdf, 0x26, 0x0d, 0xe0, 0x28, 0x08, 0xdd, 0x29, 0x0a, 0xde, 0x28, 0x0e, 0xdf, 0x26, 0x0b, 0xde, 0x28, 0x0a, 0xdf, 0x26, 0x0b, 0xde, 0x28, 0x0c, 0xe0, 0x28, 0x08, 0xe0, 0x25, 0x0b, 0xe0, 0x28, 0x08, 0xdd, 0x28, 0x0e, 0xdf, 0x26, 0x0d, 0xe0, 0x27, 0x0e, 0xda, 0x28, 0x0b, 0xdf, 0x26, 0x09, 0xdd, 0x29, 0x08, 0xdc, 0x28, 0x07, 0xdc, 0x28, 0x09, 0xe0, 0x27, 0x0a, 0xdf, 0x24, 0x03, 0xe0, 0x2e, 0x13, 0xe1, 0x31, 0x15, 0xde, 0x28, 0x0a, 0xdf, 0x27, 0x07, 0xdd, 0x27, 0x09, 0xdc, 0x28, 0x09, 0xdf, 0x26, 0x09, 0xe3, 0x27, 0x09, 0xdf, 0x26, 0x09, 0xdf, 0x26, 0x09, 0xdd, 0x27, 0x0d, 0xe0, 0x27, 0x0e, 0xde, 0x25, 0x0a, 0xde, 0x28, 0x0c, 0xdf, 0x28, 0x04, 0xe0, 0x25, 0x0b, 0xe1, 0x28, 0x0d, 0xdd, 0x27, 0x09, 0xe0, 0x26, 0x09, 0xe3, 0x27, 0x0d, 0xe0, 0x27, 0x0c, 0xe0, 0x27, 0x0e, 0xe0, 0x27, 0x0c, 0xdd, 0x28, 0x07, 0xdd, 0x28, 0x0f, 0xdd, 0x27, 0x09, 0xe0, 0x28, 0x08, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x0b, 0xe0, 0x27, 0x0c, 0xe0, 0x27, 0x0e, 0xdc, 0x28, 0x09, 0xe0, 0x26, 0x09, 0xe0, 0x26, 0x0f, 0xdd, 0x28, 0x07, 0xde, 0x28, 0x0e, 0xdc, 0x26, 0x0c, 0xe0, 0x28, 0x08, 0xe0, 0x27, 0x0a, 0xdf, 0x26, 0x09, 0xdd, 0x29, 0x0c, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x09, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x0b, 0xde, 0x26, 0x06, 0xe0, 0x35, 0x1b, 0xdc, 0x31, 0x15, 0xe0, 0x25, 0x0b, 0xe2, 0x26, 0x0a, 0xdd, 0x29, 0x0c, 0xde, 0x28, 0x0c, 0xe1, 0x27, 0x0a, 0xdf, 0x26, 0x09, 0xdd, 0x27, 0x0b, 0xe0, 0x27, 0x0c, 0xdd, 0x27, 0x0b, 0xe1, 0x27, 0x08, 0xe0, 0x25, 0x0d, 0xdd, 0x29, 0x0a, 0xe0, 0x27, 0x0c, 0xdc, 0x26, 0x08, 0xdd, 0x27, 0x09, 0xdf, 0x26, 0x0d, 0xdd, 0x27, 0x09, 0xda, 0x29, 0x09, 0xdc, 0x28, 0x07, 0xdf, 0x2a, 0x09, 0xdc, 0x27, 0x0d, 0xdc, 0x09, 0x00, 0xd8, 0x05, 0x00, 0xd9, 0x06, 0x00, 0xd9, 0x09, 0x00, 0xdb, 0x14, 0x00, 0xde, 0x20, 0x00, 0xdd, 0x29, 0x08, 0xdb, 0x25, 0x09, 0xdd, 0x27, 0x09, 0xe0, 0x28, 0x08, 0xde, 0x26, 0x06, 0xe1, 0x26, 0x0c, 0xde, 0x28, 0x0a, 0xdd, 0x29, 0x0a, 0xdf, 0x27, 0x07, 0xdf, 0x26, 0x0b, 0xde, 0x28, 0x0a, 0xdd, 0x28, 0x07, 0xe1, 0x26, 0x0c, 0xe1, 0x26, 0x0c, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x0b, 0xdf, 0x25, 0x06, 0xe2, 0x35, 0x1c, 0xdf, 0x30, 0x15, 0xe1, 0x26, 0x0c, 0xe1, 0x27, 0x0a, 0xdc, 0x26, 0x0a, 0xde, 0x25, 0x0a, 0xde, 0x28, 0x0a, 0xdc, 0x28, 0x09, 0xe2, 0x27, 0x0d, 0xe0, 0x25, 0x0e, 0xdd, 0x27, 0x0b, 0xe0, 0x28, 0x06, 0xdb, 0x27, 0x0a, 0xe1, 0x28, 0x0d, 0xda, 0x29, 0x09, 0xdf, 0x26, 0x0b, 0xdf, 0x29, 0x0d, 0xdf, 0x27, 0x07, 0xde, 0x2a, 0x0d, 0xe0, 0x28, 0x06, 0xe1, 0x26, 0x0c, 0xdf, 0x25, 0x06, 0xdf, 0x20, 0x09, 0xe6, 0x59, 0x3f, 0xe6, 0x6a, 0x57, 0xe8, 0x64, 0x4f, 0xe5, 0x53, 0x3e, 0xe2, 0x39, 0x24, 0xdd, 0x19, 0x00, 0xd8, 0x02, 0x00, 0xde, 0x03, 0x03, 0xdd, 0x1d, 0x00, 0xdb, 0x29, 0x0f, 0xde, 0x28, 0x0e, 0xdc, 0x27, 0x06, 0xdc, 0x26, 0x0a, 0xe2, 0x28, 0x09, 0xe0, 0x25, 0x0b, 0xdf, 0x26, 0x0d, 0xe3, 0x28, 0x10, 0xdf, 0x26, 0x09, 0xdd, 0x27, 0x09, 0xdc, 0x26, 0x08, 0xdb, 0x27, 0x0a, 0xde, 0x28, 0x0a, 0xde, 0x26, 0x04, 0xe0, 0x35, 0x19, 0xde, 0x32, 0x15, 0xdc, 0x26, 0x0a, 0xe0, 0x26, 0x09, 0xe1, 0x28, 0x0b, 0xde, 0x28, 0x0a, 0xdd, 0x27, 0x09, 0xdc, 0x28, 0x09, 0xdf, 0x29, 0x0d, 0xe0, 0x28, 0x08, 0xda, 0x29, 0x07, 0xdf, 0x27, 0x07, 0xdd, 0x29, 0x0c, 0xdd, 0x25, 0x05, 0xe2, 0x29, 0x0c, 0xdb, 0x1f, 0x03, 0xda, 0x09, 0x00, 0xda, 0x0d, 0x01, 0xd9, 0x18, 0x00, 0xe1, 0x21, 0x0c, 0xdc, 0x28, 0x07, 0xdc, 0x10, 0x01, 0xe0, 0x3b, 0x21, 0xfd, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfb, 0xfb, 0xfa, 0xfa, 0xf9, 0xd2, 0xce, 0xed, 0xa2, 0x99, 0xe5, 0x5f, 0x4f, 0xda, 0x1c, 0x00, 0xda, 0x00, 0x00, 0xde, 0x1c, 0x00, 0xdd, 0x2d, 0x0f, 0xde, 0x28, 0x0c, 0xe0, 0x27, 0x0a, 0xdd, 0x27, 0x0b, 0xde, 0x28, 0x0c, 0xd9, 0x27, 0x0c, 0xe0, 0x27, 0x0a, 0xe0, 0x27, 0x0c, 0xe0, 0x27, 0x0a, 0xdd, 0x27, 0x0b, 0xe0, 0x27, 0x0c, 0xdd, 0x25, 0x05, 0xe0, 0x35, 0x1b, 0xe1, 0x2f, 0x14, 0xe2, 0x28, 0x0b, 0xe0, 0x26, 0x07, 0xdc, 0x26, 0x08, 0xe2, 0x28, 0x0b, 0xe0, 0x26, 0x09, 0xde, 0x28, 0x0a, 0xde, 0x2a, 0x0d, 0xda, 0x12, 0x02, 0xdd, 0x16, 0x00, 0xdf, 0x2b, 0x0e, 0xe0, 0x25, 0x0e, 0xdd, 0x2a, 0x06, 0xdb, 0x08, 0x00, 0xdb, 0x17, 0x02, 0xe6, 0x56, 0x43, 0xe3, 0x4b, 0x30, 0xe3, 0x28, 0x0e, 0xd9, 0x09, 0x00, 0xd8, 0x02, 0x00, 0xd6, 0x05, 0x00, 0xdb, 0x26, 0x0d, 0xe6, 0x64, 0x53, 0xf2, 0xae, 0xa7, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf6, 0xd9, 0xd9, 0xea, 0x77, 0x6a, 0xdd, 0x17, 0x00, 0xd7, 0x00, 0x04, 0xe0, 0x26, 0x05, 0xda, 0x2a, 0x0a, 0xe0, 0x27, 0x0a, 0xde, 0x28, 0x0e, 0xe1, 0x27, 0x0a, 0xde, 0x29, 0x08, 0xdb, 0x25, 0x07, 0xde, 0x28, 0x0a, 0xdd, 0x27, 0x09, 0xdd, 0x27, 0x09, 0xdd, 0x25, 0x03, 0xe3, 0x37, 0x1b, 0xdd, 0x31, 0x15, 0xdd, 0x27, 0x0b, 0xde, 0x28, 0x0a, 0xdd, 0x29, 0x0c, 0xdf, 0x26, 0x0b, 0xdd, 0x29, 0x0c, 0xe2, 0x29, 0x0e, 0xda, 0x0e, 0x00, 0xe0, 0x3e, 0x23, 0xe1, 0x3b, 0x1f, 0xdd, 0x1c, 0x06, 0xdf, 0x27, 0x07, 0xd9, 0x01, 0x00, 0xe0, 0x34, 0x20, 0xf3, 0xbf, 0xb9, 0xff, 0xff, 0xfc, 0xfe, 0xff, 0xfe, 0xf6, 0xe3, 0xe1, 0xf4, 0xbe, 0xb5, 0xec, 0x87, 0x7c, 0xe4, 0x4c, 0x39, 0xdc, 0x10, 0x00, 0xd3, 0x02, 0x02, 0xd8, 0x01, 0x00, 0xdf, 0x3b, 0x29, 0xee, 0xa0, 0x98, 0xfd, 0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xfd, 0xfc, 0xfe, 0xfc, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xf8, 0xd8, 0xd5, 0xe1, 0x55, 0x43, 0xd9, 0x00, 0x00, 0xe0, 0x1b, 0x02, 0xde, 0x2a, 0x0b, 0xe0, 0x27, 0x0a, 0xdd, 0x27, 0x09, 0xdf, 0x26, 0x0d, 0xe0, 0x27, 0x0c, 0xe1, 0x27, 0x0a, 0xdf, 0x26, 0x0b, 0xe0, 0x27, 0x0c, 0xde, 0x24, 0x05, 0xe0, 0x35, 0x1b, 0xe0, 0x31, 0x18, 0xe0, 0x27, 0x0c, 0xe0, 0x24, 0x08, 0xe1, 0x26, 0x0e, 0xe0, 0x27, 0x0c, 0xde, 0x28, 0x0e, 0xd9, 0x0d, 0x00, 0xde, 0x1e, 0x09, 0xfd, 0xf7, 0xfa, 0xfb, 0xeb, 0xe7, 0xd9, 0x13, 0x00, 0xda, 0x0d, 0x03, 0xe8, 0x67, 0x59, 0xfe, 0xf9, 0xf7, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xff, 0xf7, 0xcf, 0xc7, 0xec, 0x7f, 0x7a, 0xdd, 0x2e, 0x13, 0xd4, 0x00, 0x00, 0xd3, 0x01, 0x00, 0xe1, 0x3d, 0x2b, 0xf6, 0xb8, 0xb3, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xfd, 0xfd, 0xfc, 0xfe, 0xfc, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xfc, 0xec, 0x8e, 0x84, 0xda, 0x04, 0x00, 0xdc, 0x15, 0x01, 0xde, 0x2a, 0x0b, 0xdd, 0x27, 0x09, 0xdd, 0x29, 0x0a, 0xe1, 0x26, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x28, 0x0c, 0xdc, 0x28, 0x0b, 0xe0, 0x26, 0x05, 0xe1, 0x35, 0x19, 0xdd, 0x31, 0x14, 0xdf, 0x27, 0x07, 0xdd, 0x27, 0x09, 0xdf, 0x29, 0x0b, 0xda, 0x2a, 0x0e, 0xdb, 0x1a, 0x04, 0xdc, 0x04, 0x00, 0xf4, 0xd2, 0xcc, 0xfb, 0xfe, 0xfc, 0xe9, 0x83, 0x71, 0xdc, 0x0a, 0x05, 0xdf, 0x36, 0x21, 0xfe, 0xfd, 0xf8, 0xfe, 0xff, 0xfe, 0xfb, 0xfd, 0xfb, 0xfd, 0xfc, 0xfb, 0xfc, 0xfe, 0xfc, 0xfb, 0xfd, 0xfb, 0xfe, 0xfd, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xff, 0xfe, 0xfd, 0xff, 0xf9, 0xfd, 0xff, 0xfd, 0xfd, 0xf0, 0xf3, 0xef, 0x94, 0x8b, 0xdc, 0x2c, 0x16, 0xd3, 0x01, 0x00, 0xd6, 0x00, 0x00, 0xe8, 0x6d, 0x61, 0xf8, 0xf8, 0xef, 0xfe, 0xff, 0xff, 0xfb, 0xfe, 0xfd, 0xfa, 0xfa, 0xf9, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xf0, 0xb0, 0xa6, 0xdc, 0x04, 0x00, 0xdd, 0x14, 0x00, 0xe0, 0x2a, 0x10, 0xe0, 0x25, 0x0b, 0xdc, 0x28, 0x07, 0xdf, 0x27, 0x07, 0xe1, 0x26, 0x0c, 0xde, 0x28, 0x0c, 0xdc, 0x24, 0x04, 0xdf, 0x37, 0x1c, 0xdf, 0x33, 0x16, 0xdc, 0x26, 0x0a, 0xdf, 0x2a, 0x07, 0xdd, 0x27, 0x0b, 0xe0, 0x27, 0x04, 0xd5, 0x02, 0x00, 0xf2, 0x9a, 0x8a, 0xff, 0xfe, 0xfd, 0xeb, 0x97, 0x86, 0xd9, 0x01, 0x00, 0xda, 0x0b, 0x00, 0xe2, 0x41, 0x28, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xf9, 0xff, 0xfd, 0xfa, 0xff, 0xfd, 0xfb, 0xfc, 0xfc, 0xfb, 0xfe, 0xfc, 0xfd, 0xfc, 0xfb, 0xfb, 0xfc, 0xfc, 0xfb, 0xfd, 0xfb, 0xfb, 0xfc, 0xfd, 0xfb, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xfd, 0xf9, 0xf2, 0xf1, 0xeb, 0x7c, 0x74, 0xda, 0x04, 0x00, 0xd4, 0x02, 0x00, 0xe3, 0x31, 0x1e, 0xf6, 0xd0, 0xc7, 0xfd, 0xfe, 0xff, 0xfa, 0xff, 0xff, 0xfd, 0xfc, 0xfb, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xf1, 0xb6, 0xac, 0xd9, 0x00, 0x02, 0xdc, 0x1d, 0x04, 0xdd, 0x27, 0x0b, 0xe0, 0x27, 0x0a, 0xdf, 0x2b, 0x0c, 0xdb, 0x25, 0x09, 0xe0, 0x27, 0x0c, 0xe1, 0x25, 0x07, 0xdd, 0x35, 0x1a, 0xe0, 0x2f, 0x17, 0xe0, 0x26, 0x0f, 0xe0, 0x25, 0x0b, 0xdd, 0x29, 0x08, 0xd9, 0x06, 0x00, 0xe2, 0x44, 0x28, 0xff, 0xff, 0xff, 0xf5, 0xd9, 0xd1, 0xdd, 0x00, 0x01, 0xdb, 0x1a, 0x02, 0xda, 0x14, 0x01, 0xe3, 0x3d, 0x21, 0xfb, 0xfc, 0xfc, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xfe, 0xf9, 0xfc, 0xfc, 0xfb, 0xfd, 0xfe, 0xfe, 0xfd, 0xfc, 0xf9, 0xfa, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xfd, 0xf8, 0xc4, 0xc0, 0xdd, 0x34, 0x1f, 0xd2, 0x01, 0x01, 0xda, 0x0b, 0x00, 0xf6, 0xb1, 0xa6, 0xfe, 0xfe, 0xff, 0xfd, 0xff, 0xfe, 0xfa, 0xfc, 0xfa, 0xfa, 0xfe, 0xf9, 0xfd, 0xfd, 0xfe, 0xef, 0x97, 0x83, 0xd7, 0x00, 0x00, 0xdb, 0x27, 0x06, 0xde, 0x25, 0x0a, 0xdd, 0x29, 0x0a, 0xdd, 0x27, 0x0b, 0xdf, 0x26, 0x0b, 0xe0, 0x24, 0x06, 0xe0, 0x35, 0x1b, 0xe1, 0x2f, 0x14, 0xdd, 0x28, 0x07, 0xdd, 0x27, 0x09, 0xdc, 0x24, 0x04, 0xdb, 0x04, 0x03, 0xfb, 0xd7, 0xd3, 0xfc, 0xfe, 0xfa, 0xe1, 0x3b, 0x1d, 0xd7, 0x05, 0x00, 0xdf, 0x29, 0x0b, 0xdf, 0x23, 0x05, 0xdc, 0x26, 0x0a, 0xe3, 0x46, 0x2d, 0xe3, 0x4f, 0x3b, 0xe6, 0x60, 0x50, 0xea, 0x79, 0x6d, 0xed, 0x9e, 0x93, 0xf4, 0xcb, 0xc9, 0xfa, 0xfa, 0xfa, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfd, 0xfc, 0xfb, 0xfd, 0xfd, 0xfc, 0xfc, 0xfe, 0xff, 0xfb, 0xfc, 0xfc, 0xfd, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfb, 0xfa, 0xf7, 0xe9, 0x61, 0x4f, 0xd2, 0x01, 0x00, 0xda, 0x00, 0x01, 0xee, 0x9d, 0x91, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xfb, 0xfb, 0xfb, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xe7, 0x52, 0x3d, 0xd7, 0x00, 0x01, 0xe2, 0x29, 0x0c, 0xde, 0x26, 0x06, 0xe2, 0x28, 0x0b, 0xe0, 0x27, 0x0a, 0xdc, 0x24, 0x04, 0xe0, 0x37, 0x1f, 0xe1, 0x31, 0x15, 0xdb, 0x26, 0x0c, 0xe3, 0x29, 0x0a, 0xdb, 0x05, 0x00, 0xe6, 0x55, 0x3c, 0xfd, 0xfd, 0xfe, 0xf3, 0xac, 0xa1, 0xd7, 0x03, 0x01, 0xe0, 0x2d, 0x08, 0xe0, 0x16, 0x03, 0xd8, 0x06, 0x00, 0xd9, 0x07, 0x00, 0xd9, 0x01, 0x00, 0xdb, 0x00, 0x00, 0xd5, 0x00, 0x01, 0xd4, 0x01, 0x01, 0xd7, 0x00, 0x01, 0xd7, 0x03, 0x01, 0xe0, 0x37, 0x1f, 0xe9, 0x78, 0x6a, 0xf7, 0xc9, 0xc5, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfe, 0xfa, 0xfc, 0xfa, 0xfd, 0xfd, 0xfa, 0xff, 0xfc, 0xfd, 0xfa, 0xfd, 0xfc, 0xfb, 0xff, 0xfe, 0xfc, 0xfe, 0xfc, 0xea, 0x80, 0x6e, 0xd6, 0x02, 0x00, 0xd8, 0x01, 0x00, 0xf3, 0xa1, 0x8f, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfa, 0xfb, 0xfb, 0xfe, 0xff, 0xff, 0xf6, 0xe6, 0xe2, 0xdc, 0x12, 0x00, 0xde, 0x1a, 0x05, 0xdf, 0x29, 0x0b, 0xdd, 0x27, 0x09, 0xe1, 0x27, 0x0a, 0xde, 0x24, 0x05, 0xdf, 0x37, 0x1c, 0xe0, 0x30, 0x12, 0xde, 0x28, 0x0c, 0xdf, 0x25, 0x08, 0xd9, 0x02, 0x00, 0xf3, 0xcc, 0xbf, 0xfe, 0xfe, 0xfb, 0xe3, 0x36, 0x1d, 0xd6, 0x0b, 0x00, 0xda, 0x04, 0x00, 0xdd, 0x23, 0x0c, 0xe7, 0x75, 0x62, 0xf2, 0xae, 0xa5, 0xf0, 0xc7, 0xbf, 0xf3, 0xbd, 0xb5, 0xf1, 0xa0, 0x96, 0xeb, 0x86, 0x7b, 0xe7, 0x5d, 0x4c, 0xde, 0x2a, 0x0b, 0xd8, 0x02, 0x00, 0xd3, 0x02, 0x00, 0xdc, 0x01, 0x01, 0xe5, 0x52, 0x42, 0xf3, 0xbf, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb, 0xfc, 0xfc, 0xf8, 0xfe, 0xf9, 0xff, 0xfe, 0xfd, 0xf9, 0xfc, 0xfc, 0xff, 0xfe, 0xfd, 0xff, 0xff, 0xfc, 0xea, 0x88, 0x77, 0xd7, 0x00, 0x00, 0xd9, 0x00, 0x00, 0xf3, 0xb4, 0xa6, 0xff, 0xfd, 0xfa, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xfa, 0xeb, 0x7b, 0x65, 0xd4, 0x03, 0x00, 0xdd, 0x27, 0x0d, 0xd9, 0x29, 0x0b, 0xe1, 0x27, 0x0a, 0xe1, 0x23, 0x05, 0xe0, 0x35, 0x1b, 0xe1, 0x31, 0x15, 0xdc, 0x28, 0x0b, 0xdd, 0x13, 0x01, 0xe5, 0x36, 0x1a, 0xfe, 0xfe, 0xff, 0xf3, 0xcb, 0xc3, 0xd8, 0x01, 0x00, 0xda, 0x02, 0x00, 0xe7, 0x5c, 0x4e, 0xfa, 0xe4, 0xe2, 0xfe, 0xfe, 0xfb, 0xfe, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xfd, 0xfa, 0xef, 0xef, 0xf2, 0xb6, 0xb0, 0xe9, 0x68, 0x5e, 0xde, 0x14, 0x01, 0xd3, 0x02, 0x00, 0xd8, 0x02, 0x00, 0xe5, 0x62, 0x57, 0xf8, 0xec, 0xe7, 0xfd, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xfd, 0xfc, 0xfc, 0xfd, 0xfc, 0xfb, 0xfd, 0xfe, 0xfe, 0xfd, 0xfd, 0xfc, 0xfe, 0xff, 0xff, 0xe9, 0x81, 0x6f, 0xd2, 0x01, 0x00, 0xdb, 0x0b, 0x02, 0xf7, 0xd8, 0xcd, 0xfd, 0xfe, 0xfe, 0xfb, 0xfe, 0xfc, 0xfe, 0xfd, 0xfd, 0xf7, 0xe3, 0xde, 0xe0, 0x11, 0x03, 0xdc, 0x20, 0x06, 0xdd, 0x27, 0x09, 0xde, 0x28, 0x0a, 0xdd, 0x25, 0x05, 0xe2, 0x35, 0x1e, 0xe1, 0x30, 0x16, 0xda, 0x2b, 0x08, 0xd8, 0x00, 0x00, 0xeb, 0x79, 0x68, 0xff, 0xfe, 0xff, 0xe7, 0x6e, 0x55, 0xd5, 0x01, 0x00, 0xe6, 0x65, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfc, 0xfd, 0xfe, 0xfe, 0xfb, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfb, 0xfe, 0xfc, 0xfb, 0xfc, 0xfc, 0xfd, 0xff, 0xfd, 0xfa, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfe, 0xf5, 0xd9, 0xd2, 0xea, 0x73, 0x67, 0xd7, 0x0a, 0x00, 0xd5, 0x00, 0x01, 0xde, 0x21, 0x0d, 0xf3, 0xb9, 0xb1, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0xf9, 0xfe, 0xfe, 0xfe, 0xe6, 0x5f, 0x46, 0xd2, 0x01, 0x00, 0xdf, 0x32, 0x19, 0xfb, 0xfa, 0xf9, 0xfd, 0xff, 0xff, 0xfc, 0xff, 0xfd, 0xfd, 0xff, 0xfd, 0xe5, 0x58, 0x40, 0xdc, 0x06, 0x00, 0xdf, 0x26, 0x09, 0xdf, 0x26, 0x0b, 0xe0, 0x24, 0x08, 0xe1, 0x36, 0x1c, 0xe1, 0x31, 0x15, 0xe0, 0x24, 0x0a, 0xda, 0x08, 0x01, 0xf0, 0xbf, 0xb4, 0xff, 0xfe, 0xfe, 0xde, 0x1a, 0x05, 0xde, 0x26, 0x15, 0xfe, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xfc, 0xfc, 0xfb, 0xfc, 0xfd, 0xfd, 0xfa, 0xfc, 0xfa, 0xfe, 0xfe, 0xfd, 0xfc, 0xfe, 0xfc, 0xfc, 0xf9, 0xf9, 0xfc, 0xfd, 0xfd, 0xff, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfa, 0xfd, 0xfd, 0xfc, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xca, 0xca, 0xe1, 0x45, 0x32, 0xd3, 0x02, 0x00, 0xd7, 0x01, 0x00, 0xee, 0x95, 0x89, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xfb, 0xf9, 0xfc, 0xfb, 0xfc, 0xff, 0xfd, 0xfb, 0xfc, 0xfd, 0xfe, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xe2, 0x2f, 0x1c, 0xd3, 0x01, 0x00, 0xea, 0x75, 0x5f, 0xfe, 0xff, 0xfe, 0xfb, 0xfc, 0xfc, 0xff, 0xff, 0xfc, 0xed, 0xa0, 0x92, 0xd8, 0x02, 0x00, 0xde, 0x28, 0x0e, 0xe0, 0x27, 0x0c, 0xde, 0x24, 0x05, 0xdf, 0x37, 0x1a, 0xdf, 0x30, 0x15, 0xe2, 0x1c, 0x00, 0xdb, 0x1b, 0x00, 0xf9, 0xf6, 0xf7, 0xf7, 0xe8, 0xe7, 0xd8, 0x01, 0x00, 0xec, 0x9a, 0x84, 0xff, 0xff, 0xfe, 0xf9, 0xff, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xfe, 0xfc, 0xfb, 0xff, 0xf8, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xff, 0xfb, 0xfc, 0xfd, 0xfc, 0xfe, 0xfa, 0xfd, 0xfd, 0xfe, 0xfb, 0xfd, 0xfb, 0xfa, 0xfd, 0xfb, 0xfd, 0xfd, 0xfa, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xeb, 0x75, 0x65, 0xd8, 0x00, 0x03, 0xd4, 0x00, 0x00, 0xec, 0x90, 0x7d, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xfa, 0xfd, 0xfc, 0xfc, 0xfe, 0xfc, 0xfb, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xf7, 0xd0, 0xc5, 0xd6, 0x06, 0x00, 0xd6, 0x00, 0x00, 0xf5, 0xc7, 0xbf, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xf6, 0xd0, 0xc9, 0xdc, 0x12, 0x00, 0xdd, 0x1f, 0x01, 0xdd, 0x29, 0x08, 0xe0, 0x26, 0x05, 0xe1, 0x35, 0x19, 0xe0, 0x31, 0x16, 0xde, 0x14, 0x01, 0xe0, 0x35, 0x19, 0xfd, 0xff, 0xfe, 0xf6, 0xb1, 0xa5, 0xd7, 0x00, 0x01, 0xf3, 0xc9, 0xc4, 0xfc, 0xff, 0xfd, 0xfc, 0xfc, 0xfc, 0xfe, 0xfd, 0xfd, 0xfb, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0xf7, 0xe2, 0xe0, 0xf5, 0xdb, 0xd6, 0xfe, 0xf8, 0xfd, 0xfd, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfb, 0xfd, 0xfb, 0xfd, 0xff, 0xfd, 0xfc, 0xfe, 0xfa, 0xfb, 0xfc, 0xff, 0xfc, 0xfc, 0xf9, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xee, 0x91, 0x83, 0xd8, 0x01, 0x00, 0xd6, 0x02, 0x00, 0xf0, 0x9d, 0x8e, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xfc, 0xfc, 0xf9, 0xfb, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xed, 0x7c, 0x66, 0xd6, 0x02, 0x00, 0xe3, 0x41, 0x26, 0xfd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xf6, 0xf2, 0xdf, 0x30, 0x15, 0xdf, 0x18, 0x02, 0xdc, 0x28, 0x09, 0xdc, 0x22, 0x05, 0xe3, 0x37, 0x1b, 0xe3, 0x31, 0x17, 0xd8, 0x0f, 0x00, 0xe3, 0x4a, 0x34, 0xfc, 0xfd, 0xfd, 0xed, 0x8a, 0x7e, 0xdc, 0x03, 0x03, 0xf7, 0xe1, 0xdd, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfc, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xf5, 0xb4, 0xaa, 0xd6, 0x02, 0x00, 0xda, 0x15, 0x00, 0xde, 0x33, 0x17, 0xe9, 0x5b, 0x45, 0xf0, 0x95, 0x8c, 0xfb, 0xde, 0xdc, 0xfd, 0xfd, 0xfa, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xfb, 0xfd, 0xfb, 0xfb, 0xfd, 0xf9, 0xff, 0xfc, 0xfe, 0xfb, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xea, 0x96, 0x87, 0xd5, 0x01, 0x00, 0xdb, 0x00, 0x00, 0xf6, 0xc6, 0xbe, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xfa, 0xfe, 0xfd, 0xfd, 0xfb, 0xfb, 0xf8, 0xff, 0xfd, 0xff, 0xf8, 0xf5, 0xf5, 0xdc, 0x25, 0x0f, 0xd3, 0x00, 0x01, 0xf1, 0xb0, 0xa3, 0xff, 0xff, 0xfe, 0xfc, 0xff, 0xfd, 0xe7, 0x48, 0x30, 0xd8, 0x10, 0x00, 0xde, 0x25, 0x0a, 0xe0, 0x25, 0x0b, 0xe1, 0x35, 0x19, 0xe0, 0x31, 0x18, 0xda, 0x10, 0x00, 0xe5, 0x53, 0x40, 0xfe, 0xff, 0xff, 0xeb, 0x7b, 0x67, 0xd9, 0x0a, 0x00, 0xfa, 0xed, 0xf1, 0xff, 0xfe, 0xff, 0xfa, 0xfd, 0xfc, 0xfe, 0xfd, 0xfc, 0xfb, 0xfe, 0xfd, 0xf4, 0xc4, 0xba, 0xe0, 0x1d, 0x13, 0xdf, 0x14, 0x00, 0xd9, 0x02, 0x01, 0xd4, 0x01, 0x04, 0xd4, 0x00, 0x00, 0xda, 0x15, 0x00, 0xec, 0x6f, 0x64, 0xf9, 0xe5, 0xde, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xfc, 0xfc, 0xff, 0xfe, 0xfd, 0xfd, 0xfc, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xee, 0x75, 0x5e, 0xd3, 0x00, 0x00, 0xe0, 0x25, 0x0d, 0xf9, 0xf3, 0xed, 0xff, 0xff, 0xff, 0xfb, 0xfc, 0xfd, 0xfc, 0xfe, 0xfa, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xeb, 0x98, 0x82, 0xd3, 0x01, 0x00, 0xe4, 0x3f, 0x25, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xfd, 0xe6, 0x54, 0x3f, 0xd9, 0x08, 0x00, 0xdf, 0x29, 0x0b, 0xdd, 0x24, 0x09, 0xe2, 0x36, 0x1a, 0xe2, 0x31, 0x17, 0xdc, 0x09, 0x01, 0xe2, 0x57, 0x3f, 0xff, 0xff, 0xfc, 0xe9, 0x7c, 0x6d, 0xd9, 0x03, 0x00, 0xf9, 0xdd, 0xd6, 0xfc, 0xff, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfd, 0xfa, 0xfe, 0xfd, 0xf8, 0xfb, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xf7, 0xe0, 0xe0, 0xf3, 0xc8, 0xbc, 0xee, 0x96, 0x86, 0xe3, 0x50, 0x36, 0xd9, 0x02, 0x03, 0xd2, 0x01, 0x00, 0xdb, 0x19, 0x0b, 0xf0, 0xa2, 0x99, 0xff, 0xff, 0xfe, 0xfc, 0xfe, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfd, 0xfd, 0xfd, 0xfc, 0xf9, 0xfd, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xe2, 0x3a, 0x27, 0xd4, 0x04, 0x00, 0xe6, 0x6f, 0x58, 0xfc, 0xff, 0xfd, 0xfb, 0xfe, 0xfd, 0xfc, 0xfe, 0xfc, 0xfa, 0xfd, 0xfc, 0xff, 0xfe, 0xfd, 0xfb, 0xf5, 0xf7, 0xdf, 0x24, 0x0a, 0xd6, 0x02, 0x00, 0xf2, 0xc4, 0xc0, 0xfd, 0xff, 0xff, 0xe8, 0x5e, 0x4d, 0xdb, 0x05, 0x00, 0xdf, 0x26, 0x0b, 0xdb, 0x25, 0x09, 0xde, 0x36, 0x1b, 0xe2, 0x32, 0x16, 0xd9, 0x0d, 0x00, 0xe5, 0x51, 0x3d, 0xff, 0xfe, 0xff, 0xec, 0x8e, 0x84, 0xd3, 0x02, 0x00, 0xec, 0x92, 0x81, 0xff, 0xff, 0xfe, 0xfb, 0xfe, 0xfc, 0xfb, 0xfd, 0xfb, 0xfb, 0xfe, 0xfd, 0xfb, 0xfe, 0xfd, 0xfe, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xf5, 0xbd, 0xb6, 0xe4, 0x4c, 0x39, 0xd3, 0x01, 0x00, 0xda, 0x00, 0x00, 0xe9, 0x83, 0x71, 0xff, 0xff, 0xfc, 0xfb, 0xff, 0xff, 0xfc, 0xfc, 0xfb, 0xf8, 0xfe, 0xfc, 0xfd, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xd4, 0xca, 0xd7, 0x06, 0x00, 0xdb, 0x04, 0x01, 0xf9, 0xd1, 0xcd, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xfb, 0xfc, 0xfe, 0xfc, 0xfb, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xee, 0x82, 0x6d, 0xd6, 0x00, 0x00, 0xe7, 0x70, 0x5b, 0xf9, 0xef, 0xe9, 0xe5, 0x43, 0x2e, 0xdb, 0x11, 0x00, 0xe1, 0x29, 0x09, 0xdd, 0x25, 0x05, 0xe1, 0x36, 0x1e, 0xe3, 0x31, 0x16, 0xd8, 0x11, 0x00, 0xe3, 0x40, 0x2b, 0xfd, 0xff, 0xfc, 0xee, 0xa3, 0x99, 0xd5, 0x01, 0x00, 0xdd, 0x22, 0x13, 0xfd, 0xf3, 0xed, 0xfd, 0xfe, 0xfe, 0xfb, 0xfd, 0xfb, 0xfd, 0xfd, 0xfd, 0xfc, 0xfc, 0xfb, 0xfd, 0xfd, 0xfd, 0xfa, 0xfe, 0xf7, 0xfb, 0xfe, 0xfd, 0xfd, 0xfc, 0xfc, 0xfa, 0xff, 0xfd, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xec, 0x85, 0x7a, 0xda, 0x00, 0x00, 0xd4, 0x02, 0x00, 0xe9, 0x85, 0x73, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfd, 0xfb, 0xfd, 0xfb, 0xfb, 0xfe, 0xfc, 0xfd, 0xfe, 0xff, 0xfe, 0xfe, 0xfd, 0xe6, 0x70, 0x56, 0xd4, 0x02, 0x00, 0xe3, 0x5e, 0x45, 0xfd, 0xff, 0xfd, 0xfe, 0xff, 0xff, 0xfb, 0xfd, 0xfb, 0xfb, 0xff, 0xfa, 0xff, 0xff, 0xfe, 0xf6, 0xd3, 0xcf, 0xdd, 0x0e, 0x00, 0xdd, 0x23, 0x04, 0xe2, 0x2e, 0x0f, 0xde, 0x20, 0x02, 0xde, 0x28, 0x0a, 0xdd, 0x29, 0x0a, 0xdf, 0x25, 0x06, 0xdd, 0x37, 0x1b, 0xdd, 0x31, 0x14, 0xde, 0x1a, 0x00, 0xdf, 0x2d, 0x10, 0xfe, 0xfe, 0xfd, 0xf3, 0xcb, 0xc7, 0xdc, 0x0b, 0x00, 0xd7, 0x00, 0x00, 0xe4, 0x47, 0x38, 0xfe, 0xfd, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf8, 0xfb, 0xfc, 0xfc, 0xfd, 0xfb, 0xfd, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfe, 0xfb, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xfb, 0xfb, 0xfa, 0xff, 0xff, 0xfc, 0xfe, 0xfe, 0xfe, 0xf1, 0x9e, 0x8f, 0xd4, 0x01, 0x00, 0xd5, 0x00, 0x01, 0xef, 0xb0, 0xa2, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfe, 0xf8, 0xfb, 0xfb, 0xfc, 0xff, 0xff, 0xfe, 0xf9, 0xe0, 0xdf, 0xdf, 0x0e, 0x01, 0xda, 0x09, 0x00, 0xf6, 0xdc, 0xd9, 0xfe, 0xfc, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xf9, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xe2, 0x47, 0x2a, 0xdb, 0x05, 0x00, 0xda, 0x1b, 0x04, 0xdf, 0x26, 0x09, 0xdf, 0x29, 0x0d, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x37, 0x1b, 0xe2, 0x31, 0x17, 0xdf, 0x20, 0x07, 0xdb, 0x11, 0x00, 0xf7, 0xe4, 0xdf, 0xfc, 0xfc, 0xfb, 0xdf, 0x1f, 0x02, 0xdd, 0x1f, 0x01, 0xd8, 0x01, 0x00, 0xe1, 0x3d, 0x2b, 0xf5, 0xc4, 0xbf, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfc, 0xfe, 0xf8, 0xfc, 0xfe, 0xfa, 0xfa, 0xfb, 0xfb, 0xfe, 0xfe, 0xfe, 0xfb, 0xfb, 0xfb, 0xfa, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xed, 0x87, 0x72, 0xd3, 0x02, 0x00, 0xdf, 0x1a, 0x01, 0xfa, 0xea, 0xec, 0xfc, 0xfe, 0xfc, 0xfe, 0xfd, 0xfd, 0xfa, 0xfd, 0xfb, 0xfe, 0xfe, 0xfd, 0xfd, 0xff, 0xff, 0xe5, 0x62, 0x48, 0xd3, 0x03, 0x00, 0xe9, 0x85, 0x73, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xfc, 0xfb, 0xfc, 0xfd, 0xfb, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xeb, 0x82, 0x76, 0xd8, 0x00, 0x00, 0xe2, 0x23, 0x0c, 0xde, 0x28, 0x0a, 0xdc, 0x26, 0x0a, 0xe1, 0x28, 0x0d, 0xdf, 0x23, 0x05, 0xe0, 0x35, 0x1b, 0xdf, 0x2f, 0x13, 0xe0, 0x28, 0x06, 0xd8, 0x01, 0x00, 0xee, 0xa4, 0x93, 0xff, 0xfe, 0xfb, 0xe2, 0x47, 0x2d, 0xde, 0x10, 0x00, 0xde, 0x2a, 0x0d, 0xde, 0x08, 0x00, 0xd7, 0x0c, 0x00, 0xe7, 0x54, 0x44, 0xed, 0x85, 0x7d, 0xef, 0xa5, 0x9c, 0xf4, 0xbc, 0xb9, 0xfe, 0xf8, 0xfb, 0xfd, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0xfb, 0xfe, 0xfe, 0xfe, 0xfb, 0xfc, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xe2, 0x41, 0x28, 0xd2, 0x01, 0x01, 0xef, 0x7b, 0x66, 0xfd, 0xfe, 0xfe, 0xfa, 0xfd, 0xfc, 0xfc, 0xfe, 0xfc, 0xfe, 0xfd, 0xfc, 0xfd, 0xff, 0xfd, 0xf2, 0xb2, 0xa8, 0xd5, 0x01, 0x00, 0xe4, 0x42, 0x23, 0xfb, 0xfe, 0xfd, 0xfe, 0xff, 0xff, 0xfe, 0xfd, 0xf6, 0xfd, 0xfd, 0xff, 0xfd, 0xff, 0xfb, 0xf3, 0xb9, 0xaf, 0xda, 0x08, 0x00, 0xdc, 0x28, 0x09, 0xe0, 0x28, 0x08, 0xdd, 0x27, 0x09, 0xdd, 0x27, 0x09, 0xe0, 0x24, 0x06, 0xde, 0x36, 0x1b, 0xdd, 0x30, 0x19, 0xe0, 0x27, 0x0a, 0xdd, 0x07, 0x01, 0xe1, 0x5e, 0x46, 0xff, 0xfe, 0xff, 0xeb, 0x8c, 0x7f, 0xd6, 0x00, 0x00, 0xdd, 0x2a, 0x06, 0xde, 0x28, 0x0e, 0xde, 0x22, 0x06, 0xd8, 0x09, 0x00, 0xd8, 0x02, 0x00, 0xdb, 0x00, 0x00, 0xd9, 0x08, 0x00, 0xde, 0x2a, 0x1d, 0xf0, 0x98, 0x8e, 0xfd, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xfa, 0xfd, 0xfb, 0xfc, 0xfc, 0xf9, 0xfd, 0xfd, 0xfd, 0xfb, 0xfe, 0xfc, 0xf6, 0xc4, 0xbd, 0xd5, 0x01, 0x00, 0xdc, 0x19, 0x00, 0xf8, 0xee, 0xe8, 0xfe, 0xff, 0xfe, 0xff, 0xfc, 0xfd, 0xfc, 0xfc, 0xfc, 0xfd, 0xff, 0xfd, 0xfb, 0xee, 0xef, 0xdd, 0x1b, 0x09, 0xdd, 0x0a, 0x00, 0xf7, 0xda, 0xd6, 0xfd, 0xff, 0xf9, 0xfe, 0xfd, 0xfd, 0xfb, 0xfd, 0xfb, 0xfc, 0xfe, 0xf8, 0xf6, 0xe1, 0xe0, 0xdc, 0x22, 0x05, 0xd8, 0x1c, 0x00, 0xe0, 0x26, 0x07, 0xde, 0x28, 0x0a, 0xdd, 0x27, 0x09, 0xde, 0x24, 0x05, 0xdf, 0x37, 0x1c, 0xe1, 0x31, 0x15, 0xe0, 0x25, 0x0d, 0xdc, 0x1c, 0x00, 0xde, 0x1f, 0x04, 0xfc, 0xfd, 0xf7, 0xfc, 0xeb, 0xe9, 0xdf, 0x10, 0x00, 0xdd, 0x1f, 0x01, 0xe1, 0x28, 0x0b, 0xe1, 0x28, 0x0d, 0xda, 0x1a, 0x00, 0xdb, 0x02, 0x02, 0xd6, 0x02, 0x00, 0xd9, 0x0a, 0x00, 0xdb, 0x0c, 0x00, 0xd7, 0x00, 0x00, 0xe9, 0x78, 0x62, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfc, 0xfe, 0xfc, 0xfe, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xe3, 0x45, 0x2b, 0xd6, 0x01, 0x02, 0xf2, 0x9f, 0x93, 0xfe, 0xff, 0xff, 0xfa, 0xfb, 0xfb, 0xfd, 0xfe, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xfe, 0xe4, 0x53, 0x36, 0xd5, 0x00, 0x01, 0xef, 0xac, 0x9f, 0xfd, 0xfe, 0xfe, 0xf9, 0xfc, 0xfb, 0xfb, 0xfe, 0xfd, 0xff, 0xfe, 0xfe, 0xfc, 0xff, 0xfe, 0xe6, 0x47, 0x2f, 0xdf, 0x0f, 0x00, 0xdf, 0x26, 0x0b, 0xdf, 0x26, 0x0b, 0xe1, 0x28, 0x0d, 0xdd, 0x25, 0x05, 0xe0, 0x35, 0x1b, 0xe1, 0x31, 0x13, 0xe1, 0x27, 0x0a, 0xe0, 0x27, 0x0a, 0xd7, 0x01, 0x00, 0xef, 0x9a, 0x8f, 0xfb, 0xff, 0xff, 0xe4, 0x5b, 0x42, 0xd6, 0x02, 0x00, 0xde, 0x2d, 0x0b, 0xd6, 0x0e, 0x00, 0xdc, 0x26, 0x0a, 0xeb, 0x81, 0x6d, 0xef, 0x92, 0x86, 0xe4, 0x5b, 0x43, 0xdc, 0x0d, 0x01, 0xdd, 0x18, 0x01, 0xd8, 0x01, 0x02, 0xf3, 0xa7, 0xa1, 0xfe, 0xff, 0xfe, 0xf8, 0xfe, 0xfc, 0xfb, 0xfb, 0xfa, 0xfc, 0xff, 0xfd, 0xfd, 0xfe, 0xfe, 0xef, 0x8e, 0x7f, 0xd3, 0x00, 0x00, 0xe8, 0x67, 0x51, 0xfe, 0xfe, 0xfe, 0xfa, 0xff, 0xfd, 0xfc, 0xfc, 0xfd, 0xfa, 0xff, 0xff, 0xfd, 0xff, 0xf9, 0xec, 0x7b, 0x6c, 0xd5, 0x01, 0x00, 0xea, 0x86, 0x74, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfb, 0xfb, 0xfc, 0xff, 0xfb, 0xfd, 0xfd, 0xfd, 0xe4, 0x4b, 0x33, 0xdc, 0x0c, 0x00, 0xde, 0x2a, 0x0d, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x26, 0x06, 0xe1, 0x36, 0x1c, 0xe1, 0x30, 0x16, 0xdd, 0x27, 0x0d, 0xdd, 0x29, 0x0a, 0xdb, 0x0f, 0x00, 0xde, 0x2e, 0x12, 0xff, 0xff, 0xfe, 0xfb, 0xdf, 0xd8, 0xd9, 0x09, 0x01, 0xdb, 0x0f, 0x00, 0xe1, 0x30, 0x1a, 0xfd, 0xdf, 0xe1, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfd, 0xfc, 0xec, 0x88, 0x7a, 0xd8, 0x08, 0x00, 0xd9, 0x08, 0x00, 0xe0, 0x38, 0x1d, 0xfb, 0xfc, 0xfc, 0xfe, 0xff, 0xfc, 0xfd, 0xfb, 0xff, 0xfc, 0xfe, 0xfc, 0xfe, 0xfe, 0xff, 0xf1, 0xc0, 0xb3, 0xd6, 0x01, 0x02, 0xe4, 0x3f, 0x25, 0xfd, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfa, 0xfb, 0xfc, 0xfc, 0xfd, 0xfe, 0xfe, 0xee, 0x96, 0x8c, 0xd4, 0x00, 0x00, 0xe9, 0x6a, 0x5b, 0xff, 0xff, 0xfe, 0xf8, 0xff, 0xfc, 0xfd, 0xfd, 0xfa, 0xfe, 0xff, 0xff, 0xef, 0xb2, 0xa9, 0xda, 0x08, 0x00, 0xdf, 0x23, 0x09, 0xdc, 0x28, 0x09, 0xdd, 0x27, 0x0b, 0xdf, 0x26, 0x0b, 0xdf, 0x25, 0x06, 0xe1, 0x36, 0x1c, 0xdd, 0x30, 0x19, 0xde, 0x29, 0x08, 0xdf, 0x26, 0x09, 0xdf, 0x25, 0x08, 0xd8, 0x01, 0x00, 0xed, 0x9d, 0x8e, 0xfe, 0xfe, 0xfe, 0xe8, 0x77, 0x60, 0xd4, 0x00, 0x00, 0xf0, 0xb5, 0xa9, 0xfd, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xfc, 0xfe, 0xfe, 0xfb, 0xff, 0xff, 0xff, 0xe3, 0x42, 0x29, 0xd8, 0x0b, 0x02, 0xdf, 0x11, 0x00, 0xf6, 0xcc, 0xc9, 0xfa, 0xff, 0xfd, 0xfc, 0xfd, 0xfe, 0xfc, 0xfc, 0xfb, 0xfe, 0xff, 0xfc, 0xf5, 0xd6, 0xd3, 0xdc, 0x0b, 0x00, 0xe1, 0x26, 0x0e, 0xfe, 0xed, 0xeb, 0xfe, 0xff, 0xff, 0xfb, 0xfc, 0xfd, 0xfa, 0xfe, 0xf9, 0xff, 0xff, 0xff, 0xf1, 0xa6, 0x9d, 0xd4, 0x02, 0x00, 0xe7, 0x65, 0x54, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfd, 0xfd, 0xed, 0xef, 0xdb, 0x1b, 0x06, 0xdb, 0x11, 0x00, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xe1, 0x31, 0x13, 0xdf, 0x26, 0x0b, 0xdd, 0x2a, 0x06, 0xde, 0x28, 0x0e, 0xdc, 0x18, 0x04, 0xdb, 0x16, 0x00, 0xfa, 0xf1, 0xee, 0xff, 0xff, 0xff, 0xe1, 0x20, 0x0b, 0xf4, 0xbd, 0xb0, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xf8, 0xfa, 0xfd, 0xfb, 0xfd, 0xfe, 0xff, 0xfa, 0xff, 0xfe, 0xea, 0x73, 0x66, 0xd7, 0x01, 0x00, 0xd8, 0x09, 0x00, 0xf2, 0xb5, 0xac, 0xfd, 0xff, 0xfb, 0xfd, 0xfa, 0xfa, 0xfc, 0xff, 0xfd, 0xff, 0xff, 0xfc, 0xf8, 0xe4, 0xdf, 0xd9, 0x1b, 0x00, 0xdd, 0x1b, 0x00, 0xf7, 0xe7, 0xdf, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xff, 0xfe, 0xfe, 0xef, 0xae, 0xa1, 0xd6, 0x02, 0x00, 0xe5, 0x54, 0x3b, 0xfe, 0xe9, 0xe8, 0xfb, 0xef, 0xed, 0xfa, 0xe6, 0xe7, 0xe2, 0x4e, 0x32, 0xd6, 0x00, 0x00, 0xdf, 0x2b, 0x0a, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xe0, 0x31, 0x15, 0xe1, 0x26, 0x0c, 0xdc, 0x27, 0x0d, 0xde, 0x25, 0x0a, 0xdd, 0x2c, 0x0c, 0xd7, 0x01, 0x00, 0xe4, 0x52, 0x3d, 0xfe, 0xfe, 0xff, 0xf5, 0xc7, 0xc1, 0xef, 0xa2, 0x94, 0xfe, 0xff, 0xfe, 0xfb, 0xfc, 0xfd, 0xfa, 0xfd, 0xfb, 0xff, 0xfe, 0xff, 0xfb, 0xfe, 0xfd, 0xe5, 0x4d, 0x31, 0xdb, 0x0a, 0x00, 0xdd, 0x0e, 0x00, 0xf5, 0xc3, 0xbc, 0xff, 0xfe, 0xfe, 0xfe, 0xfc, 0xfe, 0xfc, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xdb, 0xd1, 0xde, 0x0f, 0x01, 0xdd, 0x24, 0x09, 0xfa, 0xeb, 0xea, 0xfd, 0xff, 0xff, 0xfb, 0xfc, 0xfc, 0xfa, 0xfd, 0xfc, 0xfd, 0xff, 0xfd, 0xf1, 0xa7, 0xa0, 0xdd, 0x05, 0x00, 0xde, 0x24, 0x03, 0xe0, 0x2b, 0x11, 0xde, 0x33, 0x17, 0xdc, 0x21, 0x07, 0xd9, 0x0a, 0x00, 0xe2, 0x2d, 0x0a, 0xdd, 0x27, 0x0b, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xe2, 0x30, 0x16, 0xdd, 0x27, 0x0b, 0xde, 0x28, 0x0a, 0xe0, 0x27, 0x0c, 0xdd, 0x27, 0x0d, 0xdf, 0x27, 0x07, 0xdb, 0x00, 0x00, 0xed, 0x87, 0x74, 0xff, 0xff, 0xff, 0xf7, 0xe1, 0xdf, 0xf6, 0xdc, 0xd7, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfc, 0xfd, 0xfd, 0xf0, 0x9a, 0x94, 0xdb, 0x0a, 0x01, 0xd7, 0x0f, 0x01, 0xe0, 0x2b, 0x11, 0xfb, 0xf4, 0xf5, 0xfe, 0xff, 0xfc, 0xfb, 0xfc, 0xfc, 0xfb, 0xfd, 0xf9, 0xfd, 0xff, 0xfd, 0xf6, 0xc6, 0xbe, 0xd6, 0x00, 0x00, 0xe5, 0x3a, 0x20, 0xfb, 0xfa, 0xf7, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfb, 0xfd, 0xfb, 0xff, 0xff, 0xfc, 0xed, 0x9d, 0x8e, 0xda, 0x02, 0x00, 0xdd, 0x22, 0x0a, 0xda, 0x1a, 0x00, 0xdb, 0x0c, 0x00, 0xda, 0x09, 0x00, 0xde, 0x1f, 0x00, 0xde, 0x1b, 0x00, 0xde, 0x2a, 0x0d, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xe0, 0x30, 0x14, 0xde, 0x2a, 0x0d, 0xdc, 0x26, 0x0a, 0xde, 0x29, 0x08, 0xe1, 0x27, 0x08, 0xe0, 0x27, 0x0a, 0xdf, 0x1f, 0x04, 0xd9, 0x02, 0x03, 0xef, 0xa1, 0x96, 0xfe, 0xff, 0xff, 0xf7, 0xd1, 0xc8, 0xec, 0x8a, 0x80, 0xed, 0x87, 0x82, 0xea, 0x73, 0x5f, 0xdb, 0x11, 0x00, 0xda, 0x19, 0x03, 0xdb, 0x0c, 0x00, 0xec, 0x99, 0x8d, 0xfd, 0xff, 0xff, 0xf8, 0xff, 0xfa, 0xfc, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xfd, 0xf0, 0x98, 0x8e, 0xd6, 0x01, 0x05, 0xe2, 0x5e, 0x43, 0xfe, 0xff, 0xfc, 0xfb, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfc, 0xfe, 0xfc, 0xff, 0xfe, 0xff, 0xe9, 0x81, 0x72, 0xd3, 0x01, 0x00, 0xe0, 0x2c, 0x0f, 0xdb, 0x11, 0x00, 0xd8, 0x01, 0x00, 0xf0, 0xa5, 0x9c, 0xf6, 0xed, 0xe8, 0xe1, 0x34, 0x1d, 0xdb, 0x18, 0x00, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xe0, 0x31, 0x16, 0xdd, 0x29, 0x0c, 0xda, 0x28, 0x0b, 0xe0, 0x27, 0x0c, 0xe0, 0x25, 0x0e, 0xd9, 0x28, 0x08, 0xde, 0x2d, 0x0d, 0xde, 0x17, 0x01, 0xd8, 0x00, 0x01, 0xf0, 0x98, 0x90, 0xfd, 0xff, 0xfc, 0xf1, 0xba, 0xaf, 0xdd, 0x16, 0x02, 0xd4, 0x00, 0x00, 0xdd, 0x16, 0x02, 0xda, 0x1e, 0x02, 0xe1, 0x27, 0x14, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xfc, 0xfc, 0xff, 0xfd, 0xfa, 0xfd, 0xfd, 0xfe, 0xff, 0xfa, 0xfd, 0xfd, 0xfe, 0xe4, 0x57, 0x3b, 0xd3, 0x00, 0x00, 0xf4, 0xb9, 0xaf, 0xfd, 0xfe, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xfe, 0xfe, 0xfc, 0xfe, 0xfc, 0xfe, 0xff, 0xff, 0xe3, 0x5c, 0x43, 0xdc, 0x04, 0x01, 0xd3, 0x00, 0x00, 0xdc, 0x17, 0x02, 0xf4, 0xb0, 0xa7, 0xff, 0xff, 0xfe, 0xf7, 0xe3, 0xdc, 0xe1, 0x2a, 0x1e, 0xdd, 0x17, 0x06, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xe2, 0x30, 0x13, 0xdd, 0x24, 0x07, 0xe1, 0x28, 0x0f, 0xe1, 0x27, 0x0a, 0xde, 0x28, 0x0e, 0xdd, 0x27, 0x09, 0xdf, 0x26, 0x0b, 0xdf, 0x2b, 0x0e, 0xdd, 0x1a, 0x00, 0xda, 0x00, 0x00, 0xeb, 0x78, 0x6d, 0xfd, 0xff, 0xff, 0xfe, 0xfd, 0xfa, 0xe7, 0x79, 0x71, 0xda, 0x0e, 0x00, 0xda, 0x00, 0x00, 0xd7, 0x0d, 0x00, 0xe8, 0x58, 0x49, 0xf9, 0xf0, 0xef, 0xfd, 0xfe, 0xfe, 0xff, 0xfe, 0xfb, 0xfe, 0xff, 0xff, 0xfa, 0xd7, 0xd3, 0xda, 0x0a, 0x01, 0xdd, 0x0e, 0x02, 0xeb, 0x8a, 0x7d, 0xf7, 0xe7, 0xe3, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xf9, 0xd8, 0xd8, 0xe8, 0x7d, 0x6f, 0xd6, 0x02, 0x00, 0xd9, 0x00, 0x00, 0xe6, 0x59, 0x4f, 0xfd, 0xf4, 0xf1, 0xff, 0xff, 0xff, 0xef, 0xa3, 0x9d, 0xd9, 0x09, 0x00, 0xd9, 0x14, 0x00, 0xdf, 0x29, 0x0b, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xdf, 0x30, 0x15, 0xdf, 0x29, 0x0d, 0xdd, 0x27, 0x09, 0xdc, 0x26, 0x0a, 0xde, 0x29, 0x08, 0xe0, 0x27, 0x0a, 0xde, 0x28, 0x0a, 0xe0, 0x27, 0x0a, 0xde, 0x2a, 0x0d, 0xdd, 0x1f, 0x01, 0xd9, 0x00, 0x02, 0xe4, 0x47, 0x38, 0xfb, 0xe5, 0xe1, 0xff, 0xff, 0xfc, 0xf8, 0xe5, 0xe2, 0xe7, 0x61, 0x59, 0xda, 0x1b, 0x00, 0xd4, 0x00, 0x00, 0xdc, 0x12, 0x00, 0xea, 0x6b, 0x5c, 0xf0, 0xa5, 0x99, 0xf3, 0xc7, 0xc0, 0xe6, 0x57, 0x40, 0xda, 0x08, 0x01, 0xdd, 0x2a, 0x06, 0xdb, 0x0a, 0x00, 0xdf, 0x29, 0x0d, 0xe7, 0x66, 0x52, 0xdf, 0x40, 0x28, 0xd4, 0x01, 0x00, 0xdb, 0x00, 0x03, 0xe2, 0x49, 0x3b, 0xf6, 0xc5, 0xc0, 0xfc, 0xff, 0xfd, 0xfe, 0xff, 0xfe, 0xe7, 0x6a, 0x5f, 0xda, 0x00, 0x00, 0xde, 0x15, 0x00, 0xdc, 0x2b, 0x0b, 0xe0, 0x27, 0x0a, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe2, 0x35, 0x1c, 0xdf, 0x30, 0x14, 0xdd, 0x28, 0x0e, 0xdd, 0x27, 0x0b, 0xde, 0x28, 0x0c, 0xe0, 0x27, 0x0c, 0xe0, 0x27, 0x0c, 0xde, 0x28, 0x0c, 0xdd, 0x27, 0x09, 0xe0, 0x26, 0x09, 0xe1, 0x26, 0x0e, 0xde, 0x29, 0x08, 0xd7, 0x04, 0x00, 0xdf, 0x14, 0x00, 0xeb, 0x80, 0x72, 0xfe, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfc, 0xf2, 0x99, 0x8d, 0xe4, 0x42, 0x2d, 0xd4, 0x07, 0x00, 0xda, 0x01, 0x01, 0xd4, 0x02, 0x00, 0xd9, 0x01, 0x00, 0xd9, 0x06, 0x00, 0xd8, 0x05, 0x00, 0xd8, 0x08, 0x00, 0xda, 0x00, 0x00, 0xd8, 0x02, 0x00, 0xdf, 0x2a, 0x11, 0xeb, 0x7e, 0x73, 0xfa, 0xe4, 0xe2, 0xff, 0xff, 0xfe, 0xfd, 0xfe, 0xfe, 0xf0, 0xa1, 0x96, 0xde, 0x27, 0x11, 0xd8, 0x00, 0x01, 0xe0, 0x21, 0x08, 0xdf, 0x29, 0x0d, 0xdd, 0x28, 0x04, 0xdd, 0x28, 0x0e, 0xdd, 0x27, 0x09, 0xe0, 0x28, 0x08, 0xdd, 0x27, 0x09, 0xe0, 0x27, 0x0a, 0xde, 0x24, 0x05, 0xe2, 0x36, 0x1a, 0xe1, 0x31, 0x15, 0xe0, 0x27, 0x0c, 0xdf, 0x26, 0x09, 0xdf, 0x26, 0x09, 0xdf, 0x26, 0x09, 0xdf, 0x24, 0x0a, 0xdf, 0x26, 0x09, 0xdf, 0x26, 0x09, 0xdf, 0x25, 0x0e, 0xda, 0x29, 0x09, 0xdc, 0x28, 0x0b, 0xdf, 0x29, 0x0b, 0xde, 0x1b, 0x00, 0xd8, 0x02, 0x00, 0xdd, 0x25, 0x14, 0xea, 0x83, 0x78, 0xf7, 0xe6, 0xe4, 0xff, 0xff, 0xff, 0xfc, 0xfd, 0xff, 0xfe, 0xfe, 0xfd, 0xf6, 0xe0, 0xdc, 0xf4, 0xb8, 0xb2, 0xf0, 0xa5, 0x99, 0xef, 0x9f, 0x90, 0xf2, 0xa2, 0x9a, 0xf0, 0xb9, 0xae, 0xf3, 0xd9, 0xd6, 0xfc, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xfe, 0xfa, 0xf7, 0xf8, 0xee, 0x95, 0x89, 0xdf, 0x38, 0x22, 0xd7, 0x00, 0x01, 0xda, 0x0f, 0x00, 0xe0, 0x2a, 0x0c, 0xdd, 0x27, 0x09, 0xdd, 0x29, 0x0a, 0xdf, 0x27, 0x07, 0xdf, 0x26, 0x0d, 0xe0, 0x27, 0x0c, 0xe0, 0x27, 0x0a, 0xdd, 0x27, 0x0b, 0xdf, 0x26, 0x0b, 0xde, 0x24, 0x05, 0xe1, 0x34, 0x1b, 0xe0, 0x30, 0x12, 0xdd, 0x27, 0x0b, 0xdf, 0x26, 0x09, 0xde, 0x28, 0x0a, 0xdf, 0x29, 0x0b, 0xde, 0x28, 0x0c, 0xde, 0x28, 0x0a, 0xdf, 0x26, 0x09, 0xdd, 0x28, 0x07, 0xe0, 0x28, 0x08, 0xde, 0x28, 0x0a, 0xdc, 0x27, 0x0e, 0xe0, 0x24, 0x0a, 0xdd, 0x2b, 0x10, 0xdd, 0x13, 0x00, 0xd7, 0x00, 0x00, 0xde, 0x12, 0x00, 0xe0, 0x49, 0x32, 0xef, 0x88, 0x79, 0xf5, 0xc5, 0xbd, 0xfb, 0xf5, 0xf1, 0xfe, 0xff, 0xfe, 0xfa, 0xff, 0xfb, 0xfc, 0xff, 0xfd, 0xfe, 0xfe, 0xfe, 0xfd, 0xff, 0xfe, 0xfa, 0xfd, 0xfb, 0xf7, 0xd1, 0xca, 0xef, 0x94, 0x89, 0xe3, 0x5a, 0x44, 0xdb, 0x1f, 0x05, 0xda, 0x01, 0x01, 0xdf, 0x0f, 0x00, 0xdd, 0x28, 0x05, 0xdf, 0x26, 0x0b, 0xdf, 0x27, 0x05, 0xdd, 0x29, 0x0a, 0xe0, 0x26, 0x07, 0xde, 0x28, 0x0e, 0xe0, 0x27, 0x0a, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x0b, 0xdc, 0x28, 0x0b, 0xde, 0x28, 0x0c, 0xdf, 0x27, 0x07, 0xe0, 0x35, 0x1b, 0xe1, 0x31, 0x15, 0xdf, 0x29, 0x0d, 0xe0, 0x27, 0x0a, 0xdc, 0x28, 0x09, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x0b, 0xdd, 0x28, 0x07, 0xe0, 0x27, 0x0c, 0xe0, 0x26, 0x09, 0xe0, 0x26, 0x09, 0xe1, 0x28, 0x0b, 0xdd, 0x27, 0x09, 0xdf, 0x29, 0x0d, 0xe2, 0x2a, 0x0a, 0xe0, 0x21, 0x00, 0xdd, 0x0e, 0x02, 0xd6, 0x02, 0x00, 0xda, 0x07, 0x00, 0xde, 0x19, 0x00, 0xdf, 0x2e, 0x14, 0xe1, 0x38, 0x23, 0xe5, 0x42, 0x2a, 0xe5, 0x40, 0x28, 0xe4, 0x2f, 0x16, 0xdd, 0x1d, 0x02, 0xdb, 0x0c, 0x00, 0xd8, 0x00, 0x00, 0xda, 0x07, 0x00, 0xde, 0x1f, 0x00, 0xde, 0x28, 0x0e, 0xdc, 0x25, 0x0d, 0xde, 0x29, 0x08, 0xdc, 0x28, 0x0b, 0xe0, 0x27, 0x0a, 0xe0, 0x27, 0x0c, 0xdd, 0x27, 0x0b, 0xdf, 0x26, 0x09, 0xe1, 0x28, 0x0b, 0xe2, 0x27, 0x0d, 0xe0, 0x27, 0x0a, 0xde, 0x28, 0x0c, 0xdf, 0x26, 0x0b, 0xde, 0x26, 0x04, 0xe0, 0x34, 0x18, 0xd9, 0x27, 0x0c, 0xdd, 0x24, 0x0b, 0xe1, 0x26, 0x0c, 0xdf, 0x29, 0x0d, 0xe0, 0x27, 0x0e, 0xdf, 0x26, 0x0d, 0xe0, 0x27, 0x0e, 0xe0, 0x25, 0x0d, 0xde, 0x28, 0x0e, 0xde, 0x24, 0x0f, 0xde, 0x28, 0x0e, 0xdd, 0x29, 0x0a, 0xd9, 0x27, 0x0d, 0xe2, 0x25, 0x0e, 0xdc, 0x27, 0x0d, 0xdf, 0x24, 0x0c, 0xdc, 0x28, 0x0b, 0xe1, 0x25, 0x0b, 0xdf, 0x26, 0x0d, 0xe0, 0x27, 0x0c, 0xdf, 0x1f, 0x00, 0xdc, 0x18, 0x00, 0xdc, 0x15, 0x01, 0xda, 0x0f, 0x00, 0xde, 0x10, 0x00, 0xdd, 0x18, 0x00, 0xdc, 0x1e, 0x00, 0xde, 0x26, 0x06, 0xe0, 0x27, 0x0c, 0xdf, 0x25, 0x04, 0xdd, 0x26, 0x10, 0xdd, 0x29, 0x0c, 0xdd, 0x28, 0x07, 0xdf, 0x29, 0x0d, 0xe0, 0x27, 0x0e, 0xdf, 0x24, 0x0a, 0xdf, 0x26, 0x0d, 0xdd, 0x28, 0x0f, 0xde, 0x28, 0x0a, 0xdf, 0x25, 0x0e, 0xdd, 0x27, 0x0b, 0xdd, 0x27, 0x09, 0xde, 0x28, 0x0c, 0xe1, 0x26, 0x0c, 0xe0, 0x22, 0x04, 0xdf, 0x2d, 0x13, 0xe1, 0x3b, 0x1d, 0xe3, 0x34, 0x19, 0xe2, 0x33, 0x17, 0xde, 0x32, 0x15, 0xdf, 0x30, 0x14, 0xe0, 0x31, 0x16, 0xe1, 0x32, 0x17, 0xe0, 0x31, 0x15, 0xe2, 0x31, 0x17, 0xe2, 0x30, 0x16, 0xe2, 0x32, 0x14, 0xe0, 0x31, 0x15, 0xe0, 0x31, 0x16, 0xe2, 0x32, 0x14, 0xde, 0x32, 0x16, 0xe3, 0x33, 0x15, 0xdf, 0x33, 0x17, 0xe1, 0x32, 0x17, 0xe1, 0x32, 0x16, 0xe1, 0x32, 0x16, 0xdf, 0x30, 0x15, 0xe2, 0x33, 0x18, 0xe0, 0x31, 0x15, 0xe1, 0x30, 0x18, 0xde, 0x31, 0x18, 0xde, 0x32, 0x16, 0xe3, 0x33, 0x17, 0xde, 0x32, 0x16, 0xde, 0x31, 0x1a, 0xe4, 0x32, 0x18, 0xe1, 0x30, 0x16, 0xe2, 0x31, 0x1b, 0xe1, 0x2f, 0x1c, 0xde, 0x2f, 0x13, 0xe1, 0x32, 0x17, 0xe1, 0x32, 0x16, 0xe1, 0x32, 0x17, 0xe1, 0x32, 0x16, 0xe2, 0x31, 0x17, 0xe1, 0x32, 0x17, 0xe2, 0x31, 0x17, 0xe1, 0x31, 0x15, 0xe0, 0x31, 0x16, 0xe0, 0x31, 0x16, 0xdf, 0x2f, 0x11, 0xe1, 0x3f, 0x24
+};
\ No newline at end of file
@@ -0,0 +1,19202 @@
+unsigned int usb_camera_2_rgb888[19200] = {
+    0x242422,
+    0x222220,
+    0x21221D,
+    0x252620,
+    0x31322A,
+    0x424437,
+    0x545648,
+    0x5F624F,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x232726,
+    0x242827,
+    0x242827,
+    0x252928,
+    0x262A29,
+    0x272B2A,
+    0x282C2B,
+    0x282C2B,
+    0x363B35,
+    0x363B35,
+    0x363B35,
+    0x383D37,
+    0x3D423C,
+    0x434842,
+    0x4A4F49,
+    0x4E534D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x4F544E,
+    0x4B504A,
+    0x444943,
+    0x3B403A,
+    0x313630,
+    0x282D27,
+    0x212620,
+    0x1F211C,
+    0x252722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x1D1E19,
+    0x1D1E19,
+    0x1D1E19,
+    0x1D1E19,
+    0x1D1E19,
+    0x1D1E19,
+    0x1D1E19,
+    0x1D1D1B,
+    0x1F2420,
+    0x1F2322,
+    0x1F2322,
+    0x1F2322,
+    0x1F2322,
+    0x1F2322,
+    0x1F2322,
+    0x1F2322,
+    0x1D2120,
+    0x1D2120,
+    0x1D2120,
+    0x1D2120,
+    0x1D2120,
+    0x1D2120,
+    0x1D2120,
+    0x1D2120,
+    0x232726,
+    0x232726,
+    0x232726,
+    0x232726,
+    0x232726,
+    0x232726,
+    0x232726,
+    0x232726,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x2A2A28,
+    0x262624,
+    0x22231E,
+    0x23241E,
+    0x2B2C24,
+    0x393B2E,
+    0x47493B,
+    0x515441,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x222625,
+    0x232726,
+    0x252928,
+    0x282C2B,
+    0x2B2F2E,
+    0x2E3231,
+    0x303433,
+    0x323635,
+    0x393E38,
+    0x393E38,
+    0x3A3F39,
+    0x3D423C,
+    0x424741,
+    0x484D47,
+    0x4D524C,
+    0x50554F,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x494E48,
+    0x474C46,
+    0x414640,
+    0x3B403A,
+    0x343933,
+    0x2D322C,
+    0x282D27,
+    0x272924,
+    0x2B2D28,
+    0x2C2D28,
+    0x2C2D28,
+    0x2C2D28,
+    0x2C2D28,
+    0x2C2D28,
+    0x2C2D28,
+    0x2C2D28,
+    0x2B2C27,
+    0x2B2C27,
+    0x2B2C27,
+    0x2B2C27,
+    0x2B2C27,
+    0x2B2C27,
+    0x2B2C27,
+    0x2B2C27,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x292A25,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272823,
+    0x272725,
+    0x282D29,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x242827,
+    0x242827,
+    0x242827,
+    0x242827,
+    0x242827,
+    0x242827,
+    0x242827,
+    0x242827,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x333331,
+    0x2F2F2D,
+    0x2A2B26,
+    0x282923,
+    0x2E2F27,
+    0x3A3C2F,
+    0x47493B,
+    0x505340,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x202423,
+    0x222625,
+    0x262A29,
+    0x2C302F,
+    0x323635,
+    0x383C3B,
+    0x3C403F,
+    0x3F4342,
+    0x3B403A,
+    0x3D423C,
+    0x414640,
+    0x454A44,
+    0x4A4F49,
+    0x4E534D,
+    0x515650,
+    0x535852,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x40453F,
+    0x3E433D,
+    0x3B403A,
+    0x383D37,
+    0x353A34,
+    0x333832,
+    0x343631,
+    0x343631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x2F302B,
+    0x2F302B,
+    0x2F302B,
+    0x2F302B,
+    0x2F302B,
+    0x2F302B,
+    0x2F302B,
+    0x2F302B,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30302E,
+    0x2F3430,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x262A29,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x31312F,
+    0x2D2D2B,
+    0x2A2B26,
+    0x2C2D27,
+    0x34352D,
+    0x434538,
+    0x525446,
+    0x5C5F4C,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x1E2221,
+    0x212524,
+    0x272B2A,
+    0x2F3332,
+    0x373B3A,
+    0x3F4342,
+    0x454948,
+    0x484C4B,
+    0x3C413B,
+    0x40453F,
+    0x464B45,
+    0x4D524C,
+    0x515650,
+    0x545953,
+    0x545953,
+    0x545953,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x3A3F39,
+    0x3B403A,
+    0x3B403A,
+    0x3C413B,
+    0x3C413B,
+    0x3D423C,
+    0x3D423C,
+    0x3F413C,
+    0x3E403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x343530,
+    0x343530,
+    0x343530,
+    0x343530,
+    0x343530,
+    0x343530,
+    0x343530,
+    0x343530,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x323230,
+    0x2F3430,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2D3130,
+    0x2D3130,
+    0x2D3130,
+    0x2D3130,
+    0x2D3130,
+    0x2D3130,
+    0x2D3130,
+    0x2D3130,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x1B1B19,
+    0x1A1A18,
+    0x1A1B16,
+    0x1F201A,
+    0x2C2D25,
+    0x3E4033,
+    0x515345,
+    0x5C5F4C,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x1E2221,
+    0x212524,
+    0x272B2A,
+    0x2F3332,
+    0x373B3A,
+    0x3F4342,
+    0x454948,
+    0x484C4B,
+    0x383D37,
+    0x3E433D,
+    0x484D47,
+    0x50554F,
+    0x555A54,
+    0x555A54,
+    0x525751,
+    0x50554F,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x4B504A,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x393E38,
+    0x3A3F39,
+    0x3C413B,
+    0x3E433D,
+    0x40453F,
+    0x424741,
+    0x434842,
+    0x464843,
+    0x434540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30302E,
+    0x2A2F2B,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x282C2B,
+    0x2C302F,
+    0x2C302F,
+    0x2C302F,
+    0x2C302F,
+    0x2C302F,
+    0x2C302F,
+    0x2C302F,
+    0x2C302F,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x181816,
+    0x161614,
+    0x151611,
+    0x191A14,
+    0x25261E,
+    0x36382B,
+    0x47493B,
+    0x525542,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x202423,
+    0x222625,
+    0x262A29,
+    0x2C302F,
+    0x323635,
+    0x383C3B,
+    0x3C403F,
+    0x3F4342,
+    0x313630,
+    0x393E38,
+    0x454A44,
+    0x50554F,
+    0x555A54,
+    0x535852,
+    0x4D524C,
+    0x494E48,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x484D47,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x3E433D,
+    0x3E433D,
+    0x3F443E,
+    0x414640,
+    0x424741,
+    0x434842,
+    0x444943,
+    0x474944,
+    0x444641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x323230,
+    0x292E2A,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x484846,
+    0x424240,
+    0x3B3C37,
+    0x383933,
+    0x3B3C34,
+    0x444639,
+    0x505244,
+    0x585B48,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x222625,
+    0x232726,
+    0x252928,
+    0x282C2B,
+    0x2B2F2E,
+    0x2E3231,
+    0x303433,
+    0x323635,
+    0x292E28,
+    0x323731,
+    0x414640,
+    0x4D524C,
+    0x525751,
+    0x4E534D,
+    0x464B45,
+    0x40453F,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x424741,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x454A44,
+    0x444943,
+    0x444943,
+    0x444943,
+    0x434842,
+    0x424741,
+    0x424741,
+    0x444641,
+    0x434540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x3C3D38,
+    0x3C3D38,
+    0x3C3D38,
+    0x3C3D38,
+    0x3C3D38,
+    0x3C3D38,
+    0x3C3D38,
+    0x3C3C3A,
+    0x313632,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x2F3332,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x313534,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x828280,
+    0x7A7A78,
+    0x6D6E69,
+    0x62635D,
+    0x5D5E56,
+    0x5F6154,
+    0x656759,
+    0x6A6D5A,
+    0x555942,
+    0x55593E,
+    0x555A3C,
+    0x555B39,
+    0x555B37,
+    0x555B35,
+    0x555C33,
+    0x595839,
+    0x655345,
+    0x624642,
+    0x543834,
+    0x492A27,
+    0x422320,
+    0x452220,
+    0x4C2424,
+    0x532728,
+    0x512325,
+    0x542225,
+    0x572025,
+    0x5A1F25,
+    0x5A1F25,
+    0x5C1D25,
+    0x5C1D25,
+    0x532226,
+    0x42332C,
+    0x484A3F,
+    0x5B5D52,
+    0x626459,
+    0x5E6055,
+    0x585A4F,
+    0x595B50,
+    0x5C5E53,
+    0x5B5D52,
+    0x57594E,
+    0x56584D,
+    0x5C5E53,
+    0x606257,
+    0x595B50,
+    0x46483D,
+    0x35362E,
+    0x212622,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x232726,
+    0x242827,
+    0x242827,
+    0x252928,
+    0x262A29,
+    0x272B2A,
+    0x282C2B,
+    0x282C2B,
+    0x232822,
+    0x2E332D,
+    0x3E433D,
+    0x4B504A,
+    0x4F544E,
+    0x4B504A,
+    0x424741,
+    0x3B403A,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x3E433D,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x414640,
+    0x4A4F49,
+    0x494E48,
+    0x474C46,
+    0x454A44,
+    0x434842,
+    0x414640,
+    0x40453F,
+    0x41433E,
+    0x41433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x454641,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464644,
+    0x3A3F3B,
+    0x3A3E3D,
+    0x3A3E3D,
+    0x3A3E3D,
+    0x3A3E3D,
+    0x3A3E3D,
+    0x3A3E3D,
+    0x3A3E3D,
+    0x383C3B,
+    0x383C3B,
+    0x383C3B,
+    0x383C3B,
+    0x383C3B,
+    0x383C3B,
+    0x383C3B,
+    0x383C3B,
+    0x323635,
+    0x323635,
+    0x323635,
+    0x323635,
+    0x323635,
+    0x323635,
+    0x323635,
+    0x323635,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x292D2C,
+    0x63B1BD,
+    0x58A5AF,
+    0x4D969F,
+    0x4B8E96,
+    0x508B8F,
+    0x518384,
+    0x4B7372,
+    0x46635E,
+    0x465A4F,
+    0x4F5748,
+    0x545543,
+    0x5B533E,
+    0x615138,
+    0x655035,
+    0x684E33,
+    0x684D38,
+    0x6F594E,
+    0x634E4B,
+    0x563E3C,
+    0x492F2E,
+    0x422625,
+    0x432324,
+    0x482627,
+    0x4F282B,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x4C2128,
+    0x463E3C,
+    0x424B46,
+    0x4E5752,
+    0x57605B,
+    0x5A635E,
+    0x57605B,
+    0x505954,
+    0x4B544F,
+    0x4F5853,
+    0x515A55,
+    0x545D58,
+    0x555E59,
+    0x535C57,
+    0x4D5651,
+    0x47504B,
+    0x454B47,
+    0x242621,
+    0x252621,
+    0x252621,
+    0x252621,
+    0x252621,
+    0x252621,
+    0x252621,
+    0x252621,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x353630,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x67B3C0,
+    0x5CA6B1,
+    0x5296A1,
+    0x508F98,
+    0x548B90,
+    0x558285,
+    0x4C7372,
+    0x48635E,
+    0x47584E,
+    0x4F5547,
+    0x555442,
+    0x5C513D,
+    0x614F37,
+    0x664E34,
+    0x6A4C32,
+    0x684C37,
+    0x664E44,
+    0x5B4643,
+    0x4F3735,
+    0x442A29,
+    0x3F2322,
+    0x422223,
+    0x492728,
+    0x50292C,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x4E2128,
+    0x3E3331,
+    0x3D3F3A,
+    0x4A4C47,
+    0x565853,
+    0x5C5E59,
+    0x5A5C57,
+    0x555752,
+    0x50524D,
+    0x535550,
+    0x555752,
+    0x585A55,
+    0x595B56,
+    0x575954,
+    0x51534E,
+    0x4B4D48,
+    0x474944,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x262722,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x363731,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x71B6C5,
+    0x64A8B5,
+    0x5999A5,
+    0x558F9A,
+    0x598B92,
+    0x588185,
+    0x506F71,
+    0x4B5F5D,
+    0x49544C,
+    0x515145,
+    0x575040,
+    0x5E4D3B,
+    0x644B35,
+    0x684A32,
+    0x6B4930,
+    0x694835,
+    0x594137,
+    0x4E3936,
+    0x452D2B,
+    0x3D2322,
+    0x3B1F1E,
+    0x412122,
+    0x4A2829,
+    0x522B2E,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x4F2026,
+    0x34211D,
+    0x362F27,
+    0x463F37,
+    0x544D45,
+    0x5D564E,
+    0x5E574F,
+    0x5B544C,
+    0x585149,
+    0x585149,
+    0x5A534B,
+    0x5D564E,
+    0x5E574F,
+    0x5C554D,
+    0x564F47,
+    0x504941,
+    0x4A453F,
+    0x292823,
+    0x282924,
+    0x282924,
+    0x282924,
+    0x282924,
+    0x282924,
+    0x282924,
+    0x282924,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x383933,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x7CB9CB,
+    0x70ABBB,
+    0x629AA9,
+    0x5F909E,
+    0x5F8A93,
+    0x5E7F86,
+    0x546D71,
+    0x4E5C5C,
+    0x4A4F49,
+    0x534C42,
+    0x5A4A3D,
+    0x614738,
+    0x654632,
+    0x69452F,
+    0x6D432D,
+    0x6A4332,
+    0x52372E,
+    0x46312E,
+    0x3E2624,
+    0x381E1D,
+    0x391D1C,
+    0x402021,
+    0x4B292A,
+    0x542D30,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x521F24,
+    0x30130F,
+    0x342017,
+    0x453128,
+    0x554138,
+    0x604C43,
+    0x634F46,
+    0x624E45,
+    0x5F4B42,
+    0x5E4A41,
+    0x604C43,
+    0x634F46,
+    0x655148,
+    0x624E45,
+    0x5D4940,
+    0x564239,
+    0x4E3F38,
+    0x2E2923,
+    0x2A2B26,
+    0x2A2B26,
+    0x2A2B26,
+    0x2A2B26,
+    0x2A2B26,
+    0x2A2B26,
+    0x2A2B26,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x3B3C36,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x373833,
+    0x373833,
+    0x373833,
+    0x373833,
+    0x373833,
+    0x373833,
+    0x373833,
+    0x373833,
+    0x87BED2,
+    0x7AAFC1,
+    0x6D9CAE,
+    0x6791A1,
+    0x658995,
+    0x627D86,
+    0x586970,
+    0x53585B,
+    0x4D4946,
+    0x55463F,
+    0x5B453A,
+    0x624235,
+    0x67402F,
+    0x6C3F2C,
+    0x6E3E2A,
+    0x6A3F2F,
+    0x53362E,
+    0x46312E,
+    0x3E2624,
+    0x381E1D,
+    0x391D1C,
+    0x402021,
+    0x4B292A,
+    0x542D30,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x551E23,
+    0x350C06,
+    0x3D190D,
+    0x4E2A1E,
+    0x5E3A2E,
+    0x694539,
+    0x6D493D,
+    0x6B473B,
+    0x694539,
+    0x674337,
+    0x6A463A,
+    0x6D493D,
+    0x6E4A3E,
+    0x6B473B,
+    0x664236,
+    0x603C30,
+    0x553A31,
+    0x342B24,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2D2E29,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x3E3F39,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x3A3B36,
+    0x93C1D8,
+    0x85B2C7,
+    0x769FB3,
+    0x6E91A4,
+    0x6D8997,
+    0x697B87,
+    0x5D6770,
+    0x56555A,
+    0x4E4443,
+    0x56413C,
+    0x5D3F37,
+    0x643C32,
+    0x6A3A2C,
+    0x6E3929,
+    0x713827,
+    0x6B3A2C,
+    0x5D3F37,
+    0x4E3936,
+    0x452D2B,
+    0x3D2322,
+    0x3B1F1E,
+    0x412122,
+    0x4A2829,
+    0x522B2E,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x561D23,
+    0x440F07,
+    0x4C1B0D,
+    0x5B2A1C,
+    0x6A392B,
+    0x724133,
+    0x744335,
+    0x714032,
+    0x6E3D2F,
+    0x6E3D2F,
+    0x703F31,
+    0x734234,
+    0x744335,
+    0x724133,
+    0x6C3B2D,
+    0x663527,
+    0x5A3429,
+    0x382D27,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x30312C,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x41423C,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x3D3E39,
+    0x9BC5DD,
+    0x8CB5CB,
+    0x7EA1B7,
+    0x7692A7,
+    0x738899,
+    0x6D7987,
+    0x60646F,
+    0x595259,
+    0x504041,
+    0x593D3A,
+    0x5E3B35,
+    0x653930,
+    0x6B372A,
+    0x6F3527,
+    0x733425,
+    0x6C362A,
+    0x6C4B44,
+    0x5B4643,
+    0x4F3735,
+    0x442A29,
+    0x3F2322,
+    0x422223,
+    0x492728,
+    0x50292C,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x591C21,
+    0x541A0F,
+    0x5D2212,
+    0x6A2F1F,
+    0x763B2B,
+    0x7B4030,
+    0x7A3F2F,
+    0x753A2A,
+    0x703525,
+    0x733828,
+    0x753A2A,
+    0x783D2D,
+    0x793E2E,
+    0x773C2C,
+    0x713626,
+    0x6B3020,
+    0x5C3023,
+    0x3D2E27,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x32332E,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x43443E,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0x3F403B,
+    0xA0C5DF,
+    0x92B6CE,
+    0x81A1B8,
+    0x7893A8,
+    0x76899A,
+    0x707988,
+    0x61636F,
+    0x5B5159,
+    0x513E40,
+    0x593B39,
+    0x603934,
+    0x67362F,
+    0x6D3429,
+    0x713326,
+    0x743224,
+    0x6D3429,
+    0x76554E,
+    0x634E4B,
+    0x563E3C,
+    0x492F2E,
+    0x422625,
+    0x432324,
+    0x482627,
+    0x4F282B,
+    0x4C2226,
+    0x4F2026,
+    0x512026,
+    0x531E26,
+    0x551D26,
+    0x561D26,
+    0x581C26,
+    0x591C21,
+    0x602016,
+    0x6A2818,
+    0x753323,
+    0x7F3D2D,
+    0x824030,
+    0x7F3D2D,
+    0x783626,
+    0x733121,
+    0x773525,
+    0x793727,
+    0x7C3A2A,
+    0x7D3B2B,
+    0x7B3929,
+    0x753323,
+    0x6F2D1D,
+    0x5F2E20,
+    0x3E2F28,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x33342F,
+    0x2E2F2A,
+    0x2D2E29,
+    0x2B2C27,
+    0x292A25,
+    0x272823,
+    0x252621,
+    0x23241F,
+    0x23221D,
+    0x232019,
+    0x2D2920,
+    0x3B372E,
+    0x48443B,
+    0x4F4B42,
+    0x4F4B42,
+    0x4B473E,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49463D,
+    0x45453B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x44463B,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404139,
+    0x44453F,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x96C1E3,
+    0x8DB6D6,
+    0x83A6C6,
+    0x7F9CBA,
+    0x7B93AD,
+    0x74839A,
+    0x64697D,
+    0x5B5464,
+    0x554550,
+    0x5D4249,
+    0x634044,
+    0x6A3E3F,
+    0x6F3C39,
+    0x743A36,
+    0x763934,
+    0x793832,
+    0x76312C,
+    0x752E2A,
+    0x722B27,
+    0x6E2723,
+    0x69221E,
+    0x641D19,
+    0x611A16,
+    0x5F1814,
+    0x67201C,
+    0x67201C,
+    0x67201C,
+    0x67201C,
+    0x67201C,
+    0x67201C,
+    0x67201C,
+    0x65221C,
+    0x5D2318,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x2E3025,
+    0x2B2D22,
+    0x27291E,
+    0x24261B,
+    0x25271C,
+    0x292B20,
+    0x2E3025,
+    0x333329,
+    0x38352C,
+    0x3A362D,
+    0x3D3930,
+    0x413D34,
+    0x454138,
+    0x48443B,
+    0x4B473E,
+    0x4D4940,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x96C3E4,
+    0x8CB7D7,
+    0x81A8C7,
+    0x7D9FBB,
+    0x7C96AF,
+    0x74849B,
+    0x636B7E,
+    0x595765,
+    0x50434D,
+    0x594046,
+    0x5E3E41,
+    0x653B3C,
+    0x6B3A36,
+    0x6F3833,
+    0x723731,
+    0x75362F,
+    0x73342F,
+    0x72312D,
+    0x6F2E2A,
+    0x6B2A26,
+    0x662521,
+    0x62211D,
+    0x5E1D19,
+    0x5C1B17,
+    0x601F1B,
+    0x601F1B,
+    0x601F1B,
+    0x601F1B,
+    0x601F1B,
+    0x601F1B,
+    0x601F1B,
+    0x5F201B,
+    0x5C2318,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x2D2F24,
+    0x2B2D22,
+    0x27291E,
+    0x25271C,
+    0x26281D,
+    0x2B2D22,
+    0x303227,
+    0x35352B,
+    0x3A372E,
+    0x3D3930,
+    0x3F3B32,
+    0x423E35,
+    0x464239,
+    0x49453C,
+    0x4B473E,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x94C7E6,
+    0x8ABBD9,
+    0x80ACC9,
+    0x7DA2BD,
+    0x7A9AB1,
+    0x72889D,
+    0x626F80,
+    0x585A67,
+    0x49424A,
+    0x523F43,
+    0x573D3E,
+    0x5E3B39,
+    0x643933,
+    0x683730,
+    0x6B362E,
+    0x6C352E,
+    0x6F3835,
+    0x6D3534,
+    0x6A3231,
+    0x662E2D,
+    0x612928,
+    0x5D2524,
+    0x592120,
+    0x571F1E,
+    0x551D1C,
+    0x551D1C,
+    0x551D1C,
+    0x551D1C,
+    0x551D1C,
+    0x551D1C,
+    0x551D1C,
+    0x551E1B,
+    0x5A241A,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x2D2F24,
+    0x2A2C21,
+    0x27291E,
+    0x26281D,
+    0x292B20,
+    0x2E3025,
+    0x35372C,
+    0x3A3A30,
+    0x3F3C33,
+    0x413D34,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4B473E,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x93CCE9,
+    0x88C0DB,
+    0x7EB1CC,
+    0x79A7BF,
+    0x789EB3,
+    0x708D9F,
+    0x5F7583,
+    0x555F69,
+    0x424348,
+    0x4A4041,
+    0x513D3C,
+    0x583B37,
+    0x5E3931,
+    0x62372E,
+    0x65362C,
+    0x65362E,
+    0x6A3E3B,
+    0x663C3D,
+    0x63393A,
+    0x5E3435,
+    0x592F30,
+    0x552B2C,
+    0x522829,
+    0x502627,
+    0x4A2021,
+    0x4A2021,
+    0x4A2021,
+    0x4A2021,
+    0x4A2021,
+    0x4A2021,
+    0x4A2021,
+    0x4D201D,
+    0x57251C,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x2C2E23,
+    0x2A2C21,
+    0x282A1F,
+    0x282A1F,
+    0x2C2E23,
+    0x33352A,
+    0x3A3C31,
+    0x404036,
+    0x46433A,
+    0x47433A,
+    0x47433A,
+    0x48443B,
+    0x49453C,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x90D2EC,
+    0x85C5DE,
+    0x7BB7CF,
+    0x76ADC2,
+    0x75A4B6,
+    0x6D92A2,
+    0x5D7985,
+    0x53646C,
+    0x40484B,
+    0x494544,
+    0x4E433F,
+    0x55413A,
+    0x5B3F34,
+    0x5F3D31,
+    0x623C2F,
+    0x613C33,
+    0x634442,
+    0x604347,
+    0x5C3F43,
+    0x583B3F,
+    0x53363A,
+    0x4F3236,
+    0x4C2F33,
+    0x4A2D31,
+    0x44272B,
+    0x44272B,
+    0x44272B,
+    0x44272B,
+    0x44272B,
+    0x44272B,
+    0x44272B,
+    0x492525,
+    0x55261E,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x2A2C21,
+    0x292B20,
+    0x292B20,
+    0x2A2C21,
+    0x303227,
+    0x383A2F,
+    0x414338,
+    0x47473D,
+    0x4C4940,
+    0x4D4940,
+    0x4C483F,
+    0x4C483F,
+    0x4B473E,
+    0x4A463D,
+    0x4A463D,
+    0x49453C,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x8ED6EE,
+    0x84CBE1,
+    0x79BBD1,
+    0x75B2C5,
+    0x74A9B9,
+    0x6C98A5,
+    0x5A7F88,
+    0x516A6F,
+    0x425252,
+    0x4A4F4B,
+    0x514C46,
+    0x584A41,
+    0x5C493B,
+    0x614738,
+    0x654536,
+    0x62463B,
+    0x5E4A49,
+    0x58494E,
+    0x55464B,
+    0x514247,
+    0x4C3D42,
+    0x48393E,
+    0x44353A,
+    0x423338,
+    0x403136,
+    0x403136,
+    0x403136,
+    0x403136,
+    0x403136,
+    0x403136,
+    0x403136,
+    0x472F2F,
+    0x532620,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x292B20,
+    0x292B20,
+    0x292B20,
+    0x2C2E23,
+    0x33352A,
+    0x3D3F34,
+    0x46483D,
+    0x4D4D43,
+    0x524F46,
+    0x534F46,
+    0x514D44,
+    0x4F4B42,
+    0x4D4940,
+    0x4B473E,
+    0x49453C,
+    0x48443B,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x8CDAF0,
+    0x82CFE3,
+    0x77C0D3,
+    0x73B6C7,
+    0x72ADBB,
+    0x6A9CA7,
+    0x58838A,
+    0x4F6E71,
+    0x465A59,
+    0x4E5752,
+    0x54554D,
+    0x5B5348,
+    0x615142,
+    0x65503F,
+    0x684E3D,
+    0x654F42,
+    0x594F50,
+    0x534E55,
+    0x504B52,
+    0x4C474E,
+    0x474249,
+    0x433E45,
+    0x3F3A41,
+    0x3D383F,
+    0x413C43,
+    0x413C43,
+    0x413C43,
+    0x413C43,
+    0x413C43,
+    0x413C43,
+    0x413C43,
+    0x4B383C,
+    0x502820,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x292B20,
+    0x282A1F,
+    0x2A2C21,
+    0x2E3025,
+    0x36382D,
+    0x404237,
+    0x4B4D42,
+    0x525248,
+    0x57544B,
+    0x57534A,
+    0x555148,
+    0x524E45,
+    0x4E4A41,
+    0x4B473E,
+    0x49453C,
+    0x48443B,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x8BDCF1,
+    0x82D0E4,
+    0x76C1D4,
+    0x73B8C8,
+    0x71AFBC,
+    0x699DA8,
+    0x58858B,
+    0x4E7072,
+    0x48615E,
+    0x515E57,
+    0x585B52,
+    0x5F594D,
+    0x635747,
+    0x675644,
+    0x6B5442,
+    0x675549,
+    0x575151,
+    0x505058,
+    0x4D4D55,
+    0x494951,
+    0x44444C,
+    0x404048,
+    0x3C3C44,
+    0x3B3B43,
+    0x42424A,
+    0x42424A,
+    0x42424A,
+    0x42424A,
+    0x42424A,
+    0x42424A,
+    0x42424A,
+    0x4B3F41,
+    0x502721,
+    0x5F291D,
+    0x673125,
+    0x6E382C,
+    0x733D31,
+    0x743E32,
+    0x733D31,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x713B2F,
+    0x673F35,
+    0x3D3125,
+    0x323429,
+    0x313328,
+    0x2F3126,
+    0x2C2E23,
+    0x2A2C21,
+    0x292B20,
+    0x282A1F,
+    0x282A1F,
+    0x282A1F,
+    0x2A2C21,
+    0x2E3025,
+    0x37392E,
+    0x424439,
+    0x4D4F44,
+    0x55554B,
+    0x5A574E,
+    0x59554C,
+    0x57534A,
+    0x534F46,
+    0x4F4B42,
+    0x4B473E,
+    0x49453C,
+    0x47433A,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x474539,
+    0x434337,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x424439,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x404237,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x3E4035,
+    0x5B9193,
+    0x578A8D,
+    0x508386,
+    0x4D7D81,
+    0x4D7D81,
+    0x568187,
+    0x60878E,
+    0x698B94,
+    0x496A73,
+    0x4A6671,
+    0x49616D,
+    0x465967,
+    0x405361,
+    0x3C4C5B,
+    0x384857,
+    0x354552,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x324A4C,
+    0x324A4C,
+    0x324A4C,
+    0x324A4C,
+    0x324A4C,
+    0x324A4C,
+    0x324A4C,
+    0x384848,
+    0x444643,
+    0x4D4844,
+    0x544D47,
+    0x595049,
+    0x5B5148,
+    0x5C4E43,
+    0x5A4A3D,
+    0x594637,
+    0x5B4432,
+    0x5E432E,
+    0x5F432D,
+    0x624229,
+    0x644227,
+    0x654226,
+    0x664124,
+    0x62422D,
+    0x49322C,
+    0x422F31,
+    0x3B2B2C,
+    0x362828,
+    0x332727,
+    0x332B29,
+    0x35302D,
+    0x353430,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x71A7A9,
+    0x6C9FA2,
+    0x619497,
+    0x59898D,
+    0x538387,
+    0x558086,
+    0x5A8188,
+    0x5F818A,
+    0x45666F,
+    0x47636E,
+    0x475F6B,
+    0x475A68,
+    0x435664,
+    0x425261,
+    0x40505F,
+    0x3E4E5B,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x2D4547,
+    0x2D4547,
+    0x2D4547,
+    0x2D4547,
+    0x2D4547,
+    0x2D4547,
+    0x2D4547,
+    0x314345,
+    0x3B3F3E,
+    0x464241,
+    0x4D4A45,
+    0x564E4B,
+    0x59524A,
+    0x5B5148,
+    0x5B4D42,
+    0x5C4A3C,
+    0x5B4839,
+    0x5E4735,
+    0x614631,
+    0x644530,
+    0x64462C,
+    0x67452C,
+    0x674529,
+    0x644531,
+    0x48312B,
+    0x402D2F,
+    0x39292A,
+    0x332525,
+    0x302424,
+    0x302826,
+    0x312C29,
+    0x31302C,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x80B6B8,
+    0x7BAEB1,
+    0x6FA2A5,
+    0x649498,
+    0x58888C,
+    0x547F85,
+    0x547B82,
+    0x557780,
+    0x496A73,
+    0x4B6772,
+    0x4B636F,
+    0x4B5E6C,
+    0x475A68,
+    0x465665,
+    0x445463,
+    0x42525F,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x253D3F,
+    0x253D3F,
+    0x253D3F,
+    0x253D3F,
+    0x253D3F,
+    0x253D3F,
+    0x253D3F,
+    0x293B3D,
+    0x2E383A,
+    0x393A3E,
+    0x424443,
+    0x4D4C4A,
+    0x56524F,
+    0x5B544E,
+    0x5C534C,
+    0x5E5148,
+    0x5F4F42,
+    0x614E3F,
+    0x634E3D,
+    0x664D39,
+    0x674C37,
+    0x684C36,
+    0x6A4C34,
+    0x674C3B,
+    0x45302B,
+    0x3F2C2E,
+    0x372728,
+    0x302222,
+    0x2C2020,
+    0x2B2321,
+    0x2B2623,
+    0x2B2A26,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x73A9AB,
+    0x70A3A6,
+    0x699C9F,
+    0x629296,
+    0x5A8A8E,
+    0x578288,
+    0x557C83,
+    0x567881,
+    0x5D7E87,
+    0x5C7883,
+    0x59717D,
+    0x536674,
+    0x4A5D6B,
+    0x435362,
+    0x3C4C5B,
+    0x394956,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x1F3739,
+    0x1F3739,
+    0x1F3739,
+    0x1F3739,
+    0x1F3739,
+    0x1F3739,
+    0x1F3739,
+    0x223539,
+    0x233036,
+    0x2C353C,
+    0x383F45,
+    0x454A4E,
+    0x4E5255,
+    0x565656,
+    0x5A5653,
+    0x5D5650,
+    0x5D544D,
+    0x60534A,
+    0x635346,
+    0x655244,
+    0x655241,
+    0x685141,
+    0x68523D,
+    0x685143,
+    0x473430,
+    0x412E30,
+    0x372728,
+    0x302222,
+    0x2A1E1E,
+    0x271F1D,
+    0x27221F,
+    0x262521,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x508688,
+    0x54878A,
+    0x56898C,
+    0x5A8A8E,
+    0x5A8A8E,
+    0x5D888E,
+    0x5F868D,
+    0x61838C,
+    0x75969F,
+    0x728E99,
+    0x69818D,
+    0x5C6F7D,
+    0x4C5F6D,
+    0x3E4E5D,
+    0x324251,
+    0x2C3C49,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x1C3436,
+    0x1C3436,
+    0x1C3436,
+    0x1C3436,
+    0x1C3436,
+    0x1C3436,
+    0x1C3436,
+    0x1E3338,
+    0x1C2E38,
+    0x253340,
+    0x303E47,
+    0x3E4852,
+    0x465157,
+    0x4D545A,
+    0x515558,
+    0x545454,
+    0x575654,
+    0x5A5551,
+    0x5D544D,
+    0x60534A,
+    0x615348,
+    0x635346,
+    0x645244,
+    0x645248,
+    0x4C3A38,
+    0x473436,
+    0x3C2C2D,
+    0x332525,
+    0x2C2020,
+    0x28201E,
+    0x27221F,
+    0x252420,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x376D6F,
+    0x407376,
+    0x4A7D80,
+    0x56868A,
+    0x5E8E92,
+    0x669197,
+    0x6A9198,
+    0x6D8F98,
+    0x7E9FA8,
+    0x7A96A1,
+    0x708894,
+    0x627583,
+    0x506371,
+    0x415160,
+    0x344453,
+    0x2D3D4A,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x1D3537,
+    0x1D3537,
+    0x1D3537,
+    0x1D3537,
+    0x1D3537,
+    0x1D3537,
+    0x1D3537,
+    0x1D343A,
+    0x1C323F,
+    0x213647,
+    0x2C3F4E,
+    0x364856,
+    0x3E4E5B,
+    0x435059,
+    0x454F58,
+    0x464D53,
+    0x4F5356,
+    0x525252,
+    0x535250,
+    0x56514D,
+    0x58514B,
+    0x5A4F49,
+    0x5A5046,
+    0x5D4E47,
+    0x544444,
+    0x513E40,
+    0x453536,
+    0x3A2C2C,
+    0x312525,
+    0x2C2422,
+    0x2A2522,
+    0x282723,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x386E70,
+    0x427578,
+    0x4F8285,
+    0x5E8E92,
+    0x67979B,
+    0x6E999F,
+    0x71989F,
+    0x73959E,
+    0x73949D,
+    0x718D98,
+    0x6C8490,
+    0x637684,
+    0x576A78,
+    0x4E5E6D,
+    0x455564,
+    0x40505D,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x21393B,
+    0x21393B,
+    0x21393B,
+    0x21393B,
+    0x21393B,
+    0x21393B,
+    0x21393B,
+    0x203940,
+    0x1E3847,
+    0x233C52,
+    0x2A4455,
+    0x33485B,
+    0x364C5A,
+    0x394B59,
+    0x394752,
+    0x3A444D,
+    0x454E55,
+    0x484D51,
+    0x4B4C4E,
+    0x4D4B4C,
+    0x4D4C48,
+    0x504B48,
+    0x504B45,
+    0x534947,
+    0x5F4F4F,
+    0x5A4749,
+    0x4E3E3F,
+    0x433535,
+    0x392D2D,
+    0x322A28,
+    0x2F2A27,
+    0x2C2B27,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x43797B,
+    0x4D8083,
+    0x5A8D90,
+    0x68989C,
+    0x6F9FA3,
+    0x739EA4,
+    0x749BA2,
+    0x74969F,
+    0x63848D,
+    0x64808B,
+    0x647C88,
+    0x627583,
+    0x5D707E,
+    0x5A6A79,
+    0x566675,
+    0x546471,
+    0x354A4F,
+    0x324A4C,
+    0x31494B,
+    0x2F4749,
+    0x2C4446,
+    0x2A4244,
+    0x284042,
+    0x273F41,
+    0x243C3E,
+    0x243C3E,
+    0x243C3E,
+    0x243C3E,
+    0x243C3E,
+    0x243C3E,
+    0x243C3E,
+    0x233C43,
+    0x223D4E,
+    0x244056,
+    0x2B465B,
+    0x30495D,
+    0x334A5C,
+    0x344756,
+    0x314351,
+    0x313F4A,
+    0x414B54,
+    0x434A50,
+    0x454A4E,
+    0x48494B,
+    0x494949,
+    0x4A4947,
+    0x4C4845,
+    0x4F4745,
+    0x645656,
+    0x614E50,
+    0x544445,
+    0x483A3A,
+    0x3D3131,
+    0x372F2D,
+    0x332E2B,
+    0x302F2B,
+    0x2D2F2A,
+    0x272E27,
+    0x202A22,
+    0x1E2B22,
+    0x233329,
+    0x2F4036,
+    0x3C5045,
+    0x4A574D,
+    0x505245,
+    0x534F43,
+    0x514D41,
+    0x4F4B3F,
+    0x4C483C,
+    0x4A463A,
+    0x494539,
+    0x484438,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x4A463A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444035,
+    0x423E33,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x4B6B7A,
+    0x496978,
+    0x496978,
+    0x4F6F7E,
+    0x5A7A89,
+    0x688897,
+    0x7393A2,
+    0x7999A8,
+    0x648493,
+    0x5C7C8B,
+    0x577786,
+    0x597988,
+    0x5E7E8D,
+    0x597988,
+    0x4B6B7A,
+    0x405C68,
+    0x3D545A,
+    0x3D5054,
+    0x394C50,
+    0x33464A,
+    0x2D4044,
+    0x273A3E,
+    0x23363A,
+    0x203337,
+    0x203337,
+    0x203337,
+    0x203337,
+    0x203337,
+    0x203337,
+    0x203337,
+    0x203337,
+    0x213337,
+    0x26353A,
+    0x28353B,
+    0x2A373D,
+    0x2C393F,
+    0x2E3B41,
+    0x313E44,
+    0x323F45,
+    0x334046,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3D484C,
+    0x3C4846,
+    0x3D4844,
+    0x3D4844,
+    0x3D4844,
+    0x3D4844,
+    0x3D4844,
+    0x3D4844,
+    0x3D4844,
+    0x2B3632,
+    0x27322E,
+    0x232E2A,
+    0x212C28,
+    0x26312D,
+    0x2F3A36,
+    0x3A4541,
+    0x444A46,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x454138,
+    0x454138,
+    0x454138,
+    0x454138,
+    0x454138,
+    0x454138,
+    0x454138,
+    0x474038,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x60808F,
+    0x557584,
+    0x496978,
+    0x446473,
+    0x486877,
+    0x50707F,
+    0x567685,
+    0x587887,
+    0x648493,
+    0x5D7D8C,
+    0x567685,
+    0x577786,
+    0x5A7A89,
+    0x547483,
+    0x446473,
+    0x395561,
+    0x3A5157,
+    0x3B4E52,
+    0x374A4E,
+    0x324549,
+    0x2C3F43,
+    0x273A3E,
+    0x23363A,
+    0x213438,
+    0x213438,
+    0x213438,
+    0x213438,
+    0x213438,
+    0x213438,
+    0x213438,
+    0x213438,
+    0x223438,
+    0x27363B,
+    0x29363C,
+    0x2B383E,
+    0x2D3A40,
+    0x303D43,
+    0x323F45,
+    0x334046,
+    0x344147,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x394448,
+    0x3B4745,
+    0x3C4743,
+    0x3C4743,
+    0x3C4743,
+    0x3C4743,
+    0x3C4743,
+    0x3C4743,
+    0x3C4743,
+    0x3B4642,
+    0x36413D,
+    0x2F3A36,
+    0x293430,
+    0x28332F,
+    0x2C3733,
+    0x323D39,
+    0x393F3B,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x464239,
+    0x464239,
+    0x464239,
+    0x464239,
+    0x464239,
+    0x464239,
+    0x464239,
+    0x484139,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x88A8B7,
+    0x7696A5,
+    0x628291,
+    0x567685,
+    0x537382,
+    0x50707F,
+    0x476776,
+    0x3E5E6D,
+    0x638392,
+    0x5B7B8A,
+    0x537382,
+    0x527281,
+    0x537382,
+    0x4B6B7A,
+    0x3A5A69,
+    0x2E4A56,
+    0x354C52,
+    0x374A4E,
+    0x33464A,
+    0x2F4246,
+    0x2B3E42,
+    0x26393D,
+    0x23363A,
+    0x213438,
+    0x23363A,
+    0x23363A,
+    0x23363A,
+    0x23363A,
+    0x23363A,
+    0x23363A,
+    0x23363A,
+    0x24363A,
+    0x29383D,
+    0x2B383E,
+    0x2D3A40,
+    0x2F3C42,
+    0x323F45,
+    0x344147,
+    0x354248,
+    0x364349,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x343F43,
+    0x394543,
+    0x3A4541,
+    0x3A4541,
+    0x3A4541,
+    0x3A4541,
+    0x3A4541,
+    0x3A4541,
+    0x3A4541,
+    0x495450,
+    0x444F4B,
+    0x3C4743,
+    0x343F3B,
+    0x2F3A36,
+    0x2D3834,
+    0x2E3935,
+    0x323834,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x48443B,
+    0x4A433B,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xB7D7E6,
+    0xA9C9D8,
+    0x9BBBCA,
+    0x97B7C6,
+    0x95B5C4,
+    0x84A4B3,
+    0x638392,
+    0x486877,
+    0x5D7D8C,
+    0x557584,
+    0x4C6C7B,
+    0x4A6A79,
+    0x4A6A79,
+    0x426271,
+    0x315160,
+    0x24404C,
+    0x2F464C,
+    0x314448,
+    0x2F4246,
+    0x2C3F43,
+    0x293C40,
+    0x26393D,
+    0x24373B,
+    0x223539,
+    0x26393D,
+    0x26393D,
+    0x26393D,
+    0x26393D,
+    0x26393D,
+    0x26393D,
+    0x26393D,
+    0x27393D,
+    0x2C3B40,
+    0x2E3B41,
+    0x303D43,
+    0x323F45,
+    0x344147,
+    0x364349,
+    0x38454B,
+    0x39464C,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x303B3F,
+    0x364240,
+    0x37423E,
+    0x37423E,
+    0x37423E,
+    0x37423E,
+    0x37423E,
+    0x37423E,
+    0x37423E,
+    0x444F4B,
+    0x414C48,
+    0x3E4945,
+    0x3A4541,
+    0x37423E,
+    0x35403C,
+    0x35403C,
+    0x383E3A,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4C453D,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xDCFCFF,
+    0xD2F2FF,
+    0xCEEEFD,
+    0xD6F6FF,
+    0xDAFAFF,
+    0xC1E1F0,
+    0x8DADBC,
+    0x618190,
+    0x517180,
+    0x496978,
+    0x416170,
+    0x416170,
+    0x436372,
+    0x3C5C6B,
+    0x2B4B5A,
+    0x203C48,
+    0x283F45,
+    0x2B3E42,
+    0x2A3D41,
+    0x283B3F,
+    0x273A3E,
+    0x25383C,
+    0x24373B,
+    0x24373B,
+    0x283B3F,
+    0x283B3F,
+    0x283B3F,
+    0x283B3F,
+    0x283B3F,
+    0x283B3F,
+    0x283B3F,
+    0x293B3F,
+    0x2F3E43,
+    0x313E44,
+    0x323F45,
+    0x354248,
+    0x37444A,
+    0x39464C,
+    0x3B484E,
+    0x3C494F,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x2E3B41,
+    0x303B3F,
+    0x333F3D,
+    0x343F3B,
+    0x343F3B,
+    0x343F3B,
+    0x343F3B,
+    0x343F3B,
+    0x343F3B,
+    0x343F3B,
+    0x313C38,
+    0x333E3A,
+    0x37423E,
+    0x3B4642,
+    0x3E4945,
+    0x3F4A46,
+    0x404B47,
+    0x434945,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x4D4940,
+    0x4D4940,
+    0x4D4940,
+    0x4D4940,
+    0x4D4940,
+    0x4D4940,
+    0x4D4940,
+    0x4F4840,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE7FFFF,
+    0xD5F5FF,
+    0xC8E8F7,
+    0xCEEEFD,
+    0xD7F7FF,
+    0xC2E2F1,
+    0x8DADBC,
+    0x5E7E8D,
+    0x40606F,
+    0x395968,
+    0x345463,
+    0x375766,
+    0x3D5D6C,
+    0x395968,
+    0x2B4B5A,
+    0x213D49,
+    0x22393F,
+    0x25383C,
+    0x25383C,
+    0x25383C,
+    0x25383C,
+    0x25383C,
+    0x25383C,
+    0x25383C,
+    0x2B3E42,
+    0x2B3E42,
+    0x2B3E42,
+    0x2B3E42,
+    0x2B3E42,
+    0x2B3E42,
+    0x2B3E42,
+    0x2C3E42,
+    0x324146,
+    0x334046,
+    0x354248,
+    0x37444A,
+    0x3A474D,
+    0x3C494F,
+    0x3D4A50,
+    0x3E4B51,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x323F45,
+    0x343F43,
+    0x303C3A,
+    0x313C38,
+    0x313C38,
+    0x313C38,
+    0x313C38,
+    0x313C38,
+    0x313C38,
+    0x313C38,
+    0x242F2B,
+    0x293430,
+    0x313C38,
+    0x394440,
+    0x3E4945,
+    0x404B47,
+    0x3F4A46,
+    0x414743,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x504C43,
+    0x504C43,
+    0x504C43,
+    0x504C43,
+    0x504C43,
+    0x504C43,
+    0x504C43,
+    0x524B43,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xDFFFFF,
+    0xB5D5E4,
+    0x88A8B7,
+    0x7A9AA9,
+    0x82A2B1,
+    0x7A9AA9,
+    0x567685,
+    0x325261,
+    0x2F4F5E,
+    0x2A4A59,
+    0x284857,
+    0x2F4F5E,
+    0x395968,
+    0x395968,
+    0x2E4E5D,
+    0x26424E,
+    0x1D343A,
+    0x213438,
+    0x213438,
+    0x223539,
+    0x23363A,
+    0x24373B,
+    0x25383C,
+    0x25383C,
+    0x2D4044,
+    0x2D4044,
+    0x2D4044,
+    0x2D4044,
+    0x2D4044,
+    0x2D4044,
+    0x2D4044,
+    0x2E4044,
+    0x344348,
+    0x354248,
+    0x37444A,
+    0x39464C,
+    0x3C494F,
+    0x3E4B51,
+    0x3F4C52,
+    0x404D53,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x37444A,
+    0x394448,
+    0x2E3A38,
+    0x2F3A36,
+    0x2F3A36,
+    0x2F3A36,
+    0x2F3A36,
+    0x2F3A36,
+    0x2F3A36,
+    0x2F3A36,
+    0x26312D,
+    0x2B3632,
+    0x333E3A,
+    0x38433F,
+    0x394440,
+    0x36413D,
+    0x303B37,
+    0x2F3531,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x524E45,
+    0x524E45,
+    0x524E45,
+    0x524E45,
+    0x524E45,
+    0x524E45,
+    0x524E45,
+    0x544D45,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xD2F2FF,
+    0x92B2C1,
+    0x486877,
+    0x264655,
+    0x2B4B5A,
+    0x30505F,
+    0x1D3D4C,
+    0x042433,
+    0x254554,
+    0x214150,
+    0x214150,
+    0x2B4B5A,
+    0x375766,
+    0x3A5A69,
+    0x315160,
+    0x294551,
+    0x1B3238,
+    0x1E3135,
+    0x203337,
+    0x213438,
+    0x23363A,
+    0x24373B,
+    0x25383C,
+    0x26393D,
+    0x2E4145,
+    0x2E4145,
+    0x2E4145,
+    0x2E4145,
+    0x2E4145,
+    0x2E4145,
+    0x2E4145,
+    0x2F4145,
+    0x354449,
+    0x364349,
+    0x38454B,
+    0x3A474D,
+    0x3D4A50,
+    0x3F4C52,
+    0x404D53,
+    0x414E54,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3B484E,
+    0x3D484C,
+    0x2D3937,
+    0x2E3935,
+    0x2E3935,
+    0x2E3935,
+    0x2E3935,
+    0x2E3935,
+    0x2E3935,
+    0x2E3935,
+    0x2F3A36,
+    0x323D39,
+    0x37423E,
+    0x38433F,
+    0x343F3B,
+    0x2B3632,
+    0x202B27,
+    0x1C221E,
+    0x3F3F37,
+    0x433F36,
+    0x454138,
+    0x47433A,
+    0x49453C,
+    0x4B473E,
+    0x4D4940,
+    0x4E4A41,
+    0x534F46,
+    0x534F46,
+    0x534F46,
+    0x534F46,
+    0x534F46,
+    0x534F46,
+    0x534F46,
+    0x554E46,
+    0x4C463A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x4D453A,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x484438,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x464236,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xD7F3FF,
+    0x96B2D9,
+    0x4B678C,
+    0x294668,
+    0x304D6D,
+    0x395773,
+    0x2B4963,
+    0x153449,
+    0x2B4A5C,
+    0x2C4C59,
+    0x2E4E59,
+    0x305158,
+    0x325358,
+    0x345658,
+    0x365859,
+    0x39585B,
+    0x2B4449,
+    0x2B424A,
+    0x2A4149,
+    0x273E46,
+    0x253C44,
+    0x233A42,
+    0x213840,
+    0x20373F,
+    0x283F47,
+    0x283F47,
+    0x283F47,
+    0x283F47,
+    0x283F47,
+    0x283F47,
+    0x283F47,
+    0x2A3E45,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x364646,
+    0x364445,
+    0x344243,
+    0x324041,
+    0x303E3F,
+    0x2E3C3D,
+    0x2C3A3B,
+    0x2B393A,
+    0x2F3D3E,
+    0x2F3D3E,
+    0x2D3B3C,
+    0x2B393A,
+    0x283637,
+    0x263435,
+    0x253334,
+    0x263232,
+    0x373D3D,
+    0x393D3C,
+    0x3C403F,
+    0x404443,
+    0x444847,
+    0x474B4A,
+    0x4A4E4D,
+    0x4C504F,
+    0x464A49,
+    0x464A49,
+    0x484C4B,
+    0x4A4E4D,
+    0x4D5150,
+    0x4F5352,
+    0x505453,
+    0x535552,
+    0x55584F,
+    0x57594E,
+    0x585A4F,
+    0x5A5C51,
+    0x5D5F54,
+    0x5F6156,
+    0x616358,
+    0x616358,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE3FFFF,
+    0xA5C1E8,
+    0x5C789D,
+    0x3A5779,
+    0x3E5B7B,
+    0x466480,
+    0x385670,
+    0x244358,
+    0x304F61,
+    0x31515E,
+    0x33535E,
+    0x35565D,
+    0x37585D,
+    0x395B5D,
+    0x3B5D5E,
+    0x3E5D60,
+    0x2C454A,
+    0x2C434B,
+    0x2B424A,
+    0x294048,
+    0x263D45,
+    0x243B43,
+    0x223941,
+    0x213840,
+    0x294048,
+    0x294048,
+    0x294048,
+    0x294048,
+    0x294048,
+    0x294048,
+    0x294048,
+    0x2B3F46,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x374747,
+    0x374546,
+    0x354344,
+    0x334142,
+    0x313F40,
+    0x2F3D3E,
+    0x2D3B3C,
+    0x2C3A3B,
+    0x303E3F,
+    0x303E3F,
+    0x2E3C3D,
+    0x2C3A3B,
+    0x293738,
+    0x273536,
+    0x263435,
+    0x273333,
+    0x333939,
+    0x363A39,
+    0x383C3B,
+    0x3B3F3E,
+    0x3E4241,
+    0x414544,
+    0x444847,
+    0x454948,
+    0x434746,
+    0x444847,
+    0x464A49,
+    0x484C4B,
+    0x4A4E4D,
+    0x4D5150,
+    0x4E5251,
+    0x515350,
+    0x53564D,
+    0x54564B,
+    0x56584D,
+    0x585A4F,
+    0x5B5D52,
+    0x5D5F54,
+    0x5E6055,
+    0x5F6156,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE7FFFF,
+    0xB6D2F9,
+    0x738FB4,
+    0x506D8F,
+    0x506D8D,
+    0x54728E,
+    0x486680,
+    0x36556A,
+    0x385769,
+    0x395966,
+    0x3A5A65,
+    0x3C5D64,
+    0x3F6065,
+    0x416365,
+    0x426465,
+    0x456467,
+    0x2E474C,
+    0x2E454D,
+    0x2D444C,
+    0x2B424A,
+    0x283F47,
+    0x263D45,
+    0x243B43,
+    0x233A42,
+    0x2B424A,
+    0x2B424A,
+    0x2B424A,
+    0x2B424A,
+    0x2B424A,
+    0x2B424A,
+    0x2B424A,
+    0x2D4148,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x394949,
+    0x394748,
+    0x374546,
+    0x354344,
+    0x334142,
+    0x313F40,
+    0x2F3D3E,
+    0x2E3C3D,
+    0x324041,
+    0x324041,
+    0x303E3F,
+    0x2E3C3D,
+    0x2B393A,
+    0x293738,
+    0x283637,
+    0x293535,
+    0x2F3535,
+    0x303433,
+    0x323635,
+    0x343837,
+    0x363A39,
+    0x383C3B,
+    0x3A3E3D,
+    0x3B3F3E,
+    0x3F4342,
+    0x404443,
+    0x424645,
+    0x444847,
+    0x464A49,
+    0x494D4C,
+    0x4A4E4D,
+    0x4D4F4C,
+    0x4F5249,
+    0x505247,
+    0x525449,
+    0x54564B,
+    0x57594E,
+    0x595B50,
+    0x5A5C51,
+    0x5B5D52,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE7FFFF,
+    0xBEDAFF,
+    0x829EC3,
+    0x5F7C9E,
+    0x597696,
+    0x597793,
+    0x4E6C86,
+    0x405F74,
+    0x3E5D6F,
+    0x3F5F6C,
+    0x41616C,
+    0x43646B,
+    0x45666B,
+    0x47696B,
+    0x496B6C,
+    0x4C6B6E,
+    0x314A4F,
+    0x314850,
+    0x2F464E,
+    0x2D444C,
+    0x2B424A,
+    0x294048,
+    0x273E46,
+    0x263D45,
+    0x2E454D,
+    0x2E454D,
+    0x2E454D,
+    0x2E454D,
+    0x2E454D,
+    0x2E454D,
+    0x2E454D,
+    0x30444B,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x3C4C4C,
+    0x3C4A4B,
+    0x3A4849,
+    0x384647,
+    0x364445,
+    0x334142,
+    0x324041,
+    0x313F40,
+    0x354344,
+    0x344243,
+    0x334142,
+    0x303E3F,
+    0x2E3C3D,
+    0x2C3A3B,
+    0x2A3839,
+    0x2B3737,
+    0x2C3232,
+    0x2D3130,
+    0x2D3130,
+    0x2E3231,
+    0x2F3332,
+    0x303433,
+    0x303433,
+    0x313534,
+    0x3A3E3D,
+    0x3B3F3E,
+    0x3D4140,
+    0x3F4342,
+    0x414544,
+    0x434746,
+    0x454948,
+    0x484A47,
+    0x494C43,
+    0x4B4D42,
+    0x4D4F44,
+    0x4F5146,
+    0x515348,
+    0x54564B,
+    0x55574C,
+    0x56584D,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE6FFFF,
+    0xBEDAFF,
+    0x8AA6CB,
+    0x6784A6,
+    0x5A7797,
+    0x55738F,
+    0x4C6A84,
+    0x426176,
+    0x416072,
+    0x42626F,
+    0x44646F,
+    0x46676E,
+    0x48696E,
+    0x4A6C6E,
+    0x4C6E6F,
+    0x4F6E71,
+    0x344D52,
+    0x344B53,
+    0x324951,
+    0x30474F,
+    0x2E454D,
+    0x2B424A,
+    0x2A4149,
+    0x294048,
+    0x314850,
+    0x314850,
+    0x314850,
+    0x314850,
+    0x314850,
+    0x314850,
+    0x314850,
+    0x33474E,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x3E4E4E,
+    0x3F4D4E,
+    0x3D4B4C,
+    0x3B494A,
+    0x384647,
+    0x364445,
+    0x354344,
+    0x344243,
+    0x384647,
+    0x374546,
+    0x354344,
+    0x334142,
+    0x313F40,
+    0x2F3D3E,
+    0x2D3B3C,
+    0x2E3A3A,
+    0x2D3333,
+    0x2D3130,
+    0x2D3130,
+    0x2C302F,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x353938,
+    0x353938,
+    0x373B3A,
+    0x393D3C,
+    0x3C403F,
+    0x3E4241,
+    0x3F4342,
+    0x424441,
+    0x44473E,
+    0x46483D,
+    0x47493E,
+    0x494B40,
+    0x4C4E43,
+    0x4E5045,
+    0x505247,
+    0x505247,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xDFFBFF,
+    0xBFDBFF,
+    0x92AED3,
+    0x6E8BAD,
+    0x5B7898,
+    0x52708C,
+    0x4A6882,
+    0x446378,
+    0x405F71,
+    0x41616E,
+    0x42626D,
+    0x44656C,
+    0x47686D,
+    0x496B6D,
+    0x4B6D6E,
+    0x4D6C6F,
+    0x364F54,
+    0x364D55,
+    0x354C54,
+    0x334A52,
+    0x30474F,
+    0x2E454D,
+    0x2C434B,
+    0x2C434B,
+    0x334A52,
+    0x334A52,
+    0x334A52,
+    0x334A52,
+    0x334A52,
+    0x334A52,
+    0x334A52,
+    0x354950,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x415151,
+    0x414F50,
+    0x3F4D4E,
+    0x3D4B4C,
+    0x3B494A,
+    0x394748,
+    0x374546,
+    0x364445,
+    0x3B494A,
+    0x3A4849,
+    0x384647,
+    0x364445,
+    0x334142,
+    0x313F40,
+    0x303E3F,
+    0x313D3D,
+    0x323838,
+    0x323635,
+    0x303433,
+    0x2E3231,
+    0x2C302F,
+    0x2A2E2D,
+    0x282C2B,
+    0x272B2A,
+    0x2F3332,
+    0x303433,
+    0x323635,
+    0x343837,
+    0x363A39,
+    0x393D3C,
+    0x3A3E3D,
+    0x3D3F3C,
+    0x3E4138,
+    0x404237,
+    0x424439,
+    0x44463B,
+    0x46483D,
+    0x494B40,
+    0x4A4C41,
+    0x4B4D42,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xDFFBFF,
+    0xC5E1FF,
+    0x9DB9DE,
+    0x7996B8,
+    0x617E9E,
+    0x55738F,
+    0x4E6C86,
+    0x4B6A7F,
+    0x3C5B6D,
+    0x3D5D6A,
+    0x3F5F6A,
+    0x416269,
+    0x436469,
+    0x456769,
+    0x47696A,
+    0x4A696C,
+    0x385156,
+    0x384F57,
+    0x374E56,
+    0x354C54,
+    0x324951,
+    0x30474F,
+    0x2E454D,
+    0x2E454D,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x435353,
+    0x435152,
+    0x414F50,
+    0x3F4D4E,
+    0x3D4B4C,
+    0x3B494A,
+    0x394748,
+    0x384647,
+    0x3D4B4C,
+    0x3C4A4B,
+    0x3A4849,
+    0x384647,
+    0x354344,
+    0x334142,
+    0x324041,
+    0x333F3F,
+    0x383E3E,
+    0x383C3B,
+    0x353938,
+    0x323635,
+    0x2F3332,
+    0x2C302F,
+    0x2A2E2D,
+    0x282C2B,
+    0x2B2F2E,
+    0x2C302F,
+    0x2E3231,
+    0x303433,
+    0x323635,
+    0x353938,
+    0x363A39,
+    0x393B38,
+    0x3A3D34,
+    0x3C3E33,
+    0x3E4035,
+    0x404237,
+    0x424439,
+    0x45473C,
+    0x46483D,
+    0x47493E,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE3FFFF,
+    0xCBE7FF,
+    0xA7C3E8,
+    0x83A0C2,
+    0x6885A5,
+    0x5A7894,
+    0x54728C,
+    0x527186,
+    0x39586A,
+    0x3A5A67,
+    0x3C5C67,
+    0x3E5F66,
+    0x406166,
+    0x426466,
+    0x446667,
+    0x476669,
+    0x395257,
+    0x395058,
+    0x384F57,
+    0x364D55,
+    0x334A52,
+    0x314850,
+    0x2F464E,
+    0x2F464E,
+    0x364D55,
+    0x364D55,
+    0x364D55,
+    0x364D55,
+    0x364D55,
+    0x364D55,
+    0x364D55,
+    0x384C53,
+    0x334849,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x344847,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394B4B,
+    0x445454,
+    0x445253,
+    0x435152,
+    0x404E4F,
+    0x3E4C4D,
+    0x3C4A4B,
+    0x3A4849,
+    0x394748,
+    0x3E4C4D,
+    0x3D4B4C,
+    0x3B494A,
+    0x394748,
+    0x374546,
+    0x344243,
+    0x334142,
+    0x344040,
+    0x3C4242,
+    0x3C403F,
+    0x393D3C,
+    0x353938,
+    0x323635,
+    0x2E3231,
+    0x2B2F2E,
+    0x2A2E2D,
+    0x292D2C,
+    0x2A2E2D,
+    0x2C302F,
+    0x2E3231,
+    0x303433,
+    0x323635,
+    0x343837,
+    0x373936,
+    0x383B32,
+    0x3A3C31,
+    0x3C3E33,
+    0x3E4035,
+    0x404237,
+    0x424439,
+    0x44463B,
+    0x45473C,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4C4E43,
+    0x4D4D43,
+    0x504A3E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x51493E,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4F473C,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x4B4338,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x444034,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x423E32,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x413D31,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0xE0FFFF,
+    0xC2E7F9,
+    0x98BDCF,
+    0x759AAC,
+    0x608597,
+    0x557A8C,
+    0x4D7284,
+    0x476C7E,
+    0x3C6173,
+    0x3A5F71,
+    0x395E70,
+    0x395E70,
+    0x3D6274,
+    0x44697B,
+    0x4B7082,
+    0x537483,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x384C4B,
+    0x394C4A,
+    0x334340,
+    0x33423D,
+    0x31403B,
+    0x2F3E39,
+    0x2C3B36,
+    0x2A3934,
+    0x293833,
+    0x283732,
+    0x2C3B36,
+    0x2D3C37,
+    0x2E3D38,
+    0x2F3E39,
+    0x31403B,
+    0x32413C,
+    0x34433E,
+    0x36423E,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x434746,
+    0x444847,
+    0x454948,
+    0x484C4B,
+    0x4A4E4D,
+    0x4C504F,
+    0x4E5251,
+    0x515350,
+    0x43463D,
+    0x45473C,
+    0x46483D,
+    0x484A3F,
+    0x4B4D42,
+    0x4D4F44,
+    0x4F5146,
+    0x505247,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x413D34,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xDFFFFF,
+    0xC4E9FB,
+    0x9DC2D4,
+    0x7A9FB1,
+    0x63889A,
+    0x567B8D,
+    0x4E7385,
+    0x4A6F81,
+    0x3E6375,
+    0x3C6173,
+    0x395E70,
+    0x395E70,
+    0x3C6173,
+    0x43687A,
+    0x4A6F81,
+    0x517281,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x394D4C,
+    0x394D4C,
+    0x394D4C,
+    0x394D4C,
+    0x394D4C,
+    0x394D4C,
+    0x394D4C,
+    0x3A4D4B,
+    0x354542,
+    0x35443F,
+    0x33423D,
+    0x31403B,
+    0x2F3E39,
+    0x2C3B36,
+    0x2B3A35,
+    0x2A3934,
+    0x2B3A35,
+    0x2B3A35,
+    0x2C3B36,
+    0x2D3C37,
+    0x2E3D38,
+    0x2F3E39,
+    0x2F3E39,
+    0x323E3A,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x3D4140,
+    0x3E4241,
+    0x3F4342,
+    0x424645,
+    0x444847,
+    0x464A49,
+    0x484C4B,
+    0x4B4D4A,
+    0x45483F,
+    0x46483D,
+    0x484A3F,
+    0x4A4C41,
+    0x4D4F44,
+    0x4F5146,
+    0x505247,
+    0x515348,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x423E35,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xDCFFFF,
+    0xC8EDFF,
+    0xA6CBDD,
+    0x83A8BA,
+    0x678C9E,
+    0x577C8E,
+    0x507587,
+    0x4F7486,
+    0x406577,
+    0x3E6375,
+    0x3B6072,
+    0x3A5F71,
+    0x3C6173,
+    0x416678,
+    0x476C7E,
+    0x4F707F,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3B4F4E,
+    0x3B4F4E,
+    0x3B4F4E,
+    0x3B4F4E,
+    0x3B4F4E,
+    0x3B4F4E,
+    0x3B4F4E,
+    0x3C4F4D,
+    0x394946,
+    0x394843,
+    0x374641,
+    0x35443F,
+    0x33423D,
+    0x303F3A,
+    0x2F3E39,
+    0x2E3D38,
+    0x2A3934,
+    0x2A3934,
+    0x2A3934,
+    0x2A3934,
+    0x2A3934,
+    0x2A3934,
+    0x2A3934,
+    0x2C3834,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x333736,
+    0x343837,
+    0x363A39,
+    0x383C3B,
+    0x3A3E3D,
+    0x3C403F,
+    0x3E4241,
+    0x414340,
+    0x464940,
+    0x484A3F,
+    0x4A4C41,
+    0x4C4E43,
+    0x4E5045,
+    0x505247,
+    0x525449,
+    0x53554A,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x444037,
+    0x444037,
+    0x444037,
+    0x444037,
+    0x444037,
+    0x444037,
+    0x444037,
+    0x444037,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xDAFFFF,
+    0xCDF2FF,
+    0xB2D7E9,
+    0x8FB4C6,
+    0x6C91A3,
+    0x587D8F,
+    0x53788A,
+    0x557A8C,
+    0x44697B,
+    0x416678,
+    0x3D6274,
+    0x3A5F71,
+    0x3B6072,
+    0x3F6476,
+    0x44697B,
+    0x4B6C7B,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3F5250,
+    0x3E4E4B,
+    0x3E4D48,
+    0x3C4B46,
+    0x3A4944,
+    0x384742,
+    0x364540,
+    0x34433E,
+    0x33423D,
+    0x2C3B36,
+    0x2C3B36,
+    0x2B3A35,
+    0x293833,
+    0x283732,
+    0x263530,
+    0x25342F,
+    0x27332F,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2A2E2D,
+    0x2B2F2E,
+    0x2D3130,
+    0x2F3332,
+    0x313534,
+    0x333736,
+    0x353938,
+    0x383A37,
+    0x45483F,
+    0x47493E,
+    0x484A3F,
+    0x4A4C41,
+    0x4D4F44,
+    0x4F5146,
+    0x515348,
+    0x525449,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x47433A,
+    0x47433A,
+    0x47433A,
+    0x47433A,
+    0x47433A,
+    0x47433A,
+    0x47433A,
+    0x47433A,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xD7FCFF,
+    0xD2F7FF,
+    0xBFE4F6,
+    0x9BC0D2,
+    0x7297A9,
+    0x597E90,
+    0x567B8D,
+    0x5C8193,
+    0x486D7F,
+    0x44697B,
+    0x3F6476,
+    0x3B6072,
+    0x3A5F71,
+    0x3D6274,
+    0x416678,
+    0x476877,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x415554,
+    0x415554,
+    0x415554,
+    0x415554,
+    0x415554,
+    0x415554,
+    0x415554,
+    0x425553,
+    0x445451,
+    0x44534E,
+    0x42514C,
+    0x404F4A,
+    0x3E4D48,
+    0x3B4A45,
+    0x3A4944,
+    0x394843,
+    0x33423D,
+    0x32413C,
+    0x303F3A,
+    0x2D3C37,
+    0x2A3934,
+    0x273631,
+    0x25342F,
+    0x25312D,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x242827,
+    0x252928,
+    0x272B2A,
+    0x292D2C,
+    0x2C302F,
+    0x2E3231,
+    0x2F3332,
+    0x323431,
+    0x3F4239,
+    0x414338,
+    0x43453A,
+    0x45473C,
+    0x47493E,
+    0x494B40,
+    0x4B4D42,
+    0x4C4E43,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x49453C,
+    0x49453C,
+    0x49453C,
+    0x49453C,
+    0x49453C,
+    0x49453C,
+    0x49453C,
+    0x49453C,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xD4F9FF,
+    0xD7FCFF,
+    0xCBF0FF,
+    0xA7CCDE,
+    0x789DAF,
+    0x5A7F91,
+    0x587D8F,
+    0x628799,
+    0x4C7183,
+    0x476C7E,
+    0x416678,
+    0x3C6173,
+    0x3A5F71,
+    0x3B6072,
+    0x3E6375,
+    0x436473,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x435756,
+    0x435756,
+    0x435756,
+    0x435756,
+    0x435756,
+    0x435756,
+    0x435756,
+    0x445755,
+    0x495956,
+    0x495853,
+    0x475651,
+    0x45544F,
+    0x43524D,
+    0x41504B,
+    0x3F4E49,
+    0x3E4D48,
+    0x3D4C47,
+    0x3C4B46,
+    0x384742,
+    0x34433E,
+    0x303F3A,
+    0x2B3A35,
+    0x283732,
+    0x283430,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x232726,
+    0x242827,
+    0x262A29,
+    0x282C2B,
+    0x2A2E2D,
+    0x2C302F,
+    0x2E3231,
+    0x313330,
+    0x363930,
+    0x383A2F,
+    0x3A3C31,
+    0x3C3E33,
+    0x3E4035,
+    0x404237,
+    0x424439,
+    0x43453A,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xD2F7FF,
+    0xDBFFFF,
+    0xD5FAFF,
+    0xB0D5E7,
+    0x7CA1B3,
+    0x5B8092,
+    0x5B8092,
+    0x678C9E,
+    0x4E7385,
+    0x4A6F81,
+    0x43687A,
+    0x3C6173,
+    0x395E70,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x455958,
+    0x455958,
+    0x455958,
+    0x455958,
+    0x455958,
+    0x455958,
+    0x455958,
+    0x465957,
+    0x4D5D5A,
+    0x4D5C57,
+    0x4B5A55,
+    0x495853,
+    0x475651,
+    0x45544F,
+    0x43524D,
+    0x42514C,
+    0x485752,
+    0x465550,
+    0x42514C,
+    0x3C4B46,
+    0x374641,
+    0x31403B,
+    0x2D3C37,
+    0x2D3935,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x252928,
+    0x262A29,
+    0x272B2A,
+    0x292D2C,
+    0x2C302F,
+    0x2E3231,
+    0x303433,
+    0x323431,
+    0x2C2F26,
+    0x2E3025,
+    0x303227,
+    0x323429,
+    0x34362B,
+    0x37392E,
+    0x383A2F,
+    0x393B30,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4E4A41,
+    0x4E4A41,
+    0x4E4A41,
+    0x4E4A41,
+    0x4E4A41,
+    0x4E4A41,
+    0x4E4A41,
+    0x4E4A41,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xD1F6FF,
+    0xDDFFFF,
+    0xDAFFFF,
+    0xB5DAEC,
+    0x7FA4B6,
+    0x5C8193,
+    0x5C8193,
+    0x6A8FA1,
+    0x507587,
+    0x4B7082,
+    0x44697B,
+    0x3D6274,
+    0x395E70,
+    0x395E70,
+    0x3A5F71,
+    0x3F606F,
+    0x415C67,
+    0x40575F,
+    0x3A5159,
+    0x344B53,
+    0x324951,
+    0x334A52,
+    0x364D55,
+    0x384F57,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x354C54,
+    0x374B52,
+    0x394E4F,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3A4E4D,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3C504F,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x3E5251,
+    0x465A59,
+    0x465A59,
+    0x465A59,
+    0x465A59,
+    0x465A59,
+    0x465A59,
+    0x465A59,
+    0x475A58,
+    0x4F5F5C,
+    0x4F5E59,
+    0x4D5C57,
+    0x4B5A55,
+    0x495853,
+    0x475651,
+    0x45544F,
+    0x44534E,
+    0x4E5D58,
+    0x4C5B56,
+    0x475651,
+    0x42514C,
+    0x3B4A45,
+    0x364540,
+    0x31403B,
+    0x313D39,
+    0x2D3331,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x2E3231,
+    0x262A29,
+    0x272B2A,
+    0x292D2C,
+    0x2B2F2E,
+    0x2E3231,
+    0x303433,
+    0x313534,
+    0x343633,
+    0x262920,
+    0x282A1F,
+    0x2A2C21,
+    0x2C2E23,
+    0x2E3025,
+    0x313328,
+    0x323429,
+    0x33352A,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4A4C41,
+    0x4B4B41,
+    0x4B483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4C483F,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4A463D,
+    0x4F4B42,
+    0x4F4B42,
+    0x4F4B42,
+    0x4F4B42,
+    0x4F4B42,
+    0x4F4B42,
+    0x4F4B42,
+    0x4F4B42,
+    0x48443B,
+    0x47433A,
+    0x464239,
+    0x444037,
+    0x413D34,
+    0x3F3B32,
+    0x3D3930,
+    0x3C382F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3F3B2F,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0x3D392D,
+    0xC5EAFC,
+    0xCEF3FF,
+    0xCBF0FF,
+    0xAED3E5,
+    0x83A8BA,
+    0x658A9C,
+    0x608597,
+    0x678C9E,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x3F5950,
+    0x3F5950,
+    0x3F5950,
+    0x3F5950,
+    0x3F5950,
+    0x3F5950,
+    0x3F5950,
+    0x455650,
+    0x3E4241,
+    0x423E3F,
+    0x3D393A,
+    0x373334,
+    0x312D2E,
+    0x2B2728,
+    0x272324,
+    0x252122,
+    0x292526,
+    0x2A2627,
+    0x2B2728,
+    0x2C2829,
+    0x2E2A2B,
+    0x2F2B2C,
+    0x302C2D,
+    0x2F2D2E,
+    0x2D2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2E3231,
+    0x2E3231,
+    0x303433,
+    0x323635,
+    0x353938,
+    0x373B3A,
+    0x383C3B,
+    0x393D3C,
+    0x3E433D,
+    0x3F443E,
+    0x414640,
+    0x434842,
+    0x454A44,
+    0x474C46,
+    0x494E48,
+    0x4A4F49,
+    0x434842,
+    0x434842,
+    0x424741,
+    0x40453F,
+    0x3F443E,
+    0x3D423C,
+    0x3C413B,
+    0x3E403B,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0x353631,
+    0xC5EAFC,
+    0xD1F6FF,
+    0xD2F7FF,
+    0xB8DDEF,
+    0x8DB2C4,
+    0x6B90A2,
+    0x608597,
+    0x64899B,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x405A51,
+    0x405A51,
+    0x405A51,
+    0x405A51,
+    0x405A51,
+    0x405A51,
+    0x405A51,
+    0x445751,
+    0x434947,
+    0x454545,
+    0x414141,
+    0x3B3B3B,
+    0x363636,
+    0x303030,
+    0x2C2C2C,
+    0x2A2A2A,
+    0x272727,
+    0x272727,
+    0x282828,
+    0x292929,
+    0x2A2A2A,
+    0x2B2B2B,
+    0x2C2C2C,
+    0x2C2C2C,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2D3130,
+    0x2D3130,
+    0x2F3332,
+    0x313534,
+    0x343837,
+    0x363A39,
+    0x373B3A,
+    0x383C3B,
+    0x3C413B,
+    0x3D423C,
+    0x3E433D,
+    0x414640,
+    0x434842,
+    0x454A44,
+    0x474C46,
+    0x484D47,
+    0x454A44,
+    0x444943,
+    0x444943,
+    0x434842,
+    0x424741,
+    0x414640,
+    0x40453F,
+    0x42443F,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0x363732,
+    0xC5EAFC,
+    0xD5FAFF,
+    0xDCFFFF,
+    0xC6EBFD,
+    0x9ABFD1,
+    0x7297A9,
+    0x608597,
+    0x5E8395,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x425C53,
+    0x425C53,
+    0x425C53,
+    0x425C53,
+    0x425C53,
+    0x425C53,
+    0x425C53,
+    0x465953,
+    0x495450,
+    0x4B4F4E,
+    0x484C4B,
+    0x434746,
+    0x3F4342,
+    0x3B3F3E,
+    0x373B3A,
+    0x363A39,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x272B2A,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2D3130,
+    0x2F3332,
+    0x323635,
+    0x343837,
+    0x353938,
+    0x363A39,
+    0x383D37,
+    0x393E38,
+    0x3A3F39,
+    0x3D423C,
+    0x3F443E,
+    0x414640,
+    0x434842,
+    0x444943,
+    0x464B45,
+    0x464B45,
+    0x464B45,
+    0x464B45,
+    0x464B45,
+    0x464B45,
+    0x464B45,
+    0x484A45,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0x383934,
+    0xC7ECFE,
+    0xDAFFFF,
+    0xE3FFFF,
+    0xD1F6FF,
+    0xA3C8DA,
+    0x769BAD,
+    0x5E8395,
+    0x597E90,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x445E55,
+    0x445E55,
+    0x445E55,
+    0x445E55,
+    0x445E55,
+    0x445E55,
+    0x445E55,
+    0x475C55,
+    0x4D5E58,
+    0x4E5A56,
+    0x4C5854,
+    0x495551,
+    0x46524E,
+    0x434F4B,
+    0x414D49,
+    0x404C48,
+    0x2A3632,
+    0x293531,
+    0x283430,
+    0x27332F,
+    0x25312D,
+    0x24302C,
+    0x222E2A,
+    0x232E2A,
+    0x2A302E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x282C2B,
+    0x292D2C,
+    0x2A2E2D,
+    0x2D3130,
+    0x2F3332,
+    0x313534,
+    0x333736,
+    0x343837,
+    0x333832,
+    0x343933,
+    0x353A34,
+    0x373C36,
+    0x3A3F39,
+    0x3C413B,
+    0x3E433D,
+    0x3E433D,
+    0x434842,
+    0x444943,
+    0x454A44,
+    0x464B45,
+    0x484D47,
+    0x494E48,
+    0x4B504A,
+    0x4D4F4A,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0x3B3C37,
+    0xCBF0FF,
+    0xDDFFFF,
+    0xE3FFFF,
+    0xD2F7FF,
+    0xA2C7D9,
+    0x7499AB,
+    0x5B8092,
+    0x557A8C,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x476158,
+    0x476158,
+    0x476158,
+    0x476158,
+    0x476158,
+    0x476158,
+    0x476158,
+    0x496058,
+    0x4E635C,
+    0x4F625C,
+    0x4E615B,
+    0x4C5F59,
+    0x4B5E58,
+    0x495C56,
+    0x485B55,
+    0x475A54,
+    0x31443E,
+    0x30433D,
+    0x2E413B,
+    0x2B3E38,
+    0x283B35,
+    0x253832,
+    0x233630,
+    0x24332E,
+    0x28312E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x252928,
+    0x262A29,
+    0x282C2B,
+    0x2A2E2D,
+    0x2C302F,
+    0x2E3231,
+    0x303433,
+    0x313534,
+    0x2D322C,
+    0x2E332D,
+    0x30352F,
+    0x323731,
+    0x343933,
+    0x363B35,
+    0x383D37,
+    0x393E38,
+    0x3D423C,
+    0x3E433D,
+    0x40453F,
+    0x434842,
+    0x464B45,
+    0x494E48,
+    0x4B504A,
+    0x4E504B,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0x3E3F3A,
+    0xD0F5FF,
+    0xDFFFFF,
+    0xE3FFFF,
+    0xC9EEFF,
+    0x98BDCF,
+    0x6C91A3,
+    0x577C8E,
+    0x53788A,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x4A645B,
+    0x4A645B,
+    0x4A645B,
+    0x4A645B,
+    0x4A645B,
+    0x4A645B,
+    0x4A645B,
+    0x4A645B,
+    0x4B665D,
+    0x4A655C,
+    0x4A655C,
+    0x4A655C,
+    0x4A655C,
+    0x4A655C,
+    0x4A655C,
+    0x4A655C,
+    0x3C574E,
+    0x3A554C,
+    0x375249,
+    0x324D44,
+    0x2E4940,
+    0x2A453C,
+    0x264138,
+    0x293E37,
+    0x27322E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x222625,
+    0x232726,
+    0x252928,
+    0x272B2A,
+    0x2A2E2D,
+    0x2C302F,
+    0x2D3130,
+    0x2E3231,
+    0x282D27,
+    0x292E28,
+    0x2A2F29,
+    0x2D322C,
+    0x2F342E,
+    0x313630,
+    0x333832,
+    0x343933,
+    0x323731,
+    0x343933,
+    0x373C36,
+    0x3C413B,
+    0x40453F,
+    0x444943,
+    0x484D47,
+    0x4B4D48,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0x41423D,
+    0xD6FBFF,
+    0xDFFFFF,
+    0xDBFFFF,
+    0xBBE0F2,
+    0x89AEC0,
+    0x618698,
+    0x527789,
+    0x53788A,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x4C665D,
+    0x4C665D,
+    0x4C665D,
+    0x4C665D,
+    0x4C665D,
+    0x4C665D,
+    0x4C665D,
+    0x4B665D,
+    0x46645A,
+    0x46665B,
+    0x46665B,
+    0x47675C,
+    0x48685D,
+    0x49695E,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x47675C,
+    0x45655A,
+    0x416156,
+    0x3B5B50,
+    0x36564B,
+    0x315146,
+    0x2D4D42,
+    0x2E483F,
+    0x27322E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x202423,
+    0x212524,
+    0x232726,
+    0x252928,
+    0x282C2B,
+    0x2A2E2D,
+    0x2B2F2E,
+    0x2C302F,
+    0x242923,
+    0x252A24,
+    0x262B25,
+    0x292E28,
+    0x2B302A,
+    0x2D322C,
+    0x2F342E,
+    0x30352F,
+    0x282D27,
+    0x2A2F29,
+    0x2E332D,
+    0x333832,
+    0x393E38,
+    0x3E433D,
+    0x424741,
+    0x474944,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0x43443F,
+    0xD9FEFF,
+    0xDFFFFF,
+    0xD6FBFF,
+    0xB2D7E9,
+    0x7FA4B6,
+    0x5A7F91,
+    0x4F7486,
+    0x54798B,
+    0x4A6F81,
+    0x466B7D,
+    0x406577,
+    0x3A5F71,
+    0x385D6F,
+    0x395E70,
+    0x3C6173,
+    0x416271,
+    0x3D5863,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E56,
+    0x374E54,
+    0x395155,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x395153,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x3C5456,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x405956,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D5A,
+    0x445D59,
+    0x465F59,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x466057,
+    0x4D675E,
+    0x4D675E,
+    0x4D675E,
+    0x4D675E,
+    0x4D675E,
+    0x4D675E,
+    0x4D675E,
+    0x4C675E,
+    0x426358,
+    0x416559,
+    0x42665A,
+    0x43675B,
+    0x45695D,
+    0x466A5E,
+    0x476B5F,
+    0x486C60,
+    0x4D7165,
+    0x4A6E62,
+    0x466A5E,
+    0x406458,
+    0x3A5E52,
+    0x34584C,
+    0x2F5347,
+    0x334E45,
+    0x26322E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x2B2F2E,
+    0x1F2322,
+    0x202423,
+    0x222625,
+    0x242827,
+    0x262A29,
+    0x292D2C,
+    0x2A2E2D,
+    0x2B2F2E,
+    0x222721,
+    0x232822,
+    0x242923,
+    0x262B25,
+    0x292E28,
+    0x2B302A,
+    0x2D322C,
+    0x2D322C,
+    0x222721,
+    0x242923,
+    0x282D27,
+    0x2E332D,
+    0x343933,
+    0x3A3F39,
+    0x3F443E,
+    0x434540,
+    0x454742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x464742,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x42433E,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x40413C,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x444540,
+    0x96D4F9,
+    0x90CEF3,
+    0x85C1E5,
+    0x77B2D4,
+    0x679FC0,
+    0x598EAD,
+    0x4F829F,
+    0x4C7B95,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x446459,
+    0x446459,
+    0x446459,
+    0x446459,
+    0x446459,
+    0x446459,
+    0x446459,
+    0x456359,
+    0x3A5149,
+    0x384D46,
+    0x354842,
+    0x31423C,
+    0x2C3B36,
+    0x293430,
+    0x282E2C,
+    0x282A29,
+    0x303030,
+    0x332F30,
+    0x352C2F,
+    0x362A2E,
+    0x35292D,
+    0x38272D,
+    0x37262C,
+    0x34282C,
+    0x262425,
+    0x232726,
+    0x242827,
+    0x262A29,
+    0x272B2A,
+    0x292D2C,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x3B3F3E,
+    0x3C403F,
+    0x3E4241,
+    0x404443,
+    0x424645,
+    0x454948,
+    0x464A49,
+    0x474B4A,
+    0x3C403F,
+    0x3D4140,
+    0x3F4342,
+    0x414544,
+    0x434746,
+    0x454948,
+    0x474B4A,
+    0x484C4B,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x90CEF3,
+    0x8AC8ED,
+    0x81BDE1,
+    0x73AED0,
+    0x659DBE,
+    0x588DAC,
+    0x4F829F,
+    0x4B7A94,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x45655A,
+    0x45655A,
+    0x45655A,
+    0x45655A,
+    0x45655A,
+    0x45655A,
+    0x45655A,
+    0x46645A,
+    0x3D574E,
+    0x3D544C,
+    0x3A4F48,
+    0x364943,
+    0x32433D,
+    0x303C38,
+    0x2D3834,
+    0x2E3432,
+    0x303231,
+    0x312F30,
+    0x322E2F,
+    0x342B2E,
+    0x34292D,
+    0x33272B,
+    0x34252A,
+    0x31262A,
+    0x242424,
+    0x212524,
+    0x222625,
+    0x232726,
+    0x242827,
+    0x252928,
+    0x262A29,
+    0x262A29,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x353938,
+    0x363A39,
+    0x383C3B,
+    0x3A3E3D,
+    0x3C403F,
+    0x3F4342,
+    0x404443,
+    0x414544,
+    0x3A3E3D,
+    0x3B3F3E,
+    0x3D4140,
+    0x3F4342,
+    0x414544,
+    0x434746,
+    0x454948,
+    0x464A49,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x84C2E7,
+    0x7FBDE2,
+    0x77B3D7,
+    0x6CA7C9,
+    0x6098B9,
+    0x558AA9,
+    0x4D809D,
+    0x4B7A94,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x47675C,
+    0x47675C,
+    0x47675C,
+    0x47675C,
+    0x47675C,
+    0x47675C,
+    0x47675C,
+    0x47675C,
+    0x436157,
+    0x415F55,
+    0x405B52,
+    0x3D574E,
+    0x3A5149,
+    0x384B45,
+    0x374842,
+    0x384440,
+    0x2E3734,
+    0x303433,
+    0x313131,
+    0x322E2F,
+    0x2F2B2C,
+    0x30272A,
+    0x2E2528,
+    0x2B2527,
+    0x232323,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x2C302F,
+    0x2D3130,
+    0x2E3231,
+    0x303433,
+    0x333736,
+    0x353938,
+    0x373B3A,
+    0x383C3B,
+    0x363A39,
+    0x373B3A,
+    0x393D3C,
+    0x3B3F3E,
+    0x3D4140,
+    0x3F4342,
+    0x414544,
+    0x424645,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x75B3D8,
+    0x71AFD4,
+    0x6BA7CB,
+    0x629DBF,
+    0x5991B2,
+    0x5186A5,
+    0x4C7F9C,
+    0x4A7993,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x4A6A5F,
+    0x476B5F,
+    0x466A5E,
+    0x46675C,
+    0x446459,
+    0x426056,
+    0x425C53,
+    0x425951,
+    0x42554F,
+    0x31403B,
+    0x333E3A,
+    0x313A37,
+    0x313534,
+    0x2F3130,
+    0x2C2C2C,
+    0x2A2829,
+    0x282828,
+    0x252726,
+    0x222625,
+    0x212524,
+    0x1F2322,
+    0x1E2221,
+    0x1C201F,
+    0x1B1F1E,
+    0x1B1F1E,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x232726,
+    0x242827,
+    0x252928,
+    0x272B2A,
+    0x2A2E2D,
+    0x2C302F,
+    0x2D3130,
+    0x2E3231,
+    0x313534,
+    0x323635,
+    0x333736,
+    0x363A39,
+    0x383C3B,
+    0x3A3E3D,
+    0x3C403F,
+    0x3D4140,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x65A3C8,
+    0x62A0C5,
+    0x5F9BBF,
+    0x5893B5,
+    0x528AAB,
+    0x4D82A1,
+    0x4A7D9A,
+    0x4A7993,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4D6D62,
+    0x4D6D62,
+    0x4D6D62,
+    0x4D6D62,
+    0x4D6D62,
+    0x4D6D62,
+    0x4D6D62,
+    0x4C6D62,
+    0x487264,
+    0x467263,
+    0x467062,
+    0x466F61,
+    0x466C5F,
+    0x48695E,
+    0x47675C,
+    0x4A655C,
+    0x395048,
+    0x394C46,
+    0x374842,
+    0x35413D,
+    0x303B37,
+    0x2C3532,
+    0x2A302E,
+    0x282E2C,
+    0x292D2C,
+    0x282C2B,
+    0x262A29,
+    0x232726,
+    0x202423,
+    0x1D2120,
+    0x1B1F1E,
+    0x1A1E1D,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x1D2120,
+    0x1E2221,
+    0x202423,
+    0x222625,
+    0x242827,
+    0x262A29,
+    0x282C2B,
+    0x292D2C,
+    0x2B2F2E,
+    0x2C302F,
+    0x2E3231,
+    0x303433,
+    0x323635,
+    0x343837,
+    0x363A39,
+    0x373B3A,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x5694B9,
+    0x5492B7,
+    0x538FB3,
+    0x4F8AAC,
+    0x4C84A5,
+    0x4A7F9E,
+    0x487B98,
+    0x497892,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4F6F64,
+    0x4F6F64,
+    0x4F6F64,
+    0x4F6F64,
+    0x4F6F64,
+    0x4F6F64,
+    0x4F6F64,
+    0x4C7064,
+    0x447464,
+    0x427564,
+    0x427564,
+    0x457464,
+    0x457464,
+    0x487264,
+    0x4A7063,
+    0x4D6E63,
+    0x436157,
+    0x445E55,
+    0x415850,
+    0x3C4F49,
+    0x374842,
+    0x32413C,
+    0x2F3B37,
+    0x2D3834,
+    0x323836,
+    0x323635,
+    0x2F3332,
+    0x2A2E2D,
+    0x262A29,
+    0x212524,
+    0x1E2221,
+    0x1D2120,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x1C201F,
+    0x1D2120,
+    0x1E2221,
+    0x202423,
+    0x232726,
+    0x252928,
+    0x272B2A,
+    0x272B2A,
+    0x262A29,
+    0x272B2A,
+    0x282C2B,
+    0x2B2F2E,
+    0x2D3130,
+    0x2F3332,
+    0x313534,
+    0x323635,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x4A88AD,
+    0x4987AC,
+    0x4985A9,
+    0x4883A5,
+    0x477FA0,
+    0x477C9B,
+    0x477A97,
+    0x497892,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x517166,
+    0x517166,
+    0x517166,
+    0x517166,
+    0x517166,
+    0x517166,
+    0x517166,
+    0x4D7366,
+    0x407362,
+    0x3C7562,
+    0x3F7663,
+    0x417664,
+    0x437665,
+    0x477666,
+    0x497566,
+    0x4C7567,
+    0x4D7165,
+    0x4D6D62,
+    0x49675D,
+    0x445E55,
+    0x3E554D,
+    0x384D46,
+    0x334640,
+    0x33423D,
+    0x3B4441,
+    0x3C403F,
+    0x383C3B,
+    0x323635,
+    0x2D3130,
+    0x272B2A,
+    0x232726,
+    0x212524,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x1D2120,
+    0x1E2221,
+    0x202423,
+    0x222625,
+    0x242827,
+    0x262A29,
+    0x282C2B,
+    0x292D2C,
+    0x222625,
+    0x232726,
+    0x242827,
+    0x272B2A,
+    0x292D2C,
+    0x2B2F2E,
+    0x2D3130,
+    0x2E3231,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x4482A7,
+    0x4482A7,
+    0x4480A4,
+    0x447FA1,
+    0x457D9E,
+    0x457A99,
+    0x467996,
+    0x487791,
+    0x3D6A81,
+    0x3F687C,
+    0x3F6578,
+    0x3F6373,
+    0x3E5F6E,
+    0x3D5D6A,
+    0x3E5C67,
+    0x3E5A65,
+    0x3F5761,
+    0x3F565E,
+    0x3E555D,
+    0x3C535B,
+    0x395058,
+    0x374E56,
+    0x364D55,
+    0x354C54,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395058,
+    0x395056,
+    0x3B5357,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3B5355,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3E5658,
+    0x3D5758,
+    0x3F5C58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x3E5D58,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x42615C,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476661,
+    0x476660,
+    0x4B6A62,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x4B6B60,
+    0x527267,
+    0x527267,
+    0x527267,
+    0x527267,
+    0x527267,
+    0x527267,
+    0x527267,
+    0x4E7467,
+    0x3C7360,
+    0x397460,
+    0x3A7561,
+    0x3F7663,
+    0x407764,
+    0x447766,
+    0x487767,
+    0x4B7567,
+    0x537C6E,
+    0x53776B,
+    0x507065,
+    0x4B665D,
+    0x435D54,
+    0x3D544C,
+    0x384D46,
+    0x384943,
+    0x414A47,
+    0x424645,
+    0x3D4140,
+    0x383C3B,
+    0x313534,
+    0x2C302F,
+    0x272B2A,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x252928,
+    0x1F2322,
+    0x202423,
+    0x222625,
+    0x242827,
+    0x262A29,
+    0x282C2B,
+    0x2A2E2D,
+    0x2B2F2E,
+    0x202423,
+    0x212524,
+    0x222625,
+    0x242827,
+    0x272B2A,
+    0x292D2C,
+    0x2B2F2E,
+    0x2C302F,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x3A3F39,
+    0x4A7EA3,
+    0x497DA2,
+    0x497B9C,
+    0x48799A,
+    0x487795,
+    0x487491,
+    0x48728B,
+    0x4A7087,
+    0x45687E,
+    0x47667A,
+    0x476474,
+    0x476170,
+    0x475F6B,
+    0x465C69,
+    0x465A63,
+    0x455962,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x436C64,
+    0x436C64,
+    0x436C64,
+    0x436C64,
+    0x436C64,
+    0x436C64,
+    0x436C64,
+    0x466B64,
+    0x3A5753,
+    0x3B5451,
+    0x384E4C,
+    0x344847,
+    0x2E4040,
+    0x2C3A3B,
+    0x293436,
+    0x293134,
+    0x202328,
+    0x242329,
+    0x27242B,
+    0x2D262E,
+    0x322831,
+    0x362A34,
+    0x392C36,
+    0x382E36,
+    0x252527,
+    0x232726,
+    0x242827,
+    0x262A29,
+    0x272B2A,
+    0x292D2C,
+    0x2A2E2D,
+    0x2A2E2D,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x2C3033,
+    0x2C2F34,
+    0x2C2F34,
+    0x2C2F34,
+    0x2C2F34,
+    0x2C2F34,
+    0x2C2F34,
+    0x2C2F34,
+    0x3B3E43,
+    0x3B3E43,
+    0x3B3E43,
+    0x3B3E43,
+    0x3B3E43,
+    0x3B3E43,
+    0x3B3E43,
+    0x3B3E43,
+    0x497DA2,
+    0x487CA1,
+    0x487A9B,
+    0x477899,
+    0x477694,
+    0x46728F,
+    0x47718A,
+    0x496F86,
+    0x44677D,
+    0x466579,
+    0x466373,
+    0x46606F,
+    0x465E6A,
+    0x455B68,
+    0x455962,
+    0x445861,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x446D65,
+    0x446D65,
+    0x446D65,
+    0x446D65,
+    0x446D65,
+    0x446D65,
+    0x446D65,
+    0x476C65,
+    0x3E5E59,
+    0x405A57,
+    0x3C5653,
+    0x394F4D,
+    0x344A48,
+    0x314343,
+    0x303E3F,
+    0x303A3C,
+    0x242C2F,
+    0x282B30,
+    0x2B2A30,
+    0x2E2930,
+    0x2E2930,
+    0x312730,
+    0x312730,
+    0x2F282F,
+    0x242426,
+    0x212524,
+    0x222625,
+    0x232726,
+    0x242827,
+    0x252928,
+    0x262A29,
+    0x262A29,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x2B2F32,
+    0x2B2E33,
+    0x2B2E33,
+    0x2B2E33,
+    0x2B2E33,
+    0x2B2E33,
+    0x2B2E33,
+    0x2B2E33,
+    0x383B40,
+    0x383B40,
+    0x383B40,
+    0x383B40,
+    0x383B40,
+    0x383B40,
+    0x383B40,
+    0x383B40,
+    0x477BA0,
+    0x467A9F,
+    0x467899,
+    0x457697,
+    0x457492,
+    0x44708D,
+    0x456F88,
+    0x476D84,
+    0x42657B,
+    0x446377,
+    0x446171,
+    0x445E6D,
+    0x445C68,
+    0x435966,
+    0x435760,
+    0x42565F,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x476F67,
+    0x446962,
+    0x456560,
+    0x42625D,
+    0x3F5C58,
+    0x3D5754,
+    0x3C5250,
+    0x394D4C,
+    0x3B4B4B,
+    0x2F3A3C,
+    0x30383B,
+    0x2F3438,
+    0x2E2F34,
+    0x2B2A30,
+    0x29262D,
+    0x28232A,
+    0x242227,
+    0x222325,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x202423,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x292D30,
+    0x292C31,
+    0x292C31,
+    0x292C31,
+    0x292C31,
+    0x292C31,
+    0x292C31,
+    0x292C31,
+    0x34373C,
+    0x34373C,
+    0x34373C,
+    0x34373C,
+    0x34373C,
+    0x34373C,
+    0x34373C,
+    0x34373C,
+    0x44789D,
+    0x43779C,
+    0x437596,
+    0x427394,
+    0x42718F,
+    0x426E8B,
+    0x426C85,
+    0x446A81,
+    0x3F6278,
+    0x416074,
+    0x425F6F,
+    0x425C6B,
+    0x415965,
+    0x405663,
+    0x40545D,
+    0x40545D,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x49726A,
+    0x487169,
+    0x466E66,
+    0x466B64,
+    0x436660,
+    0x44635E,
+    0x445E5B,
+    0x465C5A,
+    0x394D4C,
+    0x394949,
+    0x374244,
+    0x323A3D,
+    0x2A3235,
+    0x26292E,
+    0x212429,
+    0x202125,
+    0x232728,
+    0x222625,
+    0x212524,
+    0x1F2322,
+    0x1E2221,
+    0x1C201F,
+    0x1B1F1E,
+    0x1B1F1E,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x262A2D,
+    0x26292E,
+    0x26292E,
+    0x26292E,
+    0x26292E,
+    0x26292E,
+    0x26292E,
+    0x26292E,
+    0x2F3237,
+    0x2F3237,
+    0x2F3237,
+    0x2F3237,
+    0x2F3237,
+    0x2F3237,
+    0x2F3237,
+    0x2F3237,
+    0x41759A,
+    0x407499,
+    0x417394,
+    0x407192,
+    0x3F6E8C,
+    0x3F6B88,
+    0x3F6982,
+    0x41677E,
+    0x3C5F75,
+    0x3F5E72,
+    0x3F5C6C,
+    0x3F5968,
+    0x3E5662,
+    0x3D5360,
+    0x3E525B,
+    0x3D515A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4B746C,
+    0x4B746C,
+    0x4B746C,
+    0x4B746C,
+    0x4B746C,
+    0x4B746C,
+    0x4B746C,
+    0x4A756C,
+    0x49786E,
+    0x49786E,
+    0x48776D,
+    0x49746B,
+    0x48736A,
+    0x487068,
+    0x4A6D67,
+    0x4C6B66,
+    0x425F5B,
+    0x425B58,
+    0x3E5251,
+    0x394949,
+    0x313F40,
+    0x2A3537,
+    0x252F31,
+    0x222A2C,
+    0x282E2E,
+    0x282C2B,
+    0x262A29,
+    0x232726,
+    0x202423,
+    0x1D2120,
+    0x1B1F1E,
+    0x1A1E1D,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x23272A,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x2A2D32,
+    0x2A2D32,
+    0x2A2D32,
+    0x2A2D32,
+    0x2A2D32,
+    0x2A2D32,
+    0x2A2D32,
+    0x2A2D32,
+    0x3F7398,
+    0x3E7297,
+    0x3E7091,
+    0x3D6E8F,
+    0x3D6C8A,
+    0x3C6885,
+    0x3D6780,
+    0x3F657C,
+    0x3A5D73,
+    0x3C5B6F,
+    0x3C5969,
+    0x3C5665,
+    0x3C5460,
+    0x3B515E,
+    0x3B4F58,
+    0x3A4E57,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4B796F,
+    0x477B6F,
+    0x447C6F,
+    0x467C6F,
+    0x467A6E,
+    0x47796E,
+    0x4A786E,
+    0x4C776E,
+    0x4E766E,
+    0x4B6E68,
+    0x4B6A65,
+    0x46635F,
+    0x415A57,
+    0x3A504E,
+    0x354747,
+    0x2F4141,
+    0x303C3C,
+    0x303938,
+    0x323635,
+    0x2F3332,
+    0x2A2E2D,
+    0x262A29,
+    0x212524,
+    0x1E2221,
+    0x1D2120,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x212528,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x24272C,
+    0x24272C,
+    0x24272C,
+    0x24272C,
+    0x24272C,
+    0x24272C,
+    0x24272C,
+    0x24272C,
+    0x3D7196,
+    0x3C7095,
+    0x3C6E8F,
+    0x3B6C8D,
+    0x3B6A88,
+    0x3A6683,
+    0x3B657E,
+    0x3D637A,
+    0x385B71,
+    0x3A596D,
+    0x3A5767,
+    0x3A5463,
+    0x3A525E,
+    0x394F5C,
+    0x394D56,
+    0x384C55,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x507971,
+    0x507971,
+    0x507971,
+    0x507971,
+    0x507971,
+    0x507971,
+    0x507971,
+    0x4D7B71,
+    0x407A6C,
+    0x3F7C6D,
+    0x3F7C6D,
+    0x437B6E,
+    0x447C6F,
+    0x487C70,
+    0x4C7B71,
+    0x4F7A71,
+    0x4F7870,
+    0x50756E,
+    0x4E6E69,
+    0x4A6763,
+    0x44615D,
+    0x415A57,
+    0x3C5552,
+    0x3E514F,
+    0x3B4443,
+    0x3C403F,
+    0x383C3B,
+    0x323635,
+    0x2D3130,
+    0x272B2A,
+    0x232726,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x1F2326,
+    0x1F2227,
+    0x1F2227,
+    0x1F2227,
+    0x1F2227,
+    0x1F2227,
+    0x1F2227,
+    0x1F2227,
+    0x202328,
+    0x202328,
+    0x202328,
+    0x202328,
+    0x202328,
+    0x202328,
+    0x202328,
+    0x202328,
+    0x3C7095,
+    0x3B6F94,
+    0x3B6D8E,
+    0x3A6B8C,
+    0x396886,
+    0x396582,
+    0x3A647D,
+    0x3C6279,
+    0x375A70,
+    0x39586C,
+    0x395666,
+    0x395362,
+    0x39515D,
+    0x384E5B,
+    0x384C55,
+    0x374B54,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3A5358,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x3C5A5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x405F5A,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x466560,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B64,
+    0x4C7066,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4C7064,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4E7266,
+    0x4D7368,
+    0x4B736A,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x517A72,
+    0x517A72,
+    0x517A72,
+    0x517A72,
+    0x517A72,
+    0x517A72,
+    0x517A72,
+    0x4D7C72,
+    0x3E786A,
+    0x3B7B6B,
+    0x3D7B6C,
+    0x3F7C6D,
+    0x437D6F,
+    0x477D70,
+    0x497D71,
+    0x4D7C72,
+    0x537E75,
+    0x537B73,
+    0x51766F,
+    0x50706B,
+    0x4C6B66,
+    0x486561,
+    0x47615E,
+    0x495D5B,
+    0x404A49,
+    0x424645,
+    0x3D4140,
+    0x383C3B,
+    0x313534,
+    0x2C302F,
+    0x272B2A,
+    0x252928,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212524,
+    0x212526,
+    0x1E2225,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x1E2126,
+    0x435E6F,
+    0x435E6F,
+    0x435E6F,
+    0x435E6F,
+    0x435E6F,
+    0x435E6F,
+    0x435E6F,
+    0x435E6F,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x517573,
+    0x496566,
+    0x496163,
+    0x455A5D,
+    0x3E5155,
+    0x36484C,
+    0x313E44,
+    0x2D383E,
+    0x2C333B,
+    0x181B24,
+    0x1C1A25,
+    0x1F1C27,
+    0x241C29,
+    0x291E2C,
+    0x2D212F,
+    0x302231,
+    0x2F2432,
+    0x1F1E24,
+    0x1C1F24,
+    0x1D2025,
+    0x1F2227,
+    0x202328,
+    0x22252A,
+    0x23262B,
+    0x24272C,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x425D6E,
+    0x425D6E,
+    0x425D6E,
+    0x425D6E,
+    0x425D6E,
+    0x425D6E,
+    0x425D6E,
+    0x425D6E,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x517573,
+    0x4C6C6B,
+    0x4D6768,
+    0x476162,
+    0x43585B,
+    0x3B5053,
+    0x35474B,
+    0x323F45,
+    0x323B42,
+    0x20272F,
+    0x23262F,
+    0x26242F,
+    0x29232F,
+    0x29232F,
+    0x2D2230,
+    0x2D2230,
+    0x2B2330,
+    0x212026,
+    0x1F2227,
+    0x1F2227,
+    0x202328,
+    0x212429,
+    0x22252A,
+    0x23262B,
+    0x23262B,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x405B6C,
+    0x405B6C,
+    0x405B6C,
+    0x405B6C,
+    0x405B6C,
+    0x405B6C,
+    0x405B6C,
+    0x405B6C,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4F7673,
+    0x4F7371,
+    0x50706F,
+    0x4B6B6A,
+    0x476364,
+    0x425C5D,
+    0x3E5356,
+    0x3A4D51,
+    0x3B4A4F,
+    0x303B41,
+    0x313840,
+    0x30343D,
+    0x2F2F39,
+    0x2C2A35,
+    0x2A2732,
+    0x29232F,
+    0x25222D,
+    0x25262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x23262B,
+    0x22252A,
+    0x22252A,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x3E596A,
+    0x3E596A,
+    0x3E596A,
+    0x3E596A,
+    0x3E596A,
+    0x3E596A,
+    0x3E596A,
+    0x3E596A,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x527B77,
+    0x507975,
+    0x4D7471,
+    0x4A6E6C,
+    0x466867,
+    0x436161,
+    0x435D5E,
+    0x44595C,
+    0x3E5155,
+    0x3E4D52,
+    0x3C474D,
+    0x373E46,
+    0x2F363E,
+    0x2B2E37,
+    0x262932,
+    0x25252F,
+    0x292C31,
+    0x292C31,
+    0x282B30,
+    0x26292E,
+    0x25282D,
+    0x23262B,
+    0x22252A,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x3B5667,
+    0x3B5667,
+    0x3B5667,
+    0x3B5667,
+    0x3B5667,
+    0x3B5667,
+    0x3B5667,
+    0x3B5667,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4D7773,
+    0x507F79,
+    0x4E7D77,
+    0x4B7A74,
+    0x4B7571,
+    0x47716D,
+    0x456C69,
+    0x466867,
+    0x476565,
+    0x476364,
+    0x475F61,
+    0x43565A,
+    0x3E4D52,
+    0x354248,
+    0x2F3A40,
+    0x293239,
+    0x272E36,
+    0x2F3438,
+    0x2F3237,
+    0x2D3035,
+    0x2A2D32,
+    0x272A2F,
+    0x24272C,
+    0x22252A,
+    0x202328,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4B7873,
+    0x4A7D76,
+    0x467E75,
+    0x477C74,
+    0x457871,
+    0x44756F,
+    0x45726D,
+    0x456F6B,
+    0x466D6A,
+    0x4C6E6D,
+    0x4B6969,
+    0x476364,
+    0x425A5C,
+    0x3B5053,
+    0x35474B,
+    0x2F4145,
+    0x313C42,
+    0x333B3E,
+    0x35383D,
+    0x313439,
+    0x2D3035,
+    0x282B30,
+    0x24272C,
+    0x212429,
+    0x1F2227,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x365162,
+    0x365162,
+    0x365162,
+    0x365162,
+    0x365162,
+    0x365162,
+    0x365162,
+    0x365162,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4B7873,
+    0x427B72,
+    0x407C72,
+    0x3F7B71,
+    0x40786F,
+    0x3F776E,
+    0x41746D,
+    0x43726C,
+    0x456F6B,
+    0x4B7470,
+    0x4B6F6D,
+    0x4A6A69,
+    0x466263,
+    0x3F5B5C,
+    0x3C5456,
+    0x385052,
+    0x394B4F,
+    0x384043,
+    0x393C41,
+    0x35383D,
+    0x303338,
+    0x2A2D32,
+    0x25282D,
+    0x212429,
+    0x1F2227,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x355061,
+    0x355061,
+    0x355061,
+    0x355061,
+    0x355061,
+    0x355061,
+    0x355061,
+    0x355061,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x385364,
+    0x395362,
+    0x3A525C,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B5459,
+    0x3B575A,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3A5858,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x3E5C5C,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x41645E,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x446761,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x486B65,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4C6F69,
+    0x4B7069,
+    0x4B736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4A736B,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4E776F,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7870,
+    0x4F7872,
+    0x4F7872,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4F7874,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4A7973,
+    0x3F786F,
+    0x3B7A6F,
+    0x3B796E,
+    0x3B776D,
+    0x3D766D,
+    0x3F746C,
+    0x3F726B,
+    0x42716B,
+    0x4A7470,
+    0x4A716E,
+    0x496D6B,
+    0x476766,
+    0x436161,
+    0x405C5D,
+    0x3E5859,
+    0x405357,
+    0x3A4446,
+    0x3B3E43,
+    0x373A3F,
+    0x313439,
+    0x2B2E33,
+    0x25282D,
+    0x212429,
+    0x1E2126,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x212429,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x45686C,
+    0x3E5960,
+    0x3E555D,
+    0x3C5059,
+    0x374953,
+    0x32434D,
+    0x2F3B47,
+    0x2D3743,
+    0x2C3240,
+    0x272938,
+    0x292637,
+    0x2A2637,
+    0x2C2336,
+    0x2D2135,
+    0x2D2034,
+    0x2D1E33,
+    0x2D1E33,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x45686C,
+    0x405F64,
+    0x425B62,
+    0x3E575E,
+    0x3C5059,
+    0x364A53,
+    0x33444E,
+    0x323E4A,
+    0x333B48,
+    0x2C3240,
+    0x2E303F,
+    0x2F2C3D,
+    0x2F283A,
+    0x2C2537,
+    0x2C2034,
+    0x2A1E32,
+    0x291C30,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x43696C,
+    0x44676B,
+    0x456469,
+    0x426166,
+    0x405B62,
+    0x3D565D,
+    0x3C5059,
+    0x3A4C56,
+    0x3B4954,
+    0x38424E,
+    0x383E4C,
+    0x353847,
+    0x333242,
+    0x2D2A3B,
+    0x292536,
+    0x261F31,
+    0x241D2F,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x426A6C,
+    0x466E70,
+    0x456D6F,
+    0x446A6D,
+    0x43666A,
+    0x416267,
+    0x415E64,
+    0x425B62,
+    0x445861,
+    0x3F515B,
+    0x3F4D58,
+    0x3C4652,
+    0x363C4A,
+    0x2E3442,
+    0x292B3A,
+    0x232534,
+    0x222131,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x416A6C,
+    0x447272,
+    0x447272,
+    0x437171,
+    0x446D6F,
+    0x426B6D,
+    0x43696C,
+    0x45666B,
+    0x47646A,
+    0x425D64,
+    0x425961,
+    0x3F515B,
+    0x3A4853,
+    0x333F4B,
+    0x2D3743,
+    0x28303D,
+    0x252D3A,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x3F6B6C,
+    0x3F7170,
+    0x3C7370,
+    0x3E7270,
+    0x3F7170,
+    0x407070,
+    0x426E6F,
+    0x446D6F,
+    0x466C6F,
+    0x406166,
+    0x415E64,
+    0x3D585F,
+    0x3B525A,
+    0x364A53,
+    0x33444E,
+    0x2E3F49,
+    0x2E3C47,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x3F6B6C,
+    0x376F6C,
+    0x35706C,
+    0x36716D,
+    0x3A716E,
+    0x3B726F,
+    0x3E706F,
+    0x427070,
+    0x466F71,
+    0x3B6365,
+    0x3C5F63,
+    0x3D5C61,
+    0x3C575E,
+    0x39545B,
+    0x395058,
+    0x374E56,
+    0x384C55,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x35515C,
+    0x36515C,
+    0x3A535A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3B525A,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3C535B,
+    0x3B545B,
+    0x3D585F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x3C595F,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D63,
+    0x405D61,
+    0x416364,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x416362,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x446665,
+    0x436765,
+    0x476F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x466F67,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x487169,
+    0x48716B,
+    0x4C756F,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4C7571,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4E7773,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4C7974,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B76,
+    0x4E7B78,
+    0x4E7A79,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4E7A7B,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4E7779,
+    0x4D7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4E7678,
+    0x4D7577,
+    0x4B7375,
+    0x497173,
+    0x476F71,
+    0x456D6F,
+    0x436B6D,
+    0x3E6C6C,
+    0x336B68,
+    0x306E69,
+    0x326F6A,
+    0x346F6B,
+    0x38706D,
+    0x3D716F,
+    0x3F7170,
+    0x427070,
+    0x376062,
+    0x395F62,
+    0x3A5D61,
+    0x3C5B60,
+    0x3C595F,
+    0x3C575E,
+    0x3E575E,
+    0x3D565D,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6163,
+    0x406766,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x3F6864,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x426B67,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x466F6B,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x48716D,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x497671,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7873,
+    0x4B7875,
+    0x4C7877,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C7879,
+    0x4C787B,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x497278,
+    0x436C72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x446B72,
+    0x436A71,
+    0x426970,
+    0x40676E,
+    0x3E656C,
+    0x3B6269,
+    0x396067,
+    0x385F66,
+    0x375E65,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2B484E,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x2F4C52,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x355258,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x38555B,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x395A5F,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3F6065,
+    0x3E6165,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x466E70,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x487072,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x497576,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B7778,
+    0x4B777A,
+    0x4B777A,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x4B767C,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x4B747A,
+    0x497278,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x4A7178,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x3F666D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x26424D,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x2D4954,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x335056,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545A,
+    0x37545C,
+    0x395A61,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x395A63,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3D5E67,
+    0x3C5E67,
+    0x406669,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x3F6769,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x426A6C,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457172,
+    0x457174,
+    0x477376,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x49747A,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x477278,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x457076,
+    0x477076,
+    0x456E74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x466D74,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x426970,
+    0x436871,
+    0x436571,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x446473,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E,
+    0x3F5F6E
+};
@@ -0,0 +1,19202 @@
+unsigned int jpeg_no_huffman_rgb888[19200] = {
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000E00,
+    0x000900,
+    0x000800,
+    0x000600,
+    0x131E10,
+    0x767E71,
+    0x787E72,
+    0x74776C,
+    0x787B70,
+    0x7F8176,
+    0x84867B,
+    0x86887A,
+    0x87897B,
+    0x888A7C,
+    0x888A7C,
+    0x888A7C,
+    0x898B7D,
+    0x898B7D,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x898B7D,
+    0x888A7C,
+    0x888A7C,
+    0x848678,
+    0x87897B,
+    0x8A8C7E,
+    0x8C8E80,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D8F81,
+    0x8E9082,
+    0x8E9082,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D8F81,
+    0x8C8E80,
+    0x8B8D7F,
+    0x8B8D7F,
+    0x8B8D7F,
+    0x8B8D7F,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x898B7D,
+    0x898B7D,
+    0x878B7C,
+    0x818A79,
+    0x7F8A79,
+    0x7F8A79,
+    0x808B7A,
+    0x818C7B,
+    0x808B7A,
+    0x7D8A78,
+    0x7B8876,
+    0x788573,
+    0x788573,
+    0x788774,
+    0x788774,
+    0x778673,
+    0x768572,
+    0x748370,
+    0x73826F,
+    0x74816F,
+    0x73806E,
+    0x73806E,
+    0x727F6D,
+    0x707F6C,
+    0x6F7E6B,
+    0x6E7D6A,
+    0x6E7D6A,
+    0x6A7B68,
+    0x6A7B68,
+    0x687B67,
+    0x677A66,
+    0x667965,
+    0x657864,
+    0x647763,
+    0x657664,
+    0x667463,
+    0x667264,
+    0x657362,
+    0x657362,
+    0x647563,
+    0x647563,
+    0x617461,
+    0x5F7161,
+    0x627363,
+    0x5D6D62,
+    0x5E6B61,
+    0x5D6A63,
+    0x626D67,
+    0x495450,
+    0x313A39,
+    0x000802,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000D00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x182315,
+    0x788073,
+    0x797F73,
+    0x7A7D72,
+    0x7D8075,
+    0x818378,
+    0x83857A,
+    0x848678,
+    0x858779,
+    0x86887A,
+    0x87897B,
+    0x87897B,
+    0x888A7C,
+    0x898B7D,
+    0x8A8C7E,
+    0x8B8D7F,
+    0x8C8E80,
+    0x8D8F81,
+    0x8D8F81,
+    0x858779,
+    0x888A7C,
+    0x8B8D7F,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8E9082,
+    0x8B8D7F,
+    0x8B8D7F,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x898B7D,
+    0x898B7D,
+    0x888A7C,
+    0x878B7C,
+    0x888F7F,
+    0x868F7E,
+    0x848D7C,
+    0x838C7B,
+    0x828B7A,
+    0x7F8877,
+    0x798473,
+    0x768170,
+    0x768170,
+    0x768170,
+    0x768170,
+    0x768170,
+    0x74816F,
+    0x73806E,
+    0x727F6D,
+    0x717E6C,
+    0x727D6C,
+    0x727D6C,
+    0x727D6C,
+    0x727D6C,
+    0x707D6B,
+    0x707D6B,
+    0x707D6B,
+    0x707D6B,
+    0x6C7B68,
+    0x6C7B68,
+    0x6B7A67,
+    0x6A7966,
+    0x687966,
+    0x677865,
+    0x677865,
+    0x687665,
+    0x6D7B6A,
+    0x6D796B,
+    0x6A7867,
+    0x697766,
+    0x677866,
+    0x657664,
+    0x627562,
+    0x607262,
+    0x637464,
+    0x5F6F64,
+    0x616E64,
+    0x5E6B64,
+    0x636E68,
+    0x4E5955,
+    0x363F3E,
+    0x000802,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000D00,
+    0x000A00,
+    0x000B00,
+    0x000A00,
+    0x202B1D,
+    0x798174,
+    0x787E72,
+    0x797C71,
+    0x7A7D72,
+    0x7C7E73,
+    0x7C7E73,
+    0x7D7F71,
+    0x7E8072,
+    0x808274,
+    0x828476,
+    0x808274,
+    0x808274,
+    0x818375,
+    0x818375,
+    0x838577,
+    0x858779,
+    0x87897B,
+    0x888A7C,
+    0x86887A,
+    0x898B7D,
+    0x8D8F81,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x909284,
+    0x909284,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x8E9082,
+    0x8E9082,
+    0x8D8F81,
+    0x8D8F81,
+    0x8C8E80,
+    0x8C8E80,
+    0x888C7D,
+    0x878B7C,
+    0x868A7B,
+    0x868A7B,
+    0x868A7B,
+    0x848879,
+    0x808777,
+    0x7D8474,
+    0x707767,
+    0x707767,
+    0x6F7867,
+    0x6E7766,
+    0x6D7665,
+    0x6C7564,
+    0x6B7463,
+    0x6A7362,
+    0x6B7463,
+    0x6A7362,
+    0x6A7362,
+    0x697261,
+    0x687160,
+    0x67705F,
+    0x67705F,
+    0x666F5E,
+    0x687362,
+    0x687362,
+    0x677261,
+    0x677261,
+    0x667160,
+    0x65705F,
+    0x63705E,
+    0x63705E,
+    0x646F5F,
+    0x646F5F,
+    0x63705F,
+    0x657261,
+    0x657664,
+    0x677866,
+    0x667765,
+    0x667765,
+    0x647565,
+    0x627265,
+    0x627265,
+    0x5E6B62,
+    0x626F66,
+    0x56615D,
+    0x3E4945,
+    0x000903,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000D00,
+    0x000B00,
+    0x000C00,
+    0x000A00,
+    0x293426,
+    0x798174,
+    0x767C70,
+    0x7B7E73,
+    0x7C7F74,
+    0x7F8176,
+    0x808277,
+    0x818375,
+    0x828476,
+    0x858779,
+    0x87897B,
+    0x87897B,
+    0x86887A,
+    0x858779,
+    0x858779,
+    0x858779,
+    0x87897B,
+    0x898B7D,
+    0x8A8C7E,
+    0x87897B,
+    0x898B7D,
+    0x8D8F81,
+    0x8F9183,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x8E9082,
+    0x8F9183,
+    0x8F9183,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8F9183,
+    0x909284,
+    0x8C8E80,
+    0x8C8E80,
+    0x8C8E80,
+    0x8B8D7F,
+    0x8B8D7F,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x898A7C,
+    0x898A7C,
+    0x87897B,
+    0x888A7C,
+    0x898B7D,
+    0x898B7D,
+    0x888A7C,
+    0x86887A,
+    0x7D8172,
+    0x7D8172,
+    0x7C8071,
+    0x7C8071,
+    0x7B7F70,
+    0x797D6E,
+    0x787C6D,
+    0x787C6D,
+    0x757C6C,
+    0x747B6B,
+    0x737A6A,
+    0x717868,
+    0x6E7565,
+    0x6C7363,
+    0x6A7161,
+    0x697060,
+    0x6A7161,
+    0x697060,
+    0x686F5F,
+    0x676E5E,
+    0x666D5D,
+    0x656C5C,
+    0x646B5B,
+    0x636A5A,
+    0x5B6656,
+    0x5C6757,
+    0x5D6A59,
+    0x616E5D,
+    0x647360,
+    0x687764,
+    0x677866,
+    0x677866,
+    0x647666,
+    0x627466,
+    0x657568,
+    0x5D6D63,
+    0x626F66,
+    0x5B6861,
+    0x48534F,
+    0x010C04,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000D00,
+    0x000B00,
+    0x000C00,
+    0x000A00,
+    0x333E30,
+    0x798174,
+    0x757B6F,
+    0x76796E,
+    0x787B70,
+    0x7C7E73,
+    0x7E8075,
+    0x7E8072,
+    0x7E8072,
+    0x7E8072,
+    0x7F8173,
+    0x848678,
+    0x838577,
+    0x828476,
+    0x828476,
+    0x828476,
+    0x848678,
+    0x86887A,
+    0x87897B,
+    0x86887A,
+    0x898B7D,
+    0x8D8F81,
+    0x8F9183,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x919385,
+    0x929486,
+    0x929486,
+    0x909284,
+    0x8F9183,
+    0x8F9183,
+    0x919385,
+    0x939587,
+    0x919385,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x8F9183,
+    0x8F9183,
+    0x8E9082,
+    0x8E9082,
+    0x909183,
+    0x8E8F81,
+    0x8C8D7F,
+    0x8C8D7F,
+    0x8B8C7E,
+    0x8A8B7D,
+    0x88897B,
+    0x87887A,
+    0x888A7C,
+    0x888A7C,
+    0x87897B,
+    0x86887A,
+    0x838778,
+    0x838778,
+    0x828677,
+    0x828677,
+    0x808475,
+    0x7F8374,
+    0x7D8172,
+    0x7B7F70,
+    0x797D6E,
+    0x767A6B,
+    0x75796A,
+    0x747869,
+    0x767A6B,
+    0x75796A,
+    0x747869,
+    0x727667,
+    0x707465,
+    0x6E7263,
+    0x6D7162,
+    0x6C7061,
+    0x6C7465,
+    0x6B7364,
+    0x687362,
+    0x697463,
+    0x687764,
+    0x687764,
+    0x657663,
+    0x637461,
+    0x657865,
+    0x617363,
+    0x677868,
+    0x5F6F64,
+    0x5E6E64,
+    0x5D6C65,
+    0x4F5B57,
+    0x07140B,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000D00,
+    0x000B00,
+    0x000D00,
+    0x000A00,
+    0x3D483A,
+    0x7C8477,
+    0x777D71,
+    0x777A6F,
+    0x797C71,
+    0x7C7E73,
+    0x7D7F74,
+    0x7C7E70,
+    0x7A7C6E,
+    0x7A7C6E,
+    0x7A7C6E,
+    0x7B7D6F,
+    0x7B7D6F,
+    0x7B7D6F,
+    0x7C7E70,
+    0x7E8072,
+    0x808274,
+    0x828476,
+    0x838577,
+    0x87897B,
+    0x8A8C7E,
+    0x8D8F81,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x8F9183,
+    0x909284,
+    0x909284,
+    0x8E9082,
+    0x8C8E80,
+    0x8B8D7F,
+    0x8E9082,
+    0x919385,
+    0x8F9183,
+    0x8E9082,
+    0x8E9082,
+    0x8D8F81,
+    0x8D8F81,
+    0x8C8E80,
+    0x8C8E80,
+    0x8C8E80,
+    0x8E8F81,
+    0x8C8D7F,
+    0x8B8C7E,
+    0x8A8B7D,
+    0x8B8C7E,
+    0x8B8C7E,
+    0x898B7D,
+    0x888A7C,
+    0x888A7C,
+    0x87897B,
+    0x858779,
+    0x848678,
+    0x818576,
+    0x818576,
+    0x808475,
+    0x808475,
+    0x7C8373,
+    0x7C8373,
+    0x7C8373,
+    0x7B8272,
+    0x7A8171,
+    0x798070,
+    0x7B7F70,
+    0x7A7E6F,
+    0x7C8071,
+    0x7B7F70,
+    0x7A7E6F,
+    0x797D6E,
+    0x787A6C,
+    0x77796B,
+    0x76786A,
+    0x747869,
+    0x767D6D,
+    0x747D6C,
+    0x707B6A,
+    0x6F7A69,
+    0x6D7A68,
+    0x6C7967,
+    0x677865,
+    0x657663,
+    0x677A67,
+    0x607262,
+    0x677969,
+    0x617367,
+    0x5E6E63,
+    0x5E6E64,
+    0x55645D,
+    0x0F1F15,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000A00,
+    0x000D00,
+    0x000C00,
+    0x485345,
+    0x828A7D,
+    0x7D8377,
+    0x878A7F,
+    0x888B80,
+    0x8A8C81,
+    0x8A8C81,
+    0x888A7C,
+    0x888A7C,
+    0x898B7D,
+    0x8A8C7E,
+    0x86887A,
+    0x87897B,
+    0x888A7C,
+    0x898B7D,
+    0x8A8C7E,
+    0x8B8D7F,
+    0x8C8E80,
+    0x8C8E80,
+    0x888A7C,
+    0x8B8D7F,
+    0x8F9183,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x929486,
+    0x929486,
+    0x8F9183,
+    0x919385,
+    0x909284,
+    0x8D8F81,
+    0x8A8C7E,
+    0x898B7D,
+    0x8C8E80,
+    0x909284,
+    0x848678,
+    0x848678,
+    0x848678,
+    0x838577,
+    0x838577,
+    0x828476,
+    0x828476,
+    0x818375,
+    0x898A7C,
+    0x87887A,
+    0x868779,
+    0x87887A,
+    0x87897B,
+    0x888A7C,
+    0x87897B,
+    0x87897B,
+    0x888C7D,
+    0x878B7C,
+    0x85897A,
+    0x838778,
+    0x828677,
+    0x818576,
+    0x818576,
+    0x818576,
+    0x7D8675,
+    0x7D8675,
+    0x7D8675,
+    0x7D8675,
+    0x7D8675,
+    0x7C8574,
+    0x7D8474,
+    0x7D8474,
+    0x767D6D,
+    0x767D6D,
+    0x787C6D,
+    0x787C6D,
+    0x777B6C,
+    0x777B6C,
+    0x787A6C,
+    0x787A6C,
+    0x737A6A,
+    0x727969,
+    0x717A69,
+    0x717A69,
+    0x6F7C68,
+    0x6F7C68,
+    0x6A7B68,
+    0x697A67,
+    0x6A7D6A,
+    0x5F7161,
+    0x687A6A,
+    0x65776B,
+    0x5F6F64,
+    0x5E6E64,
+    0x5B6A63,
+    0x1A2A20,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000C00,
+    0x000A00,
+    0x000E00,
+    0x000E00,
+    0x4F5A4C,
+    0x868E81,
+    0x82887C,
+    0x878A7F,
+    0x888B80,
+    0x898B80,
+    0x888A7F,
+    0x888A7C,
+    0x8A8C7E,
+    0x8D8F81,
+    0x909284,
+    0x8D8F81,
+    0x8D8F81,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8D8F81,
+    0x8C8E80,
+    0x898B7D,
+    0x8C8E80,
+    0x909284,
+    0x929486,
+    0x939587,
+    0x929486,
+    0x939587,
+    0x939587,
+    0x959789,
+    0x96988A,
+    0x96988A,
+    0x939587,
+    0x8F9183,
+    0x8E9082,
+    0x919385,
+    0x959789,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x8F9183,
+    0x8F9183,
+    0x8E9082,
+    0x8E9082,
+    0x8D8F81,
+    0x8C8E80,
+    0x898B7D,
+    0x86887A,
+    0x848678,
+    0x828476,
+    0x818375,
+    0x7D8172,
+    0x7C8071,
+    0x7F8374,
+    0x7D8172,
+    0x7B7F70,
+    0x797D6E,
+    0x767D6D,
+    0x757C6C,
+    0x757C6C,
+    0x757C6C,
+    0x737E6D,
+    0x727D6C,
+    0x727D6C,
+    0x717C6B,
+    0x727B6A,
+    0x717A69,
+    0x707968,
+    0x707968,
+    0x727969,
+    0x727969,
+    0x75796A,
+    0x767A6B,
+    0x767A6B,
+    0x777B6C,
+    0x787C6D,
+    0x787C6D,
+    0x747B6B,
+    0x737A6A,
+    0x727B68,
+    0x727B68,
+    0x6F7C68,
+    0x6F7C68,
+    0x6A7C66,
+    0x697A67,
+    0x6C7F6B,
+    0x5E7060,
+    0x697B6B,
+    0x687A6E,
+    0x5E7064,
+    0x5D6E64,
+    0x5F6E67,
+    0x223228,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000E00,
+    0x000800,
+    0x001300,
+    0x000600,
+    0x000E00,
+    0x606B5B,
+    0x7C8475,
+    0x777D6F,
+    0x787C6E,
+    0x7B7F71,
+    0x818376,
+    0x86887B,
+    0x8A8C7F,
+    0x8C8E81,
+    0x8C8E81,
+    0x8B8D80,
+    0x8E9082,
+    0x8E9082,
+    0x8E9082,
+    0x8F9183,
+    0x8E9082,
+    0x8E9082,
+    0x8D8F81,
+    0x8C8E80,
+    0x8A8C7E,
+    0x8D8F81,
+    0x919385,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x949688,
+    0x939587,
+    0x929486,
+    0x929486,
+    0x848678,
+    0x848678,
+    0x848678,
+    0x838577,
+    0x818375,
+    0x818375,
+    0x828476,
+    0x828476,
+    0x848678,
+    0x848678,
+    0x838577,
+    0x838577,
+    0x848678,
+    0x86887A,
+    0x858779,
+    0x828476,
+    0x858779,
+    0x86887A,
+    0x888A7C,
+    0x888A7C,
+    0x87897B,
+    0x858779,
+    0x828476,
+    0x808274,
+    0x838578,
+    0x838578,
+    0x828477,
+    0x808275,
+    0x7F8174,
+    0x7E8073,
+    0x7C7E71,
+    0x7C7E71,
+    0x76786B,
+    0x75776A,
+    0x747669,
+    0x737568,
+    0x717366,
+    0x707265,
+    0x6F7164,
+    0x6E7063,
+    0x6B7163,
+    0x6D7365,
+    0x6F7768,
+    0x727A6B,
+    0x707D6B,
+    0x707D6B,
+    0x6D7F69,
+    0x6C7E68,
+    0x6A7D69,
+    0x687B67,
+    0x677A67,
+    0x657865,
+    0x647666,
+    0x657769,
+    0x536356,
+    0x344437,
+    0x000900,
+    0x000F00,
+    0x000900,
+    0x000700,
+    0x000900,
+    0x000D00,
+    0x000900,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000800,
+    0x001200,
+    0x000700,
+    0x031100,
+    0x6D7868,
+    0x858D7E,
+    0x808678,
+    0x84887A,
+    0x868A7C,
+    0x898B7E,
+    0x8C8E81,
+    0x8E9083,
+    0x8F9184,
+    0x909285,
+    0x909285,
+    0x8F9183,
+    0x8F9183,
+    0x8F9183,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x8A8C7E,
+    0x8D8F81,
+    0x919385,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x949688,
+    0x939587,
+    0x939587,
+    0x929486,
+    0x929486,
+    0x929486,
+    0x929486,
+    0x929486,
+    0x919385,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x8F9183,
+    0x8E9082,
+    0x8C8E80,
+    0x8A8C7E,
+    0x898B7D,
+    0x87897B,
+    0x858779,
+    0x828476,
+    0x828476,
+    0x818375,
+    0x7F8173,
+    0x7D7F71,
+    0x7C7E70,
+    0x7C7E70,
+    0x7D7F71,
+    0x7E8072,
+    0x797B6E,
+    0x797B6E,
+    0x787A6D,
+    0x76786B,
+    0x75776A,
+    0x737568,
+    0x727467,
+    0x727467,
+    0x797B6E,
+    0x797B6E,
+    0x787A6D,
+    0x76786B,
+    0x75776A,
+    0x737568,
+    0x727467,
+    0x727467,
+    0x6E7466,
+    0x6F7567,
+    0x71796A,
+    0x737B6C,
+    0x717E6C,
+    0x717E6C,
+    0x6D7F69,
+    0x6C7E68,
+    0x6B7E6A,
+    0x697C68,
+    0x697C69,
+    0x667966,
+    0x657666,
+    0x667669,
+    0x57675A,
+    0x3C4C3F,
+    0x000900,
+    0x000D00,
+    0x000A00,
+    0x000700,
+    0x000900,
+    0x000C00,
+    0x000900,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000C00,
+    0x000B00,
+    0x001100,
+    0x000900,
+    0x000E00,
+    0x737E6E,
+    0x828A7B,
+    0x7E8476,
+    0x868A7C,
+    0x868A7C,
+    0x86887B,
+    0x86887B,
+    0x87897C,
+    0x888A7D,
+    0x898B7E,
+    0x898B7E,
+    0x8B8D7F,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x8B8D7F,
+    0x8C8E80,
+    0x8E9082,
+    0x909284,
+    0x919385,
+    0x8B8D7F,
+    0x8E9082,
+    0x929486,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x959789,
+    0x949688,
+    0x949688,
+    0x939587,
+    0x848678,
+    0x858779,
+    0x858779,
+    0x858779,
+    0x858779,
+    0x858779,
+    0x848678,
+    0x838577,
+    0x848678,
+    0x848678,
+    0x86887A,
+    0x8A8C7E,
+    0x8E9082,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x8F9183,
+    0x8D8F81,
+    0x8A8C7E,
+    0x87897B,
+    0x86887A,
+    0x86887A,
+    0x87897B,
+    0x87897B,
+    0x86887B,
+    0x85877A,
+    0x848679,
+    0x838578,
+    0x828477,
+    0x808275,
+    0x7F8174,
+    0x7F8174,
+    0x7E8073,
+    0x7D7F72,
+    0x7C7E71,
+    0x7B7D70,
+    0x7A7C6F,
+    0x787A6D,
+    0x77796C,
+    0x767A6C,
+    0x717769,
+    0x71796A,
+    0x717C6C,
+    0x737E6E,
+    0x727F6D,
+    0x727F6D,
+    0x6E806A,
+    0x6D7F69,
+    0x6B7E6A,
+    0x6A7D69,
+    0x6B7E6B,
+    0x687B68,
+    0x667767,
+    0x67776A,
+    0x5D6D60,
+    0x47574A,
+    0x000A00,
+    0x000B00,
+    0x000A00,
+    0x000800,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x001000,
+    0x000F00,
+    0x000A00,
+    0x021000,
+    0x7A8575,
+    0x81897A,
+    0x7D8375,
+    0x84887A,
+    0x84887A,
+    0x848679,
+    0x848679,
+    0x848679,
+    0x838578,
+    0x848679,
+    0x848679,
+    0x898B7D,
+    0x888A7C,
+    0x888A7C,
+    0x888A7C,
+    0x898B7D,
+    0x8B8D7F,
+    0x8E9082,
+    0x8F9183,
+    0x8C8E80,
+    0x8F9183,
+    0x939587,
+    0x959789,
+    0x96988A,
+    0x959789,
+    0x959789,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x97998B,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x949688,
+    0x939587,
+    0x909485,
+    0x8E9283,
+    0x8E9283,
+    0x909485,
+    0x919586,
+    0x8F9384,
+    0x8D9182,
+    0x8D9182,
+    0x8F9384,
+    0x8F9384,
+    0x8E9283,
+    0x8D9182,
+    0x8C9081,
+    0x898D7E,
+    0x878B7C,
+    0x868A7B,
+    0x898B7D,
+    0x898B7D,
+    0x888A7C,
+    0x87897B,
+    0x86887A,
+    0x858779,
+    0x848678,
+    0x838577,
+    0x818375,
+    0x808274,
+    0x7F8173,
+    0x7E8072,
+    0x7D7F71,
+    0x7C7E70,
+    0x7B7D6F,
+    0x7A7E6F,
+    0x757B6D,
+    0x757D6E,
+    0x747F6F,
+    0x758070,
+    0x72816E,
+    0x72816E,
+    0x6E806A,
+    0x6E806A,
+    0x6B7E6A,
+    0x6B7E6A,
+    0x6D7E6C,
+    0x6A7B69,
+    0x657666,
+    0x67776A,
+    0x637164,
+    0x536154,
+    0x000E00,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000E00,
+    0x000D00,
+    0x000C00,
+    0x0C1A09,
+    0x859080,
+    0x889081,
+    0x868C7E,
+    0x8A8E80,
+    0x8A8E80,
+    0x8D8F82,
+    0x8E9083,
+    0x8E9083,
+    0x8D8F82,
+    0x8C8E81,
+    0x8C8E81,
+    0x8F9183,
+    0x8E9082,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D8F81,
+    0x8F9183,
+    0x919385,
+    0x929486,
+    0x8C8E80,
+    0x909284,
+    0x949688,
+    0x96988A,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x97998B,
+    0x97998B,
+    0x989A8C,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x949688,
+    0x929486,
+    0x919385,
+    0x929486,
+    0x939587,
+    0x939587,
+    0x929486,
+    0x909284,
+    0x949889,
+    0x909485,
+    0x909485,
+    0x949889,
+    0x949889,
+    0x909485,
+    0x8D9182,
+    0x8D9182,
+    0x888C7D,
+    0x888C7D,
+    0x888C7D,
+    0x898D7E,
+    0x898D7E,
+    0x898D7E,
+    0x888C7D,
+    0x888C7D,
+    0x86887A,
+    0x86887A,
+    0x858779,
+    0x848678,
+    0x838577,
+    0x828476,
+    0x818375,
+    0x818375,
+    0x828476,
+    0x828476,
+    0x818375,
+    0x808274,
+    0x7F8173,
+    0x7E8072,
+    0x7D7F71,
+    0x7C8071,
+    0x788071,
+    0x768171,
+    0x758271,
+    0x758271,
+    0x73826F,
+    0x72816E,
+    0x6F816B,
+    0x6F816B,
+    0x6B7E6A,
+    0x6A7D69,
+    0x6D7E6C,
+    0x6B7C6A,
+    0x677566,
+    0x69776A,
+    0x677367,
+    0x5B675B,
+    0x051604,
+    0x000900,
+    0x000900,
+    0x000D00,
+    0x000800,
+    0x000700,
+    0x000B00,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x000C00,
+    0x162413,
+    0x838E7E,
+    0x848C7D,
+    0x848A7C,
+    0x8A8E80,
+    0x8B8F81,
+    0x8E9083,
+    0x909285,
+    0x919386,
+    0x929487,
+    0x919386,
+    0x909285,
+    0x929486,
+    0x929486,
+    0x919385,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x929486,
+    0x939587,
+    0x8D8F81,
+    0x909284,
+    0x949688,
+    0x97998B,
+    0x97998B,
+    0x97998B,
+    0x97998B,
+    0x97998B,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x989A8C,
+    0x97998B,
+    0x858779,
+    0x838577,
+    0x808274,
+    0x808274,
+    0x828476,
+    0x828476,
+    0x818375,
+    0x7F8173,
+    0x727667,
+    0x6F7364,
+    0x717566,
+    0x787C6D,
+    0x7B7F70,
+    0x787C6D,
+    0x767A6B,
+    0x797D6E,
+    0x838778,
+    0x818576,
+    0x7E8273,
+    0x7D8172,
+    0x7F8374,
+    0x848879,
+    0x8A8E7F,
+    0x8D9182,
+    0x8A8C7E,
+    0x8A8C7E,
+    0x898B7D,
+    0x888A7C,
+    0x888A7C,
+    0x87897B,
+    0x86887A,
+    0x86887A,
+    0x838577,
+    0x828476,
+    0x828476,
+    0x818375,
+    0x808274,
+    0x7F8173,
+    0x7E8072,
+    0x7D8172,
+    0x7A8273,
+    0x778272,
+    0x768372,
+    0x768372,
+    0x728370,
+    0x71826F,
+    0x70826C,
+    0x70826C,
+    0x6E7F6C,
+    0x6B7C69,
+    0x6D7E6C,
+    0x6D7B6A,
+    0x687667,
+    0x6B776B,
+    0x697569,
+    0x5F6B5F,
+    0x10210F,
+    0x000A00,
+    0x000800,
+    0x000F00,
+    0x000800,
+    0x000700,
+    0x000C00,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000E00,
+    0x000A00,
+    0x000E00,
+    0x000B00,
+    0x202E1D,
+    0x7E8979,
+    0x7E8677,
+    0x7F8577,
+    0x868A7C,
+    0x868A7C,
+    0x888A7D,
+    0x8A8C7F,
+    0x8C8E81,
+    0x8D8F82,
+    0x8F9184,
+    0x8F9184,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x929486,
+    0x8E9082,
+    0x919385,
+    0x959789,
+    0x97998B,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x9C9E90,
+    0x989A8C,
+    0x949688,
+    0x939587,
+    0x959789,
+    0x96988A,
+    0x959789,
+    0x939587,
+    0x929989,
+    0x8D9484,
+    0x8C9383,
+    0x919888,
+    0x8F9686,
+    0x878E7E,
+    0x838A7A,
+    0x848B7B,
+    0x7F8676,
+    0x7D8474,
+    0x798070,
+    0x777E6E,
+    0x798070,
+    0x7D8474,
+    0x838A7A,
+    0x898D7E,
+    0x878B7A,
+    0x888B7A,
+    0x878A79,
+    0x878A79,
+    0x868978,
+    0x858877,
+    0x858877,
+    0x848776,
+    0x838675,
+    0x838675,
+    0x828574,
+    0x818473,
+    0x818473,
+    0x808372,
+    0x7F8271,
+    0x7E8273,
+    0x798473,
+    0x778473,
+    0x768473,
+    0x758372,
+    0x728370,
+    0x71826F,
+    0x70836D,
+    0x6F826C,
+    0x71826F,
+    0x6C7D6A,
+    0x6F7D6C,
+    0x6F7D6C,
+    0x6B7769,
+    0x6C786C,
+    0x6C766B,
+    0x616D61,
+    0x1C2A19,
+    0x000C00,
+    0x000700,
+    0x000F00,
+    0x000800,
+    0x000800,
+    0x000D00,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000E00,
+    0x000800,
+    0x001000,
+    0x000D00,
+    0x2B3928,
+    0x828D7D,
+    0x858D7E,
+    0x878D7F,
+    0x888C7E,
+    0x878B7D,
+    0x888A7D,
+    0x888A7D,
+    0x8A8C7F,
+    0x8D8F82,
+    0x909285,
+    0x929487,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x8E9082,
+    0x919385,
+    0x959789,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x939587,
+    0x8D8F81,
+    0x8C8E80,
+    0x8D8F81,
+    0x8F9183,
+    0x8E9082,
+    0x8D8F81,
+    0x8C9383,
+    0x878E7E,
+    0x899080,
+    0x929989,
+    0x949B8B,
+    0x8E9585,
+    0x8C9383,
+    0x8F9686,
+    0x8F9686,
+    0x8E9585,
+    0x8C9383,
+    0x8B9282,
+    0x8A9181,
+    0x8B9282,
+    0x8B9282,
+    0x8E9283,
+    0x898D7C,
+    0x8A8D7C,
+    0x8A8D7C,
+    0x898C7B,
+    0x888B7A,
+    0x888B7A,
+    0x878A79,
+    0x878A79,
+    0x838675,
+    0x838675,
+    0x838675,
+    0x828574,
+    0x818473,
+    0x808372,
+    0x808372,
+    0x7F8374,
+    0x798473,
+    0x778473,
+    0x768473,
+    0x758372,
+    0x728370,
+    0x71826F,
+    0x70836D,
+    0x70836D,
+    0x738471,
+    0x6D7E6B,
+    0x707E6D,
+    0x707E6D,
+    0x6D796B,
+    0x6E7A6E,
+    0x6D776C,
+    0x616D61,
+    0x22301F,
+    0x000E00,
+    0x000700,
+    0x000F00,
+    0x000800,
+    0x000800,
+    0x000E00,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000E00,
+    0x000C00,
+    0x364433,
+    0x838E80,
+    0x7F877A,
+    0x848A7E,
+    0x8C8F84,
+    0x8C8F84,
+    0x8E9085,
+    0x8E9085,
+    0x8F9183,
+    0x919385,
+    0x929486,
+    0x939587,
+    0x909284,
+    0x919385,
+    0x939587,
+    0x949688,
+    0x949688,
+    0x949688,
+    0x939587,
+    0x939587,
+    0x8D8F81,
+    0x949688,
+    0x999B8D,
+    0x9A9C8E,
+    0x999B8D,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x97998B,
+    0x97998B,
+    0x949688,
+    0x909284,
+    0x8F9183,
+    0x8F9183,
+    0x8D8F81,
+    0x898B7D,
+    0x85897A,
+    0x878B7C,
+    0x8B8F80,
+    0x8F9384,
+    0x929687,
+    0x939788,
+    0x929687,
+    0x929687,
+    0x919586,
+    0x919586,
+    0x919586,
+    0x8F9384,
+    0x8E9283,
+    0x8D9182,
+    0x8E9283,
+    0x909485,
+    0x8A8E7F,
+    0x898D7E,
+    0x898D7E,
+    0x888C7D,
+    0x878B7C,
+    0x878B7C,
+    0x868A7B,
+    0x868A7B,
+    0x848879,
+    0x838778,
+    0x838778,
+    0x828677,
+    0x818576,
+    0x808475,
+    0x808475,
+    0x7E8575,
+    0x788675,
+    0x768775,
+    0x758674,
+    0x748573,
+    0x748572,
+    0x738471,
+    0x73856F,
+    0x73856F,
+    0x728370,
+    0x70816E,
+    0x6F806E,
+    0x6E7F6D,
+    0x6D7E6E,
+    0x6A7A6D,
+    0x667669,
+    0x637368,
+    0x324237,
+    0x000C01,
+    0x000A00,
+    0x000700,
+    0x000F00,
+    0x000B00,
+    0x000700,
+    0x000C00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000E00,
+    0x001200,
+    0x010F00,
+    0x3F4D3C,
+    0x869183,
+    0x838B7E,
+    0x888E82,
+    0x85887D,
+    0x85887D,
+    0x85877C,
+    0x84867B,
+    0x838577,
+    0x838577,
+    0x838577,
+    0x838577,
+    0x808274,
+    0x828476,
+    0x858779,
+    0x898B7D,
+    0x8E9082,
+    0x939587,
+    0x97998B,
+    0x999B8D,
+    0x8E9082,
+    0x959789,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9D9F91,
+    0x9EA092,
+    0x9D9F91,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x97998B,
+    0x929486,
+    0x929687,
+    0x949889,
+    0x95998A,
+    0x979B8C,
+    0x979B8C,
+    0x969A8B,
+    0x949889,
+    0x939788,
+    0x8F9384,
+    0x8F9384,
+    0x8F9384,
+    0x8E9283,
+    0x8E9283,
+    0x8D9182,
+    0x8C9081,
+    0x8B8F80,
+    0x8B8F80,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x888C7D,
+    0x878B7C,
+    0x878B7C,
+    0x868A7B,
+    0x888C7D,
+    0x878B7C,
+    0x878B7C,
+    0x868A7B,
+    0x85897A,
+    0x848879,
+    0x848879,
+    0x818878,
+    0x788675,
+    0x768775,
+    0x758674,
+    0x758674,
+    0x748572,
+    0x748572,
+    0x748670,
+    0x748670,
+    0x728370,
+    0x71826F,
+    0x6F806E,
+    0x6E7F6D,
+    0x6D7E6E,
+    0x6A7A6D,
+    0x67776A,
+    0x647469,
+    0x3D4D42,
+    0x000C01,
+    0x000B00,
+    0x000800,
+    0x000F00,
+    0x000A00,
+    0x000700,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000D00,
+    0x001000,
+    0x000E00,
+    0x485645,
+    0x848F81,
+    0x848C7F,
+    0x878D81,
+    0x8C8F84,
+    0x8C8F84,
+    0x8E9085,
+    0x8F9186,
+    0x909284,
+    0x929486,
+    0x939587,
+    0x939587,
+    0x9A9C8E,
+    0x999B8D,
+    0x97998B,
+    0x949688,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x8E9082,
+    0x959789,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9C9E90,
+    0x9C9E90,
+    0x9C9E90,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x8F9183,
+    0x8F9183,
+    0x8C8E80,
+    0x888A7C,
+    0x87897B,
+    0x888A7C,
+    0x86887A,
+    0x838577,
+    0x8B8F80,
+    0x8B8F80,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x878B7C,
+    0x85897A,
+    0x848879,
+    0x929687,
+    0x909485,
+    0x8F9384,
+    0x909485,
+    0x919586,
+    0x919586,
+    0x8E9283,
+    0x8C9081,
+    0x8C9081,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x888C7D,
+    0x878B7C,
+    0x868A7B,
+    0x85897A,
+    0x848879,
+    0x848879,
+    0x838778,
+    0x828677,
+    0x818576,
+    0x818576,
+    0x808475,
+    0x7E8575,
+    0x798776,
+    0x778876,
+    0x768775,
+    0x768775,
+    0x768774,
+    0x768774,
+    0x768872,
+    0x768872,
+    0x738471,
+    0x728370,
+    0x70816F,
+    0x6F806E,
+    0x6E7F6F,
+    0x6B7B6E,
+    0x68786B,
+    0x65756A,
+    0x4C5C51,
+    0x000D02,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x000800,
+    0x000700,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000B00,
+    0x000E00,
+    0x000E00,
+    0x546251,
+    0x828D7F,
+    0x858D80,
+    0x868C80,
+    0x84877C,
+    0x85887D,
+    0x888A7F,
+    0x8A8C81,
+    0x8D8F81,
+    0x8E9082,
+    0x909284,
+    0x919385,
+    0x929486,
+    0x929486,
+    0x929486,
+    0x939587,
+    0x959789,
+    0x96988A,
+    0x97998B,
+    0x989A8C,
+    0x8F9183,
+    0x96988A,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9C9E90,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9C9E90,
+    0x9C9E90,
+    0x9C9E90,
+    0x9D9F91,
+    0x9D9F91,
+    0x9C9E90,
+    0x9C9E90,
+    0x9C9E90,
+    0xA6A89A,
+    0xA3A597,
+    0x9C9E90,
+    0x959789,
+    0x949688,
+    0x97998B,
+    0x989A8C,
+    0x96988A,
+    0x969A8B,
+    0x969A8B,
+    0x969A8B,
+    0x95998A,
+    0x949889,
+    0x939788,
+    0x929687,
+    0x919586,
+    0x868A7B,
+    0x828677,
+    0x7F8374,
+    0x808475,
+    0x848879,
+    0x868A7B,
+    0x848879,
+    0x818576,
+    0x7F8374,
+    0x7E8273,
+    0x7D8172,
+    0x7C8071,
+    0x7A7E6F,
+    0x797D6E,
+    0x787C6D,
+    0x777B6C,
+    0x7F8374,
+    0x7F8374,
+    0x7E8273,
+    0x7D8172,
+    0x7C8071,
+    0x7C8071,
+    0x7B7F70,
+    0x798070,
+    0x768473,
+    0x738472,
+    0x738472,
+    0x738472,
+    0x738471,
+    0x738471,
+    0x748670,
+    0x748670,
+    0x748572,
+    0x738471,
+    0x718270,
+    0x718270,
+    0x6F8070,
+    0x6D7D70,
+    0x69796C,
+    0x66766B,
+    0x59695E,
+    0x000D02,
+    0x000900,
+    0x000E00,
+    0x000C00,
+    0x000700,
+    0x000A00,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000E00,
+    0x000C00,
+    0x001000,
+    0x021000,
+    0x647261,
+    0x838E80,
+    0x8A9285,
+    0x888E82,
+    0x8A8D82,
+    0x8B8E83,
+    0x8C8E83,
+    0x8D8F84,
+    0x8D8F81,
+    0x8D8F81,
+    0x8C8E80,
+    0x8C8E80,
+    0x86887A,
+    0x888A7C,
+    0x8D8F81,
+    0x929486,
+    0x96988A,
+    0x989A8C,
+    0x999B8D,
+    0x999B8D,
+    0x909284,
+    0x97998B,
+    0x9C9E90,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9D9F91,
+    0x9D9F91,
+    0x9C9E90,
+    0x9C9E90,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9C9E90,
+    0x9A9C8E,
+    0x989A8C,
+    0x939587,
+    0x8E9082,
+    0x8D8F81,
+    0x909284,
+    0x919385,
+    0x8F9183,
+    0x8C9081,
+    0x8B8F80,
+    0x8B8F80,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x898D7E,
+    0x888C7D,
+    0x939788,
+    0x8E9283,
+    0x8A8E7F,
+    0x8B8F80,
+    0x8F9384,
+    0x939788,
+    0x939788,
+    0x929687,
+    0x919586,
+    0x909485,
+    0x8F9384,
+    0x8E9283,
+    0x8C9081,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x838778,
+    0x828677,
+    0x828677,
+    0x818576,
+    0x808475,
+    0x7F8374,
+    0x7F8374,
+    0x7D8474,
+    0x738170,
+    0x718270,
+    0x70816F,
+    0x70816F,
+    0x70816E,
+    0x71826F,
+    0x71836D,
+    0x71836D,
+    0x758673,
+    0x748572,
+    0x738472,
+    0x728371,
+    0x718272,
+    0x6F7F72,
+    0x6B7B6E,
+    0x68786D,
+    0x617166,
+    0x011106,
+    0x000900,
+    0x000C00,
+    0x000B00,
+    0x000800,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000E00,
+    0x000B00,
+    0x000E00,
+    0x010F00,
+    0x707E6D,
+    0x818C7E,
+    0x8B9386,
+    0x878D81,
+    0x8F9287,
+    0x909388,
+    0x93958A,
+    0x94968B,
+    0x959789,
+    0x959789,
+    0x949688,
+    0x949688,
+    0x929486,
+    0x949688,
+    0x97998B,
+    0x999B8D,
+    0x9A9C8E,
+    0x989A8C,
+    0x959789,
+    0x939587,
+    0x919385,
+    0x97998B,
+    0x9D9F91,
+    0x9D9F91,
+    0x9C9E90,
+    0x9D9F91,
+    0x9EA092,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9EA092,
+    0x9EA092,
+    0x9EA092,
+    0x9EA092,
+    0x9D9F91,
+    0x9D9F91,
+    0x9B9D8F,
+    0x9C9E90,
+    0x9C9E90,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9EA092,
+    0x9C9E90,
+    0x989A8C,
+    0x979B8C,
+    0x979B8C,
+    0x979B8C,
+    0x969A8B,
+    0x95998A,
+    0x949889,
+    0x929687,
+    0x919586,
+    0x8D9182,
+    0x8A8E7F,
+    0x878B7C,
+    0x868A7B,
+    0x898D7E,
+    0x8C9081,
+    0x8D9182,
+    0x8D9182,
+    0x8C9081,
+    0x8C9081,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x878B7C,
+    0x878B7C,
+    0x868A7B,
+    0x888C7D,
+    0x878B7C,
+    0x878B7C,
+    0x868A7B,
+    0x85897A,
+    0x848879,
+    0x848879,
+    0x818878,
+    0x7A8877,
+    0x778876,
+    0x778876,
+    0x768775,
+    0x768774,
+    0x778875,
+    0x778973,
+    0x778973,
+    0x768774,
+    0x758673,
+    0x748573,
+    0x738472,
+    0x728373,
+    0x708073,
+    0x6D7D70,
+    0x6A7A6F,
+    0x647469,
+    0x0A1A0F,
+    0x000C00,
+    0x000800,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000900,
+    0x000D00,
+    0x010F00,
+    0x798776,
+    0x808B7D,
+    0x8B9386,
+    0x868C80,
+    0x82857A,
+    0x83867B,
+    0x87897E,
+    0x898B80,
+    0x8B8D7F,
+    0x8C8E80,
+    0x8C8E80,
+    0x8C8E80,
+    0x8B8D7F,
+    0x8D8F81,
+    0x919385,
+    0x959789,
+    0x97998B,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x919385,
+    0x989A8C,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9EA092,
+    0x9EA092,
+    0x9D9F91,
+    0x9EA092,
+    0x9EA092,
+    0x9EA092,
+    0x9FA193,
+    0x9FA193,
+    0x9EA092,
+    0x9EA092,
+    0x9EA092,
+    0xA0A294,
+    0xA0A294,
+    0x9EA092,
+    0x9B9D8F,
+    0x9C9E90,
+    0x9FA193,
+    0x9FA193,
+    0x9D9F91,
+    0x989C8D,
+    0x999D8E,
+    0x9A9E8F,
+    0x9A9E8F,
+    0x999D8E,
+    0x979B8C,
+    0x95998A,
+    0x939788,
+    0x95998A,
+    0x949889,
+    0x949889,
+    0x939788,
+    0x939788,
+    0x939788,
+    0x929687,
+    0x929687,
+    0x919586,
+    0x909485,
+    0x909485,
+    0x8F9384,
+    0x8E9283,
+    0x8D9182,
+    0x8C9081,
+    0x8C9081,
+    0x898D7E,
+    0x898D7E,
+    0x888C7D,
+    0x888C7D,
+    0x878B7C,
+    0x868A7B,
+    0x85897A,
+    0x838A7A,
+    0x808E7D,
+    0x7D8E7C,
+    0x7D8E7C,
+    0x7C8D7B,
+    0x7C8D7A,
+    0x7B8C79,
+    0x7C8E78,
+    0x7C8E78,
+    0x768774,
+    0x758673,
+    0x748573,
+    0x748573,
+    0x738474,
+    0x718174,
+    0x6E7E71,
+    0x6B7B70,
+    0x66766B,
+    0x16261B,
+    0x011202,
+    0x000700,
+    0x000C00,
+    0x000B00,
+    0x000700,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x001100,
+    0x000C00,
+    0x001000,
+    0x041201,
+    0x82907F,
+    0x838E80,
+    0x90988B,
+    0x898F83,
+    0x93968B,
+    0x94978C,
+    0x96988D,
+    0x97998E,
+    0x97998B,
+    0x959789,
+    0x949688,
+    0x939587,
+    0x959789,
+    0x96988A,
+    0x97998B,
+    0x989A8C,
+    0x999B8D,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x929486,
+    0x989A8C,
+    0x9EA092,
+    0x9EA092,
+    0x9D9F91,
+    0x9EA092,
+    0x9FA193,
+    0x9D9F91,
+    0x9EA092,
+    0x9EA092,
+    0x9FA193,
+    0x9FA193,
+    0x9FA193,
+    0x9FA193,
+    0x9EA092,
+    0x9EA092,
+    0x949688,
+    0x909284,
+    0x87897B,
+    0x7F8173,
+    0x7E8072,
+    0x848678,
+    0x888A7C,
+    0x898B7D,
+    0x8F9384,
+    0x919586,
+    0x939788,
+    0x95998A,
+    0x95998A,
+    0x939788,
+    0x919586,
+    0x909485,
+    0x949889,
+    0x969A8B,
+    0x979B8C,
+    0x979B8C,
+    0x949889,
+    0x919586,
+    0x8F9384,
+    0x8E9283,
+    0x8F9384,
+    0x8F9384,
+    0x8E9283,
+    0x8E9283,
+    0x8D9182,
+    0x8C9081,
+    0x8C9081,
+    0x8B8F80,
+    0x8B8F80,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x898D7E,
+    0x888C7D,
+    0x878B7C,
+    0x858C7C,
+    0x7E8C7B,
+    0x7B8C7A,
+    0x7A8B79,
+    0x798A78,
+    0x798A77,
+    0x788976,
+    0x788A74,
+    0x788A74,
+    0x778875,
+    0x768774,
+    0x758674,
+    0x758674,
+    0x748575,
+    0x728275,
+    0x6E7E71,
+    0x6C7C71,
+    0x67776C,
+    0x1F2F24,
+    0x061707,
+    0x000700,
+    0x000E00,
+    0x000C00,
+    0x000700,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000E00,
+    0x000800,
+    0x031100,
+    0x0E1B0A,
+    0x838E7E,
+    0x888E80,
+    0x81877B,
+    0x85887D,
+    0x8B8D82,
+    0x8D8F84,
+    0x909189,
+    0x91928A,
+    0x92938B,
+    0x94958D,
+    0x949790,
+    0x969990,
+    0x8F9587,
+    0x929989,
+    0x929989,
+    0x919888,
+    0x95998A,
+    0x999D8E,
+    0x9A9E8F,
+    0x999D8E,
+    0x929687,
+    0x999D8E,
+    0x9FA193,
+    0x9EA092,
+    0x9EA092,
+    0x9FA193,
+    0xA0A294,
+    0x9FA193,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0x9C9E90,
+    0x9A9C8E,
+    0x989A8C,
+    0x96988A,
+    0x939587,
+    0x8F9183,
+    0x8B8D7F,
+    0x888A7C,
+    0x848879,
+    0x818576,
+    0x838778,
+    0x878B7C,
+    0x838778,
+    0x7C8071,
+    0x7E8273,
+    0x868A7B,
+    0x818576,
+    0x848879,
+    0x7D8172,
+    0x707465,
+    0x727667,
+    0x7F8374,
+    0x7E8273,
+    0x6F7666,
+    0x6F7A69,
+    0x75806F,
+    0x7B8473,
+    0x7E8273,
+    0x828476,
+    0x8A8B7D,
+    0x8E9082,
+    0x8E9283,
+    0x8B9282,
+    0x889180,
+    0x85907F,
+    0x868F7E,
+    0x868F7E,
+    0x898D7E,
+    0x8A8B7D,
+    0x888A7C,
+    0x818C7B,
+    0x7E8D7A,
+    0x7D8C79,
+    0x7C8B78,
+    0x7B8A77,
+    0x7B8A77,
+    0x7C8977,
+    0x7C8977,
+    0x7C8977,
+    0x7B8876,
+    0x798674,
+    0x798674,
+    0x788573,
+    0x778472,
+    0x74816F,
+    0x727F6D,
+    0x6B7C6A,
+    0x2F402E,
+    0x021301,
+    0x000900,
+    0x000900,
+    0x000700,
+    0x000D00,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000700,
+    0x021000,
+    0x162312,
+    0x889383,
+    0x8F9587,
+    0x8B9185,
+    0x909388,
+    0x8D8F84,
+    0x8E9085,
+    0x8E8F87,
+    0x8D8E86,
+    0x8B8C84,
+    0x8A8B83,
+    0x888B82,
+    0x898C81,
+    0x858B7D,
+    0x888F7F,
+    0x8A9181,
+    0x8A9181,
+    0x8E9283,
+    0x939788,
+    0x969A8B,
+    0x95998A,
+    0x939788,
+    0x999D8E,
+    0x9FA193,
+    0x9FA193,
+    0x9EA092,
+    0x9FA193,
+    0xA0A294,
+    0x9FA193,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0xA1A395,
+    0x9D9F91,
+    0x9C9E90,
+    0x9EA092,
+    0xA2A496,
+    0xA5A799,
+    0xA4A698,
+    0x9EA092,
+    0x989A8C,
+    0x9DA192,
+    0x9B9F90,
+    0x9DA192,
+    0xA1A596,
+    0x9FA394,
+    0x999D8E,
+    0x9B9F90,
+    0xA2A697,
+    0x969A8B,
+    0x999D8E,
+    0x95998A,
+    0x8F9384,
+    0x919586,
+    0x989C8D,
+    0x949889,
+    0x868D7D,
+    0x7D8877,
+    0x818C7B,
+    0x858E7D,
+    0x85897A,
+    0x87897B,
+    0x8C8D7F,
+    0x8E9283,
+    0x8D9484,
+    0x899281,
+    0x85907F,
+    0x82917E,
+    0x828F7D,
+    0x838E7D,
+    0x868D7D,
+    0x878B7C,
+    0x848B7B,
+    0x83907E,
+    0x7F907D,
+    0x81907D,
+    0x808F7C,
+    0x7F8E7B,
+    0x7F8E7B,
+    0x7E8D7A,
+    0x7E8D7A,
+    0x7B8A77,
+    0x7A8976,
+    0x798875,
+    0x788774,
+    0x788774,
+    0x768572,
+    0x73826F,
+    0x71806D,
+    0x6B7C6A,
+    0x3B4C3A,
+    0x000F00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000C00,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000A00,
+    0x021000,
+    0x202D1C,
+    0x879282,
+    0x8D9385,
+    0x888E80,
+    0x8E9284,
+    0x97998E,
+    0x989A8F,
+    0x9A9C91,
+    0x9A9C91,
+    0x9A9C91,
+    0x999B90,
+    0x999C93,
+    0x9A9D92,
+    0x979D8F,
+    0x99A090,
+    0x99A090,
+    0x969D8D,
+    0x979B8C,
+    0x9A9E8F,
+    0x9A9E8F,
+    0x989C8D,
+    0x939788,
+    0x9A9E8F,
+    0x9FA193,
+    0x9FA193,
+    0x9FA193,
+    0xA0A294,
+    0xA1A395,
+    0xA0A294,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA5A799,
+    0x9A9C8E,
+    0x8C8E80,
+    0x858779,
+    0x86887A,
+    0x8A8C7E,
+    0x8C8E80,
+    0x8B8D7F,
+    0x8B8F80,
+    0x898D7E,
+    0x8B8F80,
+    0x8F9384,
+    0x8D9182,
+    0x898D7E,
+    0x8B8F80,
+    0x919586,
+    0x969A8B,
+    0x95998A,
+    0x929687,
+    0x919586,
+    0x939788,
+    0x95998A,
+    0x919586,
+    0x899080,
+    0x8A9382,
+    0x8C9584,
+    0x8C9383,
+    0x8B8D7F,
+    0x8A8C7E,
+    0x8E8F81,
+    0x8E9283,
+    0x8D9484,
+    0x8A9584,
+    0x889583,
+    0x839481,
+    0x829380,
+    0x859481,
+    0x869381,
+    0x869180,
+    0x848F7E,
+    0x81907D,
+    0x7F907D,
+    0x7F907D,
+    0x7E8F7C,
+    0x7D8E7B,
+    0x7C8D7A,
+    0x7B8C79,
+    0x7A8B78,
+    0x7A8B78,
+    0x798A77,
+    0x788976,
+    0x778875,
+    0x778875,
+    0x758673,
+    0x728370,
+    0x70816E,
+    0x6B7C6A,
+    0x4D5E4C,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D00,
+    0x000C00,
+    0x010F00,
+    0x2C3928,
+    0x869181,
+    0x8A9082,
+    0x858B7D,
+    0x8C9082,
+    0x808275,
+    0x838578,
+    0x86887B,
+    0x888A7D,
+    0x898B80,
+    0x8A8C81,
+    0x8C8F84,
+    0x8D9085,
+    0x878E7E,
+    0x8A9181,
+    0x8C9383,
+    0x8D9484,
+    0x929687,
+    0x989C8D,
+    0x9B9F90,
+    0x9A9E8F,
+    0x949889,
+    0x9A9E8F,
+    0xA0A294,
+    0xA0A294,
+    0x9FA193,
+    0xA1A395,
+    0xA2A496,
+    0xA1A395,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA1A395,
+    0x9FA193,
+    0x9D9F91,
+    0x9FA193,
+    0xA1A395,
+    0xA1A395,
+    0x9C9E90,
+    0x989A8C,
+    0x95998A,
+    0x949889,
+    0x95998A,
+    0x979B8C,
+    0x969A8B,
+    0x929687,
+    0x949889,
+    0x989C8D,
+    0x8D9182,
+    0x878B7C,
+    0x828677,
+    0x838778,
+    0x85897A,
+    0x85897A,
+    0x848879,
+    0x85897A,
+    0x87907F,
+    0x878E7E,
+    0x858C7C,
+    0x86887A,
+    0x858779,
+    0x87897B,
+    0x888C7D,
+    0x87907F,
+    0x869381,
+    0x81927F,
+    0x7F927E,
+    0x7E917D,
+    0x7E917D,
+    0x81907D,
+    0x808F7C,
+    0x7F8E7B,
+    0x7E8F7C,
+    0x7D907C,
+    0x7E917D,
+    0x7D907C,
+    0x7D907C,
+    0x7B8E7A,
+    0x7A8D79,
+    0x798C78,
+    0x7A8D79,
+    0x798C78,
+    0x768C77,
+    0x758B76,
+    0x758B76,
+    0x738974,
+    0x708671,
+    0x70836F,
+    0x697C69,
+    0x5E6F5D,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000D00,
+    0x000D00,
+    0x3C4938,
+    0x8A9585,
+    0x8F9587,
+    0x8B9183,
+    0x939789,
+    0x989A8D,
+    0x9A9C8F,
+    0x9B9D90,
+    0x9B9D90,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9A9E8F,
+    0x9A9E8F,
+    0x909787,
+    0x929989,
+    0x939A8A,
+    0x919888,
+    0x95998A,
+    0x989C8D,
+    0x999D8E,
+    0x989C8D,
+    0x95998A,
+    0x9B9F90,
+    0xA1A395,
+    0xA1A395,
+    0xA0A294,
+    0xA2A496,
+    0xA2A496,
+    0xA2A496,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA1A395,
+    0xA2A496,
+    0xA2A496,
+    0xA1A395,
+    0x9FA193,
+    0x9D9F91,
+    0x9C9E90,
+    0x9C9E90,
+    0x9CA091,
+    0x9B9F90,
+    0x9B9F90,
+    0x9CA091,
+    0x9B9F90,
+    0x989C8D,
+    0x989C8D,
+    0x9A9E8F,
+    0xA0A495,
+    0x9A9E8F,
+    0x969A8B,
+    0x989C8D,
+    0x999D8E,
+    0x979B8C,
+    0x979B8C,
+    0x9A9E8F,
+    0x909988,
+    0x8F9686,
+    0x8E9283,
+    0x8F9183,
+    0x909183,
+    0x909183,
+    0x8F9384,
+    0x8E9585,
+    0x8A9785,
+    0x879683,
+    0x839682,
+    0x829581,
+    0x839481,
+    0x859481,
+    0x859280,
+    0x84917F,
+    0x82917E,
+    0x81927F,
+    0x81927F,
+    0x81927F,
+    0x80917E,
+    0x7F907D,
+    0x7D907C,
+    0x7D907C,
+    0x7B8E7A,
+    0x7A8D79,
+    0x778D78,
+    0x768C77,
+    0x768C77,
+    0x748A75,
+    0x708872,
+    0x6F8570,
+    0x6A7D6A,
+    0x677866,
+    0x001100,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000800,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x001000,
+    0x000C00,
+    0x485544,
+    0x899484,
+    0x8C9284,
+    0x888E80,
+    0x919587,
+    0x959789,
+    0x96988A,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x959988,
+    0x969A89,
+    0x9DA494,
+    0x9EA595,
+    0x9DA494,
+    0x99A090,
+    0x9A9E8F,
+    0x9B9F90,
+    0x9B9F90,
+    0x989C8D,
+    0x95998A,
+    0x9CA091,
+    0xA2A496,
+    0xA2A496,
+    0xA1A395,
+    0xA2A496,
+    0xA3A597,
+    0xA2A496,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA3A597,
+    0xA7A99B,
+    0xA1A395,
+    0x959789,
+    0x898B7D,
+    0x828476,
+    0x848678,
+    0x8D8F81,
+    0x959789,
+    0x8F9384,
+    0x8E9283,
+    0x8E9283,
+    0x8D9182,
+    0x8C9081,
+    0x8B8F80,
+    0x8A8E7F,
+    0x8A8E7F,
+    0x8D9182,
+    0x8B8F80,
+    0x8C9081,
+    0x8E9283,
+    0x8F9384,
+    0x8C9081,
+    0x888C7D,
+    0x878B7C,
+    0x949D8C,
+    0x919888,
+    0x909485,
+    0x939486,
+    0x929385,
+    0x929083,
+    0x8E9082,
+    0x8E9283,
+    0x8B9483,
+    0x879281,
+    0x849380,
+    0x84917F,
+    0x84917F,
+    0x87907F,
+    0x868F7E,
+    0x858E7D,
+    0x828D7C,
+    0x818E7C,
+    0x7F8E7B,
+    0x7F8E7B,
+    0x7F8E7B,
+    0x7F8E7B,
+    0x7E8F7C,
+    0x7E8F7C,
+    0x7C8F7B,
+    0x7B8E7A,
+    0x7A8D79,
+    0x798C78,
+    0x778D78,
+    0x758B76,
+    0x728873,
+    0x728571,
+    0x6D806D,
+    0x687967,
+    0x0E1F0D,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x011202,
+    0x000C00,
+    0x525F4E,
+    0x889383,
+    0x8A9082,
+    0x858C7C,
+    0x8F9384,
+    0x87897B,
+    0x898B7D,
+    0x8C8F7E,
+    0x8D907F,
+    0x8D907F,
+    0x8E9180,
+    0x8E9281,
+    0x909483,
+    0x818878,
+    0x858C7C,
+    0x888F7F,
+    0x899080,
+    0x909485,
+    0x969A8B,
+    0x9A9E8F,
+    0x9A9E8F,
+    0x969A8B,
+    0x9CA091,
+    0xA2A496,
+    0xA2A496,
+    0xA1A395,
+    0xA3A597,
+    0xA4A698,
+    0xA3A597,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA1A395,
+    0xA3A597,
+    0xA4A698,
+    0xA5A799,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA5A799,
+    0x9FA394,
+    0x9FA394,
+    0x9EA293,
+    0x9DA192,
+    0x9DA192,
+    0x9DA192,
+    0x9CA091,
+    0x9B9F90,
+    0x939788,
+    0x95998A,
+    0x969A8B,
+    0x95998A,
+    0x95998A,
+    0x95998A,
+    0x919586,
+    0x8D9182,
+    0x8A9382,
+    0x868D7D,
+    0x868A7B,
+    0x8A8B7D,
+    0x8A8B7D,
+    0x888679,
+    0x848577,
+    0x838577,
+    0x848879,
+    0x818878,
+    0x7C8776,
+    0x7D8675,
+    0x7E8776,
+    0x818576,
+    0x818274,
+    0x808173,
+    0x818A79,
+    0x7E8978,
+    0x7D8877,
+    0x7C8776,
+    0x7C8977,
+    0x7D8A78,
+    0x7E8D7A,
+    0x808F7C,
+    0x7E8F7C,
+    0x7D8E7B,
+    0x7B8E7A,
+    0x7A8D79,
+    0x7A8D79,
+    0x788B77,
+    0x738974,
+    0x738672,
+    0x718471,
+    0x657664,
+    0x1F301E,
+    0x000C00,
+    0x000A00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x001101,
+    0x000B00,
+    0x5A6756,
+    0x8D9888,
+    0x919789,
+    0x8E9585,
+    0x999D8E,
+    0x97998B,
+    0x999B8D,
+    0x9B9E8D,
+    0x9B9E8D,
+    0x9B9E8D,
+    0x9B9E8D,
+    0x9A9F8B,
+    0x9CA08F,
+    0x9BA290,
+    0x9CA393,
+    0x9BA292,
+    0x989F8F,
+    0x9A9E8F,
+    0x9CA091,
+    0x9CA091,
+    0x9A9E8F,
+    0x969A8B,
+    0x9DA192,
+    0xA3A597,
+    0xA3A597,
+    0xA2A496,
+    0xA3A597,
+    0xA4A698,
+    0xA3A597,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA2A496,
+    0x9EA092,
+    0x999B8D,
+    0x959789,
+    0x959789,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x9CA091,
+    0x9CA091,
+    0x9B9F90,
+    0x9B9F90,
+    0x9B9F90,
+    0x9CA091,
+    0x9CA091,
+    0x9A9E8F,
+    0x9CA091,
+    0x9EA293,
+    0x9CA091,
+    0x969A8B,
+    0x95998A,
+    0x999D8E,
+    0x9A9E8F,
+    0x969A8B,
+    0x949D8C,
+    0x919888,
+    0x929687,
+    0x98998B,
+    0x9B998C,
+    0x989488,
+    0x949285,
+    0x929385,
+    0x929486,
+    0x8F9384,
+    0x8B9282,
+    0x8D9182,
+    0x8E9082,
+    0x918F82,
+    0x918D81,
+    0x8F8D80,
+    0x868A7B,
+    0x818A79,
+    0x808978,
+    0x7F8877,
+    0x7E8978,
+    0x808B7A,
+    0x828F7D,
+    0x84917F,
+    0x808F7C,
+    0x7F8E7B,
+    0x7C8D7A,
+    0x7B8C79,
+    0x7A8D79,
+    0x788B77,
+    0x768975,
+    0x738672,
+    0x758674,
+    0x627361,
+    0x2A3B29,
+    0x000C00,
+    0x000A00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000E00,
+    0x000D00,
+    0x000D00,
+    0x657261,
+    0x889383,
+    0x848A7C,
+    0x848B7B,
+    0x888C7D,
+    0x8F9183,
+    0x8F9183,
+    0x919385,
+    0x929486,
+    0x939685,
+    0x949786,
+    0x949887,
+    0x949887,
+    0x9A9C8E,
+    0x9C9E90,
+    0x9D9F91,
+    0x9C9E90,
+    0x9C9E90,
+    0x9EA092,
+    0x9D9F91,
+    0x9A9C8E,
+    0x999B8D,
+    0x9FA193,
+    0xA3A597,
+    0xA2A496,
+    0xA2A496,
+    0xA3A597,
+    0xA4A698,
+    0xA3A597,
+    0xA3A597,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA4A698,
+    0xA1A395,
+    0x9EA092,
+    0x9A9C8E,
+    0x96988A,
+    0x939587,
+    0x919385,
+    0x95998A,
+    0x969A8B,
+    0x939788,
+    0x8E9283,
+    0x8D9182,
+    0x909485,
+    0x929687,
+    0x919586,
+    0x8A8E7F,
+    0x898D7E,
+    0x898D7E,
+    0x898D7E,
+    0x8A8E7F,
+    0x8A8E7F,
+    0x898D7E,
+    0x878B7C,
+    0x8F9183,
+    0x919385,
+    0x949688,
+    0x949688,
+    0x939587,
+    0x929486,
+    0x929486,
+    0x929486,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x909284,
+    0x8E9082,
+    0x8D8F81,
+    0x8C8E80,
+    0x888E80,
+    0x898F81,
+    0x879282,
+    0x869181,
+    0x82907F,
+    0x818F7E,
+    0x80917F,
+    0x819280,
+    0x7D907D,
+    0x7D907D,
+    0x7D907D,
+    0x7C8F7C,
+    0x7B8E7B,
+    0x798C79,
+    0x788977,
+    0x778878,
+    0x708075,
+    0x6D7D73,
+    0x35453A,
+    0x000B00,
+    0x000F00,
+    0x000700,
+    0x000700,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000E00,
+    0x001000,
+    0x031102,
+    0x737F71,
+    0x8F9A8C,
+    0x8E9488,
+    0x8E9486,
+    0x979B8D,
+    0x96988B,
+    0x96988B,
+    0x96988B,
+    0x97998C,
+    0x96988A,
+    0x96988A,
+    0x95998A,
+    0x949889,
+    0x9D9F91,
+    0xA0A294,
+    0xA0A294,
+    0x9EA092,
+    0x9D9F91,
+    0x9FA193,
+    0x9D9F91,
+    0x9A9C8E,
+    0x999B8D,
+    0x9FA193,
+    0xA4A698,
+    0xA3A597,
+    0xA2A496,
+    0xA3A597,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA0A294,
+    0xA1A395,
+    0xA3A597,
+    0xA4A698,
+    0xA6A89A,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA2A697,
+    0xA4A899,
+    0xA3A798,
+    0xA0A495,
+    0x9FA394,
+    0xA1A596,
+    0xA1A596,
+    0x9EA293,
+    0x9FA394,
+    0x9EA293,
+    0x9EA293,
+    0x9EA293,
+    0x9FA394,
+    0x9FA394,
+    0x9EA293,
+    0x9DA192,
+    0x97998B,
+    0x989A8C,
+    0x999B8D,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x989A8C,
+    0x96988A,
+    0x919385,
+    0x919385,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x8F9183,
+    0x8F9183,
+    0x8E9283,
+    0x8C9284,
+    0x8C9485,
+    0x8A9585,
+    0x889383,
+    0x849281,
+    0x82907F,
+    0x80917F,
+    0x80917F,
+    0x7D907D,
+    0x7D907D,
+    0x7D907D,
+    0x7C8F7C,
+    0x7C8D7B,
+    0x7A8B79,
+    0x7A8877,
+    0x798778,
+    0x728277,
+    0x6F7F75,
+    0x3E4E43,
+    0x000A00,
+    0x001000,
+    0x000700,
+    0x000A00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000E01,
+    0x021003,
+    0x7E8A7E,
+    0x8D978C,
+    0x8F958B,
+    0x8B9187,
+    0x999C93,
+    0x9B9D92,
+    0x9B9D92,
+    0x9B9D92,
+    0x9B9D92,
+    0x9B9D90,
+    0x9A9C8F,
+    0x989C8E,
+    0x989C8E,
+    0x989A8C,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x989A8C,
+    0x9A9C8E,
+    0xA0A294,
+    0xA4A698,
+    0xA3A597,
+    0xA2A496,
+    0xA4A698,
+    0xA5A799,
+    0xA4A698,
+    0xA4A698,
+    0xA4A698,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA6A89A,
+    0xA6A89A,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA5A799,
+    0xA2A496,
+    0x9D9F91,
+    0x999B8D,
+    0x96988A,
+    0x949688,
+    0x9A9E8F,
+    0x9EA293,
+    0xA0A495,
+    0x9EA293,
+    0x9EA293,
+    0x9EA293,
+    0x9CA091,
+    0x989C8D,
+    0x9CA091,
+    0x9B9F90,
+    0x999D8E,
+    0x999D8E,
+    0x999D8E,
+    0x989C8D,
+    0x969A8B,
+    0x95998A,
+    0x97998B,
+    0x959789,
+    0x949688,
+    0x959789,
+    0x97998B,
+    0x97998B,
+    0x949688,
+    0x919385,
+    0x929486,
+    0x919385,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x919586,
+    0x868E7F,
+    0x859080,
+    0x849180,
+    0x83907F,
+    0x808E7D,
+    0x7F8D7C,
+    0x7D8E7C,
+    0x7E8F7D,
+    0x7F907E,
+    0x7F907E,
+    0x7F907E,
+    0x808E7D,
+    0x7F8D7C,
+    0x7E8B7A,
+    0x7C8978,
+    0x7B8779,
+    0x748479,
+    0x718177,
+    0x4C5C51,
+    0x000900,
+    0x001101,
+    0x000700,
+    0x000F00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D02,
+    0x000D03,
+    0x849086,
+    0x889289,
+    0x8D928B,
+    0x83897F,
+    0x91948B,
+    0x8B8C84,
+    0x8C8D85,
+    0x8D8E86,
+    0x8D8E86,
+    0x8E9085,
+    0x8E9085,
+    0x8D9085,
+    0x8D9085,
+    0x919385,
+    0x949688,
+    0x96988A,
+    0x96988A,
+    0x989A8C,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x999B8D,
+    0x9B9D8F,
+    0xA1A395,
+    0xA5A799,
+    0xA4A698,
+    0xA3A597,
+    0xA5A799,
+    0xA6A89A,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA5A799,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA7A99B,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA6A89A,
+    0xA4A698,
+    0xA2A496,
+    0xA0A294,
+    0x9EA092,
+    0x9D9F91,
+    0x949889,
+    0x979B8C,
+    0x999D8E,
+    0x989C8D,
+    0x989C8D,
+    0x999D8E,
+    0x979B8C,
+    0x939788,
+    0x969A8B,
+    0x949889,
+    0x919586,
+    0x8F9384,
+    0x8E9283,
+    0x8D9182,
+    0x8B8F80,
+    0x898D7E,
+    0x949688,
+    0x909284,
+    0x8E9082,
+    0x8F9183,
+    0x919385,
+    0x919385,
+    0x8D8F81,
+    0x898B7D,
+    0x909284,
+    0x8F9183,
+    0x8D8F81,
+    0x8C8E80,
+    0x8B8D7F,
+    0x8C8E80,
+    0x8D8F81,
+    0x8D9182,
+    0x889081,
+    0x889383,
+    0x889584,
+    0x889584,
+    0x869483,
+    0x869483,
+    0x869785,
+    0x879886,
+    0x80917F,
+    0x80917F,
+    0x818F7E,
+    0x818F7E,
+    0x808D7C,
+    0x7F8C7B,
+    0x7E8979,
+    0x7C887A,
+    0x78857B,
+    0x728278,
+    0x5A6A5F,
+    0x000B00,
+    0x001101,
+    0x000700,
+    0x001100,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000F02,
+    0x001005,
+    0x07140A,
+    0x8D998F,
+    0x8E988F,
+    0x949992,
+    0x8C9288,
+    0x94978E,
+    0x9A9B93,
+    0x9B9C94,
+    0x9C9D95,
+    0x9D9E96,
+    0x9EA095,
+    0x9EA095,
+    0x9DA095,
+    0x9DA095,
+    0x96988A,
+    0x999B8D,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9C9E90,
+    0x9FA193,
+    0xA0A294,
+    0x9D9F91,
+    0x9B9D8F,
+    0xA1A395,
+    0xA6A89A,
+    0xA5A799,
+    0xA4A698,
+    0xA5A799,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA5A799,
+    0xA4A698,
+    0xA3A597,
+    0xA3A597,
+    0x9EA293,
+    0xA0A495,
+    0xA0A495,
+    0x9EA293,
+    0x9EA293,
+    0xA0A495,
+    0x9FA394,
+    0x9DA192,
+    0xA1A596,
+    0x9FA394,
+    0x9DA192,
+    0x9CA091,
+    0x9B9F90,
+    0x9B9F90,
+    0x9A9E8F,
+    0x989C8D,
+    0x999B8D,
+    0x959789,
+    0x929486,
+    0x929486,
+    0x949688,
+    0x949688,
+    0x919385,
+    0x8D8F81,
+    0x8F9183,
+    0x8E9082,
+    0x8B8D7F,
+    0x898B7D,
+    0x888A7C,
+    0x888A7C,
+    0x888A7C,
+    0x888C7D,
+    0x797F71,
+    0x798172,
+    0x788373,
+    0x798474,
+    0x778473,
+    0x778473,
+    0x788675,
+    0x798776,
+    0x80917F,
+    0x80917F,
+    0x82907F,
+    0x82907F,
+    0x818E7D,
+    0x7F8C7B,
+    0x7F8A7A,
+    0x7C887A,
+    0x78857B,
+    0x738379,
+    0x647469,
+    0x021207,
+    0x000F00,
+    0x000700,
+    0x001000,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D00,
+    0x001003,
+    0x122013,
+    0x909C90,
+    0x929C91,
+    0x989E94,
+    0x999F95,
+    0x9B9E95,
+    0x9A9C91,
+    0x9A9C91,
+    0x9B9D92,
+    0x9C9E93,
+    0x9C9E91,
+    0x9C9E91,
+    0x9B9F91,
+    0x9B9F91,
+    0x9C9E90,
+    0x9FA193,
+    0xA0A294,
+    0x9EA092,
+    0x9EA092,
+    0xA0A294,
+    0x9FA193,
+    0x9D9F91,
+    0x9C9E90,
+    0xA2A496,
+    0xA6A89A,
+    0xA6A89A,
+    0xA5A799,
+    0xA6A89A,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xABAD9F,
+    0xA9AB9D,
+    0xA6A89A,
+    0xA3A597,
+    0x9EA092,
+    0x9A9C8E,
+    0x97998B,
+    0x959789,
+    0x9DA192,
+    0x9EA293,
+    0x9DA192,
+    0x999D8E,
+    0x999D8E,
+    0x9CA091,
+    0x9CA091,
+    0x9B9F90,
+    0x9EA293,
+    0x9DA192,
+    0x9B9F90,
+    0x9CA091,
+    0x9DA192,
+    0x9FA394,
+    0x9FA394,
+    0x9FA394,
+    0x9EA092,
+    0x9C9E90,
+    0x999B8D,
+    0x989A8C,
+    0x999B8D,
+    0x999B8D,
+    0x96988A,
+    0x949688,
+    0x959789,
+    0x949688,
+    0x929486,
+    0x909284,
+    0x8E9082,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D8F81,
+    0x8D9183,
+    0x8E9284,
+    0x8D9385,
+    0x8C9284,
+    0x879282,
+    0x869181,
+    0x859382,
+    0x869483,
+    0x819280,
+    0x819280,
+    0x819280,
+    0x80917F,
+    0x818F7E,
+    0x7F8D7C,
+    0x7E8B7A,
+    0x7D897B,
+    0x76867B,
+    0x738379,
+    0x6B7B70,
+    0x0D1D12,
+    0x000E00,
+    0x000700,
+    0x000C00,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x011202,
+    0x1D2B1C,
+    0x8C988A,
+    0x8D988A,
+    0x8D9387,
+    0x989E90,
+    0x95998B,
+    0x9C9E91,
+    0x9D9F92,
+    0x9EA093,
+    0xA0A295,
+    0xA1A395,
+    0xA2A496,
+    0xA1A596,
+    0xA2A697,
+    0x9EA092,
+    0xA1A395,
+    0xA1A395,
+    0x9FA193,
+    0x9EA092,
+    0x9FA193,
+    0x9EA092,
+    0x9B9D8F,
+    0x9D9F91,
+    0xA3A597,
+    0xA7A99B,
+    0xA6A89A,
+    0xA5A799,
+    0xA7A99B,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA7A99B,
+    0xA7A99B,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA7A99B,
+    0xA6A89A,
+    0xA5A799,
+    0xA4A698,
+    0x999D8E,
+    0x9B9F90,
+    0x999D8E,
+    0x969A8B,
+    0x95998A,
+    0x979B8C,
+    0x989C8D,
+    0x969A8B,
+    0x979B8C,
+    0x95998A,
+    0x949889,
+    0x949889,
+    0x969A8B,
+    0x989C8D,
+    0x999D8E,
+    0x999D8E,
+    0x9EA092,
+    0x9D9F91,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x989A8C,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x949688,
+    0x939587,
+    0x929486,
+    0x929486,
+    0x919185,
+    0x929286,
+    0x919386,
+    0x8F9385,
+    0x8B9183,
+    0x899182,
+    0x879483,
+    0x889584,
+    0x829381,
+    0x829381,
+    0x829381,
+    0x819280,
+    0x80917F,
+    0x7E8F7D,
+    0x7C8D7B,
+    0x7B8C7C,
+    0x77877C,
+    0x738379,
+    0x6E7E73,
+    0x1A2A1F,
+    0x000E00,
+    0x000B00,
+    0x000900,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x061705,
+    0x283625,
+    0x8A9786,
+    0x859080,
+    0x7F8577,
+    0x909787,
+    0x8A8E7F,
+    0x909284,
+    0x919385,
+    0x949688,
+    0x97998B,
+    0x9A9D8C,
+    0x9C9F8E,
+    0x9DA190,
+    0x9DA190,
+    0x9EA092,
+    0xA1A395,
+    0xA2A496,
+    0xA0A294,
+    0xA0A294,
+    0xA2A496,
+    0xA1A395,
+    0x9FA193,
+    0x9D9F91,
+    0xA3A597,
+    0xA7A99B,
+    0xA7A99B,
+    0xA6A89A,
+    0xA7A99B,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA6A89A,
+    0xA5A799,
+    0xA4A698,
+    0xA5A99A,
+    0xA7AB9C,
+    0xA7AB9C,
+    0xA4A899,
+    0xA3A798,
+    0xA4A899,
+    0xA3A798,
+    0xA0A495,
+    0xA2A697,
+    0xA0A495,
+    0x9EA293,
+    0x9DA192,
+    0x9DA192,
+    0x9EA293,
+    0x9FA394,
+    0x9EA293,
+    0x9C9E90,
+    0x9D9F91,
+    0x9C9E90,
+    0x9A9C8E,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x989A8C,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x939587,
+    0x929486,
+    0x919385,
+    0x909284,
+    0x909183,
+    0x908E82,
+    0x938F84,
+    0x919185,
+    0x8F9184,
+    0x8E9284,
+    0x8A9283,
+    0x899484,
+    0x8A9786,
+    0x829381,
+    0x829381,
+    0x819481,
+    0x809380,
+    0x7D927F,
+    0x7B907D,
+    0x798E7B,
+    0x7A8C7C,
+    0x77897D,
+    0x74847A,
+    0x6F7F74,
+    0x233328,
+    0x000E00,
+    0x000E00,
+    0x000700,
+    0x000E00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000E01,
+    0x000800,
+    0x404E41,
+    0x8D998D,
+    0x8F998E,
+    0x8E948A,
+    0x959B91,
+    0x95988F,
+    0x999B90,
+    0x9A9C91,
+    0x9C9E93,
+    0x9B9D92,
+    0x999B90,
+    0x9A9C91,
+    0x9CA092,
+    0x9FA395,
+    0xA0A294,
+    0xA0A294,
+    0xA0A294,
+    0x9FA193,
+    0xA1A395,
+    0xA3A597,
+    0xA1A395,
+    0x9C9E90,
+    0x9EA092,
+    0xA3A597,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xADAFA1,
+    0xA1A395,
+    0xA7A99B,
+    0x939587,
+    0x929486,
+    0x929486,
+    0x949688,
+    0x9EA092,
+    0x989A8C,
+    0x919385,
+    0x989A8C,
+    0x989A8C,
+    0x929486,
+    0x97998B,
+    0x959789,
+    0x999B8D,
+    0x9C9E90,
+    0x9B9D8F,
+    0x989A8C,
+    0x989A8C,
+    0x9C9E90,
+    0xA0A294,
+    0x9FA193,
+    0x9EA092,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x999B8D,
+    0x96988A,
+    0x96988A,
+    0x96988A,
+    0x959789,
+    0x949688,
+    0x939587,
+    0x939587,
+    0x929486,
+    0x8F9384,
+    0x8F9384,
+    0x8D9484,
+    0x8D9484,
+    0x8A9584,
+    0x899684,
+    0x889784,
+    0x859683,
+    0x829581,
+    0x829581,
+    0x7F9580,
+    0x7F9580,
+    0x7E947F,
+    0x7C927D,
+    0x7D907C,
+    0x7C8F7C,
+    0x798A78,
+    0x778878,
+    0x708171,
+    0x2E3F2F,
+    0x011202,
+    0x000900,
+    0x000700,
+    0x000F00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000800,
+    0x445245,
+    0x8D998D,
+    0x909A8F,
+    0x91978D,
+    0x999F95,
+    0x999C93,
+    0x9C9E93,
+    0x9C9E93,
+    0x9B9D92,
+    0x9C9E93,
+    0x9D9F94,
+    0x9FA196,
+    0x9FA395,
+    0xA0A496,
+    0xA4A698,
+    0xA4A698,
+    0xA2A496,
+    0xA0A294,
+    0xA0A294,
+    0xA2A496,
+    0x9EA092,
+    0x989A8C,
+    0x9FA193,
+    0xA3A597,
+    0xA6A89A,
+    0xA6A89A,
+    0xA6A89A,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA6A89A,
+    0xA7A99B,
+    0xACAEA0,
+    0xA5A799,
+    0xB0B2A4,
+    0xA3A597,
+    0xA6A89A,
+    0xAAAC9E,
+    0xA3A597,
+    0xA9AB9D,
+    0xA7A99B,
+    0xA3A597,
+    0xA6A89A,
+    0xA6A89A,
+    0xA3A597,
+    0xA3A597,
+    0x9D9F91,
+    0x9D9F91,
+    0x9B9D8F,
+    0x97998B,
+    0x939587,
+    0x919385,
+    0x939587,
+    0x949688,
+    0x9C9E90,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x97998B,
+    0x97998B,
+    0x96988A,
+    0x959789,
+    0x949688,
+    0x949688,
+    0x939587,
+    0x939587,
+    0x909485,
+    0x909485,
+    0x8E9585,
+    0x8C9584,
+    0x8A9584,
+    0x899684,
+    0x869784,
+    0x869784,
+    0x829581,
+    0x829581,
+    0x809681,
+    0x7F9580,
+    0x80937F,
+    0x7F927E,
+    0x7D907C,
+    0x7D907D,
+    0x798A78,
+    0x788979,
+    0x728373,
+    0x3C4D3D,
+    0x001101,
+    0x000B00,
+    0x000800,
+    0x000D00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x021205,
+    0x000E03,
+    0x4E5C4F,
+    0x8A968A,
+    0x879186,
+    0x83897F,
+    0x888E84,
+    0x868980,
+    0x919388,
+    0x8F9186,
+    0x8D8F84,
+    0x8F9186,
+    0x93958A,
+    0x95978C,
+    0x94988A,
+    0x929688,
+    0x919385,
+    0x939587,
+    0x949688,
+    0x96988A,
+    0x9C9E90,
+    0xA2A496,
+    0xA1A395,
+    0x9EA092,
+    0x9FA193,
+    0xA4A698,
+    0xA7A99B,
+    0xA6A89A,
+    0xA6A89A,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xAAAC9E,
+    0xABAD9F,
+    0xA6A89A,
+    0xAEB0A2,
+    0xA3A597,
+    0xA4A698,
+    0xA8AA9C,
+    0xA4A698,
+    0xA3A597,
+    0xA6A89A,
+    0xA6A89A,
+    0xA2A496,
+    0xA4A698,
+    0xA5A799,
+    0x9FA193,
+    0xA6A89A,
+    0xA5A799,
+    0xA2A496,
+    0xA0A294,
+    0x9EA092,
+    0x9FA193,
+    0xA0A294,
+    0xA1A395,
+    0x9C9E90,
+    0x9EA092,
+    0x9FA193,
+    0x9EA092,
+    0x9B9D8F,
+    0x999B8D,
+    0x999B8D,
+    0x9A9C8E,
+    0x97998B,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x959789,
+    0x949688,
+    0x949688,
+    0x939587,
+    0x919586,
+    0x919586,
+    0x8D9685,
+    0x8D9685,
+    0x8A9785,
+    0x899684,
+    0x869784,
+    0x869784,
+    0x839682,
+    0x839682,
+    0x829581,
+    0x829581,
+    0x819480,
+    0x7F927E,
+    0x7E917D,
+    0x7D907D,
+    0x7A8B79,
+    0x788979,
+    0x738474,
+    0x516252,
+    0x000F00,
+    0x000D00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000E01,
+    0x000E03,
+    0x5A685B,
+    0x8F9B8F,
+    0x909A8F,
+    0x90968C,
+    0x989E94,
+    0x989B92,
+    0x9EA095,
+    0x9D9F94,
+    0x9C9E93,
+    0x9EA095,
+    0xA0A297,
+    0xA1A398,
+    0xA0A496,
+    0x9FA395,
+    0xA0A294,
+    0xA1A395,
+    0xA0A294,
+    0x9FA193,
+    0xA0A294,
+    0xA3A597,
+    0xA0A294,
+    0x9B9D8F,
+    0xA0A294,
+    0xA4A698,
+    0xA7A99B,
+    0xA6A89A,
+    0xA6A89A,
+    0xA8AA9C,
+    0xA9AB9D,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xACAEA0,
+    0xADAFA1,
+    0xAAAC9E,
+    0xA6A89A,
+    0xA8AA9C,
+    0x9EA092,
+    0x999B8D,
+    0x9D9F91,
+    0x979B8C,
+    0x919586,
+    0x969A8B,
+    0x999D8E,
+    0x909485,
+    0x939788,
+    0x989C8D,
+    0x8F9384,
+    0x929687,
+    0x939788,
+    0x949889,
+    0x949889,
+    0x939788,
+    0x939788,
+    0x969A8B,
+    0x989C8D,
+    0x959789,
+    0x97998B,
+    0x989A8C,
+    0x97998B,
+    0x949688,
+    0x949688,
+    0x96988A,
+    0x999B8D,
+    0x989A8C,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x96988A,
+    0x959789,
+    0x949688,
+    0x949688,
+    0x909787,
+    0x909787,
+    0x8E9786,
+    0x8E9786,
+    0x8A9785,
+    0x8A9785,
+    0x879885,
+    0x869784,
+    0x849783,
+    0x839682,
+    0x839682,
+    0x829581,
+    0x829380,
+    0x81927F,
+    0x80917E,
+    0x7F907E,
+    0x7C8D7B,
+    0x798A7A,
+    0x738474,
+    0x637464,
+    0x000D00,
+    0x000E00,
+    0x000C00,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x001005,
+    0x657366,
+    0x8F9B8F,
+    0x909A8F,
+    0x91978D,
+    0x9AA096,
+    0x9B9E95,
+    0x9D9F94,
+    0x9EA095,
+    0xA0A297,
+    0xA0A297,
+    0x9EA095,
+    0x9EA095,
+    0x9EA294,
+    0x9FA395,
+    0xA1A395,
+    0xA1A395,
+    0xA0A294,
+    0x9FA193,
+    0xA1A395,
+    0xA3A597,
+    0xA0A294,
+    0x9B9D8F,
+    0xA0A294,
+    0xA5A799,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xABAD9F,
+    0xA8AA9C,
+    0xABAD9F,
+    0xAEB0A2,
+    0xAAAC9E,
+    0xA2A496,
+    0xA7A99B,
+    0xACB0A1,
+    0xA3A798,
+    0xA8AC9D,
+    0xAAAE9F,
+    0xA1A596,
+    0xA4A899,
+    0xAAAE9F,
+    0xA4A899,
+    0x9CA091,
+    0x9FA394,
+    0xA2A697,
+    0xA0A495,
+    0x9B9F90,
+    0x989C8D,
+    0x989C8D,
+    0x9A9E8F,
+    0x939587,
+    0x949688,
+    0x949688,
+    0x939587,
+    0x929486,
+    0x949688,
+    0x999B8D,
+    0x9D9F91,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x959789,
+    0x949889,
+    0x919888,
+    0x909988,
+    0x8D9887,
+    0x8D9887,
+    0x8A9986,
+    0x8A9986,
+    0x879885,
+    0x879885,
+    0x849783,
+    0x849783,
+    0x849783,
+    0x839682,
+    0x839481,
+    0x829380,
+    0x83927F,
+    0x82907F,
+    0x7F907E,
+    0x7B8C7C,
+    0x728373,
+    0x6E7F6F,
+    0x001000,
+    0x000D00,
+    0x000D00,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000E01,
+    0x041409,
+    0x6F7D70,
+    0x8B978B,
+    0x889287,
+    0x868C82,
+    0x8B9187,
+    0x8B8E85,
+    0x8E9085,
+    0x919388,
+    0x94968B,
+    0x93958A,
+    0x919388,
+    0x8F9186,
+    0x909486,
+    0x929688,
+    0x919385,
+    0x939587,
+    0x959789,
+    0x97998B,
+    0x9D9F91,
+    0xA2A496,
+    0xA2A496,
+    0x9EA092,
+    0xA1A395,
+    0xA6A89A,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA7A99B,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xA3A597,
+    0xA8AA9C,
+    0xA2A496,
+    0xABAD9F,
+    0xADAFA1,
+    0xAFB1A3,
+    0xA7A99B,
+    0xAEB0A2,
+    0xA9AD9E,
+    0xA4A899,
+    0xA5A99A,
+    0xA7AB9C,
+    0xA3A798,
+    0xA3A798,
+    0xA5A99A,
+    0xA4A899,
+    0xA3A798,
+    0xA4A899,
+    0xA5A99A,
+    0xA4A899,
+    0xA1A596,
+    0x9EA293,
+    0x9DA192,
+    0x9DA192,
+    0xA3A597,
+    0xA0A294,
+    0x9D9F91,
+    0x9A9C8E,
+    0x999B8D,
+    0x9A9C8E,
+    0x9C9E90,
+    0x9D9F91,
+    0x9A9C8E,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x96988A,
+    0x95998A,
+    0x929989,
+    0x919A89,
+    0x8E9988,
+    0x8E9988,
+    0x8B9A87,
+    0x8A9986,
+    0x889986,
+    0x879885,
+    0x859884,
+    0x859884,
+    0x869784,
+    0x859683,
+    0x869582,
+    0x859481,
+    0x83927F,
+    0x839180,
+    0x80917F,
+    0x7D8E7E,
+    0x738474,
+    0x738474,
+    0x091A0A,
+    0x000C00,
+    0x000D00,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000A00,
+    0x041409,
+    0x79877A,
+    0x909C90,
+    0x909A8F,
+    0x93998F,
+    0x9BA197,
+    0x9DA097,
+    0x9C9E93,
+    0x9D9F94,
+    0x9FA196,
+    0xA0A297,
+    0xA1A398,
+    0xA1A398,
+    0xA0A496,
+    0xA0A496,
+    0xA5A799,
+    0xA5A799,
+    0xA3A597,
+    0xA1A395,
+    0xA2A496,
+    0xA3A597,
+    0x9FA193,
+    0x999B8D,
+    0xA1A395,
+    0xA6A89A,
+    0xA9AB9D,
+    0xA7A99B,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA7A99B,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xA1A395,
+    0xA3A597,
+    0x97998B,
+    0x9EA092,
+    0x9B9D8F,
+    0x9FA193,
+    0x96988A,
+    0x9EA092,
+    0xA1A898,
+    0xA2A999,
+    0xA1A898,
+    0xA3AA9A,
+    0xA6AD9D,
+    0xA0A797,
+    0x9CA393,
+    0xA0A797,
+    0xA4AB9B,
+    0xA0A797,
+    0x9CA393,
+    0x9DA494,
+    0xA1A898,
+    0xA4AB9B,
+    0xA2A999,
+    0xA2A697,
+    0xA1A596,
+    0x9FA193,
+    0x9C9E90,
+    0x9C9E90,
+    0x9EA092,
+    0x9FA193,
+    0x9D9F91,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x95998A,
+    0x929B8A,
+    0x909B8A,
+    0x8E9B89,
+    0x8D9A88,
+    0x8B9A87,
+    0x8A9986,
+    0x889986,
+    0x889986,
+    0x869985,
+    0x869985,
+    0x869784,
+    0x869784,
+    0x869582,
+    0x859481,
+    0x859280,
+    0x849180,
+    0x7F907E,
+    0x7F9080,
+    0x758676,
+    0x778878,
+    0x172818,
+    0x000E00,
+    0x000E00,
+    0x000700,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000F02,
+    0x09190E,
+    0x808E81,
+    0x919D91,
+    0x8E988D,
+    0x8F958B,
+    0x969C92,
+    0x979A91,
+    0x9C9E93,
+    0x9B9D92,
+    0x9B9D92,
+    0x9EA095,
+    0xA2A499,
+    0xA4A69B,
+    0xA2A698,
+    0xA0A496,
+    0xA1A395,
+    0xA2A496,
+    0xA1A395,
+    0xA0A294,
+    0xA2A496,
+    0xA5A799,
+    0xA2A496,
+    0x9D9F91,
+    0xA2A496,
+    0xA6A89A,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA7A99B,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0x9EA092,
+    0x9EA092,
+    0x8C8E80,
+    0x909284,
+    0x8A8C7E,
+    0x8F9183,
+    0x858779,
+    0x8F9183,
+    0x7C8373,
+    0x838A7A,
+    0x818878,
+    0x848B7B,
+    0x8B9282,
+    0x818878,
+    0x777E6E,
+    0x7F8676,
+    0x8A9181,
+    0x7F8676,
+    0x767D6D,
+    0x777E6E,
+    0x7F8676,
+    0x848B7B,
+    0x818878,
+    0x7D8172,
+    0x868A7B,
+    0x87897B,
+    0x898B7D,
+    0x919385,
+    0x9B9D8F,
+    0xA0A294,
+    0x9FA193,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x969A8B,
+    0x929B8A,
+    0x909B8A,
+    0x8E9B89,
+    0x8E9B89,
+    0x8C9B88,
+    0x8B9A87,
+    0x889986,
+    0x889986,
+    0x869985,
+    0x869985,
+    0x879885,
+    0x869784,
+    0x879683,
+    0x859481,
+    0x859280,
+    0x859281,
+    0x7E8F7D,
+    0x809181,
+    0x778878,
+    0x798A7A,
+    0x223323,
+    0x000F00,
+    0x000E00,
+    0x000700,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x000900,
+    0x021303,
+    0x8E9C8F,
+    0x8C988C,
+    0x8C988E,
+    0x8B958C,
+    0x919891,
+    0x939A93,
+    0x929791,
+    0x90958F,
+    0x8F948D,
+    0x8F948D,
+    0x90988B,
+    0x90988B,
+    0x8E9687,
+    0x8D9385,
+    0x8F9384,
+    0x919385,
+    0x929486,
+    0x96988A,
+    0x9A9C8E,
+    0x9EA092,
+    0x9FA193,
+    0x9FA193,
+    0xA3A597,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA9AB9D,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xABAD9F,
+    0xABAD9F,
+    0xA8AA9C,
+    0xACAEA0,
+    0xADAFA1,
+    0xABAD9F,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xA6A89A,
+    0xACAEA0,
+    0xAAAC9E,
+    0xA6A89A,
+    0xA4A698,
+    0xA7A99B,
+    0xAAAC9E,
+    0xA8AA9C,
+    0xA3A597,
+    0xA5A799,
+    0xA3A597,
+    0xA1A395,
+    0xA0A294,
+    0xA0A294,
+    0x9FA193,
+    0x9D9F91,
+    0x9B9D8F,
+    0x939587,
+    0x8F9183,
+    0x8D8F81,
+    0x919385,
+    0x9A9C8E,
+    0x9FA193,
+    0x9D9F91,
+    0x9A9C8E,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x949B8B,
+    0x8F9C8A,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8B9C89,
+    0x8A9B88,
+    0x899A87,
+    0x899A87,
+    0x879885,
+    0x879885,
+    0x879885,
+    0x869784,
+    0x869784,
+    0x859683,
+    0x859683,
+    0x849583,
+    0x819282,
+    0x829285,
+    0x819184,
+    0x738376,
+    0x354538,
+    0x021205,
+    0x000700,
+    0x000E00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x051302,
+    0x142213,
+    0x96A296,
+    0x949E93,
+    0x939D94,
+    0x929991,
+    0x969B95,
+    0x989D97,
+    0x9EA09B,
+    0x9EA09B,
+    0x9FA299,
+    0xA0A39A,
+    0xA0A69A,
+    0xA1A79B,
+    0xA0A698,
+    0xA2A698,
+    0xA2A697,
+    0xA3A597,
+    0xA2A496,
+    0xA3A597,
+    0xA4A698,
+    0xA3A597,
+    0xA1A395,
+    0x9FA193,
+    0xA3A597,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAD9F,
+    0xAAAC9E,
+    0xA6A89A,
+    0x9FA193,
+    0x999B8D,
+    0x9B9D8F,
+    0xA2A496,
+    0xA6A89A,
+    0xA6A89A,
+    0x9EA092,
+    0x9EA092,
+    0xA1A395,
+    0xA8AA9C,
+    0xAEB0A2,
+    0xB0B2A4,
+    0xADAFA1,
+    0xAAAC9E,
+    0xA7A99B,
+    0xA5A799,
+    0xA3A597,
+    0xA3A597,
+    0xA2A496,
+    0xA2A496,
+    0xA0A294,
+    0x9EA092,
+    0xA3A597,
+    0x9FA193,
+    0x9C9E90,
+    0x9D9F91,
+    0xA1A395,
+    0xA2A496,
+    0xA0A294,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9D9F91,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x999B8D,
+    0x979B8C,
+    0x929F8D,
+    0x91A08D,
+    0x909F8C,
+    0x8F9E8B,
+    0x8B9C89,
+    0x8A9B88,
+    0x899A87,
+    0x889986,
+    0x879885,
+    0x879885,
+    0x879885,
+    0x869784,
+    0x869784,
+    0x859683,
+    0x849783,
+    0x849784,
+    0x819282,
+    0x819184,
+    0x809083,
+    0x758578,
+    0x425343,
+    0x001000,
+    0x000A00,
+    0x000F00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000C00,
+    0x000E00,
+    0x1A261A,
+    0x909A91,
+    0x8E958D,
+    0x8E958D,
+    0x8B9089,
+    0x92948F,
+    0x949691,
+    0x94958F,
+    0x969791,
+    0x989991,
+    0x999A92,
+    0x999C91,
+    0x999C91,
+    0x9A9E90,
+    0x9B9F91,
+    0x9FA193,
+    0x9FA193,
+    0xA1A395,
+    0xA3A597,
+    0xA4A698,
+    0xA4A698,
+    0xA1A395,
+    0x9FA193,
+    0xA3A597,
+    0xA7A99B,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAD9F,
+    0xA8AA9C,
+    0xA2A496,
+    0x9D9F91,
+    0x9EA092,
+    0x9EA092,
+    0x9A9C8E,
+    0x939587,
+    0x96988A,
+    0x949688,
+    0x989A8C,
+    0xA2A496,
+    0xA7A99B,
+    0xA5A799,
+    0xA2A496,
+    0xA3A597,
+    0xAAAC9E,
+    0xA8AA9C,
+    0xA7A99B,
+    0xA6A89A,
+    0xA7A99B,
+    0xA6A89A,
+    0xA5A799,
+    0xA3A597,
+    0xA3A597,
+    0xA1A395,
+    0x9EA092,
+    0x9C9E90,
+    0x9C9E90,
+    0x9B9D8F,
+    0x999B8D,
+    0x97998B,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x949889,
+    0x8E9988,
+    0x8C9987,
+    0x8B9A87,
+    0x8B9A87,
+    0x8B9A87,
+    0x8C9B88,
+    0x8D9C89,
+    0x8E9D8A,
+    0x889986,
+    0x889986,
+    0x879885,
+    0x879885,
+    0x859884,
+    0x859884,
+    0x849783,
+    0x849784,
+    0x829383,
+    0x819184,
+    0x7E8F7F,
+    0x798A7A,
+    0x566757,
+    0x000C00,
+    0x001000,
+    0x000E00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000C00,
+    0x030F03,
+    0x2C362D,
+    0x929991,
+    0x91968F,
+    0x949993,
+    0x92948F,
+    0x9A9B96,
+    0x9C9D98,
+    0x979691,
+    0x9A9994,
+    0x9C9C94,
+    0x9C9C94,
+    0x9A9C8F,
+    0x999B8E,
+    0x9A9C8E,
+    0x9D9F91,
+    0x949688,
+    0x96988A,
+    0x9A9C8E,
+    0x9FA193,
+    0xA2A496,
+    0xA2A496,
+    0xA0A294,
+    0x9EA092,
+    0xA3A597,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xA8AA9C,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xABAD9F,
+    0xA9AB9D,
+    0xA9AD9E,
+    0xA9AD9E,
+    0xA9AD9E,
+    0xA9AD9E,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xA6AA9B,
+    0xA7AB9C,
+    0xA8AC9D,
+    0xA8AC9D,
+    0xAAAE9F,
+    0xACB0A1,
+    0xA9AD9E,
+    0xA3A798,
+    0xABAFA0,
+    0xA4A899,
+    0xA4A899,
+    0xABAFA0,
+    0xADB1A2,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAEB2A3,
+    0xA3A798,
+    0xA2A697,
+    0xA1A596,
+    0xA1A596,
+    0xA1A596,
+    0xA1A596,
+    0xA0A495,
+    0x9FA394,
+    0xA4A698,
+    0xA4A698,
+    0xA3A597,
+    0xA1A395,
+    0x9FA193,
+    0x9EA092,
+    0x9FA193,
+    0x9FA193,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x97998B,
+    0x95998A,
+    0x919A89,
+    0x8E9988,
+    0x8D9A88,
+    0x8C9987,
+    0x8D9A88,
+    0x8E9B89,
+    0x8E9D8A,
+    0x8E9D8A,
+    0x889986,
+    0x889986,
+    0x889986,
+    0x879885,
+    0x869985,
+    0x859884,
+    0x859884,
+    0x859885,
+    0x859684,
+    0x819282,
+    0x7D8E7E,
+    0x7C8D7D,
+    0x697A6A,
+    0x000B00,
+    0x021301,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000C00,
+    0x041004,
+    0x3D473E,
+    0x929992,
+    0x919690,
+    0x979C96,
+    0x949691,
+    0x9C9D98,
+    0x9D9E99,
+    0x9D9C97,
+    0xA09F9A,
+    0xA2A298,
+    0xA2A298,
+    0xA0A295,
+    0x9FA194,
+    0xA1A493,
+    0xA3A695,
+    0x9D9F91,
+    0x9EA092,
+    0xA1A395,
+    0xA4A698,
+    0xA6A89A,
+    0xA4A698,
+    0xA1A395,
+    0x9D9F91,
+    0xA4A698,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xABAD9F,
+    0xA9AB9D,
+    0xA9AD9E,
+    0xA9AD9E,
+    0xA9AD9E,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xABAFA0,
+    0xABAFA0,
+    0xAAAE9F,
+    0xA4A899,
+    0x9CA091,
+    0x989C8D,
+    0x9CA091,
+    0xA2A697,
+    0xA5A99A,
+    0xA6AA9B,
+    0xA0A495,
+    0x9FA394,
+    0xA3A798,
+    0xA4A899,
+    0xA1A596,
+    0xA2A697,
+    0xA7AB9C,
+    0xA6AA9B,
+    0xA5A99A,
+    0xA4A899,
+    0xA4A899,
+    0xA5A99A,
+    0xA5A99A,
+    0xA4A899,
+    0xA2A697,
+    0x9EA092,
+    0x9FA193,
+    0x9FA193,
+    0x9EA092,
+    0x9C9E90,
+    0x9C9E90,
+    0x9D9F91,
+    0x9FA193,
+    0x9C9E90,
+    0x9B9D8F,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x999B8D,
+    0x999B8D,
+    0x999B8D,
+    0x999D8E,
+    0x989F8F,
+    0x969F8E,
+    0x939E8D,
+    0x919C8B,
+    0x909B8A,
+    0x8F9A89,
+    0x8D9A88,
+    0x8D9A88,
+    0x8B9A87,
+    0x8B9A87,
+    0x889986,
+    0x889986,
+    0x869985,
+    0x869985,
+    0x859884,
+    0x859885,
+    0x879886,
+    0x819282,
+    0x7E8F7F,
+    0x7E8F7F,
+    0x768775,
+    0x000F00,
+    0x001100,
+    0x000700,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000C00,
+    0x000B01,
+    0x465149,
+    0x8A948C,
+    0x8B928B,
+    0x919793,
+    0x8B908C,
+    0x939590,
+    0x92948F,
+    0x93948E,
+    0x959690,
+    0x97998E,
+    0x999B90,
+    0x999D8E,
+    0x9A9E8F,
+    0x9B9F8E,
+    0x9CA08F,
+    0x9EA092,
+    0x9FA193,
+    0xA2A496,
+    0xA4A698,
+    0xA6A89A,
+    0xA4A698,
+    0xA0A294,
+    0x9D9F91,
+    0xA4A698,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xABAD9F,
+    0xABAD9F,
+    0xAAAC9E,
+    0xA9AD9E,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xABAFA0,
+    0xABAFA0,
+    0xABAFA0,
+    0xAAAE9F,
+    0xACB0A1,
+    0xA9AD9E,
+    0x9FA394,
+    0x979B8C,
+    0x979B8C,
+    0x9A9E8F,
+    0x9CA091,
+    0x9A9E8F,
+    0x9A9E8F,
+    0x9B9F90,
+    0x9A9E8F,
+    0x999D8E,
+    0x979B8C,
+    0x95998A,
+    0x949889,
+    0x949889,
+    0x939788,
+    0x929687,
+    0x929687,
+    0x939788,
+    0x939788,
+    0x929687,
+    0x909485,
+    0x959789,
+    0x959789,
+    0x959789,
+    0x939587,
+    0x919385,
+    0x919385,
+    0x919385,
+    0x929486,
+    0x939587,
+    0x929486,
+    0x919385,
+    0x909284,
+    0x909284,
+    0x919385,
+    0x919385,
+    0x929486,
+    0x8F9686,
+    0x909787,
+    0x909988,
+    0x919A89,
+    0x909B8A,
+    0x909B8A,
+    0x8F9C8A,
+    0x8F9C8A,
+    0x8B9A87,
+    0x8B9A87,
+    0x899A87,
+    0x889986,
+    0x879A86,
+    0x869985,
+    0x869985,
+    0x869985,
+    0x889987,
+    0x819280,
+    0x819280,
+    0x80917F,
+    0x7C8D7B,
+    0x0B1C0A,
+    0x000F00,
+    0x000800,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x031006,
+    0x556259,
+    0x8E9993,
+    0x8F9893,
+    0x97A09B,
+    0x919793,
+    0x999E98,
+    0x969B95,
+    0x979A93,
+    0x979A93,
+    0x989B90,
+    0x9A9D92,
+    0x9BA292,
+    0x9CA393,
+    0x9CA48F,
+    0x9EA291,
+    0x999D8C,
+    0x9B9D8F,
+    0x9EA092,
+    0xA1A395,
+    0xA3A597,
+    0xA3A597,
+    0xA0A294,
+    0x9EA092,
+    0xA4A698,
+    0xA8AA9C,
+    0xAAAC9E,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xABAD9F,
+    0xABAD9F,
+    0xAAAC9E,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA0A797,
+    0xA5AC9C,
+    0xA9B0A0,
+    0xA8AF9F,
+    0xA7AE9E,
+    0xA9B0A0,
+    0xAAB1A1,
+    0xA9B0A0,
+    0xA4AB9B,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA3AA9A,
+    0xA2A999,
+    0xA6AD9D,
+    0xA6AD9D,
+    0xA1A898,
+    0xA4AB9B,
+    0xA3AA9A,
+    0xA1A898,
+    0xA1A898,
+    0xA2A999,
+    0xA2A999,
+    0xA0A797,
+    0xA1A596,
+    0x9EA293,
+    0x9EA092,
+    0x9C9E90,
+    0x9A9C8E,
+    0x999B8D,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x929486,
+    0x919385,
+    0x8F9183,
+    0x8E9082,
+    0x8D8F81,
+    0x8D8F81,
+    0x8E9082,
+    0x8F9183,
+    0x888F7F,
+    0x8A9181,
+    0x8D9484,
+    0x909787,
+    0x929B8A,
+    0x939C8B,
+    0x919C8B,
+    0x919C8B,
+    0x8C9B88,
+    0x8C9B88,
+    0x899A87,
+    0x899A87,
+    0x879A86,
+    0x879A86,
+    0x849A85,
+    0x869985,
+    0x879A87,
+    0x80917F,
+    0x849583,
+    0x819280,
+    0x7F907E,
+    0x1A2B19,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x000F04,
+    0x586760,
+    0x8D9A93,
+    0x919C96,
+    0x9AA59F,
+    0x949D98,
+    0x9DA49D,
+    0x9AA19A,
+    0xA0A59E,
+    0x9EA39C,
+    0x9DA397,
+    0x9EA496,
+    0xA0A998,
+    0xA1AA97,
+    0x9FA893,
+    0x9EA593,
+    0xA2A695,
+    0xA3A597,
+    0xA3A597,
+    0xA4A698,
+    0xA5A799,
+    0xA4A698,
+    0xA1A395,
+    0x9EA092,
+    0xA4A698,
+    0xA8AA9C,
+    0xABAD9F,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xABAD9F,
+    0xABAD9F,
+    0xAAAC9E,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA8AF9F,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xABB2A2,
+    0xA8AF9F,
+    0x9FA696,
+    0x959C8C,
+    0x919888,
+    0x939A8A,
+    0x959C8C,
+    0x949B8B,
+    0x929989,
+    0x99A090,
+    0x979E8E,
+    0x8F9686,
+    0x929989,
+    0xA0A797,
+    0xA8AF9F,
+    0xA6AD9D,
+    0xA6AD9D,
+    0xA4AB9B,
+    0xA3AA9A,
+    0xA2A999,
+    0xA3AA9A,
+    0xA3AA9A,
+    0xA1A898,
+    0xA2A697,
+    0xA5A99A,
+    0xA3A597,
+    0xA1A395,
+    0xA0A294,
+    0xA0A294,
+    0xA0A294,
+    0x9EA092,
+    0x9C9E90,
+    0xA0A294,
+    0x9EA092,
+    0x9C9E90,
+    0x9A9C8E,
+    0x989A8C,
+    0x989A8C,
+    0x999B8D,
+    0x999B8D,
+    0x949889,
+    0x95998A,
+    0x969D8D,
+    0x979E8E,
+    0x959E8D,
+    0x939C8B,
+    0x8E9988,
+    0x8D9887,
+    0x8C9B88,
+    0x8C9B88,
+    0x899A87,
+    0x899A87,
+    0x879A86,
+    0x879A86,
+    0x849A85,
+    0x869985,
+    0x869986,
+    0x7F907E,
+    0x869785,
+    0x829381,
+    0x7F907E,
+    0x263725,
+    0x000E00,
+    0x001000,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000D00,
+    0x000E00,
+    0x0C1510,
+    0x696F6F,
+    0x8F9591,
+    0x898E8A,
+    0x848982,
+    0x91948D,
+    0x84877C,
+    0x909388,
+    0x989A8C,
+    0x959789,
+    0x929687,
+    0x939788,
+    0x939B8C,
+    0x969E8F,
+    0x969E91,
+    0x949C8F,
+    0x97A08F,
+    0x9DA695,
+    0xA1A898,
+    0x9FA696,
+    0xA0A495,
+    0xA2A496,
+    0xA0A294,
+    0x9E9F91,
+    0xA6A799,
+    0xA8A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AD9E,
+    0xABAD9F,
+    0xAAAC9E,
+    0xABAC9E,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAFA0,
+    0xABAFA0,
+    0xA9B2A1,
+    0xA9B2A1,
+    0xA9B2A1,
+    0xA9B2A1,
+    0xA8AF9F,
+    0xA6AD9D,
+    0xA8AC9D,
+    0xABAFA0,
+    0xABAD9F,
+    0xA8AA9C,
+    0xA8AB9A,
+    0xA9AC9B,
+    0xA9AC9B,
+    0xAAAD9C,
+    0xABAE9D,
+    0xABAE9D,
+    0xAAAD9C,
+    0xA9AC9B,
+    0xA7AA99,
+    0xA7AA99,
+    0xA6A998,
+    0xA6A998,
+    0xA5A897,
+    0xA5A897,
+    0xA5A897,
+    0xA5A897,
+    0xA2A697,
+    0xA1A596,
+    0x9FA394,
+    0x9EA293,
+    0x9EA293,
+    0x9EA293,
+    0x9DA192,
+    0x9CA091,
+    0x9DA192,
+    0x9CA091,
+    0x9A9E8F,
+    0x989C8D,
+    0x989C8D,
+    0x989C8D,
+    0x9A9E8F,
+    0x9B9F90,
+    0x95998A,
+    0x969A8B,
+    0x949D8C,
+    0x919C8B,
+    0x8F9C8A,
+    0x8B9C89,
+    0x8B9E8A,
+    0x8AA08B,
+    0x889E89,
+    0x889E89,
+    0x8A9D89,
+    0x8B9C89,
+    0x8D9C89,
+    0x8E9988,
+    0x8D9887,
+    0x8D9887,
+    0x8A9986,
+    0x839481,
+    0x889986,
+    0x869784,
+    0x829380,
+    0x344532,
+    0x051603,
+    0x000900,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000D00,
+    0x000E00,
+    0x000B04,
+    0x6E7877,
+    0x949D98,
+    0x979D99,
+    0x9AA199,
+    0xA0A59E,
+    0x95988D,
+    0x9C9F94,
+    0xA0A295,
+    0x9FA194,
+    0x9CA092,
+    0x9B9F91,
+    0x999F91,
+    0x999F91,
+    0x989E92,
+    0x979D91,
+    0x9DA695,
+    0xA0A998,
+    0xA3AA9A,
+    0xA2A999,
+    0xA3A798,
+    0xA4A698,
+    0xA1A395,
+    0x9D9E90,
+    0xA6A799,
+    0xA8A99B,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AB9D,
+    0xA9AD9E,
+    0xAAAE9F,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xABAD9F,
+    0xABAD9F,
+    0xA9B0A0,
+    0xAAB1A1,
+    0xA9B2A1,
+    0xA9B2A1,
+    0xA4AD9C,
+    0xA4AD9C,
+    0xA4AB9B,
+    0xA2A999,
+    0xA6AA9B,
+    0xAAAE9F,
+    0xACAEA0,
+    0xAAAC9E,
+    0xA7AA99,
+    0xAAAD9C,
+    0xACAF9E,
+    0xABAE9D,
+    0xA8AB9A,
+    0xA6A998,
+    0xA7AA99,
+    0xA8AB9A,
+    0xA8AB9A,
+    0xA7AA99,
+    0xA7AA99,
+    0xA7AA99,
+    0xA6A998,
+    0xA6A998,
+    0xA5A897,
+    0xA5A897,
+    0xA3A798,
+    0xA1A596,
+    0xA0A495,
+    0x9FA394,
+    0xA0A495,
+    0xA1A596,
+    0xA0A495,
+    0x9FA394,
+    0x9CA091,
+    0x9CA091,
+    0x9B9F90,
+    0x9A9E8F,
+    0x9A9E8F,
+    0x999D8E,
+    0x999D8E,
+    0x999D8E,
+    0x999B8D,
+    0x979B8C,
+    0x949B8B,
+    0x909B8A,
+    0x8F9C8A,
+    0x8E9D8A,
+    0x8A9D89,
+    0x8A9D89,
+    0x889E89,
+    0x889E89,
+    0x8A9D89,
+    0x8B9C89,
+    0x8D9C89,
+    0x8D9A88,
+    0x8E9988,
+    0x8C9987,
+    0x899885,
+    0x849582,
+    0x889986,
+    0x869784,
+    0x839481,
+    0x435441,
+    0x021300,
+    0x000D00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000D00,
+    0x000F00,
+    0x011009,
+    0x818D8B,
+    0x909C98,
+    0x8F9895,
+    0x97A199,
+    0x99A099,
+    0x9AA096,
+    0xA1A49B,
+    0x9C9F94,
+    0x9FA196,
+    0xA0A295,
+    0xA1A396,
+    0x9FA395,
+    0x9FA395,
+    0xA0A496,
+    0xA1A597,
+    0x9CA594,
+    0x9EA796,
+    0x9FA696,
+    0xA0A797,
+    0xA4A899,
+    0xA5A799,
+    0xA1A395,
+    0x9D9E90,
+    0xA7A89A,
+    0xA8A99B,
+    0xA9AB9D,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAE9F,
+    0xABAFA0,
+    0xABAD9F,
+    0xABAD9F,
+    0xAAAE9F,
+    0xABAFA0,
+    0xA9B0A0,
+    0xAAB1A1,
+    0xA9B2A1,
+    0xA9B2A1,
+    0xA4AD9C,
+    0xA2AB9A,
+    0x9CA393,
+    0x949B8B,
+    0x929687,
+    0x929687,
+    0x909284,
+    0x8C8E80,
+    0x96988A,
+    0x9A9C8E,
+    0x9D9F91,
+    0x9B9D8F,
+    0x97998B,
+    0x959789,
+    0x96988A,
+    0x999B8D,
+    0x989A8C,
+    0x989A8C,
+    0x989A8C,
+    0x97998B,
+    0x96988A,
+    0x96988A,
+    0x959789,
+    0x959789,
+    0x989C8D,
+    0x969A8B,
+    0x95998A,
+    0x95998A,
+    0x969A8B,
+    0x979B8C,
+    0x979B8C,
+    0x969A8B,
+    0x9A9E8F,
+    0x9B9F90,
+    0x9CA091,
+    0x9CA091,
+    0x9B9F90,
+    0x9A9E8F,
+    0x999D8E,
+    0x989C8D,
+    0x9B9D8F,
+    0x989A8C,
+    0x939A8A,
+    0x929B8A,
+    0x929D8C,
+    0x93A08E,
+    0x90A18E,
+    0x8FA08D,
+    0x8A9D89,
+    0x8A9D89,
+    0x8B9C89,
+    0x8C9D8A,
+    0x8D9C89,
+    0x8D9C89,
+    0x8D9A88,
+    0x8D9A88,
+    0x889986,
+    0x869784,
+    0x889986,
+    0x869784,
+    0x859683,
+    0x5A6B58,
+    0x000D00,
+    0x001100,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D00,
+    0x000F00,
+    0x001006,
+    0x889993,
+    0x85948F,
+    0x818D89,
+    0x8A978E,
+    0x869088,
+    0x929991,
+    0x969992,
+    0x8E9188,
+    0x93948C,
+    0x97998E,
+    0x989A8F,
+    0x97998C,
+    0x97998C,
+    0x999B8E,
+    0x9A9E90,
+    0x979E8E,
+    0x969F8E,
+    0x989F8F,
+    0x9BA292,
+    0xA2A697,
+    0xA5A799,
+    0xA1A395,
+    0x9C9D8F,
+    0xA7A89A,
+    0xA9AA9C,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAC9E,
+    0xAAAE9F,
+    0xABAFA0,
+    0xAAAE9F,
+    0xAAAE9F,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA8B1A0,
+    0xA9B2A1,
+    0xA7B2A1,
+    0xA7B2A1,
+    0xACB5A4,
+    0xABB4A3,
+    0xA9B0A0,
+    0xA6AD9D,
+    0xA9AD9E,
+    0xAEB2A3,
+    0xB1B3A5,
+    0xB0B2A4,
+    0xA2A697,
+    0xA5A99A,
+    0xA7AB9C,
+    0xA7AB9C,
+    0xA6AA9B,
+    0xA5A99A,
+    0xA5A99A,
+    0xA7AB9C,
+    0xA3A798,
+    0xA2A697,
+    0xA2A697,
+    0xA1A596,
+    0xA0A495,
+    0xA0A495,
+    0x9FA394,
+    0x9FA394,
+    0x989C8D,
+    0x979B8C,
+    0x95998A,
+    0x95998A,
+    0x969A8B,
+    0x969A8B,
+    0x95998A,
+    0x949889,
+    0x888C7D,
+    0x888C7D,
+    0x888C7D,
+    0x888C7D,
+    0x878B7C,
+    0x868A7B,
+    0x85897A,
+    0x85897A,
+    0x8D8F81,
+    0x898B7D,
+    0x838A7A,
+    0x858C7C,
+    0x879281,
+    0x8B9685,
+    0x8A9986,
+    0x889784,
+    0x8B9C89,
+    0x8B9C89,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8E9D8A,
+    0x8E9D8A,
+    0x8D9C89,
+    0x8D9C89,
+    0x899A87,
+    0x899A87,
+    0x899A87,
+    0x859683,
+    0x869784,
+    0x6F806D,
+    0x000A00,
+    0x011200,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D00,
+    0x000F00,
+    0x001409,
+    0x92A39D,
+    0x8FA09A,
+    0x939F9B,
+    0x9DAAA3,
+    0x939C97,
+    0x9BA59D,
+    0x999E98,
+    0x979C95,
+    0x9C9F98,
+    0x9FA098,
+    0x9FA098,
+    0x9C9E91,
+    0x9A9C8F,
+    0x999D8F,
+    0x9A9E90,
+    0x969F8E,
+    0x949D8C,
+    0x969D8D,
+    0x9BA292,
+    0xA3A798,
+    0xA4A698,
+    0xA0A294,
+    0x9E9F91,
+    0xA8A99B,
+    0xAAAB9D,
+    0xAAAC9E,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAFA0,
+    0xACB0A1,
+    0xA9B0A0,
+    0xA9B0A0,
+    0xA8B1A0,
+    0xA8B1A0,
+    0xA6B1A0,
+    0xA7B2A1,
+    0xA7B2A1,
+    0xA7B2A1,
+    0xA7B2A1,
+    0xA6AF9E,
+    0x9EA796,
+    0x969D8D,
+    0x949889,
+    0x939788,
+    0x929486,
+    0x8E9082,
+    0x9DA192,
+    0x9CA091,
+    0x9B9F90,
+    0x9CA091,
+    0x9EA293,
+    0x9EA293,
+    0x9CA091,
+    0x9A9E8F,
+    0xA4A899,
+    0xA4A899,
+    0xA3A798,
+    0xA2A697,
+    0xA2A697,
+    0xA1A596,
+    0xA0A495,
+    0xA0A495,
+    0xA4A899,
+    0xA2A697,
+    0xA0A495,
+    0x9FA394,
+    0x9FA394,
+    0x9FA394,
+    0x9DA192,
+    0x9CA091,
+    0xA0A495,
+    0x9EA293,
+    0x9DA192,
+    0x9B9F90,
+    0x9B9F90,
+    0x9B9F90,
+    0x9CA091,
+    0x9DA192,
+    0x9A9C8E,
+    0x96988A,
+    0x919586,
+    0x939788,
+    0x959E8D,
+    0x99A291,
+    0x96A391,
+    0x95A290,
+    0x8D9C89,
+    0x8E9D8A,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8D9E8B,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8A9B88,
+    0x8B9C89,
+    0x8A9B88,
+    0x859683,
+    0x879885,
+    0x7D8E7B,
+    0x000E00,
+    0x001100,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000E00,
+    0x001000,
+    0x13241A,
+    0x93A49E,
+    0x909F9A,
+    0x929E9A,
+    0x98A4A0,
+    0x929B98,
+    0x9DA6A1,
+    0x9BA19D,
+    0x9DA29C,
+    0x9FA49E,
+    0xA2A59C,
+    0xA2A59C,
+    0xA0A698,
+    0xA0A698,
+    0xA0A797,
+    0xA1A898,
+    0x9BA493,
+    0x99A291,
+    0x9CA393,
+    0xA0A797,
+    0xA5A99A,
+    0xA4A698,
+    0xA1A395,
+    0xA0A193,
+    0xA8A99B,
+    0xAAAB9D,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAD9F,
+    0xABAFA0,
+    0xACB0A1,
+    0xA9B2A1,
+    0xA9B2A1,
+    0xA7B2A1,
+    0xA7B2A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA8B3A2,
+    0xAAB3A2,
+    0xA7B09F,
+    0xA6AD9D,
+    0xAAAE9F,
+    0xAFB1A3,
+    0xB1B3A5,
+    0xB0B1A3,
+    0xA8AC9E,
+    0xA4A89A,
+    0xA2A698,
+    0xA3A799,
+    0xA6AA9C,
+    0xA7AB9D,
+    0xA3A799,
+    0x9EA294,
+    0x9B9F91,
+    0x9A9E90,
+    0x9A9E90,
+    0x999D8F,
+    0x989C8E,
+    0x979B8D,
+    0x969A8C,
+    0x969A8C,
+    0x909485,
+    0x8E9283,
+    0x8C9081,
+    0x8B8F80,
+    0x8A8E7F,
+    0x898D7E,
+    0x888C7D,
+    0x868A7B,
+    0x8B8F80,
+    0x8A8E7F,
+    0x878B7C,
+    0x85897A,
+    0x85897A,
+    0x868A7B,
+    0x878B7C,
+    0x888C7D,
+    0x919385,
+    0x8E9082,
+    0x8B8D7F,
+    0x8A8C7E,
+    0x899080,
+    0x8A9181,
+    0x899281,
+    0x889180,
+    0x8E9B89,
+    0x8F9C8A,
+    0x8E9D8A,
+    0x8F9E8B,
+    0x8D9E8B,
+    0x8D9E8B,
+    0x8C9F8B,
+    0x8C9F8B,
+    0x8C9D8A,
+    0x8B9C89,
+    0x8B9C89,
+    0x869784,
+    0x899A87,
+    0x839481,
+    0x091A07,
+    0x001000,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000E00,
+    0x001000,
+    0x1E2E23,
+    0x889790,
+    0x86928E,
+    0x838E8A,
+    0x828D89,
+    0x828B88,
+    0x929896,
+    0x929896,
+    0x929793,
+    0x919692,
+    0x919890,
+    0x939A92,
+    0x969E91,
+    0x98A093,
+    0x98A392,
+    0x98A392,
+    0x9BA493,
+    0x9AA392,
+    0x9DA494,
+    0xA2A999,
+    0xA5A99A,
+    0xA2A496,
+    0xA0A294,
+    0xA2A395,
+    0xA9AA9C,
+    0xAAAB9D,
+    0xABAD9F,
+    0xACAEA0,
+    0xACAEA0,
+    0xACAEA0,
+    0xACB0A1,
+    0xABB2A2,
+    0xA9B2A1,
+    0xA7B2A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA7B2A1,
+    0xA8B1A0,
+    0xA3AC9B,
+    0xA0A495,
+    0x9DA192,
+    0x9EA092,
+    0x9C9D8F,
+    0x97998B,
+    0xA6AA9C,
+    0xA2A89A,
+    0xA2A89A,
+    0xA4AA9C,
+    0xA7AD9F,
+    0xA7AD9F,
+    0xA5AB9D,
+    0xA3A99B,
+    0xA8AEA0,
+    0xA7AD9F,
+    0xA6AC9E,
+    0xA5AB9D,
+    0xA4AA9C,
+    0xA3A99B,
+    0xA2A89A,
+    0xA2A89A,
+    0xA5A99A,
+    0xA3A798,
+    0xA1A596,
+    0xA0A495,
+    0xA0A495,
+    0xA0A495,
+    0x9EA293,
+    0x9DA192,
+    0x9FA394,
+    0x9EA293,
+    0x9DA192,
+    0x9CA091,
+    0x9CA091,
+    0x9CA091,
+    0x9CA091,
+    0x9D9F91,
+    0x97998B,
+    0x97988A,
+    0x949688,
+    0x939587,
+    0x919586,
+    0x909485,
+    0x8D9484,
+    0x8C9383,
+    0x909B8A,
+    0x909B8A,
+    0x8F9E8B,
+    0x8F9E8B,
+    0x8DA08C,
+    0x8DA08C,
+    0x8C9F8B,
+    0x8C9F8B,
+    0x8C9D8A,
+    0x8A9B88,
+    0x8C9D8A,
+    0x879885,
+    0x8C9D8A,
+    0x869784,
+    0x1B2C19,
+    0x001100,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000D00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000E00,
+    0x001000,
+    0x2C392F,
+    0x8E9B94,
+    0x97A29E,
+    0x9AA3A0,
+    0x97A09F,
+    0x989E9E,
+    0x9EA4A4,
+    0x9BA1A1,
+    0x9BA19D,
+    0x999F9B,
+    0x969D95,
+    0x979E96,
+    0x96A294,
+    0x98A496,
+    0x97A492,
+    0x97A291,
+    0x939E8D,
+    0x959E8D,
+    0x9AA191,
+    0xA0A797,
+    0xA3A798,
+    0xA0A294,
+    0x9FA193,
+    0xA3A496,
+    0xA9AA9C,
+    0xABAC9E,
+    0xABAD9F,
+    0xACAEA0,
+    0xACAEA0,
+    0xACAEA0,
+    0xACB0A1,
+    0xABB2A2,
+    0xA7B2A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA6B3A1,
+    0xA7B2A1,
+    0xA9B2A1,
+    0xA7B09F,
+    0xA6AA9B,
+    0xA5A99A,
+    0xA8AA9C,
+    0xA7A89A,
+    0xA2A496,
+    0x9CA092,
+    0x9CA294,
+    0x9FA597,
+    0xA2A89A,
+    0xA5AB9D,
+    0xA7AD9F,
+    0xA8AEA0,
+    0xA9AFA1,
+    0xA6AC9E,
+    0xA5AB9D,
+    0xA4AA9C,
+    0xA3A99B,
+    0xA2A89A,
+    0xA1A799,
+    0xA0A698,
+    0xA0A698,
+    0xA3A798,
+    0xA2A697,
+    0xA0A495,
+    0x9FA394,
+    0xA0A495,
+    0xA0A495,
+    0x9FA394,
+    0x9EA293,
+    0x9CA091,
+    0x9CA091,
+    0x9DA192,
+    0x9DA192,
+    0x9CA091,
+    0x9B9F90,
+    0x9A9E8F,
+    0x9A9C8E,
+    0x9A9C8E,
+    0x9B9C8E,
+    0x9B9D8F,
+    0x9A9C8E,
+    0x979B8C,
+    0x95998A,
+    0x939A8A,
+    0x949B8B,
+    0x909B8A,
+    0x909B8A,
+    0x8F9E8B,
+    0x8F9E8B,
+    0x8DA08C,
+    0x8DA08C,
+    0x8BA18C,
+    0x8DA08C,
+    0x8B9E8A,
+    0x899A87,
+    0x8D9E8B,
+    0x899A87,
+    0x8FA08D,
+    0x869784,
+    0x273825,
+    0x011200,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000E00,
+    0x001101,
+    0x37443A,
+    0x8F9C95,
+    0x96A19B,
+    0x95A09A,
+    0x97A29A,
+    0x97A29A,
+    0x96A298,
+    0x9DA99F,
+    0x99A398,
+    0x9BA59A,
+    0x9DA89A,
+    0x9FAA9C,
+    0xA0AB9B,
+    0xA0AB9B,
+    0xA2AB9A,
+    0x9FAA99,
+    0x9AA796,
+    0x9CA998,
+    0x9EAB9A,
+    0xA2AA9B,
+    0xA2AA9B,
+    0xA3A799,
+    0xA1A597,
+    0xA1A396,
+    0xABAB9F,
+    0xACACA0,
+    0xADADA1,
+    0xAEAEA2,
+    0xAEAEA2,
+    0xAEAEA2,
+    0xADAFA2,
+    0xACB0A2,
+    0xA7B2A1,
+    0xA7B4A2,
+    0xA6B5A2,
+    0xA6B5A2,
+    0xA6B5A2,
+    0xA6B5A2,
+    0xA4B5A3,
+    0xA3B4A2,
+    0xA4B5A3,
+    0xA8B6A5,
+    0x9FAD9E,
+    0xA3AFA1,
+    0xA4AFA1,
+    0xA1AC9E,
+    0xACB4A7,
+    0xABB1A5,
+    0xAAB1A1,
+    0xACB0A1,
+    0xABB2A2,
+    0xACB3A3,
+    0xA8AF9F,
+    0xA4AB9B,
+    0xA5AE9D,
+    0xABB4A3,
+    0xA6B1A0,
+    0xA4AF9E,
+    0xA3AE9D,
+    0xA4AF9E,
+    0xA1AE9C,
+    0x9DAA98,
+    0x9CA997,
+    0x9DAA98,
+    0x9BAA95,
+    0x99A893,
+    0x99A692,
+    0x9AA793,
+    0x9DA995,
+    0x9DA995,
+    0x9DA693,
+    0x9AA390,
+    0x9BA290,
+    0x9DA190,
+    0x9CA08F,
+    0x9C9F8E,
+    0x9D9E8E,
+    0x9D9E8E,
+    0x9D9E8E,
+    0x9D9E8E,
+    0x9A9B8D,
+    0x9A9B8D,
+    0x999B8D,
+    0x999B8D,
+    0x959C8C,
+    0x969D8D,
+    0x969F8E,
+    0x97A08F,
+    0x909D8B,
+    0x909D8B,
+    0x8D9E8B,
+    0x8D9E8B,
+    0x8C9F8B,
+    0x8C9F8B,
+    0x8AA08B,
+    0x8C9F8B,
+    0x8C9F8B,
+    0x90A18E,
+    0x889986,
+    0x8C9D8A,
+    0x90A18E,
+    0x81927F,
+    0x425340,
+    0x000D00,
+    0x000E00,
+    0x000C00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000E00,
+    0x001101,
+    0x404D44,
+    0x8E9A96,
+    0x8C9793,
+    0x88938F,
+    0x8A958F,
+    0x8B9690,
+    0x8A958D,
+    0x8F9A92,
+    0x949E95,
+    0x949E95,
+    0x949F91,
+    0x939E90,
+    0x939E90,
+    0x939E90,
+    0x959D8E,
+    0x949F8F,
+    0x9EAB9A,
+    0x9DAB9A,
+    0x9EAB9A,
+    0x9FAA9A,
+    0x9EA999,
+    0xA0A698,
+    0xA0A698,
+    0xA2A497,
+    0xABADA0,
+    0xACACA0,
+    0xADADA1,
+    0xAEAEA2,
+    0xAEAEA2,
+    0xAEAEA2,
+    0xADAFA2,
+    0xACB0A2,
+    0xA7B2A1,
+    0xA7B4A2,
+    0xA6B5A2,
+    0xA6B5A2,
+    0xA6B5A2,
+    0xA6B5A2,
+    0xA4B5A3,
+    0xA3B4A2,
+    0x9BAC9A,
+    0xA3B1A0,
+    0xA1AFA0,
+    0xACB8AA,
+    0xB0BBAD,
+    0xAAB5A7,
+    0xAFB7AA,
+    0xA7AFA2,
+    0xA3AA9A,
+    0xA4AB9B,
+    0xA6AD9D,
+    0xA8AF9F,
+    0xA8B1A0,
+    0xA7B09F,
+    0xA2AD9C,
+    0xA0AB9A,
+    0xA1AC9B,
+    0x9FAA99,
+    0x9FAC9A,
+    0xA2AF9D,
+    0xA2B19E,
+    0xA0AF9C,
+    0xA0AF9C,
+    0xA2B19E,
+    0xA2B19C,
+    0x9FAE99,
+    0x9CAB96,
+    0x9AA994,
+    0x9AA793,
+    0x99A692,
+    0x99A591,
+    0x98A490,
+    0x9AA692,
+    0x99A591,
+    0x9AA390,
+    0x99A28F,
+    0x99A08E,
+    0x989F8D,
+    0x989F8D,
+    0x989F8D,
+    0x989F8F,
+    0x989F8F,
+    0x989F8F,
+    0x979E8E,
+    0x959E8D,
+    0x949D8C,
+    0x919E8C,
+    0x919E8C,
+    0x909F8C,
+    0x909F8C,
+    0x8E9F8C,
+    0x8E9F8C,
+    0x8DA08C,
+    0x8DA08C,
+    0x8BA18C,
+    0x8DA08C,
+    0x8EA18D,
+    0x8FA08D,
+    0x8A9B88,
+    0x8B9C89,
+    0x8E9F8C,
+    0x859683,
+    0x4F604D,
+    0x000F00,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000C00,
+    0x000F00,
+    0x001101,
+    0x4B5851,
+    0x919D9B,
+    0x919B9A,
+    0x959F9E,
+    0x9AA5A1,
+    0x98A39F,
+    0x929D97,
+    0x919C96,
+    0x9CA69E,
+    0x9AA49C,
+    0x99A39A,
+    0x97A198,
+    0x97A196,
+    0x97A196,
+    0x9BA396,
+    0x99A496,
+    0x9FAC9B,
+    0x9EAC9B,
+    0x9EAB9A,
+    0x9EA999,
+    0x9DA898,
+    0xA0A698,
+    0xA0A698,
+    0xA2A698,
+    0xABADA0,
+    0xABADA0,
+    0xADADA1,
+    0xAEAEA2,
+    0xADAFA2,
+    0xAEB0A3,
+    0xAEB0A3,
+    0xACB0A2,
+    0xA8B3A2,
+    0xA7B4A2,
+    0xA6B5A2,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA6B5A2,
+    0xA4B5A3,
+    0xA4B5A3,
+    0x94A593,
+    0x97A594,
+    0x8D9B8C,
+    0x929E90,
+    0x96A193,
+    0x949F91,
+    0x9CA497,
+    0x959D90,
+    0xA1AA99,
+    0xA2AB9A,
+    0xA0A998,
+    0x9FA897,
+    0xA2AD9C,
+    0xA6B1A0,
+    0xA0AD9B,
+    0x96A391,
+    0x9AA795,
+    0x98A593,
+    0x98A794,
+    0x9BAA97,
+    0x9AAB98,
+    0x98A996,
+    0x98A996,
+    0x9AAB98,
+    0x94A592,
+    0x96A794,
+    0x99AA97,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9DAC99,
+    0x9DAC99,
+    0x9BAA97,
+    0x9AA996,
+    0x98A794,
+    0x97A693,
+    0x95A491,
+    0x94A390,
+    0x94A390,
+    0x93A28F,
+    0x95A491,
+    0x95A491,
+    0x95A491,
+    0x94A390,
+    0x94A390,
+    0x93A28F,
+    0x8FA08D,
+    0x8FA08D,
+    0x8E9F8C,
+    0x8E9F8C,
+    0x8E9F8C,
+    0x8E9F8C,
+    0x8DA08C,
+    0x8DA08C,
+    0x8DA08C,
+    0x8DA08C,
+    0x90A18E,
+    0x8D9E8B,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8B9C89,
+    0x8A9B88,
+    0x61725F,
+    0x001100,
+    0x000E00,
+    0x000D00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000F00,
+    0x011202,
+    0x596561,
+    0x94A0A0,
+    0x919B9C,
+    0x99A3A4,
+    0x9CA6A5,
+    0x9CA6A5,
+    0x99A4A0,
+    0x98A39F,
+    0x9EA7A2,
+    0x9DA6A1,
+    0x9DA79E,
+    0x9CA69D,
+    0x9DA79E,
+    0x9EA89F,
+    0xA1A99E,
+    0xA0AA9F,
+    0x9BA998,
+    0x9CAA99,
+    0x9CAA99,
+    0x9EA999,
+    0x9EA999,
+    0xA0A698,
+    0xA0A698,
+    0xA1A597,
+    0xABADA0,
+    0xABADA0,
+    0xACAEA1,
+    0xADAFA2,
+    0xAEB0A3,
+    0xAEB0A3,
+    0xAEB0A3,
+    0xADB1A3,
+    0xA8B3A2,
+    0xA7B4A2,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA4B5A3,
+    0xA4B5A3,
+    0x9AAB99,
+    0x9AA897,
+    0x8B998A,
+    0x8C988A,
+    0x909B8D,
+    0x919C8E,
+    0x9AA295,
+    0x929A8D,
+    0x8E9687,
+    0x8E9687,
+    0x859080,
+    0x7D8878,
+    0x808B7B,
+    0x8A9585,
+    0x879483,
+    0x7C8978,
+    0x7E8C7B,
+    0x7C8A79,
+    0x798A78,
+    0x7A8B79,
+    0x788977,
+    0x748573,
+    0x728572,
+    0x748573,
+    0x7F907D,
+    0x899885,
+    0x90A18E,
+    0x97A895,
+    0x98A996,
+    0x96A794,
+    0x93A692,
+    0x93A692,
+    0x94AA95,
+    0x93A994,
+    0x92A893,
+    0x91A792,
+    0x8FA791,
+    0x8EA690,
+    0x8DA58F,
+    0x8DA58F,
+    0x8EA48F,
+    0x8EA48F,
+    0x8EA48F,
+    0x8FA590,
+    0x91A490,
+    0x91A490,
+    0x8FA28E,
+    0x8EA18D,
+    0x8EA18D,
+    0x8EA18D,
+    0x8EA18D,
+    0x8EA18D,
+    0x8FA08D,
+    0x8FA08D,
+    0x8FA08D,
+    0x8FA08D,
+    0x90A18E,
+    0x8B9C89,
+    0x8FA08D,
+    0x8D9E8B,
+    0x8A9B88,
+    0x8D9E8B,
+    0x71826F,
+    0x001100,
+    0x000F00,
+    0x000D00,
+    0x000B00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D00,
+    0x001000,
+    0x021303,
+    0x687470,
+    0x94A0A0,
+    0x879192,
+    0x8A9495,
+    0x889291,
+    0x899392,
+    0x919C98,
+    0x96A19D,
+    0x939C97,
+    0x949D98,
+    0x959F96,
+    0x96A097,
+    0x96A097,
+    0x96A097,
+    0x98A095,
+    0x959F94,
+    0x97A594,
+    0x97A896,
+    0x9CAA99,
+    0x9FAC9B,
+    0x9FAC9B,
+    0xA1A99A,
+    0x9EA697,
+    0xA0A496,
+    0xAAAEA0,
+    0xACAEA1,
+    0xADAFA2,
+    0xADAFA2,
+    0xAEB0A3,
+    0xAEB0A3,
+    0xADB1A3,
+    0xABB1A3,
+    0xA8B3A2,
+    0xA7B4A2,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA3B4A2,
+    0xA9B7A6,
+    0xA2B0A1,
+    0xA8B4A6,
+    0xAEB9AB,
+    0xADB8AA,
+    0xB0B8AB,
+    0xA3AB9E,
+    0xABB3A4,
+    0xAEB6A7,
+    0xA9B1A2,
+    0xA0A899,
+    0x9FAA9A,
+    0xA8B3A3,
+    0xA7B4A3,
+    0x9FAC9B,
+    0xA2AF9E,
+    0x9FAC9B,
+    0x9DAB9A,
+    0x9EAC9B,
+    0x9BAC9A,
+    0x97A896,
+    0x95A694,
+    0x96A795,
+    0x909F8C,
+    0x96A592,
+    0x9DAC99,
+    0xA0AF9C,
+    0x9CAD9A,
+    0x98A996,
+    0x94A793,
+    0x93A692,
+    0x92A893,
+    0x92A893,
+    0x90A892,
+    0x8FA791,
+    0x8FA791,
+    0x8FA791,
+    0x8EA791,
+    0x8EA791,
+    0x8DA58F,
+    0x8CA48E,
+    0x8BA38D,
+    0x8CA48E,
+    0x8EA48F,
+    0x8EA48F,
+    0x8CA28D,
+    0x8AA08B,
+    0x8FA28E,
+    0x8FA28E,
+    0x8FA28E,
+    0x8FA28E,
+    0x90A18E,
+    0x90A18E,
+    0x90A18E,
+    0x90A18E,
+    0x8E9F8C,
+    0x8B9C89,
+    0x91A28F,
+    0x8FA08D,
+    0x8C9D8A,
+    0x8E9F8C,
+    0x7C8D7A,
+    0x021300,
+    0x000F00,
+    0x000D00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000D00,
+    0x001100,
+    0x021303,
+    0x6F7C75,
+    0x95A19F,
+    0x8D9796,
+    0x98A2A1,
+    0x95A09C,
+    0x929D99,
+    0x96A19B,
+    0x97A29C,
+    0x959F97,
+    0x96A098,
+    0x97A198,
+    0x98A299,
+    0x97A196,
+    0x96A095,
+    0x969E91,
+    0x939E90,
+    0x96A493,
+    0x96A795,
+    0x9CAA99,
+    0xA0AD9C,
+    0xA1AE9D,
+    0xA2AA9B,
+    0x9EA697,
+    0x9DA395,
+    0xABAFA1,
+    0xABAFA1,
+    0xADAFA2,
+    0xAEB0A3,
+    0xADB1A3,
+    0xADB1A3,
+    0xADB1A3,
+    0xABB1A3,
+    0xA8B3A2,
+    0xA8B5A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA5B6A4,
+    0xA4B5A3,
+    0xA2B3A1,
+    0xA8B6A5,
+    0x9EAC9D,
+    0x9FAB9D,
+    0xA3AEA0,
+    0xA3AEA0,
+    0xA9B1A4,
+    0x9EA699,
+    0x9FA599,
+    0xA5AB9F,
+    0xA8AEA2,
+    0xA5AB9F,
+    0xA4AC9F,
+    0xA8B0A3,
+    0xA7AFA2,
+    0xA2AA9D,
+    0xA2AD9F,
+    0xA0AB9D,
+    0xA0AC9E,
+    0xA3AFA1,
+    0xA3B1A2,
+    0xA1AFA0,
+    0xA1AFA0,
+    0xA3B1A2,
+    0xA1AE9D,
+    0xA1AE9D,
+    0x9FAC9B,
+    0x9DAA99,
+    0x9BA897,
+    0x9BA897,
+    0x9BA998,
+    0x9CAA99,
+    0x98A997,
+    0x98A997,
+    0x97A896,
+    0x97A896,
+    0x95A895,
+    0x95A895,
+    0x96A996,
+    0x96A996,
+    0x94AA95,
+    0x91A792,
+    0x8EA48F,
+    0x8EA48F,
+    0x92A591,
+    0x92A591,
+    0x91A490,
+    0x8FA28E,
+    0x90A38F,
+    0x90A38F,
+    0x90A38F,
+    0x90A38F,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x8D9E8B,
+    0x8E9F8C,
+    0x92A390,
+    0x8E9F8C,
+    0x90A18E,
+    0x8C9D8A,
+    0x849582,
+    0x0C1D0A,
+    0x000F00,
+    0x000D00,
+    0x000C00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000E00,
+    0x001100,
+    0x031404,
+    0x78857C,
+    0x98A4A0,
+    0x919C98,
+    0xA4AFAB,
+    0xA3AEA8,
+    0x9EA9A3,
+    0x9DA8A0,
+    0x97A29A,
+    0x9EA89F,
+    0x9EA89F,
+    0x9EA99B,
+    0x9EA99B,
+    0x9EA99B,
+    0x9EA99B,
+    0x9FA798,
+    0x9DA898,
+    0x98A997,
+    0x9AAB99,
+    0x9DAE9C,
+    0xA1AE9D,
+    0xA1AE9D,
+    0xA2AA9B,
+    0x9FA798,
+    0x9EA496,
+    0xABAFA1,
+    0xABAFA1,
+    0xACB0A2,
+    0xADB1A3,
+    0xADB1A3,
+    0xAEB2A4,
+    0xAEB2A4,
+    0xABB1A3,
+    0xA9B4A3,
+    0xA8B5A3,
+    0xA7B6A3,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xA7B6A3,
+    0xA5B6A4,
+    0xA5B6A4,
+    0x9FB09E,
+    0xA4B2A1,
+    0x94A293,
+    0x8E9A8C,
+    0x8E998B,
+    0x919C8E,
+    0x9CA497,
+    0x969C90,
+    0x8E9186,
+    0x929489,
+    0x96988D,
+    0x999B90,
+    0x999C91,
+    0x999C91,
+    0x969C90,
+    0x949A8E,
+    0x939B8E,
+    0x91998C,
+    0x929A8D,
+    0x959D90,
+    0x939E90,
+    0x919C8E,
+    0x919C8E,
+    0x939E90,
+    0x99A192,
+    0x959D8E,
+    0x8E9989,
+    0x8B9686,
+    0x8C9787,
+    0x8F9A8A,
+    0x929D8D,
+    0x949F8F,
+    0x98A393,
+    0x97A292,
+    0x96A191,
+    0x95A090,
+    0x94A190,
+    0x93A08F,
+    0x93A08F,
+    0x93A08F,
+    0x92A390,
+    0x8FA08D,
+    0x8C9D8A,
+    0x8D9E8B,
+    0x91A28F,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x90A38F,
+    0x90A38F,
+    0x8E9F8C,
+    0x91A28F,
+    0x91A28F,
+    0x8B9C89,
+    0x94A592,
+    0x8B9C89,
+    0x8B9C89,
+    0x1B2C19,
+    0x000F00,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000E00,
+    0x001100,
+    0x031404,
+    0x869389,
+    0x96A39C,
+    0x7F8A84,
+    0x8B9690,
+    0x8A958D,
+    0x8B968E,
+    0x919D93,
+    0x8E9A90,
+    0x9AA499,
+    0x9AA499,
+    0x99A496,
+    0x99A496,
+    0x9AA595,
+    0x9CA797,
+    0xA1AA99,
+    0xA0AB9A,
+    0x9EAF9D,
+    0x9DB09D,
+    0x9EAF9D,
+    0xA0AE9D,
+    0xA0AD9C,
+    0xA1A99A,
+    0x9FA798,
+    0x9FA597,
+    0xABAFA1,
+    0xABAFA1,
+    0xACB0A2,
+    0xADB1A3,
+    0xADB1A3,
+    0xAEB2A4,
+    0xACB2A4,
+    0xABB3A4,
+    0xA9B4A3,
+    0xA8B5A3,
+    0xA7B6A3,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xA7B6A3,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA2B3A1,
+    0xADBBAA,
+    0xA7B5A6,
+    0xA6B2A4,
+    0xA6B1A3,
+    0xA6B1A3,
+    0xADB5A8,
+    0xA4AA9E,
+    0xABADA2,
+    0xA9A99F,
+    0xA8A89E,
+    0xACACA2,
+    0xADAFA4,
+    0xACAEA3,
+    0xABAEA3,
+    0xADB0A5,
+    0xA7ADA1,
+    0xA4AA9E,
+    0xA3A99D,
+    0xA4AA9E,
+    0xA2AA9D,
+    0x9EA699,
+    0x9CA497,
+    0x9DA598,
+    0x9DA596,
+    0x98A091,
+    0x939B8C,
+    0x909889,
+    0x91998A,
+    0x939B8C,
+    0x949A8C,
+    0x93998B,
+    0x8F9587,
+    0x8E9486,
+    0x8D9385,
+    0x8B9183,
+    0x8A9082,
+    0x898F81,
+    0x898F81,
+    0x878F80,
+    0x889382,
+    0x84917F,
+    0x828F7D,
+    0x859280,
+    0x8A9986,
+    0x909F8C,
+    0x93A28F,
+    0x93A28F,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x91A490,
+    0x91A490,
+    0x8E9F8C,
+    0x93A491,
+    0x90A18E,
+    0x899A87,
+    0x96A794,
+    0x8A9B88,
+    0x8FA08D,
+    0x273825,
+    0x000F00,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000F00,
+    0x000700,
+    0x001100,
+    0x000900,
+    0x000C00,
+    0x001003,
+    0x08180E,
+    0x90A096,
+    0x909F98,
+    0x929F98,
+    0x939E98,
+    0x939E96,
+    0x949E96,
+    0x969D96,
+    0x969D96,
+    0x979E97,
+    0x979E97,
+    0x969D95,
+    0x959C94,
+    0x929C93,
+    0x939D94,
+    0x96A298,
+    0x98A59B,
+    0x9DAE9E,
+    0x9FB1A1,
+    0x9CAE9E,
+    0x9DAE9E,
+    0xA1B2A2,
+    0x9FAB9D,
+    0x9BA897,
+    0xA1AC9C,
+    0xA9B1A2,
+    0xAAB0A2,
+    0xAAB1A1,
+    0xAEB0A2,
+    0xAEB0A2,
+    0xAFB0A2,
+    0xAFB0A2,
+    0xAEB2A3,
+    0xA8B5A1,
+    0xA5B7A1,
+    0xA5B7A1,
+    0xA5B7A1,
+    0xA5B6A3,
+    0xA5B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA5B4A1,
+    0xAAB9A6,
+    0xAFBCAB,
+    0xADBAA9,
+    0xA6B3A2,
+    0xA2AF9E,
+    0xA4B1A0,
+    0xA9B4A4,
+    0xA9B1A2,
+    0xA9AFA1,
+    0xA8AEA0,
+    0xA9AFA1,
+    0xABB1A3,
+    0xABB1A3,
+    0xA9AFA1,
+    0xA7AD9F,
+    0xA7AD9F,
+    0xA5AB9D,
+    0xA3A99B,
+    0xA2A89A,
+    0xA4AA9C,
+    0xA6AC9E,
+    0xA7AD9F,
+    0xA9AD9F,
+    0xA6AA9C,
+    0xA7A99C,
+    0xA6A89B,
+    0xA5A79A,
+    0xA4A699,
+    0xA3A598,
+    0xA2A698,
+    0xA1A597,
+    0x9FA395,
+    0x9EA294,
+    0x9BA193,
+    0x9BA193,
+    0x9BA193,
+    0x9BA193,
+    0x999F91,
+    0x979F90,
+    0x95A491,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x91A28F,
+    0x91A28F,
+    0x91A28F,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x91A28F,
+    0x94A592,
+    0x8C9D8A,
+    0x96A794,
+    0x8FA08D,
+    0x91A28F,
+    0x8C9D8A,
+    0x3E4F3C,
+    0x000D00,
+    0x000D00,
+    0x000D00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000A00,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000E00,
+    0x000700,
+    0x001100,
+    0x000900,
+    0x000D00,
+    0x001003,
+    0x0E1E14,
+    0x91A197,
+    0x92A19A,
+    0x95A29B,
+    0x98A39D,
+    0x9AA59D,
+    0x9DA79F,
+    0xA0A7A0,
+    0xA1A8A1,
+    0xA0A7A0,
+    0xA0A7A0,
+    0xA0A79F,
+    0x9EA59D,
+    0x9CA69D,
+    0x9DA79E,
+    0xA0ACA2,
+    0xA2AFA5,
+    0x9DAE9E,
+    0x9FB1A1,
+    0x9DAE9E,
+    0x9DAE9E,
+    0xA3B1A2,
+    0x9EAC9D,
+    0x9BA897,
+    0xA0AD9C,
+    0xA7B2A2,
+    0xA7B2A2,
+    0xAAB3A2,
+    0xAAB3A2,
+    0xABB2A2,
+    0xABB2A2,
+    0xADB1A2,
+    0xACB3A3,
+    0xA7B6A1,
+    0xA5B7A1,
+    0xA5B7A1,
+    0xA5B7A1,
+    0xA5B6A3,
+    0xA5B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0x9FAE9B,
+    0x9DAC99,
+    0x99A695,
+    0x909D8C,
+    0x8A9786,
+    0x8B9887,
+    0x929F8E,
+    0x99A494,
+    0x9BA394,
+    0x989E90,
+    0x959B8D,
+    0x959B8D,
+    0x979D8F,
+    0x979D8F,
+    0x959B8D,
+    0x92988A,
+    0x9EA496,
+    0x9DA395,
+    0x9BA193,
+    0x9BA193,
+    0x9BA193,
+    0x9BA193,
+    0x9AA092,
+    0x989E90,
+    0x9B9F91,
+    0x9CA092,
+    0x9EA294,
+    0xA0A496,
+    0x9FA597,
+    0x9EA496,
+    0x9DA395,
+    0x9DA395,
+    0xA1A799,
+    0xA0A698,
+    0x9EA697,
+    0x9FA798,
+    0x9FA798,
+    0x9FA798,
+    0x9EA697,
+    0x9AA595,
+    0x95A491,
+    0x93A491,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x91A28F,
+    0x91A28F,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x90A18E,
+    0x94A592,
+    0x8E9F8C,
+    0x96A794,
+    0x8FA08D,
+    0x91A28F,
+    0x8D9E8B,
+    0x485946,
+    0x001000,
+    0x001000,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000D00,
+    0x000700,
+    0x001000,
+    0x000900,
+    0x000D00,
+    0x001003,
+    0x18281E,
+    0x90A096,
+    0x909F98,
+    0x929F98,
+    0x949F99,
+    0x949F97,
+    0x959F97,
+    0x979E97,
+    0x989F98,
+    0x9EA59E,
+    0x9EA59E,
+    0x9EA59D,
+    0x9DA49C,
+    0x9BA59C,
+    0x9CA69D,
+    0x9FABA1,
+    0xA1ADA3,
+    0x9DAE9E,
+    0x9FB0A0,
+    0x9DAE9E,
+    0x9DAE9E,
+    0xA1B2A2,
+    0x9CAD9D,
+    0x9AA897,
+    0xA0AE9D,
+    0xA5B3A2,
+    0xA6B4A3,
+    0xA7B4A2,
+    0xA7B4A2,
+    0xA7B4A2,
+    0xA7B4A2,
+    0xA8B5A3,
+    0xA8B5A3,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xADBCA9,
+    0xACBBA8,
+    0xACB9A8,
+    0xA9B6A5,
+    0xA7B4A3,
+    0xA7B4A3,
+    0xA9B6A5,
+    0xACB7A7,
+    0xA9B4A4,
+    0xA8B0A1,
+    0xA4AC9D,
+    0xA4AC9D,
+    0xA6AE9F,
+    0xA6AE9F,
+    0xA4AC9D,
+    0xA1A99A,
+    0x9CA495,
+    0x9BA394,
+    0x9BA394,
+    0x9BA394,
+    0x9BA394,
+    0x9AA293,
+    0x98A091,
+    0x959D8E,
+    0x99A192,
+    0x9BA394,
+    0x9EA697,
+    0xA1A99A,
+    0xA3AB9C,
+    0xA3AB9C,
+    0x9FAA9A,
+    0x9EA999,
+    0x9BA696,
+    0x9AA595,
+    0x97A493,
+    0x97A493,
+    0x98A594,
+    0x97A493,
+    0x95A291,
+    0x93A08F,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x90A18E,
+    0x94A592,
+    0x90A18E,
+    0x96A794,
+    0x8E9F8C,
+    0x91A28F,
+    0x90A18E,
+    0x586956,
+    0x021300,
+    0x001100,
+    0x000F00,
+    0x000C00,
+    0x000A00,
+    0x000900,
+    0x000A00,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000C00,
+    0x000800,
+    0x000F00,
+    0x000A00,
+    0x000E01,
+    0x011104,
+    0x26362C,
+    0x91A197,
+    0x91A099,
+    0x929F98,
+    0x939E98,
+    0x929D95,
+    0x939D95,
+    0x959C95,
+    0x949B94,
+    0x949B94,
+    0x959C95,
+    0x959C94,
+    0x949B93,
+    0x929C93,
+    0x949E95,
+    0x96A298,
+    0x99A59B,
+    0x9DAE9E,
+    0x9FB0A0,
+    0x9DAE9E,
+    0x9EAF9F,
+    0xA2B3A3,
+    0x9DAE9E,
+    0x99AA98,
+    0x9EAF9D,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA3B6A2,
+    0xA3B6A2,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xA5B4A1,
+    0xA4B3A0,
+    0xA5B2A1,
+    0xA6B3A2,
+    0xA6B3A2,
+    0xA5B2A1,
+    0xA4B1A0,
+    0xA3AE9E,
+    0xA7B2A2,
+    0xA9B1A2,
+    0xAAB2A3,
+    0xABB3A4,
+    0xAAB2A3,
+    0xAAB2A3,
+    0xA9B1A2,
+    0xA9B1A2,
+    0xA7AFA0,
+    0xA6AE9F,
+    0xA6AE9F,
+    0xA7AFA0,
+    0xA8B0A1,
+    0xA8B0A1,
+    0xA7AFA0,
+    0xA6AE9F,
+    0x9AA796,
+    0x9BA897,
+    0x9CA998,
+    0x9EAB9A,
+    0x9EAB9A,
+    0x9DAA99,
+    0x9CA998,
+    0x9BA897,
+    0x9DAB9A,
+    0x9CAA99,
+    0x9BA998,
+    0x9BA998,
+    0x9BA998,
+    0x9AA897,
+    0x96A795,
+    0x94A593,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x92A390,
+    0x90A18E,
+    0x94A592,
+    0x93A491,
+    0x95A693,
+    0x8E9F8C,
+    0x91A28F,
+    0x92A390,
+    0x6B7C69,
+    0x021300,
+    0x001000,
+    0x000E00,
+    0x000D00,
+    0x000A00,
+    0x000800,
+    0x000900,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000E00,
+    0x000B00,
+    0x000E01,
+    0x011104,
+    0x35453B,
+    0x94A49A,
+    0x95A49D,
+    0x98A59E,
+    0x9AA59F,
+    0x9CA79F,
+    0x9FA9A1,
+    0xA2A9A2,
+    0xA2A9A2,
+    0xA0A7A0,
+    0xA1A8A1,
+    0xA2A9A1,
+    0xA2A9A1,
+    0xA0AAA1,
+    0xA1ABA2,
+    0xA3AFA5,
+    0xA5B1A7,
+    0x9FAD9E,
+    0xA1AFA0,
+    0x9DAE9E,
+    0x9EAF9F,
+    0xA2B3A3,
+    0x9DAE9E,
+    0x99AA98,
+    0x9FB09E,
+    0xA3B6A3,
+    0xA3B6A3,
+    0xA3B6A2,
+    0xA3B6A2,
+    0xA2B8A3,
+    0xA2B8A3,
+    0xA2B8A3,
+    0xA4B7A3,
+    0xA5B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xA5B4A1,
+    0x9EAD9A,
+    0x96A392,
+    0x8F9C8B,
+    0x8E9B8A,
+    0x909D8C,
+    0x93A08F,
+    0x94A190,
+    0x939E8E,
+    0x99A494,
+    0x9EA999,
+    0x9EA999,
+    0x9AA595,
+    0x96A191,
+    0x97A292,
+    0x99A494,
+    0x9FAA9A,
+    0x9DA898,
+    0x9AA595,
+    0x9AA595,
+    0x9BA696,
+    0x9CA797,
+    0x9DA898,
+    0x9CA797,
+    0xA1AE9D,
+    0xA0AD9C,
+    0x9FAC9B,
+    0x9EAB9A,
+    0x9DAB9A,
+    0x9CAA99,
+    0x9DAB9A,
+    0x9DAB9A,
+    0x94A593,
+    0x93A492,
+    0x93A492,
+    0x95A694,
+    0x97A896,
+    0x97A896,
+    0x96A795,
+    0x95A694,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x91A28F,
+    0x93A491,
+    0x94A592,
+    0x95A693,
+    0x8E9F8C,
+    0x91A28F,
+    0x93A491,
+    0x7C8D7A,
+    0x031401,
+    0x000F00,
+    0x000C00,
+    0x000D00,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000A00,
+    0x000D00,
+    0x000C00,
+    0x000F02,
+    0x011104,
+    0x435349,
+    0x92A298,
+    0x93A29B,
+    0x95A29B,
+    0x97A29C,
+    0x98A39B,
+    0x99A39B,
+    0x9CA39C,
+    0x9CA39C,
+    0x9FA69F,
+    0xA0A7A0,
+    0xA1A8A0,
+    0xA1A8A0,
+    0x9FA9A0,
+    0xA0AAA1,
+    0xA1ADA3,
+    0xA3AFA5,
+    0x9FAD9E,
+    0xA1AFA0,
+    0x9DAE9E,
+    0x9EAF9F,
+    0xA2B3A3,
+    0x9EAF9F,
+    0x9AAB99,
+    0xA0B19F,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA4B7A3,
+    0xA5B8A4,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B8A2,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xADBCA9,
+    0xAAB9A6,
+    0xA6B3A2,
+    0xA3B09F,
+    0xA1AE9D,
+    0xA1AE9D,
+    0xA2AF9E,
+    0xA2AF9E,
+    0x9BA897,
+    0xA0AD9C,
+    0xA5B2A1,
+    0xA4B1A0,
+    0x9EAB9A,
+    0x9AA796,
+    0x9AA796,
+    0x9CA998,
+    0x9AA796,
+    0x97A493,
+    0x94A190,
+    0x929F8E,
+    0x919E8D,
+    0x929F8E,
+    0x929F8E,
+    0x929F8E,
+    0x8E9B8A,
+    0x8D9A89,
+    0x8B9887,
+    0x8A9786,
+    0x899786,
+    0x8A9887,
+    0x8C9A89,
+    0x8D9B8A,
+    0x8C9A89,
+    0x8C9A89,
+    0x8B9C8A,
+    0x8E9F8D,
+    0x91A290,
+    0x93A492,
+    0x94A593,
+    0x93A492,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x92A390,
+    0x93A491,
+    0x95A693,
+    0x94A592,
+    0x8FA08D,
+    0x92A390,
+    0x92A390,
+    0x889986,
+    0x091A07,
+    0x001100,
+    0x000A00,
+    0x000C00,
+    0x000E00,
+    0x000A00,
+    0x000800,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000A00,
+    0x000C00,
+    0x000C00,
+    0x000F02,
+    0x011104,
+    0x4E5E54,
+    0x91A197,
+    0x909F98,
+    0x929F98,
+    0x929D97,
+    0x929D95,
+    0x929C94,
+    0x949B94,
+    0x939A93,
+    0x919891,
+    0x929992,
+    0x939A92,
+    0x939A92,
+    0x909A91,
+    0x919B92,
+    0x919D93,
+    0x939F95,
+    0x9DAE9E,
+    0x9FB0A0,
+    0x9DAE9E,
+    0x9EAF9F,
+    0xA3B4A4,
+    0x9EAF9F,
+    0x9CAA99,
+    0xA2B09F,
+    0xA6B4A3,
+    0xA7B5A4,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA7B6A3,
+    0xA8B7A4,
+    0xA8B7A4,
+    0xA7B9A3,
+    0xA7B9A3,
+    0xA7B9A3,
+    0xA7B9A3,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA9B8A5,
+    0xA9B8A5,
+    0xA1B09D,
+    0xA5B4A1,
+    0xAAB7A6,
+    0xADBAA9,
+    0xADBAA9,
+    0xAAB7A6,
+    0xA7B4A3,
+    0xA4B1A0,
+    0xA8B5A4,
+    0xA9B6A5,
+    0xAAB7A6,
+    0xA8B5A4,
+    0xA6B3A2,
+    0xA4B1A0,
+    0xA4B1A0,
+    0xA5B2A1,
+    0xA9B6A5,
+    0xA7B4A3,
+    0xA4B1A0,
+    0xA3B09F,
+    0xA2AF9E,
+    0xA2AF9E,
+    0xA1AE9D,
+    0xA0AD9C,
+    0x9FAC9B,
+    0x9FAC9B,
+    0x9EAB9A,
+    0x9EAB9A,
+    0x9DAA99,
+    0x9EAB9A,
+    0x9FAC9B,
+    0x9FAC9B,
+    0x97A594,
+    0x96A493,
+    0x97A594,
+    0x99A796,
+    0x99AA98,
+    0x9BAC9A,
+    0x9AAB99,
+    0x99AA98,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x94A592,
+    0x92A390,
+    0x96A794,
+    0x93A491,
+    0x91A28F,
+    0x93A491,
+    0x90A18E,
+    0x8FA08D,
+    0x152613,
+    0x051603,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000B00,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x000800,
+    0x000B00,
+    0x000B00,
+    0x000C00,
+    0x001003,
+    0x011104,
+    0x536359,
+    0x95A59B,
+    0x95A49D,
+    0x98A59E,
+    0x9AA59F,
+    0x9CA79F,
+    0x9EA8A0,
+    0xA1A8A1,
+    0xA1A8A1,
+    0xA2A9A2,
+    0xA3AAA3,
+    0xA4ABA3,
+    0xA4ABA3,
+    0xA1ABA2,
+    0xA1ABA2,
+    0xA2AEA4,
+    0xA3AFA5,
+    0x9DAE9E,
+    0x9FB0A0,
+    0x9DAE9E,
+    0x9EAF9F,
+    0xA5B3A4,
+    0xA0AE9F,
+    0x9DAB9A,
+    0xA2B09F,
+    0xA7B4A3,
+    0xA8B5A4,
+    0xA8B5A3,
+    0xA8B5A3,
+    0xA9B4A3,
+    0xAAB5A4,
+    0xAAB5A4,
+    0xA9B6A4,
+    0xA9B8A3,
+    0xA7B9A3,
+    0xA7B9A3,
+    0xA7B9A3,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA9B8A5,
+    0xA9B8A5,
+    0xACBBA8,
+    0xABBAA7,
+    0xABB8A7,
+    0xA8B5A4,
+    0xA6B3A2,
+    0xA6B3A2,
+    0xA8B5A4,
+    0xABB8A7,
+    0xABB9A8,
+    0xA7B5A4,
+    0xA4B2A1,
+    0xA3B1A0,
+    0xA6B4A3,
+    0xA8B6A5,
+    0xA8B6A5,
+    0xA7B5A4,
+    0xA3B1A0,
+    0xA2B09F,
+    0xA2B09F,
+    0xA3B1A0,
+    0xA3B1A0,
+    0xA3B1A0,
+    0xA1AF9E,
+    0xA0AD9C,
+    0xA0AD9C,
+    0xA1AC9C,
+    0xA1AC9C,
+    0xA1AC9C,
+    0x9FAC9B,
+    0x9EAB9A,
+    0x9CA998,
+    0x9CA998,
+    0x9EAB9A,
+    0x9DAA99,
+    0x9BA998,
+    0x9BA998,
+    0x9BA998,
+    0x9AA897,
+    0x98A695,
+    0x96A493,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x95A693,
+    0x92A390,
+    0x96A794,
+    0x93A491,
+    0x92A390,
+    0x93A491,
+    0x8FA08D,
+    0x92A390,
+    0x1F301D,
+    0x0A1B08,
+    0x000A00,
+    0x000900,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000800,
+    0x000E00,
+    0x000B00,
+    0x000B00,
+    0x011106,
+    0x041409,
+    0x5F6F65,
+    0x99A69F,
+    0x96A39C,
+    0x96A39C,
+    0x99A69F,
+    0x9AA79E,
+    0x9AA79E,
+    0x9CA79F,
+    0x9FAAA2,
+    0x9CA89E,
+    0x9DA99F,
+    0x9FAB9F,
+    0xA1ADA1,
+    0xA4AFA1,
+    0xA4AFA1,
+    0xA4AFA1,
+    0xA3AFA1,
+    0xA1B09D,
+    0xA0B19E,
+    0xA1B29F,
+    0xA1B29F,
+    0xA0B19E,
+    0xA0B19E,
+    0xA0B19E,
+    0xA1B29F,
+    0xA5B6A3,
+    0xA5B6A3,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA5B8A5,
+    0xA5B8A5,
+    0xA5B8A5,
+    0xA6B9A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9B7A6,
+    0xA6B4A3,
+    0xA1AF9E,
+    0x9AA897,
+    0x94A291,
+    0x919D8F,
+    0x8B978B,
+    0x919B92,
+    0x959F96,
+    0x949E95,
+    0x949E93,
+    0x96A095,
+    0x94A094,
+    0x929E92,
+    0x98A498,
+    0x95A195,
+    0x919D8F,
+    0x8E9A8C,
+    0x909E8F,
+    0x94A293,
+    0x93A192,
+    0x8F9D8C,
+    0x8C9F8B,
+    0x90A38D,
+    0x97AA94,
+    0x9DB09A,
+    0x9FB29C,
+    0x9EB19B,
+    0x9AAD97,
+    0x98AB95,
+    0x98AB95,
+    0x97AA94,
+    0x97AA94,
+    0x97AA94,
+    0x98AB95,
+    0x98AB95,
+    0x96A993,
+    0x95A892,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x92A390,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x91A28F,
+    0x90A18E,
+    0x90A18E,
+    0x334431,
+    0x021300,
+    0x001100,
+    0x000700,
+    0x000C00,
+    0x000B00,
+    0x000700,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000B00,
+    0x000E01,
+    0x001005,
+    0x041409,
+    0x6A7A70,
+    0x8D9A93,
+    0x8A9790,
+    0x89968F,
+    0x8C9992,
+    0x8D9A93,
+    0x8C9992,
+    0x8F9A92,
+    0x929D95,
+    0x8D9890,
+    0x8E9991,
+    0x8F9B91,
+    0x8F9B91,
+    0x919B92,
+    0x909A91,
+    0x909A8F,
+    0x8E9A8C,
+    0x9BA998,
+    0x9BAC99,
+    0x9EAF9C,
+    0x9FB09D,
+    0xA0B19E,
+    0xA1B29F,
+    0xA3B4A1,
+    0xA4B5A2,
+    0xA5B6A3,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA5B8A5,
+    0xA5B8A5,
+    0xA6B9A6,
+    0xA6B9A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA8B6A5,
+    0xA8B6A5,
+    0xAAB8A7,
+    0xABB9A8,
+    0xADBBAA,
+    0xAFBBAD,
+    0xA9B5A9,
+    0xADB7AE,
+    0xADB9AF,
+    0xAAB6AC,
+    0xA8B4A8,
+    0xA9B5A9,
+    0xA8B4A8,
+    0xA6B2A6,
+    0xA7B5A6,
+    0xA6B4A5,
+    0xA2B0A1,
+    0x9EAC9D,
+    0x9DAB9C,
+    0x9EAC9D,
+    0x99AA9A,
+    0x94A593,
+    0x96A995,
+    0x97AA94,
+    0x99AC96,
+    0x9AAD97,
+    0x9BAE98,
+    0x9BAE98,
+    0x9BAE98,
+    0x9BAE98,
+    0x99AC96,
+    0x9AAD97,
+    0x9BAE98,
+    0x99AC96,
+    0x97AA94,
+    0x96A993,
+    0x95A892,
+    0x96A993,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x92A390,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x93A491,
+    0x92A390,
+    0x90A18E,
+    0x90A18E,
+    0x41523F,
+    0x021300,
+    0x001000,
+    0x000900,
+    0x000C00,
+    0x000A00,
+    0x000800,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000900,
+    0x000C00,
+    0x000B00,
+    0x000A00,
+    0x021205,
+    0x000E03,
+    0x041409,
+    0x7A8A80,
+    0x9DAAA3,
+    0x9AA7A0,
+    0x99A69F,
+    0x9BA8A1,
+    0x9BA8A1,
+    0x9BA8A1,
+    0x9EA9A3,
+    0xA2ADA7,
+    0x9FAAA4,
+    0x9FAAA4,
+    0xA0ABA5,
+    0xA0ABA5,
+    0xA1AAA5,
+    0xA0A9A4,
+    0xA0A9A4,
+    0x9EA9A1,
+    0xA1AF9E,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA3B4A1,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA3B4A1,
+    0xA4B5A2,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA6B9A6,
+    0xA6B9A6,
+    0xA6B9A6,
+    0xA6B9A6,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA8B9A7,
+    0xA9B7A6,
+    0xA8B6A5,
+    0xA7B5A4,
+    0xA6B4A3,
+    0xA6B4A3,
+    0xA6B4A5,
+    0xA2AEA0,
+    0xA5B1A5,
+    0xA5B3A6,
+    0xA2B0A3,
+    0xA1AFA2,
+    0xA4B2A5,
+    0xA6B4A7,
+    0xA5B3A6,
+    0xA0B1A1,
+    0xA2B3A3,
+    0xA2B3A3,
+    0xA0B1A1,
+    0xA0B19F,
+    0xA3B4A2,
+    0xA2B3A1,
+    0xA0B19F,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9BAC99,
+    0x9DAE9B,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9AAB98,
+    0x98A996,
+    0x98A996,
+    0x99AA97,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x93A491,
+    0x93A491,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x91A28F,
+    0x90A18E,
+    0x566754,
+    0x011200,
+    0x000E00,
+    0x000E00,
+    0x000B00,
+    0x000800,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000900,
+    0x000E00,
+    0x000B00,
+    0x000900,
+    0x031306,
+    0x000B00,
+    0x031308,
+    0x889790,
+    0x9CA9A2,
+    0x99A5A1,
+    0x97A39F,
+    0x99A5A1,
+    0x99A5A1,
+    0x99A5A1,
+    0x9DA8A4,
+    0xA1ACA8,
+    0xA2ADA9,
+    0xA2ADA9,
+    0xA3AEAA,
+    0xA4AFAB,
+    0xA5AEAB,
+    0xA6AFAC,
+    0xA6AFAC,
+    0xA5B0AA,
+    0xA1AFA0,
+    0xA1B2A0,
+    0xA2B3A1,
+    0xA3B4A2,
+    0xA2B3A1,
+    0xA2B3A1,
+    0xA3B4A2,
+    0xA4B5A3,
+    0xA6B7A5,
+    0xA6B7A5,
+    0xA6B7A5,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA6B9A6,
+    0xA6B9A6,
+    0xA7BAA7,
+    0xA7BAA7,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xABB9A8,
+    0xA9B7A6,
+    0xA5B3A2,
+    0x9FAD9C,
+    0x98A695,
+    0x95A394,
+    0x93A192,
+    0x95A396,
+    0x96A497,
+    0x93A194,
+    0x93A194,
+    0x97A598,
+    0x98A999,
+    0x98A999,
+    0x91A292,
+    0x95A696,
+    0x96A996,
+    0x95A895,
+    0x97AA97,
+    0x9CAF9C,
+    0xA0B3A0,
+    0xA0B3A0,
+    0x9EAF9C,
+    0x9FB09D,
+    0xA0B19E,
+    0xA1B29F,
+    0xA0B19E,
+    0x9DAE9B,
+    0x9AAB98,
+    0x98A996,
+    0x99AA97,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x93A491,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x94A592,
+    0x93A491,
+    0x91A28F,
+    0x91A28F,
+    0x6A7B68,
+    0x001100,
+    0x000A00,
+    0x011200,
+    0x000900,
+    0x000700,
+    0x000E00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000A00,
+    0x000E00,
+    0x000B00,
+    0x000900,
+    0x011104,
+    0x000A00,
+    0x06160B,
+    0x8F9E97,
+    0x8F9C95,
+    0x8C9894,
+    0x8B9793,
+    0x8C9894,
+    0x8D9995,
+    0x8D9995,
+    0x909B97,
+    0x949F9B,
+    0x95A09C,
+    0x95A09C,
+    0x96A19D,
+    0x96A19D,
+    0x98A19E,
+    0x99A29F,
+    0x99A29F,
+    0x99A49E,
+    0x95A394,
+    0x96A795,
+    0x9AAB99,
+    0x9DAE9C,
+    0x9FB09E,
+    0xA2B3A1,
+    0xA5B6A4,
+    0xA7B8A6,
+    0xA6B7A5,
+    0xA6B7A5,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA8B9A7,
+    0xA7BAA7,
+    0xA7BAA7,
+    0xA7BAA7,
+    0xA7BAA7,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA3B4A2,
+    0xA5B6A4,
+    0xAAB8A7,
+    0xACBAA9,
+    0xACBAA9,
+    0xA9B7A6,
+    0xA6B4A3,
+    0xA4B2A3,
+    0xA4B0A2,
+    0xA6B2A6,
+    0xA4B2A3,
+    0xA0AE9F,
+    0x9EAC9D,
+    0x9FAD9E,
+    0xA0AE9F,
+    0x9FAD9E,
+    0x9AAB99,
+    0x9CAD9B,
+    0x9BAC9A,
+    0x98A997,
+    0x98A997,
+    0x9CAD9B,
+    0x9FB29E,
+    0x9FB29E,
+    0x9DAE9B,
+    0x9EAF9C,
+    0x9FB09D,
+    0xA0B19E,
+    0x9FB09D,
+    0x9DAE9B,
+    0x9AAB98,
+    0x99AA97,
+    0x9BAC99,
+    0x99AA97,
+    0x97A895,
+    0x98A996,
+    0x9AAB98,
+    0x9AAB98,
+    0x97A895,
+    0x95A693,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x94A592,
+    0x94A592,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x91A28F,
+    0x7A8B78,
+    0x021300,
+    0x000800,
+    0x011200,
+    0x000900,
+    0x000700,
+    0x001000,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000A00,
+    0x000E01,
+    0x000B00,
+    0x0E1E13,
+    0x93A29B,
+    0x99A5A1,
+    0x97A3A1,
+    0x97A3A1,
+    0x9AA6A4,
+    0x9BA7A3,
+    0x9BA7A3,
+    0x9DA8A4,
+    0xA0ABA7,
+    0x9FAAA4,
+    0x9EA9A3,
+    0x9EA9A1,
+    0x9DA8A0,
+    0x9EA89F,
+    0x9EA89F,
+    0x9FA9A0,
+    0x9EAAA0,
+    0x99A798,
+    0x99AA9A,
+    0x9CAD9D,
+    0x9EAF9F,
+    0xA0B1A1,
+    0xA2B3A3,
+    0xA4B5A5,
+    0xA6B7A7,
+    0xA6B7A7,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA7BAA7,
+    0xA7BAA7,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xA8B9A7,
+    0xA7B8A6,
+    0xA9B7A6,
+    0xA8B6A5,
+    0xA8B6A5,
+    0xA9B7A6,
+    0xA9B7A6,
+    0xAAB7A6,
+    0xA8B4A6,
+    0xADB8AA,
+    0xAEB9AB,
+    0xABB6A8,
+    0xA8B4A6,
+    0xA9B5A7,
+    0xA9B6A5,
+    0xA7B4A3,
+    0xA9B6A5,
+    0xAAB7A6,
+    0xA7B5A4,
+    0xA4B2A1,
+    0xA4B3A0,
+    0xA8B7A4,
+    0xA9B8A5,
+    0xA8B7A4,
+    0xA5B3A2,
+    0xA4B2A1,
+    0xA2B09F,
+    0xA0AE9D,
+    0xA0AE9D,
+    0xA1AF9E,
+    0xA2B09F,
+    0xA3B1A0,
+    0xA2B09F,
+    0xA0AE9D,
+    0x9FAD9C,
+    0x9EAC9B,
+    0x9FAD9C,
+    0x9EAC9B,
+    0x9BA998,
+    0x99A796,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x94A592,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x95A693,
+    0x94A592,
+    0x92A390,
+    0x92A390,
+    0x849582,
+    0x091A07,
+    0x000900,
+    0x001100,
+    0x000A00,
+    0x000700,
+    0x001000,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x001005,
+    0x19291E,
+    0x96A59E,
+    0x9BA7A5,
+    0x9AA6A6,
+    0x9BA7A7,
+    0x9FABAB,
+    0xA1ADA9,
+    0xA0ACA8,
+    0xA1ACA6,
+    0xA4AFA9,
+    0xA3AFA5,
+    0xA3AFA5,
+    0xA2AEA0,
+    0xA1AD9F,
+    0xA3AE9E,
+    0xA3AE9E,
+    0xA4AF9F,
+    0xA4B1A0,
+    0xA3B1A2,
+    0xA2B3A3,
+    0xA4B5A5,
+    0xA4B5A5,
+    0xA3B4A4,
+    0xA2B3A3,
+    0xA3B4A4,
+    0xA4B5A5,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xADBEAC,
+    0xACBDAB,
+    0xAAB8A7,
+    0xA7B5A4,
+    0xA3B1A0,
+    0xA0AE9D,
+    0x9EAC9B,
+    0x9EAB9A,
+    0x9AA597,
+    0xA2AA9D,
+    0xA6AEA1,
+    0xA5ADA0,
+    0xA5AD9E,
+    0xA6AE9F,
+    0xA3AE9E,
+    0xA1AC9C,
+    0xA2AD9D,
+    0xA3AE9E,
+    0xA2AD9C,
+    0xA2AD9C,
+    0xA3B09E,
+    0xA6B3A1,
+    0xA4B19F,
+    0xA0AD9B,
+    0x9FAD9C,
+    0x9EAC9B,
+    0x9DAB9A,
+    0x9CAA99,
+    0x9CAA99,
+    0x9DAB9A,
+    0x9EAC9B,
+    0x9EAC9B,
+    0x97A594,
+    0x9BA998,
+    0x9DAB9A,
+    0x9CAA99,
+    0x99A796,
+    0x98A695,
+    0x9AA897,
+    0x9CAA99,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x95A693,
+    0x95A693,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x8C9D8A,
+    0x142512,
+    0x000D00,
+    0x000F00,
+    0x000B00,
+    0x000800,
+    0x000D00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000B00,
+    0x000700,
+    0x000F00,
+    0x000E00,
+    0x000900,
+    0x041409,
+    0x213126,
+    0x97A69F,
+    0x8E9A9A,
+    0x8E999B,
+    0x909C9C,
+    0x95A1A1,
+    0x97A39F,
+    0x96A29E,
+    0x97A29A,
+    0x99A49C,
+    0x9CA89C,
+    0x9CA89C,
+    0x9CA998,
+    0x9DAA99,
+    0x9FAB97,
+    0xA1AD99,
+    0xA3AF99,
+    0xA4B19D,
+    0xA0AE9D,
+    0xA0B1A1,
+    0xA2B3A3,
+    0xA3B4A4,
+    0xA3B4A4,
+    0xA4B5A5,
+    0xA5B6A6,
+    0xA6B7A7,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xA8BBA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xA8B9A7,
+    0xAABBA9,
+    0xADBBAA,
+    0xADBBAA,
+    0xAAB8A7,
+    0xA6B4A3,
+    0xA2B09F,
+    0xA0AD9C,
+    0x9CA497,
+    0xA3A99D,
+    0xA7ADA1,
+    0xA6ACA0,
+    0xA4AA9C,
+    0xA2A89A,
+    0x9DA596,
+    0x99A192,
+    0x959D8E,
+    0x969E8F,
+    0x959E8D,
+    0x959E8D,
+    0x96A190,
+    0x96A190,
+    0x909B8A,
+    0x889382,
+    0x8D9B8A,
+    0x8F9D8C,
+    0x92A08F,
+    0x94A291,
+    0x94A291,
+    0x92A08F,
+    0x8F9D8C,
+    0x8C9A89,
+    0x82907F,
+    0x8B9988,
+    0x92A08F,
+    0x92A08F,
+    0x8C9A89,
+    0x8B9988,
+    0x92A08F,
+    0x99A796,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x95A693,
+    0x95A693,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x91A28F,
+    0x1C2D1A,
+    0x001100,
+    0x000F00,
+    0x000D00,
+    0x000900,
+    0x000C00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x001000,
+    0x000900,
+    0x001000,
+    0x000E00,
+    0x000A00,
+    0x35443D,
+    0x94A39C,
+    0x93A097,
+    0x95A299,
+    0x95A299,
+    0x95A29B,
+    0x95A19D,
+    0x96A29E,
+    0x96A09F,
+    0x959F9E,
+    0x98A39F,
+    0x97A29E,
+    0x95A09A,
+    0x949F99,
+    0x949E95,
+    0x949E95,
+    0x949F91,
+    0x94A092,
+    0x919F90,
+    0x94A595,
+    0x9BAC9C,
+    0x9FB0A0,
+    0xA1B2A0,
+    0xA2B3A1,
+    0xA4B5A3,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A5,
+    0xA8B9A6,
+    0xA9BAA7,
+    0xA9BAA7,
+    0xAABBA8,
+    0xAABBA8,
+    0xA6BCA5,
+    0xA6BCA5,
+    0xA7BDA6,
+    0xA7BDA6,
+    0xA9BCA8,
+    0xA9BCA8,
+    0xA9BCA8,
+    0xA8BBA7,
+    0xA8BBA7,
+    0xABBEAA,
+    0xAEBFAD,
+    0xAABBA9,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA8B6A5,
+    0xAAB8A7,
+    0xA6B3A2,
+    0xA5B2A1,
+    0xA8B5A4,
+    0xA9B6A5,
+    0xA8B5A4,
+    0xA7B4A3,
+    0xA9B6A5,
+    0xA8B5A4,
+    0xADBAA9,
+    0xA3B09F,
+    0xABB8A7,
+    0xA5B2A1,
+    0xA8B5A4,
+    0x9DAA99,
+    0xA6B3A2,
+    0x9DAE9B,
+    0x9EAF9C,
+    0x9FB09D,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x95A693,
+    0x95A693,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A892,
+    0x96A892,
+    0x96A892,
+    0x96A892,
+    0x95A791,
+    0x94A690,
+    0x93A58F,
+    0x92A48E,
+    0x849680,
+    0x3C4E38,
+    0x000B00,
+    0x011300,
+    0x000D00,
+    0x000800,
+    0x000F00,
+    0x000E00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000E00,
+    0x000800,
+    0x001000,
+    0x000E00,
+    0x000C01,
+    0x3C4B44,
+    0x96A5A0,
+    0x9CA9A0,
+    0x9DAAA1,
+    0x9EABA4,
+    0x9FACA5,
+    0xA1ADA9,
+    0xA2AEAA,
+    0xA4AFAB,
+    0xA4AFAB,
+    0xA4AFAB,
+    0xA3AEAA,
+    0xA3AEA8,
+    0xA3AEA8,
+    0xA5AFA6,
+    0xA6B0A7,
+    0xA6B0A5,
+    0xA6B2A6,
+    0xA0AE9F,
+    0xA1B2A2,
+    0xA5B6A6,
+    0xA5B6A6,
+    0xA4B5A3,
+    0xA2B3A1,
+    0xA2B3A1,
+    0xA3B4A2,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA8B9A6,
+    0xA8B9A6,
+    0xA9BAA7,
+    0xA9BAA7,
+    0xAABBA8,
+    0xAABBA8,
+    0xA7BDA6,
+    0xA7BDA6,
+    0xA7BDA6,
+    0xA7BDA6,
+    0xA9BCA8,
+    0xA9BCA8,
+    0xA8BBA7,
+    0xA8BBA7,
+    0xA7B8A5,
+    0xA7B8A5,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xADBEAC,
+    0xB3C1B0,
+    0xAAB8A7,
+    0xABB8A7,
+    0xABB8A7,
+    0xACB9A8,
+    0xADBAA9,
+    0xADBAA9,
+    0xADBAA9,
+    0xACB9A8,
+    0xA4B1A0,
+    0xA7B4A3,
+    0x9FAC9B,
+    0xA3B09F,
+    0xA4B1A0,
+    0xA6B3A2,
+    0xA2AF9E,
+    0xACB9A8,
+    0xA4B5A2,
+    0xA2B3A0,
+    0xA0B19E,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A892,
+    0x96A892,
+    0x96A892,
+    0x96A892,
+    0x95A791,
+    0x94A690,
+    0x93A58F,
+    0x92A48E,
+    0x899B85,
+    0x455741,
+    0x000D00,
+    0x011300,
+    0x000E00,
+    0x000800,
+    0x000E00,
+    0x000C00,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000800,
+    0x000F00,
+    0x000E00,
+    0x000F04,
+    0x485750,
+    0x97A6A1,
+    0x96A39A,
+    0x96A39A,
+    0x98A59E,
+    0x9AA7A0,
+    0x9BA7A3,
+    0x9CA8A4,
+    0x9DA8A4,
+    0x9EA9A5,
+    0x9FAAA4,
+    0xA0ABA5,
+    0xA1ACA4,
+    0xA2ADA5,
+    0xA3ADA4,
+    0xA4AEA5,
+    0xA4AEA3,
+    0xA3AFA3,
+    0x9EAC9D,
+    0x9FB0A0,
+    0xA3B4A4,
+    0xA4B5A5,
+    0xA3B4A4,
+    0xA2B3A3,
+    0xA4B5A3,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9BAA7,
+    0xA9BAA7,
+    0xAABBA8,
+    0xAABBA8,
+    0xA9BCA6,
+    0xA9BCA6,
+    0xAABDA7,
+    0xA9BCA6,
+    0xA9BCA8,
+    0xA8BBA7,
+    0xA8BBA7,
+    0xA7BAA6,
+    0xADBEAB,
+    0xA8B9A6,
+    0xA5B6A4,
+    0xA6B7A5,
+    0xA5B3A2,
+    0xA1AF9E,
+    0xA4B2A1,
+    0xAAB8A7,
+    0xA7B4A3,
+    0xAAB7A6,
+    0xA8B5A4,
+    0xA2AF9E,
+    0xA1AE9D,
+    0xA7B4A3,
+    0xAAB7A6,
+    0xA8B5A4,
+    0xACB9A8,
+    0xACB9A8,
+    0xABB8A7,
+    0xA7B4A3,
+    0xAEBBAA,
+    0xA5B2A1,
+    0xA4B1A0,
+    0xA8B5A4,
+    0xA0B19E,
+    0xA0B19E,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA1B29F,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x8FA08D,
+    0x536451,
+    0x000E00,
+    0x001100,
+    0x000D00,
+    0x000900,
+    0x000C00,
+    0x000A00,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000F00,
+    0x000E00,
+    0x001005,
+    0x55645D,
+    0x97A6A1,
+    0x8D9A93,
+    0x8C9992,
+    0x8D9A93,
+    0x8F9C95,
+    0x909D96,
+    0x8E9B94,
+    0x8F9A94,
+    0x919C96,
+    0x929D97,
+    0x929D97,
+    0x939E96,
+    0x949F97,
+    0x959F96,
+    0x949E95,
+    0x939D94,
+    0x919D93,
+    0x9AA89B,
+    0x9BAB9E,
+    0x9FB0A0,
+    0xA1B2A2,
+    0xA1B2A2,
+    0xA3B4A4,
+    0xA6B7A7,
+    0xAABBAB,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA8,
+    0xAABBA8,
+    0xAABDA7,
+    0xAABDA7,
+    0xAABDA7,
+    0xAABDA7,
+    0xA9BCA8,
+    0xA8BBA7,
+    0xA8B9A6,
+    0xA8B9A6,
+    0x8FA08D,
+    0x879885,
+    0x849281,
+    0x839180,
+    0x7E8C7B,
+    0x768473,
+    0x768473,
+    0x7C8A79,
+    0x8D9B8A,
+    0x909E8D,
+    0x8B9988,
+    0x7E8C7B,
+    0x7B8978,
+    0x859382,
+    0x8B9988,
+    0x8A9887,
+    0x707E6D,
+    0x748271,
+    0x808E7D,
+    0x808E7D,
+    0x93A190,
+    0x879584,
+    0x8A9887,
+    0x8B9988,
+    0x839481,
+    0x899A87,
+    0x92A390,
+    0x9BAC99,
+    0xA0B19E,
+    0xA0B19E,
+    0x9EAF9C,
+    0x9CAD9A,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x91A28F,
+    0x627360,
+    0x001000,
+    0x000F00,
+    0x000C00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000F00,
+    0x000B00,
+    0x000B00,
+    0x001000,
+    0x000D00,
+    0x011106,
+    0x62716A,
+    0x95A49F,
+    0x9EAAA6,
+    0x9CA8A4,
+    0x9CA8A4,
+    0xA0ACA8,
+    0xA1AEA7,
+    0x9EABA4,
+    0x9FAAA2,
+    0xA2ADA5,
+    0x9FAAA2,
+    0xA0ABA3,
+    0xA1ACA4,
+    0xA2ADA5,
+    0xA3ADA5,
+    0xA3ADA5,
+    0xA2ACA4,
+    0xA0ABA3,
+    0xA2B0A3,
+    0xA3B3A6,
+    0xA5B5A8,
+    0xA5B5A8,
+    0xA3B3A6,
+    0xA3B3A6,
+    0xA5B6A6,
+    0xA7B8A8,
+    0xA9BAAA,
+    0xA9BAAA,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABDA7,
+    0xAABDA7,
+    0xABBDA7,
+    0xABBDA7,
+    0xAABBA8,
+    0xA9BAA7,
+    0xA8B9A6,
+    0xA8B9A6,
+    0xB3C2AF,
+    0xADBCA9,
+    0xABB9A8,
+    0xAEBCAB,
+    0xADBBAA,
+    0xA8B6A5,
+    0xA9B6A5,
+    0xADBAA9,
+    0xA6B4A3,
+    0xAAB8A7,
+    0xA6B4A3,
+    0x9AA897,
+    0x98A695,
+    0xA0AE9D,
+    0xA3B1A0,
+    0x9FAD9C,
+    0x9BA998,
+    0x9BA998,
+    0xA0AE9D,
+    0x96A493,
+    0x9FAD9C,
+    0x8A9887,
+    0x869483,
+    0x839180,
+    0x839481,
+    0x899A87,
+    0x92A390,
+    0x9AAB98,
+    0x9FB09D,
+    0xA0B19E,
+    0x9EAF9C,
+    0x9CAD9A,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x96A794,
+    0x95A693,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x90A18E,
+    0x70816E,
+    0x011200,
+    0x000E00,
+    0x000B00,
+    0x000D00,
+    0x000B00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x001200,
+    0x000B00,
+    0x000D00,
+    0x001000,
+    0x000D00,
+    0x031308,
+    0x6E7D76,
+    0x94A39E,
+    0x9BA7A5,
+    0x98A4A2,
+    0x9AA6A2,
+    0xA0ACA8,
+    0xA2AFA8,
+    0x9FACA5,
+    0xA1ACA4,
+    0xA6B1A9,
+    0xA3AFA5,
+    0xA4B0A6,
+    0xA5B1A7,
+    0xA7B3A9,
+    0xA9B3AB,
+    0xABB5AD,
+    0xABB4AF,
+    0xABB6AE,
+    0xA1AEA4,
+    0xA2B2A5,
+    0xA5B5A8,
+    0xA5B5A8,
+    0xA4B4A7,
+    0xA3B3A6,
+    0xA5B5A8,
+    0xA7B7AA,
+    0xA9BAAA,
+    0xA9BAAA,
+    0xA9BAAA,
+    0xA9BAAA,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABCA6,
+    0xAABCA6,
+    0xABBDA7,
+    0xAABCA6,
+    0xAABBA8,
+    0xA9BAA7,
+    0xABBAA7,
+    0xAAB9A6,
+    0xAAB9A6,
+    0xA8B7A4,
+    0xA7B5A4,
+    0xA8B6A5,
+    0xABB8A7,
+    0xACB9A8,
+    0xACB9A8,
+    0xACB9A8,
+    0xA5B6A4,
+    0xA9BAA8,
+    0xAABBA9,
+    0xA7B8A6,
+    0xA9BAA8,
+    0xACBDAB,
+    0xA9BAA8,
+    0xA2B3A1,
+    0xA3B4A2,
+    0xA3B4A2,
+    0xA4B5A3,
+    0xA2B3A1,
+    0xABBCAA,
+    0xA4B5A3,
+    0xA5B6A4,
+    0xAABBA9,
+    0xA0B19E,
+    0xA0B19E,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA1B29F,
+    0x9FB09D,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x96A795,
+    0x96A795,
+    0x96A795,
+    0x96A795,
+    0x95A694,
+    0x94A593,
+    0x93A492,
+    0x92A391,
+    0x8E9F8D,
+    0x7E8F7D,
+    0x051604,
+    0x000E00,
+    0x000A00,
+    0x000D00,
+    0x000A00,
+    0x000C00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x011300,
+    0x000A00,
+    0x000D00,
+    0x001000,
+    0x000C00,
+    0x041409,
+    0x798881,
+    0x94A39E,
+    0x899593,
+    0x85918F,
+    0x87938F,
+    0x8E9A96,
+    0x909D94,
+    0x8D9A91,
+    0x8F9B91,
+    0x94A096,
+    0x929E94,
+    0x939F95,
+    0x939F95,
+    0x95A197,
+    0x97A199,
+    0x99A39B,
+    0x9BA49F,
+    0x9BA6A0,
+    0x98A59B,
+    0x9AAA9F,
+    0x9FAFA4,
+    0xA2B2A7,
+    0xA3B3A6,
+    0xA3B3A6,
+    0xA6B6A9,
+    0xA8B8AB,
+    0xAABBAB,
+    0xAABBAB,
+    0xAABBAB,
+    0xAABBAB,
+    0xAABBAB,
+    0xAABBAB,
+    0xA9BAAA,
+    0xA9BAA8,
+    0xAABBA8,
+    0xAABCA6,
+    0xAABCA6,
+    0xAABCA6,
+    0xACBBA8,
+    0xACBBA8,
+    0xABBAA7,
+    0xABBAA7,
+    0xA9B8A5,
+    0xAAB9A6,
+    0xA6B3A2,
+    0x9FAC9B,
+    0x9FAC9B,
+    0xA4B1A0,
+    0xA4B1A0,
+    0x9EAB9A,
+    0x98A997,
+    0x98A997,
+    0x9AAB99,
+    0xA0B19F,
+    0xA7B8A6,
+    0xAABBA9,
+    0xA7B8A6,
+    0xA2B3A1,
+    0xAABBA9,
+    0xACBDAB,
+    0xA3B4A2,
+    0xA4B5A3,
+    0xA3B4A2,
+    0xA3B4A2,
+    0x9EAF9D,
+    0xA6B7A5,
+    0xA6B7A4,
+    0xA4B5A2,
+    0xA2B3A0,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x96A795,
+    0x96A795,
+    0x96A795,
+    0x96A795,
+    0x95A694,
+    0x94A593,
+    0x93A492,
+    0x92A391,
+    0x8D9E8C,
+    0x8B9C8A,
+    0x0B1C0A,
+    0x001100,
+    0x000B00,
+    0x000D00,
+    0x000800,
+    0x000D00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x011300,
+    0x000900,
+    0x000D00,
+    0x001000,
+    0x000D00,
+    0x06160B,
+    0x7F8E87,
+    0x95A4A1,
+    0x9CA8A6,
+    0x98A4A4,
+    0x99A5A1,
+    0x9FABA7,
+    0xA0ADA4,
+    0x9BA89F,
+    0x9DA99F,
+    0xA2AEA4,
+    0x9DA99D,
+    0x9CA89C,
+    0x9CA89E,
+    0x9CA89E,
+    0x9DA79F,
+    0x9FA8A3,
+    0xA0A9A4,
+    0xA0ABA5,
+    0x98A59C,
+    0x9BABA0,
+    0xA0B0A5,
+    0xA3B3A8,
+    0xA3B3A6,
+    0xA3B3A6,
+    0xA4B4A7,
+    0xA6B6A9,
+    0xAABAAD,
+    0xAABAAD,
+    0xAABBAB,
+    0xAABBAB,
+    0xAABBAB,
+    0xAABBAB,
+    0xA9BAAA,
+    0xA9BAA8,
+    0xA9BAA7,
+    0xA9BBA5,
+    0xAABCA6,
+    0xAABCA6,
+    0xACBBA8,
+    0xACBBA8,
+    0xACBBA8,
+    0xABBAA7,
+    0xA8B7A4,
+    0xAAB9A6,
+    0xA4B1A0,
+    0x97A493,
+    0x96A392,
+    0x9EAB9A,
+    0x9EAB9A,
+    0x96A392,
+    0x94A593,
+    0x8D9E8C,
+    0x8D9E8C,
+    0x96A795,
+    0xA1B2A0,
+    0xA7B8A6,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA5B6A4,
+    0xAABBA9,
+    0xA1B2A0,
+    0xABBCAA,
+    0xA5B6A4,
+    0xAABBA9,
+    0x9FB09E,
+    0xA9BAA8,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA2B3A0,
+    0xA1B29F,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x96A795,
+    0x96A795,
+    0x96A795,
+    0x96A795,
+    0x95A694,
+    0x94A593,
+    0x93A492,
+    0x92A391,
+    0x8E9F8D,
+    0x93A492,
+    0x10210F,
+    0x031402,
+    0x000B00,
+    0x000D00,
+    0x000800,
+    0x000E00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000700,
+    0x000A00,
+    0x000C00,
+    0x000900,
+    0x000B00,
+    0x000E00,
+    0x000B00,
+    0x000800,
+    0x000600,
+    0x011104,
+    0x000F02,
+    0x000700,
+    0x000900,
+    0x000D00,
+    0x000C00,
+    0x000F00,
+    0x000E00,
+    0x000D00,
+    0x000E01,
+    0x000B00,
+    0x08180D,
+    0x8A9A90,
+    0x97A69F,
+    0x98A7A0,
+    0x9BAAA5,
+    0x9EADA8,
+    0x9FAEA9,
+    0x9FAEA9,
+    0x9EADA8,
+    0x9EADA6,
+    0x9EADA6,
+    0x9EADA6,
+    0xA0AFA8,
+    0xA1B0A9,
+    0xA0AFA8,
+    0xA1B1A7,
+    0xA4B4AA,
+    0xA5B5AB,
+    0xA3B3A9,
+    0xA3B3A6,
+    0xA4B4A7,
+    0xA4B4A7,
+    0xA4B4A7,
+    0xA3B3A6,
+    0xA4B4A7,
+    0xA6B7A7,
+    0xA8B9A9,
+    0xA8B9A9,
+    0xA9BAAA,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xADBBAA,
+    0xADBBAA,
+    0xAAB8A7,
+    0xAAB8A7,
+    0xA9B5A7,
+    0xADB9AB,
+    0xB4C0B2,
+    0xAEBAAC,
+    0xA7B3A5,
+    0xA9B7A8,
+    0xA5B8A5,
+    0xA3B8A5,
+    0xA5B8A5,
+    0xA5B8A5,
+    0xA5B8A5,
+    0xA5B8A5,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA6B7A5,
+    0xA8B9A7,
+    0xA9B7A6,
+    0xA6B4A3,
+    0xA5B3A2,
+    0xA7B5A4,
+    0xA7B4A3,
+    0xA4B1A0,
+    0xA1B2A0,
+    0x9FB09E,
+    0xA0B19F,
+    0xA2B3A1,
+    0xA2B3A1,
+    0x9FB09E,
+    0x9EAF9D,
+    0xA0B19F,
+    0xA1B2A0,
+    0xA0B19F,
+    0x9EAF9D,
+    0x9EAF9D,
+    0x9EAF9D,
+    0x9EAF9D,
+    0x9CAD9B,
+    0x9BAC9A,
+    0x9BAC9A,
+    0x9BAC9A,
+    0x9AAB99,
+    0x9AAB99,
+    0x99AA98,
+    0x99AA98,
+    0x98A997,
+    0x98A997,
+    0x96A795,
+    0x9AAB99,
+    0x9BAC9A,
+    0x98A997,
+    0x98A997,
+    0x9AAB99,
+    0x9AAB99,
+    0x97A895,
+    0x97A993,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x8D9D90,
+    0x8B9B8E,
+    0x2E3F2F,
+    0x000E00,
+    0x000F00,
+    0x000C00,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000900,
+    0x000C00,
+    0x001000,
+    0x000D00,
+    0x000700,
+    0x000700,
+    0x001100,
+    0x000800,
+    0x001000,
+    0x001000,
+    0x000A00,
+    0x000A00,
+    0x000E00,
+    0x000B00,
+    0x000700,
+    0x000700,
+    0x000F02,
+    0x000600,
+    0x000600,
+    0x001000,
+    0x000D00,
+    0x000A00,
+    0x031402,
+    0x000E00,
+    0x000E00,
+    0x000D00,
+    0x000E01,
+    0x000C00,
+    0x0F1F14,
+    0x8E9E94,
+    0x99A8A1,
+    0x8F9E97,
+    0x91A09B,
+    0x94A39E,
+    0x97A6A1,
+    0x99A8A3,
+    0x9CABA6,
+    0x9FAEA7,
+    0xA1B0A9,
+    0x9FAEA7,
+    0xA1B0A9,
+    0xA1B0A9,
+    0x9FAEA7,
+    0x9FAFA5,
+    0xA2B2A8,
+    0xA3B3A9,
+    0xA1B1A7,
+    0xA4B4A7,
+    0xA4B4A7,
+    0xA5B5A8,
+    0xA4B4A7,
+    0xA4B5A5,
+    0xA4B5A5,
+    0xA6B7A7,
+    0xA8B9A9,
+    0xA9BAAA,
+    0xA9BAAA,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xADBBAA,
+    0xADBBAA,
+    0xB2C0AF,
+    0xB2C0AF,
+    0xADB9AB,
+    0xAAB6A8,
+    0xACB8AA,
+    0xA8B4A6,
+    0xA8B4A6,
+    0xB1BFB0,
+    0xA7B8A6,
+    0xA4B7A4,
+    0xA3B6A3,
+    0xA4B7A4,
+    0xA6B9A6,
+    0xA7BAA7,
+    0xA6B7A5,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA6B7A5,
+    0xA8B6A5,
+    0xA6B4A3,
+    0xA7B5A4,
+    0xA9B7A6,
+    0xAAB7A6,
+    0xA8B5A4,
+    0xA7B8A6,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA7B8A6,
+    0xA5B6A4,
+    0xA2B3A1,
+    0xA0B19F,
+    0xA1B2A0,
+    0x9DAE9C,
+    0x9CAD9B,
+    0x9BAC9A,
+    0x9CAD9B,
+    0x9DAE9C,
+    0x9DAE9C,
+    0x9CAD9B,
+    0x9BAC9A,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x9BAC9A,
+    0x98A997,
+    0x9BAC9A,
+    0x9BAC9A,
+    0x98A997,
+    0x98A997,
+    0x9AAB99,
+    0x9AAB99,
+    0x97A895,
+    0x97A993,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x8F9F92,
+    0x8B9B8E,
+    0x364737,
+    0x000F00,
+    0x000F00,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000F00,
+    0x000700,
+    0x000700,
+    0x000F00,
+    0x021300,
+    0x081906,
+    0x21321F,
+    0x40513E,
+    0x001100,
+    0x132411,
+    0x10210E,
+    0x031401,
+    0x0A1B08,
+    0x0F200D,
+    0x061704,
+    0x011200,
+    0x102111,
+    0x203023,
+    0x091A0A,
+    0x000D00,
+    0x000E00,
+    0x001100,
+    0x041503,
+    0x000700,
+    0x000D00,
+    0x000D00,
+    0x000D00,
+    0x000F02,
+    0x000E01,
+    0x19291E,
+    0x91A197,
+    0x9AA9A2,
+    0x8A9992,
+    0x8B9A95,
+    0x8C9B96,
+    0x8C9B96,
+    0x8C9B96,
+    0x8E9D98,
+    0x909F98,
+    0x93A29B,
+    0x86958E,
+    0x899891,
+    0x8C9B94,
+    0x8E9D96,
+    0x93A399,
+    0x9CACA2,
+    0xA1B1A7,
+    0xA1B1A7,
+    0xA4B4A7,
+    0xA5B5A8,
+    0xA5B6A6,
+    0xA5B6A6,
+    0xA4B5A5,
+    0xA5B6A6,
+    0xA7B8A8,
+    0xA8B9A9,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xADBBAA,
+    0xADBBAA,
+    0xA2B09F,
+    0xA4B2A1,
+    0x9DA99B,
+    0x94A092,
+    0x919D8F,
+    0x8C988A,
+    0x8F9B8D,
+    0x9BA99A,
+    0x97A896,
+    0x93A693,
+    0x92A391,
+    0x93A492,
+    0x97A896,
+    0x98A997,
+    0x95A694,
+    0x92A391,
+    0x98A695,
+    0x9AA897,
+    0x9AA897,
+    0x97A594,
+    0x98A695,
+    0x9AA897,
+    0x9BA998,
+    0x99A796,
+    0x97A896,
+    0x96A795,
+    0x98A997,
+    0x9CAD9B,
+    0x9DAE9C,
+    0x9CAD9B,
+    0x9CAD9B,
+    0x9EAF9D,
+    0xA1B2A0,
+    0xA0B19F,
+    0x9EAF9D,
+    0x9EAF9D,
+    0x9FB09E,
+    0x9FB09E,
+    0x9EAF9D,
+    0x9DAE9C,
+    0x9BAC9A,
+    0x9BAC9A,
+    0x9BAC9A,
+    0x9BAC9A,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x9AAB99,
+    0x98A997,
+    0x9AAB99,
+    0x99AA98,
+    0x97A896,
+    0x97A896,
+    0x99AA98,
+    0x9AAB99,
+    0x99AA97,
+    0x97A993,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x91A194,
+    0x8B9B8E,
+    0x445545,
+    0x001000,
+    0x000F00,
+    0x000C00,
+    0x000C00,
+    0x000D00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000800,
+    0x000B00,
+    0x000D00,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000D00,
+    0x000A00,
+    0x0D1E0B,
+    0x061704,
+    0x000D00,
+    0x091A07,
+    0x0B1C09,
+    0x011200,
+    0x051604,
+    0x000900,
+    0x061707,
+    0x051604,
+    0x051604,
+    0x000A00,
+    0x1B2C19,
+    0x425340,
+    0x061704,
+    0x000D00,
+    0x000D00,
+    0x000C00,
+    0x000E01,
+    0x000E01,
+    0x233328,
+    0x92A298,
+    0x99A8A1,
+    0xA0AFA8,
+    0xA0AFAA,
+    0xA1B0AB,
+    0xA0AFAA,
+    0x9EADA8,
+    0x9EADA8,
+    0x9FAEA7,
+    0xA0AFA8,
+    0xA3B2AB,
+    0xA4B3AC,
+    0xA2B1AA,
+    0x9FAEA7,
+    0xA0B0A6,
+    0xA4B4AA,
+    0xA6B6AC,
+    0xA6B6AB,
+    0xA4B4A7,
+    0xA5B6A6,
+    0xA6B7A7,
+    0xA5B6A6,
+    0xA4B5A5,
+    0xA5B6A6,
+    0xA7B8A6,
+    0xA9BAA8,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA8,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xADBBAA,
+    0xADBBAA,
+    0xAEBCAB,
+    0xB3C1B0,
+    0xB1BDAF,
+    0xABB7A9,
+    0xA9B5A7,
+    0xA4B0A2,
+    0xA4B0A2,
+    0xADB9AB,
+    0xA6B7A5,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA8B6A5,
+    0xA8B6A5,
+    0xA6B4A3,
+    0xA4B2A1,
+    0xA0AE9D,
+    0xA2B09F,
+    0xA1AF9E,
+    0x9DAB9A,
+    0x9CAA99,
+    0x9EAC9B,
+    0x9EAC9B,
+    0x9CAA99,
+    0x9AAB99,
+    0x99AA98,
+    0x9BAC9A,
+    0xA0B19F,
+    0xA2B3A1,
+    0xA2B3A1,
+    0xA2B3A1,
+    0xA5B6A4,
+    0xA0B19F,
+    0x9FB09E,
+    0x9DAE9C,
+    0x9CAD9B,
+    0x9CAD9B,
+    0x9BAC9A,
+    0x9AAB99,
+    0x98A997,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x97A895,
+    0x99AA97,
+    0x9AAB98,
+    0x99AA97,
+    0x97A991,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x92A295,
+    0x8A9A8D,
+    0x556656,
+    0x001101,
+    0x000E00,
+    0x000A00,
+    0x000C00,
+    0x000D00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000700,
+    0x000700,
+    0x000C00,
+    0x000D00,
+    0x000D00,
+    0x000D00,
+    0x000E00,
+    0x000C00,
+    0x000700,
+    0x000F00,
+    0x000700,
+    0x000700,
+    0x021300,
+    0x000E00,
+    0x000700,
+    0x041502,
+    0x122311,
+    0x182917,
+    0x162714,
+    0x182916,
+    0x001100,
+    0x10210E,
+    0x324330,
+    0x000E00,
+    0x000D00,
+    0x000D00,
+    0x000C00,
+    0x000D00,
+    0x000D00,
+    0x2E3E33,
+    0x93A399,
+    0x95A49D,
+    0x93A29B,
+    0x96A5A0,
+    0x9AA9A4,
+    0x9DACA7,
+    0x9EADA8,
+    0x9FAEA9,
+    0xA1B0A9,
+    0xA2B1AA,
+    0xA4B3AC,
+    0xA5B4AD,
+    0xA4B3AC,
+    0xA1B0A9,
+    0xA2B2A8,
+    0xA6B6AC,
+    0xA8B8AE,
+    0xA7B7AC,
+    0xA5B5A8,
+    0xA6B7A7,
+    0xA6B7A7,
+    0xA6B7A7,
+    0xA5B6A4,
+    0xA6B7A5,
+    0xA8B9A7,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA9,
+    0xAABBA8,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xADBBAA,
+    0xADBBAA,
+    0xA8B6A5,
+    0xADBBAA,
+    0xABB7A9,
+    0xA9B5A7,
+    0xADB9AB,
+    0xADB9AB,
+    0xAAB6A8,
+    0xAEBAAC,
+    0xAAB7A6,
+    0xACB9A8,
+    0xAEBBAA,
+    0xAEBBAA,
+    0xABB9A8,
+    0xA9B7A6,
+    0xA9B7A6,
+    0xAAB8A7,
+    0xA8B6A5,
+    0xA9B7A6,
+    0xA8B6A5,
+    0xA4B2A1,
+    0xA3B1A0,
+    0xA5B3A2,
+    0xA6B4A3,
+    0xA4B2A1,
+    0xA2B3A1,
+    0xA0B19F,
+    0xA0B19F,
+    0xA2B3A1,
+    0xA2B3A1,
+    0x9EAF9D,
+    0x9DAE9C,
+    0x9EAF9D,
+    0xA3B4A2,
+    0xA2B3A1,
+    0xA1B2A0,
+    0xA0B19F,
+    0xA1B2A0,
+    0xA0B19F,
+    0x9FB09E,
+    0x9EAF9D,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x9CAD9A,
+    0x9AAB98,
+    0x98A996,
+    0x98A996,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x97A991,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x91A194,
+    0x87978A,
+    0x677868,
+    0x011202,
+    0x000D00,
+    0x000900,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000C00,
+    0x000E00,
+    0x000800,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000A00,
+    0x000700,
+    0x000B00,
+    0x000C00,
+    0x000700,
+    0x000800,
+    0x001000,
+    0x000900,
+    0x000700,
+    0x031401,
+    0x000700,
+    0x000C00,
+    0x000800,
+    0x000D00,
+    0x001000,
+    0x000800,
+    0x000B00,
+    0x000D00,
+    0x000D00,
+    0x000C00,
+    0x000C00,
+    0x000D00,
+    0x000E01,
+    0x39493F,
+    0x94A49A,
+    0x93A29B,
+    0x81908B,
+    0x84938E,
+    0x899893,
+    0x8D9C97,
+    0x8F9E99,
+    0x909F9A,
+    0x91A099,
+    0x92A19A,
+    0x899891,
+    0x8D9C95,
+    0x8F9E97,
+    0x91A099,
+    0x97A79D,
+    0x9FAFA5,
+    0xA4B4AA,
+    0xA5B5AA,
+    0xA5B6A6,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA6B7A5,
+    0xA5B6A4,
+    0xA6B7A5,
+    0xA8B9A7,
+    0xAABBA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xACBDAA,
+    0xACBEA8,
+    0xACBEA8,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xAEBCAB,
+    0xAEBCAB,
+    0xABB9A8,
+    0xACBAA9,
+    0xA4B0A2,
+    0x9EAA9C,
+    0xA3AFA1,
+    0xA3AFA1,
+    0x9FAB9D,
+    0x9FAB9D,
+    0xA5B0A0,
+    0xAAB5A5,
+    0xACB9A8,
+    0xABB8A7,
+    0xA7B4A3,
+    0xA4B1A0,
+    0xA5B2A1,
+    0xA7B4A3,
+    0xA9B7A6,
+    0xABB9A8,
+    0xAAB8A7,
+    0xA7B5A4,
+    0xA7B5A4,
+    0xAAB8A7,
+    0xACBAA9,
+    0xABB9A8,
+    0xA5B6A4,
+    0xA3B4A2,
+    0xA3B4A2,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA1B2A0,
+    0xA0B19F,
+    0xA1B2A0,
+    0x9DAE9C,
+    0x9CAD9B,
+    0x9BAC9A,
+    0x9CAD9B,
+    0x9DAE9C,
+    0x9EAF9D,
+    0x9DAE9C,
+    0x9CAD9B,
+    0x98A996,
+    0x98A996,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9EAF9C,
+    0x9AAB98,
+    0x98A996,
+    0x9BAC99,
+    0x9CAD9A,
+    0x9AAB98,
+    0x97A895,
+    0x96A794,
+    0x97A991,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x91A194,
+    0x859588,
+    0x798A7A,
+    0x041505,
+    0x000E00,
+    0x000800,
+    0x000C00,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000700,
+    0x000800,
+    0x000B00,
+    0x000D00,
+    0x000E00,
+    0x000D00,
+    0x000800,
+    0x000700,
+    0x000800,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000E00,
+    0x000800,
+    0x000E00,
+    0x061800,
+    0x000B00,
+    0x000800,
+    0x061802,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000D00,
+    0x000F02,
+    0x435349,
+    0x97A79D,
+    0x94A39C,
+    0x98A7A2,
+    0x9AA9A4,
+    0x9CABA6,
+    0x9DACA7,
+    0x9DACA7,
+    0x9DACA7,
+    0x9EADA6,
+    0x9FAEA7,
+    0xA1B0A9,
+    0xA4B3AC,
+    0xA4B3AC,
+    0xA2B1AA,
+    0xA2B2A8,
+    0xA5B5AB,
+    0xA6B6AC,
+    0xA4B4A9,
+    0xA6B7A7,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA9BAA7,
+    0xAABBA8,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xACBDAA,
+    0xACBEA8,
+    0xACBEA8,
+    0xACBEA8,
+    0xACBEA8,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xAEBCAB,
+    0xAEBCAB,
+    0xA9B7A6,
+    0xA9B7A6,
+    0x9FAB9D,
+    0x97A395,
+    0x9AA698,
+    0x9AA698,
+    0x95A193,
+    0x94A092,
+    0x97A292,
+    0x9AA595,
+    0x9DA898,
+    0x9CA797,
+    0x9AA595,
+    0x97A292,
+    0x95A291,
+    0x96A392,
+    0x93A08F,
+    0x94A190,
+    0x92A08F,
+    0x8F9D8C,
+    0x8F9D8C,
+    0x92A08F,
+    0x92A391,
+    0x91A290,
+    0x8B9C8A,
+    0x8A9B89,
+    0x8B9C8A,
+    0x8E9F8D,
+    0x8FA08E,
+    0x8D9E8C,
+    0x8C9D8B,
+    0x8E9F8D,
+    0x90A18F,
+    0x8FA08E,
+    0x8E9F8D,
+    0x8E9F8D,
+    0x8E9F8D,
+    0x8E9F8D,
+    0x8D9E8C,
+    0x8B9C8A,
+    0x95A791,
+    0x95A791,
+    0x94A690,
+    0x94A690,
+    0x94A690,
+    0x93A58F,
+    0x93A58F,
+    0x93A58F,
+    0x95A791,
+    0x91A38D,
+    0x92A48E,
+    0x98AA94,
+    0x9CAE98,
+    0x9AAC96,
+    0x97A993,
+    0x97A993,
+    0x97A991,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x91A194,
+    0x849487,
+    0x879888,
+    0x071808,
+    0x000F00,
+    0x000900,
+    0x000C00,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000D00,
+    0x000800,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000700,
+    0x000700,
+    0x000D00,
+    0x000800,
+    0x000A00,
+    0x000D00,
+    0x000B00,
+    0x000800,
+    0x000D00,
+    0x001000,
+    0x000700,
+    0x000A00,
+    0x000800,
+    0x000F00,
+    0x000900,
+    0x000800,
+    0x000D00,
+    0x000E00,
+    0x000800,
+    0x000C00,
+    0x000B00,
+    0x000C00,
+    0x000E01,
+    0x001005,
+    0x49594F,
+    0x9BAAA3,
+    0x97A69F,
+    0x9BAAA5,
+    0x9CABA6,
+    0x9DACA7,
+    0x9DACA7,
+    0x9DACA7,
+    0x9FAEA9,
+    0xA1B0A9,
+    0xA4B3AC,
+    0x9FAEA7,
+    0xA2B1AA,
+    0xA3B2AB,
+    0xA2B1AA,
+    0xA3B3A9,
+    0xA6B6AC,
+    0xA6B6AC,
+    0xA4B4A9,
+    0xA6B7A7,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA7B8A6,
+    0xA6B7A5,
+    0xA7B8A6,
+    0xA9BAA7,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBCA9,
+    0xABBDA7,
+    0xACBEA8,
+    0xACBEA8,
+    0xACBEA8,
+    0xACBEA8,
+    0xADBFA9,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xAEBCAB,
+    0xAEBCAB,
+    0xACBAA9,
+    0xB1BFAE,
+    0xADB9AB,
+    0xA9B5A7,
+    0xAEBAAC,
+    0xB0BCAE,
+    0xACB8AA,
+    0xACB7A9,
+    0xAEB9A9,
+    0xB1B9AA,
+    0xB0BBAB,
+    0xB1BCAC,
+    0xB1BCAC,
+    0xAFBAAA,
+    0xABB8A7,
+    0xAAB7A6,
+    0xADBAA9,
+    0xAEBBAA,
+    0xAAB8A7,
+    0xA6B4A3,
+    0xA5B3A2,
+    0xA8B6A5,
+    0xA7B8A6,
+    0xA6B7A5,
+    0xA4B5A3,
+    0xA2B3A1,
+    0xA2B3A1,
+    0xA3B4A2,
+    0xA2B3A1,
+    0x9EAF9D,
+    0x9CAD9B,
+    0x9DAE9C,
+    0x9EAF9D,
+    0x9CAD9B,
+    0x99AA98,
+    0x97A896,
+    0x96A795,
+    0x94A593,
+    0x91A290,
+    0x8FA08E,
+    0x94A690,
+    0x93A58F,
+    0x91A38D,
+    0x8FA18B,
+    0x8D9F89,
+    0x8B9D87,
+    0x899B85,
+    0x889A84,
+    0x889A84,
+    0x859781,
+    0x899B85,
+    0x93A58F,
+    0x9AAC96,
+    0x9AAC96,
+    0x99AB95,
+    0x99AB95,
+    0x97A991,
+    0x97A993,
+    0x97A993,
+    0x97A895,
+    0x96A795,
+    0x94A593,
+    0x93A494,
+    0x92A393,
+    0x91A194,
+    0x849487,
+    0x90A191,
+    0x0A1B0B,
+    0x001100,
+    0x000A00,
+    0x000D00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000C00,
+    0x000800,
+    0x000800,
+    0x000700,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000D00,
+    0x000D00,
+    0x000800,
+    0x000D00,
+    0x000F00,
+    0x07170A,
+    0x5B6B61,
+    0x94A3A0,
+    0x8A9898,
+    0x909F9A,
+    0x92A19C,
+    0x96A5A0,
+    0x98A7A2,
+    0x99A8A3,
+    0x99A8A3,
+    0x9AA9A2,
+    0x9BAAA3,
+    0x9FAEA7,
+    0xA0AFA8,
+    0xA0AFA8,
+    0xA1B0A9,
+    0xA2B2A8,
+    0xA3B3A9,
+    0xA4B4AA,
+    0xA4B3AC,
+    0xA5B4AD,
+    0xA6B5B0,
+    0xA6B5AE,
+    0xA6B6AC,
+    0xA6B6AB,
+    0xA7B7AA,
+    0xA9BAA8,
+    0xABBCAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAB,
+    0xACBDAB,
+    0xAABDA7,
+    0xABBEA8,
+    0xABBEAA,
+    0xABBEAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAB,
+    0xACBDAB,
+    0xAFC0AE,
+    0xACBDAB,
+    0xA6B4A5,
+    0x9BA99A,
+    0x97A596,
+    0x9AA899,
+    0x9CAA9D,
+    0x9BA99C,
+    0x97A493,
+    0xA3B09F,
+    0xA8B5A4,
+    0xA1AE9D,
+    0x9FAC9B,
+    0xA6B3A2,
+    0xA7B4A3,
+    0xA1AE9D,
+    0xA3B09F,
+    0xA0AD9C,
+    0x9EAB9A,
+    0xA0AD9C,
+    0xA5B2A1,
+    0xA9B6A5,
+    0xAAB7A6,
+    0xA9B6A5,
+    0xA3AFA1,
+    0xA0AC9E,
+    0xA1AD9F,
+    0xA5B1A3,
+    0xA7B3A5,
+    0xA3AFA1,
+    0xA1AE9D,
+    0xA2AF9E,
+    0xA2AF9E,
+    0xA2AF9E,
+    0xA2AF9D,
+    0xA2AF9D,
+    0xA2AF9D,
+    0xA1AE9C,
+    0xA1AE9C,
+    0xA0AD9B,
+    0x98A996,
+    0x9BAC99,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x99AA97,
+    0x99AA97,
+    0x9CAD9A,
+    0x9FB09D,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x8FA08D,
+    0x8C9D8A,
+    0x869785,
+    0x243523,
+    0x000B00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000F00,
+    0x011200,
+    0x000E00,
+    0x000B00,
+    0x000900,
+    0x001200,
+    0x000D00,
+    0x000D00,
+    0x000E00,
+    0x021205,
+    0x637369,
+    0x98A7A4,
+    0x909E9E,
+    0x8B9A95,
+    0x8D9C97,
+    0x909F9A,
+    0x91A09B,
+    0x91A09B,
+    0x909F9A,
+    0x909F98,
+    0x91A099,
+    0x8A9992,
+    0x8C9B94,
+    0x909F98,
+    0x95A49D,
+    0x9BABA1,
+    0xA0B0A6,
+    0xA4B4AA,
+    0xA6B5AE,
+    0xA5B4AD,
+    0xA6B5B0,
+    0xA6B5AE,
+    0xA6B6AC,
+    0xA6B6AB,
+    0xA7B7AA,
+    0xA9BAA8,
+    0xABBCAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAB,
+    0xACBDAB,
+    0xAABDA9,
+    0xAABDA9,
+    0xABBEAA,
+    0xABBEAA,
+    0xADBEAB,
+    0xACBDAA,
+    0xACBDAB,
+    0xACBDAB,
+    0xA5B6A4,
+    0xA6B7A5,
+    0xA6B4A5,
+    0xA2B0A1,
+    0xA1AFA0,
+    0xA4B2A3,
+    0xA5B3A4,
+    0xA3B1A2,
+    0xA0AD9C,
+    0xA6B3A2,
+    0xA5B2A1,
+    0x9DAA99,
+    0x99A695,
+    0x9DAA99,
+    0xA0AD9C,
+    0x9EAB9A,
+    0xA0AD9C,
+    0x9BA897,
+    0x97A493,
+    0x96A392,
+    0x97A493,
+    0x97A493,
+    0x95A291,
+    0x929F8E,
+    0x95A193,
+    0x929E90,
+    0x919D8F,
+    0x94A092,
+    0x939F91,
+    0x8F9B8D,
+    0x8C9988,
+    0x8C9988,
+    0x8D9A89,
+    0x8D9A89,
+    0x8E9B89,
+    0x8E9B89,
+    0x8D9A88,
+    0x8D9A88,
+    0x8C9987,
+    0x8C9987,
+    0x889986,
+    0x8B9C89,
+    0x8D9E8B,
+    0x8D9E8B,
+    0x8C9D8A,
+    0x8C9D8A,
+    0x8FA08D,
+    0x93A491,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x8E9F8C,
+    0x8C9D8A,
+    0x879886,
+    0x2E3F2D,
+    0x000F00,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000C00,
+    0x001100,
+    0x021301,
+    0x000F00,
+    0x000A00,
+    0x000900,
+    0x000B00,
+    0x000E00,
+    0x000800,
+    0x000F00,
+    0x000F02,
+    0x74847A,
+    0x9CABA8,
+    0x97A5A5,
+    0x9BAAA5,
+    0x9DACA7,
+    0xA0AFAA,
+    0xA1B0AB,
+    0xA0AFAA,
+    0xA0AFAA,
+    0xA1B0A9,
+    0xA1B0A9,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA6B5AE,
+    0xA6B5AE,
+    0xA5B5AB,
+    0xA4B4AA,
+    0xA3B3A9,
+    0xA3B2AB,
+    0xA5B4AD,
+    0xA6B5B0,
+    0xA7B6AF,
+    0xA6B5AE,
+    0xA6B6AB,
+    0xA7B7AC,
+    0xA9BAAA,
+    0xABBCAC,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAB,
+    0xACBDAB,
+    0xAABDA9,
+    0xAABDA9,
+    0xABBEAA,
+    0xABBEAA,
+    0xADBEAB,
+    0xADBEAB,
+    0xADBEAC,
+    0xACBDAB,
+    0xB1C2B0,
+    0xB2C3B1,
+    0xB2C0B1,
+    0xADBBAC,
+    0xABB9AA,
+    0xACBAAB,
+    0xACBAAB,
+    0xAAB8A9,
+    0xADBAA9,
+    0xAEBBAA,
+    0xAEBBAA,
+    0xACB9A8,
+    0xA9B6A5,
+    0xA9B6A5,
+    0xABB8A7,
+    0xAFBCAB,
+    0xABB8A7,
+    0xA8B5A4,
+    0xA6B3A2,
+    0xA6B3A2,
+    0xA8B5A4,
+    0xAAB7A6,
+    0xAAB7A6,
+    0xA8B5A4,
+    0xABB7A9,
+    0xA8B4A6,
+    0xA7B3A5,
+    0xA8B4A6,
+    0xA7B3A5,
+    0xA4B0A2,
+    0xA0AD9C,
+    0xA0AD9C,
+    0xA1AE9D,
+    0xA2AF9E,
+    0xA2AF9D,
+    0xA2AF9D,
+    0xA2AF9D,
+    0xA1AE9C,
+    0xA0AD9B,
+    0xA0AD9B,
+    0x94A592,
+    0x96A794,
+    0x97A895,
+    0x97A895,
+    0x96A794,
+    0x96A794,
+    0x98A996,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x8E9F8C,
+    0x8C9D8A,
+    0x899A88,
+    0x3D4E3C,
+    0x011200,
+    0x000E00,
+    0x000C00,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000B00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000800,
+    0x001000,
+    0x000700,
+    0x011200,
+    0x001003,
+    0x819187,
+    0x97A6A3,
+    0x919F9F,
+    0x94A39E,
+    0x96A5A0,
+    0x99A8A3,
+    0x9BAAA5,
+    0x9CABA6,
+    0x9DACA7,
+    0x9FAEA7,
+    0xA1B0A9,
+    0xA2B1AA,
+    0xA2B1AA,
+    0xA2B1AA,
+    0xA3B2AB,
+    0xA4B4AA,
+    0xA5B5AB,
+    0xA5B5AB,
+    0xA6B5AE,
+    0xA5B4AD,
+    0xA6B5B0,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA6B6AC,
+    0xA7B7AD,
+    0xA9B9AC,
+    0xABBBAE,
+    0xACBDAD,
+    0xACBDAD,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAA,
+    0xACBDAA,
+    0xA9BCA9,
+    0xAABDAA,
+    0xABBEAB,
+    0xABBEAB,
+    0xADBEAC,
+    0xADBEAC,
+    0xADBEAC,
+    0xADBEAC,
+    0xA8B9A7,
+    0xA4B5A3,
+    0xA0AE9D,
+    0x99A796,
+    0x95A392,
+    0x95A392,
+    0x96A493,
+    0x97A594,
+    0x98A695,
+    0x97A594,
+    0x9AA897,
+    0xA0AE9D,
+    0x9EAC9B,
+    0x98A695,
+    0x96A493,
+    0x9AA897,
+    0x98A695,
+    0x97A594,
+    0x98A695,
+    0x9CAA99,
+    0xA1AF9E,
+    0xA5B3A2,
+    0xA7B5A4,
+    0xA7B5A4,
+    0xA5B3A4,
+    0xA3B1A2,
+    0xA3B1A2,
+    0xA4B2A3,
+    0xA5B3A4,
+    0xA4B2A3,
+    0xA2B09F,
+    0xA1AF9E,
+    0xA0AE9D,
+    0xA0AE9D,
+    0xA0AF9C,
+    0xA0AF9C,
+    0xA0AF9C,
+    0x9FAE9B,
+    0x9FAE9B,
+    0x9EAD9A,
+    0x9DAE9B,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9AAB98,
+    0x99AA97,
+    0x9AAB98,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x8FA08D,
+    0x8C9D8A,
+    0x889987,
+    0x4D5E4C,
+    0x011200,
+    0x000D00,
+    0x000D00,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000C00,
+    0x000800,
+    0x000800,
+    0x000700,
+    0x000700,
+    0x000700,
+    0x000900,
+    0x000E00,
+    0x000A00,
+    0x041600,
+    0x000A00,
+    0x021301,
+    0x021205,
+    0x87978D,
+    0x8E9D9A,
+    0x8B9999,
+    0x879691,
+    0x899893,
+    0x8B9A95,
+    0x8D9C97,
+    0x8E9D98,
+    0x909F9A,
+    0x92A19A,
+    0x94A39C,
+    0x92A19A,
+    0x93A29B,
+    0x95A49D,
+    0x97A69F,
+    0x99A99F,
+    0x9CACA2,
+    0x9EAEA4,
+    0x9EAEA4,
+    0xA6B5AE,
+    0xA6B5AE,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA6B6AC,
+    0xA7B7AD,
+    0xAABAAF,
+    0xACBCB1,
+    0xACBCAF,
+    0xACBCAF,
+    0xACBDAD,
+    0xACBDAD,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAA,
+    0xACBDAA,
+    0xAABDAA,
+    0xAABDAA,
+    0xABBEAB,
+    0xABBEAB,
+    0xADBEAC,
+    0xADBEAC,
+    0xACBDAB,
+    0xACBDAB,
+    0xB3C4B2,
+    0xB0C1AF,
+    0xAEBCAB,
+    0xABB9A8,
+    0xA9B7A6,
+    0xA9B7A6,
+    0xABB9A8,
+    0xADBBAA,
+    0xAAB8A7,
+    0xA6B4A3,
+    0xA8B6A5,
+    0xAEBCAB,
+    0xABB9A8,
+    0xA1AF9E,
+    0x9DAB9A,
+    0xA1AF9E,
+    0xA3B1A0,
+    0xA3B1A0,
+    0xA3B1A0,
+    0xA5B3A2,
+    0xA7B5A4,
+    0xA8B6A5,
+    0xA9B7A6,
+    0xA9B7A6,
+    0xA7B5A6,
+    0xA7B5A6,
+    0xA7B5A6,
+    0xA7B5A6,
+    0xA9B7A8,
+    0xAAB8A9,
+    0xA9B7A6,
+    0xA7B5A4,
+    0xA4B2A1,
+    0xA4B2A1,
+    0xA4B3A0,
+    0xA4B3A0,
+    0xA4B3A0,
+    0xA4B3A0,
+    0xA3B29F,
+    0xA3B29F,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x99AA97,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x91A28F,
+    0x8B9C89,
+    0x869785,
+    0x5D6E5C,
+    0x001100,
+    0x000B00,
+    0x000F00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000A00,
+    0x000900,
+    0x000A00,
+    0x000B00,
+    0x000A00,
+    0x000800,
+    0x000900,
+    0x000C00,
+    0x000C00,
+    0x011300,
+    0x000800,
+    0x001000,
+    0x08180B,
+    0x8E9E94,
+    0x93A29F,
+    0x95A3A3,
+    0x94A39E,
+    0x96A5A0,
+    0x97A6A1,
+    0x98A7A2,
+    0x98A7A2,
+    0x99A8A3,
+    0x9BAAA3,
+    0x9DACA5,
+    0xA2B1AA,
+    0xA1B0A9,
+    0xA0AFA8,
+    0x9FAEA7,
+    0x9DADA3,
+    0x9CACA2,
+    0x9AAAA0,
+    0x9AAAA0,
+    0xA6B5AE,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA8B7B0,
+    0xAAB9B2,
+    0xACBBB4,
+    0xACBCB1,
+    0xACBCB1,
+    0xACBCAF,
+    0xACBCAF,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAA,
+    0xACBDAB,
+    0xABBEAB,
+    0xABBDAD,
+    0xABBDAD,
+    0xACBEAE,
+    0xACBDAD,
+    0xACBDAD,
+    0xACBDAB,
+    0xABBCAA,
+    0xADBEAC,
+    0xABBCAA,
+    0xAEBDAA,
+    0xB1C0AD,
+    0xB0BFAC,
+    0xADBCA9,
+    0xACBBA8,
+    0xADBCA9,
+    0xADBEAC,
+    0xA8B9A7,
+    0xA7B8A6,
+    0xAABBA9,
+    0xA9BAA8,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA9BAA8,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA3B4A2,
+    0xA3B4A2,
+    0xA2B3A1,
+    0xA1B2A0,
+    0xA2B3A3,
+    0xA2B3A3,
+    0xA1B2A2,
+    0x9FB0A0,
+    0xA0B1A1,
+    0xA2B3A3,
+    0xA1B2A0,
+    0x9EAF9D,
+    0x9CAD9B,
+    0x9CAD9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x8B9C89,
+    0x859684,
+    0x6D7E6C,
+    0x001100,
+    0x000B00,
+    0x001000,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000D00,
+    0x000B00,
+    0x000800,
+    0x000800,
+    0x000B00,
+    0x000A00,
+    0x000C00,
+    0x000800,
+    0x000F00,
+    0x132316,
+    0x94A49A,
+    0x96A5A2,
+    0x9AA8A8,
+    0x9AA9A4,
+    0x9BAAA5,
+    0x9DACA7,
+    0x9DACA7,
+    0x9EADA8,
+    0x9FAEA9,
+    0xA1B0A9,
+    0xA3B2AB,
+    0x9FAEA7,
+    0xA0AFA8,
+    0xA0AFA8,
+    0xA2B1AA,
+    0xA3B3A9,
+    0xA4B4AA,
+    0xA5B5AB,
+    0xA5B5AB,
+    0xA6B5AE,
+    0xA7B6AF,
+    0xA8B7B0,
+    0xA7B6AF,
+    0xA7B6B1,
+    0xA8B7B2,
+    0xAAB9B2,
+    0xACBBB4,
+    0xACBCB2,
+    0xACBCB2,
+    0xACBCAF,
+    0xACBCAF,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBEA8,
+    0xACBDAA,
+    0xACBFAC,
+    0xACBEAE,
+    0xACBEAE,
+    0xACBEAE,
+    0xACBDAD,
+    0xACBDAD,
+    0xABBCAA,
+    0xAABBA9,
+    0xA9BAA8,
+    0xA7B8A6,
+    0xABBAA7,
+    0xAEBDAA,
+    0xAEBDAA,
+    0xAAB9A6,
+    0xA8B7A4,
+    0xAAB9A6,
+    0xA8B9A7,
+    0xA7B8A6,
+    0xA8B9A7,
+    0xAABBA9,
+    0xABBCAA,
+    0xACBDAB,
+    0xADBEAC,
+    0xAEBFAD,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA9BAA8,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA8B9A9,
+    0xA9BAAA,
+    0xA7B8A8,
+    0xA4B5A5,
+    0xA4B5A5,
+    0xA7B8A8,
+    0xA6B7A5,
+    0xA3B4A2,
+    0xA1B2A0,
+    0xA2B3A1,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA0B19E,
+    0xA0B19E,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x8B9C89,
+    0x879886,
+    0x7C8D7B,
+    0x041503,
+    0x000C00,
+    0x001100,
+    0x000800,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000B00,
+    0x000900,
+    0x000A00,
+    0x000A00,
+    0x000800,
+    0x000700,
+    0x000800,
+    0x000D00,
+    0x000D00,
+    0x000D00,
+    0x000E00,
+    0x031402,
+    0x1C2C1F,
+    0x92A298,
+    0x8D9C99,
+    0x909E9E,
+    0x93A29D,
+    0x95A49F,
+    0x97A6A1,
+    0x98A7A2,
+    0x9AA9A4,
+    0x9CABA6,
+    0x9FAEA7,
+    0xA2B1AA,
+    0xA5B4AD,
+    0xA5B4AD,
+    0xA5B4AD,
+    0xA5B4AD,
+    0xA5B5AB,
+    0xA5B5AB,
+    0xA6B6AC,
+    0xA6B6AC,
+    0xA6B6AC,
+    0xA7B7AD,
+    0xA8B7B0,
+    0xA7B6AF,
+    0xA7B6B1,
+    0xA8B7B2,
+    0xAAB9B4,
+    0xACBBB6,
+    0xACBBB4,
+    0xACBCB2,
+    0xACBCB1,
+    0xACBCAF,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBEA8,
+    0xACBDAA,
+    0xACBEAE,
+    0xACBEB0,
+    0xACBEAE,
+    0xACBEAE,
+    0xACBDAD,
+    0xABBCAC,
+    0xAABBA9,
+    0xAABBA9,
+    0xA6B7A5,
+    0xA3B4A2,
+    0xA5B4A1,
+    0xA8B7A4,
+    0xAAB9A6,
+    0xAAB9A6,
+    0xADBCA7,
+    0xB2C1AE,
+    0xA1B29F,
+    0xA5B6A4,
+    0xA8B9A7,
+    0xA8B9A7,
+    0xA9BAA8,
+    0xA8B9A7,
+    0xA4B5A3,
+    0x9FB09E,
+    0xA3B4A2,
+    0xA4B5A3,
+    0xA5B6A4,
+    0xA5B6A4,
+    0xA4B5A3,
+    0xA4B5A3,
+    0xA3B4A2,
+    0xA4B5A3,
+    0xA2B3A3,
+    0xA4B5A5,
+    0xA3B4A4,
+    0x9FB0A0,
+    0xA1B2A2,
+    0xA4B5A5,
+    0xA4B5A3,
+    0xA0B19F,
+    0xA0B19F,
+    0xA0B19F,
+    0xA0B19E,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0xA0B19E,
+    0x9FB09D,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x99AB95,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A491,
+    0x92A390,
+    0x8B9C89,
+    0x889987,
+    0x869785,
+    0x071806,
+    0x000D00,
+    0x011200,
+    0x000700,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x011202,
+    0x000D02,
+    0x2A3A2F,
+    0x90A096,
+    0x8B9A93,
+    0x94A39C,
+    0x85958B,
+    0x84948A,
+    0x85958B,
+    0x88988E,
+    0x8B9B91,
+    0x8C9C92,
+    0x8A9A90,
+    0x87978D,
+    0x92A298,
+    0x94A49A,
+    0x95A59B,
+    0x95A59B,
+    0x93A399,
+    0x92A298,
+    0x92A298,
+    0x92A298,
+    0xA0B0A6,
+    0xA2B2A8,
+    0xA5B5AB,
+    0xA7B7AD,
+    0xA8B8AD,
+    0xA8B8AD,
+    0xA8B8AB,
+    0xA9B9AC,
+    0xACBDAD,
+    0xACBDAD,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xADBEAB,
+    0xACBDAA,
+    0xAABBA8,
+    0xABBCA9,
+    0xAABBA8,
+    0xA1B29F,
+    0x96A794,
+    0x97A895,
+    0x98A996,
+    0x768774,
+    0x768774,
+    0x7B8C79,
+    0x7C8D7A,
+    0x8B9C89,
+    0x768774,
+    0x94A592,
+    0x798A77,
+    0x879885,
+    0x7E8F7C,
+    0x7F907D,
+    0x92A390,
+    0x80917E,
+    0x788976,
+    0x7A8B78,
+    0x7A8B78,
+    0x8A9B88,
+    0x80917E,
+    0x6C7D6A,
+    0x889986,
+    0x98A996,
+    0x728370,
+    0x899A87,
+    0x92A390,
+    0x9EAF9C,
+    0xA5B6A3,
+    0xA5B6A3,
+    0xA3B4A1,
+    0xA1B29F,
+    0xA0B19E,
+    0xA1B29F,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x94A593,
+    0x93A492,
+    0x93A492,
+    0x8A9B89,
+    0x8B9C8C,
+    0x7E8F7F,
+    0x1E2F1F,
+    0x000A00,
+    0x000C00,
+    0x000E00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000C00,
+    0x000F00,
+    0x000B00,
+    0x324237,
+    0x95A59B,
+    0x93A29B,
+    0x9AA9A2,
+    0x9BABA1,
+    0x9CACA2,
+    0x9DADA3,
+    0xA0B0A6,
+    0xA2B2A8,
+    0xA4B4AA,
+    0xA3B3A9,
+    0xA2B2A8,
+    0xA1B1A7,
+    0xA1B1A7,
+    0xA2B2A8,
+    0xA1B1A7,
+    0xA1B1A7,
+    0xA2B2A8,
+    0xA5B5AB,
+    0xA7B7AD,
+    0xA3B3A9,
+    0xA5B5AB,
+    0xA7B7AD,
+    0xA8B8AE,
+    0xA8B8AD,
+    0xA8B8AD,
+    0xAABAAD,
+    0xABBBAE,
+    0xACBDAD,
+    0xACBDAD,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xACBDAA,
+    0xAABBA8,
+    0xACBDAA,
+    0xADBEAB,
+    0xABBCA9,
+    0xABBCA9,
+    0xACBDAA,
+    0xA9BAA7,
+    0xA4B5A2,
+    0xA9BAA7,
+    0xB2C3B0,
+    0x9EAF9C,
+    0xA4B5A2,
+    0xA9BAA7,
+    0xA6B7A4,
+    0xB3C4B1,
+    0xA0B19E,
+    0xADBEAB,
+    0x9CAD9A,
+    0xA7B8A5,
+    0x9DAE9B,
+    0x9EAF9C,
+    0xADBEAB,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9AAB98,
+    0x94A592,
+    0x9DAE9B,
+    0x98A996,
+    0x869784,
+    0x92A390,
+    0x9BAC99,
+    0x849582,
+    0x92A390,
+    0x99AA97,
+    0xA0B19E,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA0B19E,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x94A593,
+    0x93A492,
+    0x92A391,
+    0x8B9C8A,
+    0x8D9E8E,
+    0x819282,
+    0x273828,
+    0x000C00,
+    0x000C00,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000B00,
+    0x000E00,
+    0x000C01,
+    0x3F4F44,
+    0x96A69C,
+    0x92A19A,
+    0x94A39C,
+    0x95A49D,
+    0x97A69F,
+    0x99A8A1,
+    0x9BAAA3,
+    0x9CABA4,
+    0x9EADA6,
+    0xA0AFA8,
+    0xA2B1AA,
+    0xA3B2AB,
+    0xA5B4AD,
+    0xA7B6AF,
+    0xA8B7B0,
+    0xA7B6AF,
+    0xA7B6AF,
+    0xA9B8B1,
+    0xAAB9B2,
+    0xA6B6AB,
+    0xA7B7AC,
+    0xA8B8AD,
+    0xA8B8AD,
+    0xA8B8AD,
+    0xA9B9AE,
+    0xABBBAE,
+    0xADBDB0,
+    0xACBDAD,
+    0xACBDAD,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAB,
+    0xACBDAB,
+    0xA9BAA7,
+    0xACBDAA,
+    0xADBEAB,
+    0xABBCA9,
+    0xAABBA8,
+    0xABBCA9,
+    0xAEBFAC,
+    0xAEBFAC,
+    0xA0B19E,
+    0xAEBFAC,
+    0xA4B5A2,
+    0xAABBA8,
+    0xABBCA9,
+    0xA7B8A5,
+    0xB2C3B0,
+    0xA6B7A4,
+    0xADBEAB,
+    0xA8B9A6,
+    0xB0C1AE,
+    0xA3B4A1,
+    0xA5B6A3,
+    0xAEBFAC,
+    0x9FB09D,
+    0xA7B8A5,
+    0xACBDAA,
+    0xA3B4A1,
+    0xA6B7A4,
+    0xAABBA8,
+    0xA3B4A1,
+    0xA1B29F,
+    0xA4B5A2,
+    0xA1B29F,
+    0x9DAE9B,
+    0xA0B19E,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA1B29F,
+    0xA3B4A1,
+    0xA0B19E,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x97A895,
+    0x95A693,
+    0x94A593,
+    0x93A492,
+    0x91A290,
+    0x8C9D8B,
+    0x8E9F8F,
+    0x839484,
+    0x364737,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x001000,
+    0x000F04,
+    0x4B5B50,
+    0x90A096,
+    0x8B9A93,
+    0x889790,
+    0x8C9B94,
+    0x8E9D96,
+    0x91A099,
+    0x91A099,
+    0x91A099,
+    0x93A29B,
+    0x97A69F,
+    0x9AA9A2,
+    0x95A49D,
+    0x9AA9A2,
+    0xA0AFA8,
+    0xA4B3AC,
+    0xA6B5AE,
+    0xA5B4AD,
+    0xA4B3AC,
+    0xA3B2AB,
+    0xA9B9AE,
+    0xA9B9AE,
+    0xA8B8AD,
+    0xA7B7AC,
+    0xA6B6A9,
+    0xA8B8AB,
+    0xABBBAE,
+    0xADBDB0,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAA,
+    0xABBCAA,
+    0xABBCAA,
+    0xABBCAA,
+    0xABBCA9,
+    0xACBDAA,
+    0xACBDAA,
+    0xAABBA8,
+    0xA8B9A6,
+    0xA9BAA7,
+    0xAABBA8,
+    0xABBCA9,
+    0xAABBA8,
+    0xB1C2AF,
+    0xA7B8A5,
+    0xA6B7A4,
+    0xA2B3A0,
+    0x9FB09D,
+    0xABBCA9,
+    0xA5B6A3,
+    0x9DAE9B,
+    0xA2B3A0,
+    0xA5B6A3,
+    0x9CAD9A,
+    0xA7B8A5,
+    0xAEBFAC,
+    0xA3B4A1,
+    0xAFC0AD,
+    0xA8B9A6,
+    0xA5B6A3,
+    0xA4B5A2,
+    0xAABBA8,
+    0xACBDAA,
+    0xA7B8A5,
+    0xA6B7A4,
+    0xADBEAB,
+    0xA2B3A0,
+    0xA4B5A2,
+    0xA5B6A3,
+    0xA4B5A2,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x95A693,
+    0x94A593,
+    0x93A492,
+    0x91A290,
+    0x8E9F8D,
+    0x8D9E8E,
+    0x839484,
+    0x465747,
+    0x000E00,
+    0x000C00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000B00,
+    0x000B00,
+    0x011202,
+    0x001005,
+    0x57675C,
+    0x8C9C92,
+    0x8D9C95,
+    0x8C9B94,
+    0x8F9E97,
+    0x92A19A,
+    0x94A39C,
+    0x94A39C,
+    0x94A39C,
+    0x95A49D,
+    0x98A7A0,
+    0x9BAAA3,
+    0x94A39C,
+    0x99A8A1,
+    0x9EADA6,
+    0xA3B2AB,
+    0xA6B5AE,
+    0xA7B6AF,
+    0xA8B7B0,
+    0xA9B9AF,
+    0xA8B8AD,
+    0xA8B8AB,
+    0xA7B7AA,
+    0xA6B6A9,
+    0xA5B5A8,
+    0xA6B6A9,
+    0xA9B9AC,
+    0xACBCAF,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCA9,
+    0xAABBA8,
+    0xA9BAA7,
+    0xAABBA8,
+    0xAABBA8,
+    0xA9BAA7,
+    0xA8B9A6,
+    0xA7B8A5,
+    0xA2B3A0,
+    0xA2B3A0,
+    0x97A895,
+    0x91A28F,
+    0x8E9F8C,
+    0x8E9F8C,
+    0x96A794,
+    0x95A693,
+    0x849582,
+    0x8A9B88,
+    0x8B9C89,
+    0x8A9B88,
+    0x9AAB98,
+    0xA4B5A2,
+    0x9DAE9B,
+    0xA6B7A4,
+    0xA6B7A4,
+    0xAABBA8,
+    0xA6B7A4,
+    0xA3B4A1,
+    0xA8B9A6,
+    0xA5B6A3,
+    0xA1B29F,
+    0xA5B6A3,
+    0xA2B3A0,
+    0xA3B4A1,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA3B4A1,
+    0xA1B29F,
+    0xA0B19E,
+    0xA0B19E,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x95A693,
+    0x93A492,
+    0x92A391,
+    0x91A290,
+    0x8FA08E,
+    0x8A9B8B,
+    0x809181,
+    0x556656,
+    0x000D00,
+    0x000C00,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000B00,
+    0x001000,
+    0x000E03,
+    0x627267,
+    0x8D9D93,
+    0x97A69F,
+    0x97A69F,
+    0x97A6A1,
+    0x99A8A3,
+    0x9BAAA5,
+    0x9CABA6,
+    0x9CABA6,
+    0x9DACA7,
+    0x9FAEA9,
+    0xA1B0AB,
+    0xA5B4AF,
+    0xA5B4AF,
+    0xA5B4AF,
+    0xA4B3AE,
+    0xA3B2AD,
+    0xA4B3AE,
+    0xA7B6B1,
+    0xA9B8B1,
+    0xA7B7AC,
+    0xA7B7AA,
+    0xA6B6A9,
+    0xA5B5A8,
+    0xA4B4A7,
+    0xA6B6A9,
+    0xA9B9AC,
+    0xABBBAE,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xABBCAC,
+    0xAABBA8,
+    0xA8B9A6,
+    0xA8B9A6,
+    0xACBDAA,
+    0xADBEAB,
+    0xABBCA9,
+    0xA9BAA7,
+    0xA8B9A6,
+    0xADBEAB,
+    0xABBCA9,
+    0xA6B7A4,
+    0xA3B4A1,
+    0xA3B4A1,
+    0xA4B5A2,
+    0xA6B7A4,
+    0xA5B6A3,
+    0xA1B29F,
+    0xA3B4A1,
+    0xA0B19E,
+    0xA0B19E,
+    0xAABBA8,
+    0xB0C1AE,
+    0xACBDAA,
+    0xABBCA9,
+    0xA4B5A2,
+    0xABBCA9,
+    0xA8B9A6,
+    0xA2B3A0,
+    0xA5B6A3,
+    0xA6B7A4,
+    0xA3B4A1,
+    0xA3B4A1,
+    0xA0B19E,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA3B4A1,
+    0xA3B4A1,
+    0xA2B3A0,
+    0xA0B19E,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x95A693,
+    0x93A492,
+    0x92A391,
+    0x91A290,
+    0x90A18F,
+    0x899A8A,
+    0x7F9080,
+    0x647565,
+    0x000E00,
+    0x000D00,
+    0x000C00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000D00,
+    0x000A00,
+    0x000F00,
+    0x000E03,
+    0x6D7D72,
+    0x8B9B91,
+    0x94A39C,
+    0x8F9E97,
+    0x97A6A1,
+    0x98A7A2,
+    0x99A8A3,
+    0x9CABA6,
+    0x9FAEA9,
+    0xA1B0AB,
+    0xA1B0AB,
+    0xA0AFAA,
+    0xA3B2AD,
+    0xA4B3AE,
+    0xA4B3AE,
+    0xA4B3AE,
+    0xA2B1AC,
+    0xA2B1AC,
+    0xA3B2AD,
+    0xA4B3AC,
+    0xA6B6A9,
+    0xA6B7A7,
+    0xA7B8A8,
+    0xA6B7A7,
+    0xA5B6A6,
+    0xA6B7A7,
+    0xA9BAAA,
+    0xABBCAC,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBCAC,
+    0xA9BAA8,
+    0xA8B9A6,
+    0xAABBA8,
+    0xADBEAB,
+    0xACBDAA,
+    0xA8B9A6,
+    0xA9BAA7,
+    0xACBDAA,
+    0xABBCA9,
+    0xAABBA8,
+    0xACBDAA,
+    0xAABBA8,
+    0xA9BAA7,
+    0xA9BAA7,
+    0xA7B8A5,
+    0xA9BAA7,
+    0xABBCA9,
+    0xA7B8A5,
+    0xA4B5A2,
+    0xA4B5A2,
+    0xA3B4A1,
+    0xA5B6A3,
+    0xA7B8A5,
+    0x9DAE9B,
+    0xA5B6A3,
+    0xA5B6A3,
+    0xA5B6A3,
+    0xA6B7A4,
+    0xA5B6A3,
+    0xA6B7A4,
+    0xA7B8A5,
+    0xA6B7A4,
+    0xA2B3A0,
+    0xA1B29F,
+    0xA1B29F,
+    0xA1B29F,
+    0xA1B29F,
+    0xA1B29F,
+    0xA1B29F,
+    0xA0B19E,
+    0x9FB09D,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A492,
+    0x92A391,
+    0x90A18F,
+    0x92A391,
+    0x8A9B8B,
+    0x819282,
+    0x738474,
+    0x001000,
+    0x000D00,
+    0x000B00,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000900,
+    0x000800,
+    0x000800,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000A00,
+    0x000C00,
+    0x000900,
+    0x000F00,
+    0x001005,
+    0x748479,
+    0x87978D,
+    0x87968F,
+    0x798881,
+    0x83928D,
+    0x83928D,
+    0x84938E,
+    0x899893,
+    0x8E9D98,
+    0x909F9A,
+    0x8F9E99,
+    0x8D9C97,
+    0x8B9A95,
+    0x91A09B,
+    0x9BAAA5,
+    0xA3B2AD,
+    0xA7B6B1,
+    0xA8B7B2,
+    0xA7B6B1,
+    0xA7B6AF,
+    0xA5B5A8,
+    0xA6B7A7,
+    0xA7B8A8,
+    0xA7B8A8,
+    0xA6B7A7,
+    0xA7B8A8,
+    0xA9BAAA,
+    0xABBCAC,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBBAE,
+    0xABBCAC,
+    0xA9BAA8,
+    0xA9BAA7,
+    0xACBDAA,
+    0xACBDAA,
+    0xA8B9A6,
+    0xA3B4A1,
+    0xA6B7A4,
+    0xADBEAB,
+    0xA3B4A1,
+    0xA1B29F,
+    0xA6B7A4,
+    0xA2B3A0,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x98A996,
+    0x9EAF9C,
+    0xA4B5A2,
+    0xA0B19E,
+    0xA0B19E,
+    0xA4B5A2,
+    0x9EAF9C,
+    0xA2B3A0,
+    0xABBCA9,
+    0x9DAE9B,
+    0xABBCA9,
+    0xA2B3A0,
+    0xA4B5A2,
+    0xA9BAA7,
+    0xA4B5A2,
+    0xA0B19E,
+    0xA1B29F,
+    0xA2B3A0,
+    0xA4B5A2,
+    0xA3B4A1,
+    0xA0B19E,
+    0x9FB09D,
+    0xA0B19E,
+    0xA1B29F,
+    0xA1B29F,
+    0xA1B29F,
+    0x9FB09D,
+    0x9FB09D,
+    0x9FB09D,
+    0x9EAF9C,
+    0x9EAF9C,
+    0x9DAE9B,
+    0x9DAE9B,
+    0x9CAD9A,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9BAC99,
+    0x9AAB98,
+    0x9AAB98,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x99AA97,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x98A996,
+    0x98A996,
+    0x97A895,
+    0x96A794,
+    0x94A592,
+    0x93A492,
+    0x92A391,
+    0x8FA08E,
+    0x92A391,
+    0x8C9D8D,
+    0x849585,
+    0x7D8E7E,
+    0x011202,
+    0x000D00,
+    0x000900
+};
@@ -0,0 +1,315 @@
+/*! \file cam_fb_ref_test.c
+\brief Reference counted frame buffers of cam_hal.c on the host DMA model.
+Frames carry a sequence number in a COM segment. A dispatcher takes every
+frame and shares it with several consumer threads that hold it for a random
+time while the sensor keeps sending; each consumer checks the frame byte for
+byte once it is done with it, and the model counts any capture started into
+a slot that still has references.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "cam_hal.h"
+#include "cam_sim.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define CAM_W 320
+#define CAM_H 240
+#define VARIANTS 3
+#define CONSUMERS 3
+#define SHARED_FRAMES 400
+#define STAMP_LEN 10    // FF FE, length, 4 byte sequence number, 2 byte variant
+
+static uint8_t *variants[VARIANTS];
+static size_t variant_len[VARIANTS];
+
+static pthread_mutex_t fail_lock = PTHREAD_MUTEX_INITIALIZER;
+static int thread_failures;
+
+// Thread safe HOST_CHECK for the consumers
+static void ThreadCheck(int ok, const char *what, uint32_t seq)
+{
+    if (!ok) {
+        pthread_mutex_lock(&fail_lock);
+        if (!thread_failures++) {
+            printf("frame %u: %s\n", (unsigned)seq, what);
+        }
+        pthread_mutex_unlock(&fail_lock);
+    }
+}
+
+// The variant with a COM segment holding seq right after SOI
+static size_t StampFrame(uint8_t *out, uint32_t seq)
+{
+    const int v = seq % VARIANTS;
+    const uint8_t stamp[STAMP_LEN] = {
+        0xFF, 0xFE, 0x00, STAMP_LEN - 2,
+        seq >> 24, seq >> 16, seq >> 8, seq, 0x00, v,
+    };
+    memcpy(out, variants[v], 2);
+    memcpy(out + 2, stamp, STAMP_LEN);
+    memcpy(out + 2 + STAMP_LEN, variants[v] + 2, variant_len[v] - 2);
+    return variant_len[v] + STAMP_LEN;
+}
+
+static void SendFrame(uint32_t seq)
+{
+    static uint8_t buf[CAM_W * CAM_H];
+    CamSimFrame(buf, StampFrame(buf, seq));
+}
+
+static uint32_t FrameSeq(const camera_fb_t *fb)
+{
+    const uint8_t *p = fb->buf + 6;
+    return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+// The frame must be exactly what the sensor sent for its sequence number
+static int FrameIntact(const camera_fb_t *fb, uint32_t seq)
+{
+    static __thread uint8_t expect[CAM_W * CAM_H];
+    const size_t len = StampFrame(expect, seq);
+    return fb->len == len && memcmp(fb->buf, expect, len) == 0;
+}
+
+static void ExpectFrame(uint32_t seq)
+{
+    camera_fb_t *fb = cam_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(fb != NULL);
+    if (fb) {
+        HOST_CHECK(FrameIntact(fb, seq));
+        cam_give(fb);
+    }
+}
+
+static void ExpectNoFrame(void)
+{
+    camera_fb_t *fb = cam_take(pdMS_TO_TICKS(20));
+    HOST_CHECK(fb == NULL);
+    if (fb) {
+        cam_give(fb);
+    }
+}
+
+// Single thread: reference counts, pool exhaustion and recovery
+static void RunBasics(void)
+{
+    HOST_CHECK(CamSimInit(FRAMESIZE_QVGA, 3, CAMERA_FB_IN_DRAM, CAMERA_GRAB_WHEN_EMPTY) == ESP_OK);
+    CamSimVsync();
+
+    SendFrame(1);
+    camera_fb_t *a = cam_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(a != NULL);
+    if (!a) {
+        CamSimDeinit();
+        return;
+    }
+    HOST_CHECK(cam_ref(a));
+    HOST_CHECK(cam_ref(a));
+
+    // Two more frames fill the pool, the next one has nowhere to go
+    SendFrame(2);
+    SendFrame(3);
+    SendFrame(4);
+    ExpectFrame(2);
+    ExpectFrame(3);
+    ExpectNoFrame();
+
+    // Returned slots are captured into again, the referenced one is left alone
+    cam_give(a);
+    CamSimVsync();
+    for (uint32_t seq = 5; seq < 20; seq++) {
+        SendFrame(seq);
+        ExpectFrame(seq);
+    }
+    HOST_CHECK(FrameIntact(a, 1));
+
+    cam_give(a);
+    HOST_CHECK(FrameIntact(a, 1));
+    cam_give(a);
+    HOST_CHECK(!cam_ref(a));    // no references left
+    cam_give(a);                // returning it again changes nothing
+
+    static camera_fb_t stray;
+    HOST_CHECK(!cam_ref(&stray));
+    HOST_CHECK(!cam_ref(NULL));
+    cam_give(&stray);
+
+    // Every slot is free again: three frames queue without being taken
+    for (uint32_t seq = 20; seq < 23; seq++) {
+        SendFrame(seq);
+    }
+    for (uint32_t seq = 20; seq < 23; seq++) {
+        ExpectFrame(seq);
+    }
+
+    // cam_give_all() releases held frames, capture carries on in its slot
+    CamSimVsync();
+    SendFrame(23);
+    a = cam_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(a != NULL && cam_ref(a));
+    cam_give_all();
+    HOST_CHECK(!cam_ref(a));
+    for (uint32_t seq = 24; seq < 27; seq++) {
+        SendFrame(seq);
+    }
+    for (uint32_t seq = 24; seq < 27; seq++) {
+        ExpectFrame(seq);
+    }
+
+    const cam_sim_stats_t stats = CamSimStats();
+    HOST_CHECK(stats.busy_starts == 0);
+    CamSimDeinit();
+}
+
+typedef struct {
+    QueueHandle_t queue;
+    pthread_t thread;
+    uint32_t held;
+} consumer_t;
+
+static consumer_t consumers[CONSUMERS];
+static volatile bool producer_done;
+static uint32_t dispatched;
+
+static void *ConsumerThread(void *arg)
+{
+    consumer_t *c = arg;
+    uint32_t rnd = (uint32_t)(c - consumers) + 1;
+    for (;;) {
+        camera_fb_t *fb = NULL;
+        xQueueReceive(c->queue, &fb, portMAX_DELAY);
+        if (!fb) {
+            break;
+        }
+        const uint32_t seq = FrameSeq(fb);
+        rnd = rnd * 1103515245 + 12345;
+        usleep((rnd >> 16) % 3000);
+        ThreadCheck(FrameIntact(fb, seq), "changed while referenced", seq);
+        c->held++;
+        cam_give(fb);
+    }
+    return NULL;
+}
+
+// Takes every frame, shares it with all consumers and drops its own reference
+static void *DispatchThread(void *arg)
+{
+    uint32_t last = 0;
+    for (;;) {
+        camera_fb_t *fb = cam_take(pdMS_TO_TICKS(50));
+        if (!fb) {
+            if (producer_done) {
+                break;
+            }
+            continue;
+        }
+        const uint32_t seq = FrameSeq(fb);
+        ThreadCheck(seq > last, "out of order", seq);
+        last = seq;
+        for (int i = 0; i < CONSUMERS; i++) {
+            camera_fb_t *shared = cam_ref(fb) ? fb : NULL;
+            ThreadCheck(shared != NULL, "no reference", seq);
+            if (shared) {
+                xQueueSend(consumers[i].queue, &shared, portMAX_DELAY);
+            }
+        }
+        cam_give(fb);
+        dispatched++;
+    }
+    for (int i = 0; i < CONSUMERS; i++) {
+        camera_fb_t *stop = NULL;
+        xQueueSend(consumers[i].queue, &stop, portMAX_DELAY);
+    }
+    return NULL;
+}
+
+// Concurrent consumers holding frames while capture runs on
+static void RunShared(bool zero_copy, camera_fb_location_t location, size_t fb_count)
+{
+    cam_set_zero_copy_mode(zero_copy);
+    HOST_CHECK(CamSimInit(FRAMESIZE_QVGA, fb_count, location, CAMERA_GRAB_WHEN_EMPTY) == ESP_OK);
+    CamSimVsync();
+
+    thread_failures = 0;
+    dispatched = 0;
+    producer_done = false;
+    for (int i = 0; i < CONSUMERS; i++) {
+        consumers[i].queue = xQueueCreate(fb_count, sizeof(camera_fb_t *));
+        consumers[i].held = 0;
+        pthread_create(&consumers[i].thread, NULL, ConsumerThread, &consumers[i]);
+    }
+    pthread_t dispatcher;
+    pthread_create(&dispatcher, NULL, DispatchThread, NULL);
+
+    for (uint32_t seq = 1; seq <= SHARED_FRAMES; seq++) {
+        SendFrame(seq);
+        usleep(1000);   // about the consumers' pace, the pool runs full now and then
+    }
+    producer_done = true;
+    pthread_join(dispatcher, NULL);
+    uint32_t held = 0;
+    for (int i = 0; i < CONSUMERS; i++) {
+        pthread_join(consumers[i].thread, NULL);
+        vQueueDelete(consumers[i].queue);
+        held += consumers[i].held;
+    }
+
+    const cam_sim_stats_t stats = CamSimStats();
+    printf("%-9s %-5s %2zu slots %4u of %u frames shared, %5u held, %3u busy starts\n",
+           zero_copy ? "zero copy" : "copy", location == CAMERA_FB_IN_DRAM ? "DRAM" : "PSRAM",
+           fb_count, (unsigned)dispatched, SHARED_FRAMES, (unsigned)held, (unsigned)stats.busy_starts);
+    HOST_CHECK(thread_failures == 0);
+    HOST_CHECK(stats.busy_starts == 0);
+    HOST_CHECK(held == dispatched * CONSUMERS);
+    HOST_CHECK(dispatched > SHARED_FRAMES / 10);
+
+    // Everything was returned: the whole pool fills up again
+    CamSimVsync();
+    for (uint32_t seq = 1; seq <= fb_count; seq++) {
+        SendFrame(SHARED_FRAMES + seq);
+    }
+    for (uint32_t seq = 1; seq <= fb_count; seq++) {
+        ExpectFrame(SHARED_FRAMES + seq);
+    }
+    CamSimDeinit();
+}
+
+int main(void)
+{
+    uint8_t *bgr = malloc(CAM_W * CAM_H * 3);
+    for (int y = 0; y < CAM_H; y++) {
+        for (int x = 0; x < CAM_W; x++) {
+            const unsigned int word = jpeg_no_huffman_rgb888[(y / 2) * 160 + x / 2];
+            uint8_t *p = bgr + (y * CAM_W + x) * 3;
+            p[0] = word >> 16;
+            p[1] = word >> 8;
+            p[2] = word;
+        }
+    }
+    static const int qualities[VARIANTS] = { 20, 40, 60 };
+    for (int i = 0; i < VARIANTS; i++) {
+        HOST_CHECK(fmt2jpg(bgr, CAM_W * CAM_H * 3, CAM_W, CAM_H, PIXFORMAT_RGB888, qualities[i],
+                           &variants[i], &variant_len[i]));
+        HOST_CHECK(variant_len[i] + STAMP_LEN < CAM_W * CAM_H / 5);
+    }
+    free(bgr);
+
+    RunBasics();
+    RunShared(false, CAMERA_FB_IN_DRAM, 3);
+    RunShared(false, CAMERA_FB_IN_DRAM, 6);
+    RunShared(true, CAMERA_FB_IN_PSRAM, 4);
+
+    for (int i = 0; i < VARIANTS; i++) {
+        free(variants[i]);
+    }
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,335 @@
+/*! \file cam_gray_test.c
+\brief Grayscale stream derived from the JPEG frames (cam_gray.c) on the host
+DMA model. A synthetic source sends 1280x720 JPEG frames whose brightness
+tells them apart; the JPEG consumer must see every frame while the grayscale
+queue gets the due ones at the configured cadence, each the scaled down image
+of the frame with its sequence number. Frames the application does not take
+or keeps, frames larger than the buffers and restarting the stream are
+covered too, and the table shows what the stream allocates.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "cam_hal.h"
+#include "cam_gray.h"
+#include "cam_sim.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#define SRC_W 1280
+#define SRC_H 720
+#define PATTERNS 4
+#define FB_COUNT 3
+#define FRAME_GAP_US 10000
+#define MAX_ERROR 4.0           // mean absolute error against the box filtered source
+
+#define WORK_SIZE ESP_JPEG_WORK_BUF_SIZE    // the decoder work area cam_gray.c allocates
+
+static uint8_t *src[PATTERNS];  // luma of each pattern
+static uint8_t *jpg[PATTERNS];
+static size_t jpg_len[PATTERNS];
+static int sent;                // frames sent since Start()
+static uint32_t jpeg_seq;       // last JPEG sequence number taken
+
+static void MakePatterns(void)
+{
+    uint8_t *bgr = malloc(SRC_W * SRC_H * 3);
+    for (int p = 0; p < PATTERNS; p++) {
+        src[p] = malloc(SRC_W * SRC_H);
+        for (int y = 0; y < SRC_H; y++) {
+            for (int x = 0; x < SRC_W; x++) {
+                // a gradient at a level of its own, and a bright box that moves
+                const bool box = x >= 200 + p * 160 && x < 360 + p * 160 && y >= 240 && y < 400;
+                const uint8_t v = box ? 240 : 20 + p * 40 + (x + y) / 64;
+                src[p][y * SRC_W + x] = v;
+                memset(&bgr[(y * SRC_W + x) * 3], v, 3);
+            }
+        }
+        HOST_CHECK(fmt2jpg(bgr, SRC_W * SRC_H * 3, SRC_W, SRC_H, PIXFORMAT_RGB888, 30, &jpg[p], &jpg_len[p]));
+    }
+    free(bgr);
+}
+
+// Mean absolute error of a grayscale frame against the box filtered pattern
+static double FrameError(const camera_fb_t *fb, int pattern)
+{
+    const int div = SRC_W / fb->width;
+    double sum = 0;
+    for (int oy = 0; oy < (int)fb->height; oy++) {
+        for (int ox = 0; ox < (int)fb->width; ox++) {
+            int acc = 0;
+            for (int y = 0; y < div; y++) {
+                for (int x = 0; x < div; x++) {
+                    acc += src[pattern][(oy * div + y) * SRC_W + ox * div + x];
+                }
+            }
+            const int want = acc / (div * div);
+            sum += abs(want - fb->buf[oy * fb->width + ox]);
+        }
+    }
+    return sum / (fb->width * fb->height);
+}
+
+// Frame n (from 0) of the source has sequence number n + 1 and pattern n % PATTERNS
+static int Pattern(uint32_t sequence)
+{
+    return (sequence - 1) % PATTERNS;
+}
+
+static void Start(void)
+{
+    HOST_CHECK(CamSimInit(FRAMESIZE_HD, FB_COUNT, CAMERA_FB_IN_DRAM, CAMERA_GRAB_WHEN_EMPTY) == ESP_OK);
+    CamSimVsync();
+    sent = 0;
+    jpeg_seq = 0;
+}
+
+static void Stop(void)
+{
+    camera_stats_t stats;
+    cam_get_stats(&stats);
+    HOST_CHECK(stats.delivered == (uint32_t)sent && stats.no_fb == 0 && stats.queue_full == 0);
+    HOST_CHECK(CamSimStats().busy_starts == 0);
+    CamSimDeinit();
+}
+
+static camera_gray_config_t GrayConfig(uint8_t every, uint8_t scale_div, uint8_t fb_count)
+{
+    const camera_gray_config_t config = {
+        .every = every,
+        .scale_div = scale_div,
+        .fb_count = fb_count,
+        .task_priority = 5,
+        .task_core = -1,
+    };
+    return config;
+}
+
+// One source frame, then the JPEG consumer takes it: nothing may be lost or late
+static void SendFrame(useconds_t gap)
+{
+    usleep(gap);
+    const int p = sent % PATTERNS;
+    CamSimFrame(jpg[p], jpg_len[p]);
+    sent++;
+    camera_fb_t *fb = cam_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(fb != NULL);
+    if (fb) {
+        HOST_CHECK(fb->sequence == jpeg_seq + 1 && fb->len == jpg_len[p]);
+        jpeg_seq = fb->sequence;
+        cam_give(fb);
+    }
+}
+
+static void CheckFrame(const camera_fb_t *fb, uint16_t width, uint16_t height)
+{
+    HOST_CHECK(fb->format == PIXFORMAT_GRAYSCALE && fb->width == width && fb->height == height &&
+               fb->len == (size_t)width * height);
+    HOST_CHECK(fb->sequence >= 1 && fb->sequence <= (uint32_t)sent && fb->capture_end_us > fb->capture_start_us);
+    const double error = FrameError(fb, Pattern(fb->sequence));
+    if (error > MAX_ERROR) {
+        printf("frame %u at 1/%u: error %.2f\n", (unsigned)fb->sequence, (unsigned)(SRC_W / width), error);
+    }
+    HOST_CHECK(error <= MAX_ERROR);
+}
+
+static camera_gray_stats_t GrayStats(void)
+{
+    camera_gray_stats_t stats = { 0 };
+    HOST_CHECK(cam_gray_get_stats(&stats) == ESP_OK);
+    return stats;
+}
+
+// Every stream allocation, as the start logs it
+static size_t ExpectedMemory(uint8_t scale_div, uint8_t fb_count, uint16_t max_width, uint16_t max_height)
+{
+    const size_t width = max_width / scale_div;
+    const size_t fb_size = width * (max_height / scale_div);
+    const size_t band = width * (scale_div < 16 ? 16 / scale_div : 1) * 3;
+    return fb_count * (fb_size + sizeof(camera_fb_t)) + band + WORK_SIZE;
+}
+
+// A prompt consumer gets exactly every Nth frame, the JPEG stream is untouched
+static void CheckCadence(uint8_t every)
+{
+    Start();
+    const camera_gray_config_t config = GrayConfig(every, 8, 2);
+    HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_OK);
+    const int frames = 60;
+    uint32_t last = 0;
+    int got = 0;
+    for (int i = 0; i <= frames; i++) {
+        if (i < frames) {
+            SendFrame(FRAME_GAP_US);
+        }
+        camera_fb_t *fb;
+        while ((fb = cam_gray_take(i < frames ? 0 : pdMS_TO_TICKS(200))) != NULL) {
+            CheckFrame(fb, SRC_W / 8, SRC_H / 8);
+            // the first due frame is the one being captured at start
+            HOST_CHECK(fb->sequence == (got ? last + every : 1));
+            last = fb->sequence;
+            got++;
+            cam_gray_give(fb);
+            if (got == (frames + every - 1) / every) {
+                break;
+            }
+        }
+    }
+    const camera_gray_stats_t stats = GrayStats();
+    HOST_CHECK(got == (frames + every - 1) / every);
+    HOST_CHECK(stats.taken == (uint32_t)got && stats.derived == (uint32_t)got);
+    HOST_CHECK(stats.replaced == 0 && stats.no_fb == 0 && stats.decode_failed == 0);
+    HOST_CHECK(cam_gray_stop() == ESP_OK);
+    printf("every %u: %d JPEG frames, %d grayscale frames\n", every, frames, got);
+    Stop();
+}
+
+// Frames faster than the decoder: due frames the decoder is busy for are deferred, never dropped from the JPEG stream
+static void CheckBusy(void)
+{
+    Start();
+    const camera_gray_config_t config = GrayConfig(1, 2, 2);
+    HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_OK);
+    for (int i = 0; i < 30; i++) {
+        SendFrame(2000);
+    }
+    usleep(100000);
+    uint32_t last = 0;
+    camera_fb_t *fb;
+    while ((fb = cam_gray_take(0)) != NULL) {
+        CheckFrame(fb, SRC_W / 2, SRC_H / 2);
+        HOST_CHECK(fb->sequence > last);
+        last = fb->sequence;
+        cam_gray_give(fb);
+    }
+    const camera_gray_stats_t stats = GrayStats();
+    HOST_CHECK(stats.taken >= 1 && stats.taken <= 30);
+    HOST_CHECK(stats.taken == stats.derived + stats.no_fb + stats.decode_failed);
+    printf("every 1 at 1/2, a frame every 2 ms: %u of 30 frames derived\n", (unsigned)stats.derived);
+    HOST_CHECK(cam_gray_stop() == ESP_OK);
+    Stop();
+}
+
+// Frames nobody takes make room for newer ones; held buffers make the stream skip
+static void CheckConsumer(void)
+{
+    Start();
+    const camera_gray_config_t config = GrayConfig(1, 8, 2);
+    HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_OK);
+    for (int i = 0; i < 8; i++) {
+        SendFrame(FRAME_GAP_US);
+    }
+    usleep(50000);
+    camera_gray_stats_t stats = GrayStats();
+    HOST_CHECK(stats.derived == 8 && stats.replaced == 6);
+    // the two newest frames, oldest first
+    camera_fb_t *a = cam_gray_take(0);
+    camera_fb_t *b = cam_gray_take(0);
+    HOST_CHECK(a && b && a->sequence == 7 && b->sequence == 8);
+    HOST_CHECK(cam_gray_take(0) == NULL);
+
+    // both held: the next frames are skipped, the JPEG stream goes on
+    for (int i = 0; i < 4; i++) {
+        SendFrame(FRAME_GAP_US);
+    }
+    usleep(50000);
+    stats = GrayStats();
+    HOST_CHECK(stats.no_fb == 4 && stats.derived == 8);
+    if (a && b) {
+        CheckFrame(a, SRC_W / 8, SRC_H / 8);
+        CheckFrame(b, SRC_W / 8, SRC_H / 8);
+        cam_gray_give(a);
+        cam_gray_give(b);
+    }
+    SendFrame(FRAME_GAP_US);
+    a = cam_gray_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(a && a->sequence == 13);
+    cam_gray_give(a);
+    HOST_CHECK(cam_gray_stop() == ESP_OK);
+    Stop();
+}
+
+// Frames larger than the buffers are not derived, stop releases the tapped frame, restart works
+static void CheckLimits(void)
+{
+    Start();
+    camera_gray_config_t config = GrayConfig(1, 8, 1);
+    config.scale_div = 3;
+    HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_ERR_INVALID_ARG);
+    config.scale_div = 8;
+    config.every = 0;
+    HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_ERR_INVALID_ARG);
+    config.every = 1;
+
+    HOST_CHECK(cam_gray_start(&config, 640, 480) == ESP_OK);
+    HOST_CHECK(cam_gray_start(&config, 640, 480) == ESP_ERR_INVALID_STATE);
+    SendFrame(FRAME_GAP_US);
+    HOST_CHECK(cam_gray_take(pdMS_TO_TICKS(50)) == NULL);
+    HOST_CHECK(GrayStats().decode_failed == 1);
+    HOST_CHECK(cam_gray_stop() == ESP_OK);
+    HOST_CHECK(cam_gray_stop() == ESP_ERR_INVALID_STATE);
+
+    // every slot must come back after a stop with a frame out
+    for (int i = 0; i < 3; i++) {
+        HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_OK);
+        SendFrame(FRAME_GAP_US);
+        HOST_CHECK(cam_gray_stop() == ESP_OK);
+    }
+    for (int i = 0; i < FB_COUNT + 2; i++) {
+        SendFrame(FRAME_GAP_US);
+    }
+    HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_OK);
+    SendFrame(FRAME_GAP_US);
+    camera_fb_t *fb = cam_gray_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(fb && fb->sequence == (uint32_t)sent);
+    cam_gray_give(fb);
+    HOST_CHECK(cam_gray_stop() == ESP_OK);
+    Stop();
+}
+
+// What the stream allocates, against a whole frame decoded to RGB888 at the same scale
+static void CheckMemory(void)
+{
+    Start();
+    printf("\n%-6s %10s %10s %10s %10s %12s\n", "scale", "frame", "band", "work", "total", "RGB888 frame");
+    const uint8_t divs[] = { 2, 4, 8 };
+    for (int i = 0; i < 3; i++) {
+        const camera_gray_config_t config = GrayConfig(1, divs[i], 2);
+        HOST_CHECK(cam_gray_start(&config, SRC_W, SRC_H) == ESP_OK);
+        const camera_gray_stats_t stats = GrayStats();
+        HOST_CHECK(stats.memory == ExpectedMemory(divs[i], 2, SRC_W, SRC_H));
+        const size_t width = SRC_W / divs[i], height = SRC_H / divs[i];
+        printf("1/%-4u %10u %10u %10u %10u %12u\n", divs[i], (unsigned)(width * height),
+               (unsigned)(width * (16 / divs[i]) * 3), WORK_SIZE, (unsigned)stats.memory,
+               (unsigned)(width * height * 3));
+
+        SendFrame(FRAME_GAP_US);
+        camera_fb_t *fb = cam_gray_take(pdMS_TO_TICKS(500));
+        HOST_CHECK(fb != NULL);
+        if (fb) {
+            CheckFrame(fb, width, height);
+            cam_gray_give(fb);
+        }
+        HOST_CHECK(cam_gray_stop() == ESP_OK);
+    }
+    Stop();
+}
+
+int main(void)
+{
+    MakePatterns();
+    CheckCadence(3);
+    CheckCadence(5);
+    CheckBusy();
+    CheckConsumer();
+    CheckLimits();
+    CheckMemory();
+    for (int p = 0; p < PATTERNS; p++) {
+        free(src[p]);
+        free(jpg[p]);
+    }
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+/*! \file cam_jpeg_scan_bench.c
+\brief Cost of framing a JPEG capture: the incremental scanner cam_task now
+runs per 1 KiB DMA transfer, against the scans cam_take used to run on the
+finished frame (SOI search on the first transfer plus a backward EOI search
+from the end of the received data, or the forward EOI probe over the last
+DMA node in PSRAM mode). The old scans are kept here as they were.
+
+Usage: cam_jpeg_scan_bench [iterations]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cam_jpeg_scan.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define VGA_W 640
+#define VGA_H 480
+#define TRANSFER 1024
+
+static const uint8_t JPEG_SOI_MARKER[] = {0xFF, 0xD8, 0xFF};
+#define JPEG_SOI_MARKER_LEN (3)
+static const uint8_t JPEG_EOI_BYTES[] = {0xFF, 0xD9};
+#define JPEG_EOI_MARKER_LEN (2)
+
+static int old_verify_jpeg_soi(const uint8_t *inbuf, uint32_t length)
+{
+    if (length < JPEG_SOI_MARKER_LEN) {
+        return -1;
+    }
+    for (uint32_t i = 0; i <= length - JPEG_SOI_MARKER_LEN; i++) {
+        if (memcmp(&inbuf[i], JPEG_SOI_MARKER, JPEG_SOI_MARKER_LEN) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int old_verify_jpeg_eoi(const uint8_t *inbuf, uint32_t length, bool search_forward)
+{
+    if (length < JPEG_EOI_MARKER_LEN) {
+        return -1;
+    }
+    if (search_forward) {
+        const uint8_t *pat = JPEG_EOI_BYTES;
+        const uint32_t A = pat[0] * 0x01010101u;
+        const uint32_t ONE = 0x01010101u;
+        const uint32_t HIGH = 0x80808080u;
+        uint32_t i = 0;
+        while (i + 4 <= length) {
+            uint32_t w;
+            memcpy(&w, inbuf + i, 4);
+            uint32_t x = w ^ A;
+            uint32_t m = (~x & (x - ONE)) & HIGH;
+            while (m) {
+                unsigned off = __builtin_ctz(m) >> 3;
+                uint32_t pos = i + off;
+                if (pos + JPEG_EOI_MARKER_LEN <= length &&
+                    memcmp(inbuf + pos, pat, JPEG_EOI_MARKER_LEN) == 0) {
+                    return pos;
+                }
+                m &= m - 1;
+            }
+            i += 4;
+        }
+        for (; i + JPEG_EOI_MARKER_LEN <= length; i++) {
+            if (memcmp(inbuf + i, pat, JPEG_EOI_MARKER_LEN) == 0) {
+                return i;
+            }
+        }
+        return -1;
+    }
+    const uint8_t *dptr = inbuf + length - JPEG_EOI_MARKER_LEN;
+    while (dptr >= inbuf) {
+        if (memcmp(dptr, JPEG_EOI_BYTES, JPEG_EOI_MARKER_LEN) == 0) {
+            return dptr - inbuf;
+        }
+        if (dptr == inbuf) {
+            break;
+        }
+        dptr--;
+    }
+    return -1;
+}
+
+static volatile size_t sink;
+
+// Old copy mode: SOI on the first transfer in cam_task, backward EOI in cam_take
+static double TimeOldCopy(const uint8_t *buf, size_t received, int iterations)
+{
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        sink += old_verify_jpeg_soi(buf, TRANSFER);
+        sink += old_verify_jpeg_eoi(buf, received, false);
+    }
+    return (double)(HostTimeUs() - start) / iterations;
+}
+
+// Old PSRAM mode: SOI probe of 32 bytes, forward EOI over the last node
+static double TimeOldPsram(const uint8_t *buf, size_t received, int iterations)
+{
+    const size_t window = TRANSFER + JPEG_EOI_MARKER_LEN - 1 < received ? TRANSFER + JPEG_EOI_MARKER_LEN - 1 : received;
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        sink += old_verify_jpeg_soi(buf, 32);
+        sink += old_verify_jpeg_eoi(buf + received - window, window, true);
+    }
+    return (double)(HostTimeUs() - start) / iterations;
+}
+
+// cam_task now: every transfer as it lands, nothing after the EOI
+static double TimeIncremental(const uint8_t *buf, size_t received, int iterations)
+{
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        cam_jpeg_scan_t scan;
+        cam_jpeg_scan_init(&scan);
+        for (size_t ofs = 0; ofs < received; ofs += TRANSFER) {
+            if (cam_jpeg_scan(&scan, buf + ofs, TRANSFER) != CAM_JPEG_SCAN_MORE) {
+                break;
+            }
+        }
+        sink += scan.length;
+    }
+    return (double)(HostTimeUs() - start) / iterations;
+}
+
+static void Bench(const char *name, const uint8_t *jpg, size_t len, int iterations)
+{
+    // As received: whole transfers, the last one padded
+    const size_t received = (len + TRANSFER - 1) / TRANSFER * TRANSFER;
+    uint8_t *buf = calloc(received, 1);
+    memcpy(buf, jpg, len);
+
+    const double copy = TimeOldCopy(buf, received, iterations);
+    const double psram = TimeOldPsram(buf, received, iterations);
+    const double inc = TimeIncremental(buf, received, iterations);
+    printf("%-16s %7zu %9.2f %9.2f %9.2f %8.1f\n", name, len, copy, psram, inc, len / inc);
+
+    // A frame cut short: no EOI, the old copy mode scan runs through everything
+    memset(buf + len - 2, 0, 2);
+    const double copy_bad = TimeOldCopy(buf, received, iterations);
+    const double inc_bad = TimeIncremental(buf, received, iterations);
+    printf("%-16s %7s %9.2f %9s %9.2f\n", "  without EOI", "", copy_bad, "", inc_bad);
+    free(buf);
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 2000;
+
+    printf("%d iterations, us per frame, 1 KiB transfers\n", iterations);
+    printf("%-16s %7s %9s %9s %9s %8s\n", "frame", "bytes", "old copy", "old psram", "scan", "MB/s");
+
+    static const char *files[] = { "usb_camera.jpg", "logo.jpg" };
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, files[i]);
+        size_t len = 0;
+        uint8_t *jpg = HostReadFile(path, &len);
+        if (jpg) {
+            Bench(files[i], jpg, len, iterations);
+            free(jpg);
+        }
+    }
+
+    // VGA frames: the usb_camera reference scaled up 4x with some sensor noise
+    uint8_t *bgr = malloc(VGA_W * VGA_H * 3);
+    uint32_t seed = 1;
+    for (int y = 0; y < VGA_H; y++) {
+        for (int x = 0; x < VGA_W; x++) {
+            const unsigned int word = jpeg_no_huffman_rgb888[(y / 4) * 160 + x / 4];
+            uint8_t *p = bgr + (y * VGA_W + x) * 3;
+            for (int c = 0; c < 3; c++) {
+                seed = seed * 1103515245 + 12345;
+                const int v = (int)((word >> (16 - 8 * c)) & 0xff) + (int)(seed >> 29) - 4;
+                p[c] = v < 0 ? 0 : v > 255 ? 255 : v;
+            }
+        }
+    }
+    static const int qualities[] = { 30, 60, 90 };
+    for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+        uint8_t *jpg = NULL;
+        size_t len = 0;
+        if (fmt2jpg(bgr, VGA_W * VGA_H * 3, VGA_W, VGA_H, PIXFORMAT_RGB888, qualities[q], &jpg, &len)) {
+            char name[32];
+            snprintf(name, sizeof(name), "VGA q%d", qualities[q]);
+            Bench(name, jpg, len, iterations);
+            free(jpg);
+        }
+    }
+    free(bgr);
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*! \file cam_jpeg_scan_test.c
+\brief Incremental JPEG framing of the capture task (cam_jpeg_scan.c). Real
+frames, plus stale data after them, are fed in random chunk splits down to
+single bytes so every marker gets cut at every position; the scanner must
+report the exact frame length each time. Also covers EXIF style thumbnails,
+restart markers, fill bytes and the broken stream results.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cam_jpeg_scan.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define CAM_W 320
+#define CAM_H 240
+#define SPLITS 300
+#define TAIL 3000
+
+static uint32_t seed = 1;
+
+static uint32_t Rand(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+// Feed in random chunks, mostly small so markers straddle chunk boundaries
+static cam_jpeg_scan_result_t ScanSplit(const uint8_t *data, size_t len, size_t max_chunk, cam_jpeg_scan_t *scan)
+{
+    cam_jpeg_scan_init(scan);
+    cam_jpeg_scan_result_t ret = CAM_JPEG_SCAN_MORE;
+    for (size_t pos = 0; pos < len; ) {
+        size_t n = 1 + Rand() % max_chunk;
+        if (n > len - pos) {
+            n = len - pos;
+        }
+        ret = cam_jpeg_scan(scan, data + pos, n);
+        pos += n;
+    }
+    return ret;
+}
+
+static int checked;
+
+// The frame followed by stale data that is full of markers, as left in a frame buffer slot
+static void CheckFrame(const char *name, const uint8_t *jpg, size_t len)
+{
+    uint8_t *buf = malloc(len + TAIL);
+    memcpy(buf, jpg, len);
+    for (size_t i = len; i < len + TAIL; i++) {
+        buf[i] = Rand() % 3 ? 0xFF : (Rand() % 2 ? 0xD9 : Rand());
+    }
+
+    int bad = 0;
+    for (int i = 0; i < SPLITS; i++) {
+        static const size_t max_chunks[] = { 1, 3, 64, 1024, 4096 };
+        cam_jpeg_scan_t scan;
+        const cam_jpeg_scan_result_t ret = ScanSplit(buf, len + TAIL, max_chunks[i % 5], &scan);
+        if (ret != CAM_JPEG_SCAN_END || scan.length != len) {
+            if (!bad++) {
+                printf("%s: result %d, length %u, expected %zu\n", name, ret, (unsigned)scan.length, len);
+            }
+        }
+        checked++;
+    }
+    HOST_CHECK(bad == 0);
+
+    // Without its EOI the frame never ends, whatever follows is not taken for one
+    cam_jpeg_scan_t scan;
+    memset(buf + len - 2, 0, TAIL);
+    HOST_CHECK(ScanSplit(buf, len - 2 + TAIL, 1024, &scan) == CAM_JPEG_SCAN_MORE);
+    free(buf);
+}
+
+static void CheckFile(const char *file)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, file);
+    size_t len = 0;
+    uint8_t *jpg = HostReadFile(path, &len);
+    HOST_CHECK(jpg != NULL);
+    if (jpg) {
+        CheckFrame(file, jpg, len);
+        free(jpg);
+    }
+}
+
+// APP1 after SOI holding a complete JPEG, its SOI and EOI must be skipped
+static void CheckThumbnail(void)
+{
+    char path[512];
+    size_t main_len = 0, thumb_len = 0;
+    snprintf(path, sizeof(path), "%s/usb_camera.jpg", JPEG_TEST_DIR);
+    uint8_t *main_jpg = HostReadFile(path, &main_len);
+    snprintf(path, sizeof(path), "%s/usb_camera_2.jpg", JPEG_TEST_DIR);
+    uint8_t *thumb = HostReadFile(path, &thumb_len);
+    HOST_CHECK(main_jpg && thumb);
+    if (main_jpg && thumb) {
+        const size_t seg = 2 + 6 + thumb_len;
+        const size_t len = main_len + 2 + seg;
+        uint8_t *jpg = malloc(len);
+        memcpy(jpg, main_jpg, 2);
+        uint8_t *p = jpg + 2;
+        *p++ = 0xFF;
+        *p++ = 0xE1;
+        *p++ = seg >> 8;
+        *p++ = seg & 0xff;
+        memcpy(p, "Exif\0\0", 6);
+        memcpy(p + 6, thumb, thumb_len);
+        memcpy(p + 6 + thumb_len, main_jpg + 2, main_len - 2);
+        CheckFrame("thumbnail", jpg, len);
+        free(jpg);
+    }
+    free(main_jpg);
+    free(thumb);
+}
+
+// Restart markers, stuffed bytes and fill bytes in the entropy coded data
+static void CheckEntropyMarkers(void)
+{
+    static const uint8_t jpg[] = {
+        0xFF, 0xD8, 0xFF, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x01,          // SOI, fill, DRI
+        0xFF, 0xDA, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3F, 0x00,    // SOS
+        0x12, 0xFF, 0x00, 0x34, 0xFF, 0xD0, 0x56, 0xFF, 0xFF, 0xD1,
+        0xFF, 0x00, 0xFF, 0x00, 0x78, 0xFF, 0xD7, 0x9A,
+        0xFF, 0xFF, 0xD9,                                              // fill, EOI
+    };
+    CheckFrame("restart markers", jpg, sizeof(jpg));
+}
+
+static void CheckBroken(void)
+{
+    static const uint8_t no_soi[] = { 0x00, 0xFF, 0xD8, 0xFF, 0xE0 };
+    static const uint8_t soi_no_marker[] = { 0xFF, 0xD8, 0x00, 0xFF, 0xE0 };
+    static const uint8_t short_len[] = { 0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xD9 };
+    static const uint8_t zero_code[] = { 0xFF, 0xD8, 0xFF, 0x00, 0xFF, 0xD9 };
+    static const uint8_t ended[] = { 0xFF, 0xD8, 0xFF, 0xD9, 0xFF, 0xD8 };
+    cam_jpeg_scan_t scan;
+
+    for (size_t chunk = 1; chunk <= 8; chunk++) {
+        HOST_CHECK(ScanSplit(no_soi, sizeof(no_soi), chunk, &scan) == CAM_JPEG_SCAN_NO_SOI);
+        HOST_CHECK(ScanSplit(soi_no_marker, sizeof(soi_no_marker), chunk, &scan) == CAM_JPEG_SCAN_NO_SOI);
+        HOST_CHECK(ScanSplit(short_len, sizeof(short_len), chunk, &scan) == CAM_JPEG_SCAN_BAD);
+        HOST_CHECK(ScanSplit(zero_code, sizeof(zero_code), chunk, &scan) == CAM_JPEG_SCAN_BAD);
+        HOST_CHECK(ScanSplit(ended, sizeof(ended), chunk, &scan) == CAM_JPEG_SCAN_END && scan.length == 4);
+    }
+    // Results are sticky
+    HOST_CHECK(cam_jpeg_scan(&scan, ended, sizeof(ended)) == CAM_JPEG_SCAN_END && scan.length == 4);
+    cam_jpeg_scan_init(&scan);
+    HOST_CHECK(cam_jpeg_scan(&scan, no_soi, 1) == CAM_JPEG_SCAN_NO_SOI);
+    HOST_CHECK(cam_jpeg_scan(&scan, ended, sizeof(ended)) == CAM_JPEG_SCAN_NO_SOI);
+}
+
+int main(void)
+{
+    CheckFile("usb_camera.jpg");
+    CheckFile("usb_camera_2.jpg");
+    CheckFile("logo.jpg");
+    CheckThumbnail();
+    CheckEntropyMarkers();
+    CheckBroken();
+
+    // Camera frames from the jpge encoder over the quality range, colour and Y only
+    uint8_t *bgr = malloc(CAM_W * CAM_H * 3), *gray = malloc(CAM_W * CAM_H);
+    for (int y = 0; y < CAM_H; y++) {
+        for (int x = 0; x < CAM_W; x++) {
+            const unsigned int word = jpeg_no_huffman_rgb888[(y / 2) * 160 + x / 2];
+            uint8_t *p = bgr + (y * CAM_W + x) * 3;
+            for (int c = 0; c < 3; c++) {
+                const int v = (int)((word >> (16 - 8 * c)) & 0xff) + (int)(Rand() % 9) - 4;
+                p[c] = v < 0 ? 0 : v > 255 ? 255 : v;
+            }
+            gray[y * CAM_W + x] = (p[0] + 2 * p[1] + p[2]) / 4;
+        }
+    }
+    static const int qualities[] = { 5, 30, 60, 90, 100 };
+    for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+        char name[32];
+        uint8_t *jpg = NULL;
+        size_t len = 0;
+        HOST_CHECK(fmt2jpg(bgr, CAM_W * CAM_H * 3, CAM_W, CAM_H, PIXFORMAT_RGB888, qualities[q], &jpg, &len));
+        snprintf(name, sizeof(name), "QVGA q%d", qualities[q]);
+        if (jpg) {
+            CheckFrame(name, jpg, len);
+            free(jpg);
+        }
+        jpg = NULL;
+        HOST_CHECK(fmt2jpg(gray, CAM_W * CAM_H, CAM_W, CAM_H, PIXFORMAT_GRAYSCALE, qualities[q], &jpg, &len));
+        snprintf(name, sizeof(name), "QVGA Y q%d", qualities[q]);
+        if (jpg) {
+            CheckFrame(name, jpg, len);
+            free(jpg);
+        }
+    }
+    free(bgr);
+    free(gray);
+
+    printf("%d split frames scanned, %s\n", checked, host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
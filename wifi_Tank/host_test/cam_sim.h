@@ -0,0 +1,91 @@
+/*! \file cam_sim.h
+\brief Host model of the camera DMA for cam_hal.c. ll_cam_sim.c implements
+the ll_cam interface with an ESP32-S3 style JPEG DMA (one byte per item,
+1 KiB transfers) and lets a test play the sensor: data lands wherever the
+descriptors currently point, EOF and VSYNC events go to cam_task through the
+real event queue, and every call returns once cam_task has handled them.
+*****/
+#ifndef CAM_SIM_H
+#define CAM_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    size_t copied;          // bytes cam_task moved with ll_cam_memcpy()
+    size_t copies;          // ll_cam_memcpy() calls
+    size_t dma_bytes;       // bytes the DMA wrote
+    size_t dropped;         // bytes sent while the DMA was stopped
+    uint32_t starts;        // ll_cam_start() calls
+    uint32_t busy_starts;   // ll_cam_start() into a slot that is still referenced
+} cam_sim_stats_t;
+
+/**
+ * @brief Bring up cam_hal for JPEG capture on the model
+ * @param frame_size Sensor frame size, sets the JPEG slot size
+ * @param fb_count Frame buffer slots
+ * @param fb_location Frame buffer memory
+ * @param grab_mode Grab mode
+ * @return ESP_OK or the cam_init()/cam_config() error
+ */
+esp_err_t CamSimInit(framesize_t frame_size, size_t fb_count, camera_fb_location_t fb_location,
+                     camera_grab_mode_t grab_mode);
+
+/**
+ * @brief Wait until cam_task listens for events, after a camera brought up
+ *        with esp_camera_init() instead of CamSimInit()
+ */
+void CamSimWaitReady(void);
+
+/**
+ * @brief Whether the driver has started capture: cam_start() enabled the VSYNC
+ *        interrupt, so a sensor running on its own may send from here on
+ */
+bool CamSimStarted(void);
+
+/**
+ * @brief Stop the camera and free everything cam_hal allocated
+ */
+void CamSimDeinit(void);
+
+/**
+ * @brief Sensor output for one frame: the data, padding to the next transfer
+ *        boundary, then the VSYNC that ends it and starts the next frame
+ * @param data Frame bytes as the sensor sends them
+ * @param len Number of bytes
+ */
+void CamSimFrame(const uint8_t *data, size_t len);
+
+/**
+ * @brief A VSYNC without data, starts capture after CamSimInit()
+ */
+void CamSimVsync(void);
+
+/**
+ * @brief Hold cam_task in its next ll_cam_memcpy() (copy mode) so the events
+ *        that follow pile up in the event queue until it overflows
+ * @param stall true to hold, false to let cam_task catch up and wait for it
+ */
+void CamSimStall(bool stall);
+
+/**
+ * @brief DMA bytes per EOF event
+ */
+size_t CamSimTransferSize(void);
+
+/**
+ * @brief Counters since CamSimInit()
+ */
+cam_sim_stats_t CamSimStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+/*! \file cam_stats_test.c
+\brief Frame metadata and drop accounting of cam_hal.c on the host DMA model.
+Good frames and every kind of broken one go through the simulated event
+queue; each delivered frame must carry the next sequence number, a gap for
+every frame lost in between and the VSYNC times around it, and every lost
+frame must land in exactly one drop counter of cam_get_stats().
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "cam_hal.h"
+#include "cam_sim.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define VGA_W 640
+#define VGA_H 480
+#define SLOT_SIZE (VGA_W * VGA_H / 5)
+#define FRAME_GAP_US 3000
+
+static uint8_t *jpg;
+static size_t jpg_len;
+static uint8_t *big;            // the frame without EOI, then entropy data past the slot size
+static size_t big_len;
+
+static camera_stats_t want;     // counters expected so far
+static uint32_t last_seq;
+static int64_t last_end_us;
+
+static uint32_t Dropped(const camera_stats_t *s)
+{
+    return s->no_fb + s->fb_overflow + s->no_soi + s->jpeg_bad + s->no_eoi +
+           s->fb_size + s->queue_full + s->event_overflow;
+}
+
+// capturing: a slot was free at the last VSYNC, that frame is still open
+static void CheckStats(const char *step, bool capturing)
+{
+    camera_stats_t stats;
+    cam_get_stats(&stats);
+    want.frames = want.delivered + Dropped(&want) + capturing;
+    if (memcmp(&stats, &want, sizeof(stats)) != 0) {
+        printf("%s: frames %u/%u delivered %u/%u replaced %u/%u no_fb %u/%u fb_overflow %u/%u no_soi %u/%u "
+               "jpeg_bad %u/%u no_eoi %u/%u fb_size %u/%u queue_full %u/%u event_overflow %u/%u\n", step,
+               stats.frames, want.frames, stats.delivered, want.delivered, stats.replaced, want.replaced,
+               stats.no_fb, want.no_fb, stats.fb_overflow, want.fb_overflow, stats.no_soi, want.no_soi,
+               stats.jpeg_bad, want.jpeg_bad, stats.no_eoi, want.no_eoi, stats.fb_size, want.fb_size,
+               stats.queue_full, want.queue_full, stats.event_overflow, want.event_overflow);
+    }
+    HOST_CHECK(memcmp(&stats, &want, sizeof(stats)) == 0);
+}
+
+static void Start(bool zero_copy, camera_fb_location_t location, size_t fb_count, camera_grab_mode_t grab_mode)
+{
+    cam_set_zero_copy_mode(zero_copy);
+    HOST_CHECK(CamSimInit(FRAMESIZE_VGA, fb_count, location, grab_mode) == ESP_OK);
+    memset(&want, 0, sizeof(want));
+    last_seq = 0;
+    last_end_us = 0;
+    CamSimVsync();
+    CheckStats("start", true);
+}
+
+// A delivered frame skips exactly the sequence numbers of the frames lost since the last one
+static void ExpectFrame(uint32_t lost)
+{
+    camera_fb_t *fb = cam_take(pdMS_TO_TICKS(200));
+    HOST_CHECK(fb != NULL);
+    if (!fb) {
+        return;
+    }
+    HOST_CHECK(fb->len == jpg_len && memcmp(fb->buf, jpg, jpg_len) == 0);
+    if (fb->sequence != last_seq + 1 + lost) {
+        printf("sequence %u after %u, %u lost\n", (unsigned)fb->sequence, (unsigned)last_seq, (unsigned)lost);
+    }
+    HOST_CHECK(fb->sequence == last_seq + 1 + lost);
+    HOST_CHECK(fb->capture_start_us > 0 && fb->capture_end_us >= fb->capture_start_us + FRAME_GAP_US);
+    HOST_CHECK(fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec == fb->capture_start_us);
+    if (!lost && last_end_us) {
+        // back to back frames share the VSYNC between them
+        HOST_CHECK(fb->capture_start_us == last_end_us);
+    }
+    last_seq = fb->sequence;
+    last_end_us = fb->capture_end_us;
+    cam_give(fb);
+}
+
+static void ExpectNoFrame(void)
+{
+    camera_fb_t *fb = cam_take(pdMS_TO_TICKS(20));
+    HOST_CHECK(fb == NULL);
+    if (fb) {
+        cam_give(fb);
+    }
+}
+
+// The sensor is busy with the frame for a while before VSYNC ends it
+static void SendFrame(const uint8_t *data, size_t len)
+{
+    usleep(FRAME_GAP_US);
+    CamSimFrame(data, len);
+}
+
+static void SendGood(void)
+{
+    SendFrame(jpg, jpg_len);
+    want.delivered++;
+}
+
+// Copy mode, every drop reason the capture task has
+static void RunDrops(void)
+{
+    Start(false, CAMERA_FB_IN_DRAM, 3, CAMERA_GRAB_WHEN_EMPTY);
+    const size_t transfer = CamSimTransferSize();
+    uint8_t *junk = malloc(4 * transfer);
+
+    SendGood();
+    ExpectFrame(0);
+    SendGood();
+    ExpectFrame(0);
+    CheckStats("good", true);
+
+    memset(junk, 0x5a, 4 * transfer);
+    SendFrame(junk, 3 * transfer);
+    want.no_soi++;
+    ExpectNoFrame();
+    CheckStats("no SOI", true);
+    SendGood();
+    ExpectFrame(1);
+
+    static const uint8_t bad_marker[] = { 0xFF, 0xD8, 0xFF, 0x00 };
+    memcpy(junk, bad_marker, sizeof(bad_marker));
+    SendFrame(junk, 2 * transfer);
+    want.jpeg_bad++;
+    CheckStats("bad marker", true);
+
+    SendFrame(jpg, jpg_len - 2);
+    want.no_eoi++;
+    CheckStats("no EOI", true);
+
+    SendFrame(big, big_len);
+    want.fb_overflow++;
+    CheckStats("FB-OVF", true);
+
+    // Less than one transfer never raises an EOF, copy mode has nothing at VSYNC
+    SendFrame(jpg, 100);
+    want.no_eoi++;
+    CheckStats("no data", true);
+
+    SendGood();
+    ExpectFrame(4);
+    CheckStats("recovered", true);
+
+    // All slots queued and untaken: the frames after that have no slot
+    SendGood();
+    SendGood();
+    SendGood();
+    want.no_fb++;
+    CheckStats("pool full", false);
+    SendFrame(jpg, jpg_len);
+    want.no_fb++;
+    CheckStats("no slot", false);
+    ExpectFrame(0);
+    ExpectFrame(0);
+    ExpectFrame(0);
+    SendFrame(jpg, jpg_len);    // lost while idle, its VSYNC starts the next capture
+    SendGood();
+    ExpectFrame(2);
+    CheckStats("slots back", true);
+
+    // cam_task stuck in a copy: the event queue overflows and the frame is abandoned
+    CamSimStall(true);
+    SendFrame(big, 30 * transfer);
+    CamSimStall(false);
+    want.event_overflow++;
+    // lost as well, the capture was stopped and the VSYNC before it never got queued
+    SendFrame(jpg, jpg_len);
+    CheckStats("event overflow", true);
+    SendGood();
+    ExpectFrame(1);
+    CheckStats("after overflow", true);
+
+    free(junk);
+    CamSimDeinit();
+}
+
+// A full queue replaces the oldest frame, the newer one still counts as delivered
+static void RunGrabLatest(void)
+{
+    Start(false, CAMERA_FB_IN_DRAM, 3, CAMERA_GRAB_LATEST);
+    for (int i = 0; i < 4; i++) {
+        SendGood();
+    }
+    want.replaced = 2;
+    CheckStats("grab latest", true);
+    ExpectFrame(2);
+    ExpectFrame(0);
+    ExpectNoFrame();
+    CamSimDeinit();
+}
+
+// Zero copy stops the DMA before it runs past the slot
+static void RunDmaOverflow(void)
+{
+    Start(true, CAMERA_FB_IN_PSRAM, 2, CAMERA_GRAB_WHEN_EMPTY);
+    SendGood();
+    ExpectFrame(0);
+    SendFrame(big, big_len);
+    want.fb_overflow++;
+    CheckStats("DMA overflow", true);
+    SendGood();
+    ExpectFrame(1);
+    CheckStats("zero copy", true);
+    CamSimDeinit();
+}
+
+int main(void)
+{
+    uint8_t *bgr = malloc(VGA_W * VGA_H * 3);
+    for (int y = 0; y < VGA_H; y++) {
+        for (int x = 0; x < VGA_W; x++) {
+            const unsigned int word = jpeg_no_huffman_rgb888[(y / 4) * 160 + x / 4];
+            uint8_t *p = bgr + (y * VGA_W + x) * 3;
+            p[0] = word >> 16;
+            p[1] = word >> 8;
+            p[2] = word;
+        }
+    }
+    HOST_CHECK(fmt2jpg(bgr, VGA_W * VGA_H * 3, VGA_W, VGA_H, PIXFORMAT_RGB888, 30, &jpg, &jpg_len));
+    free(bgr);
+    HOST_CHECK(jpg_len > 4096 && jpg_len < SLOT_SIZE / 2);
+
+    big_len = SLOT_SIZE + 8192;
+    big = malloc(big_len);
+    memcpy(big, jpg, jpg_len - 2);
+    memset(big + jpg_len - 2, 0x5a, big_len - (jpg_len - 2));
+
+    RunDrops();
+    RunGrabLatest();
+    RunDmaOverflow();
+
+    free(jpg);
+    free(big);
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,248 @@
+/*! \file camera_boot_test.c
+\brief Cached sensor state of esp_camera_init_cached() on the host models of
+the sensor bus (sccb_sim.c), NVS (nvs_sim.c) and camera DMA (ll_cam_sim.c).
+Every boot powers up a fresh sensor. The first one probes and runs the setter
+sequence of main/stream.c; later ones must replay the cached writes into the
+same registers and sensor status without calling it, and fall back to the
+full probe when the configuration, the sensor, the firmware or the cache does
+not match.
+The table shows the time from init to the first frame: the delays the boot
+sleeps plus the bus time of its transactions.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_camera.h"
+#include "esp_app_desc.h"
+#include "sccb_sim.h"
+#include "sensor_sim.h"
+#include "nvs_sim.h"
+#include "cam_sim.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#define CACHE_NVS "cam_boot"
+#define STATE_SIZE (65536 + 256)   // registers, then the ones behind the data port
+#define FRAME_W 64
+#define FRAME_H 48
+
+typedef struct {
+    bool setup;             // the full probe ran, with the setters
+    double delay_ms;        // time the boot slept
+    sccb_sim_stats_t bus;
+    uint8_t *regs;
+    camera_status_t status;
+    pixformat_t pixformat;
+} boot_t;
+
+static uint8_t *jpg;
+static size_t jpg_len;
+static int setup_calls;
+
+// camera_setup() in main/stream.c
+static esp_err_t StreamSetup(sensor_t *s)
+{
+    setup_calls++;
+    s->set_brightness(s, 0);     // -2 to 2
+    s->set_contrast(s, 0);       // -2 to 2
+    s->set_saturation(s, 0);     // -2 to 2
+    s->set_special_effect(s, 0); // 0 to 6 (0 - No Effect, 1 - Negative, 2 - Grayscale, etc.)
+    s->set_whitebal(s, 1);       // 0 = disable , 1 = enable
+    s->set_awb_gain(s, 1);       // 0 = disable , 1 = enable
+    s->set_wb_mode(s, 0);        // 0 to 4 - if awb_gain enabled (0 - Auto, 1 - Sunny, 2 - Cloudy, 3 - Office, 4 - Home)
+    s->set_exposure_ctrl(s, 1);  // 0 = disable , 1 = enable
+    s->set_aec2(s, 0);           // 0 = disable , 1 = enable
+    s->set_ae_level(s, 0);       // -2 to 2
+    s->set_aec_value(s, 300);    // 0 to 1200
+    s->set_gain_ctrl(s, 1);      // 0 = disable , 1 = enable
+    s->set_agc_gain(s, 0);       // 0 to 30
+    s->set_gainceiling(s, (gainceiling_t)0);  // 0 to 6
+    s->set_bpc(s, 0);            // 0 = disable , 1 = enable
+    s->set_wpc(s, 1);            // 0 = disable , 1 = enable
+    s->set_raw_gma(s, 1);        // 0 = disable , 1 = enable
+    s->set_lenc(s, 1);           // 0 = disable , 1 = enable
+    s->set_hmirror(s, 0);        // 0 = disable , 1 = enable
+    s->set_vflip(s, 0);          // 0 = disable , 1 = enable
+    s->set_dcw(s, 1);            // 0 = disable , 1 = enable
+    s->set_colorbar(s, 0);       // 0 = disable , 1 = enable
+    return ESP_OK;
+}
+
+static void SensorState(uint8_t *state)
+{
+    memcpy(state, SccbSimRegs(), 65536);
+    memcpy(state + 65536, SccbSimIndirect(), 256);
+}
+
+// Power up, init and the first frame; the camera stays up for the caller
+static bool Boot(const sensor_sim_t *def, const camera_config_t *config, boot_t *boot)
+{
+    SensorSimPowerUp(def);
+    const int calls = setup_calls;
+    const int64_t start = HostTimeUs();
+    const esp_err_t err = esp_camera_init_cached(config, CACHE_NVS, StreamSetup);
+    HOST_CHECK(err == ESP_OK);
+    if (err != ESP_OK) {
+        return false;
+    }
+    boot->bus = SccbSimStats();
+    boot->delay_ms = (HostTimeUs() - start) / 1000.0;   // the bus model takes no time of its own
+
+    CamSimWaitReady();
+    CamSimVsync();
+    CamSimFrame(jpg, jpg_len);
+    camera_fb_t *fb = esp_camera_fb_get();
+    HOST_CHECK(fb != NULL && fb->len == jpg_len);
+    if (fb) {
+        esp_camera_fb_return(fb);
+    }
+
+    const sensor_t *s = esp_camera_sensor_get();
+    boot->setup = setup_calls != calls;
+    if (!boot->regs) {
+        boot->regs = malloc(STATE_SIZE);
+    }
+    SensorState(boot->regs);
+    boot->status = s->status;
+    boot->pixformat = s->pixformat;
+    return true;
+}
+
+static void Shutdown(void)
+{
+    HOST_CHECK(esp_camera_deinit() == ESP_OK);
+}
+
+static double BootMs(const boot_t *boot)
+{
+    return boot->delay_ms + boot->bus.bus_us / 1000.0;
+}
+
+static void PrintBoot(const char *name, const char *path, const boot_t *boot)
+{
+    printf("%-8s %-12s %6u %6u %9.2f %9.2f %9.2f\n", name, path, (unsigned)boot->bus.reads,
+           (unsigned)boot->bus.writes, boot->delay_ms, boot->bus.bus_us / 1000.0, BootMs(boot));
+}
+
+// Cold start, then a warm start from the cache: same sensor state, no setters
+static void CheckCached(const sensor_sim_t *def)
+{
+    const camera_config_t config = SensorSimStreamConfig();
+    boot_t full = { 0 }, cached = { 0 };
+    uint8_t *full_vga = malloc(STATE_SIZE);
+    uint8_t *state = malloc(STATE_SIZE);
+    NvsSimErase();
+
+    if (Boot(def, &config, &full)) {
+        HOST_CHECK(full.setup);
+        size_t len = 0;
+        HOST_CHECK(NvsSimValue(CACHE_NVS, "boot", &len) != NULL && len > 0);
+        // A mode switch after boot, the driver must be in the same state either way
+        sensor_t *s = esp_camera_sensor_get();
+        HOST_CHECK(s->set_framesize(s, FRAMESIZE_VGA) == 0);
+        SensorState(full_vga);
+        Shutdown();
+    }
+
+    NvsSimClearStats();
+    if (full.regs && Boot(def, &config, &cached)) {
+        HOST_CHECK(!cached.setup);
+        HOST_CHECK(memcmp(full.regs, cached.regs, STATE_SIZE) == 0);
+        HOST_CHECK(memcmp(&full.status, &cached.status, sizeof(camera_status_t)) == 0);
+        HOST_CHECK(full.pixformat == cached.pixformat);
+        sensor_t *s = esp_camera_sensor_get();
+        HOST_CHECK(s->set_framesize(s, FRAMESIZE_VGA) == 0);
+        SensorState(state);
+        HOST_CHECK(memcmp(state, full_vga, STATE_SIZE) == 0);
+        Shutdown();
+
+        const nvs_sim_stats_t nvs = NvsSimStats();
+        HOST_CHECK(nvs.writes == 0 && nvs.commits == 0);
+
+        PrintBoot(def->name, "full probe", &full);
+        PrintBoot("", "cached", &cached);
+        HOST_CHECK(cached.bus.writes < full.bus.writes && cached.bus.reads < full.bus.reads);
+        // The replay keeps the order of the log, DSP reset pulses and table rewrites included
+        HOST_CHECK(BootMs(&cached) * 3 < BootMs(&full) * 2);
+    }
+    HOST_CHECK(NvsSimOpenHandles() == 0);
+    free(full.regs);
+    free(cached.regs);
+    free(full_vga);
+    free(state);
+}
+
+// Anything that does not match takes the full probe and records a new cache
+static void CheckFallback(void)
+{
+    camera_config_t config = SensorSimStreamConfig();
+    boot_t boot = { 0 };
+    NvsSimErase();
+    if (Boot(&sensor_sim_ov3660, &config, &boot)) {
+        Shutdown();
+    }
+
+    // Another frame size
+    config.frame_size = FRAMESIZE_SVGA;
+    if (Boot(&sensor_sim_ov3660, &config, &boot)) {
+        HOST_CHECK(boot.setup && boot.status.framesize == FRAMESIZE_SVGA);
+        Shutdown();
+    }
+    if (Boot(&sensor_sim_ov3660, &config, &boot)) {
+        HOST_CHECK(!boot.setup && boot.status.framesize == FRAMESIZE_SVGA);
+        Shutdown();
+    }
+
+    // The camera module was swapped for one with another sensor
+    if (Boot(&sensor_sim_ov2640, &config, &boot)) {
+        HOST_CHECK(boot.setup && esp_camera_sensor_get()->id.PID == OV2640_PID);
+        Shutdown();
+    }
+    if (Boot(&sensor_sim_ov2640, &config, &boot)) {
+        HOST_CHECK(!boot.setup);
+        Shutdown();
+    }
+
+    // A firmware update, maybe with other register tables or setup
+    host_app_desc.app_elf_sha256[0] ^= 0x5a;
+    if (Boot(&sensor_sim_ov2640, &config, &boot)) {
+        HOST_CHECK(boot.setup);
+        Shutdown();
+    }
+    if (Boot(&sensor_sim_ov2640, &config, &boot)) {
+        HOST_CHECK(!boot.setup);
+        Shutdown();
+    }
+
+    // A cache of another layout, e.g. from an older firmware
+    NvsSimCorrupt(CACHE_NVS, "boot", 0, 0x80);
+    if (Boot(&sensor_sim_ov2640, &config, &boot)) {
+        HOST_CHECK(boot.setup);
+        Shutdown();
+    }
+    if (Boot(&sensor_sim_ov2640, &config, &boot)) {
+        HOST_CHECK(!boot.setup);
+        Shutdown();
+    }
+    HOST_CHECK(NvsSimOpenHandles() == 0);
+    free(boot.regs);
+}
+
+int main(void)
+{
+    uint8_t *gray = malloc(FRAME_W * FRAME_H);
+    for (int i = 0; i < FRAME_W * FRAME_H; i++) {
+        gray[i] = i * 7;
+    }
+    HOST_CHECK(fmt2jpg(gray, FRAME_W * FRAME_H, FRAME_W, FRAME_H, PIXFORMAT_GRAYSCALE, 50, &jpg, &jpg_len));
+    free(gray);
+
+    printf("%-8s %-12s %6s %6s %9s %9s %9s\n", "", "init to frame", "reads", "writes", "delay ms", "bus ms", "total ms");
+    CheckCached(&sensor_sim_ov3660);
+    CheckCached(&sensor_sim_ov2640);
+    CheckFallback();
+
+    free(jpg);
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
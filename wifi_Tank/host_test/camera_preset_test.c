@@ -0,0 +1,271 @@
+/*! \file camera_preset_test.c
+\brief Sensor presets of esp_camera.c and the NVS settings they grew out of,
+on the host models of the sensor bus (sccb_sim.c) and NVS (nvs_sim.c).
+esp_camera_save_to_nvs() must commit and close its handle. Presets must
+survive a restart, switch without touching NVS, and leave the sensor with the
+registers the one-by-one setters of esp_camera_load_from_nvs() used to give
+it. The table shows the bus cost of a switch both ways.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_camera.h"
+#include "sccb_sim.h"
+#include "sensor_sim.h"
+#include "nvs_sim.h"
+#include "host_util.h"
+
+#define PRESET_NVS "cam_preset"
+#define SETTINGS_NVS "cam_cfg"
+#define STATE_SIZE (65536 + 256)   // registers, then the ones behind the data port
+#define PRESET_HEADER 3
+#define PRESET_SIZE 44      // name, pixel format, frame size and 26 bytes of settings
+
+typedef struct {
+    const char *name;
+    camera_status_t status;
+    pixformat_t pixformat;
+} preset_t;
+
+static sensor_t *CameraUp(const sensor_sim_t *def)
+{
+    SensorSimPowerUp(def);
+    const camera_config_t config = SensorSimStreamConfig();
+    HOST_CHECK(esp_camera_init(&config) == ESP_OK);
+    return esp_camera_sensor_get();
+}
+
+// Registers and the ones behind the data port. The port registers themselves are left
+// wherever the last indirect access had them, which depends on the order of the setters.
+static void SensorState(const sensor_sim_t *def, uint8_t *state)
+{
+    memcpy(state, SccbSimRegs(), 65536);
+    memcpy(state + 65536, SccbSimIndirect(), 256);
+    if (def->port_addr >= 0) {
+        state[def->port_addr] = state[def->port_data] = 0;
+    }
+}
+
+static void CameraDown(void)
+{
+    HOST_CHECK(esp_camera_deinit() == ESP_OK);
+}
+
+// The presets main/stream.c starts with
+static void MakePresets(const sensor_t *s, preset_t presets[3])
+{
+    presets[0] = (preset_t){ "day-drive", s->status, s->pixformat };
+    presets[1] = presets[0];
+    presets[1].name = "night";
+    presets[1].status.brightness = 1;
+    presets[1].status.ae_level = 2;
+    presets[1].status.aec2 = 1;
+    presets[1].status.gainceiling = GAINCEILING_64X;
+    presets[1].status.bpc = 1;
+    presets[2] = presets[0];
+    presets[2].name = "low-bandwidth";
+    presets[2].status.framesize = FRAMESIZE_VGA;
+    presets[2].status.quality = 20;
+}
+
+// What esp_camera_load_from_nvs() did: every setter, whatever the sensor had
+static void SetOneByOne(sensor_t *s, const camera_status_t *st, pixformat_t pf)
+{
+    s->set_ae_level(s, st->ae_level);
+    s->set_aec2(s, st->aec2);
+    s->set_aec_value(s, st->aec_value);
+    s->set_agc_gain(s, st->agc_gain);
+    s->set_awb_gain(s, st->awb_gain);
+    s->set_bpc(s, st->bpc);
+    s->set_brightness(s, st->brightness);
+    s->set_colorbar(s, st->colorbar);
+    s->set_contrast(s, st->contrast);
+    s->set_dcw(s, st->dcw);
+    s->set_denoise(s, st->denoise);
+    s->set_exposure_ctrl(s, st->aec);
+    s->set_framesize(s, st->framesize);
+    s->set_gain_ctrl(s, st->agc);
+    s->set_gainceiling(s, st->gainceiling);
+    s->set_hmirror(s, st->hmirror);
+    s->set_lenc(s, st->lenc);
+    s->set_quality(s, st->quality);
+    s->set_raw_gma(s, st->raw_gma);
+    s->set_saturation(s, st->saturation);
+    s->set_sharpness(s, st->sharpness);
+    s->set_special_effect(s, st->special_effect);
+    s->set_vflip(s, st->vflip);
+    s->set_wb_mode(s, st->wb_mode);
+    s->set_whitebal(s, st->awb);
+    s->set_wpc(s, st->wpc);
+    s->set_pixformat(s, pf);
+}
+
+static bool SameStatus(const camera_status_t *a, const camera_status_t *b)
+{
+    camera_status_t x = *a, y = *b;
+    x.scale = y.scale = false;
+    x.binning = y.binning = false;
+    return memcmp(&x, &y, sizeof(x)) == 0;
+}
+
+static void PrintSwitch(const char *sensor, const char *to, const char *how, sccb_sim_stats_t s)
+{
+    printf("%-8s %-14s %-10s %6u %6u %8.2f\n", sensor, to, how, (unsigned)s.writes, (unsigned)s.values,
+           s.bus_us / 1000.0);
+}
+
+// The settings esp_camera_save_to_nvs() stores are committed and read back
+static void CheckSettings(void)
+{
+    NvsSimErase();
+    sensor_t *s = CameraUp(&sensor_sim_ov3660);
+    s->set_brightness(s, 2);
+    s->set_vflip(s, 1);
+    HOST_CHECK(esp_camera_save_to_nvs(SETTINGS_NVS) == ESP_OK);
+    const nvs_sim_stats_t nvs = NvsSimStats();
+    HOST_CHECK(nvs.commits == 1 && nvs.lost == 0);
+    HOST_CHECK(NvsSimOpenHandles() == 0);
+    size_t len = 0;
+    HOST_CHECK(NvsSimValue(SETTINGS_NVS, "sensor", &len) != NULL && len == sizeof(camera_status_t));
+    CameraDown();
+
+    s = CameraUp(&sensor_sim_ov3660);
+    HOST_CHECK(s->status.brightness == 0);
+    HOST_CHECK(esp_camera_load_from_nvs(SETTINGS_NVS) == ESP_OK);
+    HOST_CHECK(s->status.brightness == 2 && s->status.vflip == 1);
+    HOST_CHECK(esp_camera_load_from_nvs("nothing_here") != ESP_OK);
+    HOST_CHECK(NvsSimOpenHandles() == 0);
+    CameraDown();
+}
+
+// From the same start, every switch gives the registers the one-by-one setters give. The
+// start is set up one by one as well: the drivers' status claims settings their init
+// tables never wrote (sharpness, denoise), a preset leaves those as they are.
+static void CheckSwitch(const sensor_sim_t *def)
+{
+    NvsSimErase();
+    sensor_t *s = CameraUp(def);
+    preset_t presets[3];
+    MakePresets(s, presets);
+    for (int i = 0; i < 3; i++) {
+        HOST_CHECK(esp_camera_preset_save(PRESET_NVS, presets[i].name, &presets[i].status,
+                                          presets[i].pixformat) == ESP_OK);
+    }
+    size_t len = 0;
+    HOST_CHECK(NvsSimValue(PRESET_NVS, "presets", &len) != NULL && len == PRESET_HEADER + 3 * PRESET_SIZE);
+    HOST_CHECK(NvsSimStats().commits == 3 && NvsSimOpenHandles() == 0);
+    CameraDown();
+
+    // The store is read once, switches after that are RAM and bus only
+    static const int order[] = { 1, 2, 0, 1, 0 };
+    uint8_t *want = malloc(STATE_SIZE);
+    uint8_t *got = malloc(STATE_SIZE);
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        const preset_t *from = &presets[i ? order[i - 1] : 0];
+        const preset_t *to = &presets[order[i]];
+
+        s = CameraUp(def);
+        SetOneByOne(s, &from->status, from->pixformat);
+        SccbSimClearStats();
+        SetOneByOne(s, &to->status, to->pixformat);
+        const sccb_sim_stats_t one_by_one = SccbSimStats();
+        SensorState(def, want);
+        CameraDown();
+
+        s = CameraUp(def);
+        SetOneByOne(s, &from->status, from->pixformat);
+        camera_status_t st;
+        pixformat_t pf;
+        HOST_CHECK(esp_camera_preset_get(PRESET_NVS, from->name, &st, &pf) == ESP_OK);
+        NvsSimClearStats();
+        SccbSimClearStats();
+        HOST_CHECK(esp_camera_preset_apply(PRESET_NVS, to->name) == ESP_OK);
+        const sccb_sim_stats_t batched = SccbSimStats();
+        HOST_CHECK(NvsSimStats().reads == 0 && NvsSimStats().opens == 0);
+        HOST_CHECK(SameStatus(&s->status, &to->status) && s->pixformat == to->pixformat);
+        SensorState(def, got);
+        if (memcmp(got, want, STATE_SIZE) != 0) {
+            printf("%s %s -> %s: registers differ\n", def->name, from->name, to->name);
+        }
+        HOST_CHECK(memcmp(got, want, STATE_SIZE) == 0);
+        CameraDown();
+
+        PrintSwitch(i ? "" : def->name, to->name, "one by one", one_by_one);
+        PrintSwitch("", "", "preset", batched);
+        HOST_CHECK(batched.writes < one_by_one.writes && batched.bus_us < one_by_one.bus_us);
+    }
+    free(want);
+    free(got);
+}
+
+// Saving, replacing and deleting presets, and what a broken store falls back to
+static void CheckStore(void)
+{
+    NvsSimErase();
+    sensor_t *s = CameraUp(&sensor_sim_ov3660);
+    preset_t presets[3];
+    MakePresets(s, presets);
+    camera_status_t st;
+    pixformat_t pf;
+
+    HOST_CHECK(esp_camera_preset_get(PRESET_NVS, "night", &st, &pf) == ESP_ERR_NOT_FOUND);
+    HOST_CHECK(esp_camera_preset_apply(PRESET_NVS, "night") == ESP_ERR_NOT_FOUND);
+    HOST_CHECK(esp_camera_preset_save(PRESET_NVS, "a-name-too-long", &presets[0].status, PIXFORMAT_JPEG) == ESP_OK);
+    HOST_CHECK(esp_camera_preset_save(PRESET_NVS, "a-name-too-long!", &presets[0].status, PIXFORMAT_JPEG) ==
+               ESP_ERR_INVALID_ARG);
+    HOST_CHECK(esp_camera_preset_save(PRESET_NVS, "", &presets[0].status, PIXFORMAT_JPEG) == ESP_ERR_INVALID_ARG);
+    HOST_CHECK(esp_camera_preset_delete(PRESET_NVS, "a-name-too-long") == ESP_OK);
+    for (int i = 0; i < 3; i++) {
+        HOST_CHECK(esp_camera_preset_save(PRESET_NVS, presets[i].name, &presets[i].status,
+                                          presets[i].pixformat) == ESP_OK);
+    }
+
+    // Replaced in place
+    presets[1].status.brightness = 2;
+    HOST_CHECK(esp_camera_preset_save(PRESET_NVS, "night", &presets[1].status, presets[1].pixformat) == ESP_OK);
+    size_t len = 0;
+    HOST_CHECK(NvsSimValue(PRESET_NVS, "presets", &len) != NULL && len == PRESET_HEADER + 3 * PRESET_SIZE);
+
+    // Up to 8 per namespace
+    char name[16];
+    for (int i = 3; i < 8; i++) {
+        snprintf(name, sizeof(name), "extra-%d", i);
+        HOST_CHECK(esp_camera_preset_save(PRESET_NVS, name, &presets[0].status, PIXFORMAT_JPEG) == ESP_OK);
+    }
+    HOST_CHECK(esp_camera_preset_save(PRESET_NVS, "one-more", &presets[0].status, PIXFORMAT_JPEG) == ESP_ERR_NO_MEM);
+    HOST_CHECK(esp_camera_preset_delete(PRESET_NVS, "day-drive") == ESP_OK);
+    HOST_CHECK(esp_camera_preset_delete(PRESET_NVS, "day-drive") == ESP_ERR_NOT_FOUND);
+    CameraDown();
+
+    // After a restart, from NVS
+    s = CameraUp(&sensor_sim_ov3660);
+    HOST_CHECK(esp_camera_preset_get(PRESET_NVS, "day-drive", &st, &pf) == ESP_ERR_NOT_FOUND);
+    for (int i = 1; i < 3; i++) {
+        HOST_CHECK(esp_camera_preset_get(PRESET_NVS, presets[i].name, &st, &pf) == ESP_OK);
+        HOST_CHECK(SameStatus(&st, &presets[i].status) && pf == presets[i].pixformat);
+    }
+    HOST_CHECK(esp_camera_preset_get(PRESET_NVS, "extra-7", &st, &pf) == ESP_OK);
+    HOST_CHECK(esp_camera_preset_apply(PRESET_NVS, "night") == ESP_OK);
+    HOST_CHECK(s->status.brightness == 2 && s->status.bpc == 1);
+    CameraDown();
+
+    // A store of another layout is dropped, not misread
+    NvsSimCorrupt(PRESET_NVS, "presets", 0, 0x80);
+    s = CameraUp(&sensor_sim_ov3660);
+    HOST_CHECK(esp_camera_preset_get(PRESET_NVS, "night", &st, &pf) == ESP_ERR_NOT_FOUND);
+    HOST_CHECK(esp_camera_preset_save(PRESET_NVS, "night", &presets[1].status, presets[1].pixformat) == ESP_OK);
+    HOST_CHECK(NvsSimValue(PRESET_NVS, "presets", &len) != NULL && len == PRESET_HEADER + PRESET_SIZE);
+    CameraDown();
+    HOST_CHECK(NvsSimOpenHandles() == 0);
+}
+
+int main(void)
+{
+    CheckSettings();
+    printf("%-8s %-14s %-10s %6s %6s %8s\n", "", "switch to", "", "writes", "values", "bus ms");
+    CheckSwitch(&sensor_sim_ov3660);
+    CheckSwitch(&sensor_sim_ov2640);
+    CheckStore();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+/*! \file clip_bench.c
+\brief Cost of writing a recorder clip on the NOR flash model
+(partition_sim.c): ClipWriter (64 kB block erases ahead of 16 kB writes from
+an internal RAM stage, the index once after the frames) against a plain
+writer that erases the sectors each frame needs, writes the frame as it is
+and its index entry after it. Both write the same HD sized frames into the
+recorder partition of partitions.csv; the flash time is the model's, with
+the typical times of a 4 MB SPI NOR part. Also the time ClipScan() and
+ClipVerify() take to find and check the clips.
+
+Usage: clip_bench [clips] [frames]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clip.h"
+#include "partition_sim.h"
+#include "host_util.h"
+
+#define PART_SIZE 0x1F0000      // partitions.csv
+#define MIN_FRAME (56 * 1024)   // HD frames at the firmware's JPEG quality
+#define MAX_FRAME (96 * 1024)
+
+static uint32_t rng = 11;
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static size_t MakeFrame(uint8_t *buf)
+{
+    const size_t len = MIN_FRAME + Random() % (MAX_FRAME - MIN_FRAME);
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)Random();
+    }
+    buf[0] = 0xff;
+    buf[1] = 0xd8;
+    buf[len - 2] = 0xff;
+    buf[len - 1] = 0xd9;
+    return len;
+}
+
+// The plain writer: per frame the erases it needs, the frame, then its index entry
+typedef struct {
+    const esp_partition_t *part;
+    uint32_t start;
+    uint32_t data_end;
+    uint32_t index_end;
+    uint32_t erased_end;
+    uint32_t count;
+} plain_writer_t;
+
+static esp_err_t PlainErase(plain_writer_t *w, uint32_t end)
+{
+    esp_err_t err = ESP_OK;
+    while (w->erased_end < end && err == ESP_OK) {
+        err = esp_partition_erase_range(w->part, w->erased_end, CLIP_SECTOR);
+        w->erased_end += CLIP_SECTOR;
+    }
+    return err;
+}
+
+static esp_err_t PlainAdd(plain_writer_t *w, const uint8_t *jpg, size_t len, int64_t time_us, uint32_t sequence)
+{
+    const clip_entry_t e = { .offset = w->data_end, .len = len, .time_us = time_us, .sequence = sequence };
+    esp_err_t err = PlainErase(w, w->start + w->data_end + len);
+    if (err == ESP_OK) {
+        err = esp_partition_write(w->part, w->start + w->data_end, jpg, len);
+    }
+    w->data_end += len;
+    // the index grows down from the end of the clip
+    w->index_end -= sizeof(e);
+    if (err == ESP_OK) {
+        err = PlainErase(w, w->start + w->index_end + sizeof(e));
+    }
+    if (err == ESP_OK) {
+        err = esp_partition_write(w->part, w->start + w->index_end, &e, sizeof(e));
+    }
+    w->count++;
+    return err;
+}
+
+typedef struct {
+    double host_ms;
+    size_t bytes;
+    partition_sim_stats_t flash;
+} run_t;
+
+static void Print(const char *name, const run_t *r)
+{
+    printf("%-12s %7.1f MB/s host %8.0f ms flash %6u writes %7u pages %5u sectors %3u blocks\n", name,
+           r->bytes / (r->host_ms * 1000.0), r->flash.flash_ms, r->flash.writes, r->flash.pages, r->flash.sectors,
+           r->flash.blocks);
+}
+
+int main(int argc, char **argv)
+{
+    const int clips = argc > 1 ? atoi(argv[1]) : 20;
+    const uint32_t frames = argc > 2 ? (uint32_t)atoi(argv[2]) : 20;
+    uint8_t **jpg = malloc(frames * sizeof(uint8_t *));
+    size_t *len = malloc(frames * sizeof(size_t));
+    size_t bytes = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        jpg[i] = malloc(MAX_FRAME);
+        len[i] = MakeFrame(jpg[i]);
+        bytes += len[i];
+    }
+    printf("%d clips of %u frames, %u kB each, into a %u kB partition\n\n", clips, frames,
+           (unsigned)(bytes / 1024), PART_SIZE / 1024);
+
+    // ClipWriter, wrapping through the partition
+    PartitionSimCreate("recorder", PART_SIZE);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    run_t staged = { 0 };
+    int64_t t0 = HostTimeUs();
+    for (int c = 0; c < clips; c++) {
+        clip_writer_t w;
+        HOST_CHECK(ClipWriterBegin(&w, part, bytes, frames, c) == ESP_OK);
+        for (uint32_t i = 0; i < frames; i++) {
+            HOST_CHECK(ClipWriterAdd(&w, jpg[i], len[i], i * 200000LL, i) == ESP_OK);
+        }
+        HOST_CHECK(ClipWriterFinish(&w, NULL) == ESP_OK);
+    }
+    staged.host_ms = (HostTimeUs() - t0) / 1000.0;
+    staged.bytes = bytes * clips;
+    staged.flash = PartitionSimStats();
+    HOST_CHECK(staged.flash.unerased == 0);
+
+    // finding the clips after a reboot and checking the newest
+    clip_info_t found[16];
+    PartitionSimClearStats();
+    t0 = HostTimeUs();
+    const int n = ClipScan(part, found, 16);
+    const double scan_ms = (HostTimeUs() - t0) / 1000.0;
+    const partition_sim_stats_t scan = PartitionSimStats();
+    PartitionSimClearStats();
+    t0 = HostTimeUs();
+    HOST_CHECK(n > 0 && ClipVerify(part, &found[n - 1]) == ESP_OK);
+    const double verify_ms = (HostTimeUs() - t0) / 1000.0;
+    const partition_sim_stats_t verify = PartitionSimStats();
+
+    // The plain writer, clip after clip the same way
+    PartitionSimCreate("recorder", PART_SIZE);
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "recorder");
+    const uint32_t size = ClipSize(bytes, frames);
+    run_t plain = { 0 };
+    uint32_t start = 0;
+    t0 = HostTimeUs();
+    for (int c = 0; c < clips; c++) {
+        if (start + size > PART_SIZE) {
+            start = 0;
+        }
+        plain_writer_t w = { .part = part, .start = start, .data_end = CLIP_SECTOR, .index_end = size,
+                             .erased_end = start };
+        for (uint32_t i = 0; i < frames; i++) {
+            HOST_CHECK(PlainAdd(&w, jpg[i], len[i], i * 200000LL, i) == ESP_OK);
+        }
+        const clip_header_t h = { .magic = CLIP_MAGIC, .frame_count = frames };
+        HOST_CHECK(esp_partition_write(part, start, &h, sizeof(h)) == ESP_OK);
+        start += size;
+    }
+    plain.host_ms = (HostTimeUs() - t0) / 1000.0;
+    plain.bytes = bytes * clips;
+    plain.flash = PartitionSimStats();
+    HOST_CHECK(plain.flash.unerased == 0);
+
+    Print("ClipWriter", &staged);
+    Print("plain", &plain);
+    printf("\nflash time per clip: %.0f ms against %.0f ms (%.2fx), %.0f against %.0f kB/s\n",
+           staged.flash.flash_ms / clips, plain.flash.flash_ms / clips, plain.flash.flash_ms / staged.flash.flash_ms,
+           staged.bytes / staged.flash.flash_ms * 1000.0 / 1024, plain.bytes / plain.flash.flash_ms * 1000.0 / 1024);
+    printf("ClipScan: %d clips in %.2f ms host, %.0f ms flash (%u reads)\n", n, scan_ms, scan.flash_ms, scan.reads);
+    printf("ClipVerify: %u kB in %.2f ms host, %.0f ms flash (%u reads)\n",
+           (unsigned)(found[n - 1].header.data_size / 1024), verify_ms, verify.flash_ms, verify.reads);
+
+    PartitionSimDestroy();
+    for (uint32_t i = 0; i < frames; i++) {
+        free(jpg[i]);
+    }
+    free(jpg);
+    free(len);
+    return host_failures ? 1 : 0;
+}
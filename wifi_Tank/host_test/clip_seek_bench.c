@@ -0,0 +1,199 @@
+/*! \file clip_seek_bench.c
+\brief Seek latency in a long synthetic recording on the flash model
+(partition_sim.c): ClipSeek(), a binary search of the clip index, against a
+linear scan of the index and against frames stored back to back without an
+index, where the frame at a time is found by counting SOI markers from the
+start (the frame rate being known). Frames are small JPEG-like blocks
+without FF bytes inside, as the entropy coded data of a JPEG has none, so a
+count of FF D8 finds them. Reported per seek: host time, flash reads and the
+modelled flash time of the reads at the typical 4 MB SPI NOR speed.
+
+Usage: clip_seek_bench [frames] [seeks]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clip.h"
+#include "partition_sim.h"
+#include "host_util.h"
+
+#define FPS 5
+#define MIN_FRAME 1024
+#define MAX_FRAME 3072
+#define THUMB_EVERY FPS         // a thumbnail a second
+#define THUMB_SIZE 256
+#define SCAN_CHUNK 4096         // bytes per read of the scans
+#define INDEX_CHUNK 32          // entries per read of the linear index scan
+#define RAW_SEEKS 20            // the scan without an index reads the recording up to the frame
+
+static uint32_t rng = 3;
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+static size_t MakeFrame(uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(Random() % 255);      // no FF
+    }
+    buf[0] = 0xff;
+    buf[1] = 0xd8;
+    buf[len - 2] = 0xff;
+    buf[len - 1] = 0xd9;
+    return len;
+}
+
+static int64_t FrameTime(uint32_t i)
+{
+    return 1000000 + i * (1000000LL / FPS);
+}
+
+// The last entry at or before the time, reading the index from the start
+static uint32_t LinearSeek(const esp_partition_t *part, const clip_info_t *clip, int64_t time_us)
+{
+    clip_entry_t chunk[INDEX_CHUNK];
+    uint32_t found = 0;
+    for (uint32_t i = 0; i < clip->header.frame_count; i += INDEX_CHUNK) {
+        const uint32_t n = clip->header.frame_count - i < INDEX_CHUNK ? clip->header.frame_count - i : INDEX_CHUNK;
+        ClipReadEntries(part, clip, i, chunk, n);
+        for (uint32_t k = 0; k < n; k++) {
+            if (chunk[k].time_us > time_us) {
+                return found;
+            }
+            if (!(chunk[k].flags & CLIP_ENTRY_THUMB)) {
+                found = i + k;
+            }
+        }
+    }
+    return found;
+}
+
+// Offset of the frame at the time in frames stored back to back, by counting SOI markers
+static uint32_t RawSeek(const esp_partition_t *part, uint32_t start, uint32_t size, int64_t time_us)
+{
+    // the frames before it, and the thumbnails that follow some of them
+    int64_t k = time_us < FrameTime(0) ? 0 : (time_us - FrameTime(0)) / (1000000LL / FPS);
+    k += (k + THUMB_EVERY - 1) / THUMB_EVERY;
+    uint8_t buf[SCAN_CHUNK + 1];
+    int64_t seen = -1;
+    uint8_t prev = 0;
+    for (uint32_t at = 0; at < size; at += SCAN_CHUNK) {
+        const uint32_t n = size - at < SCAN_CHUNK ? size - at : SCAN_CHUNK;
+        esp_partition_read(part, start + at, buf, n);
+        for (uint32_t i = 0; i < n; i++) {
+            if (prev == 0xff && buf[i] == 0xd8 && ++seen == k) {
+                return at + i - 1;
+            }
+            prev = buf[i];
+        }
+    }
+    return UINT32_MAX;
+}
+
+typedef struct {
+    double host_us;
+    uint32_t reads;
+    double flash_ms;
+    uint32_t seeks;
+} seek_stats_t;
+
+static void Add(seek_stats_t *s, int64_t t0)
+{
+    const partition_sim_stats_t st = PartitionSimStats();
+    s->host_us += HostTimeUs() - t0;
+    s->reads += st.reads;
+    s->flash_ms += st.flash_ms;
+    s->seeks++;
+}
+
+static void Print(const char *name, const seek_stats_t *s)
+{
+    printf("%-22s %10.2f us host %9.1f reads %10.2f ms flash\n", name, s->host_us / s->seeks,
+           (double)s->reads / s->seeks, s->flash_ms / s->seeks);
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t frames = argc > 1 ? (uint32_t)atoi(argv[1]) : 36000;
+    const int seeks = argc > 2 ? atoi(argv[2]) : 2000;
+    const uint32_t thumbs = (frames + THUMB_EVERY - 1) / THUMB_EVERY;
+
+    // The recording: sizes first, the writer reserves the clip up front
+    uint32_t *len = malloc(frames * sizeof(uint32_t));
+    uint32_t data_size = thumbs * THUMB_SIZE;
+    for (uint32_t i = 0; i < frames; i++) {
+        len[i] = MIN_FRAME + Random() % (MAX_FRAME - MIN_FRAME);
+        data_size += len[i];
+    }
+    const uint32_t size = ClipSize(data_size, frames + thumbs);
+    PartitionSimCreate("recorder", size);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    uint8_t *frame = malloc(MAX_FRAME);
+    clip_writer_t w;
+    clip_info_t clip;
+    int64_t t0 = HostTimeUs();
+    HOST_CHECK(ClipWriterBegin(&w, part, data_size, frames + thumbs, 0) == ESP_OK);
+    for (uint32_t i = 0; i < frames; i++) {
+        HOST_CHECK(ClipWriterAdd(&w, frame, MakeFrame(frame, len[i]), FrameTime(i), i) == ESP_OK);
+        if (i % THUMB_EVERY == 0) {
+            HOST_CHECK(ClipWriterAddThumb(&w, frame, MakeFrame(frame, THUMB_SIZE)) == ESP_OK);
+        }
+    }
+    HOST_CHECK(ClipWriterFinish(&w, &clip) == ESP_OK);
+    const double write_ms = (HostTimeUs() - t0) / 1000.0;
+    printf("%u frames (%.1f h at %d fps) and %u thumbnails, %u MB, written in %.0f ms host\n\n", frames,
+           frames / (FPS * 3600.0), FPS, thumbs, data_size >> 20, write_ms);
+
+    seek_stats_t binary = { 0 }, thumb = { 0 }, linear = { 0 }, raw = { 0 };
+    const int64_t span_us = FrameTime(frames - 1) - FrameTime(0);
+    for (int s = 0; s < seeks; s++) {
+        const int64_t t = FrameTime(0) + (int64_t)((double)Random() / UINT32_MAX * span_us);
+        uint32_t index;
+        clip_entry_t e, found;
+        PartitionSimClearStats();
+        t0 = HostTimeUs();
+        HOST_CHECK(ClipSeek(part, &clip, t, false, &index, &e) == ESP_OK);
+        Add(&binary, t0);
+        HOST_CHECK(!(e.flags & CLIP_ENTRY_THUMB) && e.time_us <= t && t - e.time_us < 1000000 / FPS);
+        found = e;
+
+        PartitionSimClearStats();
+        t0 = HostTimeUs();
+        HOST_CHECK(ClipSeek(part, &clip, t, true, NULL, &e) == ESP_OK);
+        Add(&thumb, t0);
+        HOST_CHECK((e.flags & CLIP_ENTRY_THUMB) && t - e.time_us < 1000000);
+
+        if (s < seeks / 10) {
+            PartitionSimClearStats();
+            t0 = HostTimeUs();
+            HOST_CHECK(LinearSeek(part, &clip, t) == index);
+            Add(&linear, t0);
+        }
+        if (s < RAW_SEEKS) {
+            // the frames of the clip as if they had no index
+            PartitionSimClearStats();
+            t0 = HostTimeUs();
+            const uint32_t at = RawSeek(part, clip.offset + CLIP_SECTOR, clip.header.data_size, t);
+            Add(&raw, t0);
+            HOST_CHECK(at == found.offset - CLIP_SECTOR);
+        }
+    }
+    Print("ClipSeek", &binary);
+    Print("ClipSeek, thumbnail", &thumb);
+    Print("linear index scan", &linear);
+    Print("no index, SOI count", &raw);
+    printf("\nClipSeek against the linear index scan %.0fx, against no index %.0fx in flash time\n",
+           (linear.flash_ms / linear.seeks) / (binary.flash_ms / binary.seeks),
+           (raw.flash_ms / raw.seeks) / (binary.flash_ms / binary.seeks));
+
+    PartitionSimDestroy();
+    free(frame);
+    free(len);
+    return host_failures ? 1 : 0;
+}
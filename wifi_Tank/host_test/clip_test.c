@@ -0,0 +1,310 @@
+/*! \file clip_test.c
+\brief main/clip.c on the NOR flash model (partition_sim.c): clips read back
+as written, the oldest give way when the partition wraps, and a power cut at
+every write and erase of a clip leaves only intact clips, the ones it did not
+overlap among them. ClipSeek() finds what a linear search of the index finds,
+frames and thumbnails, in O(log n) reads.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clip.h"
+#include "partition_sim.h"
+#include "host_util.h"
+
+#define PART_SIZE (1024 * 1024)
+#define MAX_CLIPS 64
+#define MAX_FRAME (48 * 1024)
+
+static uint32_t rng = 7;
+
+static uint32_t Random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return rng;
+}
+
+// A JPEG-like frame whose bytes follow from its sequence number
+static size_t MakeFrame(uint32_t sequence, uint8_t *buf)
+{
+    uint32_t state = sequence * 2654435761u + 1;
+    const size_t len = 4096 + sequence * 7919 % (MAX_FRAME - 4096);
+    buf[0] = 0xff;
+    buf[1] = 0xd8;
+    for (size_t i = 2; i < len - 2; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        buf[i] = (uint8_t)state;
+    }
+    buf[len - 2] = 0xff;
+    buf[len - 1] = 0xd9;
+    return len;
+}
+
+static size_t FrameLen(uint32_t sequence)
+{
+    return 4096 + sequence * 7919 % (MAX_FRAME - 4096);
+}
+
+// A clip of frames first..first+count-1, captured 100 ms apart
+static esp_err_t WriteClip(const esp_partition_t *part, uint32_t first, uint32_t count, clip_info_t *info)
+{
+    uint32_t bytes = 0;
+    for (uint32_t s = first; s < first + count; s++) {
+        bytes += FrameLen(s);
+    }
+    uint8_t *frame = malloc(MAX_FRAME);
+    clip_writer_t w;
+    esp_err_t err = ClipWriterBegin(&w, part, bytes, count, first * 100000LL);
+    for (uint32_t s = first; s < first + count && err == ESP_OK; s++) {
+        const size_t len = MakeFrame(s, frame);
+        err = ClipWriterAdd(&w, frame, len, s * 100000LL, s);
+    }
+    if (err == ESP_OK) {
+        err = ClipWriterFinish(&w, info);
+    } else {
+        ClipWriterAbort(&w);
+    }
+    free(frame);
+    return err;
+}
+
+// Every frame of the clip is the one written, at its time
+static bool ClipMatches(const esp_partition_t *part, const clip_info_t *clip)
+{
+    const uint32_t count = clip->header.frame_count;
+    clip_entry_t *entries = malloc(count * sizeof(clip_entry_t));
+    uint8_t *want = malloc(MAX_FRAME);
+    uint8_t *got = malloc(MAX_FRAME);
+    bool ok = ClipReadEntries(part, clip, 0, entries, count) == ESP_OK && ClipVerify(part, clip) == ESP_OK;
+    for (uint32_t i = 0; i < count && ok; i++) {
+        const size_t len = MakeFrame(entries[i].sequence, want);
+        ok = entries[i].len == len && entries[i].time_us == entries[i].sequence * 100000LL
+             && ClipReadFrame(part, clip, &entries[i], got) == ESP_OK && memcmp(want, got, len) == 0;
+    }
+    free(entries);
+    free(want);
+    free(got);
+    return ok;
+}
+
+static void CheckRoundTrip(void)
+{
+    PartitionSimCreate("recorder", PART_SIZE);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    HOST_CHECK(part != NULL);
+    clip_info_t clips[MAX_CLIPS];
+    HOST_CHECK(ClipScan(part, clips, MAX_CLIPS) == 0);
+
+    const uint32_t counts[] = { 1, 9, 0, 20 };
+    uint32_t first = 1;
+    for (int i = 0; i < 4; i++) {
+        clip_info_t info;
+        HOST_CHECK(WriteClip(part, first, counts[i], &info) == ESP_OK);
+        HOST_CHECK(info.header.number == (uint32_t)i + 1 && info.header.frame_count == counts[i]);
+        first += counts[i];
+    }
+    const int n = ClipScan(part, clips, MAX_CLIPS);
+    HOST_CHECK(n == 4);
+    first = 1;
+    for (int i = 0; i < n; i++) {
+        HOST_CHECK(clips[i].header.number == (uint32_t)i + 1 && clips[i].header.frame_count == counts[i]);
+        HOST_CHECK(clips[i].offset % CLIP_SECTOR == 0);
+        HOST_CHECK(i == 0 || clips[i].offset == clips[i - 1].offset + clips[i - 1].header.clip_size);
+        HOST_CHECK(ClipMatches(part, &clips[i]));
+        HOST_CHECK(counts[i] == 0 || clips[i].header.first_us == first * 100000LL);
+        first += counts[i];
+    }
+    // a write never needed an erase it did not do
+    HOST_CHECK(PartitionSimStats().unerased == 0);
+
+    // a flipped bit in a frame fails the clip's check, not the scan
+    PartitionSimData()[clips[3].offset + CLIP_SECTOR + 1000] ^= 0x10;
+    HOST_CHECK(ClipScan(part, clips, MAX_CLIPS) == 4);
+    HOST_CHECK(ClipVerify(part, &clips[3]) == ESP_ERR_INVALID_CRC);
+    // one in the header hides the clip
+    PartitionSimData()[clips[2].offset + 8] ^= 0x01;
+    HOST_CHECK(ClipScan(part, clips, MAX_CLIPS) == 3);
+
+    // the newest clips when there are more than asked for
+    HOST_CHECK(ClipScan(part, clips, 2) == 2 && clips[0].header.number == 2 && clips[1].header.number == 4);
+
+    // larger than the partition
+    clip_writer_t w;
+    HOST_CHECK(ClipWriterBegin(&w, part, PART_SIZE, 10, 0) == ESP_ERR_INVALID_SIZE);
+}
+
+static void CheckWrap(void)
+{
+    PartitionSimCreate("recorder", PART_SIZE);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    clip_info_t clips[MAX_CLIPS];
+    uint32_t first = 1;
+    for (uint32_t number = 1; number <= 24; number++) {
+        const uint32_t count = 3 + Random() % 12;
+        clip_info_t info;
+        HOST_CHECK(WriteClip(part, first, count, &info) == ESP_OK);
+        first += count;
+
+        // the clips left are the newest ones, consecutive, intact, and never overlap
+        const int n = ClipScan(part, clips, MAX_CLIPS);
+        HOST_CHECK(n >= 1 && clips[n - 1].header.number == number && clips[n - 1].offset == info.offset);
+        for (int i = 0; i < n; i++) {
+            HOST_CHECK(clips[i].header.number == number - (n - 1 - i));
+            HOST_CHECK(ClipMatches(part, &clips[i]));
+            HOST_CHECK(i == 0 || clips[i - 1].offset + clips[i - 1].header.clip_size <= clips[i].offset
+                       || clips[i].offset + clips[i].header.clip_size <= clips[i - 1].offset);
+        }
+    }
+    HOST_CHECK(PartitionSimStats().unerased == 0);
+}
+
+// The entry a linear search finds: the last frame (thumbnail) at or before the time
+static int LinearSeek(const clip_entry_t *entries, uint32_t count, int64_t time_us, bool thumb)
+{
+    int found = -1;
+    for (uint32_t i = 0; i < count && entries[i].time_us <= time_us; i++) {
+        if (!!(entries[i].flags & CLIP_ENTRY_THUMB) == thumb) {
+            found = i;
+        }
+    }
+    return found < 0 && !thumb && count > 0 ? 0 : found;
+}
+
+static void CheckSeek(void)
+{
+    PartitionSimCreate("recorder", PART_SIZE);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    // frames at uneven times, some at the same time, a thumbnail after every 7th
+    enum { FRAMES = 150 };
+    uint8_t *frame = malloc(MAX_FRAME);
+    clip_writer_t w;
+    HOST_CHECK(ClipWriterBegin(&w, part, 800 * 1024, FRAMES + FRAMES / 7 + 1, 0) == ESP_OK);
+    int64_t t = 1000000;
+    for (uint32_t s = 1; s <= FRAMES; s++) {
+        t += Random() % 4 == 0 ? 0 : 50000 + Random() % 200000;
+        const size_t len = 64 + Random() % 4096;
+        MakeFrame(s, frame);
+        HOST_CHECK(ClipWriterAdd(&w, frame, len, t, s) == ESP_OK);
+        if (s % 7 == 3) {
+            HOST_CHECK(ClipWriterAddThumb(&w, frame, 200) == ESP_OK);
+            HOST_CHECK(ClipWriterAddThumb(&w, frame, 200) == ESP_ERR_INVALID_STATE);
+        }
+    }
+    HOST_CHECK(ClipWriterAdd(&w, frame, 100, t - 1, 0) == ESP_ERR_INVALID_ARG);
+    clip_info_t clip;
+    HOST_CHECK(ClipWriterFinish(&w, &clip) == ESP_OK && ClipVerify(part, &clip) == ESP_OK);
+    const uint32_t count = clip.header.frame_count;
+    HOST_CHECK(count == FRAMES + FRAMES / 7 + (FRAMES % 7 >= 3));
+    HOST_CHECK(clip.header.first_us >= 1000000 && clip.header.last_us == t);
+    clip_entry_t *entries = malloc(count * sizeof(clip_entry_t));
+    HOST_CHECK(ClipReadEntries(part, &clip, 0, entries, count) == ESP_OK);
+
+    // every time around each frame, and before and after the clip
+    uint32_t reads = 0, seeks = 0;
+    for (uint32_t i = 0; i <= count; i++) {
+        const int64_t at = i < count ? entries[i].time_us : t + 1000000;
+        for (int64_t d = -1; d <= 1; d++) {
+            for (int thumb = 0; thumb < 2; thumb++) {
+                const int want = LinearSeek(entries, count, at + d, thumb);
+                uint32_t index = UINT32_MAX;
+                clip_entry_t e;
+                PartitionSimClearStats();
+                const esp_err_t err = ClipSeek(part, &clip, at + d, thumb, &index, &e);
+                reads += PartitionSimStats().reads;
+                seeks++;
+                HOST_CHECK(want < 0 ? err == ESP_ERR_NOT_FOUND
+                                    : err == ESP_OK && index == (uint32_t)want &&
+                                      memcmp(&e, &entries[want], sizeof(e)) == 0);
+            }
+        }
+    }
+    // a binary search of 172 entries takes 8 reads, a thumbnail a chunk read more at most
+    HOST_CHECK(reads <= seeks * 10);
+    printf("seek: %u entries, %.1f flash reads per seek\n", count, (double)reads / seeks);
+
+    // as a file: the clip's bytes up to the end of its index
+    const uint32_t size = ClipFileSize(&clip);
+    HOST_CHECK(size == clip.header.index_offset + count * sizeof(clip_entry_t) && size <= clip.header.clip_size);
+    uint8_t *file = malloc(size);
+    HOST_CHECK(ClipRead(part, &clip, 0, file, size) == ESP_OK && memcmp(file, &clip.header, 64) == 0);
+    HOST_CHECK(ClipRead(part, &clip, 1, file, size) == ESP_ERR_INVALID_ARG);
+    free(file);
+
+    // found by number, or the newest
+    clip_info_t found;
+    HOST_CHECK(WriteClip(part, 1, 3, &found) == ESP_OK && found.header.number == 2);
+    HOST_CHECK(ClipFind(part, 1, &found) == ESP_OK && found.offset == clip.offset);
+    HOST_CHECK(ClipFind(part, 0, &found) == ESP_OK && found.header.number == 2);
+    HOST_CHECK(ClipFind(part, 3, &found) == ESP_ERR_NOT_FOUND);
+    free(entries);
+    free(frame);
+}
+
+// Power cut at every write and erase of a clip that wraps over the oldest clip
+static void CheckCrash(void)
+{
+    PartitionSimCreate("recorder", PART_SIZE);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    clip_info_t a, b, c;
+    HOST_CHECK(WriteClip(part, 1, 16, &a) == ESP_OK);       // about 400 kB from 0
+    HOST_CHECK(WriteClip(part, 17, 16, &b) == ESP_OK);      // after it
+    HOST_CHECK(b.offset + b.header.clip_size + ClipSize(300 * 1024, 12) > PART_SIZE);
+    uint8_t *image = malloc(PART_SIZE);
+    memcpy(image, PartitionSimData(), PART_SIZE);
+
+    // the ops of an uninterrupted clip C, which goes to the start over A
+    PartitionSimClearStats();
+    HOST_CHECK(WriteClip(part, 33, 12, &c) == ESP_OK && c.offset == 0);
+    partition_sim_stats_t st = PartitionSimStats();
+    const uint32_t ops = st.writes + st.erases;
+    printf("clip of %u kB: %u writes, %u erases (%u blocks, %u sectors), %.0f ms of flash\n",
+           (unsigned)(c.header.data_size / 1024), st.writes, st.erases, st.blocks, st.sectors, st.flash_ms);
+
+    int survived_a = 0;
+    for (uint32_t cut = 1; cut <= ops; cut++) {
+        memcpy(PartitionSimData(), image, PART_SIZE);
+        PartitionSimCutAfter(cut);
+        HOST_CHECK(WriteClip(part, 33, 12, &c) != ESP_OK && PartitionSimPowerLost());
+        PartitionSimPowerOn();
+
+        // what is found is intact, B is untouched, C is never half there
+        clip_info_t clips[MAX_CLIPS];
+        const int n = ClipScan(part, clips, MAX_CLIPS);
+        bool found_b = false;
+        for (int i = 0; i < n; i++) {
+            HOST_CHECK(ClipMatches(part, &clips[i]));
+            HOST_CHECK(clips[i].header.number != 3);
+            found_b |= clips[i].header.number == 2 && clips[i].offset == b.offset;
+            survived_a += clips[i].header.number == 1;
+        }
+        HOST_CHECK(found_b);
+
+        // and the next clip is written as if nothing happened
+        clip_info_t d;
+        HOST_CHECK(WriteClip(part, 45, 12, &d) == ESP_OK && d.header.number == 3 && ClipMatches(part, &d));
+        HOST_CHECK(ClipScan(part, clips, MAX_CLIPS) == 2);
+    }
+    // A is invalidated by the first write, before any sector of it is erased
+    HOST_CHECK(survived_a == 0);
+    printf("power cut at each of the %u ops: only intact clips found, the other clip kept every time\n", ops);
+    free(image);
+}
+
+int main(void)
+{
+    CheckRoundTrip();
+    CheckWrap();
+    CheckSeek();
+    CheckCrash();
+    PartitionSimDestroy();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,305 @@
+/*! \file clip_tool.c
+\brief Writes, reads and checks recorder clips as files (main/clip.h), the
+format /recorder/clip serves. A file is loaded into the flash model
+(partition_sim.c) and read with main/clip.c as the firmware reads the
+partition.
+
+Usage:
+  clip_tool write <clip file> [seconds] [fps] [jpeg_dir]
+      frames from jpeg_dir (*.jpg in name order, repeated) or synthetic HD
+      frames, with a thumbnail a second as the recorder codes them
+  clip_tool info <clip file>
+  clip_tool validate <clip file>
+      CRCs, the index against the frames, every frame found by its time
+  clip_tool extract <clip file> <ms> <jpeg file> [thumb]
+      the frame shown ms after the first one, or its thumbnail
+*****/
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clip.h"
+#include "stream.h"
+#include "partition_sim.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#define SYNTH_FRAMES 8
+#define SYNTH_W 1280
+#define SYNTH_H 720
+#define SYNTH_QUALITY 50
+#define THUMB_SCALE 8           // as main/recorder.c codes them
+#define THUMB_QUALITY 60
+#define THUMB_INTERVAL_US 1000000
+
+static uint8_t **jpg;
+static size_t *jpg_len;
+static size_t jpg_count;
+
+static void AddJpeg(uint8_t *data, size_t len)
+{
+    jpg = realloc(jpg, (jpg_count + 1) * sizeof(*jpg));
+    jpg_len = realloc(jpg_len, (jpg_count + 1) * sizeof(*jpg_len));
+    jpg[jpg_count] = data;
+    jpg_len[jpg_count++] = len;
+}
+
+static int CompareNames(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static void LoadDir(const char *dir)
+{
+    DIR *d = opendir(dir);
+    if (!d) {
+        return;
+    }
+    char **names = NULL;
+    size_t count = 0;
+    for (struct dirent *e; (e = readdir(d)); ) {
+        const size_t n = strlen(e->d_name);
+        if (n > 4 && strcmp(e->d_name + n - 4, ".jpg") == 0) {
+            names = realloc(names, (count + 1) * sizeof(*names));
+            names[count++] = strdup(e->d_name);
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(*names), CompareNames);
+    for (size_t i = 0; i < count; i++) {
+        char path[1024];
+        size_t len = 0;
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        uint8_t *data = HostReadFile(path, &len);
+        if (data && len > 4 && data[0] == 0xff && data[1] == 0xd8) {
+            AddJpeg(data, len);
+        } else {
+            free(data);
+        }
+        free(names[i]);
+    }
+    free(names);
+}
+
+// HD frames of roughly the size the sensor gives, a box moving over texture
+static void MakeFrames(void)
+{
+    uint8_t *rgb = malloc(SYNTH_W * SYNTH_H * 3);
+    for (int f = 0; f < SYNTH_FRAMES; f++) {
+        for (int y = 0; y < SYNTH_H; y++) {
+            for (int x = 0; x < SYNTH_W; x++) {
+                const bool box = x >= 100 + f * 120 && x < 260 + f * 120 && y >= 280 && y < 440;
+                uint8_t *p = &rgb[(y * SYNTH_W + x) * 3];
+                p[0] = box ? 240 : (uint8_t)((((x / 6) * 7) ^ ((y / 6) * 13)) & 0x7f) + y / 8;
+                p[1] = box ? 40 : (uint8_t)((((x / 6) * 5) ^ ((y / 6) * 3)) & 0x3f) + x / 12;
+                p[2] = box ? 40 : (uint8_t)((x + y + f * 8) & 0x7f);
+            }
+        }
+        uint8_t *data = NULL;
+        size_t len = 0;
+        if (fmt2jpg(rgb, SYNTH_W * SYNTH_H * 3, SYNTH_W, SYNTH_H, PIXFORMAT_RGB888, SYNTH_QUALITY, &data, &len)) {
+            AddJpeg(data, len);
+        }
+    }
+    free(rgb);
+}
+
+// The clip of a file, in a partition of its own
+static const esp_partition_t *LoadClip(const char *path, clip_info_t *clip, size_t *file_len)
+{
+    uint8_t *data = HostReadFile(path, file_len);
+    if (data == NULL) {
+        printf("%s: cannot read\n", path);
+        return NULL;
+    }
+    const uint32_t size = (*file_len + PARTITION_SIM_SECTOR - 1) / PARTITION_SIM_SECTOR * PARTITION_SIM_SECTOR;
+    PartitionSimCreate("clip", size > 0 ? size : PARTITION_SIM_SECTOR);
+    memcpy(PartitionSimData(), data, *file_len);
+    free(data);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "clip");
+    if (ClipScan(part, clip, 1) != 1 || clip->offset != 0) {
+        printf("%s: no clip (header or index CRC)\n", path);
+        return NULL;
+    }
+    return part;
+}
+
+static int Write(const char *path, double seconds, double fps, const char *dir)
+{
+    if (dir) {
+        LoadDir(dir);
+    } else {
+        MakeFrames();
+    }
+    if (jpg_count == 0 || fps <= 0) {
+        printf("no frames\n");
+        return 1;
+    }
+    const uint32_t frames = (uint32_t)(seconds * fps) > 0 ? (uint32_t)(seconds * fps) : 1;
+    const int64_t interval_us = (int64_t)(1000000 / fps);
+
+    // The thumbnails first, the writer wants the sizes up front
+    uint8_t **thumb = calloc(frames, sizeof(*thumb));
+    size_t *thumb_len = calloc(frames, sizeof(*thumb_len));
+    uint32_t data_size = 0, entries = frames;
+    int64_t thumb_us = INT64_MIN / 2;
+    for (uint32_t i = 0; i < frames; i++) {
+        const int64_t t = 1000000 + i * interval_us;
+        data_size += jpg_len[i % jpg_count];
+        if (t - thumb_us >= THUMB_INTERVAL_US) {
+            thumb_us = t;
+            if (StreamJpegScale(jpg[i % jpg_count], jpg_len[i % jpg_count], THUMB_SCALE, THUMB_QUALITY, &thumb[i],
+                                &thumb_len[i])) {
+                data_size += thumb_len[i];
+                entries++;
+            }
+        }
+    }
+
+    const uint32_t size = ClipSize(data_size, entries);
+    PartitionSimCreate("clip", size);
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "clip");
+    clip_writer_t w;
+    clip_info_t clip;
+    esp_err_t err = ClipWriterBegin(&w, part, data_size, entries, 0);
+    for (uint32_t i = 0; i < frames && err == ESP_OK; i++) {
+        err = ClipWriterAdd(&w, jpg[i % jpg_count], jpg_len[i % jpg_count], 1000000 + i * interval_us, i + 1);
+        if (err == ESP_OK && thumb[i]) {
+            err = ClipWriterAddThumb(&w, thumb[i], thumb_len[i]);
+        }
+        free(thumb[i]);
+    }
+    err = err == ESP_OK ? ClipWriterFinish(&w, &clip) : err;
+    free(thumb);
+    free(thumb_len);
+    if (err != ESP_OK) {
+        printf("clip not written: 0x%x\n", err);
+        return 1;
+    }
+
+    const uint32_t file_size = ClipFileSize(&clip);
+    uint8_t *data = malloc(file_size);
+    FILE *f = fopen(path, "wb");
+    bool ok = f && ClipRead(part, &clip, 0, data, file_size) == ESP_OK && fwrite(data, 1, file_size, f) == file_size;
+    if (f) {
+        ok &= fclose(f) == 0;
+    }
+    free(data);
+    printf("%s: %u frames and %u thumbnails over %.1f s, %u kB\n", path, frames, entries - frames,
+           (clip.header.last_us - clip.header.first_us) / 1e6, file_size / 1024);
+    return ok ? 0 : 1;
+}
+
+static int Info(const char *path)
+{
+    clip_info_t clip;
+    size_t len;
+    const esp_partition_t *part = LoadClip(path, &clip, &len);
+    if (part == NULL) {
+        return 1;
+    }
+    const clip_header_t *h = &clip.header;
+    clip_entry_t *entries = malloc((h->frame_count ? h->frame_count : 1) * sizeof(clip_entry_t));
+    uint32_t thumbs = 0;
+    size_t thumb_bytes = 0;
+    if (ClipReadEntries(part, &clip, 0, entries, h->frame_count) == ESP_OK) {
+        for (uint32_t i = 0; i < h->frame_count; i++) {
+            if (entries[i].flags & CLIP_ENTRY_THUMB) {
+                thumbs++;
+                thumb_bytes += entries[i].len;
+            }
+        }
+    }
+    const uint32_t frames = h->frame_count - thumbs;
+    const double seconds = (h->last_us - h->first_us) / 1e6;
+    printf("clip %u, version %u, %zu bytes (%u as stored)\n", h->number, h->version, len, h->clip_size);
+    printf("frames      %u, %.1f s, %.2f fps\n", frames, seconds,
+           frames > 1 && seconds > 0 ? (frames - 1) / seconds : 0.0);
+    printf("capture     %.6f to %.6f s, trigger at %.6f s\n", h->first_us / 1e6, h->last_us / 1e6,
+           h->trigger_us / 1e6);
+    printf("data        %u bytes, %.0f per frame\n", h->data_size - (uint32_t)thumb_bytes,
+           frames ? (double)(h->data_size - thumb_bytes) / frames : 0.0);
+    printf("thumbnails  %u, %.0f bytes each\n", thumbs, thumbs ? (double)thumb_bytes / thumbs : 0.0);
+    printf("index       %u entries at %u\n", h->frame_count, h->index_offset);
+    free(entries);
+    return 0;
+}
+
+static int Validate(const char *path)
+{
+    clip_info_t clip;
+    size_t len;
+    const esp_partition_t *part = LoadClip(path, &clip, &len);
+    if (part == NULL) {
+        return 1;
+    }
+    HOST_CHECK(len == ClipFileSize(&clip));
+    HOST_CHECK(ClipVerify(part, &clip) == ESP_OK);
+
+    // every frame and thumbnail is what a seek to its time finds
+    const uint32_t count = clip.header.frame_count;
+    clip_entry_t *entries = malloc((count ? count : 1) * sizeof(clip_entry_t));
+    HOST_CHECK(ClipReadEntries(part, &clip, 0, entries, count) == ESP_OK);
+    for (uint32_t i = 0; i < count && !host_failures; i++) {
+        const bool thumb = entries[i].flags & CLIP_ENTRY_THUMB;
+        const bool last = i + 1 == count || entries[i + 1].time_us > entries[i].time_us;
+        uint32_t index;
+        clip_entry_t e;
+        // frames at the same time: the last of them is found
+        if (thumb || last || (entries[i + 1].flags & CLIP_ENTRY_THUMB)) {
+            HOST_CHECK(ClipSeek(part, &clip, entries[i].time_us, thumb, &index, &e) == ESP_OK && index == i);
+        }
+    }
+    free(entries);
+    printf("%s: %u entries, %s\n", path, count, host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
+
+static int Extract(const char *path, double ms, const char *out, bool thumb)
+{
+    clip_info_t clip;
+    size_t len;
+    const esp_partition_t *part = LoadClip(path, &clip, &len);
+    if (part == NULL) {
+        return 1;
+    }
+    uint32_t index;
+    clip_entry_t e;
+    if (ClipSeek(part, &clip, clip.header.first_us + (int64_t)(ms * 1000), thumb, &index, &e) != ESP_OK) {
+        printf("nothing at %.0f ms\n", ms);
+        return 1;
+    }
+    uint8_t *data = malloc(e.len);
+    FILE *f = fopen(out, "wb");
+    bool ok = f && ClipReadFrame(part, &clip, &e, data) == ESP_OK && fwrite(data, 1, e.len, f) == e.len;
+    if (f) {
+        ok &= fclose(f) == 0;
+    }
+    free(data);
+    printf("%s: entry %u, frame %u at %.3f s, %u bytes\n", out, index, e.sequence,
+           (e.time_us - clip.header.first_us) / 1e6, e.len);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *cmd = argc > 2 ? argv[1] : "";
+    int res = 2;
+    if (strcmp(cmd, "write") == 0) {
+        res = Write(argv[2], argc > 3 ? atof(argv[3]) : 10.0, argc > 4 ? atof(argv[4]) : 5.0,
+                    argc > 5 ? argv[5] : NULL);
+    } else if (strcmp(cmd, "info") == 0) {
+        res = Info(argv[2]);
+    } else if (strcmp(cmd, "validate") == 0) {
+        res = Validate(argv[2]);
+    } else if (strcmp(cmd, "extract") == 0 && argc > 4) {
+        res = Extract(argv[2], atof(argv[3]), argv[4], argc > 5 && strcmp(argv[5], "thumb") == 0);
+    } else {
+        printf("usage: %s write <clip file> [seconds] [fps] [jpeg_dir]\n"
+               "       %s info <clip file>\n"
+               "       %s validate <clip file>\n"
+               "       %s extract <clip file> <ms> <jpeg file> [thumb]\n", argv[0], argv[0], argv[0], argv[0]);
+    }
+    PartitionSimDestroy();
+    return res;
+}
@@ -0,0 +1,228 @@
+/*! \file host_cjson.c
+\brief Host stand-in for cJSON, the subset declared in stubs/cJSON.h. Numbers
+print the way cJSON prints them: integers without a fraction, anything else
+with up to 15 significant digits.
+*****/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cJSON.h"
+
+typedef struct {
+    char *buf;
+    size_t len;
+    size_t size;
+    bool failed;
+} print_buf_t;
+
+static cJSON *Create(int type)
+{
+    cJSON *item = calloc(1, sizeof(cJSON));
+    if (item) {
+        item->type = type;
+    }
+    return item;
+}
+
+cJSON *cJSON_CreateObject(void)
+{
+    return Create(cJSON_Object);
+}
+
+cJSON *cJSON_CreateArray(void)
+{
+    return Create(cJSON_Array);
+}
+
+cJSON *cJSON_CreateString(const char *string)
+{
+    cJSON *item = Create(cJSON_String);
+    if (item && !(item->valuestring = strdup(string))) {
+        free(item);
+        return NULL;
+    }
+    return item;
+}
+
+cJSON *cJSON_CreateNumber(double num)
+{
+    cJSON *item = Create(cJSON_Number);
+    if (item) {
+        item->valuedouble = num;
+        item->valueint = num >= 2147483647.0 ? 2147483647 : num <= -2147483648.0 ? -2147483647 - 1 : (int)num;
+    }
+    return item;
+}
+
+cJSON *cJSON_CreateBool(cJSON_bool boolean)
+{
+    return Create(boolean ? cJSON_True : cJSON_False);
+}
+
+cJSON_bool cJSON_AddItemToArray(cJSON *array, cJSON *item)
+{
+    if (!array || !item || item == array) {
+        return false;
+    }
+    if (!array->child) {
+        array->child = item;
+        item->prev = item;      // the first child's prev is the last child
+    } else {
+        cJSON *last = array->child->prev;
+        last->next = item;
+        item->prev = last;
+        array->child->prev = item;
+    }
+    return true;
+}
+
+cJSON_bool cJSON_AddItemToObject(cJSON *object, const char *string, cJSON *item)
+{
+    if (!object || !string || !item) {
+        return false;
+    }
+    char *key = strdup(string);
+    if (!key) {
+        return false;
+    }
+    free(item->string);
+    item->string = key;
+    return cJSON_AddItemToArray(object, item);
+}
+
+static cJSON *AddNew(cJSON *object, const char *name, cJSON *item)
+{
+    if (cJSON_AddItemToObject(object, name, item)) {
+        return item;
+    }
+    cJSON_Delete(item);
+    return NULL;
+}
+
+cJSON *cJSON_AddStringToObject(cJSON *object, const char *name, const char *string)
+{
+    return AddNew(object, name, cJSON_CreateString(string));
+}
+
+cJSON *cJSON_AddNumberToObject(cJSON *object, const char *name, double number)
+{
+    return AddNew(object, name, cJSON_CreateNumber(number));
+}
+
+cJSON *cJSON_AddBoolToObject(cJSON *object, const char *name, cJSON_bool boolean)
+{
+    return AddNew(object, name, cJSON_CreateBool(boolean));
+}
+
+void cJSON_Delete(cJSON *item)
+{
+    while (item) {
+        cJSON *next = item->next;
+        cJSON_Delete(item->child);
+        free(item->valuestring);
+        free(item->string);
+        free(item);
+        item = next;
+    }
+}
+
+static void Append(print_buf_t *p, const char *s, size_t len)
+{
+    if (p->failed) {
+        return;
+    }
+    if (p->len + len + 1 > p->size) {
+        size_t size = p->size ? p->size : 64;
+        while (p->len + len + 1 > size) {
+            size *= 2;
+        }
+        char *buf = realloc(p->buf, size);
+        if (!buf) {
+            p->failed = true;
+            return;
+        }
+        p->buf = buf;
+        p->size = size;
+    }
+    memcpy(p->buf + p->len, s, len);
+    p->len += len;
+    p->buf[p->len] = 0;
+}
+
+static void PrintString(print_buf_t *p, const char *s)
+{
+    Append(p, "\"", 1);
+    for (; *s; s++) {
+        char esc[8];
+        switch (*s) {
+        case '"': Append(p, "\\\"", 2); break;
+        case '\\': Append(p, "\\\\", 2); break;
+        case '\b': Append(p, "\\b", 2); break;
+        case '\f': Append(p, "\\f", 2); break;
+        case '\n': Append(p, "\\n", 2); break;
+        case '\r': Append(p, "\\r", 2); break;
+        case '\t': Append(p, "\\t", 2); break;
+        default:
+            if ((unsigned char)*s < 0x20) {
+                Append(p, esc, snprintf(esc, sizeof(esc), "\\u%04x", (unsigned char)*s));
+            } else {
+                Append(p, s, 1);
+            }
+        }
+    }
+    Append(p, "\"", 1);
+}
+
+static void PrintValue(print_buf_t *p, const cJSON *item)
+{
+    char num[32];
+    switch (item->type) {
+    case cJSON_False: Append(p, "false", 5); break;
+    case cJSON_True: Append(p, "true", 4); break;
+    case cJSON_NULL: Append(p, "null", 4); break;
+    case cJSON_String: PrintString(p, item->valuestring); break;
+    case cJSON_Number:
+        if (isnan(item->valuedouble) || isinf(item->valuedouble)) {
+            Append(p, "null", 4);
+        } else if (item->valuedouble == (double)item->valueint) {
+            Append(p, num, snprintf(num, sizeof(num), "%d", item->valueint));
+        } else {
+            Append(p, num, snprintf(num, sizeof(num), "%1.15g", item->valuedouble));
+        }
+        break;
+    case cJSON_Array:
+    case cJSON_Object: {
+        const bool object = item->type == cJSON_Object;
+        Append(p, object ? "{" : "[", 1);
+        for (const cJSON *c = item->child; c; c = c->next) {
+            if (object) {
+                PrintString(p, c->string ? c->string : "");
+                Append(p, ":", 1);
+            }
+            PrintValue(p, c);
+            if (c->next) {
+                Append(p, ",", 1);
+            }
+        }
+        Append(p, object ? "}" : "]", 1);
+        break;
+    }
+    default:
+        p->failed = true;
+    }
+}
+
+char *cJSON_PrintUnformatted(const cJSON *item)
+{
+    print_buf_t p = { 0 };
+    if (!item) {
+        return NULL;
+    }
+    PrintValue(&p, item);
+    if (p.failed) {
+        free(p.buf);
+        return NULL;
+    }
+    return p.buf;
+}
@@ -0,0 +1,299 @@
+/*! \file host_freertos.c
+\brief Host stand-ins for the FreeRTOS queues and tasks and esp_timer used by
+the camera driver. Tasks are threads, queues are a ring under a mutex, ticks
+are milliseconds.
+*****/
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+struct host_queue {
+    pthread_mutex_t mutex;
+    pthread_cond_t changed;     // signalled on every send, receive and reset
+    uint8_t *items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t head;
+    UBaseType_t count;
+    int receivers;              // tasks blocked in xQueueReceive()
+};
+
+struct host_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    uint32_t stack;
+    struct host_task *next;
+};
+
+// Running tasks and the CPU time of the ones that are gone, for HostTaskCpuUs()
+static pthread_mutex_t tasks_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct host_task *tasks;
+static int64_t tasks_retired_us;
+
+int64_t esp_timer_get_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() / 1000 / portTICK_PERIOD_MS);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    usleep((useconds_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+// Wait on the queue condition, false once the tick deadline has passed
+static bool QueueWait(struct host_queue *q, TickType_t wait, const struct timespec *deadline)
+{
+    if (wait == portMAX_DELAY) {
+        pthread_cond_wait(&q->changed, &q->mutex);
+        return true;
+    }
+    return pthread_cond_timedwait(&q->changed, &q->mutex, deadline) != ETIMEDOUT;
+}
+
+static void QueueDeadline(TickType_t wait, struct timespec *deadline)
+{
+    clock_gettime(CLOCK_REALTIME, deadline);
+    uint64_t ns = deadline->tv_nsec + (uint64_t)wait * portTICK_PERIOD_MS * 1000000;
+    deadline->tv_sec += ns / 1000000000;
+    deadline->tv_nsec = ns % 1000000000;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    struct host_queue *q = calloc(1, sizeof(*q));
+    if (!q) {
+        return NULL;
+    }
+    q->items = malloc(length * item_size + 1);
+    if (!q->items) {
+        free(q);
+        return NULL;
+    }
+    q->length = length;
+    q->item_size = item_size;
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->changed, NULL);
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+    pthread_mutex_destroy(&q->mutex);
+    pthread_cond_destroy(&q->changed);
+    free(q->items);
+    free(q);
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait)
+{
+    struct timespec deadline;
+    QueueDeadline(wait, &deadline);
+    pthread_mutex_lock(&q->mutex);
+    while (q->count == q->length) {
+        if (!wait || !QueueWait(q, wait, &deadline)) {
+            pthread_mutex_unlock(&q->mutex);
+            return pdFALSE;
+        }
+    }
+    if (q->item_size) {
+        memcpy(q->items + ((q->head + q->count) % q->length) * q->item_size, item, q->item_size);
+    }
+    q->count++;
+    pthread_cond_broadcast(&q->changed);
+    pthread_mutex_unlock(&q->mutex);
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken)
+{
+    if (woken) {
+        *woken = pdFALSE;
+    }
+    return xQueueSend(q, item, 0);
+}
+
+// A task deleted while blocked in xQueueReceive() must not leave the queue locked
+static void QueueReceiveCancelled(void *arg)
+{
+    struct host_queue *q = arg;
+    q->receivers--;
+    pthread_mutex_unlock(&q->mutex);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait)
+{
+    BaseType_t ret = pdTRUE;
+    struct timespec deadline;
+    QueueDeadline(wait, &deadline);
+    pthread_mutex_lock(&q->mutex);
+    q->receivers++;
+    pthread_cleanup_push(QueueReceiveCancelled, q);
+    if (!q->count) {
+        pthread_cond_broadcast(&q->changed);    // HostQueueWaitIdle() waits for this
+    }
+    while (!q->count) {
+        if (!wait || !QueueWait(q, wait, &deadline)) {
+            ret = pdFALSE;
+            break;
+        }
+    }
+    if (ret == pdTRUE) {
+        if (q->item_size) {
+            memcpy(item, q->items + q->head * q->item_size, q->item_size);
+        }
+        q->head = (q->head + 1) % q->length;
+        q->count--;
+        pthread_cond_broadcast(&q->changed);
+    }
+    pthread_cleanup_pop(0);
+    q->receivers--;
+    pthread_mutex_unlock(&q->mutex);
+    return ret;
+}
+
+BaseType_t xQueueReset(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->mutex);
+    q->head = 0;
+    q->count = 0;
+    pthread_cond_broadcast(&q->changed);
+    pthread_mutex_unlock(&q->mutex);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->mutex);
+    UBaseType_t count = q->count;
+    pthread_mutex_unlock(&q->mutex);
+    return count;
+}
+
+void HostQueueWaitIdle(QueueHandle_t q)
+{
+    pthread_mutex_lock(&q->mutex);
+    while (q->count || !q->receivers) {
+        pthread_cond_wait(&q->changed, &q->mutex);
+    }
+    pthread_mutex_unlock(&q->mutex);
+}
+
+static __thread struct host_task *current_task;
+
+static int64_t ThreadCpuUs(pthread_t thread)
+{
+    clockid_t clock;
+    struct timespec ts;
+    if (pthread_getcpuclockid(thread, &clock) || clock_gettime(clock, &ts)) {
+        return 0;
+    }
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// Take the task off the list, its CPU time so far goes to the retired total
+static void TaskRetire(struct host_task *task)
+{
+    pthread_mutex_lock(&tasks_lock);
+    for (struct host_task **t = &tasks; *t; t = &(*t)->next) {
+        if (*t == task) {
+            *t = task->next;
+            tasks_retired_us += ThreadCpuUs(task->thread);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&tasks_lock);
+}
+
+static void *TaskMain(void *arg)
+{
+    struct host_task *task = arg;
+    current_task = task;
+    task->fn(task->arg);
+    TaskRetire(task);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core)
+{
+    (void)name; (void)prio; (void)core;
+    struct host_task *task = calloc(1, sizeof(*task));
+    if (!task) {
+        return pdFAIL;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    task->stack = stack;
+    // listed before it runs, a task that deletes itself right away takes itself off again
+    pthread_mutex_lock(&tasks_lock);
+    if (pthread_create(&task->thread, NULL, TaskMain, task)) {
+        pthread_mutex_unlock(&tasks_lock);
+        free(task);
+        return pdFAIL;
+    }
+    task->next = tasks;
+    tasks = task;
+    pthread_mutex_unlock(&tasks_lock);
+    if (handle) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (!task || pthread_equal(task->thread, pthread_self())) {
+        // a task deleting itself, nobody joins it
+        if (current_task) {
+            TaskRetire(current_task);
+            pthread_detach(pthread_self());
+            free(current_task);
+        }
+        pthread_exit(NULL);
+    }
+    TaskRetire(task);
+    pthread_cancel(task->thread);
+    pthread_join(task->thread, NULL);
+    free(task);
+}
+
+int64_t HostTaskCpuUs(void)
+{
+    pthread_mutex_lock(&tasks_lock);
+    int64_t us = tasks_retired_us;
+    for (struct host_task *t = tasks; t; t = t->next) {
+        us += ThreadCpuUs(t->thread);
+    }
+    pthread_mutex_unlock(&tasks_lock);
+    return us;
+}
+
+size_t HostTaskStackBytes(int *count)
+{
+    size_t bytes = 0;
+    int n = 0;
+    pthread_mutex_lock(&tasks_lock);
+    for (struct host_task *t = tasks; t; t = t->next) {
+        bytes += t->stack;
+        n++;
+    }
+    pthread_mutex_unlock(&tasks_lock);
+    if (count) {
+        *count = n;
+    }
+    return bytes;
+}
@@ -0,0 +1,971 @@
+/*! \file host_httpd.c
+\brief Host stand-in for the ESP-IDF HTTP server on POSIX sockets. One
+server task waits on the listening socket, the open WebSocket sessions and a
+wake-up pipe (the control socket of the real server), and runs the handlers
+one at a time. A request is read up to the end of its headers, then the
+handler answers it and the connection closes, or stays open for the task a
+handler passed it to with httpd_req_async_handler_begin(). Responses without a length are
+sent chunked. WebSocket frames from clients are unmasked in
+httpd_ws_recv_frame(). Frames to clients go out unmasked, under a per-session
+lock so async sends from other tasks do not interleave with the handler's.
+*****/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "esp_http_server.h"
+#include "esp_log.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "httpd";
+
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC11B65"
+
+struct host_sess {
+    int fd;                     // -1 while free
+    bool ws;                    // handshake done
+    bool async;                 // handed to another task by httpd_req_async_handler_begin()
+    const httpd_uri_t *uri;     // WebSocket handler of the session
+    pthread_mutex_t send_lock;
+};
+
+struct host_httpd {
+    httpd_config_t config;
+    int listen_fd;
+    int wake[2];                // pipe, the server task selects on wake[0]
+    httpd_uri_t *uris;
+    size_t uri_count;
+    struct host_sess *sess;
+    pthread_mutex_t lock;       // session slots
+    QueueHandle_t work;
+    int async_count;            // requests begun async and not completed
+    volatile bool stop;
+    SemaphoreHandle_t done;
+};
+
+// Request state behind req->aux
+struct host_req {
+    struct host_httpd *hd;
+    struct host_sess *sess;
+    char hdr[HTTPD_MAX_REQ_HDR_LEN + 1];    // header lines after the request line
+    char query[HTTPD_MAX_URI_LEN + 1];
+    const char *status;
+    const char *type;
+    const char *fields[16];
+    const char *values[16];
+    size_t field_count;
+    bool headers_sent;
+    // WebSocket frame being received
+    bool ws_hdr;
+    bool ws_masked;
+    uint8_t ws_mask[4];
+    uint8_t ws_opcode;
+    size_t ws_len;
+    size_t ws_read;
+};
+
+typedef struct {
+    httpd_work_fn_t fn;
+    void *arg;
+} host_work_t;
+
+static bool SendAll(struct host_sess *sess, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    while (len) {
+        ssize_t n = send(sess->fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool RecvAll(int fd, void *buf, size_t len)
+{
+    uint8_t *p = buf;
+    while (len) {
+        ssize_t n = recv(fd, p, len, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static void SessionClose(struct host_httpd *hd, struct host_sess *sess)
+{
+    pthread_mutex_lock(&hd->lock);
+    pthread_mutex_lock(&sess->send_lock);
+    close(sess->fd);
+    sess->fd = -1;
+    sess->ws = false;
+    sess->async = false;
+    sess->uri = NULL;
+    pthread_mutex_unlock(&sess->send_lock);
+    pthread_mutex_unlock(&hd->lock);
+}
+
+static struct host_sess *SessionFind(struct host_httpd *hd, int fd)
+{
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sess[i].fd == fd) {
+            return &hd->sess[i];
+        }
+    }
+    return NULL;
+}
+
+/* ---- SHA-1 and base64 for the WebSocket handshake ---- */
+
+static uint32_t Rol(uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+static void Sha1Block(uint32_t h[5], const uint8_t *p)
+{
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t)p[i * 4] << 24 | p[i * 4 + 1] << 16 | p[i * 4 + 2] << 8 | p[i * 4 + 3];
+    }
+    for (int i = 16; i < 80; i++) {
+        w[i] = Rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+    for (int i = 0; i < 80; i++) {
+        uint32_t f, k;
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5a827999;
+        } else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1;
+        } else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdc;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6;
+        }
+        uint32_t t = Rol(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = Rol(b, 30);
+        b = a;
+        a = t;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+}
+
+static void Sha1(const uint8_t *data, size_t len, uint8_t out[20])
+{
+    uint32_t h[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+    uint8_t block[64];
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        Sha1Block(h, data + i);
+    }
+    size_t rest = len - i;
+    memset(block, 0, sizeof(block));
+    memcpy(block, data + i, rest);
+    block[rest] = 0x80;
+    if (rest >= 56) {
+        Sha1Block(h, block);
+        memset(block, 0, sizeof(block));
+    }
+    const uint64_t bits = (uint64_t)len * 8;
+    for (int b = 0; b < 8; b++) {
+        block[63 - b] = (uint8_t)(bits >> (b * 8));
+    }
+    Sha1Block(h, block);
+    for (int b = 0; b < 20; b++) {
+        out[b] = (uint8_t)(h[b / 4] >> (24 - (b % 4) * 8));
+    }
+}
+
+static void Base64(const uint8_t *in, size_t len, char *out)
+{
+    static const char abc[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (size_t i = 0; i < len; i += 3) {
+        const uint32_t v = (uint32_t)in[i] << 16 | (i + 1 < len ? in[i + 1] << 8 : 0) | (i + 2 < len ? in[i + 2] : 0);
+        *out++ = abc[(v >> 18) & 63];
+        *out++ = abc[(v >> 12) & 63];
+        *out++ = i + 1 < len ? abc[(v >> 6) & 63] : '=';
+        *out++ = i + 2 < len ? abc[v & 63] : '=';
+    }
+    *out = 0;
+}
+
+/* ---- Requests ---- */
+
+// Value of a request header, NULL without it
+static const char *HeaderFind(const struct host_req *rq, const char *field, size_t *len)
+{
+    const size_t flen = strlen(field);
+    for (const char *line = rq->hdr; *line; ) {
+        const char *end = strstr(line, "\r\n");
+        if (!end) {
+            break;
+        }
+        if ((size_t)(end - line) > flen && line[flen] == ':' && strncasecmp(line, field, flen) == 0) {
+            const char *v = line + flen + 1;
+            while (v < end && (*v == ' ' || *v == '\t')) {
+                v++;
+            }
+            *len = end - v;
+            return v;
+        }
+        line = end + 2;
+    }
+    return NULL;
+}
+
+// Read up to the empty line, false on a timeout, a closed connection or headers too long
+static bool ReadHead(int fd, char *buf, size_t size)
+{
+    size_t len = 0;
+    while (len < size - 1) {
+        ssize_t n = recv(fd, buf + len, 1, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        len++;
+        buf[len] = 0;
+        if (len >= 4 && memcmp(buf + len - 4, "\r\n\r\n", 4) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int MethodOf(const char *m)
+{
+    static const char *names[] = { "DELETE", "GET", "HEAD", "POST", "PUT" };
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (strcmp(m, names[i]) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static void ReqInit(httpd_req_t *req, struct host_req *rq, struct host_httpd *hd, struct host_sess *sess)
+{
+    memset(req, 0, sizeof(*req));
+    memset(rq, 0, sizeof(*rq));
+    rq->hd = hd;
+    rq->sess = sess;
+    rq->status = HTTPD_200;
+    rq->type = HTTPD_TYPE_TEXT;
+    req->handle = hd;
+    req->aux = rq;
+}
+
+static bool WsHandshake(struct host_req *rq)
+{
+    size_t len;
+    const char *key = HeaderFind(rq, "Sec-WebSocket-Key", &len);
+    if (!key || len > 64) {
+        return false;
+    }
+    char src[64 + sizeof(WS_GUID)];
+    memcpy(src, key, len);
+    memcpy(src + len, WS_GUID, sizeof(WS_GUID) - 1);
+    uint8_t digest[20];
+    Sha1((const uint8_t *)src, len + sizeof(WS_GUID) - 1, digest);
+    char accept[32];
+    Base64(digest, sizeof(digest), accept);
+    char resp[256];
+    const int n = snprintf(resp, sizeof(resp), "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\n"
+                           "Connection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n", accept);
+    pthread_mutex_lock(&rq->sess->send_lock);
+    const bool ok = SendAll(rq->sess, resp, n);
+    pthread_mutex_unlock(&rq->sess->send_lock);
+    return ok;
+}
+
+// A new connection: one request, then the connection closes unless it became a WebSocket
+static void HandleRequest(struct host_httpd *hd, struct host_sess *sess)
+{
+    httpd_req_t req;
+    struct host_req rq;
+    ReqInit(&req, &rq, hd, sess);
+
+    char head[HTTPD_MAX_REQ_HDR_LEN + HTTPD_MAX_URI_LEN + 32];
+    if (!ReadHead(sess->fd, head, sizeof(head))) {
+        SessionClose(hd, sess);
+        return;
+    }
+    char method[8], target[HTTPD_MAX_URI_LEN + 1];
+    if (sscanf(head, "%7s %512s HTTP/1.1", method, target) != 2) {
+        httpd_resp_send_err(&req, HTTPD_400_BAD_REQUEST, NULL);
+        SessionClose(hd, sess);
+        return;
+    }
+    snprintf(rq.hdr, sizeof(rq.hdr), "%s", strstr(head, "\r\n") + 2);
+    char *query = strchr(target, '?');
+    if (query) {
+        *query++ = 0;
+        snprintf(rq.query, sizeof(rq.query), "%s", query);
+    }
+    req.method = MethodOf(method);
+    snprintf((char *)req.uri, sizeof(req.uri), "%s", target);
+
+    const httpd_uri_t *uri = NULL;
+    for (size_t i = 0; i < hd->uri_count; i++) {
+        if (hd->uris[i].method == req.method && strcmp(hd->uris[i].uri, target) == 0) {
+            uri = &hd->uris[i];
+            break;
+        }
+    }
+    if (!uri) {
+        httpd_resp_send_404(&req);
+        SessionClose(hd, sess);
+        return;
+    }
+    req.user_ctx = uri->user_ctx;
+
+    if (uri->is_websocket) {
+        // a WebSocket from here on, async sends may follow the client's first look at the handshake
+        pthread_mutex_lock(&hd->lock);
+        sess->ws = true;
+        sess->uri = uri;
+        pthread_mutex_unlock(&hd->lock);
+        if (!WsHandshake(&rq)) {
+            SessionClose(hd, sess);
+            return;
+        }
+        if (uri->handler(&req) != ESP_OK) {
+            SessionClose(hd, sess);
+        }
+        return;
+    }
+
+    uri->handler(&req);
+    if (!sess->async) {
+        SessionClose(hd, sess);
+    }
+}
+
+// Data on a WebSocket session: the handler receives the frame
+static void HandleWsFrame(struct host_httpd *hd, struct host_sess *sess)
+{
+    httpd_req_t req;
+    struct host_req rq;
+    ReqInit(&req, &rq, hd, sess);
+    req.method = 0;
+    req.user_ctx = sess->uri->user_ctx;
+    snprintf((char *)req.uri, sizeof(req.uri), "%s", sess->uri->uri);
+
+    httpd_ws_frame_t frame = { 0 };
+    if (httpd_ws_recv_frame(&req, &frame, 0) != ESP_OK) {
+        SessionClose(hd, sess);
+        return;
+    }
+    const bool control = rq.ws_opcode >= HTTPD_WS_TYPE_CLOSE;
+    esp_err_t err = ESP_OK;
+    if (!control || sess->uri->handle_ws_control_frames) {
+        err = sess->uri->handler(&req);
+    }
+    // whatever the handler left of the payload
+    uint8_t skip[256];
+    while (err == ESP_OK && rq.ws_read < rq.ws_len) {
+        const size_t n = rq.ws_len - rq.ws_read < sizeof(skip) ? rq.ws_len - rq.ws_read : sizeof(skip);
+        if (!RecvAll(sess->fd, skip, n)) {
+            err = ESP_FAIL;
+        }
+        rq.ws_read += n;
+    }
+    if (err != ESP_OK || rq.ws_opcode == HTTPD_WS_TYPE_CLOSE) {
+        if (rq.ws_opcode == HTTPD_WS_TYPE_CLOSE) {
+            httpd_ws_frame_t close_frame = { .final = true, .type = HTTPD_WS_TYPE_CLOSE };
+            httpd_ws_send_frame(&req, &close_frame);
+        }
+        SessionClose(hd, sess);
+    } else if (rq.ws_opcode == HTTPD_WS_TYPE_PING && !sess->uri->handle_ws_control_frames) {
+        httpd_ws_frame_t pong = { .final = true, .type = HTTPD_WS_TYPE_PONG };
+        httpd_ws_send_frame(&req, &pong);
+    }
+}
+
+static void Accept(struct host_httpd *hd)
+{
+    const int fd = accept(hd->listen_fd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+    const struct timeval rcv = { .tv_sec = hd->config.recv_wait_timeout };
+    const struct timeval snd = { .tv_sec = hd->config.send_wait_timeout };
+    const int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &rcv, sizeof(rcv));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &snd, sizeof(snd));
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    pthread_mutex_lock(&hd->lock);
+    struct host_sess *sess = SessionFind(hd, -1);
+    if (sess) {
+        sess->fd = fd;
+    }
+    pthread_mutex_unlock(&hd->lock);
+    if (!sess) {
+        ESP_LOGW(TAG, "No free session for a new connection");
+        close(fd);
+        return;
+    }
+    HandleRequest(hd, sess);
+}
+
+static void ServerTask(void *arg)
+{
+    struct host_httpd *hd = arg;
+    while (!hd->stop) {
+        fd_set rd;
+        FD_ZERO(&rd);
+        FD_SET(hd->listen_fd, &rd);
+        FD_SET(hd->wake[0], &rd);
+        int max_fd = hd->listen_fd > hd->wake[0] ? hd->listen_fd : hd->wake[0];
+        for (int i = 0; i < hd->config.max_open_sockets; i++) {
+            if (hd->sess[i].fd >= 0 && hd->sess[i].ws) {
+                FD_SET(hd->sess[i].fd, &rd);
+                max_fd = hd->sess[i].fd > max_fd ? hd->sess[i].fd : max_fd;
+            }
+        }
+        if (select(max_fd + 1, &rd, NULL, NULL, NULL) < 0) {
+            continue;
+        }
+        if (FD_ISSET(hd->wake[0], &rd)) {
+            char c;
+            if (read(hd->wake[0], &c, 1) < 0) {
+                continue;
+            }
+            host_work_t work;
+            while (xQueueReceive(hd->work, &work, 0) == pdTRUE) {
+                work.fn(work.arg);
+            }
+        }
+        for (int i = 0; i < hd->config.max_open_sockets && !hd->stop; i++) {
+            if (hd->sess[i].fd >= 0 && hd->sess[i].ws && FD_ISSET(hd->sess[i].fd, &rd)) {
+                HandleWsFrame(hd, &hd->sess[i]);
+            }
+        }
+        if (!hd->stop && FD_ISSET(hd->listen_fd, &rd)) {
+            Accept(hd);
+        }
+    }
+    xSemaphoreGive(hd->done);
+    vTaskDelete(NULL);
+}
+
+static void Wake(struct host_httpd *hd)
+{
+    const char c = 0;
+    if (write(hd->wake[1], &c, 1) < 0) {
+        ESP_LOGW(TAG, "Wake-up failed");
+    }
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config)
+{
+    if (!handle || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_httpd *hd = calloc(1, sizeof(*hd));
+    if (!hd) {
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    hd->config = *config;
+    hd->uris = calloc(config->max_uri_handlers, sizeof(httpd_uri_t));
+    hd->sess = calloc(config->max_open_sockets, sizeof(struct host_sess));
+    hd->work = xQueueCreate(8, sizeof(host_work_t));
+    hd->done = xSemaphoreCreateBinary();
+    hd->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    pthread_mutex_init(&hd->lock, NULL);
+    for (int i = 0; i < config->max_open_sockets && hd->sess; i++) {
+        hd->sess[i].fd = -1;
+        pthread_mutex_init(&hd->sess[i].send_lock, NULL);
+    }
+
+    const int one = 1;
+    struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(config->server_port),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    if (!hd->uris || !hd->sess || !hd->work || !hd->done || hd->listen_fd < 0 || pipe(hd->wake)
+        || setsockopt(hd->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one))
+        || bind(hd->listen_fd, (struct sockaddr *)&addr, sizeof(addr))
+        || listen(hd->listen_fd, config->backlog_conn)) {
+        ESP_LOGE(TAG, "Server setup on port %d failed: %s", config->server_port, strerror(errno));
+        if (hd->listen_fd >= 0) {
+            close(hd->listen_fd);
+        }
+        free(hd->uris);
+        free(hd->sess);
+        free(hd);
+        return ESP_ERR_HTTPD_TASK;
+    }
+    if (xTaskCreatePinnedToCore(ServerTask, "httpd", config->stack_size, hd, config->task_priority, NULL,
+                                config->core_id) != pdPASS) {
+        close(hd->listen_fd);
+        return ESP_ERR_HTTPD_TASK;
+    }
+    *handle = hd;
+    return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle)
+{
+    struct host_httpd *hd = handle;
+    if (!hd) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // a handler still sending gets errors and returns
+    hd->stop = true;
+    pthread_mutex_lock(&hd->lock);
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sess[i].fd >= 0) {
+            shutdown(hd->sess[i].fd, SHUT_RDWR);
+        }
+    }
+    pthread_mutex_unlock(&hd->lock);
+    Wake(hd);
+    xSemaphoreTake(hd->done, portMAX_DELAY);
+    // async handlers see their sends fail and complete
+    for (;;) {
+        pthread_mutex_lock(&hd->lock);
+        const int async_count = hd->async_count;
+        pthread_mutex_unlock(&hd->lock);
+        if (!async_count) {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sess[i].fd >= 0) {
+            close(hd->sess[i].fd);
+        }
+        pthread_mutex_destroy(&hd->sess[i].send_lock);
+    }
+    close(hd->listen_fd);
+    close(hd->wake[0]);
+    close(hd->wake[1]);
+    vQueueDelete(hd->work);
+    vSemaphoreDelete(hd->done);
+    pthread_mutex_destroy(&hd->lock);
+    free(hd->uris);
+    free(hd->sess);
+    free(hd);
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler)
+{
+    struct host_httpd *hd = handle;
+    if (!hd || !uri_handler) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < hd->uri_count; i++) {
+        if (hd->uris[i].method == uri_handler->method && strcmp(hd->uris[i].uri, uri_handler->uri) == 0) {
+            return ESP_ERR_HTTPD_HANDLER_EXISTS;
+        }
+    }
+    if (hd->uri_count == hd->config.max_uri_handlers) {
+        return ESP_ERR_HTTPD_HANDLERS_FULL;
+    }
+    hd->uris[hd->uri_count++] = *uri_handler;
+    return ESP_OK;
+}
+
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void *arg)
+{
+    struct host_httpd *hd = handle;
+    const host_work_t item = { work, arg };
+    if (!hd || !work) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xQueueSend(hd->work, &item, 0) != pdTRUE) {
+        return ESP_FAIL;
+    }
+    Wake(hd);
+    return ESP_OK;
+}
+
+esp_err_t httpd_get_client_list(httpd_handle_t handle, size_t *fds, int *client_fds)
+{
+    struct host_httpd *hd = handle;
+    if (!hd || !fds || !client_fds || *fds < hd->config.max_open_sockets) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t n = 0;
+    pthread_mutex_lock(&hd->lock);
+    for (int i = 0; i < hd->config.max_open_sockets; i++) {
+        if (hd->sess[i].fd >= 0) {
+            client_fds[n++] = hd->sess[i].fd;
+        }
+    }
+    pthread_mutex_unlock(&hd->lock);
+    *fds = n;
+    return ESP_OK;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r)
+{
+    return r ? ((struct host_req *)r->aux)->sess->fd : -1;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd)
+{
+    struct host_httpd *hd = handle;
+    if (!hd) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // the client sees the end now, the slot is freed with the request or its async completion
+    pthread_mutex_lock(&hd->lock);
+    struct host_sess *sess = sockfd >= 0 ? SessionFind(hd, sockfd) : NULL;
+    if (sess) {
+        shutdown(sess->fd, SHUT_RDWR);
+    }
+    pthread_mutex_unlock(&hd->lock);
+    return sess ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+// An async request and its state, one allocation
+struct host_async {
+    httpd_req_t req;
+    struct host_req rq;
+};
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out)
+{
+    if (!r || !out) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_req *rq = r->aux;
+    struct host_async *async = malloc(sizeof(*async));
+    if (!async) {
+        return ESP_ERR_NO_MEM;
+    }
+    memcpy(&async->req, r, sizeof(*r));
+    async->rq = *rq;
+    async->req.aux = &async->rq;
+    pthread_mutex_lock(&rq->hd->lock);
+    rq->sess->async = true;
+    rq->hd->async_count++;
+    pthread_mutex_unlock(&rq->hd->lock);
+    *out = &async->req;
+    return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t *r)
+{
+    if (!r) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct host_async *async = (struct host_async *)r;
+    struct host_httpd *hd = async->rq.hd;
+    SessionClose(hd, async->rq.sess);
+    pthread_mutex_lock(&hd->lock);
+    hd->async_count--;
+    pthread_mutex_unlock(&hd->lock);
+    free(async);
+    return ESP_OK;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field)
+{
+    size_t len = 0;
+    return HeaderFind(r->aux, field, &len) ? len : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size)
+{
+    size_t len = 0;
+    const char *v = HeaderFind(r->aux, field, &len);
+    if (!v) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (!val || !val_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t n = len < val_size - 1 ? len : val_size - 1;
+    memcpy(val, v, n);
+    val[n] = 0;
+    return n < len ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+size_t httpd_req_get_url_query_len(httpd_req_t *r)
+{
+    return strlen(((struct host_req *)r->aux)->query);
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len)
+{
+    const char *q = ((struct host_req *)r->aux)->query;
+    if (!*q) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    if (!buf || !buf_len) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    snprintf(buf, buf_len, "%s", q);
+    return strlen(q) < buf_len ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size)
+{
+    if (!qry || !key || !val || !val_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t klen = strlen(key);
+    for (const char *p = qry; *p; ) {
+        const char *end = strchr(p, '&');
+        const size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len > klen && p[klen] == '=' && strncmp(p, key, klen) == 0) {
+            const size_t vlen = len - klen - 1;
+            const size_t n = vlen < val_size - 1 ? vlen : val_size - 1;
+            memcpy(val, p + klen + 1, n);
+            val[n] = 0;
+            return n < vlen ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+        }
+        p += len + (end ? 1 : 0);
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+/* ---- Responses ---- */
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status)
+{
+    ((struct host_req *)r->aux)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type)
+{
+    ((struct host_req *)r->aux)->type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value)
+{
+    struct host_req *rq = r->aux;
+    if (rq->field_count == rq->hd->config.max_resp_headers
+        || rq->field_count == sizeof(rq->fields) / sizeof(rq->fields[0])) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    rq->fields[rq->field_count] = field;
+    rq->values[rq->field_count++] = value;
+    return ESP_OK;
+}
+
+// Status line and headers, with a length or chunked
+static esp_err_t SendHead(struct host_req *rq, ssize_t content_len)
+{
+    char head[1024];
+    int n = snprintf(head, sizeof(head), "HTTP/1.1 %s\r\nContent-Type: %s\r\n", rq->status, rq->type);
+    if (content_len >= 0) {
+        n += snprintf(head + n, sizeof(head) - n, "Content-Length: %zd\r\n", content_len);
+    } else {
+        n += snprintf(head + n, sizeof(head) - n, "Transfer-Encoding: chunked\r\n");
+    }
+    for (size_t i = 0; i < rq->field_count && n < (int)sizeof(head); i++) {
+        n += snprintf(head + n, sizeof(head) - n, "%s: %s\r\n", rq->fields[i], rq->values[i]);
+    }
+    if (n >= (int)sizeof(head) - 2) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    n += snprintf(head + n, sizeof(head) - n, "\r\n");
+    rq->headers_sent = true;
+    return SendAll(rq->sess, head, n) ? ESP_OK : ESP_ERR_HTTPD_RESP_SEND;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    struct host_req *rq = r->aux;
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    esp_err_t err = SendHead(rq, buf_len);
+    if (err == ESP_OK && buf_len && !SendAll(rq->sess, buf, buf_len)) {
+        err = ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return err;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len)
+{
+    struct host_req *rq = r->aux;
+    if (buf_len == HTTPD_RESP_USE_STRLEN) {
+        buf_len = buf ? strlen(buf) : 0;
+    }
+    if (!rq->headers_sent) {
+        esp_err_t err = SendHead(rq, -1);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+    char size[16];
+    const int n = snprintf(size, sizeof(size), "%zx\r\n", buf_len);
+    if (!SendAll(rq->sess, size, n) || (buf_len && !SendAll(rq->sess, buf, buf_len))
+        || !SendAll(rq->sess, "\r\n", 2)) {
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg)
+{
+    static const char *status[] = { HTTPD_400, HTTPD_404, HTTPD_408, HTTPD_500 };
+    httpd_resp_set_status(req, status[error]);
+    httpd_resp_set_type(req, HTTPD_TYPE_TEXT);
+    return httpd_resp_sendstr(req, msg ? msg : status[error]);
+}
+
+/* ---- WebSocket ---- */
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *pkt, size_t max_len)
+{
+    struct host_req *rq = req->aux;
+    const int fd = rq->sess->fd;
+    if (!pkt) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!rq->ws_hdr) {
+        uint8_t h[8];
+        if (!RecvAll(fd, h, 2)) {
+            return ESP_FAIL;
+        }
+        pkt->final = h[0] & 0x80;
+        rq->ws_opcode = h[0] & 0x0f;
+        rq->ws_masked = h[1] & 0x80;
+        uint64_t len = h[1] & 0x7f;
+        if (len == 126) {
+            if (!RecvAll(fd, h, 2)) {
+                return ESP_FAIL;
+            }
+            len = (uint64_t)h[0] << 8 | h[1];
+        } else if (len == 127) {
+            if (!RecvAll(fd, h, 8)) {
+                return ESP_FAIL;
+            }
+            len = 0;
+            for (int i = 0; i < 8; i++) {
+                len = len << 8 | h[i];
+            }
+        }
+        if (rq->ws_masked && !RecvAll(fd, rq->ws_mask, 4)) {
+            return ESP_FAIL;
+        }
+        rq->ws_len = (size_t)len;
+        rq->ws_hdr = true;
+    }
+    pkt->type = rq->ws_opcode;
+    pkt->len = rq->ws_len;
+    if (max_len == 0) {
+        return ESP_OK;
+    }
+    if (!pkt->payload) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (max_len < rq->ws_len - rq->ws_read) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const size_t n = rq->ws_len - rq->ws_read;
+    if (!RecvAll(fd, pkt->payload, n)) {
+        return ESP_FAIL;
+    }
+    for (size_t i = 0; i < n && rq->ws_masked; i++) {
+        pkt->payload[i] ^= rq->ws_mask[(rq->ws_read + i) & 3];
+    }
+    rq->ws_read += n;
+    return ESP_OK;
+}
+
+static esp_err_t WsSend(struct host_sess *sess, const httpd_ws_frame_t *frame)
+{
+    uint8_t h[10];
+    size_t n = 2;
+    h[0] = (frame->final || !frame->fragmented ? 0x80 : 0) | frame->type;
+    if (frame->len < 126) {
+        h[1] = (uint8_t)frame->len;
+    } else if (frame->len < 65536) {
+        h[1] = 126;
+        h[2] = (uint8_t)(frame->len >> 8);
+        h[3] = (uint8_t)frame->len;
+        n = 4;
+    } else {
+        h[1] = 127;
+        for (int i = 0; i < 8; i++) {
+            h[2 + i] = (uint8_t)((uint64_t)frame->len >> (56 - i * 8));
+        }
+        n = 10;
+    }
+    pthread_mutex_lock(&sess->send_lock);
+    const bool ok = sess->fd >= 0 && SendAll(sess, h, n) && (!frame->len || SendAll(sess, frame->payload, frame->len));
+    pthread_mutex_unlock(&sess->send_lock);
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t httpd_ws_send_frame(httpd_req_t *req, httpd_ws_frame_t *pkt)
+{
+    if (!req || !pkt) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return WsSend(((struct host_req *)req->aux)->sess, pkt);
+}
+
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame)
+{
+    struct host_httpd *server = hd;
+    if (!server || !frame) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&server->lock);
+    struct host_sess *sess = SessionFind(server, fd);
+    pthread_mutex_unlock(&server->lock);
+    if (!sess || !sess->ws) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return WsSend(sess, frame);
+}
+
+httpd_ws_client_info_t httpd_ws_get_fd_info(httpd_handle_t hd, int fd)
+{
+    struct host_httpd *server = hd;
+    if (!server || fd < 0) {
+        return HTTPD_WS_CLIENT_INVALID;
+    }
+    pthread_mutex_lock(&server->lock);
+    const struct host_sess *sess = SessionFind(server, fd);
+    const httpd_ws_client_info_t info = !sess ? HTTPD_WS_CLIENT_INVALID
+                                        : sess->ws ? HTTPD_WS_CLIENT_WEBSOCKET : HTTPD_WS_CLIENT_HTTP;
+    pthread_mutex_unlock(&server->lock);
+    return info;
+}
@@ -0,0 +1,74 @@
+/*! \file host_util.c
+\brief Helpers shared by the host tests, tools and benchmarks.
+*****/
+#include "host_util.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "esp_app_desc.h"
+
+int host_failures = 0;
+
+esp_app_desc_t host_app_desc = { .version = "host", .project_name = "wifi_Tank" };
+
+const esp_app_desc_t *esp_app_get_description(void)
+{
+    return &host_app_desc;
+}
+
+int64_t HostTimeUs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint8_t *HostReadFile(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return NULL;
+    }
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *buf = malloc(size > 0 ? size : 1);
+    if (buf && fread(buf, 1, size, f) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    if (buf) {
+        *len = size;
+    }
+    return buf;
+}
+
+double HostPsnrRgb888(const uint8_t *ref, const uint8_t *img, int width, int height,
+                      int x, int y, int w, int h, int invert)
+{
+    double sse = 0;
+    long n = 0;
+
+    for (int py = 0; py < height; py++) {
+        for (int px = 0; px < width; px++) {
+            int inside = px >= x && px < x + w && py >= y && py < y + h;
+            if (inside == invert) {
+                continue;
+            }
+            const uint8_t *a = ref + (py * width + px) * 3;
+            const uint8_t *b = img + (py * width + px) * 3;
+            for (int c = 0; c < 3; c++) {
+                double d = (double)a[c] - b[c];
+                sse += d * d;
+            }
+            n += 3;
+        }
+    }
+    if (n == 0 || sse == 0) {
+        return 99.0;
+    }
+    return 10.0 * log10(255.0 * 255.0 * n / sse);
+}
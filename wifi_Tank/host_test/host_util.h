@@ -0,0 +1,59 @@
+/*! \file host_util.h
+\brief Helpers shared by the host tests, tools and benchmarks.
+*****/
+#ifndef HOST_UTIL_H
+#define HOST_UTIL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Monotonic time in microseconds
+ */
+int64_t HostTimeUs(void);
+
+/**
+ * @brief Read a whole file into a malloc'd buffer
+ * @param path File path
+ * @param len Output, number of bytes read
+ * @return Buffer to be freed by the caller, NULL on failure
+ */
+uint8_t *HostReadFile(const char *path, size_t *len);
+
+/**
+ * @brief PSNR of an RGB888 region against a reference
+ * @param ref Reference image, RGB888
+ * @param img Image under test, RGB888, same size as ref
+ * @param width Image width in pixels
+ * @param height Image height in pixels
+ * @param x Region left edge
+ * @param y Region top edge
+ * @param w Region width
+ * @param h Region height
+ * @param invert Measure everything except the region instead
+ * @return PSNR in dB, 99.0 for identical regions
+ */
+double HostPsnrRgb888(const uint8_t *ref, const uint8_t *img, int width, int height,
+                      int x, int y, int w, int h, int invert);
+
+/**
+ * @brief Check a condition and count failures, printing the location
+ */
+#define HOST_CHECK(cond) do {                                                       \
+        if (!(cond)) {                                                              \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);                  \
+            host_failures++;                                                        \
+        }                                                                           \
+    } while (0)
+
+extern int host_failures;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,156 @@
+/*! \file jpeg_band_test.c
+\brief Banded JPEG decoding. Decodes the esp_jpeg test images with
+esp_jpeg_decode_bands() at every scale and output format and checks the bands
+against esp_jpeg_decode() bit for bit, including the older ring slots and
+stopping from the callback.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#define RING_MAX 3
+
+typedef struct {
+    const uint8_t *ref;         // full decode of the same image
+    size_t ref_stride;
+    uint16_t lines;             // full band height from esp_jpeg_get_band_size()
+    uint16_t next_y;
+    uint16_t bands;
+    int stop_at;                // band index to stop at, -1 to decode everything
+    esp_jpeg_band_t ring[RING_MAX];
+    uint8_t ring_count;
+} band_check_t;
+
+static int BandMatches(const band_check_t *chk, const esp_jpeg_band_t *band)
+{
+    for (int y = 0; y < band->height; y++) {
+        if (memcmp(band->data + y * band->stride, chk->ref + (band->y + y) * chk->ref_stride, chk->ref_stride)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static bool CheckBand(const esp_jpeg_band_t *band, void *arg)
+{
+    band_check_t *chk = arg;
+
+    HOST_CHECK(band->index == chk->bands);
+    HOST_CHECK(band->y == chk->next_y);
+    HOST_CHECK(band->height >= 1 && band->height <= chk->lines);
+    HOST_CHECK(band->stride == chk->ref_stride);
+    HOST_CHECK(BandMatches(chk, band));
+
+    // Bands handed out earlier must still be intact until their slot comes round again
+    for (int i = 1; i < chk->ring_count && i <= band->index; i++) {
+        HOST_CHECK(BandMatches(chk, &chk->ring[(band->index - i) % chk->ring_count]));
+    }
+    chk->ring[band->index % chk->ring_count] = *band;
+
+    chk->next_y += band->height;
+    chk->bands++;
+    return band->index != chk->stop_at;
+}
+
+static void TestImage(const char *name, uint8_t *jpg, size_t jpg_len)
+{
+    for (int format = JPEG_IMAGE_FORMAT_RGB888; format <= JPEG_IMAGE_FORMAT_RGB565; format++) {
+        for (int scale = JPEG_IMAGE_SCALE_0; scale <= JPEG_IMAGE_SCALE_1_8; scale++) {
+            esp_jpeg_image_cfg_t cfg = {
+                .indata = jpg,
+                .indata_size = jpg_len,
+                .out_format = format,
+                .out_scale = scale,
+            };
+            esp_jpeg_image_output_t info;
+            HOST_CHECK(esp_jpeg_get_image_info(&cfg, &info) == ESP_OK);
+            cfg.outbuf = malloc(info.output_len);
+            cfg.outbuf_size = info.output_len;
+            HOST_CHECK(esp_jpeg_decode(&cfg, &info) == ESP_OK);
+
+            uint16_t lines = 0;
+            const size_t band_size = esp_jpeg_get_band_size(&cfg, &lines);
+            HOST_CHECK(band_size == (size_t)info.width * lines * (format == JPEG_IMAGE_FORMAT_RGB888 ? 3 : 2));
+
+            for (uint8_t ring = 1; ring <= RING_MAX; ring += RING_MAX - 1) {
+                band_check_t chk = {
+                    .ref = cfg.outbuf,
+                    .ref_stride = info.output_len / info.height,
+                    .lines = lines,
+                    .stop_at = -1,
+                    .ring_count = ring,
+                };
+                uint8_t *buffer = malloc(band_size * ring);
+                esp_jpeg_band_cfg_t band_cfg = {
+                    .callback = CheckBand,
+                    .arg = &chk,
+                    .buffer = buffer,
+                    .buffer_size = band_size * ring,
+                    .band_count = ring,
+                };
+                esp_jpeg_image_output_t band_info;
+                HOST_CHECK(esp_jpeg_decode_bands(&cfg, &band_cfg, &band_info) == ESP_OK);
+                HOST_CHECK(band_info.width == info.width && band_info.height == info.height);
+                HOST_CHECK(chk.next_y == info.height);
+
+                if (ring == 1) {
+                    printf("%-16s %-6s 1/%d %3dx%-3d %2u bands of %2u lines, %5zu bytes (full %zu)\n", name,
+                           format == JPEG_IMAGE_FORMAT_RGB888 ? "RGB888" : "RGB565", 1 << scale,
+                           info.width, info.height, chk.bands, lines, band_size, info.output_len);
+                }
+
+                // A too small ring is refused
+                band_cfg.buffer_size = band_size * ring - 1;
+                HOST_CHECK(esp_jpeg_decode_bands(&cfg, &band_cfg, &band_info) == ESP_ERR_INVALID_ARG);
+                free(buffer);
+            }
+
+            // Internally allocated ring, stopped after the second band
+            band_check_t chk = {
+                .ref = cfg.outbuf,
+                .ref_stride = info.output_len / info.height,
+                .lines = lines,
+                .stop_at = 1,
+                .ring_count = 1,
+            };
+            esp_jpeg_band_cfg_t band_cfg = { .callback = CheckBand, .arg = &chk };
+            esp_jpeg_image_output_t band_info;
+            const esp_err_t ret = esp_jpeg_decode_bands(&cfg, &band_cfg, &band_info);
+            if (info.height > lines) {
+                HOST_CHECK(ret == ESP_FAIL);
+                HOST_CHECK(chk.bands == 2);
+            } else {
+                HOST_CHECK(ret == ESP_OK);
+            }
+            free(cfg.outbuf);
+        }
+    }
+}
+
+int main(void)
+{
+    static const char *images[] = { "usb_camera.jpg", "usb_camera_2.jpg", "logo.jpg" };
+
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, images[i]);
+        size_t len = 0;
+        uint8_t *jpg = HostReadFile(path, &len);
+        HOST_CHECK(jpg != NULL);
+        if (jpg) {
+            TestImage(images[i], jpg, len);
+            free(jpg);
+        }
+    }
+
+    // Missing callback
+    esp_jpeg_image_cfg_t cfg = { 0 };
+    esp_jpeg_band_cfg_t band_cfg = { 0 };
+    esp_jpeg_image_output_t info;
+    HOST_CHECK(esp_jpeg_decode_bands(&cfg, &band_cfg, &info) == ESP_ERR_INVALID_ARG);
+
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
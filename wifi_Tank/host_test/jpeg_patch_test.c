@@ -0,0 +1,236 @@
+/*! \file jpeg_patch_test.c
+\brief jpg_patch() on the esp_jpeg test images (4:2:2 with restart intervals
+and the default Huffman tables, 4:2:2, 4:4:4) and on HD 4:2:0 and grayscale
+frames from fmt2jpg. A callback that draws nothing gives the source back
+decoding exactly as it did, and byte for byte when the source is coded the way
+jpg_patch() codes (fmt2jpg pads and tables); a filled rectangle decodes as its
+colour, and every MCU outside the rectangles decodes exactly as in the source.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#define HD_W 1280
+#define HD_H 720
+
+typedef struct {
+    const char *name;
+    uint8_t *jpg;
+    size_t len;
+    int width;
+    int height;
+    int mcu_w;
+    int mcu_h;
+    bool canonical;             // coded as jpg_patch() codes, so an untouched MCU keeps its bytes
+    bool gray;
+} image_t;
+
+typedef struct {
+    jpg_roi_rect_t rect;
+    uint8_t rgb[3];
+    int calls;
+} fill_t;
+
+static void NoDraw(void *arg, uint8_t *rgb, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    (*(int *)arg)++;
+}
+
+static void Fill(void *arg, uint8_t *rgb, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    fill_t *f = arg;
+    f->calls++;
+    for (int py = 0; py < h; py++) {
+        for (int px = 0; px < w; px++) {
+            const int ix = x + px, iy = y + py;
+            if (ix >= f->rect.x && ix < f->rect.x + f->rect.w && iy >= f->rect.y && iy < f->rect.y + f->rect.h) {
+                memcpy(&rgb[(py * w + px) * 3], f->rgb, 3);
+            }
+        }
+    }
+}
+
+static uint8_t *Decode(const uint8_t *jpg, size_t len, int width, int height)
+{
+    uint8_t *rgb = malloc(width * height * 3 + 8 * 8 * 3);
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = (uint8_t *)jpg,
+        .indata_size = len,
+        .outbuf = rgb,
+        .outbuf_size = width * height * 3,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888,
+    };
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_decode(&cfg, &img) != ESP_OK || img.width != width || img.height != height) {
+        free(rgb);
+        return NULL;
+    }
+    return rgb;
+}
+
+// A patch that draws nothing changes no pixel, however much it decodes and codes again
+static void CheckIdentity(const image_t *im, const uint8_t *ref)
+{
+    const jpg_roi_rect_t rects[] = {
+        { 0, 0, (uint16_t)im->width, (uint16_t)im->height },
+        { (uint16_t)(im->width / 3), (uint16_t)(im->height / 3), 9, 9 },
+        { (uint16_t)(im->width - 1), (uint16_t)(im->height - 1), 1, 1 },
+        { 0, 0, 1, 1 },
+    };
+    uint8_t *out = malloc(im->len + 4096);
+    for (size_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+        int calls = 0;
+        size_t len = 0;
+        HOST_CHECK(jpg_patch(im->jpg, im->len, &rects[i], 1, NoDraw, &calls, out, im->len + 4096, &len));
+        HOST_CHECK(calls > 0);
+        if (im->canonical) {
+            HOST_CHECK(len == im->len && memcmp(out, im->jpg, len) == 0);
+        }
+        uint8_t *img = Decode(out, len, im->width, im->height);
+        HOST_CHECK(img != NULL && memcmp(img, ref, im->width * im->height * 3) == 0);
+        free(img);
+    }
+    size_t len = 0;
+    int calls = 0;
+    HOST_CHECK(jpg_patch(im->jpg, im->len, NULL, 0, NoDraw, &calls, out, im->len + 4096, &len));
+    HOST_CHECK(calls == 0 && len == im->len && memcmp(out, im->jpg, len) == 0);
+    HOST_CHECK(!jpg_patch(im->jpg, im->len, rects, 1, NoDraw, &calls, out, im->len / 2, &len));
+    free(out);
+}
+
+static void CheckFill(const image_t *im, const uint8_t *ref, jpg_roi_rect_t rect, const uint8_t color[3])
+{
+    fill_t f = { .rect = rect };
+    memcpy(f.rgb, color, 3);
+    const size_t cap = im->len * 2 + 4096;
+    uint8_t *out = malloc(cap);
+    size_t len = 0;
+    HOST_CHECK(jpg_patch(im->jpg, im->len, &rect, 1, Fill, &f, out, cap, &len));
+    uint8_t *img = Decode(out, len, im->width, im->height);
+    HOST_CHECK(img != NULL);
+    if (!img) {
+        free(out);
+        return;
+    }
+
+    // the MCUs the rectangle touches
+    const int mx0 = rect.x / im->mcu_w * im->mcu_w, my0 = rect.y / im->mcu_h * im->mcu_h;
+    const int mx1 = (rect.x + rect.w + im->mcu_w - 1) / im->mcu_w * im->mcu_w;
+    const int my1 = (rect.y + rect.h + im->mcu_h - 1) / im->mcu_h * im->mcu_h;
+    HOST_CHECK(f.calls == (mx1 - mx0) / im->mcu_w * ((my1 - my0) / im->mcu_h));
+    // a grayscale frame keeps the luma of the colour
+    uint8_t want[3] = { color[0], color[1], color[2] };
+    if (im->gray) {
+        want[0] = want[1] = want[2] = (uint8_t)((299 * color[0] + 587 * color[1] + 114 * color[2] + 500) / 1000);
+    }
+    long outside_diff = 0, inside_err = 0, inside_n = 0;
+    int inside_max = 0;
+    for (int y = 0; y < im->height; y++) {
+        for (int x = 0; x < im->width; x++) {
+            const int i = (y * im->width + x) * 3;
+            if (x < mx0 || x >= mx1 || y < my0 || y >= my1) {
+                outside_diff += memcmp(&img[i], &ref[i], 3) != 0;
+            } else if (x >= rect.x + 4 && x < rect.x + rect.w - 4 && y >= rect.y + 4 && y < rect.y + rect.h - 4) {
+                for (int c = 0; c < 3; c++) {
+                    const int e = abs(img[i + c] - want[c]);
+                    inside_err += e;
+                    inside_max = e > inside_max ? e : inside_max;
+                }
+                inside_n += 3;
+            }
+        }
+    }
+    const double mean = inside_n ? (double)inside_err / inside_n : 0;
+    printf("  %-18s fill %4ux%-4u at %4u,%-4u %6zu -> %6zu bytes, %d MCUs, error mean %.1f max %d\n",
+           im->name, rect.w, rect.h, rect.x, rect.y, im->len, len, f.calls, mean, inside_max);
+    HOST_CHECK(outside_diff == 0);
+    HOST_CHECK(mean < 6 && inside_max < 48);
+    free(img);
+    free(out);
+}
+
+static void CheckImage(image_t *im)
+{
+    uint8_t *ref = Decode(im->jpg, im->len, im->width, im->height);
+    HOST_CHECK(ref != NULL);
+    if (!ref) {
+        return;
+    }
+    CheckIdentity(im, ref);
+
+    static const uint8_t red[3] = { 230, 20, 20 }, white[3] = { 255, 255, 255 }, dark[3] = { 30, 60, 40 };
+    const uint16_t w = (uint16_t)im->width, h = (uint16_t)im->height;
+    CheckFill(im, ref, (jpg_roi_rect_t) { 0, 0, (uint16_t)(w / 4 + 3), (uint16_t)(h / 5 + 5) }, red);
+    CheckFill(im, ref, (jpg_roi_rect_t) { (uint16_t)(w / 3 + 5), (uint16_t)(h / 2 + 3), (uint16_t)(w / 5 + 7), 11 },
+              white);
+    CheckFill(im, ref, (jpg_roi_rect_t) { (uint16_t)(w - w / 6), (uint16_t)(h - h / 7), (uint16_t)(w / 6),
+                                          (uint16_t)(h / 7) }, dark);
+    free(ref);
+}
+
+static image_t LoadImage(const char *file, int mcu_w, int mcu_h)
+{
+    char path[512];
+    image_t im = { .name = file, .mcu_w = mcu_w, .mcu_h = mcu_h };
+    snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, file);
+    im.jpg = HostReadFile(path, &im.len);
+    esp_jpeg_image_cfg_t cfg = { .indata = im.jpg, .indata_size = im.len };
+    esp_jpeg_image_output_t info;
+    HOST_CHECK(im.jpg != NULL && esp_jpeg_get_image_info(&cfg, &info) == ESP_OK);
+    im.width = info.width;
+    im.height = info.height;
+    return im;
+}
+
+static image_t MakeImage(const char *name, int width, int height, pixformat_t format)
+{
+    image_t im = { .name = name, .width = width, .height = height };
+    const int bpp = format == PIXFORMAT_GRAYSCALE ? 1 : 3;
+    uint8_t *pix = malloc(width * height * bpp);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint8_t *p = &pix[(y * width + x) * bpp];
+            p[0] = (uint8_t)((((x / 6) * 7) ^ ((y / 6) * 13)) & 0x7f) + y / 8;
+            if (bpp == 3) {
+                p[1] = (uint8_t)((((x / 6) * 5) ^ ((y / 6) * 3)) & 0x3f) + x / 12;
+                p[2] = (uint8_t)((x + y) & 0x7f);
+            }
+        }
+    }
+    HOST_CHECK(fmt2jpg(pix, width * height * bpp, width, height, format, 50, &im.jpg, &im.len));
+    im.mcu_w = im.mcu_h = format == PIXFORMAT_GRAYSCALE ? 8 : 16;
+    im.canonical = true;
+    im.gray = format == PIXFORMAT_GRAYSCALE;
+    free(pix);
+    return im;
+}
+
+int main(void)
+{
+    image_t images[] = {
+        LoadImage("usb_camera.jpg", 16, 8),
+        LoadImage("usb_camera_2.jpg", 16, 8),
+        LoadImage("logo.jpg", 8, 8),
+        MakeImage("HD 4:2:0", HD_W, HD_H, PIXFORMAT_RGB888),
+        MakeImage("grayscale", 320, 240, PIXFORMAT_GRAYSCALE),
+    };
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        printf("%s %dx%d, %zu bytes\n", images[i].name, images[i].width, images[i].height, images[i].len);
+        CheckImage(&images[i]);
+        free(images[i].jpg);
+    }
+
+    // not a JPEG it can patch
+    static const uint8_t junk[] = { 0xff, 0xd8, 0xff, 0xc2, 0x00, 0x04, 0x08, 0x00, 0xff, 0xd9 };
+    uint8_t out[64];
+    size_t len = 0;
+    int calls = 0;
+    const jpg_roi_rect_t all = { 0, 0, 100, 100 };
+    HOST_CHECK(!jpg_patch(junk, sizeof(junk), &all, 1, NoDraw, &calls, out, sizeof(out), &len));
+
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
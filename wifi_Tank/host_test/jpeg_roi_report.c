@@ -0,0 +1,150 @@
+/*! \file jpeg_roi_report.c
+\brief Region of interest JPEG encoding report. Encodes the esp_jpeg test
+images with and without a centre ROI, decodes both and prints the size saving
+and the PSNR inside and outside the ROI.
+
+Usage: jpeg_roi_report [quality] [outside_coeffs] [outside_threshold]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#include "test_logo_rgb888.h"
+#include "test_usb_camera_rgb888.h"
+#include "test_usb_camera_2_rgb888.h"
+
+typedef struct {
+    const char *name;
+    int width;
+    int height;
+    uint8_t *rgb;           // reference, RGB888
+} roi_image_t;
+
+// Unpack the 0xBBGGRR words used by the usb_camera references
+static uint8_t *UnpackWords(const unsigned int *words, int count)
+{
+    uint8_t *rgb = malloc(count * 3);
+    for (int i = 0; i < count; i++) {
+        rgb[i * 3 + 0] = words[i] & 0xff;
+        rgb[i * 3 + 1] = (words[i] >> 8) & 0xff;
+        rgb[i * 3 + 2] = (words[i] >> 16) & 0xff;
+    }
+    return rgb;
+}
+
+// Encode RGB888 with an optional ROI, returns the JPEG size or 0
+static size_t Encode(const roi_image_t *img, int quality, const jpg_roi_t *roi, uint8_t **jpg)
+{
+    // Camera RGB888 frames are stored BGR, the encoder swaps back
+    size_t len = img->width * img->height * 3;
+    uint8_t *bgr = malloc(len);
+    for (size_t i = 0; i < len; i += 3) {
+        bgr[i + 0] = img->rgb[i + 2];
+        bgr[i + 1] = img->rgb[i + 1];
+        bgr[i + 2] = img->rgb[i + 0];
+    }
+    size_t jpg_len = 0;
+    if (!fmt2jpg_roi(bgr, len, img->width, img->height, PIXFORMAT_RGB888, quality, roi, jpg, &jpg_len)) {
+        jpg_len = 0;
+    }
+    free(bgr);
+    return jpg_len;
+}
+
+static uint8_t *Decode(const roi_image_t *img, uint8_t *jpg, size_t jpg_len)
+{
+    uint8_t *out = malloc(img->width * img->height * 3);
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = jpg,
+        .indata_size = jpg_len,
+        .outbuf = out,
+        .outbuf_size = img->width * img->height * 3,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888,
+        .out_scale = JPEG_IMAGE_SCALE_0,
+    };
+    esp_jpeg_image_output_t info;
+    if (esp_jpeg_decode(&cfg, &info) != ESP_OK || info.width != img->width || info.height != img->height) {
+        free(out);
+        return NULL;
+    }
+    return out;
+}
+
+// Size of the MCU aligned area the encoder keeps at full quality (H2V2, 16x16 MCUs)
+static void AlignToMcu(const jpg_roi_rect_t *r, int width, int height, jpg_roi_rect_t *out)
+{
+    int x0 = r->x & ~15, y0 = r->y & ~15;
+    int x1 = (r->x + r->w + 15) & ~15, y1 = (r->y + r->h + 15) & ~15;
+    out->x = x0;
+    out->y = y0;
+    out->w = (x1 > width ? width : x1) - x0;
+    out->h = (y1 > height ? height : y1) - y0;
+}
+
+int main(int argc, char **argv)
+{
+    int quality = argc > 1 ? atoi(argv[1]) : 80;
+    int coeffs = argc > 2 ? atoi(argv[2]) : 6;
+    int threshold = argc > 3 ? atoi(argv[3]) : 1;
+
+    roi_image_t images[] = {
+        { "logo", 46, 46, logo_rgb888 },
+        { "usb_camera", 160, 120, UnpackWords(jpeg_no_huffman_rgb888, 160 * 120) },
+        { "usb_camera_2", 160, 120, UnpackWords(usb_camera_2_rgb888, 160 * 120) },
+    };
+
+    printf("quality %d, outside: %d coefficients, threshold %d\n", quality, coeffs, threshold);
+    printf("%-14s %8s %8s %7s | %-17s | %-17s\n", "image", "full", "roi", "saved",
+           "PSNR in full/roi", "PSNR out full/roi");
+
+    for (size_t i = 0; i < sizeof(images) / sizeof(images[0]); i++) {
+        const roi_image_t *img = &images[i];
+
+        // Centre half of the frame, where the crosshair overlay sits
+        jpg_roi_rect_t rect = { img->width / 4, img->height / 4, img->width / 2, img->height / 2 };
+        jpg_roi_t roi = { .rects = &rect, .count = 1, .outside_coeffs = coeffs, .outside_threshold = threshold };
+
+        uint8_t *full_jpg = NULL, *roi_jpg = NULL;
+        size_t full_len = Encode(img, quality, NULL, &full_jpg);
+        size_t roi_len = Encode(img, quality, &roi, &roi_jpg);
+        HOST_CHECK(full_len > 0 && roi_len > 0);
+        if (!full_len || !roi_len) {
+            continue;
+        }
+
+        uint8_t *full_rgb = Decode(img, full_jpg, full_len);
+        uint8_t *roi_rgb = Decode(img, roi_jpg, roi_len);
+        HOST_CHECK(full_rgb && roi_rgb);
+        if (full_rgb && roi_rgb) {
+            jpg_roi_rect_t m;
+            AlignToMcu(&rect, img->width, img->height, &m);
+            double in_full = HostPsnrRgb888(img->rgb, full_rgb, img->width, img->height, m.x, m.y, m.w, m.h, 0);
+            double in_roi = HostPsnrRgb888(img->rgb, roi_rgb, img->width, img->height, m.x, m.y, m.w, m.h, 0);
+            double out_full = HostPsnrRgb888(img->rgb, full_rgb, img->width, img->height, m.x, m.y, m.w, m.h, 1);
+            double out_roi = HostPsnrRgb888(img->rgb, roi_rgb, img->width, img->height, m.x, m.y, m.w, m.h, 1);
+
+            printf("%-14s %8zu %8zu %6.1f%% | %7.2f / %7.2f | %7.2f / %7.2f\n", img->name, full_len, roi_len,
+                   100.0 * (double)(full_len - roi_len) / full_len, in_full, in_roi, out_full, out_roi);
+
+            // ROI blocks are coded identically, so the decoded ROI must match bit for bit
+            for (int y = m.y; y < m.y + m.h; y++) {
+                const size_t ofs = (y * img->width + m.x) * 3;
+                HOST_CHECK(memcmp(full_rgb + ofs, roi_rgb + ofs, m.w * 3) == 0);
+            }
+            HOST_CHECK(roi_len <= full_len);
+            HOST_CHECK(out_roi <= out_full + 0.01);
+        }
+        free(full_rgb);
+        free(roi_rgb);
+        free(full_jpg);
+        free(roi_jpg);
+    }
+
+    for (size_t i = 1; i < sizeof(images) / sizeof(images[0]); i++) {
+        free(images[i].rgb);
+    }
+    return host_failures ? 1 : 0;
+}
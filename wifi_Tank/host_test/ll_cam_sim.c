@@ -0,0 +1,239 @@
+/*! \file ll_cam_sim.c
+\brief ll_cam for the host: an ESP32-S3 style JPEG DMA model driven by the
+test, see cam_sim.h.
+*****/
+#include <string.h>
+#include <pthread.h>
+#include "ll_cam.h"
+#include "cam_hal.h"
+#include "cam_sim.h"
+
+static cam_obj_t *sim_cam;
+static bool sim_running;        // DMA started, EOF interrupt enabled
+static bool sim_vsync_enabled;
+static int sim_frame_pos;
+static size_t sim_dma_pos;      // bytes written since ll_cam_start()
+static cam_sim_stats_t sim_stats;
+static bool sim_stalled;        // cam_task blocks in ll_cam_memcpy(), events pile up
+static pthread_mutex_t sim_stall_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sim_stall_cond = PTHREAD_COND_INITIALIZER;
+
+bool ll_cam_stop(cam_obj_t *cam)
+{
+    sim_running = false;
+    return true;
+}
+
+bool ll_cam_start(cam_obj_t *cam, int frame_pos)
+{
+    sim_frame_pos = frame_pos;
+    sim_dma_pos = 0;
+    sim_running = true;
+    sim_stats.starts++;
+    if (cam->frames[frame_pos].ref) {
+        sim_stats.busy_starts++;
+    }
+    return true;
+}
+
+esp_err_t ll_cam_config(cam_obj_t *cam, const camera_config_t *config)
+{
+    sim_cam = cam;
+    return ESP_OK;
+}
+
+esp_err_t ll_cam_deinit(cam_obj_t *cam)
+{
+    sim_cam = NULL;
+    return ESP_OK;
+}
+
+void ll_cam_vsync_intr_enable(cam_obj_t *cam, bool en)
+{
+    sim_vsync_enabled = en;
+}
+
+esp_err_t ll_cam_set_pin(cam_obj_t *cam, const camera_config_t *config)
+{
+    return ESP_OK;
+}
+
+esp_err_t ll_cam_init_isr(cam_obj_t *cam)
+{
+    return ESP_OK;
+}
+
+void ll_cam_do_vsync(cam_obj_t *cam)
+{
+}
+
+uint8_t ll_cam_get_dma_align(cam_obj_t *cam)
+{
+    return 16;
+}
+
+bool ll_cam_dma_sizes(cam_obj_t *cam)
+{
+    if (!cam->jpeg_mode) {
+        return false;   // the model only covers JPEG
+    }
+    cam->dma_bytes_per_item = 1;
+    if (cam->psram_mode) {
+        cam->dma_buffer_size = cam->recv_size;
+        cam->dma_half_buffer_size = 1024;
+        cam->dma_half_buffer_cnt = cam->dma_buffer_size / cam->dma_half_buffer_size;
+        cam->dma_node_buffer_size = cam->dma_half_buffer_size;
+    } else {
+        cam->dma_half_buffer_cnt = 16;
+        cam->dma_buffer_size = cam->dma_half_buffer_cnt * 1024;
+        cam->dma_half_buffer_size = cam->dma_buffer_size / cam->dma_half_buffer_cnt;
+        cam->dma_node_buffer_size = cam->dma_half_buffer_size;
+    }
+    return true;
+}
+
+size_t ll_cam_memcpy(cam_obj_t *cam, uint8_t *out, const uint8_t *in, size_t len)
+{
+    pthread_mutex_lock(&sim_stall_lock);
+    while (sim_stalled) {
+        pthread_cond_wait(&sim_stall_cond, &sim_stall_lock);
+    }
+    pthread_mutex_unlock(&sim_stall_lock);
+    memcpy(out, in, len);
+    sim_stats.copied += len;
+    sim_stats.copies++;
+    return len;
+}
+
+esp_err_t ll_cam_set_sample_mode(cam_obj_t *cam, pixformat_t pix_format, uint32_t xclk_freq_hz, uint16_t sensor_pid)
+{
+    cam->in_bytes_per_pixel = 1;
+    cam->fb_bytes_per_pixel = 1;
+    return pix_format == PIXFORMAT_JPEG ? ESP_OK : ESP_ERR_NOT_SUPPORTED;
+}
+
+void ll_cam_dma_print_state(cam_obj_t *cam)
+{
+}
+
+void ll_cam_dma_reset(cam_obj_t *cam)
+{
+}
+
+// Write through the descriptor ring the DMA is currently on, wrapping like the hardware
+static void SimDmaWrite(const uint8_t *data, size_t len)
+{
+    if (!sim_running) {
+        sim_stats.dropped += len;
+        return;
+    }
+    lldesc_t *dma = sim_cam->psram_mode ? sim_cam->frames[sim_frame_pos].dma : sim_cam->dma;
+    const size_t node = sim_cam->dma_node_buffer_size;
+    while (len) {
+        lldesc_t *desc = &dma[(sim_dma_pos / node) % sim_cam->dma_node_cnt];
+        size_t ofs = sim_dma_pos % node;
+        size_t n = node - ofs < len ? node - ofs : len;
+        memcpy((uint8_t *)desc->buf + ofs, data, n);
+        data += n;
+        len -= n;
+        sim_dma_pos += n;
+        sim_stats.dma_bytes += n;
+    }
+}
+
+static void SimEvent(cam_event_t event)
+{
+    BaseType_t woken = pdFALSE;
+    ll_cam_send_event(sim_cam, event, &woken);
+    if (!sim_stalled) {
+        HostQueueWaitIdle(sim_cam->event_queue);
+    }
+}
+
+esp_err_t CamSimInit(framesize_t frame_size, size_t fb_count, camera_fb_location_t fb_location,
+                     camera_grab_mode_t grab_mode)
+{
+    camera_config_t config = {
+        .pixel_format = PIXFORMAT_JPEG,
+        .frame_size = frame_size,
+        .fb_count = fb_count,
+        .fb_location = fb_location,
+        .grab_mode = grab_mode,
+    };
+    memset(&sim_stats, 0, sizeof(sim_stats));
+    esp_err_t ret = cam_init(&config);
+    if (ret == ESP_OK) {
+        ret = cam_config(&config, frame_size, OV3660_PID);
+    }
+    if (ret == ESP_OK) {
+        // cam_task resets the event queue when it starts, wait for that
+        HostQueueWaitIdle(sim_cam->event_queue);
+        cam_start();
+    }
+    return ret;
+}
+
+void CamSimWaitReady(void)
+{
+    HostQueueWaitIdle(sim_cam->event_queue);
+}
+
+bool CamSimStarted(void)
+{
+    return sim_vsync_enabled;
+}
+
+void CamSimDeinit(void)
+{
+    cam_deinit();
+}
+
+void CamSimVsync(void)
+{
+    if (sim_vsync_enabled) {
+        SimEvent(CAM_VSYNC_EVENT);
+    }
+}
+
+void CamSimFrame(const uint8_t *data, size_t len)
+{
+    const size_t transfer = sim_cam->dma_half_buffer_size;
+    for (size_t ofs = 0; ofs < len; ofs += transfer) {
+        const size_t n = len - ofs < transfer ? len - ofs : transfer;
+        const bool running = sim_running;
+        SimDmaWrite(data + ofs, n);
+        if (n == transfer && running) {
+            SimEvent(CAM_IN_SUC_EOF_EVENT);
+        } else {
+            // The sensor pads the last transfer until VSYNC
+            static const uint8_t pad[256];
+            for (size_t left = transfer - n; left; ) {
+                const size_t p = left < sizeof(pad) ? left : sizeof(pad);
+                SimDmaWrite(pad, p);
+                left -= p;
+            }
+        }
+    }
+    CamSimVsync();
+}
+
+void CamSimStall(bool stall)
+{
+    pthread_mutex_lock(&sim_stall_lock);
+    sim_stalled = stall;
+    pthread_cond_broadcast(&sim_stall_cond);
+    pthread_mutex_unlock(&sim_stall_lock);
+    if (!stall) {
+        HostQueueWaitIdle(sim_cam->event_queue);
+    }
+}
+
+size_t CamSimTransferSize(void)
+{
+    return sim_cam->dma_half_buffer_size;
+}
+
+cam_sim_stats_t CamSimStats(void)
+{
+    return sim_stats;
+}
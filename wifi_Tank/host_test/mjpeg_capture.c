@@ -0,0 +1,104 @@
+/*! \file mjpeg_capture.c
+\brief Records the body of /stream from the host streaming stack
+(stream_sim.c, synthetic HD frames) as a client receives it, for
+player_parse_test.js. Next to the capture it writes what a parser must find
+in it, counted here with a plain search for the part delimiters: the
+boundary, the number of complete parts and their total length.
+
+Usage: mjpeg_capture <capture file> [seconds]
+
+The port is 18085 or STREAM_SIM_PORT.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "esp_timer.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18085
+#define TIMEOUT_MS 5000
+#define FPS 30
+#define MAX_CAPTURE (64 * 1024 * 1024)
+
+static const uint8_t *Find(const uint8_t *p, const uint8_t *end, const char *s)
+{
+    const size_t n = strlen(s);
+    for (; p + n <= end; p++) {
+        if (*p == (uint8_t)s[0] && memcmp(p, s, n) == 0) {
+            return p;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        printf("usage: %s <capture file> [seconds]\n", argv[0]);
+        return 2;
+    }
+    const double seconds = argc > 2 ? atof(argv[2]) : 3.0;
+    const char *env = getenv("STREAM_SIM_PORT");
+    const uint16_t port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+    const stream_sim_config_t config = { .fps = FPS, .port = port, .seed = 9 };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+
+    stream_client_t c;
+    HOST_CHECK(StreamClientGet(&c, port, "/stream", TIMEOUT_MS) && c.status == 200);
+    const char *boundary = strstr(c.content_type, "boundary=");
+    HOST_CHECK(boundary != NULL);
+    uint8_t *buf = malloc(MAX_CAPTURE);
+    size_t len = 0;
+    const int64_t until = esp_timer_get_time() + (int64_t)(seconds * 1000000);
+    while (boundary && len < MAX_CAPTURE && esp_timer_get_time() < until) {
+        const size_t n = StreamClientRead(&c, buf + len, MAX_CAPTURE - len < 16384 ? MAX_CAPTURE - len : 16384);
+        if (!n) {
+            break;
+        }
+        len += n;
+    }
+    StreamClientClose(&c);
+    StreamSimStop();
+
+    // Complete parts: a delimiter, headers, and all of Content-Length after them
+    char delimiter[128];
+    snprintf(delimiter, sizeof(delimiter), "--%s\r\n", boundary ? boundary + 9 : "");
+    unsigned parts = 0;
+    size_t part_bytes = 0;
+    const uint8_t *end = buf + len;
+    for (const uint8_t *p = Find(buf, end, delimiter); p; p = Find(p + 1, end, delimiter)) {
+        const uint8_t *head_end = Find(p, end, "\r\n\r\n");
+        const uint8_t *length = Find(p, head_end ? head_end : p, "Content-Length: ");
+        if (!head_end || !length) {
+            break;
+        }
+        const size_t n = strtoul((const char *)length + 16, NULL, 10);
+        if (head_end + 4 + n > end) {
+            break;
+        }
+        parts++;
+        part_bytes += n;
+    }
+
+    FILE *f = fopen(argv[1], "wb");
+    HOST_CHECK(f != NULL && fwrite(buf, 1, len, f) == len);
+    if (f) {
+        fclose(f);
+    }
+    char path[1024];
+    snprintf(path, sizeof(path), "%s.json", argv[1]);
+    f = fopen(path, "w");
+    HOST_CHECK(f != NULL);
+    if (f) {
+        fprintf(f, "{\"boundary\": \"%s\", \"parts\": %u, \"part_bytes\": %zu, \"bytes\": %zu}\n",
+                boundary ? boundary + 9 : "", parts, part_bytes, len);
+        fclose(f);
+    }
+    HOST_CHECK(parts > 0);
+    printf("%zu bytes, %u complete parts (%zu bytes) in %s\n", len, parts, part_bytes, argv[1]);
+    free(buf);
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
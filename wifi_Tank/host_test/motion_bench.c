@@ -0,0 +1,109 @@
+/*! \file motion_bench.c
+\brief Per frame cost of motion detection on HD camera style frames: the full
+decode, the 1/8 decode, the DC map alone and MotionDetectorProcess() with the
+background comparison and labelling.
+
+Usage: motion_bench [iterations]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "motion.h"
+#include "img_converters.h"
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define HD_W 1280
+#define HD_H 720
+
+static uint8_t work[ESP_JPEG_WORK_BUF_SIZE];
+
+static double TimeDecode(const uint8_t *jpg, size_t len, esp_jpeg_image_scale_t scale, uint8_t *out, int iterations)
+{
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        esp_jpeg_image_cfg_t cfg = {
+            .indata = (uint8_t *)jpg, .indata_size = len, .outbuf = out, .outbuf_size = HD_W * HD_H * 3,
+            .out_format = JPEG_IMAGE_FORMAT_RGB888, .out_scale = scale,
+            .advanced.working_buffer = work, .advanced.working_buffer_size = sizeof(work),
+        };
+        esp_jpeg_image_output_t img;
+        esp_jpeg_decode(&cfg, &img);
+    }
+    return (HostTimeUs() - start) / 1000.0 / iterations;
+}
+
+static double TimeMap(const uint8_t *jpg, size_t len, uint8_t *out, int iterations)
+{
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        esp_jpeg_image_cfg_t cfg = {
+            .indata = (uint8_t *)jpg, .indata_size = len, .outbuf = out, .outbuf_size = HD_W * HD_H * 3,
+            .advanced.working_buffer = work, .advanced.working_buffer_size = sizeof(work),
+        };
+        esp_jpeg_image_output_t img;
+        esp_jpeg_decode_dc_map(&cfg, &img);
+    }
+    return (HostTimeUs() - start) / 1000.0 / iterations;
+}
+
+// Two frames with a box in another place, analysed in turn: a change every frame
+static double TimeDetector(uint8_t *const jpg[2], const size_t len[2], int iterations)
+{
+    const motion_config_t config = MOTION_DEFAULT_CONFIG();
+    motion_detector_t *m = MotionDetectorCreate(&config, HD_W, HD_H);
+    MotionDetectorProcess(m, jpg[0], len[0], 0, 0, NULL);
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        MotionDetectorProcess(m, jpg[i & 1], len[i & 1], i, i * 200000LL, NULL);
+    }
+    const double ms = (HostTimeUs() - start) / 1000.0 / iterations;
+    MotionDetectorFree(m);
+    return ms;
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 50;
+
+    // HD frame: the usb_camera reference scaled up 8x6 with some sensor noise, a dark box moving between two
+    uint8_t *bgr = malloc(HD_W * HD_H * 3);
+    uint8_t *out = malloc(HD_W * HD_H * 3);
+    printf("%d iterations, ms per HD frame\n", iterations);
+    printf("%-8s %7s %9s %9s %9s %9s\n", "quality", "kB", "full", "1/8", "DC map", "detector");
+    static const int qualities[] = { 12, 30, 50, 80 };
+    for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+        uint8_t *jpg[2] = { NULL, NULL };
+        size_t len[2] = { 0, 0 };
+        for (int f = 0; f < 2; f++) {
+            uint32_t seed = 1 + f;
+            for (int y = 0; y < HD_H; y++) {
+                for (int x = 0; x < HD_W; x++) {
+                    const unsigned int word = jpeg_no_huffman_rgb888[(y / 6) * 160 + x / 8];
+                    const bool box = x >= 200 + f * 400 && x < 360 + f * 400 && y >= 300 && y < 460;
+                    uint8_t *p = bgr + (y * HD_W + x) * 3;
+                    for (int c = 0; c < 3; c++) {
+                        seed = seed * 1103515245 + 12345;
+                        const int v = box ? 20 : (int)((word >> (16 - 8 * c)) & 0xff) + (int)(seed >> 29) - 4;
+                        p[c] = v < 0 ? 0 : v > 255 ? 255 : v;
+                    }
+                }
+            }
+            fmt2jpg(bgr, HD_W * HD_H * 3, HD_W, HD_H, PIXFORMAT_RGB888, qualities[q], &jpg[f], &len[f]);
+        }
+        if (jpg[0] && jpg[1]) {
+            const int full_iterations = iterations / 5 > 0 ? iterations / 5 : 1;
+            printf("q%-7d %7u %9.3f %9.3f %9.3f %9.3f\n", qualities[q], (unsigned)(len[0] / 1024),
+                   TimeDecode(jpg[0], len[0], JPEG_IMAGE_SCALE_0, out, full_iterations),
+                   TimeDecode(jpg[0], len[0], JPEG_IMAGE_SCALE_1_8, out, iterations),
+                   TimeMap(jpg[0], len[0], out, iterations), TimeDetector(jpg, len, iterations));
+        }
+        free(jpg[0]);
+        free(jpg[1]);
+    }
+    free(bgr);
+    free(out);
+    return 0;
+}
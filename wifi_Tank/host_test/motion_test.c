@@ -0,0 +1,374 @@
+/*! \file motion_test.c
+\brief main/motion.c. The DC map of jd_decomp_dc() is bit exact with the 1/8
+decode for grayscale frames at both tjpgd levels, odd sizes included, and
+close to its luma for color ones. On synthetic scenes the detector stays quiet
+on a still scene with sensor noise and through an exposure step, relearns
+when the light changes, and boxes a moving object from the START of its event
+to the END hold_ms after it left, two objects as two boxes. On the host
+streaming stack (stream_sim.c) the service captures by itself while no stream
+runs and GET /motion reports the events.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "motion.h"
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "img_converters.h"
+#include "jpeg_decoder.h"
+#include "tjpgd_ref.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18092
+#define TIMEOUT_MS 5000
+#define FPS 10
+#define SCENE_W 640
+#define SCENE_H 480
+#define STEP_US 200000          // MOTION_DEFAULT_CONFIG() interval
+#define MAX_EVENTS 64
+
+static uint16_t port;
+static uint32_t noise_seed = 1;
+
+typedef struct {
+    int x;
+    int y;
+    int size;
+} object_t;
+
+// Textured scene of mid tones, brightness added, objects drawn dark, sensor noise of +-3
+static void DrawScene(uint8_t *rgb, int brightness, const object_t *objects, int count)
+{
+    for (int y = 0; y < SCENE_H; y++) {
+        for (int x = 0; x < SCENE_W; x++) {
+            int v = 60 + (((x / 5) * 7) ^ ((y / 5) * 11)) % 100 + brightness;
+            for (int i = 0; i < count; i++) {
+                if (x >= objects[i].x && x < objects[i].x + objects[i].size && y >= objects[i].y &&
+                    y < objects[i].y + objects[i].size) {
+                    v = 10;
+                }
+            }
+            uint8_t *p = &rgb[(y * SCENE_W + x) * 3];
+            for (int c = 0; c < 3; c++) {
+                noise_seed = noise_seed * 1103515245 + 12345;
+                const int n = v + (int)(noise_seed >> 29) - 3 + c * 4;
+                p[c] = n < 0 ? 0 : n > 255 ? 255 : n;
+            }
+        }
+    }
+}
+
+static uint8_t *Encode(const uint8_t *pix, int w, int h, pixformat_t format, int quality, size_t *len)
+{
+    uint8_t *jpg = NULL;
+    const size_t pix_len = (size_t)w * h * (format == PIXFORMAT_GRAYSCALE ? 1 : 3);
+    return fmt2jpg((uint8_t *)pix, pix_len, w, h, format, quality, &jpg, len) ? jpg : NULL;
+}
+
+// The DC map at level 2, through the renamed reference build
+static bool RefDcMap(const uint8_t *jpg, size_t len, uint8_t *map, unsigned int stride)
+{
+    static uint8_t pool[ESP_JPEG_WORK_BUF_SIZE];
+    JDEC jd;
+    tjpgd_host_io_t io = { jpg, len, 0, NULL, 0 };
+    return ref_jd_prepare(&jd, TjpgdHostIn, pool, sizeof(pool), &io) == JDR_OK &&
+           ref_jd_decomp_dc(&jd, map, stride) == JDR_OK;
+}
+
+// The map against the 1/8 decode: equal to its gray for grayscale frames, near its luma for color ones
+static void CheckMap(const char *name, const uint8_t *pix, int w, int h, pixformat_t format, int quality)
+{
+    size_t len;
+    uint8_t *jpg = Encode(pix, w, h, format, quality, &len);
+    HOST_CHECK(jpg != NULL);
+    if (jpg == NULL) {
+        return;
+    }
+    const int bw = (w + 7) / 8, bh = (h + 7) / 8;
+    uint8_t *map = malloc(bw * bh);
+    uint8_t *ref = malloc(bw * bh);
+    uint8_t *rgb = malloc(bw * bh * 3);
+    esp_jpeg_image_cfg_t cfg = { .indata = jpg, .indata_size = len, .outbuf = map, .outbuf_size = bw * bh };
+    esp_jpeg_image_output_t img;
+    HOST_CHECK(esp_jpeg_decode_dc_map(&cfg, &img) == ESP_OK);
+    HOST_CHECK(img.width == bw && img.height == bh && img.output_len == (size_t)bw * bh);
+
+    // level 2 gives the same map
+    memset(ref, 0, bw * bh);
+    HOST_CHECK(RefDcMap(jpg, len, ref, bw) && memcmp(map, ref, bw * bh) == 0);
+
+    // a buffer short of a byte is refused
+    cfg.outbuf_size = bw * bh - 1;
+    HOST_CHECK(esp_jpeg_decode_dc_map(&cfg, &img) != ESP_OK);
+
+    esp_jpeg_image_cfg_t dec = {
+        .indata = jpg, .indata_size = len, .outbuf = rgb, .outbuf_size = bw * bh * 3,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888, .out_scale = JPEG_IMAGE_SCALE_1_8,
+    };
+    esp_jpeg_image_output_t out;
+    HOST_CHECK(esp_jpeg_decode(&dec, &out) == ESP_OK);
+    int differ = 0, worst = 0;
+    for (int y = 0; y < out.height; y++) {
+        for (int x = 0; x < out.width; x++) {
+            const uint8_t *p = &rgb[(y * out.width + x) * 3];
+            const int luma = (299 * p[0] + 587 * p[1] + 114 * p[2] + 500) / 1000;
+            const int d = abs(luma - map[y * bw + x]);
+            differ += d > 2;
+            worst = d > worst ? d : worst;
+        }
+    }
+    if (format == PIXFORMAT_GRAYSCALE) {
+        HOST_CHECK(worst == 0);
+    } else {
+        HOST_CHECK(differ * 100 <= out.width * out.height);
+    }
+    printf("%s: %dx%d map, %d of %d blocks off the 1/8 decode by more than 2, at most %d\n", name, bw, bh, differ,
+           out.width * out.height, worst);
+    free(jpg);
+    free(map);
+    free(ref);
+    free(rgb);
+}
+
+static void CheckMaps(void)
+{
+    static const int sizes[][2] = { { 200, 100 }, { 640, 480 }, { 1280, 720 }, { 97, 61 } };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        const int w = sizes[s][0], h = sizes[s][1];
+        uint8_t *gray = malloc(w * h);
+        uint8_t *rgb = malloc(w * h * 3);
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                gray[y * w + x] = (uint8_t)((x * 255 / w) ^ ((x / 12 + y / 12) * 24));
+                rgb[(y * w + x) * 3 + 0] = (uint8_t)(x * 255 / w);
+                rgb[(y * w + x) * 3 + 1] = (uint8_t)(y * 255 / h);
+                rgb[(y * w + x) * 3 + 2] = (uint8_t)(((x / 10) ^ (y / 10)) * 16);
+            }
+        }
+        char name[32];
+        for (int q = 20; q <= 80; q += 60) {
+            snprintf(name, sizeof(name), "gray %dx%d q%d", w, h, q);
+            CheckMap(name, gray, w, h, PIXFORMAT_GRAYSCALE, q);
+            snprintf(name, sizeof(name), "color %dx%d q%d", w, h, q);
+            CheckMap(name, rgb, w, h, PIXFORMAT_RGB888, q);
+        }
+        free(gray);
+        free(rgb);
+    }
+}
+
+static motion_event_t events[MAX_EVENTS];
+static int event_count;
+
+static void OnEvent(const motion_event_t *event, void *arg)
+{
+    if (event_count < MAX_EVENTS) {
+        events[event_count++] = *event;
+    }
+}
+
+typedef struct {
+    motion_detector_t *m;
+    uint8_t *rgb;
+    uint32_t sequence;
+    int64_t time_us;
+} scene_t;
+
+// Encode the scene and run the detector on it, one interval after the frame before
+static motion_frame_t Step(scene_t *s, int brightness, const object_t *objects, int count)
+{
+    motion_frame_t frame = { 0 };
+    DrawScene(s->rgb, brightness, objects, count);
+    size_t len;
+    uint8_t *jpg = Encode(s->rgb, SCENE_W, SCENE_H, PIXFORMAT_RGB888, 60, &len);
+    s->sequence++;
+    s->time_us += STEP_US;
+    HOST_CHECK(jpg && MotionDetectorProcess(s->m, jpg, len, s->sequence, s->time_us, &frame) == ESP_OK);
+    free(jpg);
+    return frame;
+}
+
+// The box holds the object up to a block either way
+static bool Boxes(const motion_box_t *box, const object_t *o)
+{
+    return abs(box->x - o->x) <= 8 && abs(box->y - o->y) <= 8 && abs(box->x + box->w - o->x - o->size) <= 8 &&
+           abs(box->y + box->h - o->y - o->size) <= 8;
+}
+
+static void CheckScenes(void)
+{
+    motion_config_t config = MOTION_DEFAULT_CONFIG();
+    config.on_event = OnEvent;
+    scene_t s = { .m = MotionDetectorCreate(&config, SCENE_W, SCENE_H), .rgb = malloc(SCENE_W * SCENE_H * 3) };
+    HOST_CHECK(s.m != NULL);
+    uint16_t mw, mh;
+    HOST_CHECK(MotionDetectorMap(s.m, &mw, &mh) == NULL);
+
+    // the first frame is the background; a still scene with noise, then an exposure step, are no motion
+    HOST_CHECK(Step(&s, 0, NULL, 0).relearned);
+    HOST_CHECK(MotionDetectorMap(s.m, &mw, &mh) != NULL && mw == SCENE_W / 8 && mh == SCENE_H / 8);
+    int quiet_changed = 0;
+    for (int i = 0; i < 20; i++) {
+        const motion_frame_t f = Step(&s, i < 10 ? 0 : 30, NULL, 0);
+        HOST_CHECK(f.box_count == 0 && !f.relearned);
+        quiet_changed += f.changed;
+    }
+    HOST_CHECK(event_count == 0);
+    printf("still scene and exposure step: %d changed blocks over 20 frames, no event\n", quiet_changed);
+
+    // the light changes the whole frame: relearned, no event
+    for (int i = 0; i < 4; i++) {
+        uint8_t *p = s.rgb;
+        DrawScene(p, 30, NULL, 0);
+        for (size_t k = 0; k < SCENE_W * SCENE_H * 3; k++) {
+            p[k] = 255 - p[k];
+        }
+        size_t len;
+        uint8_t *jpg = Encode(p, SCENE_W, SCENE_H, PIXFORMAT_RGB888, 60, &len);
+        motion_frame_t f;
+        s.time_us += STEP_US;
+        HOST_CHECK(MotionDetectorProcess(s.m, jpg, len, ++s.sequence, s.time_us, &f) == ESP_OK);
+        HOST_CHECK(f.relearned == (i == 0) && f.box_count == 0);
+        free(jpg);
+    }
+    HOST_CHECK(event_count == 0);
+
+    // back to the scene, relearned again
+    HOST_CHECK(Step(&s, 30, NULL, 0).relearned);
+
+    // an object crosses: START on its second frame, an UPDATE per frame, each boxing it
+    object_t o = { .x = 40, .y = 200, .size = 48 };
+    int moved = 0, boxed = 0;
+    for (; o.x < SCENE_W - 100; o.x += 20, moved++) {
+        const motion_frame_t f = Step(&s, 30, &o, 1);
+        HOST_CHECK(f.box_count == 1);
+        boxed += f.box_count == 1 && Boxes(&f.boxes[0], &o);
+        HOST_CHECK(event_count == (moved >= 1 ? moved : 0));
+    }
+    HOST_CHECK(boxed == moved);
+    HOST_CHECK(event_count == moved - 1 && events[0].type == MOTION_EVENT_START && events[0].number == 1);
+    HOST_CHECK(events[0].start_us == events[0].frame.time_us);
+    for (int i = 1; i < event_count; i++) {
+        HOST_CHECK(events[i].type == MOTION_EVENT_UPDATE && events[i].number == 1);
+    }
+    const motion_frame_t last = events[event_count - 1].frame;
+
+    // gone: END hold_ms after the last frame with it, carrying that frame
+    const int before = event_count;
+    int64_t gone_us = 0;
+    while (event_count == before && s.time_us < last.time_us + 10 * config.hold_ms * 1000LL) {
+        HOST_CHECK(Step(&s, 30, NULL, 0).box_count == 0);
+        gone_us = s.time_us;
+    }
+    HOST_CHECK(event_count == before + 1 && events[before].type == MOTION_EVENT_END);
+    HOST_CHECK(events[before].frame.sequence == last.sequence && events[before].start_us == events[0].start_us);
+    HOST_CHECK(gone_us - last.time_us >= config.hold_ms * 1000LL &&
+               gone_us - last.time_us < config.hold_ms * 1000LL + STEP_US);
+    printf("object: %d frames boxed, event 1 over %.1f s, ended %.1f s after the last motion\n", boxed,
+           (last.time_us - events[0].start_us) / 1e6, (gone_us - last.time_us) / 1e6);
+
+    // two objects apart, the larger box first; a second event
+    event_count = 0;
+    const object_t two[2] = { { .x = 64, .y = 64, .size = 40 }, { .x = 400, .y = 300, .size = 80 } };
+    motion_frame_t f = { 0 };
+    for (int i = 0; i < 3; i++) {
+        f = Step(&s, 30, two, 2);
+    }
+    HOST_CHECK(f.box_count == 2 && Boxes(&f.boxes[0], &two[1]) && Boxes(&f.boxes[1], &two[0]));
+    HOST_CHECK(f.boxes[0].blocks > f.boxes[1].blocks);
+    HOST_CHECK(event_count >= 2 && events[0].type == MOTION_EVENT_START && events[0].number == 2);
+
+    // a frame larger than the detector's, and one that does not decode
+    uint8_t *big = malloc(SCENE_W * 2 * SCENE_H * 3);
+    memset(big, 128, SCENE_W * 2 * SCENE_H * 3);
+    size_t len;
+    uint8_t *jpg = Encode(big, SCENE_W * 2, SCENE_H, PIXFORMAT_RGB888, 60, &len);
+    HOST_CHECK(MotionDetectorProcess(s.m, jpg, len, 0, s.time_us, NULL) == ESP_ERR_INVALID_SIZE);
+    jpg[2] = 0;
+    HOST_CHECK(MotionDetectorProcess(s.m, jpg, len, 0, s.time_us, NULL) == ESP_FAIL);
+    free(jpg);
+    free(big);
+
+    MotionDetectorFree(s.m);
+    free(s.rgb);
+}
+
+// A short response, its body NUL terminated
+static int Request(const char *path, char *body, size_t size)
+{
+    stream_client_t c;
+    if (!StreamClientRequest(&c, port, "GET", path, NULL, TIMEOUT_MS)) {
+        return 0;
+    }
+    const size_t n = StreamClientRead(&c, (uint8_t *)body, size - 1);
+    body[n] = 0;
+    StreamClientClose(&c);
+    return c.status;
+}
+
+static long JsonNumber(const char *body, const char *key)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char *p = strstr(body, pattern);
+    return p ? strtol(p + strlen(pattern), NULL, 10) : -1;
+}
+
+static void CheckOnStack(void)
+{
+    const stream_sim_config_t sim = { .fps = FPS, .port = port, .seed = 9 };
+    HOST_CHECK(StreamSimStart(&sim) == ESP_OK);
+    char body[2048];
+    HOST_CHECK(Request("/motion", body, sizeof(body)) == 200 && strstr(body, "\"running\":false") != NULL);
+
+    // nobody streams, the service takes the moving box frames itself
+    motion_config_t config = MOTION_DEFAULT_CONFIG();
+    config.on_event = OnEvent;
+    event_count = 0;
+    HOST_CHECK(MotionInit(&config) == 0);
+    const int64_t until = esp_timer_get_time() + TIMEOUT_MS * 1000LL;
+    do {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        HOST_CHECK(Request("/motion", body, sizeof(body)) == 200);
+    } while (JsonNumber(body, "events") < 1 && esp_timer_get_time() < until);
+    HOST_CHECK(strstr(body, "\"running\":true") != NULL && JsonNumber(body, "events") >= 1);
+    HOST_CHECK(JsonNumber(body, "analysed") >= 2 && JsonNumber(body, "errors") == 0);
+    HOST_CHECK(strstr(body, "\"boxes\":[{\"x\":") != NULL);
+    HOST_CHECK(event_count >= 1 && events[0].type == MOTION_EVENT_START && events[0].frame.box_count >= 1);
+    motion_status_t st;
+    MotionGetStatus(&st);
+    printf("on the stack: %u frames analysed, %u events, %u us per frame at most\n", st.analysed, st.events,
+           st.max_us);
+
+    // a stream sends the frames now; the service takes them from the sender
+    stream_client_t c;
+    HOST_CHECK(StreamClientGet(&c, port, "/stream", TIMEOUT_MS));
+    char headers[512];
+    uint8_t *part = malloc(512 * 1024);
+    for (int i = 0; i < FPS && StreamClientPart(&c, headers, sizeof(headers), part, 512 * 1024) > 0; i++) {
+    }
+    free(part);
+    motion_status_t streamed;
+    MotionGetStatus(&streamed);
+    HOST_CHECK(streamed.analysed >= st.analysed + 3 && streamed.errors == 0);
+    StreamClientClose(&c);
+
+    MotionStop();
+    MotionGetStatus(&st);
+    HOST_CHECK(!st.running);
+    StreamSimStop();
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    CheckMaps();
+    CheckScenes();
+    CheckOnStack();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
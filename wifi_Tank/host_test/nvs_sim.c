@@ -0,0 +1,324 @@
+/*! \file nvs_sim.c
+\brief NVS on the host, see nvs_sim.h.
+*****/
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nvs_sim.h"
+
+#define SIM_ENTRIES 64
+#define SIM_HANDLES 8
+#define SIM_PENDING 16
+
+typedef struct {
+    bool used;
+    bool erased;            // pending erase of the key
+    char ns[NVS_KEY_NAME_MAX_SIZE];
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    bool blob;
+    uint8_t *data;
+    size_t len;
+} sim_entry_t;
+
+typedef struct {
+    bool used;
+    nvs_open_mode_t mode;
+    char ns[NVS_KEY_NAME_MAX_SIZE];
+    sim_entry_t pending[SIM_PENDING];
+} sim_handle_t;
+
+static sim_entry_t entries[SIM_ENTRIES];
+static sim_handle_t handles[SIM_HANDLES];
+static nvs_sim_stats_t stats;
+
+static void EntryFree(sim_entry_t *e)
+{
+    free(e->data);
+    memset(e, 0, sizeof(*e));
+}
+
+static sim_entry_t *Find(sim_entry_t *list, size_t count, const char *ns, const char *key)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (list[i].used && strcmp(list[i].ns, ns) == 0 && strcmp(list[i].key, key) == 0) {
+            return &list[i];
+        }
+    }
+    return NULL;
+}
+
+static sim_entry_t *FindFree(sim_entry_t *list, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        if (!list[i].used) {
+            return &list[i];
+        }
+    }
+    return NULL;
+}
+
+static sim_handle_t *Handle(nvs_handle_t handle)
+{
+    if (handle == 0 || handle > SIM_HANDLES || !handles[handle - 1].used) {
+        return NULL;
+    }
+    return &handles[handle - 1];
+}
+
+static bool ValidName(const char *name)
+{
+    return name && name[0] && strlen(name) < NVS_KEY_NAME_MAX_SIZE;
+}
+
+void NvsSimErase(void)
+{
+    for (int i = 0; i < SIM_ENTRIES; i++) {
+        EntryFree(&entries[i]);
+    }
+    for (int h = 0; h < SIM_HANDLES; h++) {
+        for (int i = 0; i < SIM_PENDING; i++) {
+            EntryFree(&handles[h].pending[i]);
+        }
+        handles[h].used = false;
+    }
+    memset(&stats, 0, sizeof(stats));
+}
+
+nvs_sim_stats_t NvsSimStats(void)
+{
+    return stats;
+}
+
+void NvsSimClearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+size_t NvsSimOpenHandles(void)
+{
+    size_t n = 0;
+    for (int h = 0; h < SIM_HANDLES; h++) {
+        n += handles[h].used;
+    }
+    return n;
+}
+
+const uint8_t *NvsSimValue(const char *namespace_name, const char *key, size_t *length)
+{
+    const sim_entry_t *e = Find(entries, SIM_ENTRIES, namespace_name, key);
+    if (!e) {
+        return NULL;
+    }
+    *length = e->len;
+    return e->data;
+}
+
+void NvsSimCorrupt(const char *namespace_name, const char *key, size_t offset, uint8_t bits)
+{
+    sim_entry_t *e = Find(entries, SIM_ENTRIES, namespace_name, key);
+    if (e && offset < e->len) {
+        e->data[offset] ^= bits;
+    }
+}
+
+esp_err_t nvs_open(const char *namespace_name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    if (!ValidName(namespace_name)) {
+        return ESP_ERR_NVS_INVALID_NAME;
+    }
+    // Like the target, a namespace that was never written cannot be opened read only
+    bool exists = false;
+    for (int i = 0; i < SIM_ENTRIES && !exists; i++) {
+        exists = entries[i].used && strcmp(entries[i].ns, namespace_name) == 0;
+    }
+    if (open_mode == NVS_READONLY && !exists) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    for (int h = 0; h < SIM_HANDLES; h++) {
+        if (!handles[h].used) {
+            handles[h].used = true;
+            handles[h].mode = open_mode;
+            strcpy(handles[h].ns, namespace_name);
+            *out_handle = h + 1;
+            stats.opens++;
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    sim_handle_t *h = Handle(handle);
+    if (!h) {
+        return;
+    }
+    for (int i = 0; i < SIM_PENDING; i++) {
+        if (h->pending[i].used) {
+            stats.lost++;
+            EntryFree(&h->pending[i]);
+        }
+    }
+    h->used = false;
+    stats.closes++;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    sim_handle_t *h = Handle(handle);
+    if (!h) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    for (int i = 0; i < SIM_PENDING; i++) {
+        sim_entry_t *p = &h->pending[i];
+        if (!p->used) {
+            continue;
+        }
+        sim_entry_t *e = Find(entries, SIM_ENTRIES, p->ns, p->key);
+        if (e) {
+            EntryFree(e);
+        }
+        if (p->erased) {
+            EntryFree(p);
+            continue;
+        }
+        e = FindFree(entries, SIM_ENTRIES);
+        if (!e) {
+            return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+        }
+        *e = *p;
+        memset(p, 0, sizeof(*p));
+    }
+    stats.commits++;
+    return ESP_OK;
+}
+
+// Change held in the handle until the commit
+static esp_err_t Stage(nvs_handle_t handle, const char *key, bool blob, const void *value, size_t length, bool erase)
+{
+    sim_handle_t *h = Handle(handle);
+    if (!h) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    if (h->mode == NVS_READONLY) {
+        return ESP_ERR_NVS_READ_ONLY;
+    }
+    if (!ValidName(key)) {
+        return ESP_ERR_NVS_INVALID_NAME;
+    }
+    stats.writes++;
+    sim_entry_t *p = Find(h->pending, SIM_PENDING, h->ns, key);
+    if (p) {
+        EntryFree(p);
+    } else {
+        p = FindFree(h->pending, SIM_PENDING);
+        if (!p) {
+            return ESP_ERR_NVS_NOT_ENOUGH_SPACE;
+        }
+    }
+    p->used = true;
+    p->erased = erase;
+    strcpy(p->ns, h->ns);
+    strcpy(p->key, key);
+    p->blob = blob;
+    if (!erase) {
+        p->data = malloc(length ? length : 1);
+        memcpy(p->data, value, length);
+        p->len = length;
+        stats.bytes_written += length;
+    }
+    return ESP_OK;
+}
+
+// Pending change of the handle first, then the partition
+static esp_err_t Lookup(nvs_handle_t handle, const char *key, bool blob, const sim_entry_t **out)
+{
+    sim_handle_t *h = Handle(handle);
+    if (!h) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    stats.reads++;
+    const sim_entry_t *e = Find(h->pending, SIM_PENDING, h->ns, key);
+    if (!e) {
+        e = Find(entries, SIM_ENTRIES, h->ns, key);
+    }
+    if (!e || e->erased) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (e->blob != blob) {
+        return ESP_ERR_NVS_TYPE_MISMATCH;
+    }
+    *out = e;
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char *key, uint8_t value)
+{
+    return Stage(handle, key, false, &value, 1, false);
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char *key, uint8_t *out_value)
+{
+    const sim_entry_t *e;
+    esp_err_t ret = Lookup(handle, key, false, &e);
+    if (ret == ESP_OK) {
+        *out_value = e->data[0];
+    }
+    return ret;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    return Stage(handle, key, true, value, length, false);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    const sim_entry_t *e;
+    esp_err_t ret = Lookup(handle, key, true, &e);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (out_value == NULL) {
+        *length = e->len;
+        return ESP_OK;
+    }
+    if (*length < e->len) {
+        *length = e->len;
+        return ESP_ERR_NVS_INVALID_LENGTH;
+    }
+    memcpy(out_value, e->data, e->len);
+    *length = e->len;
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char *key)
+{
+    const sim_entry_t *e;
+    if (Lookup(handle, key, true, &e) != ESP_OK && Lookup(handle, key, false, &e) != ESP_OK) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    return Stage(handle, key, false, NULL, 0, true);
+}
+
+// Immediate, unlike the other changes
+esp_err_t nvs_erase_all(nvs_handle_t handle)
+{
+    sim_handle_t *h = Handle(handle);
+    if (!h) {
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+    if (h->mode == NVS_READONLY) {
+        return ESP_ERR_NVS_READ_ONLY;
+    }
+    stats.writes++;
+    for (int i = 0; i < SIM_ENTRIES; i++) {
+        if (entries[i].used && strcmp(entries[i].ns, h->ns) == 0) {
+            EntryFree(&entries[i]);
+        }
+    }
+    for (int i = 0; i < SIM_PENDING; i++) {
+        EntryFree(&h->pending[i]);
+    }
+    return ESP_OK;
+}
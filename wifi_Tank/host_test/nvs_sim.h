@@ -0,0 +1,58 @@
+/*! \file nvs_sim.h
+\brief Host model of an NVS partition for the nvs.h stand-in. nvs_sim.c keeps
+namespaces and keys in memory and holds every change in its handle until
+nvs_commit(), so a change that is never committed is lost on nvs_close() the
+way the API allows it to be on the target. Counters show what a caller did.
+*****/
+#ifndef NVS_SIM_H
+#define NVS_SIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "nvs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t opens;
+    uint32_t closes;
+    uint32_t commits;
+    uint32_t reads;         // nvs_get_* calls
+    uint32_t writes;        // nvs_set_* and nvs_erase_* calls
+    size_t bytes_written;   // value bytes handed to nvs_set_*
+    uint32_t lost;          // changes dropped by nvs_close() without a commit
+} nvs_sim_stats_t;
+
+/**
+ * @brief Empty the partition, close all handles and clear the counters
+ */
+void NvsSimErase(void);
+
+/**
+ * @brief Counters since NvsSimErase() or NvsSimClearStats()
+ */
+nvs_sim_stats_t NvsSimStats(void);
+void NvsSimClearStats(void);
+
+/**
+ * @brief Handles opened and not closed yet
+ */
+size_t NvsSimOpenHandles(void);
+
+/**
+ * @brief Stored value of a key, NULL if there is none. Committed values only.
+ */
+const uint8_t *NvsSimValue(const char *namespace_name, const char *key, size_t *length);
+
+/**
+ * @brief Flip bits of a stored value, as a torn write or another firmware would leave it
+ */
+void NvsSimCorrupt(const char *namespace_name, const char *key, size_t offset, uint8_t bits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,140 @@
+/*! \file overlay_burn_bench.c
+\brief Cost of drawing the sample overlay into a frame, as /stream?overlay=1
+does: OverlayRender() patching the MCUs under the overlay, against a full
+decode (esp_jpeg), OverlayDrawRgb() and fmt2jpg at the source quality. Runs on
+HD frames like the sensor's (the usb_camera reference scaled up with sensor
+noise, and a synthetic texture) and on the esp_jpeg test images.
+
+Usage: overlay_burn_bench [iterations]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "overlay.h"
+#include "img_converters.h"
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define HD_W 1280
+#define HD_H 720
+
+static overlay_data_t overlay;
+
+static double TimePatch(const uint8_t *jpg, size_t len, uint8_t *out, size_t cap, size_t *out_len, int iterations)
+{
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        if (!OverlayRender(&overlay, jpg, len, out, cap, out_len)) {
+            return -1;
+        }
+    }
+    return (HostTimeUs() - start) / 1000.0 / iterations;
+}
+
+// Decode, draw and code again, the way without jpg_patch()
+static double TimeFull(const uint8_t *jpg, size_t len, int quality, size_t *out_len, int iterations)
+{
+    esp_jpeg_image_cfg_t cfg = { .indata = (uint8_t *)jpg, .indata_size = len };
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return -1;
+    }
+    const size_t size = img.width * img.height * 3;
+    uint8_t *rgb = malloc(size);
+    cfg.outbuf = rgb;
+    cfg.outbuf_size = size;
+    cfg.out_format = JPEG_IMAGE_FORMAT_RGB888;
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        esp_jpeg_decode(&cfg, &img);
+        OverlayDrawRgb(&overlay, rgb, img.width, img.height);
+        // fmt2jpg takes RGB888 as B, G, R bytes
+        for (size_t p = 0; p < size; p += 3) {
+            const uint8_t r = rgb[p];
+            rgb[p] = rgb[p + 2];
+            rgb[p + 2] = r;
+        }
+        uint8_t *out = NULL;
+        fmt2jpg(rgb, size, img.width, img.height, PIXFORMAT_RGB888, quality, &out, out_len);
+        free(out);
+    }
+    const double ms = (HostTimeUs() - start) / 1000.0 / iterations;
+    free(rgb);
+    return ms;
+}
+
+static void Bench(const char *name, const uint8_t *jpg, size_t len, int quality, int iterations)
+{
+    const size_t cap = len * 2 + 4096;
+    uint8_t *out = malloc(cap);
+    size_t patch_len = 0, full_len = 0;
+    const double patch = TimePatch(jpg, len, out, cap, &patch_len, iterations);
+    const double full = TimeFull(jpg, len, quality, &full_len, iterations);
+    printf("%-18s %7zu %9.3f %7zu %9.3f %7zu %7.1fx\n", name, len, patch, patch_len, full, full_len,
+           patch > 0 ? full / patch : 0.0);
+    free(out);
+}
+
+static void BenchHd(const char *name, uint8_t *bgr, int quality, int iterations)
+{
+    uint8_t *jpg = NULL;
+    size_t len = 0;
+    if (fmt2jpg(bgr, HD_W * HD_H * 3, HD_W, HD_H, PIXFORMAT_RGB888, quality, &jpg, &len)) {
+        Bench(name, jpg, len, quality, iterations);
+        free(jpg);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 20;
+    OverlayCreateSampleData(&overlay);
+
+    printf("%d iterations, ms per frame, sample overlay (3 texts, crosshair, rectangle, circle)\n", iterations);
+    printf("%-18s %7s %9s %7s %9s %7s %8s\n", "frame", "bytes", "patch", "bytes", "full", "bytes", "speedup");
+
+    // HD camera style: the usb_camera reference scaled up 8x, with some sensor noise, BGR
+    uint8_t *bgr = malloc(HD_W * HD_H * 3);
+    uint32_t seed = 1;
+    for (int y = 0; y < HD_H; y++) {
+        for (int x = 0; x < HD_W; x++) {
+            const unsigned int word = jpeg_no_huffman_rgb888[(y / 8) * 160 + x / 8];
+            uint8_t *p = bgr + (y * HD_W + x) * 3;
+            for (int c = 0; c < 3; c++) {
+                seed = seed * 1103515245 + 12345;
+                const int v = (int)((word >> (16 - 8 * c)) & 0xff) + (int)(seed >> 29) - 4;
+                p[c] = v < 0 ? 0 : v > 255 ? 255 : v;
+            }
+        }
+    }
+    BenchHd("HD camera q50", bgr, 50, iterations);
+    BenchHd("HD camera q80", bgr, 80, iterations);
+
+    // HD texture, the synthetic frames of stream_sim.c
+    for (int y = 0; y < HD_H; y++) {
+        for (int x = 0; x < HD_W; x++) {
+            uint8_t *p = &bgr[(y * HD_W + x) * 3];
+            p[2] = (uint8_t)((((x / 6) * 7) ^ ((y / 6) * 13)) & 0x7f) + y / 8;
+            p[1] = (uint8_t)((((x / 6) * 5) ^ ((y / 6) * 3)) & 0x3f) + x / 12;
+            p[0] = (uint8_t)((x + y) & 0x7f);
+        }
+    }
+    BenchHd("HD texture q50", bgr, 50, iterations);
+    free(bgr);
+
+    // their quality is not known, the full path codes them at 80
+    static const char *files[] = { "usb_camera.jpg", "usb_camera_2.jpg", "logo.jpg" };
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, files[i]);
+        size_t len = 0;
+        uint8_t *jpg = HostReadFile(path, &len);
+        if (jpg) {
+            Bench(files[i], jpg, len, 80, iterations * 10);
+            free(jpg);
+        }
+    }
+    return 0;
+}
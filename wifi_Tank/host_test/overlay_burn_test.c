@@ -0,0 +1,247 @@
+/*! \file overlay_burn_test.c
+\brief Overlay burn-in (OverlayRender(), /stream?overlay=1). The sample overlay
+is drawn into an HD frame from fmt2jpg and into a test JPEG of esp_jpeg: every
+MCU it leaves alone must decode exactly as before, the MCUs it draws on must
+decode as close to OverlayDrawRgb() on the decoded frame as that frame coded
+again whole at the source quality does. Then the stream of the
+host stack (stream_sim.c) must carry the frames as the sensor sent them until
+an overlay is sent, and with the overlay drawn in after that.
+*****/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "overlay.h"
+#include "img_converters.h"
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18084
+#define TIMEOUT_MS 5000
+#define FPS 30
+#define HD_W 1280
+#define HD_H 720
+#define MAX_PART (512 * 1024)
+
+static uint16_t port;
+
+static uint8_t *Decode(const uint8_t *jpg, size_t len, int *width, int *height)
+{
+    esp_jpeg_image_cfg_t cfg = { .indata = (uint8_t *)jpg, .indata_size = len };
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return NULL;
+    }
+    uint8_t *rgb = malloc(img.width * img.height * 3);
+    cfg.outbuf = rgb;
+    cfg.outbuf_size = img.width * img.height * 3;
+    cfg.out_format = JPEG_IMAGE_FORMAT_RGB888;
+    if (esp_jpeg_decode(&cfg, &img) != ESP_OK) {
+        free(rgb);
+        return NULL;
+    }
+    *width = img.width;
+    *height = img.height;
+    return rgb;
+}
+
+// Squared error of the MCUs marked in changed, and the sample count
+static double Error(const uint8_t *a, const uint8_t *b, const bool *changed, int width, int height,
+                    int mcu_w, int mcu_h, long *n)
+{
+    const int mcus_x = (width + mcu_w - 1) / mcu_w;
+    double sq = 0;
+    *n = 0;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            if (!changed[y / mcu_h * mcus_x + x / mcu_w]) {
+                continue;
+            }
+            for (int c = 0; c < 3; c++) {
+                const double e = a[(y * width + x) * 3 + c] - b[(y * width + x) * 3 + c];
+                sq += e * e;
+            }
+            *n += 3;
+        }
+    }
+    return sq;
+}
+
+static double Psnr(double sq, long n)
+{
+    return n ? 10 * log10(255.0 * 255.0 / (sq / n + 1e-9)) : 0;
+}
+
+// MCUs without a pixel of the overlay decode as the source, the others as the overlay drawn on it
+static void CheckRender(const char *name, const uint8_t *jpg, size_t len, int mcu_w, int mcu_h, int quality)
+{
+    overlay_data_t overlay;
+    OverlayCreateSampleData(&overlay);
+    int width = 0, height = 0;
+    uint8_t *ref = Decode(jpg, len, &width, &height);
+    HOST_CHECK(ref != NULL);
+    if (!ref) {
+        return;
+    }
+    const size_t size = width * height * 3;
+    uint8_t *drawn = malloc(size);
+    memcpy(drawn, ref, size);
+    OverlayDrawRgb(&overlay, drawn, width, height);
+
+    const size_t cap = len * 2 + 4096;
+    uint8_t *out = malloc(cap);
+    size_t out_len = 0;
+    int w = 0, h = 0;
+    HOST_CHECK(OverlayRender(&overlay, jpg, len, out, cap, &out_len));
+    uint8_t *got = Decode(out, out_len, &w, &h);
+    HOST_CHECK(got != NULL && w == width && h == height);
+    if (!got) {
+        free(ref);
+        free(drawn);
+        free(out);
+        return;
+    }
+
+    const int mcus_x = (width + mcu_w - 1) / mcu_w;
+    bool *changed_at = calloc(mcus_x * ((height + mcu_h - 1) / mcu_h), sizeof(bool));
+    int kept = 0, drawn_on = 0, moved = 0;
+    for (int my = 0; my < height; my += mcu_h) {
+        for (int mx = 0; mx < width; mx += mcu_w) {
+            bool changed = false;
+            for (int y = my; y < my + mcu_h && y < height && !changed; y++) {
+                const size_t i = (y * width + mx) * 3;
+                const int row = (mx + mcu_w > width ? width - mx : mcu_w) * 3;
+                changed = memcmp(&drawn[i], &ref[i], row) != 0;
+            }
+            changed_at[my / mcu_h * mcus_x + mx / mcu_w] = changed;
+            drawn_on += changed;
+            kept += !changed;
+            for (int y = my; y < my + mcu_h && y < height && !changed; y++) {
+                const size_t i = (y * width + mx) * 3;
+                const int row = (mx + mcu_w > width ? width - mx : mcu_w) * 3;
+                moved += memcmp(&got[i], &ref[i], row) != 0;
+            }
+        }
+    }
+    long n = 0;
+    double sq = Error(got, drawn, changed_at, width, height, mcu_w, mcu_h, &n);
+    const double psnr = Psnr(sq, n);
+    printf("%-14s %dx%d: %d MCUs drawn on, %d kept, %zu -> %zu bytes, %.1f dB against the drawn frame",
+           name, width, height, drawn_on, kept, len, out_len, psnr);
+    HOST_CHECK(moved == 0 && drawn_on > 0);
+
+    // the drawn frame coded again whole loses as much on the overlay's sharp edges;
+    // fmt2jpg takes RGB888 as B, G, R bytes
+    uint8_t *bgr = malloc(size);
+    for (size_t i = 0; i < size; i += 3) {
+        bgr[i] = drawn[i + 2];
+        bgr[i + 1] = drawn[i + 1];
+        bgr[i + 2] = drawn[i];
+    }
+    uint8_t *full = NULL;
+    size_t full_len = 0;
+    HOST_CHECK(fmt2jpg(bgr, size, width, height, PIXFORMAT_RGB888, quality, &full, &full_len));
+    free(bgr);
+    uint8_t *full_rgb = full ? Decode(full, full_len, &w, &h) : NULL;
+    HOST_CHECK(full_rgb != NULL);
+    if (full_rgb) {
+        sq = Error(full_rgb, drawn, changed_at, width, height, mcu_w, mcu_h, &n);
+        const double full_psnr = Psnr(sq, n);
+        printf(", %.1f dB coded again whole (%zu bytes)\n", full_psnr, full_len);
+        HOST_CHECK(psnr > full_psnr - 1.0);
+    }
+    free(full_rgb);
+    free(full);
+    free(changed_at);
+    free(got);
+    free(ref);
+    free(drawn);
+    free(out);
+}
+
+static uint8_t *MakeFrame(size_t *len)
+{
+    uint8_t *rgb = malloc(HD_W * HD_H * 3);
+    for (int y = 0; y < HD_H; y++) {
+        for (int x = 0; x < HD_W; x++) {
+            uint8_t *p = &rgb[(y * HD_W + x) * 3];
+            p[0] = (uint8_t)((((x / 6) * 7) ^ ((y / 6) * 13)) & 0x7f) + y / 8;
+            p[1] = (uint8_t)((((x / 6) * 5) ^ ((y / 6) * 3)) & 0x3f) + x / 12;
+            p[2] = (uint8_t)((x + y) & 0x7f);
+        }
+    }
+    uint8_t *jpg = NULL;
+    HOST_CHECK(fmt2jpg(rgb, HD_W * HD_H * 3, HD_W, HD_H, PIXFORMAT_RGB888, 50, &jpg, len));
+    free(rgb);
+    return jpg;
+}
+
+// Whether the centre of the sample overlay's filled circle is lime in a streamed frame
+static bool CircleShown(const uint8_t *jpg, size_t len)
+{
+    int width = 0, height = 0;
+    uint8_t *rgb = Decode(jpg, len, &width, &height);
+    HOST_CHECK(rgb != NULL && width == HD_W && height == HD_H);
+    if (!rgb) {
+        return false;
+    }
+    const uint8_t *p = &rgb[(30 * width + 1250) * 3];
+    const bool lime = p[0] < 80 && p[1] > 200 && p[2] < 80;
+    free(rgb);
+    return lime;
+}
+
+static void CheckStream(void)
+{
+    const stream_sim_config_t config = { .fps = FPS, .port = port, .seed = 5 };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+    uint8_t *part = malloc(MAX_PART);
+    char headers[512];
+    stream_client_t c;
+
+    // no overlay sent yet: the frames as they are
+    HOST_CHECK(StreamClientGet(&c, port, "/stream?overlay=1", TIMEOUT_MS) && c.status == 200);
+    size_t len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART);
+    HOST_CHECK(len > 0 && StreamSimFrameId(part, len) != 0 && !CircleShown(part, len));
+    StreamClientClose(&c);
+
+    overlay_data_t overlay;
+    OverlayCreateSampleData(&overlay);
+    OverlaySendUpdate(&overlay);
+    HOST_CHECK(StreamClientGet(&c, port, "/stream?overlay=1", TIMEOUT_MS) && c.status == 200);
+    for (int i = 0; i < 3; i++) {
+        len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART);
+        HOST_CHECK(len > 0 && StreamSimFrameId(part, len) != 0 && CircleShown(part, len));
+    }
+    StreamClientClose(&c);
+
+    // clients that did not ask for it get no overlay
+    HOST_CHECK(StreamClientGet(&c, port, "/stream", TIMEOUT_MS) && c.status == 200);
+    len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART);
+    HOST_CHECK(len > 0 && !CircleShown(part, len));
+    StreamClientClose(&c);
+
+    free(part);
+    StreamSimStop();
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    size_t len = 0;
+    uint8_t *jpg = MakeFrame(&len);
+    CheckRender("HD 4:2:0", jpg, len, 16, 16, 50);
+    free(jpg);
+    jpg = HostReadFile(JPEG_TEST_DIR "/usb_camera.jpg", &len);
+    HOST_CHECK(jpg != NULL);
+    CheckRender("usb_camera.jpg", jpg, len, 16, 8, 90);
+    free(jpg);
+
+    CheckStream();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
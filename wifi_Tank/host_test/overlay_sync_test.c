@@ -0,0 +1,235 @@
+/*! \file overlay_sync_test.c
+\brief Frame tags of the MJPEG parts and overlay updates on the host streaming
+stack (stream_sim.c). A thread tags an overlay with the newest streamed frame
+(StreamGetLastFrame()) whenever it changes, as overlay_demo_task does, while a
+client watches /stream and the overlay WebSocket. Both must name the frames
+the player sent, with the same sequence number for the same frame and the
+VSYNC time that started it. The grayscale frames of the vision queue are left
+to the vision code.
+
+The skew of the overlay on screen to the frame under it is reported for a
+client that draws each overlay on arrival and for one that holds it back
+until its frame is shown, as overlay_demo.html does.
+*****/
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "stream.h"
+#include "overlay.h"
+#include "esp_timer.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18083
+#define TIMEOUT_MS 5000
+#define FPS 30
+#define CORRUPT_EVERY 5
+#define STREAM_PARTS 30
+#define MAX_PART (256 * 1024)
+#define MAX_OVERLAYS 1024
+
+typedef struct {
+    uint32_t seq;
+    int64_t ts;
+    int64_t arrived;
+} tag_t;
+
+static uint16_t port;
+static volatile bool tagger_stop;
+static tag_t parts[STREAM_PARTS];
+static uint32_t part_ids[STREAM_PARTS];
+static tag_t overlays[MAX_OVERLAYS];
+static int overlay_count;
+
+// Tags an overlay with each newest streamed frame, like overlay_demo_task
+static void *Tagger(void *arg)
+{
+    (void)arg;
+    uint32_t last = 0;
+    while (!tagger_stop) {
+        uint32_t sequence;
+        int64_t capture_us;
+        if (StreamGetLastFrame(&sequence, &capture_us) && sequence != last) {
+            overlay_data_t overlay;
+            OverlayCreateSampleData(&overlay);
+            overlay.frame_sequence = sequence;
+            overlay.frame_time_us = capture_us;
+            OverlaySendUpdate(&overlay);
+            last = sequence;
+        }
+        usleep(1000000 / FPS / 4);
+    }
+    return NULL;
+}
+
+static void *WsReader(void *arg)
+{
+    stream_client_t *c = arg;
+    char msg[4096];
+    int opcode = 0;
+    long len;
+    while ((len = StreamClientWsRecv(c, &opcode, msg, sizeof(msg))) >= 0 && opcode != 8) {
+        const int64_t now = esp_timer_get_time();
+        const char *seq = strstr(msg, "\"seq\":");
+        const char *ts = strstr(msg, "\"ts\":");
+        HOST_CHECK(opcode == 1 && seq != NULL && ts != NULL);
+        if (seq && ts && overlay_count < MAX_OVERLAYS) {
+            overlays[overlay_count++] = (tag_t) {
+                .seq = (uint32_t)strtoul(seq + 6, NULL, 10),
+                .ts = (int64_t)strtod(ts + 5, NULL),
+                .arrived = now,
+            };
+        }
+    }
+    return NULL;
+}
+
+// The frame a tag names started with the VSYNC that ended the player's previous frame
+static bool TagMatches(const tag_t *tag, uint32_t id)
+{
+    const int64_t before = StreamSimFrameTime(id - 1);
+    const int64_t after = StreamSimFrameTime(id);
+    return after > 0 && tag->ts <= after && (id == 1 || before < 0 || tag->ts >= before);
+}
+
+typedef struct {
+    int frames;
+    double seq_sum;
+    double ms_sum;
+    double ms_worst;
+    int leading;                // overlay of a frame later than the one on screen
+} skew_t;
+
+static void AddSkew(skew_t *s, const tag_t *frame, const tag_t *overlay)
+{
+    const double ms = (frame->ts - overlay->ts) / 1000.0;
+    s->frames++;
+    s->seq_sum += (double)frame->seq - overlay->seq;
+    s->ms_sum += ms < 0 ? -ms : ms;
+    s->ms_worst = (ms < 0 ? -ms : ms) > (s->ms_worst < 0 ? -s->ms_worst : s->ms_worst) ? ms : s->ms_worst;
+    s->leading += overlay->seq > frame->seq;
+}
+
+static void PrintSkew(const char *name, const skew_t *s)
+{
+    printf("%-11s %d frames with an overlay, mean %+.1f frames, %.1f ms, worst %+.1f ms, %d leading\n", name,
+           s->frames, s->frames ? s->seq_sum / s->frames : 0.0, s->frames ? s->ms_sum / s->frames : 0.0,
+           s->ms_worst, s->leading);
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+    const stream_sim_config_t config = {
+        .jpeg_dir = JPEG_TEST_DIR,
+        .fps = FPS,
+        .jitter_us = 3000,
+        .corrupt_every = CORRUPT_EVERY,
+        .port = port,
+        .seed = 3,
+    };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+
+    // the WebSocket first, the stream keeps the server task busy
+    stream_client_t ws, c;
+    HOST_CHECK(StreamClientWsOpen(&ws, port, "/ws", TIMEOUT_MS));
+    pthread_t tagger, reader;
+    pthread_create(&reader, NULL, WsReader, &ws);
+    pthread_create(&tagger, NULL, Tagger, NULL);
+
+    HOST_CHECK(StreamClientGet(&c, port, "/stream", TIMEOUT_MS) && c.status == 200);
+    uint8_t *part = malloc(MAX_PART);
+    char headers[512];
+    int n = 0;
+    for (; n < STREAM_PARTS; n++) {
+        const size_t len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART);
+        const int64_t now = esp_timer_get_time();
+        HOST_CHECK(len > 0);
+        if (!len) {
+            break;
+        }
+        const char *seq = strstr(headers, "X-Frame-Sequence: ");
+        const char *ts = strstr(headers, "X-Timestamp: ");
+        int64_t sec = 0, usec = 0;
+        HOST_CHECK(seq != NULL && ts != NULL);
+        HOST_CHECK(ts && sscanf(ts + 13, "%" SCNd64 ".%6" SCNd64, &sec, &usec) == 2);
+        parts[n] = (tag_t) {
+            .seq = seq ? (uint32_t)strtoul(seq + 18, NULL, 10) : 0,
+            .ts = sec * 1000000 + usec,
+            .arrived = now,
+        };
+        part_ids[n] = StreamSimFrameId(part, len);
+    }
+    StreamClientClose(&c);
+    free(part);
+
+    tagger_stop = true;
+    pthread_join(tagger, NULL);
+    HOST_CHECK(StreamClientWsSend(&ws, 8, NULL, 0));
+    pthread_join(reader, NULL);
+    StreamClientClose(&ws);
+
+    // Every VSYNC takes a sequence number, so the player's frame number is off by a constant
+    const int64_t offset = n ? (int64_t)parts[0].seq - part_ids[0] : 0;
+    for (int i = 0; i < n; i++) {
+        HOST_CHECK(part_ids[i] != 0 && (int64_t)parts[i].seq - part_ids[i] == offset);
+        HOST_CHECK(TagMatches(&parts[i], part_ids[i]));
+        HOST_CHECK(i == 0 || parts[i].seq > parts[i - 1].seq);
+    }
+    HOST_CHECK(overlay_count > 0);
+    int same = 0;
+    for (int i = 0; i < overlay_count; i++) {
+        HOST_CHECK(overlays[i].seq > offset && TagMatches(&overlays[i], (uint32_t)(overlays[i].seq - offset)));
+        HOST_CHECK(i == 0 || overlays[i].seq >= overlays[i - 1].seq);
+        // an overlay of a streamed frame carries that part's timestamp exactly
+        for (int k = 0; k < n; k++) {
+            if (parts[k].seq == overlays[i].seq) {
+                HOST_CHECK(parts[k].ts == overlays[i].ts);
+                same++;
+            }
+        }
+    }
+
+    // Replay what the client would have shown with each part
+    skew_t arrival = { 0 }, synced = { 0 };
+    int o = 0;
+    const tag_t *shown = NULL;
+    for (int k = 0; k < n; k++) {
+        while (o < overlay_count && overlays[o].arrived <= parts[k].arrived) {
+            o++;
+        }
+        if (o) {
+            AddSkew(&arrival, &parts[k], &overlays[o - 1]);
+        }
+        for (int i = o - 1; i >= 0; i--) {
+            if (overlays[i].seq <= parts[k].seq) {
+                shown = shown && shown->seq > overlays[i].seq ? shown : &overlays[i];
+                break;
+            }
+        }
+        if (shown) {
+            AddSkew(&synced, &parts[k], shown);
+        }
+    }
+    HOST_CHECK(synced.frames > 0 && synced.leading == 0);
+    printf("%d parts, %d overlays, %d of them for a streamed frame, sequence offset %" PRId64 "\n", n,
+           overlay_count, same, offset);
+    PrintSkew("on arrival:", &arrival);
+    PrintSkew("synced:", &synced);
+
+    // tagging took nothing from the vision queue
+    camera_fb_t *gray = StreamGetVisionFrame(1000);
+    HOST_CHECK(gray != NULL);
+    if (gray) {
+        StreamReturnVisionFrame(gray);
+    }
+
+    StreamSimStop();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
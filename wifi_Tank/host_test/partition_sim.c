@@ -0,0 +1,224 @@
+/*! \file partition_sim.c
+\brief NOR flash data partition on the host, see partition_sim.h. Times are
+the typical ones of a W25Q32 on the 40 MHz DIO bus of the ESP32 module.
+*****/
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "partition_sim.h"
+
+#define SIM_ADDRESS 0x210000    // after the 2 MB factory app
+#define SIM_CALL_MS 0.02        // command, address and driver overhead per call
+#define SIM_PAGE_MS 0.7         // page program
+#define SIM_SECTOR_MS 45.0      // 4 kB sector erase
+#define SIM_BLOCK_MS 150.0      // 64 kB block erase
+#define SIM_READ_MS_PER_KB 0.1  // 10 MB/s
+
+static struct {
+    esp_partition_t part;
+    uint8_t *data;
+    partition_sim_stats_t stats;
+    uint32_t cut_in;            // writes and erases to the cut, 0 for none
+    bool off;
+    float slow;
+    pthread_mutex_t lock;
+} sim = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+void PartitionSimCreate(const char *label, uint32_t size)
+{
+    pthread_mutex_lock(&sim.lock);
+    free(sim.data);
+    memset(&sim.part, 0, sizeof(sim.part));
+    sim.part.type = ESP_PARTITION_TYPE_DATA;
+    sim.part.subtype = (esp_partition_subtype_t)0x40;
+    sim.part.address = SIM_ADDRESS;
+    sim.part.size = size;
+    sim.part.erase_size = PARTITION_SIM_SECTOR;
+    strncpy(sim.part.label, label, sizeof(sim.part.label) - 1);
+    sim.data = malloc(size);
+    memset(sim.data, 0xff, size);
+    memset(&sim.stats, 0, sizeof(sim.stats));
+    sim.cut_in = 0;
+    sim.off = false;
+    pthread_mutex_unlock(&sim.lock);
+}
+
+void PartitionSimDestroy(void)
+{
+    pthread_mutex_lock(&sim.lock);
+    free(sim.data);
+    sim.data = NULL;
+    pthread_mutex_unlock(&sim.lock);
+}
+
+uint8_t *PartitionSimData(void)
+{
+    return sim.data;
+}
+
+partition_sim_stats_t PartitionSimStats(void)
+{
+    pthread_mutex_lock(&sim.lock);
+    const partition_sim_stats_t stats = sim.stats;
+    pthread_mutex_unlock(&sim.lock);
+    return stats;
+}
+
+void PartitionSimClearStats(void)
+{
+    pthread_mutex_lock(&sim.lock);
+    memset(&sim.stats, 0, sizeof(sim.stats));
+    pthread_mutex_unlock(&sim.lock);
+}
+
+void PartitionSimCutAfter(uint32_t ops)
+{
+    pthread_mutex_lock(&sim.lock);
+    sim.cut_in = ops;
+    pthread_mutex_unlock(&sim.lock);
+}
+
+void PartitionSimPowerOn(void)
+{
+    pthread_mutex_lock(&sim.lock);
+    sim.off = false;
+    sim.cut_in = 0;
+    pthread_mutex_unlock(&sim.lock);
+}
+
+bool PartitionSimPowerLost(void)
+{
+    return sim.off;
+}
+
+void PartitionSimSlow(float factor)
+{
+    sim.slow = factor;
+}
+
+// The chip busy for ms, with the lock released so readers go on meanwhile
+static void Busy(double ms)
+{
+    sim.stats.flash_ms += ms;
+    if (sim.slow > 0.0f) {
+        pthread_mutex_unlock(&sim.lock);
+        usleep((useconds_t)(ms * sim.slow * 1000.0));
+        pthread_mutex_lock(&sim.lock);
+    }
+}
+
+// Whether this write or erase is the one the power is cut in
+static bool Cut(void)
+{
+    if (sim.cut_in && --sim.cut_in == 0) {
+        sim.off = true;
+        return true;
+    }
+    return false;
+}
+
+static bool Valid(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    return partition == &sim.part && sim.data && offset <= sim.part.size && size <= sim.part.size - offset;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label)
+{
+    if (!sim.data || (type != ESP_PARTITION_TYPE_ANY && type != sim.part.type)
+        || (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != sim.part.subtype)
+        || (label && strcmp(label, sim.part.label) != 0)) {
+        return NULL;
+    }
+    return &sim.part;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size)
+{
+    pthread_mutex_lock(&sim.lock);
+    esp_err_t ret = ESP_OK;
+    if (sim.off) {
+        ret = ESP_FAIL;
+    } else if (!Valid(partition, src_offset, size)) {
+        ret = ESP_ERR_INVALID_SIZE;
+    } else {
+        memcpy(dst, sim.data + src_offset, size);
+        sim.stats.reads++;
+        sim.stats.bytes_read += size;
+        Busy(SIM_CALL_MS + size / 1024.0 * SIM_READ_MS_PER_KB);
+    }
+    pthread_mutex_unlock(&sim.lock);
+    return ret;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src, size_t size)
+{
+    pthread_mutex_lock(&sim.lock);
+    if (sim.off) {
+        pthread_mutex_unlock(&sim.lock);
+        return ESP_FAIL;
+    }
+    if (!Valid(partition, dst_offset, size)) {
+        pthread_mutex_unlock(&sim.lock);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    const bool cut = Cut();
+    const size_t len = cut ? size / 2 : size;
+    const uint8_t *s = src;
+    uint8_t *d = sim.data + dst_offset;
+    for (size_t i = 0; i < len; i++) {
+        sim.stats.unerased += (d[i] & s[i]) != s[i];
+        d[i] &= s[i];
+    }
+    sim.stats.writes++;
+    sim.stats.bytes_written += len;
+    uint32_t pages = 0;
+    if (len) {
+        const size_t first = (sim.part.address + dst_offset) / PARTITION_SIM_PAGE;
+        const size_t last = (sim.part.address + dst_offset + len - 1) / PARTITION_SIM_PAGE;
+        pages = (uint32_t)(last - first + 1);
+    }
+    sim.stats.pages += pages;
+    Busy(SIM_CALL_MS + pages * SIM_PAGE_MS);
+    pthread_mutex_unlock(&sim.lock);
+    return cut ? ESP_FAIL : ESP_OK;
+}
+
+// Like esp_flash_erase_region(): 64 kB block erases where the range covers an aligned block
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    pthread_mutex_lock(&sim.lock);
+    if (sim.off) {
+        pthread_mutex_unlock(&sim.lock);
+        return ESP_FAIL;
+    }
+    if (!Valid(partition, offset, size)) {
+        pthread_mutex_unlock(&sim.lock);
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (offset % PARTITION_SIM_SECTOR || size % PARTITION_SIM_SECTOR) {
+        pthread_mutex_unlock(&sim.lock);
+        return ESP_ERR_INVALID_ARG;
+    }
+    const bool cut = Cut();
+    const size_t end = offset + (cut ? size / PARTITION_SIM_SECTOR / 2 * PARTITION_SIM_SECTOR : size);
+    sim.stats.erases++;
+    Busy(SIM_CALL_MS);
+    for (size_t at = offset; at < end; ) {
+        const size_t address = sim.part.address + at;
+        const size_t step = address % PARTITION_SIM_BLOCK == 0 && end - at >= PARTITION_SIM_BLOCK
+                            ? PARTITION_SIM_BLOCK : PARTITION_SIM_SECTOR;
+        memset(sim.data + at, 0xff, step);
+        if (step == PARTITION_SIM_BLOCK) {
+            sim.stats.blocks++;
+            Busy(SIM_BLOCK_MS);
+        } else {
+            sim.stats.sectors++;
+            Busy(SIM_SECTOR_MS);
+        }
+        at += step;
+    }
+    pthread_mutex_unlock(&sim.lock);
+    return cut ? ESP_FAIL : ESP_OK;
+}
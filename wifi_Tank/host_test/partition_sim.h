@@ -0,0 +1,89 @@
+/*! \file partition_sim.h
+\brief Host model of a data partition on NOR flash for the esp_partition.h
+stand-in. partition_sim.c keeps the partition in memory: a write can only
+clear bits (it ANDs into what is there), an erase sets 4 kB sectors to 0xFF.
+It counts what the chip would have done and what that takes with the
+typical times of a 4 MB SPI NOR part, and can cut the power in the middle
+of an operation to test what a reader finds after a crash.
+*****/
+#ifndef PARTITION_SIM_H
+#define PARTITION_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_partition.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PARTITION_SIM_SECTOR 4096
+#define PARTITION_SIM_BLOCK 65536
+#define PARTITION_SIM_PAGE 256
+
+typedef struct {
+    uint32_t reads;             // esp_partition_read() calls
+    uint32_t writes;            // esp_partition_write() calls
+    uint32_t erases;            // esp_partition_erase_range() calls
+    size_t bytes_read;
+    size_t bytes_written;
+    uint32_t pages;             // 256 byte pages programmed, a partial page costs a whole one
+    uint32_t sectors;           // 4 kB sector erases
+    uint32_t blocks;            // 64 kB block erases, where an erase covers an aligned block
+    uint32_t unerased;          // bytes written that needed an erase first (a 0 bit set to 1)
+    double flash_ms;            // time the chip was busy, modelled
+} partition_sim_stats_t;
+
+/**
+ * @brief Create the one partition, erased, at flash offset 0x210000 (after the
+ *        factory app of partitions.csv). Replaces a partition created before.
+ * @param label Partition label
+ * @param size Bytes, a multiple of 4 kB
+ */
+void PartitionSimCreate(const char *label, uint32_t size);
+
+/**
+ * @brief Free the partition, esp_partition_find_first() finds nothing after it
+ */
+void PartitionSimDestroy(void);
+
+/**
+ * @brief The partition contents, to copy or restore an image
+ */
+uint8_t *PartitionSimData(void);
+
+/**
+ * @brief Counters since PartitionSimCreate() or PartitionSimClearStats()
+ */
+partition_sim_stats_t PartitionSimStats(void);
+void PartitionSimClearStats(void);
+
+/**
+ * @brief Cut the power during the ops-th write or erase from now: a write
+ *        programs the first half of its bytes, an erase the first half of its
+ *        sectors, and every call after it fails until PartitionSimPowerOn()
+ * @param ops Writes and erases until the cut, from 1, 0 for none
+ */
+void PartitionSimCutAfter(uint32_t ops);
+
+/**
+ * @brief Power back on after a cut, the contents stay as the cut left them
+ */
+void PartitionSimPowerOn(void);
+
+/**
+ * @brief Whether a cut happened and the power is off
+ */
+bool PartitionSimPowerLost(void);
+
+/**
+ * @brief Make each call take its modelled time times factor, 0 (default) to return at once
+ */
+void PartitionSimSlow(float factor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,122 @@
+/*! \file pixconv_bench.c
+\brief Throughput of the row pixel converters against the per-pixel code they
+replaced, one line per format pair.
+
+Usage: pixconv_bench [frames]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include "pixconv.h"
+#include "yuv.h"
+#include "host_util.h"
+
+#define W 640
+#define H 480
+#define PIXELS (W * H)
+
+static void RefYuv422ToRgb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    uint8_t r, g, b;
+    for (size_t i = 0; i < pixels; i += 2, src += 4) {
+        yuv2rgb(src[0], src[1], src[3], &r, &g, &b);
+        *dst++ = r; *dst++ = g; *dst++ = b;
+        yuv2rgb(src[2], src[1], src[3], &r, &g, &b);
+        *dst++ = r; *dst++ = g; *dst++ = b;
+    }
+}
+
+static void RefYuv422ToRgb565(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    uint8_t r, g, b;
+    for (size_t i = 0; i < pixels; i++) {
+        yuv2rgb(src[(i & ~1) * 2 + (i & 1) * 2], src[(i & ~1) * 2 + 1], src[(i & ~1) * 2 + 3], &r, &g, &b);
+        *dst++ = (r & 0xF8) | (g >> 5);
+        *dst++ = ((g & 0x1C) << 3) | (b >> 3);
+    }
+}
+
+static void RefYuv422ToY8(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++) {
+        dst[i] = src[i * 2];
+    }
+}
+
+static void RefRgb565ToRgb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    uint8_t hb, lb;
+    for (size_t i = 0; i < pixels; i++) {
+        hb = *src++;
+        lb = *src++;
+        *dst++ = hb & 0xF8;
+        *dst++ = (hb & 0x07) << 5 | (lb & 0xE0) >> 3;
+        *dst++ = (lb & 0x1F) << 3;
+    }
+}
+
+static void RefRgb888ToRgb565(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels; i++, src += 3) {
+        uint16_t v = (src[0] >> 3) << 11 | (src[1] >> 2) << 5 | (src[2] >> 3);
+        *dst++ = v >> 8;
+        *dst++ = v & 0xff;
+    }
+}
+
+static void RefSwapRb888(const uint8_t *src, uint8_t *dst, size_t pixels)
+{
+    for (size_t i = 0; i < pixels * 3; i += 3) {
+        dst[i] = src[i + 2];
+        dst[i + 1] = src[i + 1];
+        dst[i + 2] = src[i];
+    }
+}
+
+typedef void (*conv_fn)(const uint8_t *src, uint8_t *dst, size_t pixels);
+
+typedef struct {
+    const char *name;
+    conv_fn ref;
+    conv_fn fast;
+} bench_case_t;
+
+static double Run(conv_fn fn, const uint8_t *src, uint8_t *dst, int frames)
+{
+    int64_t t0 = HostTimeUs();
+    for (int f = 0; f < frames; f++) {
+        for (int y = 0; y < H; y++) {
+            fn(src + y * W * 3, dst + y * W * 3, W);
+        }
+    }
+    int64_t dt = HostTimeUs() - t0;
+    return dt > 0 ? (double)PIXELS * frames / dt : 0;
+}
+
+int main(int argc, char **argv)
+{
+    int frames = argc > 1 ? atoi(argv[1]) : 50;
+    uint8_t *src = malloc(PIXELS * 3), *dst = malloc(PIXELS * 3);
+    for (int i = 0; i < PIXELS * 3; i++) {
+        src[i] = (i * 131) ^ (i >> 7);
+    }
+
+    const bench_case_t cases[] = {
+        { "YUV422 -> RGB888", RefYuv422ToRgb888, pixconv_yuv422_to_rgb888 },
+        { "YUV422 -> RGB565", RefYuv422ToRgb565, pixconv_yuv422_to_rgb565 },
+        { "YUV422 -> Y8", RefYuv422ToY8, pixconv_yuv422_to_y8 },
+        { "RGB565 -> RGB888", RefRgb565ToRgb888, pixconv_rgb565_to_rgb888 },
+        { "RGB888 -> RGB565", RefRgb888ToRgb565, pixconv_rgb888_to_rgb565 },
+        { "RGB888 <-> BGR888", RefSwapRb888, pixconv_swap_rb888 },
+    };
+
+    printf("%dx%d, %d frames, Mpixel/s\n", W, H, frames);
+    printf("%-20s %10s %10s %8s\n", "format", "per-pixel", "row", "speedup");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        double ref = Run(cases[i].ref, src, dst, frames);
+        double fast = Run(cases[i].fast, src, dst, frames);
+        printf("%-20s %10.1f %10.1f %7.2fx\n", cases[i].name, ref, fast, ref > 0 ? fast / ref : 0);
+    }
+    free(src);
+    free(dst);
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*! \file pixconv_test.c
+\brief Row pixel converters against the per-pixel reference code they replaced
+in to_bmp.c / to_jpg.cpp, plus fmt2rgb888 end to end.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "pixconv.h"
+#include "yuv.h"
+#include "host_util.h"
+
+#define W 322
+#define H 7
+#define PIXELS (W * H)
+
+// Reference: per-pixel code as used before pixconv
+static void RefYuv422(const uint8_t *src, uint8_t *dst, size_t pixels, int bgr)
+{
+    uint8_t r, g, b;
+    for (size_t i = 0; i < pixels; i += 2, src += 4) {
+        yuv2rgb(src[0], src[1], src[3], &r, &g, &b);
+        *dst++ = bgr ? b : r; *dst++ = g; *dst++ = bgr ? r : b;
+        yuv2rgb(src[2], src[1], src[3], &r, &g, &b);
+        *dst++ = bgr ? b : r; *dst++ = g; *dst++ = bgr ? r : b;
+    }
+}
+
+static void RefRgb565(const uint8_t *src, uint8_t *dst, size_t pixels, int bgr)
+{
+    for (size_t i = 0; i < pixels; i++, src += 2) {
+        uint8_t hb = src[0], lb = src[1];
+        uint8_t r = hb & 0xF8, g = (hb & 0x07) << 5 | (lb & 0xE0) >> 3, b = (lb & 0x1F) << 3;
+        *dst++ = bgr ? b : r; *dst++ = g; *dst++ = bgr ? r : b;
+    }
+}
+
+static void Fill(uint8_t *buf, size_t len, unsigned seed)
+{
+    srand(seed);
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = rand() & 0xff;
+    }
+}
+
+static void TestYuv422(void)
+{
+    uint8_t *src = malloc(PIXELS * 2), *ref = malloc(PIXELS * 3), *out = malloc(PIXELS * 3);
+    Fill(src, PIXELS * 2, 1);
+
+    RefYuv422(src, ref, PIXELS, 0);
+    pixconv_yuv422_to_rgb888(src, out, PIXELS);
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    RefYuv422(src, ref, PIXELS, 1);
+    pixconv_yuv422_to_bgr888(src, out, PIXELS);
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    // RGB565 must equal RGB888 truncated
+    RefYuv422(src, ref, PIXELS, 0);
+    pixconv_yuv422_to_rgb565(src, out, PIXELS);
+    for (int i = 0; i < PIXELS; i++) {
+        uint16_t v = out[i * 2] << 8 | out[i * 2 + 1];
+        HOST_CHECK((v >> 11) == ref[i * 3] >> 3);
+        HOST_CHECK(((v >> 5) & 0x3F) == ref[i * 3 + 1] >> 2);
+        HOST_CHECK((v & 0x1F) == ref[i * 3 + 2] >> 3);
+    }
+
+    pixconv_yuv422_to_y8(src, out, PIXELS);
+    for (int i = 0; i < PIXELS; i++) {
+        HOST_CHECK(out[i] == src[i * 2]);
+    }
+
+    // Every Y, U, V combination against yuv2rgb
+    uint8_t quad[4], rgb[6], r, g, b;
+    int mismatches = 0;
+    for (int u = 0; u < 256; u++) {
+        for (int v = 0; v < 256; v++) {
+            for (int y = 0; y < 256; y++) {
+                quad[0] = y; quad[1] = u; quad[2] = 255 - y; quad[3] = v;
+                pixconv_yuv422_to_rgb888(quad, rgb, 2);
+                yuv2rgb(y, u, v, &r, &g, &b);
+                mismatches += rgb[0] != r || rgb[1] != g || rgb[2] != b;
+                yuv2rgb(255 - y, u, v, &r, &g, &b);
+                mismatches += rgb[3] != r || rgb[4] != g || rgb[5] != b;
+            }
+        }
+    }
+    HOST_CHECK(mismatches == 0);
+
+    free(src);
+    free(ref);
+    free(out);
+}
+
+static void TestRgb565(void)
+{
+    uint8_t *src = malloc(PIXELS * 2), *ref = malloc(PIXELS * 3), *out = malloc(PIXELS * 3);
+    uint8_t *back = malloc(PIXELS * 2);
+    Fill(src, PIXELS * 2, 2);
+
+    RefRgb565(src, ref, PIXELS, 0);
+    pixconv_rgb565_to_rgb888(src, out, PIXELS);
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    // RGB888 -> RGB565 must round trip
+    pixconv_rgb888_to_rgb565(out, back, PIXELS);
+    HOST_CHECK(memcmp(src, back, PIXELS * 2) == 0);
+
+    RefRgb565(src, ref, PIXELS, 1);
+    pixconv_rgb565_to_bgr888(src, out, PIXELS);
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    // BGR swap, out of place and in place
+    RefRgb565(src, ref, PIXELS, 0);
+    pixconv_swap_rb888(out, back = realloc(back, PIXELS * 3), PIXELS);
+    HOST_CHECK(memcmp(ref, back, PIXELS * 3) == 0);
+    pixconv_swap_rb888(out, out, PIXELS);
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    free(src);
+    free(ref);
+    free(out);
+    free(back);
+}
+
+static void TestFmt2rgb888(void)
+{
+    uint8_t *src = malloc(PIXELS * 2), *ref = malloc(PIXELS * 3), *out = malloc(PIXELS * 3);
+    Fill(src, PIXELS * 2, 3);
+
+    RefYuv422(src, ref, PIXELS, 1);
+    HOST_CHECK(fmt2rgb888(src, PIXELS * 2, PIXFORMAT_YUV422, out));
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    RefRgb565(src, ref, PIXELS, 1);
+    HOST_CHECK(fmt2rgb888(src, PIXELS * 2, PIXFORMAT_RGB565, out));
+    HOST_CHECK(memcmp(ref, out, PIXELS * 3) == 0);
+
+    HOST_CHECK(fmt2rgb888(src, PIXELS, PIXFORMAT_GRAYSCALE, out));
+    for (int i = 0; i < PIXELS; i++) {
+        HOST_CHECK(out[i * 3] == src[i] && out[i * 3 + 1] == src[i] && out[i * 3 + 2] == src[i]);
+    }
+
+    free(src);
+    free(ref);
+    free(out);
+}
+
+int main(void)
+{
+    TestYuv422();
+    TestRgb565();
+    TestFmt2rgb888();
+    printf("pixconv_test: %s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+// player_parse_test.js - MjpegParser of player_worker.js on a stream recorded
+// by mjpeg_capture. The capture is fed in chunks of random size, as fetch
+// hands them over; the parser must find every complete part mjpeg_capture
+// counted, each a JPEG of the length its headers give, with the frame
+// sequence numbers rising. Then it is timed against the reader of
+// overlay_demo.html (joins every chunk to what is left, searches from the
+// start) on the same chunks.
+//
+// Usage: node player_parse_test.js <capture file> [passes]
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const { MjpegParser, frameOf } = require(path.join(__dirname, '..', 'player_worker.js'));
+
+const MIN_MB_PER_S = 30;        // ten times an HD stream at 30 fps of 100 kB frames
+
+let failures = 0;
+function check(cond, what) {
+    if (!cond) {
+        console.log('FAIL ' + what);
+        failures++;
+    }
+}
+
+// Chunk sizes from 1 byte to 64 kB, the same for both readers
+function chunksOf(buf, seed) {
+    const chunks = [];
+    for (let at = 0; at < buf.length; ) {
+        seed = (seed * 1103515245 + 12345) >>> 0;
+        const n = (seed >>> 8) % 8 === 0 ? 1 + (seed >>> 16) % 16 : 1 + (seed >>> 12) % 65536;
+        chunks.push(buf.subarray(at, Math.min(at + n, buf.length)));
+        at += n;
+    }
+    return chunks;
+}
+
+// overlay_demo.html's reader, the baseline
+function demoReader(boundaryText, onPart) {
+    const encoder = new TextEncoder();
+    const decoder = new TextDecoder();
+    const boundary = encoder.encode('--' + boundaryText);
+    const headerEnd = encoder.encode('\r\n\r\n');
+    let buf = new Uint8Array(0);
+    let part = null;
+    function indexOf(b, pattern, from) {
+        outer: for (let i = from; i <= b.length - pattern.length; i++) {
+            for (let j = 0; j < pattern.length; j++) {
+                if (b[i + j] !== pattern[j]) {
+                    continue outer;
+                }
+            }
+            return i;
+        }
+        return -1;
+    }
+    return function(value) {
+        const joined = new Uint8Array(buf.length + value.length);
+        joined.set(buf);
+        joined.set(value, buf.length);
+        buf = joined;
+        while (true) {
+            if (!part) {
+                const start = indexOf(buf, boundary, 0);
+                const end = start < 0 ? -1 : indexOf(buf, headerEnd, start);
+                if (end < 0) {
+                    break;
+                }
+                part = {};
+                decoder.decode(buf.subarray(start + boundary.length, end)).split('\r\n').forEach(function(line) {
+                    const colon = line.indexOf(':');
+                    if (colon > 0) {
+                        part[line.slice(0, colon).trim().toLowerCase()] = line.slice(colon + 1).trim();
+                    }
+                });
+                buf = buf.slice(end + headerEnd.length);
+            }
+            const len = parseInt(part['content-length'] || '0', 10);
+            if (buf.length < len) {
+                break;
+            }
+            onPart(part, buf.slice(0, len));
+            buf = buf.slice(len);
+            part = null;
+        }
+    };
+}
+
+function time(chunks, bytes, passes, makeReader) {
+    let parts = 0;
+    const t0 = process.hrtime.bigint();
+    for (let p = 0; p < passes; p++) {
+        const push = makeReader(function() { parts++; });
+        chunks.forEach(push);
+    }
+    const s = Number(process.hrtime.bigint() - t0) / 1e9;
+    return { mbs: bytes * passes / 1e6 / s, fps: parts / s };
+}
+
+function main() {
+    const file = process.argv[2];
+    const passes = parseInt(process.argv[3] || '20', 10);
+    const capture = fs.readFileSync(file);
+    const expected = JSON.parse(fs.readFileSync(file + '.json', 'utf8'));
+    const chunks = chunksOf(new Uint8Array(capture.buffer, capture.byteOffset, capture.length), 1);
+    console.log(`${capture.length} bytes in ${chunks.length} chunks, ${expected.parts} parts expected`);
+
+    // Every part, intact and in order
+    const frames = [];
+    let bytes = 0;
+    const parser = new MjpegParser(expected.boundary, function(headers, data) {
+        const frame = frameOf(headers, data);
+        check(headers['content-type'] === 'image/jpeg', 'part type');
+        check(data.length === parseInt(headers['content-length'], 10), 'part length');
+        check(data[0] === 0xff && data[1] === 0xd8 && data[data.length - 2] === 0xff && data[data.length - 1] === 0xd9,
+              `part ${frames.length} is not a whole JPEG`);
+        check(frame.seq > 0 && frame.ts > 0, 'frame tags');
+        check(!frames.length || frame.seq > frames[frames.length - 1].seq, 'sequence numbers rise');
+        frames.push(frame);
+        bytes += data.length;
+    });
+    chunks.forEach(function(chunk) { parser.push(chunk); });
+    check(frames.length === expected.parts, `${frames.length} parts found, ${expected.parts} in the capture`);
+    check(bytes === expected.part_bytes, `${bytes} part bytes, ${expected.part_bytes} in the capture`);
+    check(parser.bytes === capture.length, 'every byte pushed');
+
+    // Without Content-Length the parts end at the next delimiter
+    const stripped = Buffer.from(capture.toString('latin1').replace(/Content-Length: \d+\r\n/g, ''), 'latin1');
+    let open = 0;
+    const lengths = frames.map(function(f) { return f.data.length; });
+    const noLength = new MjpegParser(expected.boundary, function(headers, data) {
+        check(data.length === lengths[open], `part ${open} without Content-Length: ${data.length} bytes`);
+        open++;
+    });
+    chunksOf(new Uint8Array(stripped.buffer, stripped.byteOffset, stripped.length), 2).forEach(function(chunk) {
+        noLength.push(chunk);
+    });
+    // the last complete part has no delimiter after it
+    check(open === frames.length - 1 || open === frames.length, `${open} parts found without Content-Length`);
+
+    const parsed = time(chunks, capture.length, passes, function(onPart) {
+        const p = new MjpegParser(expected.boundary, onPart);
+        return function(chunk) { p.push(chunk); };
+    });
+    const demo = time(chunks, capture.length, Math.max(1, passes / 10), function(onPart) {
+        return demoReader(expected.boundary, onPart);
+    });
+    console.log(`MjpegParser:        ${parsed.mbs.toFixed(1)} MB/s, ${parsed.fps.toFixed(0)} parts/s`);
+    console.log(`overlay_demo.html:  ${demo.mbs.toFixed(1)} MB/s, ${demo.fps.toFixed(0)} parts/s`);
+    check(parsed.mbs > MIN_MB_PER_S, `throughput below ${MIN_MB_PER_S} MB/s`);
+
+    console.log(failures ? 'FAILED' : 'OK');
+    process.exit(failures ? 1 : 0);
+}
+
+main();
@@ -0,0 +1,409 @@
+/*! \file recorder_test.c
+\brief main/recorder.c on the flash model (partition_sim.c). The ring keeps
+the newest frames within its byte, frame and age limits, one per interval; a
+trigger writes exactly the frames it held while recording goes on, new frames
+dropped rather than written over ones still to be flushed. On the host
+streaming stack (stream_sim.c) the recorder captures by itself while no
+stream runs, POST /recorder/trigger writes the clip with its thumbnails (409
+while one is being written) and GET /recorder lists it. /recorder/clip
+serves it as a file with byte ranges from a sender task, cut short when a
+clip is written over it, /recorder/frame its frames by time.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "recorder.h"
+#include "clip.h"
+#include "partition_sim.h"
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "jpeg_decoder.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18090
+#define TIMEOUT_MS 5000
+#define FPS 10
+#define PART_SIZE 0x1F0000      // partitions.csv
+#define MAX_FRAME (48 * 1024)
+#define MAX_SEQ 4096
+
+static uint16_t port;
+
+// A JPEG-like frame whose bytes follow from its sequence number
+static size_t MakeFrame(uint32_t sequence, uint8_t *buf)
+{
+    uint32_t state = sequence * 2654435761u + 1;
+    const size_t len = 4096 + sequence * 7919 % (MAX_FRAME - 4096);
+    buf[0] = 0xff;
+    buf[1] = 0xd8;
+    for (size_t i = 2; i < len - 2; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        buf[i] = (uint8_t)state;
+    }
+    buf[len - 2] = 0xff;
+    buf[len - 1] = 0xd9;
+    return len;
+}
+
+// Offer frame seq, captured 50 ms after the one before
+static bool Offer(uint32_t seq, uint8_t *buf)
+{
+    camera_fb_t fb = { .buf = buf, .format = PIXFORMAT_JPEG, .sequence = seq, .capture_start_us = seq * 50000LL };
+    fb.len = MakeFrame(seq, buf);
+    return RecorderAddFrame(&fb);
+}
+
+static bool WaitFlushed(void)
+{
+    recorder_status_t st;
+    const int64_t until = esp_timer_get_time() + 20 * TIMEOUT_MS * 1000LL;
+    do {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        RecorderGetStatus(&st);
+    } while (st.flushing && esp_timer_get_time() < until);
+    return !st.flushing;
+}
+
+// The newest clip holds exactly these frames
+static bool NewestClipIs(const uint32_t *seqs, uint32_t count)
+{
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    clip_info_t clips[8];
+    const int n = ClipScan(part, clips, 8);
+    if (n < 1 || clips[n - 1].header.frame_count != count || ClipVerify(part, &clips[n - 1]) != ESP_OK) {
+        return false;
+    }
+    clip_entry_t *entries = malloc(count * sizeof(clip_entry_t));
+    uint8_t *want = malloc(MAX_FRAME);
+    uint8_t *got = malloc(MAX_FRAME);
+    bool ok = ClipReadEntries(part, &clips[n - 1], 0, entries, count) == ESP_OK;
+    for (uint32_t i = 0; i < count && ok; i++) {
+        const size_t len = MakeFrame(seqs[i], want);
+        ok = entries[i].sequence == seqs[i] && entries[i].time_us == seqs[i] * 50000LL && entries[i].len == len
+             && ClipReadFrame(part, &clips[n - 1], &entries[i], got) == ESP_OK && memcmp(got, want, len) == 0;
+    }
+    free(entries);
+    free(want);
+    free(got);
+    return ok;
+}
+
+static void CheckRing(void)
+{
+    PartitionSimCreate("recorder", PART_SIZE);
+    recorder_config_t config = RECORDER_DEFAULT_CONFIG();
+    config.ring_bytes = 256 * 1024;
+    config.max_frames = 16;
+    config.seconds = 1;
+    config.interval_ms = 100;
+    config.capture = false;
+    HOST_CHECK(RecorderInit(&config) == 0);
+
+    uint8_t *buf = malloc(MAX_FRAME);
+    static uint32_t recorded[MAX_SEQ];
+    uint32_t n = 0;
+    uint32_t seq = 1;
+    bool full_bytes = false, full_age = false;
+    recorder_status_t st;
+
+    // one frame in two at 20 fps and 100 ms, the ring within its limits, the newest frame in it
+    for (; seq <= 200; seq++) {
+        const bool taken = Offer(seq, buf);
+        HOST_CHECK(taken == (seq % 2 == 1));
+        if (taken) {
+            recorded[n++] = seq;
+        }
+        RecorderGetStatus(&st);
+        HOST_CHECK(st.frames >= 1 && st.frames <= config.max_frames && st.bytes <= config.ring_bytes);
+        HOST_CHECK(st.newest_us == recorded[n - 1] * 50000LL);
+        HOST_CHECK(st.newest_us - st.oldest_us <= config.seconds * 1000000LL);
+        full_bytes |= st.bytes + MAX_FRAME > config.ring_bytes;
+        full_age |= st.newest_us - st.oldest_us >= config.seconds * 1000000LL - 100000;
+    }
+    HOST_CHECK(full_bytes && full_age);
+    HOST_CHECK(st.recorded == n && st.evicted == n - st.frames && st.dropped == 0);
+    printf("ring: %u frames recorded, %u kept (%u kB, %.1f s)\n", n, st.frames, (unsigned)(st.bytes / 1024),
+           (st.newest_us - st.oldest_us) / 1e6);
+
+    // a flush on slow flash: the frames of the trigger, new ones dropped until there is room
+    PartitionSimSlow(1.0f);
+    HOST_CHECK(RecorderTrigger() == ESP_OK);
+    const uint32_t flushed = st.frames;
+    const uint32_t *flush_seqs = &recorded[n - flushed];
+    HOST_CHECK(RecorderTrigger() == ESP_ERR_INVALID_STATE);
+    uint32_t during = 0;
+    for (;; seq++) {
+        RecorderGetStatus(&st);
+        if (!st.flushing) {
+            break;
+        }
+        during += Offer(seq, buf);
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    const recorder_status_t after = st;
+    HOST_CHECK(after.flushes == 1 && after.last_clip == 1 && after.flush_errors == 0);
+    HOST_CHECK(after.dropped > 0 && during > 0);
+    HOST_CHECK(NewestClipIs(flush_seqs, flushed));
+    printf("flush: %u frames in %u ms of modelled flash, meanwhile %u frames recorded and %u dropped\n",
+           flushed, after.last_flush_ms, during, after.dropped);
+    PartitionSimSlow(0.0f);
+
+    // the ring wrapped meanwhile; a second clip has the frames now in it
+    n = 0;
+    for (uint32_t end = seq + 40; seq < end; seq++) {
+        if (Offer(seq, buf)) {
+            recorded[n++] = seq;
+        }
+    }
+    RecorderGetStatus(&st);
+    HOST_CHECK(RecorderTrigger() == ESP_OK);
+    HOST_CHECK(WaitFlushed());
+    HOST_CHECK(NewestClipIs(&recorded[n - st.frames], st.frames));
+    RecorderGetStatus(&st);
+    HOST_CHECK(st.flushes == 2 && st.last_clip == 2);
+
+    RecorderStop();
+    HOST_CHECK(!Offer(seq, buf) && RecorderTrigger() == ESP_ERR_INVALID_STATE);
+
+    // the frame limit, after a restart
+    config.max_frames = 4;
+    HOST_CHECK(RecorderInit(&config) == 0);
+    for (uint32_t end = seq + 20; seq < end; seq += 2) {
+        HOST_CHECK(Offer(seq, buf));
+    }
+    RecorderGetStatus(&st);
+    HOST_CHECK(st.frames == 4 && st.recorded == 10 && st.evicted == 6);
+    RecorderStop();
+    free(buf);
+    PartitionSimDestroy();
+}
+
+// A short response, its body NUL terminated
+static int Request(const char *method, const char *path, char *body, size_t size)
+{
+    stream_client_t c;
+    if (!StreamClientRequest(&c, port, method, path, "Content-Length: 0\r\n", TIMEOUT_MS)) {
+        return 0;
+    }
+    const size_t n = StreamClientRead(&c, (uint8_t *)body, size - 1);
+    body[n] = 0;
+    StreamClientClose(&c);
+    return c.status;
+}
+
+static long JsonNumber(const char *body, const char *key)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char *p = strstr(body, pattern);
+    return p ? strtol(p + strlen(pattern), NULL, 10) : -1;
+}
+
+// A GET with extra headers, its whole body read into buf
+static int Get(const char *path, const char *headers, stream_client_t *c, uint8_t *buf, size_t cap, size_t *len)
+{
+    *len = 0;
+    if (!StreamClientRequest(c, port, "GET", path, headers, TIMEOUT_MS)) {
+        return 0;
+    }
+    for (size_t n; *len < cap && (n = StreamClientRead(c, buf + *len, cap - *len)) > 0; ) {
+        *len += n;
+    }
+    StreamClientClose(c);
+    return c->status;
+}
+
+// /recorder/clip with and without ranges, /recorder/frame by time
+static void CheckClipRoutes(const esp_partition_t *part, const clip_info_t *clip, const clip_entry_t *entries,
+                            uint8_t *buf)
+{
+    const uint32_t size = ClipFileSize(clip);
+    uint8_t *want = malloc(size);
+    HOST_CHECK(ClipRead(part, clip, 0, want, size) == ESP_OK);
+    stream_client_t c;
+    size_t len;
+    char value[64];
+    char path[64];
+
+    // the clip as a file, its ETag revalidated
+    HOST_CHECK(Get("/recorder/clip", NULL, &c, buf, 512 * 1024, &len) == 200);
+    HOST_CHECK(len == size && memcmp(buf, want, size) == 0);
+    HOST_CHECK(StreamClientHeader(&c, "Accept-Ranges", value, sizeof(value)) && strcmp(value, "bytes") == 0);
+    char etag[64], match[96];
+    HOST_CHECK(StreamClientHeader(&c, "ETag", etag, sizeof(etag)));
+    snprintf(match, sizeof(match), "If-None-Match: %s\r\n", etag);
+    HOST_CHECK(Get("/recorder/clip?n=1", match, &c, buf, 512 * 1024, &len) == 304 && len == 0);
+
+    // ranges: the header, the index at the end, one frame, and past the end
+    HOST_CHECK(Get("/recorder/clip?n=1", "Range: bytes=0-63\r\n", &c, buf, 512 * 1024, &len) == 206);
+    HOST_CHECK(len == 64 && memcmp(buf, want, 64) == 0);
+    snprintf(value, sizeof(value), "bytes 0-63/%u", size);
+    char got[64];
+    HOST_CHECK(StreamClientHeader(&c, "Content-Range", got, sizeof(got)) && strcmp(got, value) == 0);
+    const uint32_t index_bytes = clip->header.frame_count * sizeof(clip_entry_t);
+    snprintf(match, sizeof(match), "Range: bytes=-%u\r\n", index_bytes);
+    HOST_CHECK(Get("/recorder/clip", match, &c, buf, 512 * 1024, &len) == 206);
+    HOST_CHECK(len == index_bytes && memcmp(buf, entries, index_bytes) == 0);
+    const clip_entry_t *e = &entries[clip->header.frame_count / 2];
+    snprintf(match, sizeof(match), "Range: bytes=%u-%u\r\n", e->offset, e->offset + e->len - 1);
+    HOST_CHECK(Get("/recorder/clip", match, &c, buf, 512 * 1024, &len) == 206);
+    HOST_CHECK(len == e->len && memcmp(buf, want + e->offset, len) == 0);
+    snprintf(match, sizeof(match), "Range: bytes=%u-\r\n", size);
+    HOST_CHECK(Get("/recorder/clip", match, &c, buf, 512 * 1024, &len) == 416);
+    HOST_CHECK(Get("/recorder/clip?n=9", NULL, &c, buf, 512 * 1024, &len) == 404);
+
+    // frames by time from the first frame: the one shown then, or the thumbnail before it
+    const int64_t span_ms = (clip->header.last_us - clip->header.first_us) / 1000;
+    for (int64_t t = -100; t <= span_ms + 100; t += 50) {
+        for (int thumb = 0; thumb < 2; thumb++) {
+            uint32_t index;
+            clip_entry_t entry;
+            const esp_err_t err = ClipSeek(part, clip, clip->header.first_us + t * 1000, thumb, &index, &entry);
+            snprintf(path, sizeof(path), "/recorder/frame?t=%lld%s", (long long)t, thumb ? "&thumb=1" : "");
+            const int status = Get(path, NULL, &c, buf, 512 * 1024, &len);
+            if (err != ESP_OK) {
+                HOST_CHECK(err == ESP_ERR_NOT_FOUND && thumb && t < 0 && status == 404);
+                continue;
+            }
+            HOST_CHECK(status == 200 && len == entry.len && memcmp(buf, want + entry.offset, len) == 0);
+            HOST_CHECK(StreamClientHeader(&c, "X-Frame-Index", value, sizeof(value)) &&
+                       (uint32_t)atoi(value) == index);
+            HOST_CHECK(StreamClientHeader(&c, "X-Clip-Offset", value, sizeof(value)) &&
+                       (uint32_t)atoi(value) == entry.offset);
+            HOST_CHECK(!!(entry.flags & CLIP_ENTRY_THUMB) == thumb);
+            // the newest frame at or before t
+            HOST_CHECK(t < 0 ? index == 0 : entry.time_us <= clip->header.first_us + t * 1000);
+            HOST_CHECK(index + 2 >= clip->header.frame_count || thumb ||
+                       entries[index + 1 + !!(entries[index + 1].flags & CLIP_ENTRY_THUMB)].time_us >
+                       clip->header.first_us + t * 1000);
+        }
+    }
+    HOST_CHECK(Get("/recorder/frame?t=x", NULL, &c, buf, 512 * 1024, &len) == 400);
+    free(want);
+}
+
+// A clip written over the one being downloaded cuts the body short, other requests go on meanwhile
+static void CheckOverwrittenClip(const esp_partition_t *part, const clip_info_t *clip, uint8_t *buf)
+{
+    const uint32_t size = ClipFileSize(clip);
+    uint8_t *image = malloc(part->size);
+    memcpy(image, PartitionSimData(), part->size);
+    PartitionSimSlow(20.0f);
+
+    stream_client_t c;
+    char body[256];
+    HOST_CHECK(StreamClientRequest(&c, port, "GET", "/recorder/clip", NULL, TIMEOUT_MS) && c.status == 200);
+    size_t len = StreamClientRead(&c, buf, 4096);
+    const int64_t start = esp_timer_get_time();
+    HOST_CHECK(Request("GET", "/stats", body, sizeof(body)) == 200);
+    const int64_t stats_us = esp_timer_get_time() - start;
+    HOST_CHECK(stats_us < 200000);      // the whole clip takes about 750 ms to read
+
+    // what ClipWriterBegin() does to a clip in its way, before it erases
+    const uint32_t zero = 0;
+    HOST_CHECK(esp_partition_write(part, clip->offset, &zero, sizeof(zero)) == ESP_OK);
+    for (size_t n; len < 512 * 1024 && (n = StreamClientRead(&c, buf + len, 512 * 1024 - len)) > 0; ) {
+        len += n;
+    }
+    HOST_CHECK(len < size);
+    HOST_CHECK(memcmp(buf, image + clip->offset, len) == 0);
+    StreamClientClose(&c);
+    printf("clip overwritten while sent: %zu of %u bytes, /stats meanwhile in %lld ms\n", len, size,
+           (long long)(stats_us / 1000));
+
+    PartitionSimSlow(0.0f);
+    memcpy(PartitionSimData(), image, part->size);
+    free(image);
+}
+
+static void CheckOnStack(void)
+{
+    recorder_config_t config = RECORDER_DEFAULT_CONFIG();
+    config.ring_bytes = 1024 * 1024;
+    config.seconds = 3;
+    const stream_sim_config_t sim = { .fps = FPS, .port = port, .seed = 5, .recorder = &config };
+    HOST_CHECK(StreamSimStart(&sim) == ESP_OK);
+    char body[2048];
+
+    // nobody streams, the recorder takes frames itself
+    int64_t until = esp_timer_get_time() + TIMEOUT_MS * 1000LL;
+    do {
+        vTaskDelay(pdMS_TO_TICKS(100));
+        HOST_CHECK(Request("GET", "/recorder", body, sizeof(body)) == 200);
+    } while (JsonNumber(body, "frames") < 5 && esp_timer_get_time() < until);
+    HOST_CHECK(JsonNumber(body, "frames") >= 5 && strstr(body, "\"clips\":[]") != NULL);
+
+    PartitionSimSlow(0.5f);
+    HOST_CHECK(Request("POST", "/recorder/trigger", body, sizeof(body)) == 202);
+    const long frames = JsonNumber(body, "frames");
+    HOST_CHECK(frames >= 5);
+    HOST_CHECK(Request("POST", "/recorder/trigger", body, sizeof(body)) == 409);
+    HOST_CHECK(WaitFlushed());
+    PartitionSimSlow(0.0f);
+
+    HOST_CHECK(Request("GET", "/recorder", body, sizeof(body)) == 200);
+    HOST_CHECK(JsonNumber(body, "flushes") == 1 && JsonNumber(body, "last_clip") == 1);
+    const long thumbs = JsonNumber(body, "thumbs");
+    HOST_CHECK(thumbs >= 1 && thumbs <= frames);
+    char expect[64];
+    snprintf(expect, sizeof(expect), "\"clips\":[{\"number\":1,\"frames\":%ld,", frames + thumbs);
+    HOST_CHECK(strstr(body, expect) != NULL);
+
+    // the clip holds player frames, one per interval at least, in order, thumbnails of 1/8 after some
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+                                                           "recorder");
+    clip_info_t clip;
+    HOST_CHECK(ClipScan(part, &clip, 1) == 1 && ClipVerify(part, &clip) == ESP_OK);
+    const uint32_t count = clip.header.frame_count;
+    clip_entry_t *entries = malloc(count * sizeof(clip_entry_t));
+    uint8_t *jpg = malloc(512 * 1024);
+    HOST_CHECK(ClipReadEntries(part, &clip, 0, entries, count) == ESP_OK);
+    uint32_t last_id = 0;
+    long seen_frames = 0, seen_thumbs = 0;
+    int64_t last_us = 0, frame_us = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        HOST_CHECK(entries[i].len <= 512 * 1024 && ClipReadFrame(part, &clip, &entries[i], jpg) == ESP_OK);
+        if (entries[i].flags & CLIP_ENTRY_THUMB) {
+            esp_jpeg_image_cfg_t cfg = { .indata = jpg, .indata_size = entries[i].len };
+            esp_jpeg_image_output_t img;
+            HOST_CHECK(esp_jpeg_get_image_info(&cfg, &img) == ESP_OK && img.width == 160 && img.height == 90);
+            HOST_CHECK(seen_thumbs == 0 || entries[i].time_us - last_us >= config.thumb_interval_ms * 1000LL);
+            last_us = entries[i].time_us;
+            seen_thumbs++;
+            continue;
+        }
+        const uint32_t id = StreamSimFrameId(jpg, entries[i].len);
+        HOST_CHECK(id > last_id);
+        HOST_CHECK(seen_frames == 0 || entries[i].time_us - frame_us >= config.interval_ms * 750);
+        frame_us = entries[i].time_us;
+        last_id = id;
+        seen_frames++;
+    }
+    HOST_CHECK(seen_frames == frames && seen_thumbs == thumbs);
+    printf("on the stack: %ld self-captured frames over %.1f s in clip 1 (%u kB), %ld of them with a thumbnail\n",
+           frames, (clip.header.last_us - clip.header.first_us) / 1e6, (unsigned)(clip.header.data_size / 1024),
+           thumbs);
+    CheckClipRoutes(part, &clip, entries, jpg);
+    CheckOverwrittenClip(part, &clip, jpg);
+    free(entries);
+    free(jpg);
+
+    HOST_CHECK(Request("GET", "/recorder/trigger", body, sizeof(body)) != 202);
+    StreamSimStop();
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    CheckRing();
+    CheckOnStack();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
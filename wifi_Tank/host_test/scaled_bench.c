@@ -0,0 +1,79 @@
+/*! \file scaled_bench.c
+\brief Thumbnail cost: full fmt2rgb888 conversion followed by a box resize,
+against fmt2scaled doing both in one pass.
+
+Usage: scaled_bench [frames]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "host_util.h"
+
+#define W 1280
+#define H 720
+
+// Box resize of an RGB888 buffer, the second step of the two pass path
+static void ResizeRgb888(const uint8_t *src, int w, int h, uint8_t *dst, int ow, int oh)
+{
+    for (int oy = 0; oy < oh; oy++) {
+        const int y0 = oy * h / oh, y1 = (oy + 1) * h / oh;
+        for (int ox = 0; ox < ow; ox++) {
+            const int x0 = ox * w / ow, x1 = (ox + 1) * w / ow;
+            uint32_t s0 = 0, s1 = 0, s2 = 0, n = (x1 - x0) * (y1 - y0);
+            for (int y = y0; y < y1; y++) {
+                const uint8_t *p = src + (y * w + x0) * 3;
+                for (int x = x0; x < x1; x++, p += 3) {
+                    s0 += p[0]; s1 += p[1]; s2 += p[2];
+                }
+            }
+            *dst++ = (s0 + n / 2) / n;
+            *dst++ = (s1 + n / 2) / n;
+            *dst++ = (s2 + n / 2) / n;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int frames = argc > 1 ? atoi(argv[1]) : 20;
+    uint8_t *src = malloc(W * H * 2), *full = malloc(W * H * 3), *thumb = malloc(W * H * 3);
+    for (int i = 0; i < W * H * 2; i++) {
+        src[i] = (i * 37) ^ (i >> 9);
+    }
+
+    const struct {
+        const char *name;
+        pixformat_t format;
+        int ow, oh;
+    } cases[] = {
+        { "YUV422 1/2", PIXFORMAT_YUV422, W / 2, H / 2 },
+        { "YUV422 1/4", PIXFORMAT_YUV422, W / 4, H / 4 },
+        { "YUV422 1/8", PIXFORMAT_YUV422, W / 8, H / 8 },
+        { "YUV422 QVGA box", PIXFORMAT_YUV422, 320, 240 },
+        { "RGB565 1/2", PIXFORMAT_RGB565, W / 2, H / 2 },
+        { "RGB565 1/4", PIXFORMAT_RGB565, W / 4, H / 4 },
+        { "RGB565 QVGA box", PIXFORMAT_RGB565, 320, 240 },
+    };
+
+    printf("%dx%d source, %d frames, ms per frame\n", W, H, frames);
+    printf("%-18s %10s %10s %8s\n", "case", "two pass", "fused", "speedup");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        int64_t t0 = HostTimeUs();
+        for (int f = 0; f < frames; f++) {
+            fmt2rgb888(src, W * H * 2, cases[i].format, full);
+            ResizeRgb888(full, W, H, thumb, cases[i].ow, cases[i].oh);
+        }
+        int64_t t1 = HostTimeUs();
+        for (int f = 0; f < frames; f++) {
+            fmt2scaled(src, W * H * 2, W, H, cases[i].format, cases[i].ow, cases[i].oh, PIXFORMAT_RGB888, thumb);
+        }
+        int64_t t2 = HostTimeUs();
+        const double two = (t1 - t0) / 1000.0 / frames, fused = (t2 - t1) / 1000.0 / frames;
+        printf("%-18s %10.3f %10.3f %7.2fx\n", cases[i].name, two, fused, fused > 0 ? two / fused : 0);
+    }
+    free(src);
+    free(full);
+    free(thumb);
+    return 0;
+}
@@ -0,0 +1,184 @@
+/*! \file scaled_test.c
+\brief Fused downscale-on-convert (fmt2scaled) against a straightforward
+per-pixel box filter, plus golden checksums of the scaled test image.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "pixconv.h"
+#include "yuv.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define W 160
+#define H 120
+
+static uint8_t src_yuv[W * H * 2];
+static uint8_t src_565[W * H * 2];
+static uint8_t src_rgb[W * H * 3];
+
+static uint32_t Crc32(const uint8_t *p, size_t len)
+{
+    uint32_t crc = 0xffffffff;
+    while (len--) {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+// BT.601 full range, matches the yuv_table the converters use
+static void MakeSources(void)
+{
+    for (int i = 0; i < W * H; i++) {
+        src_rgb[i * 3 + 0] = jpeg_no_huffman_rgb888[i] & 0xff;
+        src_rgb[i * 3 + 1] = (jpeg_no_huffman_rgb888[i] >> 8) & 0xff;
+        src_rgb[i * 3 + 2] = (jpeg_no_huffman_rgb888[i] >> 16) & 0xff;
+    }
+    pixconv_rgb888_to_rgb565(src_rgb, src_565, W * H);
+    for (int i = 0; i < W * H; i += 2) {
+        int y[2], u = 0, v = 0;
+        for (int k = 0; k < 2; k++) {
+            const uint8_t *p = src_rgb + (i + k) * 3;
+            y[k] = (77 * p[0] + 150 * p[1] + 29 * p[2] + 128) >> 8;
+            u += ((-43 * p[0] - 85 * p[1] + 128 * p[2] + 128) >> 8) + 128;
+            v += ((128 * p[0] - 107 * p[1] - 21 * p[2] + 128) >> 8) + 128;
+        }
+        src_yuv[i * 2 + 0] = y[0];
+        src_yuv[i * 2 + 1] = u / 2;
+        src_yuv[i * 2 + 2] = y[1];
+        src_yuv[i * 2 + 3] = v / 2;
+    }
+}
+
+// Reference: average every channel of the box, then convert the one pixel
+static void RefScale(const uint8_t *src, int yuv, int ow, int oh, pixformat_t out_format, uint8_t *out)
+{
+    for (int oy = 0; oy < oh; oy++) {
+        for (int ox = 0; ox < ow; ox++) {
+            int x0 = ox * W / ow, x1 = (ox + 1) * W / ow, y0 = oy * H / oh, y1 = (oy + 1) * H / oh;
+            uint32_t s[3] = { 0 }, n = 0;
+            for (int y = y0; y < y1; y++) {
+                for (int x = x0; x < x1; x++, n++) {
+                    const uint8_t *p = src + (y * W + x) * 2;
+                    if (yuv) {
+                        const uint8_t *q = src + (y * W + (x & ~1)) * 2;
+                        s[0] += p[0]; s[1] += q[1]; s[2] += q[3];
+                    } else {
+                        s[0] += p[0] & 0xF8;
+                        s[1] += (p[0] & 0x07) << 5 | (p[1] & 0xE0) >> 3;
+                        s[2] += (p[1] & 0x1F) << 3;
+                    }
+                }
+            }
+            uint8_t c[3], r, g, b;
+            for (int k = 0; k < 3; k++) {
+                c[k] = (s[k] + n / 2) / n;
+            }
+            if (yuv && out_format == PIXFORMAT_GRAYSCALE) {
+                *out++ = c[0];
+                continue;
+            }
+            if (yuv) {
+                yuv2rgb(c[0], c[1], c[2], &r, &g, &b);
+            } else {
+                r = c[0]; g = c[1]; b = c[2];
+            }
+            if (out_format == PIXFORMAT_RGB888) {
+                *out++ = b; *out++ = g; *out++ = r;
+            } else if (out_format == PIXFORMAT_RGB565) {
+                *out++ = (r & 0xF8) | (g >> 5);
+                *out++ = ((g & 0x1C) << 3) | (b >> 3);
+            } else {
+                *out++ = (r * 77 + g * 150 + b * 29 + 128) >> 8;
+            }
+        }
+    }
+}
+
+typedef struct {
+    pixformat_t format;
+    int ow, oh;
+    pixformat_t out_format;
+    uint32_t golden_crc;
+} scale_case_t;
+
+int main(int argc, char **argv)
+{
+    const int print_crc = argc > 1 && !strcmp(argv[1], "--print-crc");
+    MakeSources();
+
+    // Golden CRC32 of each output, regenerate with --print-crc after an intended change
+    const scale_case_t cases[] = {
+        { PIXFORMAT_YUV422, W / 2, H / 2, PIXFORMAT_RGB888,    0x2b495414 },
+        { PIXFORMAT_YUV422, W / 4, H / 4, PIXFORMAT_RGB888,    0xc506055f },
+        { PIXFORMAT_YUV422, W / 8, H / 8, PIXFORMAT_RGB888,    0x0902c1be },
+        { PIXFORMAT_YUV422, 53, 37,       PIXFORMAT_RGB888,    0x03173435 },
+        { PIXFORMAT_YUV422, W / 2, H / 2, PIXFORMAT_RGB565,    0xade3d549 },
+        { PIXFORMAT_YUV422, W / 4, H / 4, PIXFORMAT_GRAYSCALE, 0x7abe4e23 },
+        { PIXFORMAT_YUV422, W, H,         PIXFORMAT_RGB888,    0x124b0982 },
+        { PIXFORMAT_RGB565, W / 2, H / 2, PIXFORMAT_RGB888,    0x54c053d4 },
+        { PIXFORMAT_RGB565, W / 4, H / 4, PIXFORMAT_RGB565,    0xc2241fa1 },
+        { PIXFORMAT_RGB565, W / 8, H / 8, PIXFORMAT_GRAYSCALE, 0x4e08b391 },
+        { PIXFORMAT_RGB565, 101, 77,      PIXFORMAT_RGB888,    0x6434d377 },
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const scale_case_t *c = &cases[i];
+        const int bpp = c->out_format == PIXFORMAT_RGB888 ? 3 : (c->out_format == PIXFORMAT_RGB565 ? 2 : 1);
+        const size_t len = c->ow * c->oh * bpp;
+        const uint8_t *src = c->format == PIXFORMAT_YUV422 ? src_yuv : src_565;
+        uint8_t *out = malloc(len), *ref = malloc(len);
+
+        HOST_CHECK(fmt2scaled(src, W * H * 2, W, H, c->format, c->ow, c->oh, c->out_format, out));
+        RefScale(src, c->format == PIXFORMAT_YUV422, c->ow, c->oh, c->out_format, ref);
+        HOST_CHECK(memcmp(out, ref, len) == 0);
+
+        const uint32_t crc = Crc32(out, len);
+        if (print_crc) {
+            printf("case %zu: 0x%08x\n", i, crc);
+        } else if (c->golden_crc) {
+            HOST_CHECK(crc == c->golden_crc);
+        }
+        free(out);
+        free(ref);
+    }
+
+    // 1:1 scale of YUV422 must equal the plain converter
+    uint8_t *full = malloc(W * H * 3), *same = malloc(W * H * 3);
+    HOST_CHECK(fmt2rgb888(src_yuv, W * H * 2, PIXFORMAT_YUV422, full));
+    HOST_CHECK(fmt2scaled(src_yuv, W * H * 2, W, H, PIXFORMAT_YUV422, W, H, PIXFORMAT_RGB888, same));
+    HOST_CHECK(memcmp(full, same, W * H * 3) == 0);
+
+    // 1/2 of YUV422 must look like the RGB source box filtered: swap to RGB order and compare PSNR
+    uint8_t *half = malloc(W / 2 * H / 2 * 3), *ref_half = malloc(W / 2 * H / 2 * 3);
+    HOST_CHECK(fmt2scaled(src_yuv, W * H * 2, W, H, PIXFORMAT_YUV422, W / 2, H / 2, PIXFORMAT_RGB888, half));
+    pixconv_swap_rb888(half, half, W / 2 * H / 2);
+    for (int y = 0; y < H / 2; y++) {
+        for (int x = 0; x < W / 2; x++) {
+            for (int k = 0; k < 3; k++) {
+                const uint8_t *p = src_rgb + ((y * 2) * W + x * 2) * 3 + k;
+                ref_half[(y * W / 2 + x) * 3 + k] = (p[0] + p[3] + p[W * 3] + p[W * 3 + 3] + 2) >> 2;
+            }
+        }
+    }
+    const double psnr = HostPsnrRgb888(ref_half, half, W / 2, H / 2, 0, 0, W / 2, H / 2, 0);
+    printf("YUV422 1/2 vs RGB box filter: %.2f dB\n", psnr);
+    HOST_CHECK(psnr > 30.0);
+
+    // Invalid arguments
+    HOST_CHECK(!fmt2scaled(src_yuv, W * H * 2, W, H, PIXFORMAT_JPEG, W / 2, H / 2, PIXFORMAT_RGB888, half));
+    HOST_CHECK(!fmt2scaled(src_yuv, W * H * 2, W, H, PIXFORMAT_YUV422, W * 2, H, PIXFORMAT_RGB888, half));
+    HOST_CHECK(!fmt2scaled(src_yuv, W * H, W, H, PIXFORMAT_YUV422, W / 2, H / 2, PIXFORMAT_RGB888, half));
+
+    free(full);
+    free(same);
+    free(half);
+    free(ref_half);
+    printf("scaled_test: %s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,282 @@
+/*! \file sccb_batch_test.c
+\brief Batched SCCB register writes (SCCB_Write16_Regs, sccb_shadow.c) with
+the OV3660 driver on the host bus model. Camera init and a series of mode
+switches run three ways: one transaction per register value as the driver
+used to write them (a replay of everything the driver asked for), batched
+without a shadow, and batched on the shadow. All three must leave the sensor
+with the same registers; the table shows what each costs on the bus.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_err.h"
+#include "sccb.h"
+#include "sccb_sim.h"
+#include "sensor_sim.h"
+#include "ov3660.h"
+#include "host_util.h"
+
+#define MODES (sizeof(modes) / sizeof(modes[0]))
+#define LOG_MAX 4096
+
+typedef struct {
+    const char *name;
+    pixformat_t format;
+    framesize_t size;
+    int quality;
+} sensor_mode_t;
+
+// The first one is camera init as esp_camera_init() does it
+static const sensor_mode_t modes[] = {
+    { "init JPEG SVGA", PIXFORMAT_JPEG, FRAMESIZE_SVGA, 12 },
+    { "RGB565 QVGA", PIXFORMAT_RGB565, FRAMESIZE_QVGA, 12 },
+    { "JPEG UXGA", PIXFORMAT_JPEG, FRAMESIZE_UXGA, 10 },
+    { "JPEG VGA", PIXFORMAT_JPEG, FRAMESIZE_VGA, 10 },
+    { "JPEG HQVGA", PIXFORMAT_JPEG, FRAMESIZE_HQVGA, 10 },
+    { "JPEG HQVGA again", PIXFORMAT_JPEG, FRAMESIZE_HQVGA, 10 },
+};
+
+typedef struct {
+    sccb_sim_stats_t stats[MODES];
+    uint8_t *regs[MODES];
+} run_t;
+
+static sensor_t sensor;
+
+// OV3660 on the bus, in power down as SYSTEM_CTROL0 has it after reset
+static void BusUp(void)
+{
+    SensorSimPowerUp(&sensor_sim_ov3660);
+    SccbSimSetDefault(0x3008, 0x02);
+    HOST_CHECK(SCCB_Init(4, 5) == ESP_OK);
+    HOST_CHECK(SCCB_Probe(OV3660_SCCB_ADDR) == 0);
+}
+
+static void BusDown(void)
+{
+    HOST_CHECK(SCCB_Deinit() == ESP_OK);
+}
+
+static void SensorUp(bool shadow)
+{
+    sensor_id_t id = { 0 };
+    HOST_CHECK(esp32_camera_ov3660_detect(OV3660_SCCB_ADDR, &id) == OV3660_PID);
+    memset(&sensor, 0, sizeof(sensor));
+    sensor.slv_addr = OV3660_SCCB_ADDR;
+    sensor.xclk_freq_hz = 20000000;
+    sensor.id = id;
+    HOST_CHECK(esp32_camera_ov3660_init(&sensor) == 0);
+    if (!shadow) {
+        SCCB_Shadow_Enable(OV3660_SCCB_ADDR, false);
+    }
+}
+
+static int SetMode(const sensor_mode_t *mode, bool init)
+{
+    if (init) {
+        sensor.status.framesize = mode->size;
+        sensor.pixformat = mode->format;
+        return sensor.reset(&sensor)
+            || sensor.set_framesize(&sensor, mode->size)
+            || sensor.set_pixformat(&sensor, mode->format)
+            || sensor.set_quality(&sensor, mode->quality)
+            || sensor.init_status(&sensor);
+    }
+    return sensor.set_pixformat(&sensor, mode->format)
+        || sensor.set_framesize(&sensor, mode->size)
+        || sensor.set_quality(&sensor, mode->quality);
+}
+
+static void RunModes(run_t *run, bool shadow, sccb_sim_access_t *logs[])
+{
+    BusUp();
+    SensorUp(shadow);
+    for (size_t i = 0; i < MODES; i++) {
+        SccbSimClearStats();
+        if (logs) {
+            SccbSimRecord(logs[i], LOG_MAX);
+        }
+        HOST_CHECK(SetMode(&modes[i], i == 0) == 0);
+        if (logs) {
+            HOST_CHECK(SccbSimRecorded() < LOG_MAX);
+            logs[i][SccbSimRecorded()].reg = 0;
+            SccbSimRecord(NULL, 0);
+        }
+        run->stats[i] = SccbSimStats();
+        memcpy(run->regs[i], SccbSimRegs(), 65536);
+    }
+    BusDown();
+}
+
+// The driver as it was: every value it asked for in its own SCCB_Write16()
+static void ReplayOld(run_t *run, sccb_sim_access_t *logs[])
+{
+    BusUp();
+    for (size_t i = 0; i < MODES; i++) {
+        SccbSimClearStats();
+        for (const sccb_sim_access_t *a = logs[i]; a->reg; a++) {
+            if (a->read) {
+                SCCB_Read16(OV3660_SCCB_ADDR, a->reg);
+            } else {
+                HOST_CHECK(SCCB_Write16(OV3660_SCCB_ADDR, a->reg, a->value) == 0);
+            }
+        }
+        run->stats[i] = SccbSimStats();
+        memcpy(run->regs[i], SccbSimRegs(), 65536);
+    }
+    BusDown();
+}
+
+static void RunNew(run_t *run)
+{
+    for (size_t i = 0; i < MODES; i++) {
+        run->regs[i] = malloc(65536);
+    }
+}
+
+static void FreeRun(run_t *run)
+{
+    for (size_t i = 0; i < MODES; i++) {
+        free(run->regs[i]);
+    }
+}
+
+static void CheckModeSwitches(void)
+{
+    run_t old, batched, shadowed;
+    sccb_sim_access_t *logs[MODES];
+    for (size_t i = 0; i < MODES; i++) {
+        logs[i] = malloc(LOG_MAX * sizeof(sccb_sim_access_t));
+    }
+    RunNew(&old);
+    RunNew(&batched);
+    RunNew(&shadowed);
+
+    RunModes(&batched, false, logs);
+    ReplayOld(&old, logs);
+    RunModes(&shadowed, true, NULL);
+
+    printf("%-18s %25s %25s %25s\n", "wire time at", "one value a write", "batched", "batched + shadow");
+    printf("%-18s %8s %6s %9s %8s %6s %9s %8s %6s %9s\n", "100 kHz",
+           "writes", "reads", "bus ms", "writes", "reads", "bus ms", "writes", "reads", "bus ms");
+    for (size_t i = 0; i < MODES; i++) {
+        const sccb_sim_stats_t *o = &old.stats[i], *b = &batched.stats[i], *s = &shadowed.stats[i];
+        printf("%-18s %8u %6u %9.2f %8u %6u %9.2f %8u %6u %9.2f\n", modes[i].name,
+               (unsigned)o->writes, (unsigned)o->reads, o->bus_us / 1000.0,
+               (unsigned)b->writes, (unsigned)b->reads, b->bus_us / 1000.0,
+               (unsigned)s->writes, (unsigned)s->reads, s->bus_us / 1000.0);
+
+        // Same sensor state every way
+        HOST_CHECK(memcmp(old.regs[i], batched.regs[i], 65536) == 0);
+        HOST_CHECK(memcmp(old.regs[i], shadowed.regs[i], 65536) == 0);
+
+        // The old driver wrote one value per transaction, batching only merges them
+        HOST_CHECK(o->writes == o->values && b->values == o->values);
+        // Reads of registers the shadow knows never reach the bus
+        HOST_CHECK(b->reads == o->reads && s->reads <= o->reads);
+        HOST_CHECK(b->writes < o->writes && s->writes <= b->writes);
+        HOST_CHECK(i == 0 || s->bus_us < o->bus_us / 2);
+    }
+    // Camera init: everything is unknown after the reset, only the runs in the tables count
+    HOST_CHECK(shadowed.stats[0].writes * 2 < old.stats[0].writes);
+    HOST_CHECK(shadowed.stats[0].bus_us * 10 < old.stats[0].bus_us * 6);
+    // Nothing changes, nothing is written
+    HOST_CHECK(shadowed.stats[MODES - 1].writes == 0);
+
+    for (size_t i = 0; i < MODES; i++) {
+        free(logs[i]);
+    }
+    FreeRun(&old);
+    FreeRun(&batched);
+    FreeRun(&shadowed);
+}
+
+// Coalescing and skipping on a plain register list
+static void CheckRuns(void)
+{
+    BusUp();
+    SCCB_Shadow_Enable(OV3660_SCCB_ADDR, true);
+    uint16_t regs[][2] = {
+        { 0x5000, 0x10 }, { 0x5001, 0x11 }, { 0x5002, 0x12 }, { 0x5003, 0x13 }, { 0x5004, 0x14 },
+        { 0x5005, 0x15 }, { 0x5006, 0x16 }, { 0x5020, 0x20 }, { 0x5021, 0x21 }, { 0x4000, 0x40 },
+    };
+    const size_t count = sizeof(regs) / sizeof(regs[0]);
+
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 3 && SccbSimStats().values == count);
+
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 0);
+
+    // Two unchanged registers in between are written again, three split the run
+    regs[0][1] = 0x90;
+    regs[3][1] = 0x93;
+    regs[6][1] = 0x96;
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 1 && SccbSimStats().values == 7);
+    regs[0][1] = 0x10;
+    regs[4][1] = 0x94;
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 2 && SccbSimStats().values == 2);
+
+    // Single writes keep the shadow up to date
+    HOST_CHECK(SCCB_Write16(OV3660_SCCB_ADDR, 0x5021, 0x55) == 0);
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 1 && SccbSimStats().values == 1);
+
+    // A failed run is unknown afterwards and written again
+    regs[1][1] = 0x81;
+    SccbSimFailNextWrite();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) != 0);
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 1 && SccbSimStats().values == 1);
+    for (size_t i = 0; i < count; i++) {
+        HOST_CHECK(SccbSimRegs()[regs[i][0]] == regs[i][1]);
+    }
+
+    // Invalidated: everything goes out again
+    SCCB_Shadow_Invalidate(OV3660_SCCB_ADDR);
+    SccbSimClearStats();
+    HOST_CHECK(SCCB_Write16_Regs(OV3660_SCCB_ADDR, regs, count) == 0);
+    HOST_CHECK(SccbSimStats().writes == 3 && SccbSimStats().values == count);
+    BusDown();
+}
+
+// A mode switch that fails half way, then succeeds, leaves the same registers as one that never failed
+static void CheckFailedSwitch(void)
+{
+    uint8_t *want = malloc(65536);
+    BusUp();
+    SensorUp(true);
+    HOST_CHECK(SetMode(&modes[0], true) == 0);
+    HOST_CHECK(SetMode(&modes[2], false) == 0);
+    memcpy(want, SccbSimRegs(), 65536);
+    BusDown();
+
+    BusUp();
+    SensorUp(true);
+    HOST_CHECK(SetMode(&modes[0], true) == 0);
+    // set_pixformat goes through, the set_framesize batch fails
+    HOST_CHECK(sensor.set_pixformat(&sensor, modes[2].format) == 0);
+    SccbSimFailNextWrite();
+    HOST_CHECK(sensor.set_framesize(&sensor, modes[2].size) != 0);
+    HOST_CHECK(SetMode(&modes[2], false) == 0);
+    HOST_CHECK(memcmp(want, SccbSimRegs(), 65536) == 0);
+    BusDown();
+    free(want);
+}
+
+int main(void)
+{
+    CheckRuns();
+    CheckModeSwitches();
+    CheckFailedSwitch();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,190 @@
+/*! \file sccb_shadow_test.c
+\brief Register shadow reads (SCCB_Read through sccb_shadow.c) with the
+OV3660 and OV2640 drivers on the host bus model. Camera init followed by the
+setter sequence of main/stream.c runs once with the shadow switched off, as
+the drivers used to talk to the sensor, and once with it on: the sensor must
+end up with the same registers, and the table shows the reads and writes
+each costs. Registers the sensor changes by itself must still come from the
+bus, everything else from RAM.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_err.h"
+#include "sccb.h"
+#include "sccb_sim.h"
+#include "sensor_sim.h"
+#include "ov2640.h"
+#include "ov3660.h"
+#include "host_util.h"
+
+typedef struct {
+    const sensor_sim_t *sim;
+    uint16_t volatile_reg;  // updated by the AEC loop, bank << 8 | reg as get_reg() takes it
+    uint16_t quality_reg;   // written by set_quality(), never changes by itself
+    framesize_t size;
+    int (*detect)(int slv_addr, sensor_id_t *id);
+    int (*init)(sensor_t *sensor);
+} sensor_def_t;
+
+static const sensor_def_t sensors[] = {
+    { &sensor_sim_ov3660, 0x3500, 0x4407, FRAMESIZE_HD, esp32_camera_ov3660_detect, esp32_camera_ov3660_init },
+    { &sensor_sim_ov2640, 0x110, 0x044, FRAMESIZE_HD, esp32_camera_ov2640_detect, esp32_camera_ov2640_init },
+};
+
+typedef struct {
+    sccb_sim_stats_t init;
+    sccb_sim_stats_t setters;
+    sccb_sim_stats_t masked;    // one read-modify-write setter
+    sccb_sim_stats_t get;       // get_reg() of a register the driver wrote
+    uint8_t *regs;
+} run_t;
+
+static sensor_t sensor;
+
+static void BusUp(const sensor_def_t *def)
+{
+    SensorSimPowerUp(def->sim);
+    HOST_CHECK(SCCB_Init(4, 5) == ESP_OK);
+    HOST_CHECK(SCCB_Probe(def->sim->slv_addr) == 0);
+}
+
+static void BusDown(void)
+{
+    HOST_CHECK(SCCB_Deinit() == ESP_OK);
+}
+
+static void SensorUp(const sensor_def_t *def, bool shadow)
+{
+    sensor_id_t id = { 0 };
+    HOST_CHECK(def->detect(def->sim->slv_addr, &id) == def->sim->pid);
+    memset(&sensor, 0, sizeof(sensor));
+    sensor.slv_addr = def->sim->slv_addr;
+    sensor.xclk_freq_hz = 20000000;
+    sensor.id = id;
+    HOST_CHECK(def->init(&sensor) == 0);
+    if (!shadow) {
+        SCCB_Shadow_Enable(def->sim->slv_addr, false);
+    }
+}
+
+// The sensor part of esp_camera_init() with the configuration of main/stream.c
+static int CameraInit(const sensor_def_t *def)
+{
+    sensor.status.framesize = def->size;
+    sensor.pixformat = PIXFORMAT_JPEG;
+    return sensor.reset(&sensor)
+        || sensor.set_framesize(&sensor, def->size)
+        || sensor.set_pixformat(&sensor, PIXFORMAT_JPEG)
+        || sensor.set_quality(&sensor, 12)
+        || sensor.init_status(&sensor);
+}
+
+// camera_init() in main/stream.c
+static void StreamSetters(void)
+{
+    sensor_t *s = &sensor;
+    s->set_brightness(s, 0);     // -2 to 2
+    s->set_contrast(s, 0);       // -2 to 2
+    s->set_saturation(s, 0);     // -2 to 2
+    s->set_special_effect(s, 0); // 0 to 6 (0 - No Effect, 1 - Negative, 2 - Grayscale, etc.)
+    s->set_whitebal(s, 1);       // 0 = disable , 1 = enable
+    s->set_awb_gain(s, 1);       // 0 = disable , 1 = enable
+    s->set_wb_mode(s, 0);        // 0 to 4 - if awb_gain enabled (0 - Auto, 1 - Sunny, 2 - Cloudy, 3 - Office, 4 - Home)
+    s->set_exposure_ctrl(s, 1);  // 0 = disable , 1 = enable
+    s->set_aec2(s, 0);           // 0 = disable , 1 = enable
+    s->set_ae_level(s, 0);       // -2 to 2
+    s->set_aec_value(s, 300);    // 0 to 1200
+    s->set_gain_ctrl(s, 1);      // 0 = disable , 1 = enable
+    s->set_agc_gain(s, 0);       // 0 to 30
+    s->set_gainceiling(s, (gainceiling_t)0);  // 0 to 6
+    s->set_bpc(s, 0);            // 0 = disable , 1 = enable
+    s->set_wpc(s, 1);            // 0 = disable , 1 = enable
+    s->set_raw_gma(s, 1);        // 0 = disable , 1 = enable
+    s->set_lenc(s, 1);           // 0 = disable , 1 = enable
+    s->set_hmirror(s, 0);        // 0 = disable , 1 = enable
+    s->set_vflip(s, 0);          // 0 = disable , 1 = enable
+    s->set_dcw(s, 1);            // 0 = disable , 1 = enable
+    s->set_colorbar(s, 0);       // 0 = disable , 1 = enable
+}
+
+static void Run(const sensor_def_t *def, bool shadow, run_t *run)
+{
+    BusUp(def);
+    SensorUp(def, shadow);
+
+    SccbSimClearStats();
+    HOST_CHECK(CameraInit(def) == 0);
+    run->init = SccbSimStats();
+
+    SccbSimClearStats();
+    StreamSetters();
+    run->setters = SccbSimStats();
+    run->regs = malloc(65536);
+    memcpy(run->regs, SccbSimRegs(), 65536);
+
+    SccbSimClearStats();
+    HOST_CHECK(sensor.set_colorbar(&sensor, 1) == 0);
+    run->masked = SccbSimStats();
+    HOST_CHECK(sensor.set_colorbar(&sensor, 0) == 0);
+
+    SccbSimClearStats();
+    HOST_CHECK(sensor.get_reg(&sensor, def->quality_reg, 0xff) == 12);
+    run->get = SccbSimStats();
+
+    // The AEC loop moved the exposure: get_reg() must see it either way
+    const uint8_t exposure = SccbSimRegs()[def->volatile_reg] ^ 0x5a;
+    SccbSimPoke(def->volatile_reg, exposure);
+    HOST_CHECK(sensor.get_reg(&sensor, def->volatile_reg, 0xff) == exposure);
+
+    BusDown();
+}
+
+static void PrintRow(const char *step, const char *shadow, sccb_sim_stats_t s)
+{
+    printf("%-8s %-6s %6u %6u %8.2f\n", step, shadow, (unsigned)s.reads, (unsigned)s.writes, s.bus_us / 1000.0);
+}
+
+static void CheckSensor(const sensor_def_t *def)
+{
+    run_t before, after;
+    Run(def, false, &before);
+    Run(def, true, &after);
+    HOST_CHECK(memcmp(before.regs, after.regs, 65536) == 0);
+
+    printf("%-8s %-6s %6s %6s %8s\n", def->sim->name, "shadow", "reads", "writes", "bus ms");
+    const struct {
+        const char *step;
+        sccb_sim_stats_t before, after;
+    } rows[] = {
+        { "init", before.init, after.init },
+        { "setters", before.setters, after.setters },
+        { "masked", before.masked, after.masked },
+        { "get_reg", before.get, after.get },
+    };
+    for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++) {
+        PrintRow(rows[i].step, "off", rows[i].before);
+        PrintRow("", "on", rows[i].after);
+    }
+
+    // Everything the setters read back was written before, or is volatile
+    HOST_CHECK(after.setters.reads * 3 <= before.setters.reads);
+    HOST_CHECK(after.setters.writes <= before.setters.writes);
+    HOST_CHECK(after.init.reads < before.init.reads);
+    HOST_CHECK(after.setters.bus_us < before.setters.bus_us);
+    // A masked update is a single write, a known register costs no transaction
+    HOST_CHECK(before.masked.reads == 1 && after.masked.reads == 0 && after.masked.writes == 1);
+    HOST_CHECK(before.get.reads == 1 && after.get.reads == 0 && after.get.writes == 0);
+
+    free(before.regs);
+    free(after.regs);
+}
+
+int main(void)
+{
+    for (size_t i = 0; i < sizeof(sensors) / sizeof(sensors[0]); i++) {
+        CheckSensor(&sensors[i]);
+    }
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
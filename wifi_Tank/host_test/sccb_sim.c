@@ -0,0 +1,259 @@
+/*! \file sccb_sim.c
+\brief Host model of the SCCB bus, see sccb_sim.h.
+*****/
+#include <string.h>
+#include "driver/i2c_master.h"
+#include "sdkconfig.h"
+#include "sccb_sim.h"
+
+struct host_i2c_bus {
+    int port;
+};
+
+struct host_i2c_dev {
+    uint16_t address;
+};
+
+static struct host_i2c_bus bus;
+static bool bus_up;
+static struct host_i2c_dev devs[4];
+
+static uint8_t sensor_addr;
+static bool sensor_addr16;
+static uint8_t regs[65536];
+static uint8_t defaults[65536];
+static int bank_reg;
+static uint8_t bank;
+static uint16_t reset_reg;
+static int port_addr = -1;      // indirect register port, banked addresses
+static int port_data = -1;
+static uint8_t indirect[256];
+static uint8_t reset_mask;
+static bool fail_next;
+static sccb_sim_access_t *record;
+static size_t record_max;
+static size_t recorded;
+static sccb_sim_stats_t stats;
+
+void SccbSimInit(uint8_t slv_addr, bool addr16)
+{
+    sensor_addr = slv_addr;
+    sensor_addr16 = addr16;
+    memset(defaults, 0, sizeof(defaults));
+    memset(regs, 0, sizeof(regs));
+    bank_reg = -1;
+    bank = 0;
+    reset_mask = 0;
+    port_addr = port_data = -1;
+    memset(indirect, 0, sizeof(indirect));
+    fail_next = false;
+    SccbSimRecord(NULL, 0);
+    SccbSimClearStats();
+}
+
+void SccbSimSetBankReg(uint8_t reg)
+{
+    bank_reg = reg;
+}
+
+void SccbSimSetDefault(uint16_t reg, uint8_t value)
+{
+    defaults[reg] = value;
+    regs[reg] = value;
+}
+
+void SccbSimSetResetReg(uint16_t reg, uint8_t mask)
+{
+    reset_reg = reg;
+    reset_mask = mask;
+}
+
+void SccbSimPoke(uint16_t reg, uint8_t value)
+{
+    regs[reg] = value;
+}
+
+const uint8_t *SccbSimRegs(void)
+{
+    return regs;
+}
+
+void SccbSimSetDataPort(uint16_t addr_reg, uint16_t data_reg)
+{
+    port_addr = addr_reg;
+    port_data = data_reg;
+}
+
+const uint8_t *SccbSimIndirect(void)
+{
+    return indirect;
+}
+
+void SccbSimFailNextWrite(void)
+{
+    fail_next = true;
+}
+
+void SccbSimRecord(sccb_sim_access_t *log, size_t max)
+{
+    record = log;
+    record_max = log ? max : 0;
+    recorded = 0;
+}
+
+size_t SccbSimRecorded(void)
+{
+    return recorded;
+}
+
+static void Record(uint16_t reg, uint8_t value, bool read)
+{
+    if (recorded < record_max) {
+        record[recorded++] = (sccb_sim_access_t) { reg, value, read };
+    }
+}
+
+sccb_sim_stats_t SccbSimStats(void)
+{
+    return stats;
+}
+
+void SccbSimClearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+// Start, the bytes with their ACK bit and stop: 9 clocks a byte plus one each for start and stop
+static void BusTime(size_t bytes, size_t conditions)
+{
+    stats.bytes += bytes;
+    stats.bus_us += ((uint64_t)bytes * 9 + conditions) * 1000000 / CONFIG_SCCB_CLK_FREQ;
+}
+
+static bool Fail(void)
+{
+    const bool fail = fail_next;
+    fail_next = false;
+    return fail;
+}
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *bus_config, i2c_master_bus_handle_t *ret_bus_handle)
+{
+    if (bus_up) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    bus.port = bus_config->i2c_port;
+    bus_up = true;
+    *ret_bus_handle = &bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus_handle)
+{
+    bus_up = false;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_get_bus_handle(i2c_port_num_t port_num, i2c_master_bus_handle_t *ret_handle)
+{
+    if (!bus_up || port_num != bus.port) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *ret_handle = &bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus_handle, const i2c_device_config_t *dev_config,
+                                    i2c_master_dev_handle_t *ret_handle)
+{
+    for (size_t i = 0; i < sizeof(devs) / sizeof(devs[0]); i++) {
+        if (!devs[i].address) {
+            devs[i].address = dev_config->device_address;
+            *ret_handle = &devs[i];
+            return ESP_OK;
+        }
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t handle)
+{
+    handle->address = 0;
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_probe(i2c_master_bus_handle_t bus_handle, uint16_t address, int xfer_timeout_ms)
+{
+    BusTime(1, 2);
+    return address == sensor_addr ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+// Register address at the start of a write, the number of bytes it took
+static size_t RegAddr(const uint8_t *buf, size_t size, uint16_t *reg)
+{
+    if (sensor_addr16) {
+        if (size < 2) {
+            return 0;
+        }
+        *reg = buf[0] << 8 | buf[1];
+        return 2;
+    }
+    if (size < 1) {
+        return 0;
+    }
+    *reg = buf[0];
+    return 1;
+}
+
+static uint16_t Banked(uint16_t reg)
+{
+    return bank_reg >= 0 ? bank << 8 | reg : reg;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size,
+                              int xfer_timeout_ms)
+{
+    BusTime(1 + write_size, 2);
+    uint16_t reg;
+    const size_t n = RegAddr(write_buffer, write_size, &reg);
+    if (i2c_dev->address != sensor_addr || !n || Fail()) {
+        return ESP_FAIL;
+    }
+    stats.writes++;
+    for (size_t i = n; i < write_size; i++, reg++) {
+        stats.values++;
+        Record(reg, write_buffer[i], false);
+        if (reg == bank_reg) {
+            bank = write_buffer[i];
+            continue;
+        }
+        const uint16_t addr = Banked(reg);
+        regs[addr] = write_buffer[i];
+        if (addr == port_data) {
+            indirect[regs[port_addr]++] = write_buffer[i];
+        }
+        if (reset_mask && addr == reset_reg && (write_buffer[i] & reset_mask)) {
+            memcpy(regs, defaults, sizeof(regs));
+            memset(indirect, 0, sizeof(indirect));
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size,
+                                      uint8_t *read_buffer, size_t read_size, int xfer_timeout_ms)
+{
+    // Repeated start between the register address and the read
+    BusTime(1 + write_size + 1 + read_size, 3);
+    uint16_t reg;
+    const size_t n = RegAddr(write_buffer, write_size, &reg);
+    if (i2c_dev->address != sensor_addr || n != write_size) {
+        return ESP_FAIL;
+    }
+    stats.reads++;
+    for (size_t i = 0; i < read_size; i++, reg++) {
+        read_buffer[i] = reg == bank_reg ? bank : regs[Banked(reg)];
+        Record(reg, read_buffer[i], true);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,101 @@
+/*! \file sccb_sim.h
+\brief Host model of the SCCB bus for the sensor drivers. sccb_sim.c
+implements the ESP-IDF I2C master driver with one sensor on the bus: a
+register file with 8 or 16 bit addresses that auto increments across
+multi-byte writes, optionally banked behind a bank select register, a soft
+reset bit that restores the power-on values, and counters for every
+transaction and the bus time it takes on the wire.
+*****/
+#ifndef SCCB_SIM_H
+#define SCCB_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t writes;        // write transactions
+    uint32_t reads;         // register reads, a write of the address and a read
+    uint32_t values;        // register values written
+    uint32_t bytes;         // bytes on the wire, slave addresses included
+    uint64_t bus_us;        // wire time at CONFIG_SCCB_CLK_FREQ, start and stop included
+} sccb_sim_stats_t;
+
+typedef struct {
+    uint16_t reg;
+    uint8_t value;
+    bool read;
+} sccb_sim_access_t;
+
+/**
+ * @brief Put a sensor on the bus, all registers at their power-on value
+ * @param slv_addr 7 bit slave address
+ * @param addr16 16 bit register addresses
+ */
+void SccbSimInit(uint8_t slv_addr, bool addr16);
+
+/**
+ * @brief 8 bit address sensors: writing reg selects the bank, registers live at bank << 8 | reg
+ */
+void SccbSimSetBankReg(uint8_t reg);
+
+/**
+ * @brief Set a power-on value, e.g. the chip ID. Banked registers at bank << 8 | reg.
+ */
+void SccbSimSetDefault(uint16_t reg, uint8_t value);
+
+/**
+ * @brief Writing a value with mask set to reg restores every power-on value
+ */
+void SccbSimSetResetReg(uint16_t reg, uint8_t mask);
+
+/**
+ * @brief Change a register behind the driver's back, as the sensor's own control loops do
+ */
+void SccbSimPoke(uint16_t reg, uint8_t value);
+
+/**
+ * @brief The register file, 65536 entries, banked registers at bank << 8 | reg
+ */
+const uint8_t *SccbSimRegs(void);
+
+/**
+ * @brief Registers written through an address and a data register, the address
+ *        increments with every data write. Banked addresses as for SccbSimSetDefault().
+ */
+void SccbSimSetDataPort(uint16_t addr_reg, uint16_t data_reg);
+
+/**
+ * @brief The 256 registers behind the data port
+ */
+const uint8_t *SccbSimIndirect(void);
+
+/**
+ * @brief NACK the next write transaction
+ */
+void SccbSimFailNextWrite(void);
+
+/**
+ * @brief Log every register read and written value, one entry each, in bus order
+ * @param log Where to log, NULL stops logging
+ * @param max Entries in log, the rest is not logged
+ */
+void SccbSimRecord(sccb_sim_access_t *log, size_t max);
+
+/**
+ * @brief Entries logged since SccbSimRecord()
+ */
+size_t SccbSimRecorded(void);
+
+sccb_sim_stats_t SccbSimStats(void);
+void SccbSimClearStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,55 @@
+/*! \file sensor_sim.c
+\brief The sensors of the host tests, see sensor_sim.h.
+*****/
+#include "sensor_sim.h"
+#include "sccb_sim.h"
+#include "ov2640.h"
+#include "ov3660.h"
+
+const sensor_sim_t sensor_sim_ov3660 = { "OV3660", OV3660_SCCB_ADDR, true, -1, 0x300a, OV3660_PID, 0x3008, 0x80, -1, -1 };
+const sensor_sim_t sensor_sim_ov2640 = { "OV2640", OV2640_SCCB_ADDR, false, 0xff, 0x10a, OV2640_PID, 0x112, 0x80,
+                                         0x07c, 0x07d };
+
+esp_err_t xclk_timer_conf(int ledc_timer, int xclk_freq_hz)
+{
+    return ESP_OK;
+}
+
+void SensorSimPowerUp(const sensor_sim_t *def)
+{
+    SccbSimInit(def->slv_addr, def->addr16);
+    if (def->bank_reg >= 0) {
+        SccbSimSetBankReg(def->bank_reg);
+    }
+    if (def->addr16) {
+        SccbSimSetDefault(def->pid_reg, def->pid >> 8);
+        SccbSimSetDefault(def->pid_reg + 1, def->pid & 0xff);
+    } else {
+        SccbSimSetDefault(def->pid_reg, def->pid);
+    }
+    SccbSimSetResetReg(def->reset_reg, def->reset_mask);
+    if (def->port_addr >= 0) {
+        SccbSimSetDataPort(def->port_addr, def->port_data);
+    }
+}
+
+camera_config_t SensorSimStreamConfig(void)
+{
+    const camera_config_t config = {
+        .pin_pwdn = 32,
+        .pin_reset = -1,
+        .pin_xclk = 0,
+        .pin_sccb_sda = 26,
+        .pin_sccb_scl = 27,
+        .xclk_freq_hz = 20000000,
+        .ledc_timer = LEDC_TIMER_0,
+        .ledc_channel = LEDC_CHANNEL_0,
+        .pixel_format = PIXFORMAT_JPEG,
+        .frame_size = FRAMESIZE_HD,
+        .jpeg_quality = 12,
+        .fb_count = 3,
+        .fb_location = CAMERA_FB_IN_DRAM,
+        .grab_mode = CAMERA_GRAB_WHEN_EMPTY,
+    };
+    return config;
+}
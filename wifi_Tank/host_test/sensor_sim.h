@@ -0,0 +1,49 @@
+/*! \file sensor_sim.h
+\brief The sensors the host tests put on the bus model (sccb_sim.h): what an
+OV3660 and an OV2640 answer at power-up, and the camera configuration
+main/stream.c starts them with. sensor_sim.c also stands in for the XCLK
+timer of the camera driver.
+*****/
+#ifndef SENSOR_SIM_H
+#define SENSOR_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_camera.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char *name;
+    uint8_t slv_addr;
+    bool addr16;
+    int bank_reg;           // -1 without banks
+    uint16_t pid_reg;       // bank << 8 | reg
+    uint16_t pid;
+    uint16_t reset_reg;
+    uint8_t reset_mask;
+    int port_addr;          // indirect register port, -1 without
+    int port_data;
+} sensor_sim_t;
+
+extern const sensor_sim_t sensor_sim_ov3660;
+extern const sensor_sim_t sensor_sim_ov2640;
+
+/**
+ * @brief Put a sensor straight out of power down on the bus: chip ID, soft reset bit and register port
+ * @param def The sensor
+ */
+void SensorSimPowerUp(const sensor_sim_t *def);
+
+/**
+ * @brief The camera configuration of camera_init() in main/stream.c, with the pins of the AI-Thinker board
+ */
+camera_config_t SensorSimStreamConfig(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,146 @@
+/*! \file server_bench.c
+\brief Request latency of main/server.c while 0 to 4 clients watch /stream,
+on the host streaming stack (stream_sim.c, synthetic HD frames). Each round
+sends GET /stats, GET /metrics and a revalidating GET / one after another
+and times them from connect to the last byte; it also prints the stack the
+firmware's tasks asked for, the sender task of each stream included.
+
+    server_bench [requests per round] [max streams] [fps]
+
+The port is 18088 or STREAM_SIM_PORT.
+*****/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "stream.h"
+#include "web_assets.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18088
+#define TIMEOUT_MS 5000
+#define MAX_STREAMS 4
+#define MAX_PART (512 * 1024)
+
+typedef struct {
+    stream_client_t c;
+    volatile bool stop;
+    volatile uint32_t parts;
+} viewer_t;
+
+static uint16_t port;
+
+static void *Viewer(void *arg)
+{
+    viewer_t *v = arg;
+    uint8_t *part = malloc(MAX_PART);
+    char headers[256];
+    while (!v->stop && StreamClientPart(&v->c, headers, sizeof(headers), part, MAX_PART)) {
+        v->parts++;
+    }
+    free(part);
+    return NULL;
+}
+
+static int CompareUs(const void *a, const void *b)
+{
+    const int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// One request, connect to the last byte, -1 if it failed
+static int64_t Request(int i)
+{
+    char headers[128] = "";
+    const char *path = i % 3 == 0 ? "/stats" : i % 3 == 1 ? "/metrics" : "/";
+    if (i % 3 == 2) {
+        snprintf(headers, sizeof(headers), "If-None-Match: %s\r\n", web_assets[0].etag);
+    }
+    const int64_t start = esp_timer_get_time();
+    stream_client_t c;
+    uint8_t buf[2048];
+    bool ok = StreamClientGetHeaders(&c, port, path, headers, TIMEOUT_MS) && (c.status == 200 || c.status == 304);
+    while (ok && StreamClientRead(&c, buf, sizeof(buf)) == sizeof(buf)) {
+    }
+    const int64_t us = esp_timer_get_time() - start;
+    StreamClientClose(&c);
+    return ok ? us : -1;
+}
+
+static void Round(int streams, int requests)
+{
+    static viewer_t viewers[MAX_STREAMS];
+    pthread_t threads[MAX_STREAMS];
+    for (int i = 0; i < streams; i++) {
+        memset(&viewers[i], 0, sizeof(viewers[i]));
+        HOST_CHECK(StreamClientGet(&viewers[i].c, port, "/stream", TIMEOUT_MS) && viewers[i].c.status == 200);
+        pthread_create(&threads[i], NULL, Viewer, &viewers[i]);
+    }
+    for (int i = 0; i < streams; i++) {
+        while (viewers[i].parts < 2) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+
+    int tasks = 0;
+    const size_t stack = HostTaskStackBytes(&tasks);
+    int64_t *us = malloc(requests * sizeof(int64_t));
+    int n = 0, failed = 0;
+    for (int i = 0; i < requests; i++) {
+        const int64_t t = Request(i);
+        if (t < 0) {
+            failed++;
+        } else {
+            us[n++] = t;
+        }
+    }
+    uint32_t parts = 0;
+    for (int i = 0; i < streams; i++) {
+        viewers[i].stop = true;
+        pthread_join(threads[i], NULL);
+        StreamClientClose(&viewers[i].c);
+        parts += viewers[i].parts;
+    }
+    while (StreamGetClientCount() > 0) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    qsort(us, n, sizeof(int64_t), CompareUs);
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += us[i];
+    }
+    printf("%7d %5d %8zu %6d %7.2f %7.2f %7.2f %7.2f %6d %6u\n", streams, tasks, stack / 1024, n,
+           n ? sum / n / 1000.0 : 0.0, n ? us[n / 2] / 1000.0 : 0.0, n ? us[n * 95 / 100] / 1000.0 : 0.0,
+           n ? us[n - 1] / 1000.0 : 0.0, failed, parts);
+    free(us);
+}
+
+int main(int argc, char **argv)
+{
+    const int requests = argc > 1 ? atoi(argv[1]) : 300;
+    int max_streams = argc > 2 ? atoi(argv[2]) : MAX_STREAMS;
+    const float fps = argc > 3 ? (float)atof(argv[3]) : 25.0f;
+    max_streams = max_streams > MAX_STREAMS ? MAX_STREAMS : max_streams;
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    const stream_sim_config_t config = { .fps = fps, .port = port, .seed = 8 };
+    if (StreamSimStart(&config) != ESP_OK) {
+        printf("stack did not start\n");
+        return 1;
+    }
+    printf("sensor %.1f fps, synthetic HD, %d requests per round (/stats, /metrics, / revalidated)\n", fps,
+           requests);
+    printf("%7s %5s %8s %6s %7s %7s %7s %7s %6s %6s\n", "streams", "tasks", "stack kB", "req", "avg ms",
+           "p50 ms", "p95 ms", "max ms", "failed", "parts");
+    for (int streams = 0; streams <= max_streams; streams++) {
+        Round(streams, requests);
+    }
+    StreamSimStop();
+    return host_failures ? 1 : 0;
+}
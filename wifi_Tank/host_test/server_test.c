@@ -0,0 +1,158 @@
+/*! \file server_test.c
+\brief main/server.c on the host streaming stack (stream_sim.c): every route
+on the one port, streams on their own sender tasks so pages, /stats and
+/metrics are answered while clients watch /stream, the WebSocket beside them,
+and 503 for a stream client over the limit.
+*****/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "stream.h"
+#include "overlay.h"
+#include "web_assets.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18087
+#define TIMEOUT_MS 5000
+#define FPS 20
+#define STREAMS 4               // STREAM_MAX_CLIENTS of main/stream.c
+#define MAX_PART (512 * 1024)
+
+typedef struct {
+    stream_client_t c;
+    volatile bool stop;
+    volatile uint32_t parts;
+    bool ok;
+} viewer_t;
+
+static uint16_t port;
+
+static void *Viewer(void *arg)
+{
+    viewer_t *v = arg;
+    uint8_t *part = malloc(MAX_PART);
+    char headers[256];
+    while (!v->stop) {
+        const size_t len = StreamClientPart(&v->c, headers, sizeof(headers), part, MAX_PART);
+        if (!len) {
+            v->ok = false;
+            break;
+        }
+        v->parts++;
+    }
+    free(part);
+    return NULL;
+}
+
+// A short response, its body NUL terminated
+static int Get(const char *path, char *body, size_t size)
+{
+    stream_client_t c;
+    if (!StreamClientGet(&c, port, path, TIMEOUT_MS)) {
+        return 0;
+    }
+    const size_t n = StreamClientRead(&c, (uint8_t *)body, size - 1);
+    body[n] = 0;
+    StreamClientClose(&c);
+    return c.status;
+}
+
+static bool WaitParts(viewer_t *v, int count, uint32_t parts)
+{
+    const int64_t until = esp_timer_get_time() + TIMEOUT_MS * 1000LL;
+    for (int i = 0; i < count; i++) {
+        while (v[i].parts < parts && v[i].ok) {
+            if (esp_timer_get_time() > until) {
+                return false;
+            }
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        if (!v[i].ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void CheckWhileStreaming(void)
+{
+    static viewer_t viewers[STREAMS];
+    pthread_t threads[STREAMS];
+    char body[2048];
+
+    for (int i = 0; i < STREAMS; i++) {
+        viewers[i].ok = StreamClientGet(&viewers[i].c, port, "/stream", TIMEOUT_MS) && viewers[i].c.status == 200;
+        HOST_CHECK(viewers[i].ok);
+        pthread_create(&threads[i], NULL, Viewer, &viewers[i]);
+    }
+    HOST_CHECK(WaitParts(viewers, STREAMS, 3));
+
+    // every route answers while all streams run
+    for (size_t i = 0; i < web_assets_count; i++) {
+        HOST_CHECK(Get(web_assets[i].uri, body, sizeof(body)) == 200);
+    }
+    HOST_CHECK(Get("/stats", body, sizeof(body)) == 200);
+    char expect[64];
+    snprintf(expect, sizeof(expect), "\"stream_clients\":%d", STREAMS);
+    HOST_CHECK(strstr(body, expect) != NULL);
+    HOST_CHECK(strstr(body, "\"stream_frames\":") != NULL && strstr(body, "\"overlay_clients\":0") != NULL);
+    HOST_CHECK(Get("/metrics", body, sizeof(body)) == 200);
+    snprintf(expect, sizeof(expect), "\nwifi_tank_stream_clients %d\n", STREAMS);
+    HOST_CHECK(strstr(body, expect) != NULL);
+    HOST_CHECK(strstr(body, "# TYPE wifi_tank_stream_frames_total counter\n") != NULL);
+
+    // an overlay reaches a WebSocket client on the same port
+    stream_client_t ws;
+    HOST_CHECK(StreamClientWsOpen(&ws, port, "/ws", TIMEOUT_MS));
+    overlay_data_t overlay;
+    OverlayCreateSampleData(&overlay);
+    HOST_CHECK(OverlaySendUpdate(&overlay) == 1);
+    int opcode = 0;
+    HOST_CHECK(StreamClientWsRecv(&ws, &opcode, body, sizeof(body)) > 0 && opcode == 1);
+    StreamClientClose(&ws);
+
+    // one more stream is refused, the others go on
+    HOST_CHECK(Get("/stream", body, sizeof(body)) == 503);
+    const uint32_t parts = viewers[0].parts;
+    HOST_CHECK(WaitParts(viewers, STREAMS, parts + 3));
+
+    for (int i = 0; i < STREAMS; i++) {
+        viewers[i].stop = true;
+        pthread_join(threads[i], NULL);
+        StreamClientClose(&viewers[i].c);
+    }
+
+    // the sender tasks notice and give their places back
+    int64_t deadline = esp_timer_get_time() + TIMEOUT_MS * 1000LL;
+    while (StreamGetClientCount() > 0 && esp_timer_get_time() < deadline) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    HOST_CHECK(StreamGetClientCount() == 0);
+    viewer_t again = { .ok = true };
+    HOST_CHECK(StreamClientGet(&again.c, port, "/stream", TIMEOUT_MS) && again.c.status == 200);
+    char headers[256];
+    uint8_t *part = malloc(MAX_PART);
+    HOST_CHECK(StreamClientPart(&again.c, headers, sizeof(headers), part, MAX_PART) > 0);
+    free(part);
+    StreamClientClose(&again.c);
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    const stream_sim_config_t config = { .fps = FPS, .port = port, .seed = 4 };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+    char body[64];
+    HOST_CHECK(Get("/nothing", body, sizeof(body)) == 404);
+    CheckWhileStreaming();
+    StreamSimStop();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
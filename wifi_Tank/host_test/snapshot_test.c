@@ -0,0 +1,326 @@
+/*! \file snapshot_test.c
+\brief /snapshot.jpg (StreamSnapshotHandler() of main/stream.c) on the host
+streaming stack (stream_sim.c, synthetic HD frames). Concurrent snapshots
+while clients watch /stream take no frame from the camera: every one is a
+frame the streams sent. Without a stream, concurrent snapshots share one
+capture. The ETag names the frame (304 until the next one), ?scale=4 gives
+the frame at a quarter of its size, coded once for the requests for it.
+*****/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "stream.h"
+#include "jpeg_decoder.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18089
+#define TIMEOUT_MS 5000
+#define FPS 10
+#define SNAPSHOTS 5             // requests at once, the listen backlog of ServerInit()
+#define ROUNDS 3
+#define STREAMS 2
+#define MAX_JPEG (512 * 1024)
+#define MAX_ID 4096
+#define SNAPSHOT_STALE_FRAMES 3 // main/stream.c
+#define MIN_SCALED_PSNR 22.0    // the dense synthetic texture; red and blue swapped give about 12
+
+typedef struct {
+    const char *path;
+    const char *if_none_match;
+    int status;
+    uint32_t sequence;          // X-Frame-Sequence
+    uint32_t id;                // frame number of the player
+    char etag[64];
+    uint8_t *jpg;
+    size_t len;
+} snapshot_t;
+
+typedef struct {
+    stream_client_t c;
+    volatile bool stop;
+    volatile uint32_t parts;
+} viewer_t;
+
+static uint16_t port;
+static volatile uint8_t streamed[MAX_ID];   // frame numbers the viewers got
+
+static void Snapshot(snapshot_t *s)
+{
+    char headers[128] = "";
+    if (s->if_none_match) {
+        snprintf(headers, sizeof(headers), "If-None-Match: %s\r\n", s->if_none_match);
+    }
+    s->status = 0;
+    s->len = 0;
+    s->etag[0] = 0;
+    stream_client_t c;
+    if (!StreamClientGetHeaders(&c, port, s->path, headers, TIMEOUT_MS)) {
+        return;
+    }
+    char value[32];
+    s->status = c.status;
+    s->sequence = StreamClientHeader(&c, "X-Frame-Sequence", value, sizeof(value)) ? strtoul(value, NULL, 10) : 0;
+    StreamClientHeader(&c, "ETag", s->etag, sizeof(s->etag));
+    if (!s->jpg) {
+        s->jpg = malloc(MAX_JPEG);
+    }
+    s->len = StreamClientRead(&c, s->jpg, MAX_JPEG);
+    s->id = StreamSimFrameId(s->jpg, s->len);
+    StreamClientClose(&c);
+}
+
+static void *SnapshotThread(void *arg)
+{
+    Snapshot(arg);
+    return NULL;
+}
+
+// SNAPSHOTS requests at once
+static void Concurrent(snapshot_t *s)
+{
+    pthread_t threads[SNAPSHOTS];
+    for (int i = 0; i < SNAPSHOTS; i++) {
+        s[i].path = "/snapshot.jpg";
+        s[i].if_none_match = NULL;
+        pthread_create(&threads[i], NULL, SnapshotThread, &s[i]);
+    }
+    for (int i = 0; i < SNAPSHOTS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+static void *Viewer(void *arg)
+{
+    viewer_t *v = arg;
+    uint8_t *part = malloc(MAX_JPEG);
+    char headers[256];
+    size_t len;
+    while (!v->stop && (len = StreamClientPart(&v->c, headers, sizeof(headers), part, MAX_JPEG)) > 0) {
+        const uint32_t id = StreamSimFrameId(part, len);
+        if (id < MAX_ID) {
+            streamed[id] = 1;
+        }
+        v->parts++;
+    }
+    free(part);
+    return NULL;
+}
+
+static bool WaitParts(viewer_t *v, uint32_t parts)
+{
+    const int64_t until = esp_timer_get_time() + TIMEOUT_MS * 1000LL;
+    for (int i = 0; i < STREAMS; i++) {
+        while (v[i].parts < parts) {
+            if (esp_timer_get_time() > until) {
+                return false;
+            }
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+    return true;
+}
+
+// Image size from the SOF segment
+static bool JpegSize(const uint8_t *jpg, size_t len, int *width, int *height)
+{
+    for (size_t i = 2; i + 9 < len; ) {
+        if (jpg[i] != 0xff) {
+            return false;
+        }
+        const uint8_t marker = jpg[i + 1];
+        if (marker >= 0xc0 && marker <= 0xc2) {
+            *height = jpg[i + 5] << 8 | jpg[i + 6];
+            *width = jpg[i + 7] << 8 | jpg[i + 8];
+            return true;
+        }
+        i += 2 + (jpg[i + 2] << 8 | jpg[i + 3]);
+    }
+    return false;
+}
+
+static uint8_t *Decode(const uint8_t *jpg, size_t len, esp_jpeg_image_scale_t scale, int *width, int *height)
+{
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = (uint8_t *)jpg,
+        .indata_size = len,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888,
+        .out_scale = scale,
+    };
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return NULL;
+    }
+    cfg.outbuf = malloc(img.output_len);
+    cfg.outbuf_size = img.output_len;
+    if (esp_jpeg_decode(&cfg, &img) != ESP_OK) {
+        free(cfg.outbuf);
+        return NULL;
+    }
+    *width = img.width;
+    *height = img.height;
+    return cfg.outbuf;
+}
+
+static void CheckWithoutStreams(void)
+{
+    static snapshot_t s[SNAPSHOTS];
+    stream_snapshot_stats_t before, after;
+    StreamGetSnapshotStats(&before);
+    Concurrent(s);
+    StreamGetSnapshotStats(&after);
+
+    for (int i = 0; i < SNAPSHOTS; i++) {
+        HOST_CHECK(s[i].status == 200 && s[i].id != 0);
+        HOST_CHECK(s[i].sequence == s[0].sequence && s[i].id == s[0].id && strcmp(s[i].etag, s[0].etag) == 0);
+    }
+    // one capture, past the frames that waited in the driver queue
+    const uint32_t captures = after.captures - before.captures;
+    HOST_CHECK(captures >= 1 && captures <= 1 + SNAPSHOT_STALE_FRAMES);
+    HOST_CHECK(after.shared - before.shared == SNAPSHOTS - 1);
+    HOST_CHECK(after.requests - before.requests == SNAPSHOTS);
+    printf("no stream: %d snapshots at once, %u captures, %u shared\n", SNAPSHOTS, captures,
+           after.shared - before.shared);
+    for (int i = 0; i < SNAPSHOTS; i++) {
+        free(s[i].jpg);
+    }
+}
+
+static void CheckWhileStreaming(void)
+{
+    static viewer_t viewers[STREAMS];
+    static snapshot_t s[ROUNDS][SNAPSHOTS];
+    pthread_t threads[STREAMS];
+    for (int i = 0; i < STREAMS; i++) {
+        HOST_CHECK(StreamClientGet(&viewers[i].c, port, "/stream", TIMEOUT_MS) && viewers[i].c.status == 200);
+        pthread_create(&threads[i], NULL, Viewer, &viewers[i]);
+    }
+    HOST_CHECK(WaitParts(viewers, 3));
+
+    stream_snapshot_stats_t before, after;
+    StreamGetSnapshotStats(&before);
+    const uint32_t frames = StreamGetFrameCount();
+    for (int r = 0; r < ROUNDS; r++) {
+        Concurrent(s[r]);
+    }
+    StreamGetSnapshotStats(&after);
+
+    // not one frame taken from the camera, every snapshot is one the streams sent
+    HOST_CHECK(after.captures == before.captures);
+    HOST_CHECK(after.shared - before.shared == ROUNDS * SNAPSHOTS);
+    HOST_CHECK(WaitParts(viewers, viewers[0].parts + 3));
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < SNAPSHOTS; i++) {
+            HOST_CHECK(s[r][i].status == 200 && s[r][i].id != 0 && s[r][i].id < MAX_ID && streamed[s[r][i].id]);
+            free(s[r][i].jpg);
+        }
+    }
+    printf("%d streams: %d snapshots at once x %d, %u captures, %u shared, %u frames streamed meanwhile\n",
+           STREAMS, SNAPSHOTS, ROUNDS, after.captures - before.captures, after.shared - before.shared,
+           StreamGetFrameCount() - frames);
+
+    // revalidation: 304 until the streams send the next frame
+    snapshot_t first = { .path = "/snapshot.jpg" };
+    Snapshot(&first);
+    HOST_CHECK(first.status == 200 && first.etag[0] == '"');
+    bool not_modified = false;
+    for (int i = 0; i < 10 && !not_modified; i++) {
+        snapshot_t again = { .path = "/snapshot.jpg", .if_none_match = first.etag };
+        Snapshot(&again);
+        not_modified = again.status == 304;
+        HOST_CHECK(again.status == 304 ? again.len == 0 && strcmp(again.etag, first.etag) == 0
+                                       : again.status == 200 && again.sequence > first.sequence);
+        if (again.status == 200) {
+            memcpy(first.etag, again.etag, sizeof(first.etag));
+            first.sequence = again.sequence;
+        }
+        free(again.jpg);
+    }
+    HOST_CHECK(not_modified);
+    free(first.jpg);
+
+    for (int i = 0; i < STREAMS; i++) {
+        viewers[i].stop = true;
+        pthread_join(threads[i], NULL);
+        StreamClientClose(&viewers[i].c);
+    }
+    const int64_t until = esp_timer_get_time() + TIMEOUT_MS * 1000LL;
+    while (StreamGetClientCount() > 0 && esp_timer_get_time() < until) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    HOST_CHECK(StreamGetClientCount() == 0);
+}
+
+static void CheckScale(void)
+{
+    // the full frame and the scaled one of the same capture
+    snapshot_t full = { .path = "/snapshot.jpg" };
+    snapshot_t small = { .path = "/snapshot.jpg?scale=4" };
+    stream_snapshot_stats_t before, after;
+    for (int i = 0; i < 5; i++) {
+        Snapshot(&full);
+        StreamGetSnapshotStats(&before);
+        Snapshot(&small);
+        if (full.status == 200 && small.status == 200 && small.sequence == full.sequence) {
+            break;
+        }
+    }
+    HOST_CHECK(full.status == 200 && small.status == 200 && small.sequence == full.sequence);
+    HOST_CHECK(strcmp(full.etag, small.etag) != 0);
+
+    int w = 0, h = 0, fw = 0, fh = 0;
+    HOST_CHECK(JpegSize(full.jpg, full.len, &fw, &fh) && fw == 1280 && fh == 720);
+    HOST_CHECK(JpegSize(small.jpg, small.len, &w, &h) && w == fw / 4 && h == fh / 4);
+
+    // the pixels of the frame decoded at 1/4, colors included
+    int rw = 0, rh = 0, sw = 0, sh = 0;
+    uint8_t *ref = Decode(full.jpg, full.len, JPEG_IMAGE_SCALE_1_4, &rw, &rh);
+    uint8_t *img = Decode(small.jpg, small.len, JPEG_IMAGE_SCALE_0, &sw, &sh);
+    HOST_CHECK(ref && img && rw == sw && rh == sh);
+    double psnr = 0.0;
+    if (ref && img && rw == sw && rh == sh) {
+        psnr = HostPsnrRgb888(ref, img, rw, rh, 0, 0, rw, rh, 0);
+        HOST_CHECK(psnr >= MIN_SCALED_PSNR);
+    }
+    free(ref);
+    free(img);
+
+    // coded once for the requests for that frame and scale
+    snapshot_t again = { .path = "/snapshot.jpg?scale=4" };
+    Snapshot(&again);
+    StreamGetSnapshotStats(&after);
+    if (again.sequence == small.sequence) {
+        HOST_CHECK(again.status == 200 && strcmp(again.etag, small.etag) == 0);
+        HOST_CHECK(again.len == small.len && memcmp(again.jpg, small.jpg, small.len) == 0);
+        HOST_CHECK(after.scaled - before.scaled == 1);
+    }
+    printf("scale=4: %dx%d, %zu of %zu bytes, %.1f dB against the frame decoded at 1/4\n", w, h, small.len,
+           full.len, psnr);
+
+    snapshot_t bad = { .path = "/snapshot.jpg?scale=3" };
+    Snapshot(&bad);
+    HOST_CHECK(bad.status == 400);
+    free(full.jpg);
+    free(small.jpg);
+    free(again.jpg);
+    free(bad.jpg);
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    const stream_sim_config_t config = { .fps = FPS, .port = port, .seed = 9 };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+    CheckWithoutStreams();
+    CheckWhileStreaming();
+    CheckScale();
+    StreamSimStop();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
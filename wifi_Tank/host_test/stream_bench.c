@@ -0,0 +1,174 @@
+/*! \file stream_bench.c
+\brief Throughput, latency and CPU of the firmware's MJPEG streaming on the
+host streaming stack (stream_sim.c), for 1 to N clients watching /stream at
+once. Latency is from the VSYNC that ended a frame to the client having all
+of it. CPU is that of the firmware's tasks (capture, vision, HTTP server),
+the player and the clients do not count.
+
+    stream_bench [seconds per round] [max clients] [fps] [jpeg dir]
+
+Without a directory the player sends synthetic HD frames. The port is 18082
+or STREAM_SIM_PORT.
+*****/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "stream.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18082
+#define MAX_CLIENTS 16
+#define MAX_PART (512 * 1024)
+#define MAX_SAMPLES 4096
+
+typedef struct {
+    int64_t until;
+    uint32_t frames;
+    size_t bytes;
+    uint32_t bad;               // parts that are not a frame the player sent intact
+    int64_t first_us;           // first part received
+    int64_t last_us;
+    int samples;
+    int64_t latency[MAX_SAMPLES];
+} client_t;
+
+static uint16_t port;
+
+static void *Client(void *arg)
+{
+    client_t *cl = arg;
+    stream_client_t c;
+    uint8_t *part = malloc(MAX_PART);
+    char headers[256];
+    if (StreamClientGet(&c, port, "/stream", 1000)) {
+        while (esp_timer_get_time() < cl->until) {
+            const size_t len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART);
+            const int64_t now = esp_timer_get_time();
+            if (!len) {
+                break;
+            }
+            const uint32_t id = StreamSimFrameId(part, len);
+            const int64_t t = StreamSimFrameTime(id);
+            if (!id || t < 0 || StreamSimFrameCorrupted(id) || part[len - 2] != 0xff || part[len - 1] != 0xd9) {
+                cl->bad++;
+                continue;
+            }
+            if (!cl->frames) {
+                cl->first_us = now;
+            }
+            cl->last_us = now;
+            cl->frames++;
+            cl->bytes += len;
+            if (cl->samples < MAX_SAMPLES) {
+                cl->latency[cl->samples++] = now - t;
+            }
+        }
+    }
+    StreamClientClose(&c);
+    free(part);
+    return NULL;
+}
+
+static int CompareUs(const void *a, const void *b)
+{
+    const int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void Round(int clients, int seconds)
+{
+    static client_t cl[MAX_CLIENTS];
+    pthread_t threads[MAX_CLIENTS];
+    camera_stats_t cam0, cam1;
+    esp_camera_get_stats(&cam0);
+    const stream_sim_stats_t sim0 = StreamSimStats();
+    const int64_t start = esp_timer_get_time();
+    const int64_t cpu0 = HostTaskCpuUs();
+    for (int i = 0; i < clients; i++) {
+        memset(&cl[i], 0, sizeof(cl[i]));
+        cl[i].until = start + seconds * 1000000LL;
+        pthread_create(&threads[i], NULL, Client, &cl[i]);
+    }
+    for (int i = 0; i < clients; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    const int64_t wall = esp_timer_get_time() - start;
+    const int64_t cpu = HostTaskCpuUs() - cpu0;
+    esp_camera_get_stats(&cam1);
+    const stream_sim_stats_t sim1 = StreamSimStats();
+
+    // every client's latencies together
+    static int64_t all[MAX_CLIENTS * MAX_SAMPLES];
+    int n = 0, served = 0;
+    uint32_t frames = 0, bad = 0;
+    size_t bytes = 0;
+    double fps_min = 1e9, fps_max = 0, sum = 0;
+    for (int i = 0; i < clients; i++) {
+        const double fps = cl[i].frames > 1 ? (cl[i].frames - 1) * 1e6 / (cl[i].last_us - cl[i].first_us) : 0;
+        fps_min = fps < fps_min ? fps : fps_min;
+        fps_max = fps > fps_max ? fps : fps_max;
+        served += cl[i].frames > 0;
+        frames += cl[i].frames;
+        bad += cl[i].bad;
+        bytes += cl[i].bytes;
+        memcpy(all + n, cl[i].latency, cl[i].samples * sizeof(int64_t));
+        n += cl[i].samples;
+    }
+    qsort(all, n, sizeof(int64_t), CompareUs);
+    for (int i = 0; i < n; i++) {
+        sum += all[i];
+    }
+    const uint32_t sensor = sim1.frames - sim0.frames;
+    const uint32_t delivered = cam1.delivered - cam0.delivered;
+    printf("%7d %6d %8.1f %6.1f %6.1f %7.2f %8.1f %8.1f %8.1f %6.1f %6u %6u %4u\n", clients, served,
+           frames * 1e6 / wall, fps_min, fps_max, bytes * 8.0 / wall, n ? sum / n / 1000 : 0.0,
+           n ? all[n / 2] / 1000.0 : 0.0, n ? all[n * 95 / 100] / 1000.0 : 0.0, cpu * 100.0 / wall,
+           (unsigned)sensor, (unsigned)delivered, (unsigned)bad);
+
+    // let the server finish with the clients that just left
+    for (int i = 0; i < 300 && StreamGetClientCount() > 0; i++) {
+        usleep(10000);
+    }
+    usleep(200000);
+}
+
+int main(int argc, char **argv)
+{
+    const int seconds = argc > 1 ? atoi(argv[1]) : 5;
+    int max_clients = argc > 2 ? atoi(argv[2]) : 4;
+    const float fps = argc > 3 ? (float)atof(argv[3]) : 25.0f;
+    const char *dir = argc > 4 ? argv[4] : NULL;
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+    max_clients = max_clients > MAX_CLIENTS ? MAX_CLIENTS : max_clients;
+
+    const stream_sim_config_t config = {
+        .jpeg_dir = dir,
+        .fps = fps,
+        .jitter_us = (uint32_t)(100000 / fps),      // 10 % of the frame interval
+        .corrupt_every = 50,
+        .port = port,
+        .seed = 1,
+    };
+    if (StreamSimStart(&config) != ESP_OK) {
+        printf("Streaming stack did not start\n");
+        return 1;
+    }
+    const stream_sim_stats_t warm = StreamSimStats();
+    printf("sensor %.1f fps, %s, %zu bytes per frame on average so far\n", fps, dir ? dir : "synthetic HD",
+           warm.frames ? warm.bytes / warm.frames : 0);
+    printf("%7s %6s %8s %6s %6s %7s %8s %8s %8s %6s %6s %6s %4s\n", "clients", "served", "fps", "min", "max",
+           "Mbit/s", "lat ms", "p50 ms", "p95 ms", "cpu %", "sensor", "driver", "bad");
+    for (int clients = 1; clients <= max_clients; clients++) {
+        Round(clients, seconds);
+    }
+    StreamSimStop();
+    return 0;
+}
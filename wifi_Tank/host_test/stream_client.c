@@ -0,0 +1,358 @@
+/*! \file stream_client.c
+\brief Minimal HTTP and WebSocket client for the host streaming stack, see
+stream_client.h.
+*****/
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "stream_client.h"
+
+static bool SendAll(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    while (len) {
+        const ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Raw bytes from the socket, through the buffer
+static size_t Fill(stream_client_t *c)
+{
+    if (c->buf_pos < c->buf_len) {
+        return c->buf_len - c->buf_pos;
+    }
+    if (c->eof) {
+        return 0;
+    }
+    ssize_t n;
+    do {
+        n = recv(c->fd, c->buf, sizeof(c->buf), 0);
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0) {
+        c->eof = true;
+        return 0;
+    }
+    c->buf_pos = 0;
+    c->buf_len = n;
+    c->received += n;
+    return n;
+}
+
+static size_t RawRead(stream_client_t *c, uint8_t *out, size_t len)
+{
+    size_t got = 0;
+    while (got < len && Fill(c)) {
+        size_t n = c->buf_len - c->buf_pos;
+        n = n < len - got ? n : len - got;
+        memcpy(out + got, c->buf + c->buf_pos, n);
+        c->buf_pos += n;
+        got += n;
+    }
+    return got;
+}
+
+// One line without its CRLF, false at the end of the data or for a line too long
+static bool RawLine(stream_client_t *c, char *line, size_t size)
+{
+    size_t len = 0;
+    while (Fill(c)) {
+        const char ch = (char)c->buf[c->buf_pos++];
+        if (ch == '\n') {
+            if (len && line[len - 1] == '\r') {
+                len--;
+            }
+            line[len] = 0;
+            return true;
+        }
+        if (len == size - 1) {
+            return false;
+        }
+        line[len++] = ch;
+    }
+    return false;
+}
+
+static bool Connect(stream_client_t *c, uint16_t port, int timeout_ms)
+{
+    memset(c, 0, sizeof(*c));
+    c->content_left = -1;
+    c->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (c->fd < 0) {
+        return false;
+    }
+    const struct timeval tv = { .tv_sec = timeout_ms / 1000, .tv_usec = (timeout_ms % 1000) * 1000 };
+    const int one = 1;
+    setsockopt(c->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(c->fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    const struct sockaddr_in addr = {
+        .sin_family = AF_INET,
+        .sin_port = htons(port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+    };
+    if (connect(c->fd, (const struct sockaddr *)&addr, sizeof(addr))) {
+        close(c->fd);
+        c->fd = -1;
+        return false;
+    }
+    return true;
+}
+
+// Status line and headers
+static bool ReadHead(stream_client_t *c)
+{
+    char line[512];
+    if (!RawLine(c, line, sizeof(line)) || sscanf(line, "HTTP/1.1 %d", &c->status) != 1) {
+        return false;
+    }
+    while (RawLine(c, line, sizeof(line))) {
+        if (!line[0]) {
+            return true;
+        }
+        const size_t used = strlen(c->head);
+        snprintf(c->head + used, sizeof(c->head) - used, "%s\r\n", line);
+        if (strncasecmp(line, "Content-Type:", 13) == 0) {
+            snprintf(c->content_type, sizeof(c->content_type), "%s", line + 13 + strspn(line + 13, " "));
+        } else if (strncasecmp(line, "Content-Length:", 15) == 0) {
+            c->content_left = atol(line + 15);
+        } else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0 && strstr(line, "chunked")) {
+            c->chunked = true;
+        }
+    }
+    return false;
+}
+
+bool StreamClientGet(stream_client_t *c, uint16_t port, const char *path, int timeout_ms)
+{
+    return StreamClientGetHeaders(c, port, path, NULL, timeout_ms);
+}
+
+bool StreamClientGetHeaders(stream_client_t *c, uint16_t port, const char *path, const char *headers,
+                            int timeout_ms)
+{
+    return StreamClientRequest(c, port, "GET", path, headers, timeout_ms);
+}
+
+bool StreamClientRequest(stream_client_t *c, uint16_t port, const char *method, const char *path,
+                         const char *headers, int timeout_ms)
+{
+    if (!Connect(c, port, timeout_ms)) {
+        return false;
+    }
+    char req[1024];
+    const int n = snprintf(req, sizeof(req), "%s %s HTTP/1.1\r\nHost: 127.0.0.1\r\n%s\r\n", method, path,
+                           headers ? headers : "");
+    return n < (int)sizeof(req) && SendAll(c->fd, req, n) && ReadHead(c);
+}
+
+bool StreamClientHeader(const stream_client_t *c, const char *field, char *val, size_t size)
+{
+    const size_t len = strlen(field);
+    for (const char *line = c->head, *end; (end = strstr(line, "\r\n")) != NULL; line = end + 2) {
+        if (strncasecmp(line, field, len) == 0 && line[len] == ':') {
+            const char *v = line + len + 1 + strspn(line + len + 1, " ");
+            snprintf(val, size, "%.*s", (int)(end - v), v);
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t StreamClientRead(stream_client_t *c, uint8_t *buf, size_t len)
+{
+    if (!c->chunked) {
+        if (c->content_left >= 0 && (long)len > c->content_left) {
+            len = c->content_left;
+        }
+        const size_t n = RawRead(c, buf, len);
+        if (c->content_left >= 0) {
+            c->content_left -= n;
+        }
+        return n;
+    }
+    size_t got = 0;
+    while (got < len) {
+        if (!c->chunk_left) {
+            char line[32];
+            if (got && c->buf_pos == c->buf_len) {
+                break;      // what is here is enough, do not wait for the next chunk
+            }
+            if (!RawLine(c, line, sizeof(line))) {
+                break;
+            }
+            if (!line[0] && !RawLine(c, line, sizeof(line))) {
+                break;      // the CRLF after the previous chunk
+            }
+            c->chunk_left = strtoul(line, NULL, 16);
+            if (!c->chunk_left) {
+                c->eof = true;
+                break;
+            }
+        }
+        const size_t want = c->chunk_left < len - got ? c->chunk_left : len - got;
+        const size_t n = RawRead(c, buf + got, want);
+        c->chunk_left -= n;
+        got += n;
+        if (n < want) {
+            break;
+        }
+    }
+    return got;
+}
+
+static bool BodyAll(stream_client_t *c, uint8_t *buf, size_t len)
+{
+    size_t got = 0;
+    while (got < len) {
+        const size_t n = StreamClientRead(c, buf + got, len - got);
+        if (!n) {
+            return false;
+        }
+        got += n;
+    }
+    return true;
+}
+
+// A line of the body
+static bool BodyLine(stream_client_t *c, char *line, size_t size)
+{
+    size_t len = 0;
+    uint8_t ch;
+    while (StreamClientRead(c, &ch, 1) == 1) {
+        if (ch == '\n') {
+            if (len && line[len - 1] == '\r') {
+                len--;
+            }
+            line[len] = 0;
+            return true;
+        }
+        if (len == size - 1) {
+            return false;
+        }
+        line[len++] = (char)ch;
+    }
+    return false;
+}
+
+size_t StreamClientPart(stream_client_t *c, char *headers, size_t headers_size, uint8_t *data, size_t cap)
+{
+    char line[256];
+    // the boundary line, after the CRLF that ends the previous part
+    do {
+        if (!BodyLine(c, line, sizeof(line))) {
+            return 0;
+        }
+    } while (strncmp(line, "--", 2) != 0);
+
+    size_t hlen = 0;
+    long len = -1;
+    headers[0] = 0;
+    while (BodyLine(c, line, sizeof(line)) && line[0]) {
+        if (strncasecmp(line, "Content-Length:", 15) == 0) {
+            len = atol(line + 15);
+        }
+        hlen += snprintf(headers + hlen, hlen < headers_size ? headers_size - hlen : 0, "%s\r\n", line);
+    }
+    if (len <= 0 || (size_t)len > cap || !BodyAll(c, data, len)) {
+        return 0;
+    }
+    return len;
+}
+
+bool StreamClientWsOpen(stream_client_t *c, uint16_t port, const char *path, int timeout_ms)
+{
+    if (!Connect(c, port, timeout_ms)) {
+        return false;
+    }
+    char req[512];
+    const int n = snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: 127.0.0.1\r\nUpgrade: websocket\r\n"
+                           "Connection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                           "Sec-WebSocket-Version: 13\r\n\r\n", path);
+    return SendAll(c->fd, req, n) && ReadHead(c) && c->status == 101;
+}
+
+bool StreamClientWsSend(stream_client_t *c, int opcode, const void *data, size_t len)
+{
+    static const uint8_t mask[4] = { 0x12, 0x34, 0x56, 0x78 };
+    uint8_t h[8];
+    size_t n = 2;
+    if (len > 65535) {
+        return false;
+    }
+    h[0] = 0x80 | opcode;
+    if (len < 126) {
+        h[1] = 0x80 | (uint8_t)len;
+    } else {
+        h[1] = 0x80 | 126;
+        h[2] = (uint8_t)(len >> 8);
+        h[3] = (uint8_t)len;
+        n = 4;
+    }
+    memcpy(h + n, mask, 4);
+    n += 4;
+    uint8_t *payload = malloc(len + 1);
+    for (size_t i = 0; i < len; i++) {
+        payload[i] = ((const uint8_t *)data)[i] ^ mask[i & 3];
+    }
+    const bool ok = SendAll(c->fd, h, n) && SendAll(c->fd, payload, len);
+    free(payload);
+    return ok;
+}
+
+long StreamClientWsRecv(stream_client_t *c, int *opcode, char *buf, size_t cap)
+{
+    uint8_t h[8];
+    if (RawRead(c, h, 2) != 2) {
+        return -1;
+    }
+    *opcode = h[0] & 0x0f;
+    uint64_t len = h[1] & 0x7f;
+    if (len == 126) {
+        if (RawRead(c, h, 2) != 2) {
+            return -1;
+        }
+        len = (uint64_t)h[0] << 8 | h[1];
+    } else if (len == 127) {
+        if (RawRead(c, h, 8) != 8) {
+            return -1;
+        }
+        len = 0;
+        for (int i = 0; i < 8; i++) {
+            len = len << 8 | h[i];
+        }
+    }
+    for (uint64_t i = 0; i < len; i++) {
+        uint8_t ch;
+        if (RawRead(c, &ch, 1) != 1) {
+            return -1;
+        }
+        if (i < cap - 1) {
+            buf[i] = (char)ch;
+        }
+    }
+    buf[len < cap - 1 ? len : cap - 1] = 0;
+    return (long)len;
+}
+
+void StreamClientClose(stream_client_t *c)
+{
+    if (c->fd >= 0) {
+        close(c->fd);
+        c->fd = -1;
+    }
+}
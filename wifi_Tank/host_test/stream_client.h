@@ -0,0 +1,133 @@
+/*! \file stream_client.h
+\brief Minimal HTTP client for the host streaming stack: one request per
+connection, chunked bodies, the parts of a multipart MJPEG stream, and
+WebSocket text frames. Blocking, with a receive timeout so a client the
+server never gets to fails instead of hanging.
+*****/
+#ifndef STREAM_CLIENT_H
+#define STREAM_CLIENT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int fd;
+    int status;                 // HTTP status code of the response
+    char content_type[128];
+    bool chunked;
+    size_t chunk_left;          // bytes left in the current chunk
+    long content_left;          // bytes left of a body with a length, -1 for chunked or unknown
+    bool eof;
+    char head[1024];            // response header lines, NUL terminated, what fits
+    size_t received;            // bytes received on the connection, head included
+    uint8_t buf[4096];          // received, not yet consumed
+    size_t buf_pos;
+    size_t buf_len;
+} stream_client_t;
+
+/**
+ * @brief Connect to 127.0.0.1 and send a GET request, then read the response head
+ * @param c Client
+ * @param port Server port
+ * @param path Request path
+ * @param timeout_ms Receive timeout of every read
+ * @return true once the status line and headers are in
+ */
+bool StreamClientGet(stream_client_t *c, uint16_t port, const char *path, int timeout_ms);
+
+/**
+ * @brief StreamClientGet() with extra request headers
+ * @param headers Header lines, each ending in CRLF, or NULL
+ */
+bool StreamClientGetHeaders(stream_client_t *c, uint16_t port, const char *path, const char *headers,
+                            int timeout_ms);
+
+/**
+ * @brief Send a request without a body, then read the response head
+ * @param c Client
+ * @param port Server port
+ * @param method "GET", "POST", ...
+ * @param path Request path
+ * @param headers Header lines, each ending in CRLF, or NULL ("Content-Length: 0" for a POST)
+ * @param timeout_ms Receive timeout of every read
+ * @return true once the status line and headers are in
+ */
+bool StreamClientRequest(stream_client_t *c, uint16_t port, const char *method, const char *path,
+                         const char *headers, int timeout_ms);
+
+/**
+ * @brief Value of a response header
+ * @param c Client
+ * @param field Header name, any case
+ * @param val Output, NUL terminated, truncated to size
+ * @param size Size of val
+ * @return true if the response has the header
+ */
+bool StreamClientHeader(const stream_client_t *c, const char *field, char *val, size_t size);
+
+/**
+ * @brief Read the response body, chunked or not
+ * @param c Client
+ * @param buf Output
+ * @param len Bytes wanted
+ * @return Bytes read, less than len only at the end of the body or on an error
+ */
+size_t StreamClientRead(stream_client_t *c, uint8_t *buf, size_t len);
+
+/**
+ * @brief Next part of a multipart body: skips to the boundary, reads the part
+ *        headers and the part with the Content-Length they give
+ * @param c Client
+ * @param headers Output, the part headers, NUL terminated
+ * @param headers_size Size of headers
+ * @param data Output, the part
+ * @param cap Size of data
+ * @return Part length, 0 at the end of the stream, on an error or for a part larger than cap
+ */
+size_t StreamClientPart(stream_client_t *c, char *headers, size_t headers_size, uint8_t *data, size_t cap);
+
+/**
+ * @brief Connect to 127.0.0.1 and open a WebSocket
+ * @param c Client
+ * @param port Server port
+ * @param path Request path
+ * @param timeout_ms Receive timeout of every read
+ * @return true once the server switched protocols
+ */
+bool StreamClientWsOpen(stream_client_t *c, uint16_t port, const char *path, int timeout_ms);
+
+/**
+ * @brief Send a masked WebSocket frame
+ * @param c Client
+ * @param opcode Frame type, 1 text, 8 close, 9 ping
+ * @param data Payload
+ * @param len Payload length, up to 65535
+ * @return true once sent
+ */
+bool StreamClientWsSend(stream_client_t *c, int opcode, const void *data, size_t len);
+
+/**
+ * @brief Receive a WebSocket frame, truncated to the buffer, NUL terminated
+ * @param c Client
+ * @param opcode Output, frame type
+ * @param buf Output, payload
+ * @param cap Size of buf
+ * @return Payload length, -1 on an error or a timeout
+ */
+long StreamClientWsRecv(stream_client_t *c, int *opcode, char *buf, size_t cap);
+
+/**
+ * @brief Close the connection
+ */
+void StreamClientClose(stream_client_t *c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,319 @@
+/*! \file stream_sim.c
+\brief Host streaming stack with a player in place of the sensor, see
+stream_sim.h. The player is a plain thread, not a task, so HostTaskCpuUs()
+counts the firmware's tasks only. It waits for esp_camera_init() to start the
+DMA, then plays a frame, sleeps to the next deadline and plays the next one.
+A frame the firmware cannot take (every buffer held, DMA stopped) is lost the
+way it is on the target.
+*****/
+#include <dirent.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "stream_sim.h"
+#include "stream.h"
+#include "server.h"
+#include "recorder.h"
+#include "esp_camera.h"
+#include "esp_http_server.h"
+#include "esp_timer.h"
+#include "img_converters.h"
+#include "cam_sim.h"
+#include "sensor_sim.h"
+#include "partition_sim.h"
+#include "host_util.h"
+
+#define FRAME_RING 4096         // frames StreamSimFrameTime() remembers
+#define COM_SIZE 8              // FF FE, length 6, frame number
+#define SYNTH_FRAMES 8
+#define SYNTH_W 1280
+#define SYNTH_H 720
+#define SYNTH_QUALITY 50
+#define RECORDER_PARTITION_SIZE 0x1F0000   // partitions.csv
+
+static struct {
+    stream_sim_config_t config;
+    uint8_t **jpg;
+    size_t *jpg_len;
+    size_t count;
+    uint8_t *frame;             // frame being played, with the COM segment
+    size_t frame_size;
+    pthread_t player;
+    volatile bool stop;
+    uint32_t rng;
+    pthread_mutex_t lock;       // the tables and counters below
+    int64_t time[FRAME_RING];
+    uint32_t id[FRAME_RING];
+    bool corrupted[FRAME_RING];
+    stream_sim_stats_t stats;
+} sim = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+static uint32_t Random(void)
+{
+    sim.rng ^= sim.rng << 13;
+    sim.rng ^= sim.rng >> 17;
+    sim.rng ^= sim.rng << 5;
+    return sim.rng;
+}
+
+static void AddFrame(uint8_t *jpg, size_t len)
+{
+    sim.jpg = realloc(sim.jpg, (sim.count + 1) * sizeof(*sim.jpg));
+    sim.jpg_len = realloc(sim.jpg_len, (sim.count + 1) * sizeof(*sim.jpg_len));
+    sim.jpg[sim.count] = jpg;
+    sim.jpg_len[sim.count++] = len;
+    if (len + COM_SIZE > sim.frame_size) {
+        sim.frame_size = len + COM_SIZE;
+    }
+}
+
+static int CompareNames(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static void LoadDir(const char *dir)
+{
+    DIR *d = opendir(dir);
+    if (!d) {
+        return;
+    }
+    char **names = NULL;
+    size_t count = 0;
+    for (struct dirent *e; (e = readdir(d)); ) {
+        const size_t n = strlen(e->d_name);
+        if (n > 4 && strcmp(e->d_name + n - 4, ".jpg") == 0) {
+            names = realloc(names, (count + 1) * sizeof(*names));
+            names[count++] = strdup(e->d_name);
+        }
+    }
+    closedir(d);
+    qsort(names, count, sizeof(*names), CompareNames);
+    for (size_t i = 0; i < count; i++) {
+        char path[1024];
+        size_t len = 0;
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        uint8_t *jpg = HostReadFile(path, &len);
+        if (jpg && len > 4 && jpg[0] == 0xff && jpg[1] == 0xd8) {
+            AddFrame(jpg, len);
+        } else {
+            free(jpg);
+        }
+        free(names[i]);
+    }
+    free(names);
+}
+
+// HD frames of roughly the size the sensor gives: texture, and a box that moves
+static void MakeFrames(void)
+{
+    uint8_t *rgb = malloc(SYNTH_W * SYNTH_H * 3);
+    for (int f = 0; f < SYNTH_FRAMES; f++) {
+        for (int y = 0; y < SYNTH_H; y++) {
+            for (int x = 0; x < SYNTH_W; x++) {
+                const bool box = x >= 100 + f * 120 && x < 260 + f * 120 && y >= 280 && y < 440;
+                uint8_t *p = &rgb[(y * SYNTH_W + x) * 3];
+                p[0] = box ? 240 : (uint8_t)((((x / 6) * 7) ^ ((y / 6) * 13)) & 0x7f) + y / 8;
+                p[1] = box ? 40 : (uint8_t)((((x / 6) * 5) ^ ((y / 6) * 3)) & 0x3f) + x / 12;
+                p[2] = box ? 40 : (uint8_t)((x + y + f * 8) & 0x7f);
+            }
+        }
+        uint8_t *jpg = NULL;
+        size_t len = 0;
+        if (fmt2jpg(rgb, SYNTH_W * SYNTH_H * 3, SYNTH_W, SYNTH_H, PIXFORMAT_RGB888, SYNTH_QUALITY, &jpg, &len)) {
+            AddFrame(jpg, len);
+        }
+    }
+    free(rgb);
+}
+
+// The frame with its number right after SOI, then corrupted if it is due
+static size_t BuildFrame(uint32_t id, bool corrupt)
+{
+    const uint8_t *src = sim.jpg[(id - 1) % sim.count];
+    const size_t src_len = sim.jpg_len[(id - 1) % sim.count];
+    uint8_t *f = sim.frame;
+    f[0] = 0xff;
+    f[1] = 0xd8;
+    f[2] = 0xff;
+    f[3] = 0xfe;
+    f[4] = 0;
+    f[5] = 6;
+    f[6] = (uint8_t)(id >> 24);
+    f[7] = (uint8_t)(id >> 16);
+    f[8] = (uint8_t)(id >> 8);
+    f[9] = (uint8_t)id;
+    memcpy(f + 2 + COM_SIZE, src + 2, src_len - 2);
+    size_t len = src_len + COM_SIZE;
+    if (!corrupt) {
+        return len;
+    }
+    switch (Random() % 3) {
+    case 0:     // link dropped out: cut short, no EOI
+        return len / 2 + Random() % (len / 4);
+    case 1:     // start of frame lost: no SOI
+        memmove(f, f + 2, len - 2);
+        return len - 2;
+    default:    // noise: no SOI, whatever the bytes happen to be
+        for (size_t i = 0; i < len; i++) {
+            f[i] = (uint8_t)Random();
+            if (i && f[i - 1] == 0xff && f[i] == 0xd8) {
+                f[i] = 0;
+            }
+        }
+        f[0] = 0;
+        return len;
+    }
+}
+
+static void SleepUntil(int64_t us)
+{
+    const struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000 };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL)) {
+    }
+}
+
+static void *Player(void *arg)
+{
+    (void)arg;
+    while (!sim.stop && !CamSimStarted()) {
+        usleep(1000);
+    }
+    if (sim.stop) {
+        return NULL;
+    }
+    CamSimWaitReady();
+    CamSimVsync();
+
+    const int64_t period = (int64_t)(1000000.0f / sim.config.fps);
+    int64_t next = esp_timer_get_time();
+    for (uint32_t id = 1; !sim.stop; id++) {
+        const bool corrupt = sim.config.corrupt_every && id % sim.config.corrupt_every == 0;
+        const size_t len = BuildFrame(id, corrupt);
+
+        pthread_mutex_lock(&sim.lock);
+        sim.time[id % FRAME_RING] = esp_timer_get_time();
+        sim.id[id % FRAME_RING] = id;
+        sim.corrupted[id % FRAME_RING] = corrupt;
+        sim.stats.frames++;
+        sim.stats.corrupted += corrupt;
+        sim.stats.bytes += len;
+        pthread_mutex_unlock(&sim.lock);
+        CamSimFrame(sim.frame, len);
+
+        int64_t jitter = 0;
+        if (sim.config.jitter_us) {
+            jitter = (int64_t)(Random() % (2 * sim.config.jitter_us + 1)) - sim.config.jitter_us;
+        }
+        next += period + jitter;
+        const int64_t now = esp_timer_get_time();
+        if (next < now) {
+            next = now;     // behind: the sensor does not catch up, it just runs on
+        }
+        SleepUntil(next);
+    }
+    return NULL;
+}
+
+esp_err_t StreamSimStart(const stream_sim_config_t *config)
+{
+    sim.config = *config;
+    sim.rng = config->seed ? config->seed : 1;
+    sim.stop = false;
+    memset(&sim.stats, 0, sizeof(sim.stats));
+    memset(sim.id, 0, sizeof(sim.id));
+    if (config->jpeg_dir) {
+        LoadDir(config->jpeg_dir);
+    } else {
+        MakeFrames();
+    }
+    if (!sim.count) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    sim.frame = malloc(sim.frame_size);
+
+    // OV3660 at power-up, as main/stream.c expects it
+    SensorSimPowerUp(&sensor_sim_ov3660);
+
+    // StreamInit() waits for the first frame, so the sensor is running before it is called
+    pthread_create(&sim.player, NULL, Player, NULL);
+    if (StreamInit() != 0) {
+        sim.stop = true;
+        pthread_join(sim.player, NULL);
+        return ESP_FAIL;
+    }
+    StreamStart();
+    if (config->recorder) {
+        const char *label = config->recorder->partition;
+        if (!esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label)) {
+            PartitionSimCreate(label, RECORDER_PARTITION_SIZE);
+        }
+        if (RecorderInit(config->recorder) != 0) {
+            StreamSimStop();
+            return ESP_FAIL;
+        }
+    }
+    if (ServerInit(config->port) != 0) {
+        StreamSimStop();
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void StreamSimStop(void)
+{
+    // the stream senders return on their next send, while the player still feeds them
+    RecorderStop();
+    ServerStop();
+    StreamStop();
+    sim.stop = true;
+    pthread_join(sim.player, NULL);
+    esp_camera_deinit();
+    for (size_t i = 0; i < sim.count; i++) {
+        free(sim.jpg[i]);
+    }
+    free(sim.jpg);
+    free(sim.jpg_len);
+    free(sim.frame);
+    sim.jpg = NULL;
+    sim.jpg_len = NULL;
+    sim.frame = NULL;
+    sim.count = 0;
+    sim.frame_size = 0;
+}
+
+uint32_t StreamSimFrameId(const uint8_t *jpeg, size_t len)
+{
+    if (len < 2 + COM_SIZE || jpeg[0] != 0xff || jpeg[1] != 0xd8 || jpeg[2] != 0xff || jpeg[3] != 0xfe
+        || jpeg[4] != 0 || jpeg[5] != 6) {
+        return 0;
+    }
+    return (uint32_t)jpeg[6] << 24 | (uint32_t)jpeg[7] << 16 | (uint32_t)jpeg[8] << 8 | jpeg[9];
+}
+
+int64_t StreamSimFrameTime(uint32_t id)
+{
+    pthread_mutex_lock(&sim.lock);
+    const int64_t t = id && sim.id[id % FRAME_RING] == id ? sim.time[id % FRAME_RING] : -1;
+    pthread_mutex_unlock(&sim.lock);
+    return t;
+}
+
+bool StreamSimFrameCorrupted(uint32_t id)
+{
+    pthread_mutex_lock(&sim.lock);
+    const bool corrupted = id && sim.id[id % FRAME_RING] == id && sim.corrupted[id % FRAME_RING];
+    pthread_mutex_unlock(&sim.lock);
+    return corrupted;
+}
+
+stream_sim_stats_t StreamSimStats(void)
+{
+    pthread_mutex_lock(&sim.lock);
+    const stream_sim_stats_t stats = sim.stats;
+    pthread_mutex_unlock(&sim.lock);
+    return stats;
+}
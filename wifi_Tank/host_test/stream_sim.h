@@ -0,0 +1,85 @@
+/*! \file stream_sim.h
+\brief The camera streaming stack of the firmware on the host: main/stream.c
+and main/overlay.c on the host HTTP server (host_httpd.c), esp_camera.c and
+cam_hal.c on the models of the sensor bus, NVS and camera DMA, and a player
+thread in place of the sensor. The player replays JPEG files at a set frame
+rate with jitter, and corrupts some frames the way a disturbed sensor link
+does. Every frame it sends carries its number in a COM segment right after
+SOI, so a client can tell which frame it got and when the sensor sent it.
+*****/
+#ifndef STREAM_SIM_H
+#define STREAM_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "recorder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    const char *jpeg_dir;       // *.jpg files played in name order, NULL for synthetic HD frames
+    float fps;                  // sensor frame rate
+    uint32_t jitter_us;         // frame interval varies by up to this much either way
+    uint32_t corrupt_every;     // every n-th frame is corrupted, 0 for none
+    uint16_t port;              // HTTP port of ServerInit()
+    uint32_t seed;              // jitter and corruption pattern
+    const recorder_config_t *recorder;  // RecorderInit() settings, NULL for no recorder
+} stream_sim_config_t;
+
+typedef struct {
+    uint32_t frames;            // frames the player sent
+    uint32_t corrupted;         // of them corrupted
+    size_t bytes;               // bytes the player sent
+} stream_sim_stats_t;
+
+/**
+ * @brief Bring up the stack with StreamInit() and ServerInit() while the player starts sending
+ *
+ * With config->recorder, RecorderInit() runs between them, on a partition_sim.h
+ * partition of the size partitions.csv gives it unless the caller created one.
+ * @param config Player and server settings
+ * @return ESP_OK, ESP_ERR_NOT_FOUND without JPEG files, ESP_FAIL if StreamInit(), RecorderInit() or
+ *         ServerInit() failed
+ */
+esp_err_t StreamSimStart(const stream_sim_config_t *config);
+
+/**
+ * @brief Stop the recorder, the HTTP server, the player and the camera
+ */
+void StreamSimStop(void);
+
+/**
+ * @brief Number of a frame the player sent, from its COM segment
+ * @param jpeg Frame as a client received it
+ * @param len Its length
+ * @return Frame number from 1, 0 for a frame the player did not number
+ */
+uint32_t StreamSimFrameId(const uint8_t *jpeg, size_t len);
+
+/**
+ * @brief When the player finished sending a frame, i.e. the VSYNC that ended it
+ * @param id Frame number
+ * @return esp_timer time in microseconds, -1 for a frame not sent (yet) or too long ago
+ */
+int64_t StreamSimFrameTime(uint32_t id);
+
+/**
+ * @brief Whether the player corrupted a frame
+ * @param id Frame number
+ */
+bool StreamSimFrameCorrupted(uint32_t id);
+
+/**
+ * @brief Counters since StreamSimStart()
+ */
+stream_sim_stats_t StreamSimStats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
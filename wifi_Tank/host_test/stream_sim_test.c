@@ -0,0 +1,167 @@
+/*! \file stream_sim_test.c
+\brief main/stream.c and main/overlay.c end to end on the host streaming
+stack (stream_sim.c), with the test JPEGs of esp_jpeg as the sensor output
+and every 4th frame corrupted. The MJPEG stream must carry the sensor's
+frames byte for byte, in order, and none of the corrupted ones. The web
+pages and the overlay WebSocket are checked on the same server.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "stream.h"
+#include "overlay.h"
+#include "web_assets.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18081
+#define TIMEOUT_MS 5000
+#define FPS 30
+#define CORRUPT_EVERY 4
+#define STREAM_PARTS 20
+#define MAX_PART (256 * 1024)
+
+// The player's files, in name order
+static const char *files[] = { "logo.jpg", "usb_camera.jpg", "usb_camera_2.jpg" };
+#define FILES (sizeof(files) / sizeof(files[0]))
+
+static uint8_t *src[FILES];
+static size_t src_len[FILES];
+static uint16_t port;
+
+// Every page of the asset table, compressed as the table has it (web_assets_test checks the table)
+static void CheckPages(void)
+{
+    for (size_t i = 0; i < web_assets_count; i++) {
+        const web_asset_t *asset = &web_assets[i];
+        stream_client_t c;
+        char encoding[32] = "";
+        HOST_CHECK(StreamClientGet(&c, port, asset->uri, TIMEOUT_MS));
+        HOST_CHECK(c.status == 200 && strcmp(c.content_type, asset->type) == 0);
+        HOST_CHECK(StreamClientHeader(&c, "Content-Encoding", encoding, sizeof(encoding))
+                   && strcmp(encoding, "gzip") == 0);
+        HOST_CHECK(c.content_left == (long)asset->gzip_len);
+        uint8_t *body = malloc(asset->gzip_len + 1);
+        HOST_CHECK(StreamClientRead(&c, body, asset->gzip_len + 1) == asset->gzip_len);
+        HOST_CHECK(memcmp(body, asset->gzip, asset->gzip_len) == 0);
+        free(body);
+        StreamClientClose(&c);
+    }
+
+    stream_client_t c;
+    HOST_CHECK(StreamClientGet(&c, port, "/nothing", TIMEOUT_MS));
+    HOST_CHECK(c.status == 404);
+    StreamClientClose(&c);
+}
+
+// An overlay update reaches the WebSocket client, a ping gets its pong
+static void CheckOverlay(void)
+{
+    stream_client_t c;
+    HOST_CHECK(StreamClientWsOpen(&c, port, "/ws", TIMEOUT_MS));
+    overlay_data_t overlay;
+    OverlayCreateSampleData(&overlay);
+    HOST_CHECK(OverlaySendUpdate(&overlay) == 1);
+
+    char msg[4096];
+    int opcode = 0;
+    const long len = StreamClientWsRecv(&c, &opcode, msg, sizeof(msg));
+    HOST_CHECK(opcode == 1 && len > 0 && (size_t)len < sizeof(msg));
+    HOST_CHECK(msg[0] == '{' && msg[len - 1] == '}');
+    HOST_CHECK(strstr(msg, "\"text\":[{\"content\":\"ESP32 WiFi Tank\",\"x\":10,\"y\":30,") != NULL);
+    HOST_CHECK(strstr(msg, "\"shapes\":[") != NULL);
+
+    HOST_CHECK(StreamClientWsSend(&c, 9, "ping", 4));
+    HOST_CHECK(StreamClientWsRecv(&c, &opcode, msg, sizeof(msg)) == 4);
+    HOST_CHECK(opcode == 10 && strcmp(msg, "ping") == 0);
+
+    HOST_CHECK(StreamClientWsSend(&c, 8, NULL, 0));
+    HOST_CHECK(StreamClientWsRecv(&c, &opcode, msg, sizeof(msg)) == 0 && opcode == 8);
+    StreamClientClose(&c);
+}
+
+// Frames in order, intact, none of the corrupted ones, and no older than the frame queue allows
+static void CheckStream(void)
+{
+    stream_client_t c;
+    HOST_CHECK(StreamClientGet(&c, port, "/stream", TIMEOUT_MS));
+    HOST_CHECK(c.status == 200 && c.chunked);
+    HOST_CHECK(strncmp(c.content_type, "multipart/x-mixed-replace;boundary=", 35) == 0);
+
+    uint8_t *part = malloc(MAX_PART);
+    char headers[256];
+    uint32_t last = 0;
+    int64_t worst_us = 0;
+    int parts = 0;
+    for (; parts < STREAM_PARTS; parts++) {
+        const size_t len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART);
+        const int64_t now = esp_timer_get_time();
+        HOST_CHECK(len > 0 && strstr(headers, "Content-Type: image/jpeg\r\n") != NULL);
+        if (!len) {
+            break;
+        }
+        const uint32_t id = StreamSimFrameId(part, len);
+        HOST_CHECK(id > last);
+        HOST_CHECK(!StreamSimFrameCorrupted(id));
+        const size_t f = (id - 1) % FILES;
+        HOST_CHECK(len == src_len[f] + 8 && memcmp(part + 10, src[f] + 2, src_len[f] - 2) == 0);
+        const int64_t t = StreamSimFrameTime(id);
+        HOST_CHECK(t > 0 && now >= t);
+        worst_us = now - t > worst_us ? now - t : worst_us;
+        last = id;
+    }
+    StreamClientClose(&c);
+    free(part);
+
+    // CAMERA_GRAB_WHEN_EMPTY keeps the oldest frames queued while the stream takes one per
+    // 100 ms, so a frame may wait for every buffer ahead of it
+    HOST_CHECK(worst_us < 3 * 100000 + 2 * 1000000 / FPS);
+    printf("%d frames up to #%u, oldest %.1f ms when received\n", parts, (unsigned)last, worst_us / 1000.0);
+
+    const stream_sim_stats_t sim = StreamSimStats();
+    camera_stats_t cam;
+    HOST_CHECK(esp_camera_get_stats(&cam) == ESP_OK);
+    printf("sensor: %u frames, %u corrupted; driver: %u delivered, %u no FB, %u no SOI, %u no EOI, "
+           "%u bad JPEG\n", (unsigned)sim.frames, (unsigned)sim.corrupted, (unsigned)cam.delivered,
+           (unsigned)cam.no_fb, (unsigned)cam.no_soi, (unsigned)cam.no_eoi, (unsigned)cam.jpeg_bad);
+    HOST_CHECK(sim.corrupted >= sim.frames / CORRUPT_EVERY - 1 && sim.corrupted > 0);
+    // corrupted frames that found every buffer held count as NO-FB like the intact ones
+    HOST_CHECK(cam.no_soi + cam.no_eoi + cam.jpeg_bad > 0);
+    HOST_CHECK(cam.no_soi + cam.no_eoi + cam.jpeg_bad <= sim.corrupted);
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+    for (size_t i = 0; i < FILES; i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, files[i]);
+        src[i] = HostReadFile(path, &src_len[i]);
+        HOST_CHECK(src[i] != NULL);
+    }
+
+    const stream_sim_config_t config = {
+        .jpeg_dir = JPEG_TEST_DIR,
+        .fps = FPS,
+        .jitter_us = 3000,
+        .corrupt_every = CORRUPT_EVERY,
+        .port = port,
+        .seed = 7,
+    };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+    CheckPages();
+    CheckOverlay();
+    CheckStream();
+    StreamSimStop();
+
+    for (size_t i = 0; i < FILES; i++) {
+        free(src[i]);
+    }
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,217 @@
+/*! \file stream_skip_test.c
+\brief Duplicate frame suppression of the MJPEG stream (StreamSetSkip()) on
+the host streaming stack (stream_sim.c), replaying an idle and a motion
+sequence. Idle, a client gets a keep-alive frame a second in place of every
+frame, with fine and with coarse cells, a fraction of the bytes of a
+/stream?skip=0 client; with motion it gets about every frame. Threshold 0
+sends every frame again, and /stats counts the skipped frames.
+
+Usage: stream_skip_test [idle_dir motion_dir]
+       directories of JPEG files, e.g. frames clip_tool extract took from clips; synthetic VGA without
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "stream.h"
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "esp_timer.h"
+#include "img_converters.h"
+#include "host_util.h"
+
+#define DEFAULT_PORT 18094
+#define TIMEOUT_MS 5000
+#define FPS 10
+#define SECONDS 4
+#define MAX_PART (512 * 1024)
+#define SEQ_W 640
+#define SEQ_H 480
+#define SEQ_FRAMES 30
+
+static uint16_t port;
+
+typedef struct {
+    int frames;
+    size_t bytes;
+    int64_t worst_gap_us;       // longest time between two parts
+} received_t;
+
+// A still room with sensor noise, with an object crossing it in the motion sequence
+static bool WriteSequence(const char *dir, bool motion)
+{
+    uint8_t *rgb = malloc(SEQ_W * SEQ_H * 3);
+    uint32_t seed = 7;
+    bool ok = true;
+    for (int f = 0; f < SEQ_FRAMES && ok; f++) {
+        const int ox = 20 + f * (SEQ_W - 100) / SEQ_FRAMES;
+        for (int y = 0; y < SEQ_H; y++) {
+            for (int x = 0; x < SEQ_W; x++) {
+                const bool object = motion && x >= ox && x < ox + 64 && y >= 200 && y < 264;
+                const int v = object ? 30 : 70 + (((x / 9) * 5) ^ ((y / 7) * 3)) % 90 + y / 16;
+                uint8_t *p = &rgb[(y * SEQ_W + x) * 3];
+                for (int c = 0; c < 3; c++) {
+                    seed = seed * 1103515245 + 12345;
+                    const int n = v + (int)(seed >> 29) - 3 + c * 6;
+                    p[c] = n < 0 ? 0 : n > 255 ? 255 : n;
+                }
+            }
+        }
+        uint8_t *jpg = NULL;
+        size_t len = 0;
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%03d.jpg", dir, f);
+        FILE *file = NULL;
+        ok = fmt2jpg(rgb, SEQ_W * SEQ_H * 3, SEQ_W, SEQ_H, PIXFORMAT_RGB888, 70, &jpg, &len) &&
+             (file = fopen(path, "wb")) != NULL && fwrite(jpg, 1, len, file) == len;
+        if (file) {
+            fclose(file);
+        }
+        free(jpg);
+    }
+    free(rgb);
+    return ok;
+}
+
+static void RemoveSequence(const char *dir)
+{
+    char path[512];
+    for (int f = 0; f < SEQ_FRAMES; f++) {
+        snprintf(path, sizeof(path), "%s/%03d.jpg", dir, f);
+        unlink(path);
+    }
+    rmdir(dir);
+}
+
+// Parts of a stream for SECONDS
+static received_t Receive(const char *path)
+{
+    received_t r = { 0 };
+    stream_client_t c;
+    HOST_CHECK(StreamClientGet(&c, port, path, TIMEOUT_MS) && c.status == 200);
+    uint8_t *part = malloc(MAX_PART);
+    char headers[512];
+    const int64_t start = esp_timer_get_time();
+    int64_t last = start;
+    size_t len;
+    while (esp_timer_get_time() - start < SECONDS * 1000000LL &&
+           (len = StreamClientPart(&c, headers, sizeof(headers), part, MAX_PART)) > 0) {
+        const int64_t now = esp_timer_get_time();
+        r.worst_gap_us = now - last > r.worst_gap_us ? now - last : r.worst_gap_us;
+        last = now;
+        r.frames++;
+        r.bytes += len;
+    }
+    StreamClientClose(&c);
+    free(part);
+    return r;
+}
+
+static long JsonNumber(const char *body, const char *key)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char *p = strstr(body, pattern);
+    return p ? strtol(p + strlen(pattern), NULL, 10) : -1;
+}
+
+static long StatsNumber(const char *key)
+{
+    stream_client_t c;
+    char body[1024];
+    if (!StreamClientRequest(&c, port, "GET", "/stats", NULL, TIMEOUT_MS)) {
+        return -1;
+    }
+    const size_t n = StreamClientRead(&c, (uint8_t *)body, sizeof(body) - 1);
+    body[n] = 0;
+    StreamClientClose(&c);
+    return JsonNumber(body, key);
+}
+
+static void Report(const char *name, const received_t *r)
+{
+    printf("%-18s %3d frames %8.1f kB/s  longest gap %4lld ms\n", name, r->frames, r->bytes / 1024.0 / SECONDS,
+           (long long)(r->worst_gap_us / 1000));
+}
+
+static void CheckIdle(const char *dir)
+{
+    const stream_sim_config_t sim = { .jpeg_dir = dir, .fps = FPS, .jitter_us = 2000, .port = port, .seed = 11 };
+    HOST_CHECK(StreamSimStart(&sim) == ESP_OK);
+    const stream_skip_config_t config = STREAM_SKIP_DEFAULT_CONFIG();
+    StreamSetSkip(&config);
+
+    stream_skip_stats_t before, after;
+    StreamGetSkipStats(&before);
+    const received_t every = Receive("/stream?skip=0");
+    const received_t skipped = Receive("/stream");
+    StreamGetSkipStats(&after);
+    Report("idle, every frame", &every);
+    Report("idle, skipped", &skipped);
+
+    // a keep-alive per keepalive_ms, not much more
+    HOST_CHECK(every.frames >= SECONDS * FPS / 2);
+    HOST_CHECK(skipped.frames >= SECONDS - 1 && skipped.frames <= SECONDS * 1000 / (int)config.keepalive_ms + 2);
+    HOST_CHECK(skipped.worst_gap_us <= config.keepalive_ms * 1000LL + 3 * 1000000LL / FPS);
+    HOST_CHECK(skipped.bytes * 5 < every.bytes);
+    HOST_CHECK(after.skipped > before.skipped && after.keepalives > before.keepalives);
+    HOST_CHECK(StatsNumber("stream_skipped") == (long)after.skipped);
+    printf("idle: %.0f%% of the bytes, %u frames sampled, %u skipped, %u keep-alives\n",
+           100.0 * skipped.bytes / every.bytes, after.sampled - before.sampled, after.skipped - before.skipped,
+           after.keepalives - before.keepalives);
+
+    // coarse cells, sums of up to 255 x 24 x 24 a cell, still tell the idle frames apart from new ones
+    stream_skip_config_t coarse = config;
+    coarse.sample_step = 24;
+    StreamSetSkip(&coarse);
+    const received_t large = Receive("/stream");
+    Report("idle, cells of 24", &large);
+    HOST_CHECK(large.frames >= SECONDS - 1 && large.frames <= SECONDS * 1000 / (int)config.keepalive_ms + 2);
+
+    // threshold 0 sends them all again
+    stream_skip_config_t off = config;
+    off.threshold = 0;
+    StreamSetSkip(&off);
+    const received_t all = Receive("/stream");
+    Report("idle, threshold 0", &all);
+    HOST_CHECK(all.frames >= SECONDS * FPS / 2);
+    StreamSetSkip(&config);
+    StreamSimStop();
+}
+
+static void CheckMotion(const char *dir)
+{
+    const stream_sim_config_t sim = { .jpeg_dir = dir, .fps = FPS, .jitter_us = 2000, .port = port, .seed = 12 };
+    HOST_CHECK(StreamSimStart(&sim) == ESP_OK);
+
+    const received_t every = Receive("/stream?skip=0");
+    const received_t skipped = Receive("/stream");
+    Report("motion, every frame", &every);
+    Report("motion, skipped", &skipped);
+
+    // every frame differs, a frame or two may go at the wrap of the sequence
+    HOST_CHECK(skipped.frames * 10 >= every.frames * 9);
+    HOST_CHECK(skipped.worst_gap_us < 4 * 1000000LL / FPS);
+    StreamSimStop();
+}
+
+int main(int argc, char **argv)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    if (argc > 2) {
+        CheckIdle(argv[1]);
+        CheckMotion(argv[2]);
+    } else {
+        char idle[] = "/tmp/stream_skip_idle_XXXXXX";
+        char motion[] = "/tmp/stream_skip_motion_XXXXXX";
+        HOST_CHECK(mkdtemp(idle) && mkdtemp(motion) && WriteSequence(idle, false) && WriteSequence(motion, true));
+        CheckIdle(idle);
+        CheckMotion(motion);
+        RemoveSequence(idle);
+        RemoveSequence(motion);
+    }
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
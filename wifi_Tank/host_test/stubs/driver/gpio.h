@@ -0,0 +1,34 @@
+/*! \file gpio.h
+\brief Host stand-in for the GPIO driver, the power down and reset lines of
+the camera go nowhere.
+*****/
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int gpio_num_t;
+
+typedef enum {
+    GPIO_MODE_DISABLE = 0,
+    GPIO_MODE_INPUT,
+    GPIO_MODE_OUTPUT,
+} gpio_mode_t;
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+    int pull_up_en;
+    int pull_down_en;
+    int intr_type;
+} gpio_config_t;
+
+static inline esp_err_t gpio_config(const gpio_config_t *conf)
+{
+    return ESP_OK;
+}
+
+static inline esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    return ESP_OK;
+}
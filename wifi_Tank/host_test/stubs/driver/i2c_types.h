@@ -0,0 +1,21 @@
+/*! \file i2c_types.h
+\brief Host stand-in for the I2C types of the ESP-IDF master driver.
+*****/
+#pragma once
+
+#include <stdint.h>
+
+typedef int i2c_port_num_t;
+typedef struct host_i2c_bus *i2c_master_bus_handle_t;
+typedef struct host_i2c_dev *i2c_master_dev_handle_t;
+
+#define I2C_NUM_MAX 2
+
+typedef enum {
+    I2C_CLK_SRC_DEFAULT = 0,
+} i2c_clock_source_t;
+
+typedef enum {
+    I2C_ADDR_BIT_LEN_7 = 0,
+    I2C_ADDR_BIT_LEN_10,
+} i2c_addr_bit_len_t;
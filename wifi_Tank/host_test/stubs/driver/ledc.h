@@ -0,0 +1,12 @@
+/*! \file ledc.h
+\brief Host stand-in for the LEDC types referenced by camera_config_t.
+*****/
+#pragma once
+
+#include "esp_intr_alloc.h"
+
+typedef int ledc_timer_t;
+typedef int ledc_channel_t;
+
+#define LEDC_TIMER_0    0
+#define LEDC_CHANNEL_0  0
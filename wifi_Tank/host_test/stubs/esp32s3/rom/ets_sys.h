@@ -0,0 +1,8 @@
+/*! \file ets_sys.h
+\brief Host stand-in for the ROM printf.
+*****/
+#pragma once
+
+#include <stdio.h>
+
+#define ets_printf printf
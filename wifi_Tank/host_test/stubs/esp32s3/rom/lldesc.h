@@ -0,0 +1,18 @@
+/*! \file lldesc.h
+\brief Host stand-in for the DMA linked list descriptor. The link field is
+32 bits as on the target, so the host DMA model walks descriptors as an array.
+*****/
+#pragma once
+
+#include <stdint.h>
+
+typedef struct lldesc_s {
+    volatile uint32_t size  : 12,
+                      length: 12,
+                      offset: 5,
+                      sosf  : 1,
+                      eof   : 1,
+                      owner : 1;
+    volatile const uint8_t *buf;
+    volatile uint32_t empty;
+} lldesc_t;
@@ -0,0 +1,26 @@
+/*! \file esp_app_desc.h
+\brief Host stand-in for the application description, the fields the host
+builds read. host_util.c defines it; tests change the ELF hash to model a
+firmware update.
+*****/
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    char version[32];
+    char project_name[32];
+    uint8_t app_elf_sha256[32];
+} esp_app_desc_t;
+
+extern esp_app_desc_t host_app_desc;
+
+const esp_app_desc_t *esp_app_get_description(void);
+
+#ifdef __cplusplus
+}
+#endif
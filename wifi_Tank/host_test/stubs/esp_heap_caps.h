@@ -0,0 +1,28 @@
+/*! \file esp_heap_caps.h
+\brief Host stand-in for capability based allocation, backed by malloc.
+*****/
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MALLOC_CAP_DEFAULT  (1 << 12)
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+static inline void *heap_caps_malloc(size_t size, unsigned caps) { (void)caps; return malloc(size); }
+static inline void *heap_caps_calloc(size_t n, size_t size, unsigned caps) { (void)caps; return calloc(n, size); }
+static inline void heap_caps_free(void *ptr) { free(ptr); }
+static inline void *heap_caps_aligned_alloc(size_t align, size_t size, unsigned caps)
+{
+    (void)caps;
+    return aligned_alloc(align, (size + align - 1) / align * align);
+}
+static inline void *heap_caps_aligned_calloc(size_t align, size_t n, size_t size, unsigned caps)
+{
+    void *p = heap_caps_aligned_alloc(align, n * size, caps);
+    return p ? memset(p, 0, n * size) : NULL;
+}
+static inline size_t heap_caps_get_largest_free_block(unsigned caps) { (void)caps; return 0; }
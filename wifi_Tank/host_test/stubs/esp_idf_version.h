@@ -0,0 +1,10 @@
+/*! \file esp_idf_version.h
+\brief Host stand-in, the IDF release the project is built with.
+*****/
+#pragma once
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION_MAJOR   5
+#define ESP_IDF_VERSION_MINOR   5
+#define ESP_IDF_VERSION_PATCH   2
+#define ESP_IDF_VERSION ESP_IDF_VERSION_VAL(ESP_IDF_VERSION_MAJOR, ESP_IDF_VERSION_MINOR, ESP_IDF_VERSION_PATCH)
@@ -0,0 +1,6 @@
+/*! \file esp_intr_alloc.h
+\brief Host stand-in for the interrupt allocator types.
+*****/
+#pragma once
+
+typedef struct intr_handle_data_t *intr_handle_t;
@@ -0,0 +1,4 @@
+/*! \file i2c_platform.h
+\brief Host stand-in for the private I2C platform header, nothing in it is used.
+*****/
+#pragma once
@@ -0,0 +1,4 @@
+/*! \file esp_rom_caps.h
+\brief Host stand-in, the host build has no ROM.
+*****/
+#pragma once
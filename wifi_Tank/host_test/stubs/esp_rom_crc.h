@@ -0,0 +1,29 @@
+/*! \file esp_rom_crc.h
+\brief Host stand-in for the ROM CRC: CRC-32 as zlib computes it, chained
+through the first argument the way the ROM function is.
+*****/
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+static inline uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len)
+{
+    static uint32_t table[256];
+    static volatile bool ready;
+    if (!ready) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int b = 0; b < 8; b++) {
+                c = c >> 1 ^ (0xedb88320u & (0u - (c & 1)));
+            }
+            table[i] = c;
+        }
+        ready = true;
+    }
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc = table[(crc ^ buf[i]) & 0xff] ^ crc >> 8;
+    }
+    return ~crc;
+}
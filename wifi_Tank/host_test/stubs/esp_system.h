@@ -0,0 +1,10 @@
+/*! \file esp_system.h
+\brief Host stand-in: heap figures for the status endpoints, the host has none.
+*****/
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+static inline uint32_t esp_get_free_heap_size(void) { return 0; }
+static inline uint32_t esp_get_minimum_free_heap_size(void) { return 0; }
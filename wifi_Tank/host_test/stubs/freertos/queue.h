@@ -0,0 +1,33 @@
+/*! \file queue.h
+\brief Host stand-in for FreeRTOS queues, thread safe, implemented in
+host_freertos.c.
+*****/
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct host_queue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+void vQueueDelete(QueueHandle_t queue);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t wait);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *woken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t wait);
+BaseType_t xQueueReset(QueueHandle_t queue);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+
+#define xQueueSendToBack(q, item, wait) xQueueSend(q, item, wait)
+
+/**
+ * @brief Host only: block until the queue is empty and a task is waiting on it,
+ *        i.e. the receiving task has finished with everything sent so far
+ */
+void HostQueueWaitIdle(QueueHandle_t queue);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+/*! \file semphr.h
+\brief Host stand-in for FreeRTOS semaphores, built on the host queues as
+FreeRTOS does.
+*****/
+#pragma once
+
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    QueueHandle_t q = xQueueCreate(1, 0);
+    if (q) {
+        xQueueSend(q, NULL, 0);
+    }
+    return q;
+}
+
+#define xSemaphoreCreateBinary()        xQueueCreate(1, 0)
+#define xSemaphoreTake(sem, wait)       xQueueReceive(sem, NULL, wait)
+#define xSemaphoreGive(sem)             xQueueSend(sem, NULL, 0)
+#define vSemaphoreDelete(sem)           vQueueDelete(sem)
@@ -0,0 +1,41 @@
+/*! \file task.h
+\brief Host stand-in for FreeRTOS tasks, run as threads by host_freertos.c.
+Ticks are milliseconds.
+*****/
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define tskNO_AFFINITY  (-1)
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+
+/**
+ * @brief Host only: CPU time of all tasks so far, running or deleted, in
+ *        microseconds. Threads the host programs start themselves do not count.
+ */
+int64_t HostTaskCpuUs(void);
+
+/**
+ * @brief Host only: stack the running tasks asked for, in bytes
+ * @param count Output, number of running tasks, or NULL
+ */
+size_t HostTaskStackBytes(int *count);
+
+#define xTaskCreate(fn, name, stack, arg, prio, handle) \
+    xTaskCreatePinnedToCore(fn, name, stack, arg, prio, handle, tskNO_AFFINITY)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,13 @@
+/*! \file cache_hal.h
+\brief Host stand-in for the cache HAL.
+*****/
+#pragma once
+
+#include <stdint.h>
+#include "hal/cache_ll.h"
+
+static inline uint32_t cache_hal_get_cache_line_size(int level, int type)
+{
+    (void)level; (void)type;
+    return 32;
+}
@@ -0,0 +1,7 @@
+/*! \file cache_ll.h
+\brief Host stand-in for the cache LL constants.
+*****/
+#pragma once
+
+#define CACHE_LL_LEVEL_EXT_MEM  2
+#define CACHE_TYPE_DATA         0
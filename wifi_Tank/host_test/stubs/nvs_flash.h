@@ -0,0 +1,6 @@
+/*! \file nvs_flash.h
+\brief Host stand-in, the NVS partition of nvs_sim.c needs no init.
+*****/
+#pragma once
+
+#include "nvs.h"
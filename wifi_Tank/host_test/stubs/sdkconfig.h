@@ -0,0 +1,33 @@
+/*! \file sdkconfig.h
+\brief Host build configuration. Mirrors the project sdkconfig where the
+host build compiles the same code, and selects the non-ROM decoder.
+*****/
+#pragma once
+
+// esp_jpeg: host build compiles tjpgd from source
+#define CONFIG_JD_USE_ROM 0
+#define CONFIG_JD_SZBUF 512
+#define CONFIG_JD_FORMAT 0
+#define CONFIG_JD_USE_SCALE 1
+#define CONFIG_JD_TBLCLIP 1
+#ifndef CONFIG_JD_FASTDECODE     // tjpgd_accel_test builds a second copy at level 2
+#define CONFIG_JD_FASTDECODE 3
+#endif
+#define CONFIG_JD_DEFAULT_HUFFMAN 1
+
+// esp32-camera
+#define CONFIG_OV3660_SUPPORT 1
+#define CONFIG_OV2640_SUPPORT 1
+#define CONFIG_CAMERA_JPEG_MODE_FRAME_SIZE_AUTO 1
+#define CONFIG_CAMERA_DMA_BUFFER_SIZE_MAX 32768
+#define CONFIG_SCCB_HARDWARE_I2C_PORT1 1
+#define CONFIG_SCCB_CLK_FREQ 100000
+
+// lwip / httpd
+#define CONFIG_LWIP_MAX_SOCKETS 16
+#define CONFIG_HTTPD_MAX_REQ_HDR_LEN 1024
+#define CONFIG_HTTPD_MAX_URI_LEN 512
+#define CONFIG_HTTPD_WS_SUPPORT 1
+
+// FreeRTOS
+#define CONFIG_FREERTOS_HZ 1000
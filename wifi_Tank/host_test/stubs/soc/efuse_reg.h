@@ -0,0 +1,4 @@
+/*! \file efuse_reg.h
+\brief Host stand-in, nothing needed by the host build.
+*****/
+#pragma once
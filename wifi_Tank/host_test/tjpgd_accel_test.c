@@ -0,0 +1,424 @@
+/*! \file tjpgd_accel_test.c
+\brief Bit exactness of the accelerated tjpgd level (JD_FASTDECODE 3) against
+the table decoder it extends (JD_FASTDECODE 2). Decodes the esp_jpeg test images
+and camera style jpge frames over the whole quality range, at every scale.
+The same images coded again with restart intervals (DRI, RSTn markers) decode,
+and give the DC map of jd_decomp_dc(), exactly as they did without.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "tjpgd_ref.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define CAM_W 160
+#define CAM_H 120
+
+static int compared;
+static int restarted;
+
+static void Compare(const char *name, const uint8_t *jpg, size_t len)
+{
+    for (uint8_t scale = 0; scale <= 3; scale++) {
+        unsigned int rw = 0, rh = 0, aw = 0, ah = 0;
+        uint8_t *ref = TjpgdHostDecode(&tjpgd_ref, jpg, len, scale, &rw, &rh);
+        uint8_t *acc = TjpgdHostDecode(&tjpgd_accel, jpg, len, scale, &aw, &ah);
+        HOST_CHECK(ref != NULL && acc != NULL);
+        if (ref && acc) {
+            HOST_CHECK(rw == aw && rh == ah);
+            const int same = memcmp(ref, acc, (size_t)rw * rh * 3) == 0;
+            if (!same) {
+                printf("%s, scale 1/%d differs\n", name, 1 << scale);
+            }
+            HOST_CHECK(same);
+            compared++;
+        }
+        free(ref);
+        free(acc);
+    }
+}
+
+typedef struct {
+    uint16_t code[256];         // code of each symbol
+    uint8_t size[256];          // its length, 0 for none
+    int32_t maxcode[17];        // largest code of each length, -1 for none
+    int32_t delta[17];          // vals index of a code of each length, less the code
+    uint8_t vals[256];
+} huff_t;
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint32_t bits;
+    int count;
+    uint8_t *out;
+    size_t len;
+    uint32_t obits;
+    int ocount;
+} recode_t;
+
+static void HuffBuild(huff_t *h, const uint8_t *bits, const uint8_t *vals)
+{
+    int k = 0, code = 0;
+    memset(h, 0, sizeof(*h));
+    for (int l = 1; l <= 16; l++, code <<= 1) {
+        h->delta[l] = k - code;
+        h->maxcode[l] = bits[l - 1] ? code + bits[l - 1] - 1 : -1;
+        for (int i = 0; i < bits[l - 1]; i++, k++, code++) {
+            h->vals[k] = vals[k];
+            h->code[vals[k]] = code;
+            h->size[vals[k]] = l;
+        }
+    }
+}
+
+static int GetBit(recode_t *r)
+{
+    if (r->count == 0) {
+        const uint8_t b = r->p < r->end ? *r->p++ : 0;
+        if (b == 0xff && r->p < r->end && *r->p == 0) {
+            r->p++;
+        }
+        r->bits = b;
+        r->count = 8;
+    }
+    return (r->bits >> --r->count) & 1;
+}
+
+static int GetBits(recode_t *r, int n)
+{
+    int v = 0;
+    while (n--) {
+        v = v << 1 | GetBit(r);
+    }
+    return v;
+}
+
+static int GetSymbol(recode_t *r, const huff_t *h)
+{
+    int32_t code = 0;
+    for (int l = 1; l <= 16; l++) {
+        code = code << 1 | GetBit(r);
+        if (code <= h->maxcode[l]) {
+            return h->vals[h->delta[l] + code];
+        }
+    }
+    return -1;
+}
+
+static void PutBits(recode_t *r, uint32_t v, int n)
+{
+    while (n--) {
+        r->obits = r->obits << 1 | ((v >> n) & 1);
+        if (++r->ocount == 8) {
+            r->out[r->len++] = (uint8_t)r->obits;
+            if ((r->obits & 0xff) == 0xff) {
+                r->out[r->len++] = 0;
+            }
+            r->obits = 0;
+            r->ocount = 0;
+        }
+    }
+}
+
+static void PutPad(recode_t *r)
+{
+    if (r->ocount) {
+        PutBits(r, 0xff, 8 - r->ocount);
+    }
+}
+
+// Annex K tables in esp_jpeg
+extern const unsigned char esp_jpeg_lum_dc_num_bits[], esp_jpeg_lum_dc_values[];
+extern const unsigned char esp_jpeg_chrom_dc_num_bits[], esp_jpeg_chrom_dc_values[];
+extern const unsigned char esp_jpeg_lum_ac_num_bits[], esp_jpeg_lum_ac_values[];
+extern const unsigned char esp_jpeg_chrom_ac_num_bits[], esp_jpeg_chrom_ac_values[];
+extern const unsigned esp_jpeg_lum_dc_codes_total, esp_jpeg_lum_ac_codes_total;
+extern const unsigned esp_jpeg_chrom_dc_codes_total, esp_jpeg_chrom_ac_codes_total;
+
+static void PutTable(recode_t *r, uint8_t tc_th, const uint8_t *bits, const uint8_t *vals, unsigned int n)
+{
+    r->out[r->len++] = tc_th;
+    memcpy(r->out + r->len, bits, 16);
+    memcpy(r->out + r->len + 16, vals, n);
+    r->len += 16 + n;
+}
+
+/*
+ * Code a baseline JPEG again with a restart interval of the given MCUs. The AC
+ * coefficients go out with their own codes; the DC differences, which change
+ * where the prediction restarts, with the Annex K tables that have a code for
+ * every size.
+ */
+static uint8_t *AddRestarts(const uint8_t *jpg, size_t len, int interval, size_t *out_len)
+{
+    huff_t *dc = calloc(2, sizeof(huff_t)), *ac = calloc(4, sizeof(huff_t)), *src_dc = calloc(4, sizeof(huff_t));
+    int width = 0, height = 0, ncomp = 0, hmax = 1, vmax = 1, src_interval = 0;
+    int ch[3] = { 0 }, cv[3] = { 0 }, ctd[3] = { 0 }, cta[3] = { 0 };
+    bool dht = false;
+    recode_t r = { .out = malloc(len * 3 + 64 * 1024) };     // DC codes and markers, plenty for a test image
+    HuffBuild(&dc[0], esp_jpeg_lum_dc_num_bits, esp_jpeg_lum_dc_values);
+    HuffBuild(&dc[1], esp_jpeg_chrom_dc_num_bits, esp_jpeg_chrom_dc_values);
+    memcpy(src_dc, dc, 2 * sizeof(huff_t));     // frames without DHT (MJPEG from USB cameras)
+    HuffBuild(&ac[0], esp_jpeg_lum_ac_num_bits, esp_jpeg_lum_ac_values);
+    HuffBuild(&ac[1], esp_jpeg_chrom_ac_num_bits, esp_jpeg_chrom_ac_values);
+
+    // segments up to the scan, the DC tables left out and replaced
+    const uint8_t *p = jpg + 2, *end = jpg + len;
+    memcpy(r.out, jpg, 2);
+    r.len = 2;
+    while (p + 4 <= end && p[0] == 0xff && p[1] != 0xda) {
+        const int seg = p[2] << 8 | p[3];
+        const uint8_t *s = p + 4, *s_end = p + 2 + seg;
+        if (p[1] == 0xc4) {
+            const size_t at = r.len;
+            memcpy(r.out + r.len, p, 4);
+            r.len += 4;
+            while (s < s_end) {
+                int n = 0;
+                for (int i = 0; i < 16; i++) {
+                    n += s[1 + i];
+                }
+                HuffBuild(&((s[0] >> 4) ? ac : src_dc)[s[0] & 3], s + 1, s + 17);
+                if (s[0] >> 4) {
+                    memcpy(r.out + r.len, s, 17 + n);
+                    r.len += 17 + n;
+                }
+                s += 17 + n;
+            }
+            r.out[at + 2] = (uint8_t)((r.len - at - 2) >> 8);
+            r.out[at + 3] = (uint8_t)(r.len - at - 2);
+            if (r.len == at + 4) {
+                r.len = at;         // DC tables only
+            }
+            dht = true;
+        } else {
+            if (p[1] == 0xc0) {
+                height = s[1] << 8 | s[2];
+                width = s[3] << 8 | s[4];
+                ncomp = s[5];
+                for (int c = 0; c < ncomp; c++) {
+                    ch[c] = s[7 + c * 3] >> 4;
+                    cv[c] = s[7 + c * 3] & 15;
+                    hmax = ch[c] > hmax ? ch[c] : hmax;
+                    vmax = cv[c] > vmax ? cv[c] : vmax;
+                }
+            } else if (p[1] == 0xdd) {
+                src_interval = s[0] << 8 | s[1];
+            }
+            if (p[1] != 0xdd) {
+                memcpy(r.out + r.len, p, 2 + seg);
+                r.len += 2 + seg;
+            }
+        }
+        p = s_end;
+        while (p + 1 < end && p[0] == 0xff && p[1] == 0xff) {
+            p++;                // fill bytes before a marker
+        }
+    }
+    if (p + 4 > end || p[1] != 0xda || ncomp == 0) {
+        free(dc), free(ac), free(src_dc), free(r.out);
+        return NULL;
+    }
+    const size_t at = r.len;
+    r.out[r.len++] = 0xff;
+    r.out[r.len++] = 0xc4;
+    r.len += 2;
+    PutTable(&r, 0x00, esp_jpeg_lum_dc_num_bits, esp_jpeg_lum_dc_values, esp_jpeg_lum_dc_codes_total);
+    PutTable(&r, 0x01, esp_jpeg_chrom_dc_num_bits, esp_jpeg_chrom_dc_values, esp_jpeg_chrom_dc_codes_total);
+    if (!dht) {
+        PutTable(&r, 0x10, esp_jpeg_lum_ac_num_bits, esp_jpeg_lum_ac_values, esp_jpeg_lum_ac_codes_total);
+        PutTable(&r, 0x11, esp_jpeg_chrom_ac_num_bits, esp_jpeg_chrom_ac_values, esp_jpeg_chrom_ac_codes_total);
+    }
+    r.out[at + 2] = (uint8_t)((r.len - at - 2) >> 8);
+    r.out[at + 3] = (uint8_t)(r.len - at - 2);
+    const uint8_t dri[] = { 0xff, 0xdd, 0, 4, (uint8_t)(interval >> 8), (uint8_t)interval };
+    memcpy(r.out + r.len, dri, sizeof(dri));
+    r.len += sizeof(dri);
+    const int seg = p[2] << 8 | p[3];
+    for (int c = 0; c < ncomp; c++) {
+        ctd[c] = p[6 + c * 2] >> 4;
+        cta[c] = p[6 + c * 2] & 15;
+    }
+    memcpy(r.out + r.len, p, 2 + seg);
+    r.len += 2 + seg;
+    r.p = p + 2 + seg;
+    r.end = end;
+
+    // the scan, MCU by MCU
+    const int mcus = ncomp == 1 ? ((width + 7) / 8) * ((height + 7) / 8)
+                     : ((width + hmax * 8 - 1) / (hmax * 8)) * ((height + vmax * 8 - 1) / (vmax * 8));
+    int src_pred[3] = { 0 }, pred[3] = { 0 };
+    bool ok = true;
+    for (int m = 0; m < mcus && ok; m++) {
+        if (src_interval && m && m % src_interval == 0) {
+            r.count = 0;
+            while (r.p + 1 < r.end && r.p[0] == 0xff && r.p[1] == 0) {
+                r.p += 2;       // a whole padding byte, stuffed
+            }
+            r.p += 2;
+            memset(src_pred, 0, sizeof(src_pred));
+        }
+        if (m && m % interval == 0) {
+            PutPad(&r);
+            r.out[r.len++] = 0xff;
+            r.out[r.len++] = (uint8_t)(0xd0 + (m / interval - 1) % 8);
+            memset(pred, 0, sizeof(pred));
+        }
+        for (int c = 0; c < ncomp && ok; c++) {
+            const int blocks = ncomp == 1 ? 1 : ch[c] * cv[c];
+            for (int b = 0; b < blocks && ok; b++) {
+                const int t = GetSymbol(&r, &src_dc[ctd[c]]);
+                ok = t >= 0;
+                int diff = t > 0 ? GetBits(&r, t) : 0;
+                if (t > 0 && diff < 1 << (t - 1)) {
+                    diff -= (1 << t) - 1;
+                }
+                src_pred[c] += diff;
+                diff = src_pred[c] - pred[c];
+                pred[c] = src_pred[c];
+                int size = 0;
+                while (abs(diff) >> size) {
+                    size++;
+                }
+                PutBits(&r, dc[ctd[c] & 1].code[size], dc[ctd[c] & 1].size[size]);
+                PutBits(&r, diff < 0 ? diff - 1 : diff, size);
+                for (int k = 1; k < 64 && ok;) {
+                    const huff_t *h = &ac[cta[c]];
+                    const int rs = GetSymbol(&r, h);
+                    ok = rs >= 0;
+                    if (!ok) {
+                        break;
+                    }
+                    PutBits(&r, h->code[rs], h->size[rs]);
+                    if ((rs & 15) == 0 && rs != 0xf0) {
+                        break;
+                    }
+                    PutBits(&r, GetBits(&r, rs & 15), rs & 15);
+                    k += (rs >> 4) + 1;
+                }
+            }
+        }
+    }
+    PutPad(&r);
+    r.out[r.len++] = 0xff;
+    r.out[r.len++] = 0xd9;
+    free(dc), free(ac), free(src_dc);
+    if (!ok) {
+        free(r.out);
+        return NULL;
+    }
+    *out_len = r.len;
+    return r.out;
+}
+
+// The source with restart intervals, against the decodes and DC maps of the source
+static void CompareRestarts(const char *name, const uint8_t *jpg, size_t len)
+{
+    static const int intervals[] = { 1, 3, 7, 40 };
+    for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+        size_t rst_len = 0;
+        uint8_t *rst = AddRestarts(jpg, len, intervals[i], &rst_len);
+        HOST_CHECK(rst != NULL);
+        if (rst == NULL) {
+            continue;
+        }
+        char label[96];
+        snprintf(label, sizeof(label), "%s, restart interval %d", name, intervals[i]);
+        Compare(label, rst, rst_len);
+        for (uint8_t scale = 0; scale <= 3; scale++) {
+            unsigned int sw = 0, sh = 0, rw = 0, rh = 0;
+            uint8_t *src = TjpgdHostDecode(&tjpgd_ref, jpg, len, scale, &sw, &sh);
+            uint8_t *acc = TjpgdHostDecode(&tjpgd_accel, rst, rst_len, scale, &rw, &rh);
+            HOST_CHECK(src && acc && sw == rw && sh == rh && memcmp(src, acc, (size_t)sw * sh * 3) == 0);
+            free(src);
+            free(acc);
+        }
+        unsigned int sw = 0, sh = 0, rw = 0, rh = 0, aw = 0, ah = 0;
+        uint8_t *src = TjpgdHostDcMap(&tjpgd_ref, jpg, len, &sw, &sh);
+        uint8_t *ref = TjpgdHostDcMap(&tjpgd_ref, rst, rst_len, &rw, &rh);
+        uint8_t *acc = TjpgdHostDcMap(&tjpgd_accel, rst, rst_len, &aw, &ah);
+        const int same = src && ref && acc && sw == rw && sh == rh && sw == aw && sh == ah &&
+                         memcmp(src, ref, (size_t)sw * sh) == 0 && memcmp(src, acc, (size_t)sw * sh) == 0;
+        if (!same) {
+            printf("%s, DC map differs\n", label);
+        }
+        HOST_CHECK(same);
+        free(src);
+        free(ref);
+        free(acc);
+        free(rst);
+        restarted++;
+    }
+}
+
+static void CompareFile(const char *file)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, file);
+    size_t len = 0;
+    uint8_t *jpg = HostReadFile(path, &len);
+    HOST_CHECK(jpg != NULL);
+    if (jpg) {
+        Compare(file, jpg, len);
+        CompareRestarts(file, jpg, len);
+        free(jpg);
+    }
+}
+
+// Encode with the camera's own encoder and compare, covers H2V2 and Y only images
+static void CompareEncoded(const char *name, const uint8_t *pix, int w, int h, pixformat_t format, int quality)
+{
+    uint8_t *jpg = NULL;
+    size_t len = 0;
+    const size_t pix_len = (size_t)w * h * (format == PIXFORMAT_GRAYSCALE ? 1 : 3);
+    HOST_CHECK(fmt2jpg((uint8_t *)pix, pix_len, w, h, format, quality, &jpg, &len));
+    if (jpg) {
+        char label[64];
+        snprintf(label, sizeof(label), "%s q%d", name, quality);
+        Compare(label, jpg, len);
+        if (quality % 25 == 0) {
+            CompareRestarts(label, jpg, len);
+        }
+        free(jpg);
+    }
+}
+
+int main(void)
+{
+    CompareFile("usb_camera.jpg");
+    CompareFile("usb_camera_2.jpg");
+    CompareFile("logo.jpg");
+
+    // Camera frame as BGR and Y, plus noise which needs Huffman codes longer than the lookup tables
+    uint8_t *bgr = malloc(CAM_W * CAM_H * 3), *gray = malloc(CAM_W * CAM_H), *noise = malloc(CAM_W * CAM_H * 3);
+    uint32_t seed = 1;
+    for (int i = 0; i < CAM_W * CAM_H; i++) {
+        const unsigned int word = jpeg_no_huffman_rgb888[i];
+        bgr[i * 3 + 0] = (word >> 16) & 0xff;
+        bgr[i * 3 + 1] = (word >> 8) & 0xff;
+        bgr[i * 3 + 2] = word & 0xff;
+        gray[i] = (bgr[i * 3 + 0] + 2 * bgr[i * 3 + 1] + bgr[i * 3 + 2]) / 4;
+        for (int c = 0; c < 3; c++) {
+            seed = seed * 1103515245 + 12345;
+            noise[i * 3 + c] = seed >> 24;
+        }
+    }
+
+    static const int qualities[] = { 1, 5, 10, 25, 50, 75, 90, 95, 100 };
+    for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+        CompareEncoded("camera", bgr, CAM_W, CAM_H, PIXFORMAT_RGB888, qualities[q]);
+        CompareEncoded("camera Y", gray, CAM_W, CAM_H, PIXFORMAT_GRAYSCALE, qualities[q]);
+        CompareEncoded("noise", noise, CAM_W, CAM_H, PIXFORMAT_RGB888, qualities[q]);
+    }
+    free(bgr);
+    free(gray);
+    free(noise);
+
+    printf("%d decodes compared, %d with restart intervals, %s\n", compared, restarted,
+           host_failures ? "FAILED" : "bit exact");
+    return host_failures ? 1 : 0;
+}
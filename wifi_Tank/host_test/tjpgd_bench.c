@@ -0,0 +1,85 @@
+/*! \file tjpgd_bench.c
+\brief tjpgd decode time, table decoder (JD_FASTDECODE 2) against the
+accelerated level (JD_FASTDECODE 3), over the esp_jpeg test images and a VGA
+camera style frame from the jpge encoder.
+
+Usage: tjpgd_bench [iterations]
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "img_converters.h"
+#include "tjpgd_ref.h"
+#include "host_util.h"
+
+#include "test_usb_camera_rgb888.h"
+
+#define VGA_W 640
+#define VGA_H 480
+
+static double TimeDecode(const tjpgd_impl_t *impl, const uint8_t *jpg, size_t len, uint8_t scale, int iterations)
+{
+    unsigned int w, h;
+    const int64_t start = HostTimeUs();
+    for (int i = 0; i < iterations; i++) {
+        free(TjpgdHostDecode(impl, jpg, len, scale, &w, &h));
+    }
+    return (HostTimeUs() - start) / 1000.0 / iterations;
+}
+
+static void Bench(const char *name, const uint8_t *jpg, size_t len, int iterations)
+{
+    for (uint8_t scale = 0; scale <= 3; scale += 3) {
+        const double ref = TimeDecode(&tjpgd_ref, jpg, len, scale, iterations);
+        const double acc = TimeDecode(&tjpgd_accel, jpg, len, scale, iterations);
+        printf("%-16s 1/%d %9.3f %9.3f %7.2fx\n", name, 1 << scale, ref, acc, ref / acc);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? atoi(argv[1]) : 200;
+
+    printf("%d iterations, ms per decode\n", iterations);
+    printf("%-16s %3s %9s %9s %8s\n", "image", "", "level 2", "level 3", "speedup");
+
+    static const char *files[] = { "usb_camera.jpg", "usb_camera_2.jpg", "logo.jpg" };
+    for (size_t i = 0; i < sizeof(files) / sizeof(files[0]); i++) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", JPEG_TEST_DIR, files[i]);
+        size_t len = 0;
+        uint8_t *jpg = HostReadFile(path, &len);
+        if (jpg) {
+            Bench(files[i], jpg, len, iterations);
+            free(jpg);
+        }
+    }
+
+    // VGA frame: the usb_camera reference scaled up 4x with some sensor noise, BGR as the camera stores it
+    uint8_t *bgr = malloc(VGA_W * VGA_H * 3);
+    uint32_t seed = 1;
+    for (int y = 0; y < VGA_H; y++) {
+        for (int x = 0; x < VGA_W; x++) {
+            const unsigned int word = jpeg_no_huffman_rgb888[(y / 4) * 160 + x / 4];
+            uint8_t *p = bgr + (y * VGA_W + x) * 3;
+            for (int c = 0; c < 3; c++) {
+                seed = seed * 1103515245 + 12345;
+                const int v = (int)((word >> (16 - 8 * c)) & 0xff) + (int)(seed >> 29) - 4;
+                p[c] = v < 0 ? 0 : v > 255 ? 255 : v;
+            }
+        }
+    }
+    static const int qualities[] = { 50, 80, 95 };
+    for (size_t q = 0; q < sizeof(qualities) / sizeof(qualities[0]); q++) {
+        uint8_t *jpg = NULL;
+        size_t len = 0;
+        if (fmt2jpg(bgr, VGA_W * VGA_H * 3, VGA_W, VGA_H, PIXFORMAT_RGB888, qualities[q], &jpg, &len)) {
+            char name[32];
+            snprintf(name, sizeof(name), "VGA q%d", qualities[q]);
+            Bench(name, jpg, len, iterations / 20 > 0 ? iterations / 20 : 1);
+            free(jpg);
+        }
+    }
+    free(bgr);
+    return 0;
+}
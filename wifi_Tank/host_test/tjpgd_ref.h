@@ -0,0 +1,127 @@
+/*! \file tjpgd_ref.h
+\brief Two tjpgd builds side by side: the host configuration (accelerated,
+JD_FASTDECODE 3) and a reference copy at JD_FASTDECODE 2 with its entry points
+renamed to ref_jd_*. Both levels share the same JDEC layout.
+*****/
+#ifndef TJPGD_REF_H
+#define TJPGD_REF_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "tjpgd.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+JRESULT ref_jd_prepare(JDEC *jd, size_t (*infunc)(JDEC *, uint8_t *, size_t), void *pool, size_t sz_pool, void *dev);
+JRESULT ref_jd_decomp(JDEC *jd, int (*outfunc)(JDEC *, void *, JRECT *), uint8_t scale);
+JRESULT ref_jd_decomp_dc(JDEC *jd, uint8_t *ymap, unsigned int stride);
+
+typedef struct {
+    const char *name;
+    JRESULT (*prepare)(JDEC *, size_t (*)(JDEC *, uint8_t *, size_t), void *, size_t, void *);
+    JRESULT (*decomp)(JDEC *, int (*)(JDEC *, void *, JRECT *), uint8_t);
+    JRESULT (*decomp_dc)(JDEC *, uint8_t *, unsigned int);
+} tjpgd_impl_t;
+
+static const tjpgd_impl_t tjpgd_ref = { "level 2", ref_jd_prepare, ref_jd_decomp, ref_jd_decomp_dc };
+static const tjpgd_impl_t tjpgd_accel = { "level 3", jd_prepare, jd_decomp, jd_decomp_dc };
+
+typedef struct {
+    const uint8_t *jpg;
+    size_t len;
+    size_t pos;
+    uint8_t *out;       // RGB888, out_width pixels per row
+    unsigned int out_width;
+} tjpgd_host_io_t;
+
+static size_t TjpgdHostIn(JDEC *jd, uint8_t *buf, size_t n)
+{
+    tjpgd_host_io_t *io = (tjpgd_host_io_t *)jd->device;
+    if (n > io->len - io->pos) {
+        n = io->len - io->pos;
+    }
+    if (buf) {
+        memcpy(buf, io->jpg + io->pos, n);
+    }
+    io->pos += n;
+    return n;
+}
+
+static int TjpgdHostOut(JDEC *jd, void *bitmap, JRECT *rect)
+{
+    tjpgd_host_io_t *io = (tjpgd_host_io_t *)jd->device;
+    const unsigned int w = (rect->right - rect->left + 1) * 3;
+    const uint8_t *src = (const uint8_t *)bitmap;
+    for (unsigned int y = rect->top; y <= rect->bottom; y++, src += w) {
+        memcpy(io->out + (y * io->out_width + rect->left) * 3, src, w);
+    }
+    return 1;
+}
+
+/**
+ * @brief Decode a JPEG to RGB888 with one of the tjpgd builds
+ * @param impl Decoder build
+ * @param jpg JPEG data
+ * @param len JPEG length
+ * @param scale tjpgd scale, 0..3
+ * @param width Output, scaled width
+ * @param height Output, scaled height
+ * @return Buffer to be freed by the caller, NULL on failure
+ */
+static uint8_t *TjpgdHostDecode(const tjpgd_impl_t *impl, const uint8_t *jpg, size_t len, uint8_t scale,
+                                unsigned int *width, unsigned int *height)
+{
+    static uint8_t pool[65472];
+    JDEC jd;
+    tjpgd_host_io_t io = { jpg, len, 0, NULL, 0 };
+
+    if (impl->prepare(&jd, TjpgdHostIn, pool, sizeof(pool), &io) != JDR_OK) {
+        return NULL;
+    }
+    io.out_width = jd.width >> scale;
+    *width = jd.width >> scale;
+    *height = jd.height >> scale;
+    io.out = (uint8_t *)calloc((size_t)*width * *height * 3 + 1, 1);
+    if (impl->decomp(&jd, TjpgdHostOut, scale) != JDR_OK) {
+        free(io.out);
+        return NULL;
+    }
+    return io.out;
+}
+
+/**
+ * @brief DC luma map of a JPEG with one of the tjpgd builds
+ * @param impl Decoder build
+ * @param jpg JPEG data
+ * @param len JPEG length
+ * @param width Output, map width, a byte per 8x8 block
+ * @param height Output, map height
+ * @return Buffer to be freed by the caller, NULL on failure
+ */
+static uint8_t *TjpgdHostDcMap(const tjpgd_impl_t *impl, const uint8_t *jpg, size_t len, unsigned int *width,
+                               unsigned int *height)
+{
+    static uint8_t pool[65472];
+    JDEC jd;
+    tjpgd_host_io_t io = { jpg, len, 0, NULL, 0 };
+
+    if (impl->prepare(&jd, TjpgdHostIn, pool, sizeof(pool), &io) != JDR_OK) {
+        return NULL;
+    }
+    *width = (jd.width + 7) / 8;
+    *height = (jd.height + 7) / 8;
+    uint8_t *map = (uint8_t *)calloc((size_t)*width * *height, 1);
+    if (impl->decomp_dc(&jd, map, *width) != JDR_OK) {
+        free(map);
+        return NULL;
+    }
+    return map;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,197 @@
+/*! \file web_assets_test.c
+\brief The web asset table web_assets.py generates (main/web_assets.h)
+against the files of main/web_assets.cmake: gzip streams without time stamp
+that inflate to the files (with zlib; without it only the length trailer is
+checked), one strong ETag each. Then the pages from the host streaming stack
+(stream_sim.c): compressed with their ETag and Cache-Control, 304 for a
+matching If-None-Match. Prints the bytes a load and a reload of each page
+costs, against the uncompressed pages sent before.
+*****/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stream_sim.h"
+#include "stream_client.h"
+#include "web_assets.h"
+#include "host_util.h"
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#define DEFAULT_PORT 18086
+#define TIMEOUT_MS 5000
+#define FPS 5
+#define MAX_REVALIDATE 512      // bytes of a 304 answer, head only
+
+// main/web_assets.cmake
+static const struct {
+    const char *uri;
+    const char *type;
+    const char *file;
+} expected[] = {
+    { "/", "text/html", "overlay_demo.html" },
+    { "/player", "text/html", "player.html" },
+    { "/player_worker.js", "text/javascript", "player_worker.js" },
+};
+#define ASSETS (sizeof(expected) / sizeof(expected[0]))
+
+// What a browser loads for a page
+static const char *loads[][3] = {
+    { "/", NULL },
+    { "/player", "/player_worker.js", NULL },
+};
+
+static uint16_t port;
+
+static const web_asset_t *Find(const char *uri)
+{
+    for (size_t i = 0; i < web_assets_count; i++) {
+        if (strcmp(web_assets[i].uri, uri) == 0) {
+            return &web_assets[i];
+        }
+    }
+    return NULL;
+}
+
+static uint32_t Le32(const uint8_t *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static void CheckTable(void)
+{
+    HOST_CHECK(web_assets_count == ASSETS);
+    for (size_t i = 0; i < ASSETS; i++) {
+        const web_asset_t *asset = Find(expected[i].uri);
+        HOST_CHECK(asset != NULL);
+        if (!asset) {
+            continue;
+        }
+        HOST_CHECK(strcmp(asset->type, expected[i].type) == 0);
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", PROJECT_ROOT, expected[i].file);
+        size_t len = 0;
+        uint8_t *file = HostReadFile(path, &len);
+        HOST_CHECK(file != NULL && asset->len == len);
+
+        // gzip member: magic, deflate, no flags, no time stamp, ISIZE trailer
+        const uint8_t *gz = asset->gzip;
+        HOST_CHECK(asset->gzip_len > 18 && gz[0] == 0x1f && gz[1] == 0x8b && gz[2] == 8 && gz[3] == 0);
+        HOST_CHECK(Le32(gz + 4) == 0);
+        HOST_CHECK(Le32(gz + asset->gzip_len - 4) == len);
+        HOST_CHECK(asset->gzip_len < len / 2);
+#ifdef HAVE_ZLIB
+        uint8_t *out = malloc(len + 1);
+        z_stream z = { .next_in = (Bytef *)gz, .avail_in = asset->gzip_len, .next_out = out, .avail_out = len + 1 };
+        HOST_CHECK(inflateInit2(&z, 16 + MAX_WBITS) == Z_OK);
+        HOST_CHECK(inflate(&z, Z_FINISH) == Z_STREAM_END && z.total_out == len);
+        HOST_CHECK(file && memcmp(out, file, len) == 0);
+        inflateEnd(&z);
+        free(out);
+#endif
+        free(file);
+
+        // "<16 hex digits>", none shared
+        const size_t n = strlen(asset->etag);
+        HOST_CHECK(n == 18 && asset->etag[0] == '"' && asset->etag[n - 1] == '"'
+                   && strspn(asset->etag + 1, "0123456789abcdef") == 16);
+        for (size_t j = 0; j < web_assets_count; j++) {
+            HOST_CHECK(&web_assets[j] == asset || strcmp(web_assets[j].etag, asset->etag) != 0);
+        }
+    }
+}
+
+// One request: status and bytes received
+static int Get(const char *uri, const char *if_none_match, size_t *received, stream_client_t *c)
+{
+    char headers[256] = "";
+    if (if_none_match) {
+        snprintf(headers, sizeof(headers), "If-None-Match: %s\r\n", if_none_match);
+    }
+    if (!StreamClientGetHeaders(c, port, uri, headers, TIMEOUT_MS)) {
+        return 0;
+    }
+    uint8_t buf[4096];
+    while (StreamClientRead(c, buf, sizeof(buf)) == sizeof(buf)) {
+    }
+    *received = c->received;
+    return c->status;
+}
+
+static void CheckServer(void)
+{
+    for (size_t i = 0; i < web_assets_count; i++) {
+        const web_asset_t *asset = &web_assets[i];
+        stream_client_t c;
+        char value[64] = "";
+        size_t received;
+
+        HOST_CHECK(Get(asset->uri, NULL, &received, &c) == 200);
+        HOST_CHECK(StreamClientHeader(&c, "ETag", value, sizeof(value)) && strcmp(value, asset->etag) == 0);
+        HOST_CHECK(StreamClientHeader(&c, "Cache-Control", value, sizeof(value)) && strcmp(value, "no-cache") == 0);
+        HOST_CHECK(StreamClientHeader(&c, "Content-Encoding", value, sizeof(value)) && strcmp(value, "gzip") == 0);
+        StreamClientClose(&c);
+
+        // revalidation: the ETag itself, weak, in a list, any
+        char weak[64], list[96];
+        snprintf(weak, sizeof(weak), "W/%s", asset->etag);
+        snprintf(list, sizeof(list), "\"0123456789abcdef\", %s", asset->etag);
+        const char *match[] = { asset->etag, weak, list, "*" };
+        for (size_t m = 0; m < sizeof(match) / sizeof(match[0]); m++) {
+            HOST_CHECK(Get(asset->uri, match[m], &received, &c) == 304);
+            HOST_CHECK(!StreamClientHeader(&c, "Content-Encoding", value, sizeof(value)));
+            HOST_CHECK(StreamClientHeader(&c, "ETag", value, sizeof(value)) && strcmp(value, asset->etag) == 0);
+            HOST_CHECK(received < MAX_REVALIDATE);
+            StreamClientClose(&c);
+        }
+
+        // an old version of the page
+        HOST_CHECK(Get(asset->uri, "\"0123456789abcdef\"", &received, &c) == 200);
+        HOST_CHECK(c.content_left == 0 && received > asset->gzip_len);
+        StreamClientClose(&c);
+    }
+}
+
+// Bytes of a page load: first visit, reload, and the uncompressed page without an ETag as before
+static void Report(void)
+{
+    printf("%-10s %10s %10s %10s\n", "page", "before", "first", "reload");
+    for (size_t l = 0; l < sizeof(loads) / sizeof(loads[0]); l++) {
+        size_t before = 0, first = 0, reload = 0;
+        for (const char **uri = loads[l]; *uri; uri++) {
+            const web_asset_t *asset = Find(*uri);
+            HOST_CHECK(asset != NULL);
+            if (!asset) {
+                continue;
+            }
+            char head[256];
+            before += snprintf(head, sizeof(head), "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nContent-Length: %zu\r\n\r\n",
+                               asset->type, asset->len) + asset->len;
+            stream_client_t c;
+            size_t received = 0;
+            HOST_CHECK(Get(*uri, NULL, &received, &c) == 200);
+            first += received;
+            StreamClientClose(&c);
+            HOST_CHECK(Get(*uri, asset->etag, &received, &c) == 304);
+            reload += received;
+            StreamClientClose(&c);
+        }
+        printf("%-10s %10zu %10zu %10zu\n", loads[l][0], before, first, reload);
+        HOST_CHECK(first < before / 2 && reload < before / 20);
+    }
+}
+
+int main(void)
+{
+    const char *env = getenv("STREAM_SIM_PORT");
+    port = env ? (uint16_t)atoi(env) : DEFAULT_PORT;
+
+    CheckTable();
+    const stream_sim_config_t config = { .fps = FPS, .port = port, .seed = 3 };
+    HOST_CHECK(StreamSimStart(&config) == ESP_OK);
+    CheckServer();
+    Report();
+    StreamSimStop();
+    printf("%s\n", host_failures ? "FAILED" : "OK");
+    return host_failures ? 1 : 0;
+}
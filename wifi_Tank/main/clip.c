@@ -0,0 +1,477 @@
+/*! \file clip.c
+\brief Clip container in a flash data partition, see clip.h
+*******************************************************************************/
+
+#include "clip.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_crc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+static const char *TAG = "CLIP";
+
+#define CLIP_ERASE_BLOCK 65536      // erased at once where aligned, one block erase instead of 16 sector erases
+#define CLIP_INDEX_CHUNK 32         // index entries read at a time
+#define CLIP_VERIFY_CHUNK 4096      // frame bytes read at a time by ClipVerify()
+
+static uint32_t clip_align4(uint32_t n) {
+    return (n + 3) & ~3u;
+}
+
+static uint32_t clip_header_crc(const clip_header_t *h) {
+    return esp_rom_crc32_le(0, (const uint8_t *)h, offsetof(clip_header_t, header_crc));
+}
+
+uint32_t ClipSize(uint32_t data_size, uint32_t frames) {
+    uint32_t bytes = CLIP_SECTOR + clip_align4(data_size) + frames * sizeof(clip_entry_t);
+    return (bytes + CLIP_SECTOR - 1) / CLIP_SECTOR * CLIP_SECTOR;
+}
+
+/**
+ * @brief Whether a header read at a partition offset describes a clip that fits there
+ */
+static bool clip_header_valid(const esp_partition_t *part, uint32_t offset, const clip_header_t *h) {
+    if (h->magic != CLIP_MAGIC || h->version != CLIP_VERSION || h->header_size != sizeof(clip_header_t) ||
+        h->header_crc != clip_header_crc(h)) {
+        return false;
+    }
+    return h->clip_size >= CLIP_SECTOR && h->clip_size % CLIP_SECTOR == 0 &&
+           h->clip_size <= part->size - offset && h->data_size <= h->clip_size - CLIP_SECTOR &&
+           h->index_offset == CLIP_SECTOR + clip_align4(h->data_size) &&
+           (uint64_t)h->index_offset + (uint64_t)h->frame_count * sizeof(clip_entry_t) <= h->clip_size;
+}
+
+/**
+ * @brief Whether the index of a clip matches the CRC in its header
+ */
+static bool clip_index_valid(const esp_partition_t *part, uint32_t offset, const clip_header_t *h) {
+    clip_entry_t chunk[CLIP_INDEX_CHUNK];
+    uint32_t crc = 0;
+    for (uint32_t i = 0; i < h->frame_count; i += CLIP_INDEX_CHUNK) {
+        uint32_t n = h->frame_count - i < CLIP_INDEX_CHUNK ? h->frame_count - i : CLIP_INDEX_CHUNK;
+        if (esp_partition_read(part, offset + h->index_offset + i * sizeof(clip_entry_t), chunk,
+                               n * sizeof(clip_entry_t)) != ESP_OK) {
+            return false;
+        }
+        crc = esp_rom_crc32_le(crc, (const uint8_t *)chunk, n * sizeof(clip_entry_t));
+    }
+    return crc == h->index_crc;
+}
+
+/**
+ * @brief Find the next valid clip from *offset on, and move *offset past it
+ *
+ * Sectors without a valid header are stepped over one by one, a clip as a whole.
+ */
+static bool clip_next(const esp_partition_t *part, uint32_t *offset, clip_info_t *clip) {
+    while (*offset + CLIP_SECTOR <= part->size) {
+        uint32_t at = *offset;
+        if (esp_partition_read(part, at, &clip->header, sizeof(clip_header_t)) != ESP_OK) {
+            return false;
+        }
+        if (clip_header_valid(part, at, &clip->header) && clip_index_valid(part, at, &clip->header)) {
+            clip->offset = at;
+            *offset = at + clip->header.clip_size;
+            return true;
+        }
+        *offset = at + CLIP_SECTOR;
+    }
+    return false;
+}
+
+/**
+ * @brief Erase the clip's 64 kB blocks up to a partition offset
+ */
+static esp_err_t clip_erase_to(clip_writer_t *w, uint32_t end) {
+    const uint32_t clip_end = w->start + w->size;
+    while (w->erased_end < end) {
+        uint32_t next = (w->part->address + w->erased_end) / CLIP_ERASE_BLOCK * CLIP_ERASE_BLOCK +
+                        CLIP_ERASE_BLOCK - w->part->address;
+        if (next > clip_end) {
+            next = clip_end;
+        }
+        esp_err_t err = esp_partition_erase_range(w->part, w->erased_end, next - w->erased_end);
+        if (err != ESP_OK) {
+            return err;
+        }
+        w->erased_end = next;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Write what the stage holds, erasing ahead of it
+ */
+static esp_err_t clip_write_stage(clip_writer_t *w) {
+    if (w->stage_len == 0) {
+        return ESP_OK;
+    }
+    uint32_t at = w->start + w->stage_offset;
+    esp_err_t err = clip_erase_to(w, at + w->stage_len);
+    if (err == ESP_OK) {
+        err = esp_partition_write(w->part, at, w->stage, w->stage_len);
+    }
+    w->stage_offset += w->stage_len;
+    w->stage_len = 0;
+    return err;
+}
+
+/**
+ * @brief Append bytes to the clip through the stage, full stages go to flash
+ */
+static esp_err_t clip_append(clip_writer_t *w, const uint8_t *data, size_t len) {
+    while (len > 0) {
+        size_t n = CLIP_WRITE_SIZE - w->stage_len;
+        n = n < len ? n : len;
+        memcpy(w->stage + w->stage_len, data, n);
+        w->stage_len += n;
+        data += n;
+        len -= n;
+        if (w->stage_len == CLIP_WRITE_SIZE) {
+            esp_err_t err = clip_write_stage(w);
+            if (err != ESP_OK) {
+                return err;
+            }
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t ClipWriterBegin(clip_writer_t *w, const esp_partition_t *part, uint32_t data_size,
+                          uint32_t max_frames, int64_t trigger_us) {
+    memset(w, 0, sizeof(*w));
+    const uint32_t size = ClipSize(data_size, max_frames);
+    if (size > part->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // The stage in internal RAM: the flash driver would copy a PSRAM buffer in small pieces
+    w->stage = heap_caps_malloc(CLIP_WRITE_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    w->entries = malloc((max_frames ? max_frames : 1) * sizeof(clip_entry_t));
+    if (w->stage == NULL || w->entries == NULL) {
+        ClipWriterAbort(w);
+        return ESP_ERR_NO_MEM;
+    }
+
+    // After the newest clip, else from the start of the partition
+    uint32_t offset = 0;
+    uint32_t number = 0;
+    uint32_t start = 0;
+    clip_info_t clip;
+    while (clip_next(part, &offset, &clip)) {
+        if (clip.header.number >= number) {
+            number = clip.header.number;
+            start = clip.offset + clip.header.clip_size;
+        }
+    }
+    if (start + size > part->size) {
+        start = 0;
+    }
+
+    // Clips in the way become invalid before any of their sectors is erased
+    offset = 0;
+    while (clip_next(part, &offset, &clip)) {
+        if (clip.offset < start + size && start < clip.offset + clip.header.clip_size) {
+            const uint32_t zero = 0;
+            esp_err_t err = esp_partition_write(part, clip.offset, &zero, sizeof(zero));
+            if (err != ESP_OK) {
+                ClipWriterAbort(w);
+                return err;
+            }
+            ESP_LOGI(TAG, "Clip %" PRIu32 " at 0x%" PRIx32 " overwritten", clip.header.number, clip.offset);
+        }
+    }
+
+    w->part = part;
+    w->start = start;
+    w->size = size;
+    w->max_frames = max_frames;
+    w->data_end = CLIP_SECTOR;
+    w->erased_end = start;
+    w->stage_offset = CLIP_SECTOR;
+    w->header.number = number + 1;
+    w->header.trigger_us = trigger_us;
+    return ESP_OK;
+}
+
+/**
+ * @brief Append a JPEG and its index entry
+ */
+static esp_err_t clip_add(clip_writer_t *w, const uint8_t *jpg, size_t len, int64_t time_us, uint32_t sequence,
+                          uint32_t flags) {
+    if (w->header.frame_count >= w->max_frames ||
+        clip_align4(w->data_end + len) + w->max_frames * sizeof(clip_entry_t) > w->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    clip_entry_t *e = &w->entries[w->header.frame_count++];
+    e->offset = w->data_end;
+    e->len = len;
+    e->time_us = time_us;
+    e->sequence = sequence;
+    e->flags = flags;
+    w->header.data_crc = esp_rom_crc32_le(w->header.data_crc, jpg, len);
+    w->data_end += len;
+    return clip_append(w, jpg, len);
+}
+
+esp_err_t ClipWriterAdd(clip_writer_t *w, const uint8_t *jpg, size_t len, int64_t time_us, uint32_t sequence) {
+    const bool first = w->header.frame_count == 0;
+    if (!first && time_us < w->header.last_us) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = clip_add(w, jpg, len, time_us, sequence, 0);
+    if (err != ESP_ERR_INVALID_SIZE) {
+        if (first) {
+            w->header.first_us = time_us;
+        }
+        w->header.last_us = time_us;
+    }
+    return err;
+}
+
+esp_err_t ClipWriterAddThumb(clip_writer_t *w, const uint8_t *jpg, size_t len) {
+    if (w->header.frame_count == 0 || (w->entries[w->header.frame_count - 1].flags & CLIP_ENTRY_THUMB)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const clip_entry_t *frame = &w->entries[w->header.frame_count - 1];
+    return clip_add(w, jpg, len, frame->time_us, frame->sequence, CLIP_ENTRY_THUMB);
+}
+
+esp_err_t ClipWriterFinish(clip_writer_t *w, clip_info_t *info) {
+    static const uint8_t pad[3];
+    clip_header_t *h = &w->header;
+    const uint32_t index_bytes = h->frame_count * sizeof(clip_entry_t);
+
+    // The index after the frames, then the header that makes the clip valid
+    esp_err_t err = clip_append(w, pad, clip_align4(w->data_end) - w->data_end);
+    if (err == ESP_OK) {
+        err = clip_append(w, (const uint8_t *)w->entries, index_bytes);
+    }
+    if (err == ESP_OK) {
+        err = clip_write_stage(w);
+    }
+    if (err == ESP_OK) {
+        err = clip_erase_to(w, w->start + CLIP_SECTOR);
+    }
+    if (err == ESP_OK) {
+        h->magic = CLIP_MAGIC;
+        h->version = CLIP_VERSION;
+        h->header_size = sizeof(clip_header_t);
+        h->index_offset = clip_align4(w->data_end);
+        h->clip_size = w->size;
+        h->index_crc = esp_rom_crc32_le(0, (const uint8_t *)w->entries, index_bytes);
+        h->data_size = w->data_end - CLIP_SECTOR;
+        h->header_crc = clip_header_crc(h);
+        err = esp_partition_write(w->part, w->start, h, sizeof(*h));
+    }
+    if (err == ESP_OK && info) {
+        info->offset = w->start;
+        info->header = *h;
+    }
+    ClipWriterAbort(w);
+    return err;
+}
+
+void ClipWriterAbort(clip_writer_t *w) {
+    free(w->entries);
+    heap_caps_free(w->stage);
+    w->entries = NULL;
+    w->stage = NULL;
+}
+
+static int clip_compare(const void *a, const void *b) {
+    uint32_t x = ((const clip_info_t *)a)->header.number;
+    uint32_t y = ((const clip_info_t *)b)->header.number;
+    return (x > y) - (x < y);
+}
+
+int ClipScan(const esp_partition_t *part, clip_info_t *clips, int max) {
+    int count = 0;
+    uint32_t offset = 0;
+    clip_info_t clip;
+    while (max > 0 && clip_next(part, &offset, &clip)) {
+        if (count < max) {
+            clips[count++] = clip;
+            continue;
+        }
+        int oldest = 0;
+        for (int i = 1; i < count; i++) {
+            if (clips[i].header.number < clips[oldest].header.number) {
+                oldest = i;
+            }
+        }
+        if (clip.header.number > clips[oldest].header.number) {
+            clips[oldest] = clip;
+        }
+    }
+    qsort(clips, count, sizeof(clip_info_t), clip_compare);
+    return count;
+}
+
+esp_err_t ClipFind(const esp_partition_t *part, uint32_t number, clip_info_t *clip) {
+    uint32_t offset = 0;
+    clip_info_t found;
+    bool any = false;
+    while (clip_next(part, &offset, &found)) {
+        if (number == 0 ? !any || found.header.number > clip->header.number : found.header.number == number) {
+            *clip = found;
+            any = true;
+        }
+    }
+    return any ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+uint32_t ClipFileSize(const clip_info_t *clip) {
+    return clip->header.index_offset + clip->header.frame_count * sizeof(clip_entry_t);
+}
+
+esp_err_t ClipRead(const esp_partition_t *part, const clip_info_t *clip, uint32_t offset, void *buf, size_t len) {
+    const uint32_t size = ClipFileSize(clip);
+    if (offset > size || len > size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return esp_partition_read(part, clip->offset + offset, buf, len);
+}
+
+esp_err_t ClipReadEntries(const esp_partition_t *part, const clip_info_t *clip, uint32_t first,
+                          clip_entry_t *entries, uint32_t count) {
+    if (first > clip->header.frame_count || count > clip->header.frame_count - first) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return esp_partition_read(part, clip->offset + clip->header.index_offset + first * sizeof(clip_entry_t),
+                              entries, count * sizeof(clip_entry_t));
+}
+
+/**
+ * @brief Whether an index entry lies within the frames of its clip
+ */
+static bool clip_entry_valid(const clip_header_t *h, const clip_entry_t *entry) {
+    return entry->offset >= CLIP_SECTOR && entry->offset <= CLIP_SECTOR + h->data_size &&
+           entry->len <= CLIP_SECTOR + h->data_size - entry->offset;
+}
+
+esp_err_t ClipReadFrame(const esp_partition_t *part, const clip_info_t *clip, const clip_entry_t *entry,
+                        uint8_t *buf) {
+    if (!clip_entry_valid(&clip->header, entry)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return esp_partition_read(part, clip->offset + entry->offset, buf, entry->len);
+}
+
+esp_err_t ClipSeek(const esp_partition_t *part, const clip_info_t *clip, int64_t time_us, bool thumb,
+                   uint32_t *index, clip_entry_t *entry) {
+    if (clip->header.frame_count == 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // The first entry after the time; the one before it is the last at or before
+    uint32_t lo = 0;
+    uint32_t hi = clip->header.frame_count;
+    clip_entry_t e;
+    esp_err_t err;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if ((err = ClipReadEntries(part, clip, mid, &e, 1)) != ESP_OK) {
+            return err;
+        }
+        if (e.time_us <= time_us) {
+            *entry = e;         // lo only grows, the last of these is entry lo - 1
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    uint32_t at = lo > 0 ? lo - 1 : 0;
+    if (lo == 0) {
+        if (thumb) {
+            return ESP_ERR_NOT_FOUND;
+        }
+        if ((err = ClipReadEntries(part, clip, 0, entry, 1)) != ESP_OK) {
+            return err;
+        }
+    }
+
+    if (!thumb && (entry->flags & CLIP_ENTRY_THUMB)) {
+        // the frame of this thumbnail, right before it
+        at--;
+        err = ClipReadEntries(part, clip, at, entry, 1);
+    } else if (thumb) {
+        // back over the frames since the last thumbnail, a chunk of entries at a time
+        clip_entry_t chunk[CLIP_INDEX_CHUNK];
+        uint32_t end = at + 1;
+        err = ESP_ERR_NOT_FOUND;
+        while (end > 0 && err == ESP_ERR_NOT_FOUND) {
+            uint32_t n = end < CLIP_INDEX_CHUNK ? end : CLIP_INDEX_CHUNK;
+            esp_err_t read = ClipReadEntries(part, clip, end - n, chunk, n);
+            if (read != ESP_OK) {
+                return read;
+            }
+            for (uint32_t k = n; k-- > 0; ) {
+                if (chunk[k].flags & CLIP_ENTRY_THUMB) {
+                    at = end - n + k;
+                    *entry = chunk[k];
+                    err = ESP_OK;
+                    break;
+                }
+            }
+            end -= n;
+        }
+    }
+    if (err == ESP_OK && index) {
+        *index = at;
+    }
+    return err;
+}
+
+esp_err_t ClipVerify(const esp_partition_t *part, const clip_info_t *clip) {
+    const clip_header_t *h = &clip->header;
+    uint8_t *buf = malloc(CLIP_VERIFY_CHUNK);
+    if (buf == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // The frames against their CRC
+    esp_err_t err = ESP_OK;
+    uint32_t crc = 0;
+    for (uint32_t done = 0; done < h->data_size && err == ESP_OK; ) {
+        uint32_t n = h->data_size - done < CLIP_VERIFY_CHUNK ? h->data_size - done : CLIP_VERIFY_CHUNK;
+        err = esp_partition_read(part, clip->offset + CLIP_SECTOR + done, buf, n);
+        crc = esp_rom_crc32_le(crc, buf, n);
+        done += n;
+    }
+    if (err == ESP_OK && crc != h->data_crc) {
+        err = ESP_ERR_INVALID_CRC;
+    }
+
+    // The index: frames back to back, each a JPEG, in capture order, thumbnails after their frames
+    clip_entry_t chunk[CLIP_INDEX_CHUNK];
+    clip_entry_t prev = { 0 };
+    uint32_t expected = CLIP_SECTOR;
+    for (uint32_t i = 0; i < h->frame_count && err == ESP_OK; i += CLIP_INDEX_CHUNK) {
+        uint32_t n = h->frame_count - i < CLIP_INDEX_CHUNK ? h->frame_count - i : CLIP_INDEX_CHUNK;
+        err = ClipReadEntries(part, clip, i, chunk, n);
+        for (uint32_t k = 0; k < n && err == ESP_OK; k++) {
+            uint8_t soi[2];
+            const bool is_thumb = chunk[k].flags & CLIP_ENTRY_THUMB;
+            const bool ordered = i + k == 0 || (is_thumb ? !(prev.flags & CLIP_ENTRY_THUMB) &&
+                                                           chunk[k].time_us == prev.time_us
+                                                         : chunk[k].time_us >= prev.time_us);
+            if (chunk[k].offset != expected || chunk[k].len < sizeof(soi) || !clip_entry_valid(h, &chunk[k]) ||
+                (i + k == 0 && is_thumb) || !ordered) {
+                err = ESP_ERR_INVALID_CRC;
+            } else if ((err = esp_partition_read(part, clip->offset + chunk[k].offset, soi, sizeof(soi))) == ESP_OK &&
+                       (soi[0] != 0xff || soi[1] != 0xd8)) {
+                err = ESP_ERR_INVALID_CRC;
+            }
+            expected += chunk[k].len;
+            prev = chunk[k];
+        }
+    }
+    if (err == ESP_OK && expected != CLIP_SECTOR + h->data_size) {
+        err = ESP_ERR_INVALID_CRC;
+    }
+    free(buf);
+    return err;
+}
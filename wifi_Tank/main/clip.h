@@ -0,0 +1,266 @@
+/*! \file clip.h
+\brief Recorded clips in a flash data partition: JPEG frames with an index of
+their offsets and capture times
+*******************************************************************************/
+
+#ifndef CLIP_H_
+#define CLIP_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_partition.h"
+
+/*
+ * A clip takes whole 4 kB sectors of the partition:
+ *
+ *   +0       clip_header_t, the rest of the sector unused
+ *   +4096    the JPEG frames back to back, data_size bytes
+ *   +index   clip_entry_t per frame, 4 byte aligned after the frames
+ *
+ * The index is in capture order, so a frame is found by its time with a
+ * binary search of O(log n) entry reads (ClipSeek()). A frame may be
+ * followed by a small JPEG of it, flagged CLIP_ENTRY_THUMB, for scrubbing
+ * through a clip without reading whole frames. The clip from its header to
+ * the end of the index (ClipFileSize()) is also the file format of a clip
+ * outside the partition, e.g. downloaded from /recorder/clip.
+ *
+ * The header is written last and names the CRCs of the index and the frames,
+ * so a clip cut short by a reset has no valid header and is not found. A new
+ * clip goes after the newest one, or to the start of the partition when it
+ * does not fit there, and invalidates the older clips it overlaps before it
+ * erases them. Clips it does not overlap are never touched.
+ */
+
+#define CLIP_MAGIC 0x50494c43       // "CLIP"
+#define CLIP_VERSION 1
+#define CLIP_SECTOR 4096
+#define CLIP_WRITE_SIZE 16384       // bytes per flash write, a multiple of the 256 byte page
+
+#define CLIP_ENTRY_THUMB 0x1        // entry flag: a thumbnail of the frame before it, at its time
+
+// Clip header, at the start of the clip's first sector
+typedef struct {
+    uint32_t magic;                 // CLIP_MAGIC
+    uint16_t version;               // CLIP_VERSION
+    uint16_t header_size;           // sizeof(clip_header_t)
+    uint32_t number;                // counts up with every clip written to the partition
+    uint32_t frame_count;
+    uint32_t index_offset;          // from the clip start
+    uint32_t clip_size;             // bytes of the partition the clip takes, whole sectors
+    int64_t trigger_us;             // esp_timer time of the trigger
+    int64_t first_us;               // capture time of the first and the last frame
+    int64_t last_us;
+    uint32_t index_crc;             // CRC-32 of the index
+    uint32_t data_crc;              // CRC-32 of the frames
+    uint32_t data_size;             // bytes of frames from CLIP_SECTOR on
+    uint32_t header_crc;            // CRC-32 of the header bytes before it
+} clip_header_t;
+
+// Index entry of a frame
+typedef struct {
+    uint32_t offset;                // of the JPEG, from the clip start
+    uint32_t len;
+    int64_t time_us;                // capture time (VSYNC) of the frame
+    uint32_t sequence;              // capture sequence number
+    uint32_t flags;                 // CLIP_ENTRY_*
+} clip_entry_t;
+
+// A clip found in the partition
+typedef struct {
+    uint32_t offset;                // of the clip in the partition
+    clip_header_t header;
+} clip_info_t;
+
+// Clip being written, see ClipWriterBegin()
+typedef struct {
+    const esp_partition_t *part;
+    uint32_t start;                 // partition offset of the clip
+    uint32_t size;                  // bytes reserved for it
+    uint32_t max_frames;
+    uint32_t data_end;              // clip offset of the next frame byte
+    uint32_t erased_end;            // partition offset up to which the clip is erased
+    clip_entry_t *entries;
+    uint8_t *stage;                 // CLIP_WRITE_SIZE bytes collected for the next write
+    uint32_t stage_offset;          // clip offset of stage[0]
+    uint32_t stage_len;
+    clip_header_t header;
+} clip_writer_t;
+
+/**
+ * @brief Bytes of the partition a clip takes
+ *
+ * @param data_size Bytes of JPEG frames
+ * @param frames Number of frames
+ */
+uint32_t ClipSize(uint32_t data_size, uint32_t frames);
+
+/**
+ * @brief Start a clip
+ *
+ * Places the clip after the newest one, invalidates the clips in its way
+ * and allocates the write buffers. Nothing is erased yet; the writer erases
+ * 64 kB blocks just ahead of what it writes.
+ *
+ * @param w Writer
+ * @param part Data partition
+ * @param data_size Bytes of all the frames the clip will hold
+ * @param max_frames Frames it will hold
+ * @param trigger_us Time of the trigger, kept in the header
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE if the clip cannot fit the partition,
+ *         ESP_ERR_NO_MEM, or the error of the flash driver
+ */
+esp_err_t ClipWriterBegin(clip_writer_t *w, const esp_partition_t *part, uint32_t data_size,
+                          uint32_t max_frames, int64_t trigger_us);
+
+/**
+ * @brief Append a frame to the clip
+ *
+ * The frame is copied into the write buffer, which goes to flash in
+ * CLIP_WRITE_SIZE writes, so jpg may be in PSRAM and may be reused on return.
+ * Frames come in capture order, time_us never less than the frame before.
+ *
+ * @param w Writer
+ * @param jpg JPEG
+ * @param len Its length
+ * @param time_us Its capture time
+ * @param sequence Its capture sequence number
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE past the sizes given to ClipWriterBegin(),
+ *         ESP_ERR_INVALID_ARG for a frame older than the one before, or the
+ *         error of the flash driver
+ */
+esp_err_t ClipWriterAdd(clip_writer_t *w, const uint8_t *jpg, size_t len, int64_t time_us, uint32_t sequence);
+
+/**
+ * @brief Append a thumbnail of the frame added last
+ *
+ * It takes an index entry and its bytes like a frame, count both in the
+ * sizes given to ClipWriterBegin().
+ *
+ * @param w Writer
+ * @param jpg Small JPEG of the frame
+ * @param len Its length
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE past the sizes given to ClipWriterBegin(),
+ *         ESP_ERR_INVALID_STATE without a frame to go with, or the error of the flash driver
+ */
+esp_err_t ClipWriterAddThumb(clip_writer_t *w, const uint8_t *jpg, size_t len);
+
+/**
+ * @brief Write the index and then the header, which makes the clip valid, and free the writer
+ *
+ * @param w Writer
+ * @param info Filled with the clip written, or NULL
+ * @return ESP_OK, or the error of the flash driver (the clip is not valid then)
+ */
+esp_err_t ClipWriterFinish(clip_writer_t *w, clip_info_t *info);
+
+/**
+ * @brief Free a writer without finishing its clip, which stays invalid
+ */
+void ClipWriterAbort(clip_writer_t *w);
+
+/**
+ * @brief Find the valid clips of the partition
+ *
+ * Checks the header and index CRCs, not the frames (see ClipVerify()).
+ *
+ * @param part Data partition
+ * @param clips Filled with the clips, oldest first
+ * @param max Size of clips; the newest max clips are kept if there are more
+ * @return Number of clips found
+ */
+int ClipScan(const esp_partition_t *part, clip_info_t *clips, int max);
+
+/**
+ * @brief Find a clip by its number
+ *
+ * @param part Data partition
+ * @param number Clip number, 0 for the newest clip
+ * @param clip Output
+ * @return ESP_OK, ESP_ERR_NOT_FOUND, or the error of the flash driver
+ */
+esp_err_t ClipFind(const esp_partition_t *part, uint32_t number, clip_info_t *clip);
+
+/**
+ * @brief Bytes of a clip from its header to the end of its index, its size as a file
+ */
+uint32_t ClipFileSize(const clip_info_t *clip);
+
+/**
+ * @brief Read bytes of a clip as a file, see ClipFileSize()
+ *
+ * @param part Data partition
+ * @param clip Clip from ClipScan()
+ * @param offset From the clip start
+ * @param buf Output
+ * @param len Bytes to read
+ * @return ESP_OK, ESP_ERR_INVALID_ARG past the end, or the error of the flash driver
+ */
+esp_err_t ClipRead(const esp_partition_t *part, const clip_info_t *clip, uint32_t offset, void *buf, size_t len);
+
+/**
+ * @brief Read index entries of a clip
+ *
+ * @param part Data partition
+ * @param clip Clip from ClipScan()
+ * @param first First entry
+ * @param entries Output
+ * @param count Entries to read, at most frame_count - first
+ * @return ESP_OK, ESP_ERR_INVALID_ARG past the index, or the error of the flash driver
+ */
+esp_err_t ClipReadEntries(const esp_partition_t *part, const clip_info_t *clip, uint32_t first,
+                          clip_entry_t *entries, uint32_t count);
+
+/**
+ * @brief Read the JPEG of an index entry
+ *
+ * @param part Data partition
+ * @param clip Clip from ClipScan()
+ * @param entry Its index entry
+ * @param buf Output, entry->len bytes
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for an entry outside the clip, or the error of the flash driver
+ */
+esp_err_t ClipReadFrame(const esp_partition_t *part, const clip_info_t *clip, const clip_entry_t *entry,
+                        uint8_t *buf);
+
+/**
+ * @brief Find the frame shown at a time, or its thumbnail
+ *
+ * A binary search of the index: about log2(frame_count) reads of one entry.
+ *
+ * @param part Data partition
+ * @param clip Clip from ClipScan()
+ * @param time_us Capture time; the last frame captured at or before it, the
+ *        first frame for a time before the clip
+ * @param thumb Find the last thumbnail at or before the time instead, which
+ *        steps back over the frames since it
+ * @param index Output, the entry's place in the index, or NULL
+ * @param entry Output, its entry
+ * @return ESP_OK, ESP_ERR_NOT_FOUND for a clip without frames or without a
+ *         thumbnail that early, or the error of the flash driver
+ */
+esp_err_t ClipSeek(const esp_partition_t *part, const clip_info_t *clip, int64_t time_us, bool thumb,
+                   uint32_t *index, clip_entry_t *entry);
+
+/**
+ * @brief Check a clip's frames against their CRC and its index against the frames
+ *
+ * The index has to cover the frames back to back, each a JPEG, in capture
+ * order, a thumbnail only after a frame and at its time.
+ *
+ * @param part Data partition
+ * @param clip Clip from ClipScan()
+ * @return ESP_OK, ESP_ERR_INVALID_CRC for a damaged clip, or the error of the flash driver
+ */
+esp_err_t ClipVerify(const esp_partition_t *part, const clip_info_t *clip);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLIP_H_ */
@@ -8,12 +8,14 @@
 #include "esp_event.h"
 #include "esp_log.h"
 #include "nvs_flash.h"
-#include "esp_http_server.h"
 #include "esp_netif.h"
 #include "trice.h"
 #include "system.h"
 #include "stream.h"
 #include "overlay.h"
+#include "server.h"
+#include "recorder.h"
+#include "motion.h"
 #include "lwip/netif.h"
 #include "esp_netif_net_stack.h"
 
@@ -55,19 +57,6 @@ void app_throughput_add_tx(uint32_t bytes) {
 static EventGroupHandle_t wifi_event_group;
 const int WIFI_CONNECTED_BIT = BIT0;
 
-static esp_err_t root_get_handler(httpd_req_t *req) {
-    const char *resp = "hello world";
-    httpd_resp_send(req, resp, strlen(resp));
-    return ESP_OK;
-}
-
-static const httpd_uri_t root = {
-    .uri = "/",
-    .method = HTTP_GET,
-    .handler = root_get_handler,
-    .user_ctx = NULL
-};
-
 static void wifi_event_handler(void* arg, esp_event_base_t event_base,
                                int32_t event_id, void* event_data) {
     if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START) {
@@ -129,22 +118,6 @@ void wifi_init_sta(void) {
     ESP_LOGI(TAG, "connect to ap SSID:%s password:%s", WIFI_SSID, WIFI_PASS);
 }
 
-static httpd_handle_t start_webserver(void) {
-    httpd_handle_t server = NULL;
-    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.server_port = WEB_SERVER_PORT;
-    config.lru_purge_enable = true;
-
-    if (httpd_start(&server, &config) == ESP_OK) {
-        ESP_LOGI(TAG, "Registering URI handlers");
-        httpd_register_uri_handler(server, &root);
-        return server;
-    }
-
-    ESP_LOGI(TAG, "Error starting server!");
-    return NULL;
-}
-
 void print_network_scan_tips(void) {
     ESP_LOGI(TAG, "");
     ESP_LOGI(TAG, "=== NETWORK SCANNING TIPS ===");
@@ -188,6 +161,13 @@ static void throughput_monitor_task(void *pvParameters) {
     }
 }
 
+// A clip of every motion event: at its end the ring holds it and the seconds before
+static void motion_event(const motion_event_t *event, void *arg) {
+    if (event->type == MOTION_EVENT_END && RecorderTrigger() != ESP_OK) {
+        ESP_LOGW(TAG, "No clip of motion %lu", event->number);
+    }
+}
+
 static void overlay_demo_task(void *pvParameters) {
     ESP_LOGI(TAG, "Overlay demo task started");
 
@@ -204,6 +184,14 @@ static void overlay_demo_task(void *pvParameters) {
             overlay_data_t overlay;
             OverlayCreateSampleData(&overlay);
 
+            // Describe the newest streamed frame, clients show the HUD change on that frame
+            uint32_t sequence;
+            int64_t capture_us;
+            if (StreamGetLastFrame(&sequence, &capture_us)) {
+                overlay.frame_sequence = sequence;
+                overlay.frame_time_us = capture_us;
+            }
+
             // Update dynamic data (battery percentage cycles 0-100)
             uint8_t battery_pct = (counter % 100);
             snprintf(overlay.texts[2].content, OVERLAY_MAX_TEXT_LENGTH, "Battery: %d%%", battery_pct);
@@ -244,21 +232,31 @@ void app_main(void) {
 
     ESP_LOGI(TAG, "WiFi connected, initializing system");
 
-    // Initialize system (creates task and TCP server on port 8080)
-    SystemInit(8080);
+    // Initialize system, without the raw TCP server: everything is on the HTTP port
+    SystemInit(0);
 
-    // Initialize video stream (camera + HTTP MJPEG server on port 81)
-    if (StreamInit(81) == 0) {
+    // Initialize video stream (camera)
+    if (StreamInit() == 0) {
         StreamStart();
-        ESP_LOGI(TAG, "Video stream initialized on port 81");
+        ESP_LOGI(TAG, "Video stream initialized");
+
+        // Keep the last seconds of driving, written to flash on POST /recorder/trigger
+        const recorder_config_t recorder = RECORDER_DEFAULT_CONFIG();
+        if (RecorderInit(&recorder) != 0) {
+            ESP_LOGW(TAG, "Recorder not started");
+        }
+
+        motion_config_t motion = MOTION_DEFAULT_CONFIG();
+        motion.on_event = motion_event;
+        if (MotionInit(&motion) != 0) {
+            ESP_LOGW(TAG, "Motion detection not started");
+        }
     } else {
         ESP_LOGW(TAG, "Failed to initialize video stream");
     }
 
-    ESP_LOGI(TAG, "Starting web server");
-    httpd_handle_t server = start_webserver();
-
-    if (server) {
+    // One HTTP server for the pages, the stream, the overlay WebSocket and the status
+    if (ServerInit(WEB_SERVER_PORT) == 0) {
         ESP_LOGI(TAG, "Web server started on port %d", WEB_SERVER_PORT);
     }
 
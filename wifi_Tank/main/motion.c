@@ -0,0 +1,565 @@
+/*! \file motion.c
+\brief Motion detection from the DC coefficients of the JPEG frames, see motion.h
+*******************************************************************************/
+
+#include "motion.h"
+#include "stream.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "jpeg_decoder.h"
+#include "cJSON.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+static const char *TAG = "MOTION";
+
+#define MOTION_TASK_STACK 4096
+#define MOTION_TASK_PRIORITY 3      // below the stream senders, with the recorder
+#define MOTION_FRAME_RESERVE (96 * 1024)    // JPEG copy allocated at the start, grown for larger frames
+
+// Background values carry 4 fraction bits, so a slow learning rate still moves them
+#define MOTION_BG_SHIFT 4
+
+struct motion_detector {
+    motion_config_t config;
+    size_t max_blocks;
+    uint8_t *work;              // tjpgd work area
+    uint8_t *map;               // luma map of the frame
+    uint16_t *background;       // running background, << MOTION_BG_SHIFT
+    uint8_t *mask;              // 1 for changed blocks, 2 once labelled
+    uint16_t *queue;            // blocks of the region being labelled
+    uint16_t width;             // map size of the background, 0 before the first frame
+    uint16_t height;
+    uint16_t hist[511];         // differences from the background, -255..255
+    uint8_t motion_frames;      // frames with motion in a row
+    bool active;
+    uint32_t number;
+    int64_t start_us;
+    int64_t last_motion_us;
+    motion_frame_t last_motion;
+};
+
+motion_detector_t *MotionDetectorCreate(const motion_config_t *config, uint16_t max_width, uint16_t max_height) {
+    const size_t blocks = (size_t)((max_width + 7) / 8) * ((max_height + 7) / 8);
+    if (blocks == 0 || blocks > UINT16_MAX) {
+        return NULL;
+    }
+    motion_detector_t *m = calloc(1, sizeof(motion_detector_t));
+    if (m == NULL) {
+        return NULL;
+    }
+    m->config = *config;
+    m->max_blocks = blocks;
+    m->work = heap_caps_malloc(ESP_JPEG_WORK_BUF_SIZE, MALLOC_CAP_8BIT);
+    m->map = malloc(blocks);
+    m->background = malloc(blocks * sizeof(uint16_t));
+    m->mask = malloc(blocks);
+    m->queue = malloc(blocks * sizeof(uint16_t));
+    if (m->work == NULL || m->map == NULL || m->background == NULL || m->mask == NULL || m->queue == NULL) {
+        MotionDetectorFree(m);
+        return NULL;
+    }
+    return m;
+}
+
+void MotionDetectorFree(motion_detector_t *m) {
+    if (m == NULL) {
+        return;
+    }
+    heap_caps_free(m->work);
+    free(m->map);
+    free(m->background);
+    free(m->mask);
+    free(m->queue);
+    free(m);
+}
+
+const uint8_t *MotionDetectorMap(const motion_detector_t *m, uint16_t *width, uint16_t *height) {
+    *width = m->width;
+    *height = m->height;
+    return m->width ? m->map : NULL;
+}
+
+/**
+ * @brief Take the map as the background
+ */
+static void motion_relearn(motion_detector_t *m) {
+    const size_t n = (size_t)m->width * m->height;
+    for (size_t i = 0; i < n; i++) {
+        m->background[i] = m->map[i] << MOTION_BG_SHIFT;
+    }
+}
+
+/**
+ * @brief Median difference of the map from the background, in background units
+ *
+ * A change of exposure or white balance shifts every block alike, the
+ * median follows it and moving things barely move it.
+ */
+static int motion_offset(motion_detector_t *m) {
+    const size_t n = (size_t)m->width * m->height;
+    memset(m->hist, 0, sizeof(m->hist));
+    for (size_t i = 0; i < n; i++) {
+        m->hist[m->map[i] - (m->background[i] >> MOTION_BG_SHIFT) + 255]++;
+    }
+    size_t seen = 0;
+    int d = 0;
+    while (seen + m->hist[d] <= n / 2) {
+        seen += m->hist[d++];
+    }
+    return (d - 255) << MOTION_BG_SHIFT;
+}
+
+/**
+ * @brief Add a labelled region to the boxes, the largest ones kept
+ */
+static void motion_add_box(motion_frame_t *frame, const motion_box_t *box) {
+    int at = frame->box_count;
+    while (at > 0 && frame->boxes[at - 1].blocks < box->blocks) {
+        at--;
+    }
+    if (at >= MOTION_MAX_BOXES) {
+        return;
+    }
+    const int last = frame->box_count < MOTION_MAX_BOXES ? frame->box_count : MOTION_MAX_BOXES - 1;
+    memmove(&frame->boxes[at + 1], &frame->boxes[at], (last - at) * sizeof(motion_box_t));
+    frame->boxes[at] = *box;
+    if (frame->box_count < MOTION_MAX_BOXES) {
+        frame->box_count++;
+    }
+}
+
+/**
+ * @brief Label the 8-connected regions of changed blocks and box the ones with min_blocks
+ */
+static void motion_label(motion_detector_t *m, motion_frame_t *frame) {
+    const int w = m->width, h = m->height;
+    for (int start = 0; start < w * h; start++) {
+        if (m->mask[start] != 1) {
+            continue;
+        }
+        int x0 = start % w, x1 = x0, y0 = start / w, y1 = y0;
+        size_t head = 0, tail = 0;
+        m->queue[tail++] = (uint16_t)start;
+        m->mask[start] = 2;
+        while (head < tail) {
+            const int i = m->queue[head++];
+            const int x = i % w, y = i / w;
+            x0 = x < x0 ? x : x0;
+            x1 = x > x1 ? x : x1;
+            y0 = y < y0 ? y : y0;
+            y1 = y > y1 ? y : y1;
+            for (int ny = y - 1; ny <= y + 1; ny++) {
+                for (int nx = x - 1; nx <= x + 1; nx++) {
+                    if (nx >= 0 && nx < w && ny >= 0 && ny < h && m->mask[ny * w + nx] == 1) {
+                        m->mask[ny * w + nx] = 2;
+                        m->queue[tail++] = (uint16_t)(ny * w + nx);
+                    }
+                }
+            }
+        }
+        if (tail >= m->config.min_blocks) {
+            const motion_box_t box = {
+                .x = x0 * 8, .y = y0 * 8, .w = (x1 - x0 + 1) * 8, .h = (y1 - y0 + 1) * 8, .blocks = tail,
+            };
+            motion_add_box(frame, &box);
+        }
+    }
+}
+
+/**
+ * @brief Compare the map with the background, then let the background follow it
+ */
+static void motion_compare(motion_detector_t *m, motion_frame_t *frame) {
+    const size_t n = (size_t)m->width * m->height;
+    const int offset = motion_offset(m);
+    const int threshold = m->config.threshold << MOTION_BG_SHIFT;
+    size_t changed = 0;
+    for (size_t i = 0; i < n; i++) {
+        const int d = (m->map[i] << MOTION_BG_SHIFT) - m->background[i] - offset;
+        m->mask[i] = d > threshold || d < -threshold;
+        changed += m->mask[i];
+    }
+    frame->changed = (uint16_t)changed;
+    if (changed * 100 > n * m->config.relearn_percent) {
+        frame->relearned = true;
+        motion_relearn(m);
+        return;
+    }
+
+    // Where the frame changed, the background follows 4 times slower: a thing that stays is learnt in time
+    for (size_t i = 0; i < n; i++) {
+        const int d = (m->map[i] << MOTION_BG_SHIFT) - m->background[i];
+        m->background[i] += d / (1 << (m->config.learn_shift + (m->mask[i] ? 2 : 0)));
+    }
+    if (changed >= m->config.min_blocks) {
+        motion_label(m, frame);
+    }
+}
+
+static void motion_emit(motion_detector_t *m, motion_event_type_t type, const motion_frame_t *frame) {
+    if (m->config.on_event == NULL) {
+        return;
+    }
+    const motion_event_t event = {
+        .type = type,
+        .number = m->number,
+        .start_us = m->start_us,
+        .frame = *frame,
+    };
+    m->config.on_event(&event, m->config.arg);
+}
+
+esp_err_t MotionDetectorProcess(motion_detector_t *m, const uint8_t *jpg, size_t len, uint32_t sequence,
+                                int64_t time_us, motion_frame_t *frame) {
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = (uint8_t *)jpg,
+        .indata_size = len,
+        .outbuf = m->map,
+        .outbuf_size = m->max_blocks,
+        .advanced.working_buffer = m->work,
+        .advanced.working_buffer_size = ESP_JPEG_WORK_BUF_SIZE,
+    };
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    if ((size_t)((img.width + 7) / 8) * ((img.height + 7) / 8) > m->max_blocks) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (esp_jpeg_decode_dc_map(&cfg, &img) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    motion_frame_t result = { .sequence = sequence, .time_us = time_us };
+    if (img.width != m->width || img.height != m->height) {
+        m->width = img.width;
+        m->height = img.height;
+        result.relearned = true;
+        motion_relearn(m);
+    } else {
+        motion_compare(m, &result);
+    }
+
+    if (result.box_count > 0) {
+        m->motion_frames += m->motion_frames < UINT8_MAX;
+        m->last_motion_us = time_us;
+        m->last_motion = result;
+        if (m->active) {
+            motion_emit(m, MOTION_EVENT_UPDATE, &result);
+        } else if (m->motion_frames >= m->config.start_frames) {
+            m->active = true;
+            m->number++;
+            m->start_us = time_us;
+            motion_emit(m, MOTION_EVENT_START, &result);
+        }
+    } else {
+        m->motion_frames = 0;
+        if (m->active && time_us - m->last_motion_us >= m->config.hold_ms * 1000LL) {
+            m->active = false;
+            motion_emit(m, MOTION_EVENT_END, &m->last_motion);
+        }
+    }
+    if (frame) {
+        *frame = result;
+    }
+    return ESP_OK;
+}
+
+// Motion service state. The frame copy belongs to whoever set busy, the rest under motion_lock.
+static struct {
+    motion_config_t config;
+    motion_detector_t *detector;
+    bool running;
+    volatile bool stopping;
+    bool busy;                  // a frame is being copied or analysed
+    int64_t last_us;            // capture time of the last frame taken
+    uint8_t *frame;             // JPEG copy for the task
+    size_t frame_cap;
+    size_t frame_len;
+    uint32_t frame_sequence;
+    int64_t frame_time_us;
+    SemaphoreHandle_t wake;     // a frame or MotionStop() for the task
+    SemaphoreHandle_t done;     // the task has ended
+    motion_status_t stats;
+} motion;
+
+static portMUX_TYPE motion_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Take the right to analyse a frame: one per interval, one at a time
+ */
+static bool motion_claim(int64_t time_us) {
+    const int64_t interval_us = motion.config.interval_ms * 1000LL;
+    portENTER_CRITICAL(&motion_lock);
+    bool due = time_us - motion.last_us >= interval_us - interval_us / 4;
+    bool claimed = due && !motion.busy;
+    if (claimed) {
+        motion.busy = true;
+        motion.last_us = time_us;
+    } else if (due) {
+        motion.stats.busy++;
+    }
+    portEXIT_CRITICAL(&motion_lock);
+    return claimed;
+}
+
+static void motion_release(void) {
+    portENTER_CRITICAL(&motion_lock);
+    motion.busy = false;
+    portEXIT_CRITICAL(&motion_lock);
+}
+
+/**
+ * @brief Event callback of the detector: keep the event, then pass it on
+ */
+static void motion_on_event(const motion_event_t *event, void *arg) {
+    portENTER_CRITICAL(&motion_lock);
+    motion.stats.last = *event;
+    motion.stats.active = event->type != MOTION_EVENT_END;
+    motion.stats.events += event->type == MOTION_EVENT_START;
+    portEXIT_CRITICAL(&motion_lock);
+
+    if (event->type == MOTION_EVENT_START) {
+        ESP_LOGI(TAG, "Motion %" PRIu32 " at frame %" PRIu32 ": %u blocks, %u x %u at %u,%u", event->number,
+                 event->frame.sequence, event->frame.changed, event->frame.boxes[0].w, event->frame.boxes[0].h,
+                 event->frame.boxes[0].x, event->frame.boxes[0].y);
+    } else if (event->type == MOTION_EVENT_END) {
+        ESP_LOGI(TAG, "Motion %" PRIu32 " over after %" PRId64 " ms", event->number,
+                 (event->frame.time_us - event->start_us) / 1000);
+    }
+    if (motion.config.on_event) {
+        motion.config.on_event(event, motion.config.arg);
+    }
+}
+
+/**
+ * @brief Analyse a claimed frame, then release the claim
+ */
+static void motion_analyse(const uint8_t *jpg, size_t len, uint32_t sequence, int64_t time_us) {
+    const int64_t start_us = esp_timer_get_time();
+    motion_frame_t frame;
+    esp_err_t err = MotionDetectorProcess(motion.detector, jpg, len, sequence, time_us, &frame);
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - start_us);
+
+    portENTER_CRITICAL(&motion_lock);
+    if (err == ESP_OK) {
+        motion.stats.analysed++;
+        motion.stats.relearned += frame.relearned;
+        motion.stats.last_us = us;
+        motion.stats.max_us = us > motion.stats.max_us ? us : motion.stats.max_us;
+    } else {
+        motion.stats.errors++;
+    }
+    motion.busy = false;
+    portEXIT_CRITICAL(&motion_lock);
+}
+
+bool MotionAddFrame(const camera_fb_t *fb) {
+    if (!motion.running || fb->format != PIXFORMAT_JPEG || !motion_claim(fb->capture_start_us)) {
+        return false;
+    }
+    if (fb->len > motion.frame_cap) {
+        heap_caps_free(motion.frame);
+        motion.frame = heap_caps_malloc(fb->len, MALLOC_CAP_SPIRAM);
+        motion.frame_cap = motion.frame ? fb->len : 0;
+        if (motion.frame == NULL) {
+            ESP_LOGW(TAG, "No memory for a frame of %u bytes", (unsigned)fb->len);
+            motion_release();
+            return false;
+        }
+    }
+    memcpy(motion.frame, fb->buf, fb->len);
+    motion.frame_len = fb->len;
+    motion.frame_sequence = fb->sequence;
+    motion.frame_time_us = fb->capture_start_us;
+    xSemaphoreGive(motion.wake);
+    return true;
+}
+
+/**
+ * @brief Motion task: analyses the frames offered, and captures at the interval while no stream runs
+ */
+static void motion_task(void *arg) {
+    while (!motion.stopping) {
+        TickType_t wait = motion.config.capture ? pdMS_TO_TICKS(motion.config.interval_ms) : portMAX_DELAY;
+        bool woken = xSemaphoreTake(motion.wake, wait) == pdTRUE;
+        if (motion.stopping) {
+            break;
+        }
+        if (woken) {
+            motion_analyse(motion.frame, motion.frame_len, motion.frame_sequence, motion.frame_time_us);
+        } else if (motion.config.capture && StreamGetClientCount() == 0) {
+            // The camera's frame is analysed in place, it goes back right after
+            camera_fb_t *fb = esp_camera_fb_get();
+            if (fb && fb->format == PIXFORMAT_JPEG && motion_claim(fb->capture_start_us)) {
+                motion_analyse(fb->buf, fb->len, fb->sequence, fb->capture_start_us);
+            }
+            if (fb) {
+                esp_camera_fb_return(fb);
+            }
+        }
+    }
+    xSemaphoreGive(motion.done);
+    vTaskDelete(NULL);
+}
+
+int MotionInit(const motion_config_t *config) {
+    if (motion.running) {
+        return 0;
+    }
+    sensor_t *s = esp_camera_sensor_get();
+    const framesize_t largest = s ? (framesize_t)s->status.framesize : FRAMESIZE_HD;
+    const uint16_t max_width = resolution[largest > FRAMESIZE_HD ? largest : FRAMESIZE_HD].width;
+    const uint16_t max_height = resolution[largest > FRAMESIZE_HD ? largest : FRAMESIZE_HD].height;
+
+    if (motion.wake == NULL) {
+        motion.wake = xSemaphoreCreateBinary();
+        motion.done = xSemaphoreCreateBinary();
+    }
+    motion_config_t detector_config = *config;
+    detector_config.on_event = motion_on_event;
+    detector_config.arg = NULL;
+    motion.detector = MotionDetectorCreate(&detector_config, max_width, max_height);
+    motion.frame = heap_caps_malloc(MOTION_FRAME_RESERVE, MALLOC_CAP_SPIRAM);
+    motion.frame_cap = motion.frame ? MOTION_FRAME_RESERVE : 0;
+    if (motion.wake == NULL || motion.done == NULL || motion.detector == NULL || motion.frame == NULL) {
+        ESP_LOGE(TAG, "No memory for motion detection");
+        MotionDetectorFree(motion.detector);
+        heap_caps_free(motion.frame);
+        motion.detector = NULL;
+        motion.frame = NULL;
+        return -1;
+    }
+
+    motion.config = *config;
+    motion.busy = false;
+    motion.last_us = INT64_MIN / 2;
+    motion.stopping = false;
+    memset(&motion.stats, 0, sizeof(motion.stats));
+    xSemaphoreTake(motion.wake, 0);
+    motion.running = true;
+    if (xTaskCreate(motion_task, "motion", MOTION_TASK_STACK, NULL, MOTION_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "No motion task");
+        motion.stopping = true;
+        xSemaphoreGive(motion.done);
+        MotionStop();
+        return -1;
+    }
+
+    ESP_LOGI(TAG, "Motion detection on frames up to %ux%u, one per %" PRIu32 " ms", max_width, max_height,
+             config->interval_ms);
+    return 0;
+}
+
+void MotionStop(void) {
+    if (!motion.running) {
+        return;
+    }
+    motion.stopping = true;
+    xSemaphoreGive(motion.wake);
+    xSemaphoreTake(motion.done, portMAX_DELAY);
+
+    // A sender copying a frame holds the claim, wait for it to let go
+    portENTER_CRITICAL(&motion_lock);
+    motion.running = false;
+    bool busy = motion.busy;
+    portEXIT_CRITICAL(&motion_lock);
+    while (busy) {
+        vTaskDelay(1);
+        portENTER_CRITICAL(&motion_lock);
+        busy = motion.busy;
+        portEXIT_CRITICAL(&motion_lock);
+    }
+    MotionDetectorFree(motion.detector);
+    heap_caps_free(motion.frame);
+    motion.detector = NULL;
+    motion.frame = NULL;
+    motion.frame_cap = 0;
+}
+
+void MotionGetStatus(motion_status_t *status) {
+    portENTER_CRITICAL(&motion_lock);
+    *status = motion.stats;
+    portEXIT_CRITICAL(&motion_lock);
+    status->running = motion.running;
+}
+
+static const char *motion_event_name(motion_event_type_t type) {
+    switch (type) {
+    case MOTION_EVENT_START:
+        return "start";
+    case MOTION_EVENT_UPDATE:
+        return "update";
+    default:
+        return "end";
+    }
+}
+
+esp_err_t MotionStatusHandler(httpd_req_t *req) {
+    motion_status_t st;
+    MotionGetStatus(&st);
+
+    cJSON *root = cJSON_CreateObject();
+    if (root == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    cJSON_AddBoolToObject(root, "running", st.running);
+    cJSON_AddBoolToObject(root, "active", st.active);
+    cJSON_AddNumberToObject(root, "analysed", st.analysed);
+    cJSON_AddNumberToObject(root, "busy", st.busy);
+    cJSON_AddNumberToObject(root, "errors", st.errors);
+    cJSON_AddNumberToObject(root, "relearned", st.relearned);
+    cJSON_AddNumberToObject(root, "events", st.events);
+    cJSON_AddNumberToObject(root, "last_us", st.last_us);
+    cJSON_AddNumberToObject(root, "max_us", st.max_us);
+
+    // The last event and the boxes of its frame
+    if (st.last.number) {
+        cJSON *event = cJSON_CreateObject();
+        cJSON *boxes = cJSON_CreateArray();
+        if (event && boxes) {
+            cJSON_AddNumberToObject(event, "number", st.last.number);
+            cJSON_AddStringToObject(event, "type", motion_event_name(st.last.type));
+            cJSON_AddNumberToObject(event, "start_us", (double)st.last.start_us);
+            cJSON_AddNumberToObject(event, "sequence", st.last.frame.sequence);
+            cJSON_AddNumberToObject(event, "time_us", (double)st.last.frame.time_us);
+            cJSON_AddNumberToObject(event, "changed", st.last.frame.changed);
+            for (int i = 0; i < st.last.frame.box_count; i++) {
+                const motion_box_t *b = &st.last.frame.boxes[i];
+                cJSON *box = cJSON_CreateObject();
+                if (box == NULL) {
+                    break;
+                }
+                cJSON_AddNumberToObject(box, "x", b->x);
+                cJSON_AddNumberToObject(box, "y", b->y);
+                cJSON_AddNumberToObject(box, "w", b->w);
+                cJSON_AddNumberToObject(box, "h", b->h);
+                cJSON_AddNumberToObject(box, "blocks", b->blocks);
+                cJSON_AddItemToArray(boxes, box);
+            }
+            cJSON_AddItemToObject(event, "boxes", boxes);
+            cJSON_AddItemToObject(root, "last", event);
+        } else {
+            cJSON_Delete(event);
+            cJSON_Delete(boxes);
+        }
+    }
+    char *json = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (json == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+
+    httpd_resp_set_type(req, HTTPD_TYPE_JSON);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    esp_err_t res = httpd_resp_sendstr(req, json);
+    free(json);
+    return res;
+}
@@ -0,0 +1,190 @@
+/*! \file motion.h
+\brief Motion detection on the JPEG frames from their DC coefficients: a 1/8
+scale luma map per frame (esp_jpeg_decode_dc_map()), compared with a running
+background, with motion events carrying the bounding boxes of what changed
+*******************************************************************************/
+
+#ifndef MOTION_H_
+#define MOTION_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_camera.h"
+#include "esp_http_server.h"
+
+#define MOTION_MAX_BOXES 4
+
+// Region that changed, in image pixels (multiples of the 8x8 blocks)
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t blocks;            // changed blocks in it
+} motion_box_t;
+
+// What the detector found in one frame
+typedef struct {
+    uint32_t sequence;          // capture sequence number of the frame
+    int64_t time_us;            // its capture time (VSYNC)
+    uint16_t changed;           // blocks that differ from the background
+    bool relearned;             // most of the frame changed at once (light), taken as the new background
+    uint8_t box_count;          // regions with at least min_blocks blocks, largest first
+    motion_box_t boxes[MOTION_MAX_BOXES];
+} motion_frame_t;
+
+typedef enum {
+    MOTION_EVENT_START = 0,     // start_frames frames in a row had motion
+    MOTION_EVENT_UPDATE,        // another frame with motion while the event lasts
+    MOTION_EVENT_END,           // no motion for hold_ms
+} motion_event_type_t;
+
+typedef struct {
+    motion_event_type_t type;
+    uint32_t number;            // of the event, counts from 1
+    int64_t start_us;           // capture time of the frame that started it
+    motion_frame_t frame;       // the frame with motion, for END the last one
+} motion_event_t;
+
+/**
+ * @brief Event callback, runs on the task that analysed the frame
+ */
+typedef void (*motion_event_cb_t)(const motion_event_t *event, void *arg);
+
+typedef struct {
+    uint32_t interval_ms;       // least time between analysed frames
+    uint8_t threshold;          // luma difference of a block from the background that is a change
+    uint16_t min_blocks;        // changed blocks a region needs to be motion
+    uint8_t learn_shift;        // background moves 1/2^learn_shift of the way to each frame, 4 times slower where it changed
+    uint8_t relearn_percent;    // a change of more of the frame than this is light, not motion
+    uint8_t start_frames;       // frames with motion in a row that start an event
+    uint32_t hold_ms;           // an event ends this long after its last frame with motion
+    bool capture;               // take frames from the camera while no stream runs
+    motion_event_cb_t on_event; // called for every event, may be NULL
+    void *arg;                  // passed to on_event
+} motion_config_t;
+
+// Five frames a second; a change of 24 levels over 4 blocks (16x16 pixels) for two frames
+#define MOTION_DEFAULT_CONFIG() { \
+    .interval_ms = 200,         \
+    .threshold = 24,            \
+    .min_blocks = 4,            \
+    .learn_shift = 3,           \
+    .relearn_percent = 60,      \
+    .start_frames = 2,          \
+    .hold_ms = 2000,            \
+    .capture = true,            \
+    .on_event = NULL,           \
+    .arg = NULL,                \
+}
+
+typedef struct motion_detector motion_detector_t;
+
+/**
+ * @brief Create a detector for frames up to a size
+ *
+ * Everything is allocated here: the decoder work area, the luma map, the
+ * background and the labelling buffers. The first frame and a frame of
+ * another size become the background.
+ *
+ * @param config Thresholds and event settings, interval_ms and capture are not used
+ * @param max_width Width of the largest frame
+ * @param max_height Height of the largest frame
+ * @return Detector, NULL without memory
+ */
+motion_detector_t *MotionDetectorCreate(const motion_config_t *config, uint16_t max_width, uint16_t max_height);
+
+/**
+ * @brief Free a detector
+ */
+void MotionDetectorFree(motion_detector_t *m);
+
+/**
+ * @brief Analyse a frame and call on_event for the events it starts, continues or ends
+ *
+ * @param m Detector
+ * @param jpg Baseline JPEG
+ * @param len Its length
+ * @param sequence Capture sequence number
+ * @param time_us Capture time, events end by it
+ * @param frame Output, optional, what the frame showed
+ * @return ESP_OK, ESP_ERR_INVALID_SIZE for a frame larger than the detector's,
+ *         ESP_FAIL for one that does not decode
+ */
+esp_err_t MotionDetectorProcess(motion_detector_t *m, const uint8_t *jpg, size_t len, uint32_t sequence,
+                                int64_t time_us, motion_frame_t *frame);
+
+/**
+ * @brief The luma map of the last frame analysed, one byte per 8x8 block
+ *
+ * @param m Detector
+ * @param width Output, blocks per row
+ * @param height Output, rows
+ * @return The map, valid until the next frame, NULL before the first one
+ */
+const uint8_t *MotionDetectorMap(const motion_detector_t *m, uint16_t *width, uint16_t *height);
+
+typedef struct {
+    bool running;               // MotionInit() succeeded
+    bool active;                // an event is going on
+    uint32_t analysed;          // frames analysed since MotionInit()
+    uint32_t busy;              // frames offered while one was still being analysed
+    uint32_t errors;            // frames that did not decode
+    uint32_t relearned;         // frames taken as the new background
+    uint32_t events;            // events started
+    uint32_t last_us;           // time the last analysis took
+    uint32_t max_us;            // longest one
+    motion_event_t last;        // the last event, type and number 0 before the first
+} motion_status_t;
+
+/**
+ * @brief Start motion detection
+ *
+ * Starts the task that analyses one frame per interval_ms: frames the
+ * stream senders offer with MotionAddFrame() and, with config->capture,
+ * frames it takes itself while no stream runs. Call after StreamInit().
+ *
+ * @param config Settings, MOTION_DEFAULT_CONFIG() plus the event callback for the firmware's
+ * @return 0 on success, -1 without memory
+ */
+int MotionInit(const motion_config_t *config);
+
+/**
+ * @brief Stop motion detection and free the detector
+ */
+void MotionStop(void);
+
+/**
+ * @brief Offer a frame to the motion detector
+ *
+ * One frame per interval_ms is copied for the task to analyse, the others
+ * and the frames offered while it is busy go on at once.
+ *
+ * @param fb JPEG frame, the caller keeps it
+ * @return true if the frame was taken
+ */
+bool MotionAddFrame(const camera_fb_t *fb);
+
+/**
+ * @brief Read the motion state and counters
+ *
+ * @param status Filled with the state now and the counters since MotionInit()
+ */
+void MotionGetStatus(motion_status_t *status);
+
+/**
+ * @brief HTTP handler of GET /motion: the status and the last event with its boxes as JSON
+ */
+esp_err_t MotionStatusHandler(httpd_req_t *req);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MOTION_H_ */
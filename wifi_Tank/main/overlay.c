@@ -5,7 +5,12 @@
 #include "overlay.h"
 #include "esp_log.h"
 #include "cJSON.h"
+#include "img_converters.h"
+#include "freertos/FreeRTOS.h"
+#include <math.h>
+#include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
 static const char *TAG = "OVERLAY";
 
@@ -17,6 +22,82 @@ typedef struct {
     bool connected;
 } ws_client_t;
 
+// Burn-in (OverlayRender): areas handed to jpg_patch() for the MCUs an overlay covers
+#define BURN_MAX_RECTS 512
+#define BURN_LINE_PIECES 24     // most pieces a line is split into, each with its own area
+#define BURN_LINE_PIECE 32      // shortest piece in pixels
+#define BURN_DEFAULT_WIDTH 2    // line width overlay_demo.html uses for shapes without one
+
+// 5x7 font for ASCII 32-126, one byte per column, bit 0 the top row
+#define FONT_W 5
+#define FONT_H 7
+#define FONT_ADVANCE 6
+static const uint8_t font5x7[][FONT_W] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5f, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00}, // ' ' ! "
+    {0x14, 0x7f, 0x14, 0x7f, 0x14}, {0x24, 0x2a, 0x7f, 0x2a, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // # $ %
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, {0x00, 0x1c, 0x22, 0x41, 0x00}, // & ' (
+    {0x00, 0x41, 0x22, 0x1c, 0x00}, {0x14, 0x08, 0x3e, 0x08, 0x14}, {0x08, 0x08, 0x3e, 0x08, 0x08}, // ) * +
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00}, // , - .
+    {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3e, 0x51, 0x49, 0x45, 0x3e}, {0x00, 0x42, 0x7f, 0x40, 0x00}, // / 0 1
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4b, 0x31}, {0x18, 0x14, 0x12, 0x7f, 0x10}, // 2 3 4
+    {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3c, 0x4a, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // 5 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1e}, {0x00, 0x36, 0x36, 0x00, 0x00}, // 8 9 :
+    {0x00, 0x56, 0x36, 0x00, 0x00}, {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, // ; < =
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, {0x32, 0x49, 0x79, 0x41, 0x3e}, // > ? @
+    {0x7e, 0x11, 0x11, 0x11, 0x7e}, {0x7f, 0x49, 0x49, 0x49, 0x36}, {0x3e, 0x41, 0x41, 0x41, 0x22}, // A B C
+    {0x7f, 0x41, 0x41, 0x22, 0x1c}, {0x7f, 0x49, 0x49, 0x49, 0x41}, {0x7f, 0x09, 0x09, 0x09, 0x01}, // D E F
+    {0x3e, 0x41, 0x49, 0x49, 0x7a}, {0x7f, 0x08, 0x08, 0x08, 0x7f}, {0x00, 0x41, 0x7f, 0x41, 0x00}, // G H I
+    {0x20, 0x40, 0x41, 0x3f, 0x01}, {0x7f, 0x08, 0x14, 0x22, 0x41}, {0x7f, 0x40, 0x40, 0x40, 0x40}, // J K L
+    {0x7f, 0x02, 0x0c, 0x02, 0x7f}, {0x7f, 0x04, 0x08, 0x10, 0x7f}, {0x3e, 0x41, 0x41, 0x41, 0x3e}, // M N O
+    {0x7f, 0x09, 0x09, 0x09, 0x06}, {0x3e, 0x41, 0x51, 0x21, 0x5e}, {0x7f, 0x09, 0x19, 0x29, 0x46}, // P Q R
+    {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7f, 0x01, 0x01}, {0x3f, 0x40, 0x40, 0x40, 0x3f}, // S T U
+    {0x1f, 0x20, 0x40, 0x20, 0x1f}, {0x3f, 0x40, 0x38, 0x40, 0x3f}, {0x63, 0x14, 0x08, 0x14, 0x63}, // V W X
+    {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7f, 0x41, 0x41, 0x00}, // Y Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7f, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04}, // \ ] ^
+    {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, // _ ` a
+    {0x7f, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, {0x38, 0x44, 0x44, 0x48, 0x7f}, // b c d
+    {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7e, 0x09, 0x01, 0x02}, {0x0c, 0x52, 0x52, 0x52, 0x3e}, // e f g
+    {0x7f, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7d, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3d, 0x00}, // h i j
+    {0x7f, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7f, 0x40, 0x00}, {0x7c, 0x04, 0x18, 0x04, 0x78}, // k l m
+    {0x7c, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0x7c, 0x14, 0x14, 0x14, 0x08}, // n o p
+    {0x08, 0x14, 0x14, 0x18, 0x7c}, {0x7c, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20}, // q r s
+    {0x04, 0x3f, 0x44, 0x40, 0x20}, {0x3c, 0x40, 0x40, 0x20, 0x7c}, {0x1c, 0x20, 0x40, 0x20, 0x1c}, // t u v
+    {0x3c, 0x40, 0x30, 0x40, 0x3c}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0c, 0x50, 0x50, 0x50, 0x3c}, // w x y
+    {0x44, 0x64, 0x54, 0x4c, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x7f, 0x00, 0x00}, // z { |
+    {0x00, 0x41, 0x36, 0x08, 0x00}, {0x10, 0x08, 0x08, 0x10, 0x08},                                 // } ~
+};
+
+static const struct {
+    const char *name;
+    uint8_t rgb[3];
+} color_names[] = {
+    { "white", { 255, 255, 255 } }, { "black", { 0, 0, 0 } }, { "red", { 255, 0, 0 } },
+    { "lime", { 0, 255, 0 } }, { "green", { 0, 128, 0 } }, { "blue", { 0, 0, 255 } },
+    { "yellow", { 255, 255, 0 } }, { "cyan", { 0, 255, 255 } }, { "aqua", { 0, 255, 255 } },
+    { "magenta", { 255, 0, 255 } }, { "fuchsia", { 255, 0, 255 } }, { "orange", { 255, 165, 0 } },
+    { "gray", { 128, 128, 128 } }, { "grey", { 128, 128, 128 } },
+};
+
+// Overlay ready to draw: colours parsed, the areas it covers worked out
+typedef struct {
+    overlay_data_t data;
+    uint8_t text_rgb[OVERLAY_MAX_TEXT][3];
+    uint8_t shape_rgb[OVERLAY_MAX_SHAPES][3];
+    size_t rect_count;
+    jpg_roi_rect_t rects[BURN_MAX_RECTS];
+    int refs;                   // burn_latest and the OverlayBurnIn() calls drawing it
+} overlay_burn_t;
+
+// Part of the frame a draw call gets, x1 and y1 exclusive
+typedef struct {
+    uint8_t *rgb;
+    int x0, y0, x1, y1;
+} burn_area_t;
+
+// Latest overlay for OverlayBurnIn(), replaced by OverlaySendUpdate()
+static portMUX_TYPE burn_lock = portMUX_INITIALIZER_UNLOCKED;
+static overlay_burn_t *burn_latest;
+
 // Overlay state
 static struct {
     httpd_handle_t server;
@@ -43,6 +124,12 @@ static char* overlay_to_json(const overlay_data_t *overlay) {
         return NULL;
     }
 
+    // Frame the overlay belongs to
+    if (overlay->frame_sequence) {
+        cJSON_AddNumberToObject(root, "seq", overlay->frame_sequence);
+        cJSON_AddNumberToObject(root, "ts", (double)overlay->frame_time_us);
+    }
+
     // Add text array
     cJSON *text_array = cJSON_CreateArray();
     for (int i = 0; i < overlay->text_count && i < OVERLAY_MAX_TEXT; i++) {
@@ -101,10 +188,7 @@ static char* overlay_to_json(const overlay_data_t *overlay) {
     return json_string;
 }
 
-/**
- * @brief WebSocket handler for overlay updates
- */
-static esp_err_t ws_handler(httpd_req_t *req) {
+esp_err_t OverlayWsHandler(httpd_req_t *req) {
     if (req->method == HTTP_GET) {
         ESP_LOGI(TAG, "WebSocket handshake initiated");
         return ESP_OK;
@@ -201,6 +285,259 @@ static void ws_async_send(void *arg) {
     free(ws_pkt);
 }
 
+/**
+ * @brief CSS colour of an overlay element: the names the demo uses, #rgb or #rrggbb
+ */
+static void burn_parse_color(const char *name, uint8_t rgb[3]) {
+    const size_t len = strlen(name);
+    char *end = NULL;
+    const unsigned long v = name[0] == '#' ? strtoul(name + 1, &end, 16) : 0;
+    if (end && !*end && len == 7) {
+        rgb[0] = (uint8_t)(v >> 16);
+        rgb[1] = (uint8_t)(v >> 8);
+        rgb[2] = (uint8_t)v;
+        return;
+    }
+    if (end && !*end && len == 4) {
+        rgb[0] = (uint8_t)((v >> 8 & 0xf) * 17);
+        rgb[1] = (uint8_t)((v >> 4 & 0xf) * 17);
+        rgb[2] = (uint8_t)((v & 0xf) * 17);
+        return;
+    }
+    for (size_t i = 0; i < sizeof(color_names) / sizeof(color_names[0]); i++) {
+        if (strcasecmp(name, color_names[i].name) == 0) {
+            memcpy(rgb, color_names[i].rgb, 3);
+            return;
+        }
+    }
+    memset(rgb, 255, 3);
+}
+
+static int burn_text_scale(const overlay_text_t *text) {
+    // font size in pixels to glyph scale, 20px text is 14 pixels high like Arial's capitals
+    const int scale = (text->size + 5) / 10;
+    return scale < 1 ? 1 : scale;
+}
+
+static int burn_shape_width(const overlay_shape_t *shape) {
+    return shape->width ? shape->width : BURN_DEFAULT_WIDTH;
+}
+
+/**
+ * @brief Add an area to patch, [x0, x1) x [y0, y1) clipped to the frame's quadrant
+ */
+static void burn_add_rect(overlay_burn_t *b, int x0, int y0, int x1, int y1) {
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > UINT16_MAX ? UINT16_MAX : x1;
+    y1 = y1 > UINT16_MAX ? UINT16_MAX : y1;
+    if (x1 <= x0 || y1 <= y0 || b->rect_count == BURN_MAX_RECTS) {
+        return;
+    }
+    b->rects[b->rect_count++] = (jpg_roi_rect_t) {
+        (uint16_t)x0, (uint16_t)y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)
+    };
+}
+
+/**
+ * @brief Parse the colours of an overlay and collect the areas it draws on
+ *
+ * A line is split into pieces with an area each, so a diagonal does not
+ * patch its whole bounding box; a rectangle outline gets one area per edge.
+ */
+static void burn_prepare(overlay_burn_t *b, const overlay_data_t *overlay) {
+    b->data = *overlay;
+    b->data.text_count = b->data.text_count > OVERLAY_MAX_TEXT ? OVERLAY_MAX_TEXT : b->data.text_count;
+    b->data.shape_count = b->data.shape_count > OVERLAY_MAX_SHAPES ? OVERLAY_MAX_SHAPES : b->data.shape_count;
+    b->rect_count = 0;
+    b->refs = 1;
+
+    for (int i = 0; i < b->data.text_count; i++) {
+        overlay_text_t *t = &b->data.texts[i];
+        t->content[OVERLAY_MAX_TEXT_LENGTH - 1] = 0;
+        t->color[OVERLAY_MAX_COLOR_LENGTH - 1] = 0;
+        burn_parse_color(t->color, b->text_rgb[i]);
+        const int scale = burn_text_scale(t);
+        const int len = strlen(t->content);
+        if (len) {
+            // glyphs and their one pixel outline
+            burn_add_rect(b, t->x - 1, t->y - FONT_H * scale - 1,
+                          t->x + ((len - 1) * FONT_ADVANCE + FONT_W) * scale + 1, t->y + 1);
+        }
+    }
+
+    for (int i = 0; i < b->data.shape_count; i++) {
+        overlay_shape_t *s = &b->data.shapes[i];
+        s->color[OVERLAY_MAX_COLOR_LENGTH - 1] = 0;
+        burn_parse_color(s->color, b->shape_rgb[i]);
+        const int lw = burn_shape_width(s);
+        const int lo = lw / 2, hi = lw - lw / 2;
+        if (s->type == OVERLAY_SHAPE_LINE) {
+            const float dx = s->x2 - s->x1, dy = s->y2 - s->y1;
+            int pieces = (int)ceilf(sqrtf(dx * dx + dy * dy) / BURN_LINE_PIECE);
+            pieces = pieces < 1 ? 1 : pieces > BURN_LINE_PIECES ? BURN_LINE_PIECES : pieces;
+            for (int k = 0; k < pieces; k++) {
+                const float ax = s->x1 + dx * k / pieces, ay = s->y1 + dy * k / pieces;
+                const float bx = s->x1 + dx * (k + 1) / pieces, by = s->y1 + dy * (k + 1) / pieces;
+                burn_add_rect(b, (int)floorf(fminf(ax, bx)) - hi - 1, (int)floorf(fminf(ay, by)) - hi - 1,
+                              (int)ceilf(fmaxf(ax, bx)) + hi + 1, (int)ceilf(fmaxf(ay, by)) + hi + 1);
+            }
+        } else if (s->type == OVERLAY_SHAPE_RECT && s->fill) {
+            burn_add_rect(b, s->x1, s->y1, s->x1 + s->x2, s->y1 + s->y2);
+        } else if (s->type == OVERLAY_SHAPE_RECT) {
+            const int x0 = s->x1, y0 = s->y1, x1 = s->x1 + s->x2, y1 = s->y1 + s->y2;
+            burn_add_rect(b, x0 - lo, y0 - lo, x1 + hi, y0 + hi);
+            burn_add_rect(b, x0 - lo, y1 - lo, x1 + hi, y1 + hi);
+            burn_add_rect(b, x0 - lo, y0 + hi, x0 + hi, y1 - lo);
+            burn_add_rect(b, x1 - lo, y0 + hi, x1 + hi, y1 - lo);
+        } else if (s->type == OVERLAY_SHAPE_CIRCLE) {
+            const int r = s->radius + (s->fill ? 0 : hi) + 1;
+            burn_add_rect(b, s->x1 - r, s->y1 - r, s->x1 + r, s->y1 + r);
+        }
+    }
+}
+
+static void burn_release(overlay_burn_t *b) {
+    portENTER_CRITICAL(&burn_lock);
+    const bool last = --b->refs == 0;
+    portEXIT_CRITICAL(&burn_lock);
+    if (last) {
+        free(b);
+    }
+}
+
+/**
+ * @brief Fill [x0, x1) x [y0, y1) as far as it lies in the area
+ */
+static void burn_fill(const burn_area_t *a, int x0, int y0, int x1, int y1, const uint8_t rgb[3]) {
+    x0 = x0 < a->x0 ? a->x0 : x0;
+    y0 = y0 < a->y0 ? a->y0 : y0;
+    x1 = x1 > a->x1 ? a->x1 : x1;
+    y1 = y1 > a->y1 ? a->y1 : y1;
+    const int stride = (a->x1 - a->x0) * 3;
+    for (int y = y0; y < y1; y++) {
+        uint8_t *p = a->rgb + (y - a->y0) * stride + (x0 - a->x0) * 3;
+        for (int x = x0; x < x1; x++, p += 3) {
+            p[0] = rgb[0];
+            p[1] = rgb[1];
+            p[2] = rgb[2];
+        }
+    }
+}
+
+/**
+ * @brief Text with its baseline at y, outlined in black first as the demo strokes before it fills
+ */
+static void burn_draw_text(const burn_area_t *a, const overlay_text_t *t, const uint8_t rgb[3]) {
+    static const uint8_t black[3] = { 0, 0, 0 };
+    const int scale = burn_text_scale(t);
+    const int top = t->y - FONT_H * scale;
+    if (top - 1 >= a->y1 || t->y + 1 <= a->y0) {
+        return;
+    }
+    for (int grow = 1; grow >= 0; grow--) {
+        int left = t->x;
+        for (const char *c = t->content; *c && left - 1 < a->x1; c++, left += FONT_ADVANCE * scale) {
+            if (left + FONT_W * scale + 1 <= a->x0) {
+                continue;
+            }
+            const unsigned char ch = (unsigned char)*c;
+            const uint8_t *glyph = font5x7[(ch < 32 || ch > 126 ? '?' : ch) - 32];
+            for (int col = 0; col < FONT_W; col++) {
+                for (int row = 0; row < FONT_H; row++) {
+                    if (glyph[col] >> row & 1) {
+                        const int x = left + col * scale, y = top + row * scale;
+                        burn_fill(a, x - grow, y - grow, x + scale + grow, y + scale + grow, grow ? black : rgb);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Line as the canvas strokes it: pixels whose centre lies within half the width, butt ends
+ */
+static void burn_draw_line(const burn_area_t *a, const overlay_shape_t *s, const uint8_t rgb[3]) {
+    const float dx = s->x2 - s->x1, dy = s->y2 - s->y1;
+    const float len2 = dx * dx + dy * dy;
+    if (len2 == 0.0f) {
+        return;
+    }
+    const float half = burn_shape_width(s) / 2.0f, len = sqrtf(len2);
+    const int bx0 = (int)floorf(fminf(s->x1, s->x2) - half), bx1 = (int)ceilf(fmaxf(s->x1, s->x2) + half);
+    const int by0 = (int)floorf(fminf(s->y1, s->y2) - half), by1 = (int)ceilf(fmaxf(s->y1, s->y2) + half);
+    const int x0 = bx0 < a->x0 ? a->x0 : bx0, x1 = bx1 > a->x1 ? a->x1 : bx1;
+    const int y0 = by0 < a->y0 ? a->y0 : by0, y1 = by1 > a->y1 ? a->y1 : by1;
+    const int stride = (a->x1 - a->x0) * 3;
+    for (int y = y0; y < y1; y++) {
+        const float fy = y + 0.5f - s->y1;
+        for (int x = x0; x < x1; x++) {
+            const float fx = x + 0.5f - s->x1;
+            const float along = fx * dx + fy * dy;
+            if (along < 0.0f || along > len2 || fabsf(fx * dy - fy * dx) > half * len) {
+                continue;
+            }
+            uint8_t *p = a->rgb + (y - a->y0) * stride + (x - a->x0) * 3;
+            p[0] = rgb[0];
+            p[1] = rgb[1];
+            p[2] = rgb[2];
+        }
+    }
+}
+
+static void burn_draw_circle(const burn_area_t *a, const overlay_shape_t *s, const uint8_t rgb[3]) {
+    const float half = burn_shape_width(s) / 2.0f;
+    const float outer = s->fill ? s->radius : s->radius + half;
+    const float inner = s->fill ? 0.0f : (s->radius > half ? s->radius - half : 0.0f);
+    const int reach = (int)ceilf(outer);
+    const int x0 = s->x1 - reach < a->x0 ? a->x0 : s->x1 - reach, x1 = s->x1 + reach > a->x1 ? a->x1 : s->x1 + reach;
+    const int y0 = s->y1 - reach < a->y0 ? a->y0 : s->y1 - reach, y1 = s->y1 + reach > a->y1 ? a->y1 : s->y1 + reach;
+    const int stride = (a->x1 - a->x0) * 3;
+    for (int y = y0; y < y1; y++) {
+        const float fy = y + 0.5f - s->y1;
+        for (int x = x0; x < x1; x++) {
+            const float fx = x + 0.5f - s->x1;
+            const float d2 = fx * fx + fy * fy;
+            if (d2 > outer * outer || d2 < inner * inner) {
+                continue;
+            }
+            uint8_t *p = a->rgb + (y - a->y0) * stride + (x - a->x0) * 3;
+            p[0] = rgb[0];
+            p[1] = rgb[1];
+            p[2] = rgb[2];
+        }
+    }
+}
+
+/**
+ * @brief jpg_patch() callback: everything of the overlay that falls in one MCU
+ */
+static void burn_draw(void *arg, uint8_t *rgb, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    const overlay_burn_t *b = arg;
+    const burn_area_t a = { rgb, x, y, x + w, y + h };
+    for (int i = 0; i < b->data.text_count; i++) {
+        burn_draw_text(&a, &b->data.texts[i], b->text_rgb[i]);
+    }
+    for (int i = 0; i < b->data.shape_count; i++) {
+        const overlay_shape_t *s = &b->data.shapes[i];
+        if (s->type == OVERLAY_SHAPE_LINE) {
+            burn_draw_line(&a, s, b->shape_rgb[i]);
+        } else if (s->type == OVERLAY_SHAPE_RECT && s->fill) {
+            burn_fill(&a, s->x1, s->y1, s->x1 + s->x2, s->y1 + s->y2, b->shape_rgb[i]);
+        } else if (s->type == OVERLAY_SHAPE_RECT) {
+            const int lw = burn_shape_width(s), lo = lw / 2, hi = lw - lw / 2;
+            const int x0 = s->x1, y0 = s->y1, x1 = s->x1 + s->x2, y1 = s->y1 + s->y2;
+            burn_fill(&a, x0 - lo, y0 - lo, x1 + hi, y0 + hi, b->shape_rgb[i]);
+            burn_fill(&a, x0 - lo, y1 - lo, x1 + hi, y1 + hi, b->shape_rgb[i]);
+            burn_fill(&a, x0 - lo, y0 + hi, x0 + hi, y1 - lo, b->shape_rgb[i]);
+            burn_fill(&a, x1 - lo, y0 + hi, x1 + hi, y1 - lo, b->shape_rgb[i]);
+        } else if (s->type == OVERLAY_SHAPE_CIRCLE) {
+            burn_draw_circle(&a, s, b->shape_rgb[i]);
+        }
+    }
+}
+
 int OverlayInit(httpd_handle_t server) {
     if (server == NULL) {
         ESP_LOGE(TAG, "Invalid server handle");
@@ -217,30 +554,31 @@ int OverlayInit(httpd_handle_t server) {
         overlay_state.clients[i].connected = false;
     }
 
-    // Register WebSocket handler
-    httpd_uri_t ws_uri = {
-        .uri = "/ws",
-        .method = HTTP_GET,
-        .handler = ws_handler,
-        .user_ctx = NULL,
-        .is_websocket = true,
-        .handle_ws_control_frames = true
-    };
-
-    esp_err_t ret = httpd_register_uri_handler(server, &ws_uri);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to register WebSocket handler: %s", esp_err_to_name(ret));
-        return -1;
-    }
-
     overlay_state.initialized = true;
-    ESP_LOGI(TAG, "Overlay WebSocket initialized on /ws endpoint");
+    ESP_LOGI(TAG, "Overlay WebSocket system initialized");
 
     return 0;
 }
 
 int OverlaySendUpdate(const overlay_data_t *overlay) {
-    if (!overlay_state.initialized || overlay == NULL) {
+    if (overlay == NULL) {
+        return -1;
+    }
+
+    // Latest overlay for the burn-in streams, with or without WebSocket clients
+    overlay_burn_t *burn = malloc(sizeof(overlay_burn_t));
+    if (burn != NULL) {
+        burn_prepare(burn, overlay);
+        portENTER_CRITICAL(&burn_lock);
+        overlay_burn_t *old = burn_latest;
+        burn_latest = burn;
+        portEXIT_CRITICAL(&burn_lock);
+        if (old != NULL) {
+            burn_release(old);
+        }
+    }
+
+    if (!overlay_state.initialized) {
         return -1;
     }
 
@@ -265,13 +603,19 @@ int OverlaySendUpdate(const overlay_data_t *overlay) {
     ws_pkt->len = strlen(json);
     ws_pkt->type = HTTPD_WS_TYPE_TEXT;
 
-    // Update client list by checking all possible file descriptors
-    // This is a simple approach - we'll track clients when they connect
+    // Update client list from the server's open sessions, streams and page requests among them
     httpd_handle_t hd = overlay_state.server;
     overlay_state.client_count = 0;
 
+    int fds[CONFIG_LWIP_MAX_SOCKETS];
+    size_t fd_count = CONFIG_LWIP_MAX_SOCKETS;
+    if (httpd_get_client_list(hd, &fd_count, fds) != ESP_OK) {
+        fd_count = 0;
+    }
+
     // Scan for WebSocket clients
-    for (int fd = 3; fd < CONFIG_LWIP_MAX_SOCKETS; fd++) {
+    for (size_t n = 0; n < fd_count; n++) {
+        int fd = fds[n];
         httpd_ws_client_info_t client_info = httpd_ws_get_fd_info(hd, fd);
         if (client_info == HTTPD_WS_CLIENT_WEBSOCKET) {
             // Check if this fd is already tracked
@@ -312,6 +656,67 @@ int OverlaySendUpdate(const overlay_data_t *overlay) {
     return overlay_state.client_count;
 }
 
+void OverlaySetFrame(overlay_data_t *overlay, const camera_fb_t *fb) {
+    if (overlay == NULL || fb == NULL) {
+        return;
+    }
+
+    overlay->frame_sequence = fb->sequence;
+    overlay->frame_time_us = fb->capture_start_us;
+}
+
+bool OverlayRender(const overlay_data_t *overlay, const uint8_t *jpg, size_t jpg_len,
+                   uint8_t *out, size_t out_cap, size_t *out_len) {
+    if (overlay == NULL || jpg == NULL) {
+        return false;
+    }
+
+    overlay_burn_t *burn = malloc(sizeof(overlay_burn_t));
+    if (burn == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate overlay burn-in");
+        return false;
+    }
+    burn_prepare(burn, overlay);
+    bool ok = jpg_patch(jpg, jpg_len, burn->rects, burn->rect_count, burn_draw, burn, out, out_cap, out_len);
+    free(burn);
+    return ok;
+}
+
+bool OverlayBurnIn(const camera_fb_t *fb, uint8_t *out, size_t out_cap, size_t *out_len) {
+    if (fb == NULL || fb->format != PIXFORMAT_JPEG) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&burn_lock);
+    overlay_burn_t *burn = burn_latest;
+    if (burn != NULL) {
+        burn->refs++;
+    }
+    portEXIT_CRITICAL(&burn_lock);
+    if (burn == NULL) {
+        return false;
+    }
+
+    bool ok = jpg_patch(fb->buf, fb->len, burn->rects, burn->rect_count, burn_draw, burn, out, out_cap, out_len);
+    burn_release(burn);
+    return ok;
+}
+
+void OverlayDrawRgb(const overlay_data_t *overlay, uint8_t *rgb, uint16_t width, uint16_t height) {
+    if (overlay == NULL || rgb == NULL) {
+        return;
+    }
+
+    overlay_burn_t *burn = malloc(sizeof(overlay_burn_t));
+    if (burn == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate overlay burn-in");
+        return;
+    }
+    burn_prepare(burn, overlay);
+    burn_draw(burn, rgb, 0, 0, width, height);
+    free(burn);
+}
+
 void OverlayCreateSampleData(overlay_data_t *overlay) {
     if (overlay == NULL) {
         return;
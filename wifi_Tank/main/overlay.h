@@ -12,6 +12,7 @@ extern "C" {
 #include <stdint.h>
 #include <stdbool.h>
 #include "esp_http_server.h"
+#include "esp_camera.h"
 
 // Maximum overlay elements
 #define OVERLAY_MAX_TEXT 10
@@ -48,6 +49,11 @@ typedef struct {
 
 // Complete overlay data structure
 typedef struct {
+    // Video frame the overlay describes, see OverlaySetFrame(). Clients hold a
+    // tagged overlay back until that frame is on screen; 0 draws it on arrival.
+    uint32_t frame_sequence;
+    int64_t frame_time_us;
+
     uint8_t text_count;
     overlay_text_t texts[OVERLAY_MAX_TEXT];
 
@@ -58,11 +64,19 @@ typedef struct {
 /**
  * @brief Initialize overlay system with WebSocket support
  *
- * @param server HTTP server handle to attach WebSocket endpoint
+ * @param server HTTP server that routes /ws to OverlayWsHandler(), for the async sends
  * @return 0 on success, -1 on failure
  */
 int OverlayInit(httpd_handle_t server);
 
+/**
+ * @brief WebSocket handler for overlay updates (/ws)
+ *
+ * Register with is_websocket and handle_ws_control_frames set; it answers
+ * pings itself and forgets clients that close.
+ */
+esp_err_t OverlayWsHandler(httpd_req_t *req);
+
 /**
  * @brief Send overlay update to all connected WebSocket clients
  *
@@ -71,6 +85,66 @@ int OverlayInit(httpd_handle_t server);
  */
 int OverlaySendUpdate(const overlay_data_t *overlay);
 
+/**
+ * @brief Tie an overlay to the video frame it describes
+ *
+ * Sends the frame's capture sequence number and VSYNC time with the overlay.
+ * Each part of the MJPEG stream carries the same two values (X-Frame-Sequence,
+ * X-Timestamp), so a client can draw the overlay on that frame instead of
+ * whatever frame is on screen when the message arrives. Frames from
+ * StreamGetVisionFrame() carry the values of the JPEG frame they come from.
+ *
+ * @param overlay Overlay to tag
+ * @param fb Frame the overlay was computed from
+ */
+void OverlaySetFrame(overlay_data_t *overlay, const camera_fb_t *fb);
+
+/**
+ * @brief Draw an overlay into a JPEG frame
+ *
+ * For viewers that cannot run the WebSocket client (VLC, ffmpeg, recorders).
+ * Text and shapes are drawn as overlay_demo.html draws them, in frame pixels,
+ * with a 5x7 pixel font in place of the browser's. Only the MCUs under them
+ * are decoded and coded again (jpg_patch()), the rest of the frame keeps its
+ * bytes.
+ *
+ * @param overlay Overlay to draw
+ * @param jpg Baseline JPEG frame
+ * @param jpg_len Length of the frame
+ * @param out Output buffer
+ * @param out_cap Size of the output buffer, the frame is about the size of the source
+ * @param out_len Length of the frame with the overlay
+ * @return true on success, false for a frame that cannot be patched or an output buffer too small
+ */
+bool OverlayRender(const overlay_data_t *overlay, const uint8_t *jpg, size_t jpg_len,
+                   uint8_t *out, size_t out_cap, size_t *out_len);
+
+/**
+ * @brief Draw the overlay last passed to OverlaySendUpdate() into a JPEG frame
+ *
+ * OverlayRender() with the latest overlay, whether or not a WebSocket client
+ * was there to get it.
+ *
+ * @param fb JPEG frame
+ * @param out Output buffer
+ * @param out_cap Size of the output buffer
+ * @param out_len Length of the frame with the overlay
+ * @return true if out holds the frame with the overlay, false to send the frame as it is
+ */
+bool OverlayBurnIn(const camera_fb_t *fb, uint8_t *out, size_t out_cap, size_t *out_len);
+
+/**
+ * @brief Draw an overlay on a decoded RGB888 frame
+ *
+ * The same pixels OverlayRender() draws, for frames that are not JPEG.
+ *
+ * @param overlay Overlay to draw
+ * @param rgb Frame, R, G, B bytes, width * 3 bytes per row
+ * @param width Width in pixels
+ * @param height Height in pixels
+ */
+void OverlayDrawRgb(const overlay_data_t *overlay, uint8_t *rgb, uint16_t width, uint16_t height);
+
 /**
  * @brief Create sample overlay data for testing
  *
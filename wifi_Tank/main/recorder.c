@@ -0,0 +1,760 @@
+/*! \file recorder.c
+\brief Incident recorder, see recorder.h
+*******************************************************************************/
+
+#include "recorder.h"
+#include "clip.h"
+#include "stream.h"
+#include "server.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "cJSON.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+static const char *TAG = "RECORDER";
+
+#define RECORDER_TASK_STACK 4096
+#define RECORDER_TASK_PRIORITY 3    // below the stream senders
+#define RECORDER_CLIPS_LISTED 16    // newest clips /recorder lists
+#define RECORDER_THUMB_SCALE 8      // thumbnails of HD frames are 160x90
+#define RECORDER_THUMB_QUALITY 60
+#define RECORDER_THUMB_RESERVE 8192 // clip bytes set aside per thumbnail, a larger one is left out
+#define RECORDER_SEND_CHUNK 8192    // clip bytes read from flash and sent at a time
+#define RECORDER_MAX_SENDERS 2      // clip downloads at once, each by its own sender task
+#define RECORDER_SENDER_STACK 4096
+#define RECORDER_SENDER_PRIORITY 4  // below the stream senders
+
+// A frame in the ring
+typedef struct {
+    uint32_t offset;            // in the ring
+    uint32_t len;
+    uint32_t sequence;
+    int64_t time_us;            // capture time (VSYNC)
+    uint32_t id;                // counts up from 1 with every frame recorded
+} recorder_frame_t;
+
+// A clip download handed to its sender task, with the header values the response points to
+typedef struct {
+    httpd_req_t *req;
+    clip_info_t clip;
+    uint32_t offset;
+    uint32_t len;
+    char etag[32];
+    char disposition[48];
+    char range[48];
+} recorder_send_t;
+
+// Recorder state. The ring, its frames and the flush under ring_lock, the
+// interval and the counters under recorder_lock.
+static struct {
+    recorder_config_t config;
+    const esp_partition_t *part;
+    bool running;
+    volatile bool stopping;
+    uint8_t *ring;              // JPEGs back to back, wrapping to the start where the next one does not fit
+    recorder_frame_t *frames;   // FIFO of max_frames, oldest at first
+    uint32_t first;
+    uint32_t count;
+    uint32_t head;              // ring offset after the newest frame
+    size_t bytes;
+    uint32_t next_id;
+    int64_t last_us;            // capture time of the last frame recorded
+    bool flushing;
+    recorder_frame_t *flush;    // frames of the clip being written, copied at the trigger
+    uint32_t flush_count;
+    uint32_t flush_thumbs;
+    size_t flush_bytes;
+    int64_t flush_trigger_us;
+    uint32_t pin_next;          // frames pin_next..pin_last are still to be written
+    uint32_t pin_last;
+    SemaphoreHandle_t ring_lock;
+    SemaphoreHandle_t wake;     // a trigger or RecorderStop() for the task
+    SemaphoreHandle_t done;     // the task has ended
+    int senders;                // clip sender tasks, under recorder_lock
+    recorder_status_t stats;
+} recorder;
+
+static portMUX_TYPE recorder_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/**
+ * @brief Drop the oldest frame, unless a flush still has to write it. ring_lock held.
+ */
+static bool recorder_evict(void) {
+    if (recorder.count == 0) {
+        return false;
+    }
+    const recorder_frame_t *oldest = &recorder.frames[recorder.first];
+    if (recorder.flushing && oldest->id >= recorder.pin_next && oldest->id <= recorder.pin_last) {
+        return false;
+    }
+    recorder.bytes -= oldest->len;
+    recorder.first = (recorder.first + 1) % recorder.config.max_frames;
+    recorder.count--;
+    if (recorder.count == 0) {
+        recorder.head = 0;
+    }
+    portENTER_CRITICAL(&recorder_lock);
+    recorder.stats.evicted++;
+    portEXIT_CRITICAL(&recorder_lock);
+    return true;
+}
+
+/**
+ * @brief Ring offset with room for len bytes after the newest frame. ring_lock held.
+ */
+static bool recorder_room(size_t len, uint32_t *at) {
+    if (recorder.count == 0) {
+        *at = 0;
+        return len <= recorder.config.ring_bytes;
+    }
+    const uint32_t tail = recorder.frames[recorder.first].offset;
+    if (tail < recorder.head) {
+        // frames in [tail, head): room after them, else at the start
+        if (recorder.head + len <= recorder.config.ring_bytes) {
+            *at = recorder.head;
+            return true;
+        }
+        *at = 0;
+        return len <= tail;
+    }
+    // wrapped, the room is between the newest and the oldest frame
+    *at = recorder.head;
+    return recorder.head + len <= tail;
+}
+
+/**
+ * @brief Copy a frame into the ring, making room from the oldest frames
+ */
+static bool recorder_store(const uint8_t *jpg, size_t len, uint32_t sequence, int64_t time_us) {
+    xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+    if (!recorder.running) {
+        xSemaphoreGive(recorder.ring_lock);
+        return false;
+    }
+    const int64_t oldest_us = time_us - recorder.config.seconds * 1000000LL;
+    while (recorder.count > 0 && recorder.frames[recorder.first].time_us < oldest_us && recorder_evict()) {
+    }
+    uint32_t at = 0;
+    bool stored = len > 0 && len <= recorder.config.ring_bytes;
+    while (stored && (recorder.count == recorder.config.max_frames || !recorder_room(len, &at))) {
+        stored = recorder_evict();
+    }
+    if (stored) {
+        memcpy(recorder.ring + at, jpg, len);
+        recorder_frame_t *f = &recorder.frames[(recorder.first + recorder.count) % recorder.config.max_frames];
+        f->offset = at;
+        f->len = len;
+        f->sequence = sequence;
+        f->time_us = time_us;
+        f->id = recorder.next_id++;
+        recorder.count++;
+        recorder.head = at + len;
+        recorder.bytes += len;
+    }
+    xSemaphoreGive(recorder.ring_lock);
+
+    portENTER_CRITICAL(&recorder_lock);
+    if (stored) {
+        recorder.stats.recorded++;
+    } else {
+        recorder.stats.dropped++;
+    }
+    portEXIT_CRITICAL(&recorder_lock);
+    return stored;
+}
+
+bool RecorderAddFrame(const camera_fb_t *fb) {
+    if (!recorder.running || fb->format != PIXFORMAT_JPEG) {
+        return false;
+    }
+    // One sender task takes the frame, the others and the frames before the interval is up go on at once.
+    // A quarter interval of slack keeps a 10 fps source at 5 frames a second for 200 ms.
+    const int64_t interval_us = recorder.config.interval_ms * 1000LL;
+    portENTER_CRITICAL(&recorder_lock);
+    bool due = fb->capture_start_us - recorder.last_us >= interval_us - interval_us / 4;
+    if (due) {
+        recorder.last_us = fb->capture_start_us;
+    }
+    portEXIT_CRITICAL(&recorder_lock);
+    return due && recorder_store(fb->buf, fb->len, fb->sequence, fb->capture_start_us);
+}
+
+/**
+ * @brief Whether a frame gets a thumbnail, the first one and then one per thumb_interval_ms
+ */
+static bool recorder_thumb_due(int64_t time_us, int64_t *last_us) {
+    const int64_t interval_us = recorder.config.thumb_interval_ms * 1000LL;
+    if (interval_us == 0 || time_us - *last_us < interval_us) {
+        return false;
+    }
+    *last_us = time_us;
+    return true;
+}
+
+esp_err_t RecorderTrigger(void) {
+    if (!recorder.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t err = ESP_OK;
+    xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+    if (recorder.flushing) {
+        err = ESP_ERR_INVALID_STATE;
+    } else if (recorder.count == 0) {
+        err = ESP_ERR_NOT_FOUND;
+    } else {
+        // The frames as they are now; they stay in the ring until written
+        recorder.flush_count = recorder.count;
+        recorder.flush_thumbs = 0;
+        recorder.flush_bytes = 0;
+        int64_t thumb_us = INT64_MIN / 2;
+        for (uint32_t i = 0; i < recorder.count; i++) {
+            recorder.flush[i] = recorder.frames[(recorder.first + i) % recorder.config.max_frames];
+            recorder.flush_bytes += recorder.flush[i].len;
+            recorder.flush_thumbs += recorder_thumb_due(recorder.flush[i].time_us, &thumb_us);
+        }
+        recorder.flush_trigger_us = esp_timer_get_time();
+        recorder.pin_next = recorder.flush[0].id;
+        recorder.pin_last = recorder.flush[recorder.count - 1].id;
+        recorder.flushing = true;
+    }
+    xSemaphoreGive(recorder.ring_lock);
+    if (err == ESP_OK) {
+        xSemaphoreGive(recorder.wake);
+    }
+    return err;
+}
+
+/**
+ * @brief Add a thumbnail of a frame to the clip; a frame that does not decode goes without
+ */
+static esp_err_t recorder_add_thumb(clip_writer_t *w, const recorder_frame_t *f, uint32_t *thumbs) {
+    uint8_t *thumb = NULL;
+    size_t len = 0;
+    esp_err_t err = ESP_OK;
+    if (StreamJpegScale(recorder.ring + f->offset, f->len, RECORDER_THUMB_SCALE, RECORDER_THUMB_QUALITY, &thumb,
+                        &len) && len <= RECORDER_THUMB_RESERVE) {
+        err = ClipWriterAddThumb(w, thumb, len);
+        *thumbs += err == ESP_OK;
+    }
+    free(thumb);
+    return err;
+}
+
+/**
+ * @brief Write the frames of the trigger as a clip, from the ring without holding it
+ *
+ * Thumbnails are coded from the frames while they are still pinned in the ring.
+ */
+static void recorder_flush(void) {
+    const int64_t start_us = esp_timer_get_time();
+    clip_writer_t w;
+    clip_info_t clip = { 0 };
+    uint32_t thumbs = 0;
+    int64_t thumb_us = INT64_MIN / 2;
+    esp_err_t err = ClipWriterBegin(&w, recorder.part,
+                                    recorder.flush_bytes + recorder.flush_thumbs * RECORDER_THUMB_RESERVE,
+                                    recorder.flush_count + recorder.flush_thumbs, recorder.flush_trigger_us);
+    for (uint32_t i = 0; i < recorder.flush_count && err == ESP_OK; i++) {
+        if (recorder.stopping) {
+            err = ESP_ERR_INVALID_STATE;
+            break;
+        }
+        const recorder_frame_t *f = &recorder.flush[i];
+        err = ClipWriterAdd(&w, recorder.ring + f->offset, f->len, f->time_us, f->sequence);
+        if (err == ESP_OK && recorder_thumb_due(f->time_us, &thumb_us)) {
+            err = recorder_add_thumb(&w, f, &thumbs);
+        }
+
+        // Written: its room is free for new frames
+        xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+        recorder.pin_next = f->id + 1;
+        xSemaphoreGive(recorder.ring_lock);
+        vTaskDelay(1);
+    }
+    if (err == ESP_OK) {
+        err = ClipWriterFinish(&w, &clip);
+    } else {
+        ClipWriterAbort(&w);
+    }
+
+    const uint32_t ms = (uint32_t)((esp_timer_get_time() - start_us) / 1000);
+    xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+    recorder.flushing = false;
+    xSemaphoreGive(recorder.ring_lock);
+    portENTER_CRITICAL(&recorder_lock);
+    if (err == ESP_OK) {
+        recorder.stats.flushes++;
+        recorder.stats.thumbs += thumbs;
+        recorder.stats.last_clip = clip.header.number;
+        recorder.stats.last_flush_ms = ms;
+    } else {
+        recorder.stats.flush_errors++;
+    }
+    portEXIT_CRITICAL(&recorder_lock);
+
+    if (err == ESP_OK) {
+        ESP_LOGI(TAG, "Clip %" PRIu32 ": %" PRIu32 " frames, %u kB in %" PRIu32 " ms", clip.header.number,
+                 clip.header.frame_count, (unsigned)(clip.header.data_size / 1024), ms);
+    } else {
+        ESP_LOGE(TAG, "Clip not written: %s", esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief Recorder task: writes clips, and captures at the interval while no stream runs
+ */
+static void recorder_task(void *arg) {
+    while (!recorder.stopping) {
+        TickType_t wait = recorder.config.capture ? pdMS_TO_TICKS(recorder.config.interval_ms) : portMAX_DELAY;
+        bool woken = xSemaphoreTake(recorder.wake, wait) == pdTRUE;
+        if (recorder.stopping) {
+            break;
+        }
+        xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+        bool flush = recorder.flushing;
+        xSemaphoreGive(recorder.ring_lock);
+        if (flush) {
+            recorder_flush();
+        } else if (!woken && recorder.config.capture && StreamGetClientCount() == 0) {
+            camera_fb_t *fb = esp_camera_fb_get();
+            if (fb) {
+                RecorderAddFrame(fb);
+                esp_camera_fb_return(fb);
+            }
+        }
+    }
+    xSemaphoreGive(recorder.done);
+    vTaskDelete(NULL);
+}
+
+int RecorderInit(const recorder_config_t *config) {
+    if (recorder.running) {
+        return 0;
+    }
+    recorder.part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, config->partition);
+    if (recorder.part == NULL) {
+        ESP_LOGW(TAG, "No \"%s\" partition, nothing is recorded", config->partition);
+        return -1;
+    }
+    // The ring's frames span config->seconds at most, so do their thumbnails
+    uint32_t thumbs = config->thumb_interval_ms ? config->seconds * 1000 / config->thumb_interval_ms + 1 : 0;
+    thumbs = thumbs < config->max_frames ? thumbs : config->max_frames;
+    if (config->max_frames == 0 || ClipSize(config->ring_bytes + thumbs * RECORDER_THUMB_RESERVE,
+                                            config->max_frames + thumbs) > recorder.part->size) {
+        ESP_LOGE(TAG, "A clip of %u kB does not fit the partition", (unsigned)(config->ring_bytes / 1024));
+        return -1;
+    }
+
+    // The semaphores stay for another RecorderInit(), a sender may still wait on the ring
+    if (recorder.ring_lock == NULL) {
+        recorder.ring_lock = xSemaphoreCreateMutex();
+        recorder.wake = xSemaphoreCreateBinary();
+        recorder.done = xSemaphoreCreateBinary();
+    }
+    recorder.ring = heap_caps_malloc(config->ring_bytes, MALLOC_CAP_SPIRAM);
+    recorder.frames = malloc(config->max_frames * sizeof(recorder_frame_t));
+    recorder.flush = malloc(config->max_frames * sizeof(recorder_frame_t));
+    if (recorder.ring_lock == NULL || recorder.wake == NULL || recorder.done == NULL || recorder.ring == NULL ||
+        recorder.frames == NULL || recorder.flush == NULL) {
+        ESP_LOGE(TAG, "No memory for a ring of %u kB", (unsigned)(config->ring_bytes / 1024));
+        heap_caps_free(recorder.ring);
+        free(recorder.frames);
+        free(recorder.flush);
+        recorder.ring = NULL;
+        recorder.frames = NULL;
+        recorder.flush = NULL;
+        return -1;
+    }
+
+    recorder.config = *config;
+    recorder.first = 0;
+    recorder.count = 0;
+    recorder.head = 0;
+    recorder.bytes = 0;
+    recorder.next_id = 1;
+    recorder.last_us = INT64_MIN / 2;
+    recorder.flushing = false;
+    recorder.stopping = false;
+    memset(&recorder.stats, 0, sizeof(recorder.stats));
+    xSemaphoreTake(recorder.wake, 0);
+    recorder.running = true;
+    if (xTaskCreate(recorder_task, "recorder", RECORDER_TASK_STACK, NULL, RECORDER_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "No recorder task");
+        recorder.stopping = true;
+        xSemaphoreGive(recorder.done);
+        RecorderStop();
+        return -1;
+    }
+
+    ESP_LOGI(TAG, "Recording the last %" PRIu32 " s into %u kB of PSRAM, clips to \"%s\" (%" PRIu32 " kB)",
+             config->seconds, (unsigned)(config->ring_bytes / 1024), config->partition,
+             recorder.part->size / 1024);
+    return 0;
+}
+
+void RecorderStop(void) {
+    if (!recorder.running) {
+        return;
+    }
+    recorder.stopping = true;
+    xSemaphoreGive(recorder.wake);
+    xSemaphoreTake(recorder.done, portMAX_DELAY);
+
+    // No sender is in the ring once the lock is had with running false
+    xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+    recorder.running = false;
+    recorder.count = 0;
+    recorder.flushing = false;
+    xSemaphoreGive(recorder.ring_lock);
+    heap_caps_free(recorder.ring);
+    free(recorder.frames);
+    free(recorder.flush);
+    recorder.ring = NULL;
+    recorder.frames = NULL;
+    recorder.flush = NULL;
+}
+
+void RecorderGetStatus(recorder_status_t *status) {
+    portENTER_CRITICAL(&recorder_lock);
+    *status = recorder.stats;
+    portEXIT_CRITICAL(&recorder_lock);
+    status->running = recorder.running;
+    if (!recorder.running) {
+        return;
+    }
+    xSemaphoreTake(recorder.ring_lock, portMAX_DELAY);
+    status->frames = recorder.count;
+    status->bytes = recorder.bytes;
+    if (recorder.count > 0) {
+        status->oldest_us = recorder.frames[recorder.first].time_us;
+        status->newest_us = recorder.frames[(recorder.first + recorder.count - 1) % recorder.config.max_frames].time_us;
+    }
+    status->flushing = recorder.flushing;
+    if (recorder.flushing) {
+        status->flush_frames = recorder.flush_count;
+        status->flush_written = recorder.pin_next - recorder.flush[0].id;
+    }
+    xSemaphoreGive(recorder.ring_lock);
+}
+
+esp_err_t RecorderStatusHandler(httpd_req_t *req) {
+    recorder_status_t st;
+    RecorderGetStatus(&st);
+
+    cJSON *root = cJSON_CreateObject();
+    if (root == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    cJSON_AddBoolToObject(root, "running", st.running);
+    cJSON_AddNumberToObject(root, "frames", st.frames);
+    cJSON_AddNumberToObject(root, "bytes", st.bytes);
+    cJSON_AddNumberToObject(root, "seconds", st.frames ? (st.newest_us - st.oldest_us) / 1e6 : 0.0);
+    cJSON_AddBoolToObject(root, "flushing", st.flushing);
+    cJSON_AddNumberToObject(root, "flush_frames", st.flush_frames);
+    cJSON_AddNumberToObject(root, "flush_written", st.flush_written);
+    cJSON_AddNumberToObject(root, "recorded", st.recorded);
+    cJSON_AddNumberToObject(root, "evicted", st.evicted);
+    cJSON_AddNumberToObject(root, "dropped", st.dropped);
+    cJSON_AddNumberToObject(root, "flushes", st.flushes);
+    cJSON_AddNumberToObject(root, "thumbs", st.thumbs);
+    cJSON_AddNumberToObject(root, "flush_errors", st.flush_errors);
+    cJSON_AddNumberToObject(root, "last_clip", st.last_clip);
+    cJSON_AddNumberToObject(root, "last_flush_ms", st.last_flush_ms);
+
+    // The clips in flash, newest last
+    cJSON *list = cJSON_CreateArray();
+    clip_info_t *clips = st.running ? malloc(RECORDER_CLIPS_LISTED * sizeof(clip_info_t)) : NULL;
+    int count = clips ? ClipScan(recorder.part, clips, RECORDER_CLIPS_LISTED) : 0;
+    for (int i = 0; i < count && list; i++) {
+        cJSON *clip = cJSON_CreateObject();
+        if (clip == NULL) {
+            break;
+        }
+        cJSON_AddNumberToObject(clip, "number", clips[i].header.number);
+        cJSON_AddNumberToObject(clip, "frames", clips[i].header.frame_count);
+        cJSON_AddNumberToObject(clip, "bytes", clips[i].header.data_size);
+        cJSON_AddNumberToObject(clip, "trigger_us", (double)clips[i].header.trigger_us);
+        cJSON_AddNumberToObject(clip, "first_us", (double)clips[i].header.first_us);
+        cJSON_AddNumberToObject(clip, "last_us", (double)clips[i].header.last_us);
+        cJSON_AddItemToArray(list, clip);
+    }
+    free(clips);
+    if (list) {
+        cJSON_AddItemToObject(root, "clips", list);
+    }
+    char *json = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (json == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+
+    httpd_resp_set_type(req, HTTPD_TYPE_JSON);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    esp_err_t res = httpd_resp_sendstr(req, json);
+    free(json);
+    return res;
+}
+
+/**
+ * @brief Answer a request for a clip that could not be served
+ */
+static esp_err_t recorder_send_error(httpd_req_t *req, esp_err_t err) {
+    switch (err) {
+    case ESP_ERR_INVALID_STATE:
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "No recorder");
+    case ESP_ERR_INVALID_ARG:
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "n is a clip number, t a time in ms");
+    case ESP_ERR_NOT_FOUND:
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No such clip or frame");
+    default:
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief A number in the query of a request, def without the key
+ */
+static bool recorder_query_number(const char *query, const char *key, long long def, long long *value) {
+    char text[24];
+    if (httpd_query_key_value(query, key, text, sizeof(text)) != ESP_OK) {
+        *value = def;
+        return true;
+    }
+    char *end;
+    *value = strtoll(text, &end, 10);
+    return end != text && *end == 0;
+}
+
+/**
+ * @brief The clip a request names with ?n=, the newest one without
+ */
+static esp_err_t recorder_request_clip(httpd_req_t *req, char *query, size_t size, clip_info_t *clip) {
+    if (!recorder.running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (httpd_req_get_url_query_str(req, query, size) != ESP_OK) {
+        query[0] = 0;
+    }
+    long long number;
+    if (!recorder_query_number(query, "n", 0, &number) || number < 0 || number > UINT32_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ClipFind(recorder.part, (uint32_t)number, clip);
+}
+
+/**
+ * @brief Whether a clip is still in flash: a clip written over it clears the header before it erases
+ */
+static bool recorder_clip_intact(const clip_info_t *clip) {
+    clip_header_t header;
+    return ClipRead(recorder.part, clip, 0, &header, sizeof(header)) == ESP_OK &&
+           memcmp(&header, &clip->header, sizeof(header)) == 0;
+}
+
+/**
+ * @brief Send bytes of a clip from flash as the chunked body of the response
+ *
+ * Each chunk is sent only if the clip was still intact after it was read, a
+ * clip written over it meanwhile ends the body short with an error.
+ */
+static esp_err_t recorder_send_clip(httpd_req_t *req, const clip_info_t *clip, uint32_t offset, uint32_t len) {
+    uint8_t *buf = malloc(RECORDER_SEND_CHUNK);
+    if (buf == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    esp_err_t err = ESP_OK;
+    while (len > 0 && err == ESP_OK) {
+        uint32_t n = len < RECORDER_SEND_CHUNK ? len : RECORDER_SEND_CHUNK;
+        err = ClipRead(recorder.part, clip, offset, buf, n);
+        if (err == ESP_OK && !recorder_clip_intact(clip)) {
+            ESP_LOGW(TAG, "Clip %" PRIu32 " overwritten while it was sent", clip->header.number);
+            err = ESP_ERR_INVALID_STATE;
+        }
+        if (err == ESP_OK) {
+            err = httpd_resp_send_chunk(req, (const char *)buf, n);
+        }
+        offset += n;
+        len -= n;
+    }
+    free(buf);
+    return err == ESP_OK ? httpd_resp_send_chunk(req, NULL, 0) : err;
+}
+
+/**
+ * @brief Sender task of one clip download, the request from httpd_req_async_handler_begin()
+ */
+static void recorder_sender_task(void *arg) {
+    recorder_send_t *send = arg;
+    httpd_req_t *req = send->req;
+    if (recorder_send_clip(req, &send->clip, send->offset, send->len) != ESP_OK) {
+        // A body cut short ends with the connection, the client cannot take it for the whole clip
+        httpd_sess_trigger_close(req->handle, httpd_req_to_sockfd(req));
+    }
+    httpd_req_async_handler_complete(req);
+    free(send);
+
+    portENTER_CRITICAL(&recorder_lock);
+    recorder.senders--;
+    portEXIT_CRITICAL(&recorder_lock);
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Hand the body of a clip download to a sender task, the server carries on with other requests
+ *
+ * Takes send, freed by the task or here.
+ */
+static esp_err_t recorder_send_async(httpd_req_t *req, recorder_send_t *send) {
+    portENTER_CRITICAL(&recorder_lock);
+    bool admitted = recorder.senders < RECORDER_MAX_SENDERS;
+    if (admitted) {
+        recorder.senders++;
+    }
+    portEXIT_CRITICAL(&recorder_lock);
+    if (!admitted) {
+        free(send);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "Too many clip downloads");
+    }
+
+    if (httpd_req_async_handler_begin(req, &send->req) == ESP_OK) {
+        if (xTaskCreate(recorder_sender_task, "clip_tx", RECORDER_SENDER_STACK, send, RECORDER_SENDER_PRIORITY,
+                        NULL) == pdPASS) {
+            return ESP_OK;
+        }
+        httpd_req_async_handler_complete(send->req);
+    }
+
+    ESP_LOGE(TAG, "No sender task for a clip download");
+    free(send);
+    portENTER_CRITICAL(&recorder_lock);
+    recorder.senders--;
+    portEXIT_CRITICAL(&recorder_lock);
+    return ESP_FAIL;
+}
+
+esp_err_t RecorderClipHandler(httpd_req_t *req) {
+    char query[64];
+    recorder_send_t *send = malloc(sizeof(recorder_send_t));
+    if (send == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    esp_err_t err = recorder_request_clip(req, query, sizeof(query), &send->clip);
+    if (err != ESP_OK) {
+        free(send);
+        return recorder_send_error(req, err);
+    }
+
+    // The header CRC covers those of the index and the frames, it names the clip's bytes
+    const clip_info_t *clip = &send->clip;
+    const uint32_t size = ClipFileSize(clip);
+    snprintf(send->etag, sizeof(send->etag), "\"clip-%" PRIu32 "-%08" PRIx32 "\"", clip->header.number,
+             clip->header.header_crc);
+    snprintf(send->disposition, sizeof(send->disposition), "attachment; filename=clip-%" PRIu32 ".clip",
+             clip->header.number);
+    httpd_resp_set_type(req, HTTPD_TYPE_OCTET);
+    httpd_resp_set_hdr(req, "Accept-Ranges", "bytes");
+    httpd_resp_set_hdr(req, "ETag", send->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if (ServerEtagMatches(req, send->etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        err = httpd_resp_send(req, NULL, 0);
+        free(send);
+        return err;
+    }
+    httpd_resp_set_hdr(req, "Content-Disposition", send->disposition);
+
+    uint32_t first = 0;
+    uint32_t last = size - 1;
+    switch (ServerRange(req, size, &first, &last)) {
+    case -1:
+        snprintf(send->range, sizeof(send->range), "bytes */%" PRIu32, size);
+        httpd_resp_set_hdr(req, "Content-Range", send->range);
+        httpd_resp_set_status(req, "416 Range Not Satisfiable");
+        err = httpd_resp_send(req, NULL, 0);
+        free(send);
+        return err;
+    case 1:
+        snprintf(send->range, sizeof(send->range), "bytes %" PRIu32 "-%" PRIu32 "/%" PRIu32, first, last, size);
+        httpd_resp_set_hdr(req, "Content-Range", send->range);
+        httpd_resp_set_status(req, "206 Partial Content");
+        break;
+    default:
+        break;
+    }
+    send->offset = first;
+    send->len = last - first + 1;
+    return recorder_send_async(req, send);
+}
+
+esp_err_t RecorderFrameHandler(httpd_req_t *req) {
+    char query[64];
+    clip_info_t clip;
+    esp_err_t err = recorder_request_clip(req, query, sizeof(query), &clip);
+    long long t_ms;
+    long long thumb;
+    if (err == ESP_OK && (!recorder_query_number(query, "t", 0, &t_ms) ||
+                          !recorder_query_number(query, "thumb", 0, &thumb))) {
+        err = ESP_ERR_INVALID_ARG;
+    }
+    uint32_t index = 0;
+    clip_entry_t entry;
+    if (err == ESP_OK) {
+        err = ClipSeek(recorder.part, &clip, clip.header.first_us + t_ms * 1000, thumb != 0, &index, &entry);
+    }
+    if (err != ESP_OK) {
+        return recorder_send_error(req, err);
+    }
+
+    char etag[40];
+    char index_text[12];
+    char offset[12];
+    char sequence[12];
+    char timestamp[24];
+    snprintf(etag, sizeof(etag), "\"clip-%" PRIu32 "-%08" PRIx32 "-%" PRIu32 "\"", clip.header.number,
+             clip.header.header_crc, index);
+    snprintf(index_text, sizeof(index_text), "%" PRIu32, index);
+    snprintf(offset, sizeof(offset), "%" PRIu32, entry.offset);
+    snprintf(sequence, sizeof(sequence), "%" PRIu32, entry.sequence);
+    snprintf(timestamp, sizeof(timestamp), "%" PRId64 ".%06" PRId64, entry.time_us / 1000000,
+             entry.time_us % 1000000);
+    httpd_resp_set_type(req, "image/jpeg");
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_set_hdr(req, "X-Frame-Index", index_text);
+    httpd_resp_set_hdr(req, "X-Clip-Offset", offset);
+    httpd_resp_set_hdr(req, "X-Frame-Sequence", sequence);
+    httpd_resp_set_hdr(req, "X-Timestamp", timestamp);
+    if (ServerEtagMatches(req, etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    return recorder_send_clip(req, &clip, entry.offset, entry.len);
+}
+
+esp_err_t RecorderTriggerHandler(httpd_req_t *req) {
+    esp_err_t err = RecorderTrigger();
+    httpd_resp_set_type(req, HTTPD_TYPE_JSON);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    if (err == ESP_OK) {
+        char body[48];
+        snprintf(body, sizeof(body), "{\"frames\":%" PRIu32 "}", recorder.flush_count);
+        httpd_resp_set_status(req, "202 Accepted");
+        return httpd_resp_sendstr(req, body);
+    }
+    if (err == ESP_ERR_INVALID_STATE && recorder.running) {
+        httpd_resp_set_status(req, "409 Conflict");
+        return httpd_resp_sendstr(req, "{\"error\":\"a clip is being written\"}");
+    }
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    return httpd_resp_sendstr(req, recorder.running ? "{\"error\":\"no frames\"}" : "{\"error\":\"no recorder\"}");
+}
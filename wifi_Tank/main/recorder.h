@@ -0,0 +1,144 @@
+/*! \file recorder.h
+\brief Incident recorder: the last seconds of frames in a PSRAM ring, written
+to the recorder flash partition as a clip (clip.h) on a trigger
+*******************************************************************************/
+
+#ifndef RECORDER_H_
+#define RECORDER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_camera.h"
+#include "esp_http_server.h"
+
+typedef struct {
+    const char *partition;      // label of the data partition in partitions.csv
+    size_t ring_bytes;          // PSRAM for the JPEGs, and the largest clip
+    uint32_t max_frames;        // frames the ring and a clip hold
+    uint32_t seconds;           // frames older than this leave the ring
+    uint32_t interval_ms;       // least time between recorded frames
+    bool capture;               // take frames from the camera while no stream runs
+    uint32_t thumb_interval_ms; // a clip has a thumbnail of its first frame and of one this much later, ..., 0 for none
+} recorder_config_t;
+
+// About 20 HD frames at the firmware's JPEG quality fit the ring, a clip fits the partition
+#define RECORDER_DEFAULT_CONFIG() { \
+    .partition = "recorder",        \
+    .ring_bytes = 1536 * 1024,      \
+    .max_frames = 512,              \
+    .seconds = 10,                  \
+    .interval_ms = 200,             \
+    .capture = true,                \
+    .thumb_interval_ms = 1000,      \
+}
+
+typedef struct {
+    bool running;               // RecorderInit() succeeded
+    uint32_t frames;            // frames in the ring
+    size_t bytes;               // their JPEG bytes
+    int64_t oldest_us;          // capture time of the oldest and the newest, 0 without frames
+    int64_t newest_us;
+    bool flushing;              // a clip is being written
+    uint32_t flush_frames;      // frames of that clip
+    uint32_t flush_written;     // of them written so far
+    uint32_t recorded;          // frames put into the ring since RecorderInit()
+    uint32_t evicted;           // frames that left the ring, too old or for room
+    uint32_t dropped;           // frames not recorded: larger than the ring, or its room held by a flush
+    uint32_t flushes;           // clips written
+    uint32_t thumbs;            // thumbnails written into them
+    uint32_t flush_errors;      // clips not written for a flash or memory error
+    uint32_t last_clip;         // number of the last clip written, 0 for none
+    uint32_t last_flush_ms;     // time it took
+} recorder_status_t;
+
+/**
+ * @brief Start the recorder
+ *
+ * Allocates the ring in PSRAM and starts the task that writes clips (and,
+ * with config->capture, captures while no stream runs). Call after
+ * StreamInit().
+ *
+ * @param config Settings, RECORDER_DEFAULT_CONFIG() for the firmware's
+ * @return 0 on success, -1 without the partition or memory
+ */
+int RecorderInit(const recorder_config_t *config);
+
+/**
+ * @brief Stop the recorder and free the ring; a clip being written is abandoned
+ */
+void RecorderStop(void);
+
+/**
+ * @brief Offer a frame to the recorder
+ *
+ * The stream sender tasks offer every frame they send. One frame per
+ * interval_ms is copied into the ring; the oldest frames make room. Frames
+ * of a clip being written stay until written, a new frame that needs their
+ * room is dropped instead.
+ *
+ * @param fb JPEG frame, the caller keeps it
+ * @return true if the frame was recorded
+ */
+bool RecorderAddFrame(const camera_fb_t *fb);
+
+/**
+ * @brief Write the frames in the ring to flash as a clip
+ *
+ * Returns at once; the recorder task writes the clip while recording goes
+ * on, see RecorderGetStatus().
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_STATE while a clip is being written or
+ *         without RecorderInit(), ESP_ERR_NOT_FOUND with an empty ring
+ */
+esp_err_t RecorderTrigger(void);
+
+/**
+ * @brief Read the recorder state and counters
+ *
+ * @param status Filled with the state now and the counters since RecorderInit()
+ */
+void RecorderGetStatus(recorder_status_t *status);
+
+/**
+ * @brief HTTP handler of GET /recorder: the status and the clips in flash as JSON
+ */
+esp_err_t RecorderStatusHandler(httpd_req_t *req);
+
+/**
+ * @brief HTTP handler of GET /recorder/clip?n=<number>: a clip as a file (clip.h)
+ *
+ * The newest clip without n. Answers a Range request with 206 and the bytes
+ * asked for, so a player can fetch the index and then single frames; the
+ * ETag names the clip. The body goes out from a sender task; a clip written
+ * over it meanwhile ends the body short and closes the connection. 404 for a
+ * clip not in flash, 503 without recorder or with too many downloads at once.
+ */
+esp_err_t RecorderClipHandler(httpd_req_t *req);
+
+/**
+ * @brief HTTP handler of GET /recorder/frame?n=<number>&t=<ms>[&thumb=1]: one JPEG of a clip
+ *
+ * The frame shown t ms after the first frame of the clip (the newest clip
+ * without n), found with a binary search of the index, or with thumb=1 its
+ * nearest thumbnail before. X-Frame-Index, X-Clip-Offset, X-Frame-Sequence
+ * and X-Timestamp tell which frame it is and where in /recorder/clip.
+ */
+esp_err_t RecorderFrameHandler(httpd_req_t *req);
+
+/**
+ * @brief HTTP handler of POST /recorder/trigger: 202 once the clip is being
+ *        written, 409 while another one is, 503 without frames or recorder
+ */
+esp_err_t RecorderTriggerHandler(httpd_req_t *req);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RECORDER_H_ */
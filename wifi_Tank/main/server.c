@@ -0,0 +1,276 @@
+/*! \file server.c
+\brief The HTTP server: one httpd instance and its route table for the web
+pages, the MJPEG stream, the overlay WebSocket and the status endpoints
+*******************************************************************************/
+
+#include "server.h"
+#include "stream.h"
+#include "overlay.h"
+#include "recorder.h"
+#include "motion.h"
+#include "web_assets.h"
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "cJSON.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+static const char *TAG = "SERVER";
+
+// Sockets of the pool: the stream clients, the WebSocket clients and a few page requests.
+// lwIP has CONFIG_LWIP_MAX_SOCKETS (16), httpd keeps 3 of them for itself.
+#define SERVER_MAX_SOCKETS 12
+
+static httpd_handle_t server_handle;
+
+// Status figures shared by /stats and /metrics
+typedef struct {
+    int64_t uptime_ms;
+    uint32_t free_heap;
+    uint32_t min_free_heap;
+    int stream_clients;
+    float stream_fps;
+    uint32_t stream_frames;
+    stream_skip_stats_t skip;
+    int overlay_clients;
+} server_stats_t;
+
+static void server_collect(server_stats_t *st) {
+    st->uptime_ms = esp_timer_get_time() / 1000;
+    st->free_heap = esp_get_free_heap_size();
+    st->min_free_heap = esp_get_minimum_free_heap_size();
+    st->stream_clients = StreamGetClientCount();
+    st->stream_fps = StreamGetFps();
+    st->stream_frames = StreamGetFrameCount();
+    StreamGetSkipStats(&st->skip);
+    st->overlay_clients = OverlayGetClientCount();
+}
+
+/**
+ * @brief HTTP handler for /stats, the status as JSON
+ */
+static esp_err_t server_stats_handler(httpd_req_t *req) {
+    server_stats_t st;
+    server_collect(&st);
+
+    cJSON *root = cJSON_CreateObject();
+    if (root == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    cJSON_AddNumberToObject(root, "uptime_ms", (double)st.uptime_ms);
+    cJSON_AddNumberToObject(root, "free_heap", st.free_heap);
+    cJSON_AddNumberToObject(root, "min_free_heap", st.min_free_heap);
+    cJSON_AddNumberToObject(root, "stream_clients", st.stream_clients);
+    cJSON_AddNumberToObject(root, "stream_fps", st.stream_fps);
+    cJSON_AddNumberToObject(root, "stream_frames", st.stream_frames);
+    cJSON_AddNumberToObject(root, "stream_skipped", st.skip.skipped);
+    cJSON_AddNumberToObject(root, "stream_skipped_bytes", (double)st.skip.skipped_bytes);
+    cJSON_AddNumberToObject(root, "stream_keepalives", st.skip.keepalives);
+    cJSON_AddNumberToObject(root, "overlay_clients", st.overlay_clients);
+    char *json = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (json == NULL) {
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+
+    httpd_resp_set_type(req, HTTPD_TYPE_JSON);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    esp_err_t res = httpd_resp_sendstr(req, json);
+    free(json);
+    return res;
+}
+
+/**
+ * @brief HTTP handler for /metrics, the status in the Prometheus text format
+ */
+static esp_err_t server_metrics_handler(httpd_req_t *req) {
+    server_stats_t st;
+    server_collect(&st);
+
+    char text[1024];
+    int len = snprintf(text, sizeof(text),
+        "# TYPE wifi_tank_uptime_seconds gauge\n"
+        "wifi_tank_uptime_seconds %.3f\n"
+        "# TYPE wifi_tank_free_heap_bytes gauge\n"
+        "wifi_tank_free_heap_bytes %" PRIu32 "\n"
+        "# TYPE wifi_tank_min_free_heap_bytes gauge\n"
+        "wifi_tank_min_free_heap_bytes %" PRIu32 "\n"
+        "# TYPE wifi_tank_stream_clients gauge\n"
+        "wifi_tank_stream_clients %d\n"
+        "# TYPE wifi_tank_sensor_fps gauge\n"
+        "wifi_tank_sensor_fps %.2f\n"
+        "# TYPE wifi_tank_stream_frames_total counter\n"
+        "wifi_tank_stream_frames_total %" PRIu32 "\n"
+        "# TYPE wifi_tank_stream_skipped_frames_total counter\n"
+        "wifi_tank_stream_skipped_frames_total %" PRIu32 "\n"
+        "# TYPE wifi_tank_stream_skipped_bytes_total counter\n"
+        "wifi_tank_stream_skipped_bytes_total %" PRIu64 "\n"
+        "# TYPE wifi_tank_stream_keepalive_frames_total counter\n"
+        "wifi_tank_stream_keepalive_frames_total %" PRIu32 "\n"
+        "# TYPE wifi_tank_overlay_clients gauge\n"
+        "wifi_tank_overlay_clients %d\n",
+        st.uptime_ms / 1000.0, st.free_heap, st.min_free_heap, st.stream_clients,
+        st.stream_fps, st.stream_frames, st.skip.skipped, st.skip.skipped_bytes, st.skip.keepalives,
+        st.overlay_clients);
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, text, len);
+}
+
+bool ServerEtagMatches(httpd_req_t *req, const char *etag) {
+    char value[128];
+    if (httpd_req_get_hdr_value_len(req, "If-None-Match") == 0
+        || httpd_req_get_hdr_value_str(req, "If-None-Match", value, sizeof(value)) != ESP_OK) {
+        return false;
+    }
+    return strcmp(value, "*") == 0 || strstr(value, etag) != NULL;
+}
+
+int ServerRange(httpd_req_t *req, uint32_t size, uint32_t *first, uint32_t *last) {
+    char value[64];
+    if (httpd_req_get_hdr_value_len(req, "Range") == 0
+        || httpd_req_get_hdr_value_str(req, "Range", value, sizeof(value)) != ESP_OK
+        || strncmp(value, "bytes=", 6) != 0 || strchr(value, ',') != NULL) {
+        return 0;
+    }
+    const char *p = value + 6;
+    char *end;
+    if (*p == '-') {
+        // the last bytes
+        unsigned long suffix = strtoul(p + 1, &end, 10);
+        if (end == p + 1 || *end != 0) {
+            return 0;
+        }
+        if (suffix == 0 || size == 0) {
+            return -1;
+        }
+        *first = suffix < size ? size - suffix : 0;
+        *last = size - 1;
+        return 1;
+    }
+    unsigned long from = strtoul(p, &end, 10);
+    if (end == p || *end != '-') {
+        return 0;
+    }
+    p = end + 1;
+    unsigned long to = size ? size - 1 : 0;
+    if (*p != 0) {
+        to = strtoul(p, &end, 10);
+        if (end == p || *end != 0 || to < from) {
+            return 0;
+        }
+    }
+    if (from >= size) {
+        return -1;
+    }
+    *first = from;
+    *last = to < size ? to : size - 1;
+    return 1;
+}
+
+/**
+ * @brief HTTP handler serving an embedded page, the web_asset_t in user_ctx
+ *
+ * Pages are sent gzip compressed with their ETag. Browsers revalidate on
+ * every load (Cache-Control: no-cache) and get 304 until the firmware changes.
+ */
+static esp_err_t server_asset_handler(httpd_req_t *req) {
+    const web_asset_t *asset = req->user_ctx;
+    httpd_resp_set_type(req, asset->type);
+    httpd_resp_set_hdr(req, "ETag", asset->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if (ServerEtagMatches(req, asset->etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char *)asset->gzip, asset->gzip_len);
+}
+
+// Routes besides the web pages
+static const httpd_uri_t server_routes[] = {
+    { .uri = "/stream", .method = HTTP_GET, .handler = StreamHttpHandler },
+    { .uri = "/snapshot.jpg", .method = HTTP_GET, .handler = StreamSnapshotHandler },
+    { .uri = "/ws", .method = HTTP_GET, .handler = OverlayWsHandler,
+      .is_websocket = true, .handle_ws_control_frames = true },
+    { .uri = "/stats", .method = HTTP_GET, .handler = server_stats_handler },
+    { .uri = "/metrics", .method = HTTP_GET, .handler = server_metrics_handler },
+    { .uri = "/recorder", .method = HTTP_GET, .handler = RecorderStatusHandler },
+    { .uri = "/recorder/trigger", .method = HTTP_POST, .handler = RecorderTriggerHandler },
+    { .uri = "/recorder/clip", .method = HTTP_GET, .handler = RecorderClipHandler },
+    { .uri = "/recorder/frame", .method = HTTP_GET, .handler = RecorderFrameHandler },
+    { .uri = "/motion", .method = HTTP_GET, .handler = MotionStatusHandler },
+};
+
+#define SERVER_ROUTES (sizeof(server_routes) / sizeof(server_routes[0]))
+
+int ServerInit(uint16_t port) {
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = port;
+    config.max_open_sockets = SERVER_MAX_SOCKETS;
+    config.max_uri_handlers = SERVER_ROUTES + web_assets_count;
+    config.lru_purge_enable = true;
+    config.send_wait_timeout = 10;
+    config.recv_wait_timeout = 10;
+    config.backlog_conn = 5;
+
+    ESP_LOGI(TAG, "Starting HTTP server on port %d", port);
+
+    esp_err_t err = httpd_start(&server_handle, &config);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start HTTP server: %s", esp_err_to_name(err));
+        server_handle = NULL;
+        return -1;
+    }
+
+    // The WebSocket handler sends through the server, it needs the handle first
+    if (OverlayInit(server_handle) != 0) {
+        ESP_LOGW(TAG, "Failed to initialize overlay WebSocket");
+    }
+
+    for (size_t i = 0; i < SERVER_ROUTES; i++) {
+        err = httpd_register_uri_handler(server_handle, &server_routes[i]);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Route %s not registered: %s", server_routes[i].uri, esp_err_to_name(err));
+        }
+    }
+    for (size_t i = 0; i < web_assets_count; i++) {
+        httpd_uri_t asset_uri = {
+            .uri = web_assets[i].uri,
+            .method = HTTP_GET,
+            .handler = server_asset_handler,
+            .user_ctx = (void *)&web_assets[i]
+        };
+        err = httpd_register_uri_handler(server_handle, &asset_uri);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Route %s not registered: %s", web_assets[i].uri, esp_err_to_name(err));
+        }
+    }
+
+    ESP_LOGI(TAG, "Overlay demo at: http://[ESP32-IP]:%d/", port);
+    ESP_LOGI(TAG, "Player at: http://[ESP32-IP]:%d/player", port);
+    ESP_LOGI(TAG, "Stream at: http://[ESP32-IP]:%d/stream", port);
+    ESP_LOGI(TAG, "With the overlay drawn in: http://[ESP32-IP]:%d/stream?overlay=1", port);
+    ESP_LOGI(TAG, "Snapshot at: http://[ESP32-IP]:%d/snapshot.jpg", port);
+    ESP_LOGI(TAG, "Overlay WebSocket at: ws://[ESP32-IP]:%d/ws", port);
+    ESP_LOGI(TAG, "Status at: http://[ESP32-IP]:%d/stats and /metrics", port);
+    ESP_LOGI(TAG, "Recorder at: http://[ESP32-IP]:%d/recorder, POST /recorder/trigger to keep a clip", port);
+    ESP_LOGI(TAG, "Clips at: http://[ESP32-IP]:%d/recorder/clip?n=1, frames at /recorder/frame?n=1&t=2500", port);
+    ESP_LOGI(TAG, "Motion detection at: http://[ESP32-IP]:%d/motion", port);
+    return 0;
+}
+
+void ServerStop(void) {
+    if (server_handle != NULL) {
+        httpd_stop(server_handle);
+        server_handle = NULL;
+    }
+}
+
+httpd_handle_t ServerGetHandle(void) {
+    return server_handle;
+}
@@ -0,0 +1,74 @@
+/*! \file server.h
+\brief The HTTP server: web pages, MJPEG stream, overlay WebSocket and status on one port
+*******************************************************************************/
+
+#ifndef SERVER_H_
+#define SERVER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_http_server.h"
+
+/**
+ * @brief Start the HTTP server
+ *
+ * One server task and socket pool for every route: the web pages
+ * (web_assets.h), /stream (StreamHttpHandler(), each stream on a sender task
+ * of its own), /snapshot.jpg (StreamSnapshotHandler()), /ws
+ * (OverlayWsHandler()), /stats (JSON) and /metrics (Prometheus text). Call
+ * after StreamInit(); /stream and /snapshot.jpg answer 503 without a camera.
+ *
+ * @param port HTTP port
+ * @return 0 on success, -1 on failure
+ */
+int ServerInit(uint16_t port);
+
+/**
+ * @brief Stop the HTTP server, after the stream clients are gone
+ */
+void ServerStop(void);
+
+/**
+ * @brief Whether the If-None-Match header of the request names this ETag
+ *
+ * The comparison is the weak one RFC 9110 asks for here, so W/"tag" and
+ * lists match as well. A header too long for the buffer does not match.
+ *
+ * @param req HTTP request
+ * @param etag ETag of the resource, quotes included
+ * @return true to answer 304 Not Modified
+ */
+bool ServerEtagMatches(httpd_req_t *req, const char *etag);
+
+/**
+ * @brief The byte range the Range header of the request asks for
+ *
+ * One range of the forms bytes=first-last, bytes=first- and bytes=-suffix.
+ * A header with several ranges or one that does not parse is ignored, as
+ * RFC 9110 allows, and the whole resource is sent.
+ *
+ * @param req HTTP request
+ * @param size Bytes of the resource
+ * @param first Output, first byte of the range
+ * @param last Output, last byte of the range, included
+ * @return 1 for a range to answer 206 with, 0 to send the whole resource,
+ *         -1 for a range outside it (416 Range Not Satisfiable)
+ */
+int ServerRange(httpd_req_t *req, uint32_t size, uint32_t *first, uint32_t *last);
+
+/**
+ * @brief Get the HTTP server handle
+ *
+ * @return HTTP server handle or NULL if not started
+ */
+httpd_handle_t ServerGetHandle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SERVER_H_ */
@@ -4,11 +4,21 @@
 
 #include "stream.h"
 #include "overlay.h"
+#include "server.h"
+#include "recorder.h"
+#include "motion.h"
 #include "esp_log.h"
 #include "esp_http_server.h"
 #include "esp_camera.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "img_converters.h"
+#include "jpeg_decoder.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <inttypes.h>
 
@@ -33,24 +43,56 @@ static const char *TAG = "STREAM";
 #define CAM_PIN_HREF    23
 #define CAM_PIN_PCLK    22
 
+// NVS namespace of the cached sensor state, a firmware update invalidates it
+#define CAMERA_CACHE_NVS "cam_boot"
+
+// NVS namespace of the sensor presets
+#define CAMERA_PRESET_NVS "cam_preset"
+
+// Grayscale frames for on-device vision: 160x90 from every 6th HD frame
+#define VISION_EVERY 6
+#define VISION_SCALE_DIV 8
+
 // Stream configuration
 #define STREAM_BOUNDARY "123456789000000000000987654321"
 #define STREAM_CONTENT_TYPE "multipart/x-mixed-replace;boundary=" STREAM_BOUNDARY
 #define STREAM_PART_BOUNDARY "\r\n--" STREAM_BOUNDARY "\r\n"
-#define STREAM_PART_HEADER "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n"
+// Capture sequence number and VSYNC time (seconds.microseconds of esp_timer) of the
+// frame, the same values OverlaySetFrame() puts in the overlays describing it
+#define STREAM_PART_HEADER "Content-Type: image/jpeg\r\nContent-Length: %u\r\n" \
+                           "X-Frame-Sequence: %" PRIu32 "\r\nX-Timestamp: %" PRId64 ".%06" PRId64 "\r\n\r\n"
+
+// Stream clients served at once, each by its own sender task
+#define STREAM_MAX_CLIENTS 4
+#define STREAM_SENDER_STACK 4096
+#define STREAM_SENDER_PRIORITY 5
+
+// Duplicate frame suppression
+#define SKIP_MAX_SAMPLES 4096       // the cells grow for frames with more blocks
+
+// Snapshot configuration
+#define SNAPSHOT_KEEP_MS 5000       // streams copy their frames into the slot this long after a snapshot request
+#define SNAPSHOT_WAIT_MS 1000       // longest wait for a streamed frame before capturing one
+#define SNAPSHOT_MAX_AGE_MS 500     // without streams, a captured frame answers the requests this long
+#define SNAPSHOT_STALE_FRAMES 3     // fb_count of camera_init(), frames queued before a capture
+#define SNAPSHOT_QUALITY 80         // JPEG quality of downscaled snapshots
+
+// Snapshot requests answered at once, each by its own task
+#define SNAPSHOT_MAX_REQUESTS 5     // the listen backlog of ServerInit()
+#define SNAPSHOT_TASK_STACK 4096
+#define SNAPSHOT_TASK_PRIORITY 4
 
 // Stream state
 static struct {
-    httpd_handle_t server;
-    uint16_t port;
     bool camera_initialized;
     bool streaming;
     int client_count;
     uint32_t frame_count;
     uint32_t last_frame_time;
+    uint32_t last_sequence;     // newest capture sequence number seen by any client
+    int64_t last_capture_us;    // its VSYNC time
+    float frame_period_us;      // smoothed sensor frame period
 } stream_state = {
-    .server = NULL,
-    .port = 0,
     .camera_initialized = false,
     .streaming = false,
     .client_count = 0,
@@ -58,6 +100,342 @@ static struct {
     .last_frame_time = 0
 };
 
+// Client count and frame statistics, updated by every sender task
+static portMUX_TYPE stream_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// A JPEG shared by snapshot requests, freed with its last reference
+typedef struct {
+    int refs;
+    uint32_t sequence;
+    int64_t capture_start_us;
+    uint8_t scale;              // 1 for the frame as captured
+    size_t len;
+    uint8_t data[];
+} snapshot_frame_t;
+
+// Snapshot slot; pointers, references and counters under stream_lock
+static struct {
+    snapshot_frame_t *latest;   // newest frame as captured
+    snapshot_frame_t *scaled;   // a frame downscaled, at the last scale asked for
+    int64_t wanted_until_us;    // sender tasks copy their frames into the slot until then
+    SemaphoreHandle_t work;     // one request captures or downscales at a time
+    int tasks;                  // snapshot tasks answering a request
+    stream_snapshot_stats_t stats;
+} snapshot_state;
+
+// DC samples of a frame, the mean of a cell of 8x8 blocks per byte
+typedef struct {
+    uint32_t sequence;
+    int64_t capture_start_us;
+    uint8_t step;               // the sample_step it was sampled at
+    uint16_t width;             // block map size, 0 for a frame that did not decode
+    uint16_t height;
+    uint16_t count;
+    uint8_t samples[SKIP_MAX_SAMPLES];
+} skip_samples_t;
+
+// Duplicate suppression; config and stats under stream_lock, the decoder and latest under work
+static struct {
+    stream_skip_config_t config;
+    SemaphoreHandle_t work;     // one sender decodes at a time
+    uint8_t *work_area;         // tjpgd work area, allocated by the first frame sampled
+    uint8_t *map;               // DC luma map of the frame
+    size_t map_cap;
+    skip_samples_t latest;      // the last frame sampled, for the other senders of the same frame
+    uint32_t sums[SKIP_MAX_SAMPLES];    // up to 255 per block, step x step blocks a cell
+    stream_skip_stats_t stats;
+} skip_state = {
+    .config = STREAM_SKIP_DEFAULT_CONFIG(),
+};
+
+/**
+ * @brief Track the sensor frame period from the capture metadata
+ *
+ * Sequence numbers count the frames the driver dropped as well, so the
+ * period is the sensor's, not the rate this client happens to be served at.
+ */
+static void stream_note_frame(const camera_fb_t *fb) {
+    portENTER_CRITICAL(&stream_lock);
+    if (fb->sequence > stream_state.last_sequence) {  // else seen by another client, or the driver restarted
+        if (stream_state.last_sequence) {
+            float period = (float)(fb->capture_start_us - stream_state.last_capture_us) /
+                           (fb->sequence - stream_state.last_sequence);
+            stream_state.frame_period_us = stream_state.frame_period_us > 0.0f ?
+                                           stream_state.frame_period_us * 0.875f + period * 0.125f : period;
+        }
+        stream_state.last_sequence = fb->sequence;
+        stream_state.last_capture_us = fb->capture_start_us;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+}
+
+/**
+ * @brief Copy a JPEG into a new snapshot frame, its one reference for the caller
+ */
+static snapshot_frame_t *snapshot_frame_new(const uint8_t *jpg, size_t len, uint32_t sequence,
+                                            int64_t capture_start_us, uint8_t scale) {
+    snapshot_frame_t *frame = malloc(sizeof(snapshot_frame_t) + len);
+    if (frame == NULL) {
+        ESP_LOGW(TAG, "No memory for a snapshot of %u bytes", (unsigned)len);
+        return NULL;
+    }
+    frame->refs = 1;
+    frame->sequence = sequence;
+    frame->capture_start_us = capture_start_us;
+    frame->scale = scale;
+    frame->len = len;
+    memcpy(frame->data, jpg, len);
+    return frame;
+}
+
+/**
+ * @brief Drop a reference to a snapshot frame
+ */
+static void snapshot_release(snapshot_frame_t *frame) {
+    if (frame == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&stream_lock);
+    bool last = --frame->refs == 0;
+    portEXIT_CRITICAL(&stream_lock);
+    if (last) {
+        free(frame);
+    }
+}
+
+/**
+ * @brief Put a frame into a slot, which takes over the caller's reference
+ *
+ * A frame of the same scale that is not newer than the one in the slot is
+ * dropped instead: another sender task got a later frame in first.
+ */
+static void snapshot_store(snapshot_frame_t **slot, snapshot_frame_t *frame) {
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_frame_t *old = *slot;
+    if (old && old->scale == frame->scale && frame->sequence <= old->sequence) {
+        old = frame;
+    } else {
+        *slot = frame;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+    snapshot_release(old);
+}
+
+/**
+ * @brief Copy a streamed frame into the snapshot slot, while snapshots are asked for
+ *
+ * Costs a copy per new frame, and nothing when nobody took a snapshot for
+ * SNAPSHOT_KEEP_MS.
+ */
+static void snapshot_publish(const camera_fb_t *fb) {
+    const int64_t now_us = esp_timer_get_time();
+    portENTER_CRITICAL(&stream_lock);
+    bool wanted = now_us < snapshot_state.wanted_until_us &&
+                  (snapshot_state.latest == NULL || fb->sequence > snapshot_state.latest->sequence);
+    portEXIT_CRITICAL(&stream_lock);
+    if (!wanted) {
+        return;
+    }
+    snapshot_frame_t *frame = snapshot_frame_new(fb->buf, fb->len, fb->sequence, fb->capture_start_us, 1);
+    if (frame) {
+        snapshot_store(&snapshot_state.latest, frame);
+    }
+}
+
+/**
+ * @brief Sample the DC map of a frame into skip_state.latest, with skip_state.work held
+ */
+static void skip_decode(const camera_fb_t *fb, uint8_t step) {
+    skip_samples_t *out = &skip_state.latest;
+    out->sequence = fb->sequence;
+    out->capture_start_us = fb->capture_start_us;
+    out->step = step;
+    out->width = 0;
+    out->height = 0;
+    out->count = 0;
+
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = fb->buf,
+        .indata_size = fb->len,
+    };
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return;
+    }
+    const size_t blocks = (size_t)((img.width + 7) / 8) * ((img.height + 7) / 8);
+    if (skip_state.work_area == NULL) {
+        skip_state.work_area = heap_caps_malloc(ESP_JPEG_WORK_BUF_SIZE, MALLOC_CAP_8BIT);
+    }
+    if (blocks > skip_state.map_cap) {
+        free(skip_state.map);
+        skip_state.map = malloc(blocks);
+        skip_state.map_cap = skip_state.map ? blocks : 0;
+    }
+    if (skip_state.work_area == NULL || skip_state.map == NULL) {
+        ESP_LOGW(TAG, "No memory to sample frames");
+        return;
+    }
+    cfg.outbuf = skip_state.map;
+    cfg.outbuf_size = skip_state.map_cap;
+    cfg.advanced.working_buffer = skip_state.work_area;
+    cfg.advanced.working_buffer_size = ESP_JPEG_WORK_BUF_SIZE;
+    if (esp_jpeg_decode_dc_map(&cfg, &img) != ESP_OK) {
+        return;
+    }
+
+    // Cells of step x step blocks: a change anywhere in one moves its mean
+    while (((img.width + step - 1) / step) * ((img.height + step - 1) / step) > SKIP_MAX_SAMPLES) {
+        step++;
+    }
+    const int cells_x = (img.width + step - 1) / step;
+    const int cells_y = (img.height + step - 1) / step;
+    memset(skip_state.sums, 0, cells_x * cells_y * sizeof(uint32_t));
+    for (int y = 0; y < img.height; y++) {
+        const uint8_t *row = skip_state.map + y * img.width;
+        uint32_t *sums = skip_state.sums + (y / step) * cells_x;
+        for (int x = 0; x < img.width; x++) {
+            sums[x / step] += row[x];
+        }
+    }
+    for (int cy = 0; cy < cells_y; cy++) {
+        const int h = cy < cells_y - 1 ? step : img.height - cy * step;
+        for (int cx = 0; cx < cells_x; cx++) {
+            const int w = cx < cells_x - 1 ? step : img.width - cx * step;
+            out->samples[out->count++] = (uint8_t)(skip_state.sums[cy * cells_x + cx] / (w * h));
+        }
+    }
+    out->width = img.width;
+    out->height = img.height;
+}
+
+/**
+ * @brief The DC samples of a frame, decoded once for all the senders that have it at this step
+ *
+ * @return false if the frame did not decode
+ */
+static bool skip_sample(const camera_fb_t *fb, uint8_t step, skip_samples_t *samples) {
+    if (xSemaphoreTake(skip_state.work, portMAX_DELAY) != pdTRUE) {
+        return false;
+    }
+    if (skip_state.latest.sequence != fb->sequence || skip_state.latest.capture_start_us != fb->capture_start_us ||
+        skip_state.latest.step != step) {
+        skip_decode(fb, step);
+        portENTER_CRITICAL(&stream_lock);
+        skip_state.stats.sampled++;
+        portEXIT_CRITICAL(&stream_lock);
+    }
+    memcpy(samples, &skip_state.latest, sizeof(skip_samples_t));
+    xSemaphoreGive(skip_state.work);
+    return samples->width != 0;
+}
+
+/**
+ * @brief Whether a frame repeats the last one a sender sent
+ *
+ * @param fb The frame
+ * @param sent Samples of the last frame sent, count 0 before the first
+ * @param sent_len Its JPEG length
+ * @param sent_us When it went out
+ * @param frame Output, the samples of this frame once it had to be decoded, else its count is 0
+ */
+static bool skip_duplicate(const camera_fb_t *fb, const skip_samples_t *sent, size_t sent_len, int64_t sent_us,
+                           skip_samples_t *frame) {
+    portENTER_CRITICAL(&stream_lock);
+    const stream_skip_config_t config = skip_state.config;
+    portEXIT_CRITICAL(&stream_lock);
+    frame->count = 0;
+
+    // The size tells most new frames apart without a decode
+    const size_t delta = fb->len > sent_len ? fb->len - sent_len : sent_len - fb->len;
+    if (config.threshold == 0 || delta * 100 > sent_len * config.size_percent ||
+        !skip_sample(fb, config.sample_step ? config.sample_step : 1, frame)) {
+        return false;
+    }
+    if (frame->step != sent->step || frame->width != sent->width || frame->height != sent->height ||
+        frame->count != sent->count) {
+        return false;
+    }
+    for (uint16_t i = 0; i < frame->count; i++) {
+        if (abs(frame->samples[i] - sent->samples[i]) > config.threshold) {
+            return false;
+        }
+    }
+
+    // A duplicate; one still goes out once in a while, the client knows the stream is alive
+    bool keepalive = esp_timer_get_time() - sent_us >= config.keepalive_ms * 1000LL;
+    portENTER_CRITICAL(&stream_lock);
+    if (keepalive) {
+        skip_state.stats.keepalives++;
+    } else {
+        skip_state.stats.skipped++;
+        skip_state.stats.skipped_bytes += fb->len;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+    return !keepalive;
+}
+
+/**
+ * @brief Sensor settings applied on top of the driver defaults
+ *
+ * Only runs when the camera boots without a cache; later boots of the same
+ * firmware replay the registers it wrote.
+ */
+static esp_err_t camera_setup(sensor_t *s) {
+    s->set_brightness(s, 0);     // -2 to 2
+    s->set_contrast(s, 0);       // -2 to 2
+    s->set_saturation(s, 0);     // -2 to 2
+    s->set_special_effect(s, 0); // 0 to 6 (0 - No Effect, 1 - Negative, 2 - Grayscale, etc.)
+    s->set_whitebal(s, 1);       // 0 = disable , 1 = enable
+    s->set_awb_gain(s, 1);       // 0 = disable , 1 = enable
+    s->set_wb_mode(s, 0);        // 0 to 4 - if awb_gain enabled (0 - Auto, 1 - Sunny, 2 - Cloudy, 3 - Office, 4 - Home)
+    s->set_exposure_ctrl(s, 1);  // 0 = disable , 1 = enable
+    s->set_aec2(s, 0);           // 0 = disable , 1 = enable
+    s->set_ae_level(s, 0);       // -2 to 2
+    s->set_aec_value(s, 300);    // 0 to 1200
+    s->set_gain_ctrl(s, 1);      // 0 = disable , 1 = enable
+    s->set_agc_gain(s, 0);       // 0 to 30
+    s->set_gainceiling(s, (gainceiling_t)0);  // 0 to 6
+    s->set_bpc(s, 0);            // 0 = disable , 1 = enable
+    s->set_wpc(s, 1);            // 0 = disable , 1 = enable
+    s->set_raw_gma(s, 1);        // 0 = disable , 1 = enable
+    s->set_lenc(s, 1);           // 0 = disable , 1 = enable
+    s->set_hmirror(s, 0);        // 0 = disable , 1 = enable
+    s->set_vflip(s, 0);          // 0 = disable , 1 = enable
+    s->set_dcw(s, 1);            // 0 = disable , 1 = enable
+    s->set_colorbar(s, 0);       // 0 = disable , 1 = enable
+    return ESP_OK;
+}
+
+/**
+ * @brief Store the built-in presets the namespace does not have yet
+ *
+ * They derive from the settings camera_setup() leaves, so presets saved
+ * before a change of it stay as they were.
+ */
+static void camera_presets_init(sensor_t *s) {
+    camera_status_t st;
+    pixformat_t pf;
+
+    if (esp_camera_preset_get(CAMERA_PRESET_NVS, "day-drive", &st, &pf) == ESP_ERR_NOT_FOUND) {
+        esp_camera_preset_save(CAMERA_PRESET_NVS, "day-drive", &s->status, s->pixformat);
+    }
+    if (esp_camera_preset_get(CAMERA_PRESET_NVS, "night", &st, &pf) == ESP_ERR_NOT_FOUND) {
+        st = s->status;
+        st.brightness = 1;
+        st.ae_level = 2;
+        st.aec2 = 1;
+        st.gainceiling = GAINCEILING_64X;
+        st.bpc = 1;
+        esp_camera_preset_save(CAMERA_PRESET_NVS, "night", &st, s->pixformat);
+    }
+    if (esp_camera_preset_get(CAMERA_PRESET_NVS, "low-bandwidth", &st, &pf) == ESP_ERR_NOT_FOUND) {
+        st = s->status;
+        st.framesize = FRAMESIZE_VGA;
+        st.quality = 20;
+        esp_camera_preset_save(CAMERA_PRESET_NVS, "low-bandwidth", &st, s->pixformat);
+    }
+}
+
 /**
  * @brief Initialize the camera
  */
@@ -90,12 +468,13 @@ static int camera_init(void) {
         .pixel_format = PIXFORMAT_JPEG,     // JPEG for streaming
         .frame_size = FRAMESIZE_HD,         // 1280x720
         .jpeg_quality = 12,                 // 0-63, lower = higher quality
-        .fb_count = 2,                      // Double buffering
+        .fb_count = 3,                      // Double buffering, plus the frame the vision stream decodes
         .grab_mode = CAMERA_GRAB_WHEN_EMPTY // Grab next frame when buffer is empty
     };
 
-    // Initialize camera
-    esp_err_t err = esp_camera_init(&config);
+    // Initialize camera, from the sensor state cached by the last boot if it still matches
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t err = esp_camera_init_cached(&config, CAMERA_CACHE_NVS, camera_setup);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Camera init failed with error 0x%x", err);
         return -1;
@@ -108,29 +487,30 @@ static int camera_init(void) {
         return -1;
     }
 
-    // Initial sensor configuration
-    s->set_brightness(s, 0);     // -2 to 2
-    s->set_contrast(s, 0);       // -2 to 2
-    s->set_saturation(s, 0);     // -2 to 2
-    s->set_special_effect(s, 0); // 0 to 6 (0 - No Effect, 1 - Negative, 2 - Grayscale, etc.)
-    s->set_whitebal(s, 1);       // 0 = disable , 1 = enable
-    s->set_awb_gain(s, 1);       // 0 = disable , 1 = enable
-    s->set_wb_mode(s, 0);        // 0 to 4 - if awb_gain enabled (0 - Auto, 1 - Sunny, 2 - Cloudy, 3 - Office, 4 - Home)
-    s->set_exposure_ctrl(s, 1);  // 0 = disable , 1 = enable
-    s->set_aec2(s, 0);           // 0 = disable , 1 = enable
-    s->set_ae_level(s, 0);       // -2 to 2
-    s->set_aec_value(s, 300);    // 0 to 1200
-    s->set_gain_ctrl(s, 1);      // 0 = disable , 1 = enable
-    s->set_agc_gain(s, 0);       // 0 to 30
-    s->set_gainceiling(s, (gainceiling_t)0);  // 0 to 6
-    s->set_bpc(s, 0);            // 0 = disable , 1 = enable
-    s->set_wpc(s, 1);            // 0 = disable , 1 = enable
-    s->set_raw_gma(s, 1);        // 0 = disable , 1 = enable
-    s->set_lenc(s, 1);           // 0 = disable , 1 = enable
-    s->set_hmirror(s, 0);        // 0 = disable , 1 = enable
-    s->set_vflip(s, 0);          // 0 = disable , 1 = enable
-    s->set_dcw(s, 1);            // 0 = disable , 1 = enable
-    s->set_colorbar(s, 0);       // 0 = disable , 1 = enable
+    // Time to first frame
+    camera_fb_t *fb = esp_camera_fb_get();
+    if (fb) {
+        int64_t now_us = esp_timer_get_time();
+        ESP_LOGI(TAG, "First frame after %" PRId64 " ms (%" PRId64 " ms since boot)",
+                 (now_us - start_us) / 1000, now_us / 1000);
+        esp_camera_fb_return(fb);
+    } else {
+        ESP_LOGW(TAG, "No frame from the camera yet");
+    }
+
+    camera_presets_init(s);
+
+    const camera_gray_config_t vision = {
+        .every = VISION_EVERY,
+        .scale_div = VISION_SCALE_DIV,
+        .fb_count = 2,
+        .task_priority = 4,
+        .task_core = -1,
+    };
+    err = esp_camera_gray_start(&vision);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "No vision frames: %s", esp_err_to_name(err));
+    }
 
     ESP_LOGI(TAG, "Camera initialized successfully");
     ESP_LOGI(TAG, "Camera sensor: PID=0x%02x VER=0x%02x MIDL=0x%02x MIDH=0x%02x",
@@ -141,24 +521,65 @@ static int camera_init(void) {
 }
 
 /**
- * @brief HTTP handler for MJPEG stream
+ * @brief Whether the client asked for the overlay drawn into the frames (/stream?overlay=1)
  */
-static esp_err_t stream_handler(httpd_req_t *req) {
+static bool stream_wants_overlay(httpd_req_t *req) {
+    char query[64];
+    char value[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "overlay", value, sizeof(value)) != ESP_OK) {
+        return false;
+    }
+    return strcmp(value, "1") == 0;
+}
+
+/**
+ * @brief Whether the client turned duplicate suppression off (/stream?skip=0)
+ */
+static bool stream_wants_every_frame(httpd_req_t *req) {
+    char query[64];
+    char value[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "skip", value, sizeof(value)) != ESP_OK) {
+        return false;
+    }
+    return strcmp(value, "0") == 0;
+}
+
+/**
+ * @brief Send the MJPEG stream until the client goes away
+ *
+ * With ?overlay=1 each frame carries the latest overlay, drawn by
+ * OverlayBurnIn(), for players that cannot run the WebSocket client. A frame
+ * it cannot draw into goes out as the sensor sent it. Those clients get
+ * every frame, the overlay changes on frames that repeat; the others no
+ * duplicates, see skip_duplicate().
+ */
+static esp_err_t stream_send(httpd_req_t *req) {
     camera_fb_t *fb = NULL;
     esp_err_t res = ESP_OK;
     size_t _jpg_buf_len = 0;
     uint8_t *_jpg_buf = NULL;
-    char part_buf[64];
-
-    ESP_LOGI(TAG, "Stream client connected from %s",
-             req->sess_ctx ? (char*)req->sess_ctx : "unknown");
+    char part_buf[160];
+    bool burn_in = stream_wants_overlay(req);
+    uint8_t *burn_buf = NULL;
+    size_t burn_cap = 0;
+    // Samples of the last frame sent and of the frame at hand
+    skip_samples_t *sent = burn_in || stream_wants_every_frame(req) ? NULL : malloc(2 * sizeof(skip_samples_t));
+    skip_samples_t *samples = sent ? sent + 1 : NULL;
+    size_t sent_len = 0;
+    int64_t sent_us = 0;
+    if (sent) {
+        sent->count = 0;
+    }
 
-    stream_state.client_count++;
+    ESP_LOGI(TAG, "Stream client connected from %s%s%s",
+             req->sess_ctx ? (char*)req->sess_ctx : "unknown", burn_in ? ", overlay burned in" : "",
+             sent ? "" : ", every frame");
 
     // Set HTTP response headers
     res = httpd_resp_set_type(req, STREAM_CONTENT_TYPE);
     if (res != ESP_OK) {
-        stream_state.client_count--;
         return res;
     }
 
@@ -174,9 +595,34 @@ static esp_err_t stream_handler(httpd_req_t *req) {
             break;
         }
 
+        stream_note_frame(fb);
+        snapshot_publish(fb);
+        RecorderAddFrame(fb);
+        MotionAddFrame(fb);
+        if (sent && skip_duplicate(fb, sent, sent_len, sent_us, samples)) {
+            esp_camera_fb_return(fb);
+            fb = NULL;
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
         _jpg_buf_len = fb->len;
         _jpg_buf = fb->buf;
 
+        if (burn_in) {
+            // patched frames stay about the source size, the margin covers the MCUs drawn on
+            if (burn_cap < fb->len + fb->len / 2) {
+                free(burn_buf);
+                burn_cap = fb->len * 2;
+                burn_buf = malloc(burn_cap);
+                burn_cap = burn_buf ? burn_cap : 0;
+            }
+            size_t burn_len = 0;
+            if (burn_buf && OverlayBurnIn(fb, burn_buf, burn_cap, &burn_len)) {
+                _jpg_buf = burn_buf;
+                _jpg_buf_len = burn_len;
+            }
+        }
+
         // Send MIME boundary
         res = httpd_resp_send_chunk(req, STREAM_PART_BOUNDARY, strlen(STREAM_PART_BOUNDARY));
         if (res != ESP_OK) {
@@ -184,7 +630,8 @@ static esp_err_t stream_handler(httpd_req_t *req) {
         }
 
         // Send JPEG content-type and length
-        size_t hlen = snprintf(part_buf, sizeof(part_buf), STREAM_PART_HEADER, _jpg_buf_len);
+        size_t hlen = snprintf(part_buf, sizeof(part_buf), STREAM_PART_HEADER, _jpg_buf_len, fb->sequence,
+                               fb->capture_start_us / 1000000, fb->capture_start_us % 1000000);
         res = httpd_resp_send_chunk(req, part_buf, hlen);
         if (res != ESP_OK) {
             break;
@@ -196,13 +643,22 @@ static esp_err_t stream_handler(httpd_req_t *req) {
             break;
         }
 
+        // The frame the next ones are compared with; its samples if it was decoded, else the next close one is
+        if (sent) {
+            memcpy(sent, samples, samples->count ? sizeof(skip_samples_t) : offsetof(skip_samples_t, samples));
+            sent_len = fb->len;
+            sent_us = esp_timer_get_time();
+        }
+
         // Return framebuffer
         esp_camera_fb_return(fb);
         fb = NULL;
 
         // Update stats
+        portENTER_CRITICAL(&stream_lock);
         stream_state.frame_count++;
         stream_state.last_frame_time = xTaskGetTickCount();
+        portEXIT_CRITICAL(&stream_lock);
 
         // Thermal management: Add 100ms delay between frames (~10 fps max)
         vTaskDelay(pdMS_TO_TICKS(100));
@@ -212,88 +668,407 @@ static esp_err_t stream_handler(httpd_req_t *req) {
     if (fb) {
         esp_camera_fb_return(fb);
     }
+    free(burn_buf);
+    free(sent);
 
-    stream_state.client_count--;
     ESP_LOGI(TAG, "Stream client disconnected");
 
     return res;
 }
 
-// Embedded overlay demo HTML page
-extern const uint8_t overlay_demo_html_start[] asm("_binary_overlay_demo_html_start");
-extern const uint8_t overlay_demo_html_end[]   asm("_binary_overlay_demo_html_end");
+/**
+ * @brief Sender task of one stream client, the request from httpd_req_async_handler_begin()
+ */
+static void stream_sender_task(void *arg) {
+    httpd_req_t *req = arg;
+    stream_send(req);
+    httpd_req_async_handler_complete(req);
+
+    portENTER_CRITICAL(&stream_lock);
+    stream_state.client_count--;
+    portEXIT_CRITICAL(&stream_lock);
+    vTaskDelete(NULL);
+}
+
+esp_err_t StreamHttpHandler(httpd_req_t *req) {
+    if (!stream_state.camera_initialized) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "No camera");
+    }
+
+    portENTER_CRITICAL(&stream_lock);
+    bool admitted = stream_state.client_count < STREAM_MAX_CLIENTS;
+    if (admitted) {
+        stream_state.client_count++;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+    if (!admitted) {
+        ESP_LOGW(TAG, "Stream client refused, %d streaming", STREAM_MAX_CLIENTS);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "Too many stream clients");
+    }
+
+    // The connection goes to its own task, the server carries on with other requests
+    httpd_req_t *async = NULL;
+    if (httpd_req_async_handler_begin(req, &async) == ESP_OK) {
+        if (xTaskCreate(stream_sender_task, "stream_tx", STREAM_SENDER_STACK, async,
+                        STREAM_SENDER_PRIORITY, NULL) == pdPASS) {
+            return ESP_OK;
+        }
+        httpd_req_async_handler_complete(async);
+    }
+
+    ESP_LOGE(TAG, "No sender task for a stream client");
+    portENTER_CRITICAL(&stream_lock);
+    stream_state.client_count--;
+    portEXIT_CRITICAL(&stream_lock);
+    return ESP_FAIL;
+}
 
 /**
- * @brief HTTP handler serving the overlay demo page
+ * @brief A reference to the slot frame if it is recent enough, else NULL
+ *
+ * While streams run that is the newest frame any of them took, else a frame
+ * captured since since_us.
  */
-static esp_err_t stream_info_handler(httpd_req_t *req) {
-    httpd_resp_set_type(req, "text/html");
-    size_t len = overlay_demo_html_end - overlay_demo_html_start;
-    return httpd_resp_send(req, (const char *)overlay_demo_html_start, len);
+static snapshot_frame_t *snapshot_take(int64_t since_us) {
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_frame_t *frame = snapshot_state.latest;
+    bool fresh = frame && (stream_state.client_count > 0 ? frame->sequence >= stream_state.last_sequence
+                                                         : frame->capture_start_us >= since_us);
+    if (fresh) {
+        frame->refs++;
+        snapshot_state.stats.shared++;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+    return fresh ? frame : NULL;
 }
 
-int StreamInit(uint16_t stream_port) {
-    ESP_LOGI(TAG, "Initializing video stream module");
+/**
+ * @brief A reference to the slot frame however old, NULL for an empty slot
+ */
+static snapshot_frame_t *snapshot_take_last(void) {
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_frame_t *frame = snapshot_state.latest;
+    if (frame) {
+        frame->refs++;
+        snapshot_state.stats.shared++;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+    return frame;
+}
 
-    if (stream_port == 0) {
-        ESP_LOGI(TAG, "Stream disabled (port = 0)");
-        return 0;
+/**
+ * @brief Capture a frame for the snapshot slot, with snapshot_state.work held
+ *
+ * With nobody taking frames the driver queue holds old ones, those are
+ * handed back until one captured since since_us comes.
+ */
+static snapshot_frame_t *snapshot_capture(int64_t since_us) {
+    int captures = 1;
+    camera_fb_t *fb = esp_camera_fb_get();
+    while (fb && fb->capture_start_us < since_us && captures <= SNAPSHOT_STALE_FRAMES) {
+        esp_camera_fb_return(fb);
+        fb = esp_camera_fb_get();
+        captures++;
+    }
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_state.stats.captures += captures;
+    portEXIT_CRITICAL(&stream_lock);
+    if (!fb) {
+        ESP_LOGE(TAG, "Snapshot capture failed");
+        return NULL;
     }
 
-    // Initialize camera
-    if (camera_init() != 0) {
-        ESP_LOGE(TAG, "Failed to initialize camera");
-        return -1;
+    snapshot_frame_t *frame = snapshot_frame_new(fb->buf, fb->len, fb->sequence, fb->capture_start_us, 1);
+    esp_camera_fb_return(fb);
+    if (frame) {
+        frame->refs++;  // the caller's, the other one goes to the slot
+        snapshot_store(&snapshot_state.latest, frame);
     }
+    return frame;
+}
 
-    // Create HTTP server for streaming
-    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.server_port = stream_port;
-    config.ctrl_port = stream_port + 1;
-    config.max_open_sockets = 13;  // Increased from 7 for more concurrent clients
-    config.lru_purge_enable = true;
-    config.send_wait_timeout = 10;  // Add send timeout
-    config.recv_wait_timeout = 10;  // Add receive timeout
-    config.backlog_conn = 5;  // Add connection backlog
+/**
+ * @brief The frame for a snapshot request
+ *
+ * Shared from the streams when they run, they copy the next frame they send.
+ * A stream that sends none in time leaves the newest frame of the slot, the
+ * camera's frames are theirs. Otherwise the first request captures and the
+ * ones waiting behind it take the same frame.
+ */
+static snapshot_frame_t *snapshot_latest(void) {
+    const int64_t arrived_us = esp_timer_get_time();
+    const int64_t since_us = arrived_us - SNAPSHOT_MAX_AGE_MS * 1000LL;
+    snapshot_frame_t *frame;
+    while ((frame = snapshot_take(since_us)) == NULL && stream_state.client_count > 0 &&
+           esp_timer_get_time() - arrived_us < SNAPSHOT_WAIT_MS * 1000LL) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (frame) {
+        return frame;
+    }
+    if (stream_state.client_count > 0) {
+        return snapshot_take_last();
+    }
 
-    ESP_LOGI(TAG, "Starting stream server on port %d", stream_port);
+    if (xSemaphoreTake(snapshot_state.work, pdMS_TO_TICKS(2 * SNAPSHOT_WAIT_MS)) != pdTRUE) {
+        return NULL;
+    }
+    frame = snapshot_take(since_us);
+    if (frame == NULL) {
+        // a stream that started meanwhile has the camera
+        frame = stream_state.client_count > 0 ? snapshot_take_last() : snapshot_capture(since_us);
+    }
+    xSemaphoreGive(snapshot_state.work);
+    return frame;
+}
 
-    esp_err_t err = httpd_start(&stream_state.server, &config);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to start stream server: %s", esp_err_to_name(err));
-        return -1;
+/**
+ * @brief A reference to the downscaled frame in the slot if it is this frame at this scale, else NULL
+ */
+static snapshot_frame_t *snapshot_take_scaled(const snapshot_frame_t *frame, uint8_t scale) {
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_frame_t *scaled = snapshot_state.scaled;
+    bool match = scaled && scaled->scale == scale && scaled->sequence == frame->sequence &&
+                 scaled->capture_start_us == frame->capture_start_us;
+    if (match) {
+        scaled->refs++;
     }
+    portEXIT_CRITICAL(&stream_lock);
+    return match ? scaled : NULL;
+}
 
-    // Register URI handlers
-    httpd_uri_t stream_uri = {
-        .uri = "/stream",
-        .method = HTTP_GET,
-        .handler = stream_handler,
-        .user_ctx = NULL
+bool StreamJpegScale(const uint8_t *jpg, size_t len, uint8_t scale, uint8_t quality, uint8_t **out,
+                     size_t *out_len) {
+    esp_jpeg_image_cfg_t cfg = {
+        .indata = (uint8_t *)jpg,
+        .indata_size = len,
+        .out_format = JPEG_IMAGE_FORMAT_RGB565,
+        .out_scale = scale == 2 ? JPEG_IMAGE_SCALE_1_2 : scale == 4 ? JPEG_IMAGE_SCALE_1_4 : JPEG_IMAGE_SCALE_1_8,
+        .flags.swap_color_bytes = 1,    // high byte first, the sensor's RGB565 that fmt2jpg() takes
     };
-    httpd_register_uri_handler(stream_state.server, &stream_uri);
+    esp_jpeg_image_output_t img;
+    if (esp_jpeg_get_image_info(&cfg, &img) != ESP_OK) {
+        return false;
+    }
+    uint8_t *rgb = malloc(img.output_len);
+    if (rgb == NULL) {
+        ESP_LOGW(TAG, "No memory to downscale a JPEG");
+        return false;
+    }
+    cfg.outbuf = rgb;
+    cfg.outbuf_size = img.output_len;
 
-    httpd_uri_t info_uri = {
-        .uri = "/",
-        .method = HTTP_GET,
-        .handler = stream_info_handler,
-        .user_ctx = NULL
-    };
-    httpd_register_uri_handler(stream_state.server, &info_uri);
+    *out = NULL;
+    bool ok = esp_jpeg_decode(&cfg, &img) == ESP_OK &&
+              fmt2jpg(rgb, img.output_len, img.width, img.height, PIXFORMAT_RGB565, quality, out, out_len);
+    free(rgb);
+    if (!ok) {
+        free(*out);
+        *out = NULL;
+    }
+    return ok;
+}
+
+/**
+ * @brief Decode a frame at 1/scale and code it again as JPEG
+ */
+static snapshot_frame_t *snapshot_encode_scaled(const snapshot_frame_t *frame, uint8_t scale) {
+    snapshot_frame_t *scaled = NULL;
+    uint8_t *jpg = NULL;
+    size_t jpg_len = 0;
+    if (StreamJpegScale(frame->data, frame->len, scale, SNAPSHOT_QUALITY, &jpg, &jpg_len)) {
+        scaled = snapshot_frame_new(jpg, jpg_len, frame->sequence, frame->capture_start_us, scale);
+    }
+    free(jpg);
+
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_state.stats.scaled++;
+    portEXIT_CRITICAL(&stream_lock);
+    return scaled;
+}
 
-    stream_state.port = stream_port;
+/**
+ * @brief The frame downscaled, coded once for all the requests for it
+ */
+static snapshot_frame_t *snapshot_scaled(const snapshot_frame_t *frame, uint8_t scale) {
+    snapshot_frame_t *scaled = snapshot_take_scaled(frame, scale);
+    if (scaled || xSemaphoreTake(snapshot_state.work, pdMS_TO_TICKS(2 * SNAPSHOT_WAIT_MS)) != pdTRUE) {
+        return scaled;
+    }
+    scaled = snapshot_take_scaled(frame, scale);
+    if (scaled == NULL) {
+        scaled = snapshot_encode_scaled(frame, scale);
+        if (scaled) {
+            scaled->refs++;
+            snapshot_store(&snapshot_state.scaled, scaled);
+        }
+    }
+    xSemaphoreGive(snapshot_state.work);
+    return scaled;
+}
 
-    ESP_LOGI(TAG, "Stream server started successfully");
-    ESP_LOGI(TAG, "Stream available at: http://[ESP32-IP]:%d/stream", stream_port);
-    ESP_LOGI(TAG, "Info page at: http://[ESP32-IP]:%d/", stream_port);
+/**
+ * @brief Scale a snapshot request asks for (/snapshot.jpg?scale=4), 1 without, 0 for one not offered
+ */
+static uint8_t snapshot_wanted_scale(httpd_req_t *req) {
+    char query[64];
+    char value[8];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+        httpd_query_key_value(query, "scale", value, sizeof(value)) != ESP_OK) {
+        return 1;
+    }
+    if (strcmp(value, "1") == 0 || strcmp(value, "2") == 0 || strcmp(value, "4") == 0 ||
+        strcmp(value, "8") == 0) {
+        return (uint8_t)atoi(value);
+    }
+    return 0;
+}
 
-    // Initialize overlay WebSocket system
-    if (OverlayInit(stream_state.server) == 0) {
-        ESP_LOGI(TAG, "Overlay WebSocket initialized at: ws://[ESP32-IP]:%d/ws", stream_port);
+/**
+ * @brief Answer a snapshot request, on its own task: waiting for a frame, capturing or downscaling one
+ */
+static esp_err_t snapshot_send(httpd_req_t *req) {
+    uint8_t scale = snapshot_wanted_scale(req);
+    snapshot_frame_t *frame = snapshot_latest();
+    if (frame && scale > 1) {
+        snapshot_frame_t *scaled = snapshot_scaled(frame, scale);
+        snapshot_release(frame);
+        frame = scaled;
+    }
+    if (frame == NULL) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "No frame");
+    }
+
+    // The ETag names the frame, the capture time tells sequences of two boots apart
+    char etag[48];
+    char sequence[12];
+    char timestamp[24];
+    snprintf(etag, sizeof(etag), "\"%" PRIu32 "-%" PRId64 "-%u\"", frame->sequence, frame->capture_start_us,
+             frame->scale);
+    snprintf(sequence, sizeof(sequence), "%" PRIu32, frame->sequence);
+    snprintf(timestamp, sizeof(timestamp), "%" PRId64 ".%06" PRId64, frame->capture_start_us / 1000000,
+             frame->capture_start_us % 1000000);
+
+    httpd_resp_set_type(req, "image/jpeg");
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    httpd_resp_set_hdr(req, "X-Frame-Sequence", sequence);
+    httpd_resp_set_hdr(req, "X-Timestamp", timestamp);
+    esp_err_t res;
+    if (ServerEtagMatches(req, etag)) {
+        portENTER_CRITICAL(&stream_lock);
+        snapshot_state.stats.not_modified++;
+        portEXIT_CRITICAL(&stream_lock);
+        httpd_resp_set_status(req, "304 Not Modified");
+        res = httpd_resp_send(req, NULL, 0);
     } else {
-        ESP_LOGW(TAG, "Failed to initialize overlay WebSocket");
+        httpd_resp_set_hdr(req, "Content-Disposition", "inline; filename=snapshot.jpg");
+        res = httpd_resp_send(req, (const char *)frame->data, frame->len);
+    }
+    snapshot_release(frame);
+    return res;
+}
+
+/**
+ * @brief Task of one snapshot request, the request from httpd_req_async_handler_begin()
+ */
+static void snapshot_task(void *arg) {
+    httpd_req_t *req = arg;
+    snapshot_send(req);
+    httpd_req_async_handler_complete(req);
+
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_state.tasks--;
+    portEXIT_CRITICAL(&stream_lock);
+    vTaskDelete(NULL);
+}
+
+esp_err_t StreamSnapshotHandler(httpd_req_t *req) {
+    if (!stream_state.camera_initialized) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "No camera");
+    }
+    if (snapshot_wanted_scale(req) == 0) {
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "scale is 1, 2, 4 or 8");
+    }
+
+    const int64_t wanted_until_us = esp_timer_get_time() + SNAPSHOT_KEEP_MS * 1000LL;
+    portENTER_CRITICAL(&stream_lock);
+    bool admitted = snapshot_state.tasks < SNAPSHOT_MAX_REQUESTS;
+    if (admitted) {
+        snapshot_state.tasks++;
+        snapshot_state.stats.requests++;
+        snapshot_state.wanted_until_us = wanted_until_us;
+    }
+    portEXIT_CRITICAL(&stream_lock);
+    if (!admitted) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_sendstr(req, "Too many snapshot requests");
     }
 
+    // Waiting for the streams or the camera and downscaling happen on the request's task
+    httpd_req_t *async = NULL;
+    if (httpd_req_async_handler_begin(req, &async) == ESP_OK) {
+        if (xTaskCreate(snapshot_task, "snapshot", SNAPSHOT_TASK_STACK, async, SNAPSHOT_TASK_PRIORITY, NULL) ==
+            pdPASS) {
+            return ESP_OK;
+        }
+        httpd_req_async_handler_complete(async);
+    }
+
+    ESP_LOGE(TAG, "No task for a snapshot request");
+    portENTER_CRITICAL(&stream_lock);
+    snapshot_state.tasks--;
+    portEXIT_CRITICAL(&stream_lock);
+    return ESP_FAIL;
+}
+
+void StreamSetSkip(const stream_skip_config_t *config) {
+    portENTER_CRITICAL(&stream_lock);
+    skip_state.config = *config;
+    portEXIT_CRITICAL(&stream_lock);
+    ESP_LOGI(TAG, "Duplicate frames %s: threshold %u, size %u%%, cells of %u blocks, one per %" PRIu32 " ms",
+             config->threshold ? "skipped" : "sent", config->threshold, config->size_percent, config->sample_step,
+             config->keepalive_ms);
+}
+
+void StreamGetSkipStats(stream_skip_stats_t *stats) {
+    portENTER_CRITICAL(&stream_lock);
+    *stats = skip_state.stats;
+    portEXIT_CRITICAL(&stream_lock);
+}
+
+void StreamGetSnapshotStats(stream_snapshot_stats_t *stats) {
+    portENTER_CRITICAL(&stream_lock);
+    *stats = snapshot_state.stats;
+    portEXIT_CRITICAL(&stream_lock);
+}
+
+int StreamInit(void) {
+    ESP_LOGI(TAG, "Initializing video stream module");
+
+    // Initialize camera
+    if (camera_init() != 0) {
+        ESP_LOGE(TAG, "Failed to initialize camera");
+        return -1;
+    }
+
+    if (snapshot_state.work == NULL) {
+        snapshot_state.work = xSemaphoreCreateMutex();
+    }
+    if (skip_state.work == NULL) {
+        skip_state.work = xSemaphoreCreateMutex();
+    }
+    if (snapshot_state.work == NULL || skip_state.work == NULL) {
+        ESP_LOGE(TAG, "Failed to create the snapshot and skip locks");
+        return -1;
+    }
+
+    ESP_LOGI(TAG, "Video stream ready, up to %d clients", STREAM_MAX_CLIENTS);
     return 0;
 }
 
@@ -322,20 +1097,46 @@ int StreamGetClientCount(void) {
 }
 
 float StreamGetFps(void) {
-    // Simple FPS calculation based on frame count and time
-    // This is a rough estimate
-    if (stream_state.frame_count == 0) {
+    // Sensor rate from the VSYNC times of the captured frames
+    if (stream_state.frame_period_us <= 0.0f) {
         return 0.0f;
     }
 
-    uint32_t elapsed_ms = (xTaskGetTickCount() - stream_state.last_frame_time) * portTICK_PERIOD_MS;
-    if (elapsed_ms == 0) {
-        return 0.0f;
+    return 1000000.0f / stream_state.frame_period_us;
+}
+
+bool StreamGetLastFrame(uint32_t *sequence, int64_t *capture_us) {
+    portENTER_CRITICAL(&stream_lock);
+    *sequence = stream_state.last_sequence;
+    *capture_us = stream_state.last_capture_us;
+    portEXIT_CRITICAL(&stream_lock);
+    return *sequence != 0;
+}
+
+int StreamSetPreset(const char *name) {
+    if (!stream_state.camera_initialized) {
+        return -1;
     }
+    esp_err_t err = esp_camera_preset_apply(CAMERA_PRESET_NVS, name);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Preset \"%s\" not applied: %s", name, esp_err_to_name(err));
+        return -1;
+    }
+    ESP_LOGI(TAG, "Preset \"%s\" applied", name);
+    return 0;
+}
+
+camera_fb_t *StreamGetVisionFrame(uint32_t timeout_ms) {
+    if (!stream_state.camera_initialized) {
+        return NULL;
+    }
+    return esp_camera_gray_get(timeout_ms);
+}
 
-    return 1000.0f / elapsed_ms;
+void StreamReturnVisionFrame(camera_fb_t *fb) {
+    esp_camera_gray_return(fb);
 }
 
-void* StreamGetServerHandle(void) {
-    return stream_state.server;
+uint32_t StreamGetFrameCount(void) {
+    return stream_state.frame_count;
 }
@@ -11,17 +11,128 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "esp_camera.h"
+#include "esp_http_server.h"
 
 /**
  * @brief Initialize the video streaming system
  *
- * Initializes the camera (OV3660 on AI-Thinker ESP32-CAM) and creates
- * an HTTP MJPEG streaming server.
+ * Initializes the camera (OV3660 on AI-Thinker ESP32-CAM). The HTTP server
+ * (server.h) routes /stream to StreamHttpHandler() and /snapshot.jpg to
+ * StreamSnapshotHandler().
  *
- * @param stream_port HTTP port for video stream (use 0 to disable)
  * @return 0 on success, -1 on failure
  */
-int StreamInit(uint16_t stream_port);
+int StreamInit(void);
+
+/**
+ * @brief HTTP handler of the MJPEG stream (/stream, /stream?overlay=1, /stream?skip=0)
+ *
+ * Hands the connection to a sender task of its own with
+ * httpd_req_async_handler_begin(), so a stream does not hold up the server.
+ * Frames that repeat the last one sent are skipped, see StreamSetSkip().
+ * Answers 503 without a camera or with all stream clients taken.
+ */
+esp_err_t StreamHttpHandler(httpd_req_t *req);
+
+/**
+ * @brief Suppression of near duplicate frames in the MJPEG stream, see StreamSetSkip()
+ */
+typedef struct {
+    uint8_t threshold;          // change of the mean DC luma of a cell that makes a frame new, 0 sends every frame
+    uint8_t size_percent;       // a frame whose JPEG size differs more than this from the last one sent is new
+    uint8_t sample_step;        // cells of n x n 8x8 blocks are sampled, larger for frames of over 4096 cells
+    uint32_t keepalive_ms;      // a duplicate goes out anyway this long after the last frame sent
+} stream_skip_config_t;
+
+// An idle HD scene goes out once a second; a change of 6 levels over a 16x16 pixel cell is new
+#define STREAM_SKIP_DEFAULT_CONFIG() { \
+    .threshold = 6,                 \
+    .size_percent = 3,              \
+    .sample_step = 2,               \
+    .keepalive_ms = 1000,           \
+}
+
+/**
+ * @brief Skip counters since boot, summed over the stream clients
+ */
+typedef struct {
+    uint32_t sampled;           // frames decoded for their DC samples, once for all the clients
+    uint32_t skipped;           // frames not sent as duplicates of the one sent before
+    uint64_t skipped_bytes;     // their JPEG bytes
+    uint32_t keepalives;        // duplicates sent for keepalive_ms
+} stream_skip_stats_t;
+
+/**
+ * @brief Set the duplicate frame suppression of the stream senders
+ *
+ * Before a frame goes out, its JPEG size and the mean DC luma of coarse
+ * cells of blocks are compared with the last frame sent to the client. A frame close
+ * in size whose samples all stay within the threshold is not sent, unless
+ * keepalive_ms passed since the last frame sent. The size check costs
+ * nothing, the samples an entropy decode without IDCT, shared by the
+ * clients. /stream?skip=0 sends every frame to a client.
+ *
+ * @param config Settings, STREAM_SKIP_DEFAULT_CONFIG() is in effect from boot
+ */
+void StreamSetSkip(const stream_skip_config_t *config);
+
+/**
+ * @brief Read the skip counters
+ *
+ * @param stats Filled with the counters since boot
+ */
+void StreamGetSkipStats(stream_skip_stats_t *stats);
+
+/**
+ * @brief Snapshot counters since boot, see StreamSnapshotHandler()
+ */
+typedef struct {
+    uint32_t requests;          // /snapshot.jpg requests with a valid scale
+    uint32_t shared;            // answered from a frame already in the snapshot slot
+    uint32_t captures;          // frames taken from the camera for snapshots, no stream running
+    uint32_t scaled;            // downscaled JPEGs encoded
+    uint32_t not_modified;      // answered 304, the client had the frame
+} stream_snapshot_stats_t;
+
+/**
+ * @brief HTTP handler of the latest frame as a still (/snapshot.jpg, /snapshot.jpg?scale=2)
+ *
+ * Each request is answered by its own task, the server does not wait for
+ * frames or downscaling. While streams run, the stream sender tasks copy the
+ * frames they send into a shared slot, so snapshots take no frame from the
+ * camera and do not slow the streams; without a new one in time the newest
+ * frame of the slot answers. Without a stream, concurrent requests share one
+ * capture. ?scale=2, 4 or 8 decodes the frame downscaled and codes it again,
+ * once per frame and scale. The ETag names the frame, a client that has it
+ * gets 304. Answers 503 without a camera or frame or with too many requests
+ * at once, 400 for another scale.
+ */
+esp_err_t StreamSnapshotHandler(httpd_req_t *req);
+
+/**
+ * @brief Decode a JPEG at 1/scale and code it again
+ *
+ * The decoder scales in the IDCT, so the work and the RGB buffer shrink with
+ * the scale. Used for /snapshot.jpg?scale= and the recorder's thumbnails.
+ *
+ * @param jpg JPEG
+ * @param len Its length
+ * @param scale 2, 4 or 8
+ * @param quality JPEG quality of the result
+ * @param out Output, the JPEG, to be freed by the caller
+ * @param out_len Output, its length
+ * @return true on success
+ */
+bool StreamJpegScale(const uint8_t *jpg, size_t len, uint8_t scale, uint8_t quality, uint8_t **out,
+                     size_t *out_len);
+
+/**
+ * @brief Read the snapshot counters
+ *
+ * @param stats Filled with the counters since boot
+ */
+void StreamGetSnapshotStats(stream_snapshot_stats_t *stats);
 
 /**
  * @brief Start the video stream
@@ -54,20 +165,66 @@ bool StreamIsActive(void);
 int StreamGetClientCount(void);
 
 /**
- * @brief Get current frame rate
+ * @brief Get the sensor frame rate
+ *
+ * Measured from the capture sequence numbers and VSYNC times of the streamed
+ * frames, so frames the driver dropped do not lower it.
  *
- * @return Current FPS (frames per second)
+ * @return Current FPS (frames per second), 0 until two frames were streamed
  */
 float StreamGetFps(void);
 
 /**
- * @brief Get the HTTP server handle
+ * @brief Get the newest frame the stream captured
+ *
+ * Its capture sequence number and VSYNC time, the ones its MJPEG part carries,
+ * to tag an overlay computed now (see overlay_data_t). Takes no frame from
+ * any queue.
+ *
+ * @param sequence Output, capture sequence number
+ * @param capture_us Output, its VSYNC time
+ * @return false until a stream client got a frame
+ */
+bool StreamGetLastFrame(uint32_t *sequence, int64_t *capture_us);
+
+/**
+ * @brief Switch the camera to a sensor preset
  *
- * Used for accessing the server from other modules (e.g., overlay)
+ * "day-drive" is the startup configuration, "night" trades noise for
+ * brightness and "low-bandwidth" streams VGA at a lower JPEG quality.
+ * Presets tuned on the device can be saved over them with
+ * esp_camera_preset_save() in the same NVS namespace.
+ *
+ * @param name Preset name
+ * @return 0 on success, -1 on failure
+ */
+int StreamSetPreset(const char *name);
+
+/**
+ * @brief Wait for the next grayscale frame for on-device vision
+ *
+ * Derived by the camera driver from every 6th streamed JPEG frame at 1/8 of
+ * its size (160x90 for HD) without holding up the stream. The frame carries
+ * the sequence number and capture times of the JPEG frame it comes from.
+ *
+ * @param timeout_ms Time to wait for a frame
+ * @return Grayscale frame to be handed back with StreamReturnVisionFrame(), or NULL
+ */
+camera_fb_t *StreamGetVisionFrame(uint32_t timeout_ms);
+
+/**
+ * @brief Hand a frame from StreamGetVisionFrame() back to the driver
+ *
+ * @param fb Grayscale frame
+ */
+void StreamReturnVisionFrame(camera_fb_t *fb);
+
+/**
+ * @brief Get the number of frames sent to stream clients
  *
- * @return HTTP server handle or NULL if not initialized
+ * @return Frames sent since boot, summed over the clients
  */
-void* StreamGetServerHandle(void);
+uint32_t StreamGetFrameCount(void);
 
 #ifdef __cplusplus
 }
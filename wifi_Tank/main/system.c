@@ -226,6 +226,12 @@ void SystemInit(uint16_t tcp_port) {
         system_state.clients[i].connected = false;
     }
 
+    // The system task only looks after the TCP server
+    if (tcp_port == 0) {
+        ESP_LOGI(TAG, "System initialized without TCP server");
+        return;
+    }
+
     // Create system task
     system_state.running = true;
     BaseType_t ret = xTaskCreate(
@@ -15,10 +15,10 @@ extern "C" {
 /**
  * @brief Initialize the system
  *
- * Creates a system task that manages the TCP server and other system functions.
- * This should be called after WiFi is connected.
+ * Creates a system task that manages the TCP server. This should be called
+ * after WiFi is connected.
  *
- * @param tcp_port TCP server port number (use 0 to disable TCP server)
+ * @param tcp_port TCP server port number (use 0 to disable the TCP server and the task)
  */
 void SystemInit(uint16_t tcp_port);
 
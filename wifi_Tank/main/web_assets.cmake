@@ -0,0 +1,31 @@
+# Web pages of the stream server: URI, content type and file in the project directory.
+# web_assets_generate() turns them into the gzip compressed table of web_assets.h, for the
+# firmware (main/CMakeLists.txt) and the host build (host_test/CMakeLists.txt).
+set(WEB_ASSETS
+    "/"                 "text/html"         "overlay_demo.html"
+    "/player"           "text/html"         "player.html"
+    "/player_worker.js" "text/javascript"   "player_worker.js")
+
+set(WEB_ASSETS_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/web_assets.py)
+
+# Generate output (a C source) from the WEB_ASSETS files under project_dir with python
+function(web_assets_generate python project_dir output)
+    set(args)
+    set(files)
+    list(LENGTH WEB_ASSETS count)
+    math(EXPR last "${count} - 1")
+    foreach(i RANGE 0 ${last} 3)
+        math(EXPR type_i "${i} + 1")
+        math(EXPR file_i "${i} + 2")
+        list(GET WEB_ASSETS ${i} uri)
+        list(GET WEB_ASSETS ${type_i} type)
+        list(GET WEB_ASSETS ${file_i} file)
+        list(APPEND args ${uri} ${type} ${project_dir}/${file})
+        list(APPEND files ${project_dir}/${file})
+    endforeach()
+    add_custom_command(OUTPUT ${output}
+        COMMAND ${python} ${WEB_ASSETS_SCRIPT} ${output} ${args}
+        DEPENDS ${WEB_ASSETS_SCRIPT} ${files}
+        COMMENT "Compressing web assets"
+        VERBATIM)
+endfunction()
@@ -0,0 +1,36 @@
+/*! \file web_assets.h
+\brief Web pages of the stream server, gzip compressed at build time
+
+The table is generated by web_assets.py from the files listed in
+web_assets.cmake. The pages are only kept compressed and always sent with
+Content-Encoding: gzip, which every browser accepts.
+*******************************************************************************/
+
+#ifndef WEB_ASSETS_H_
+#define WEB_ASSETS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One page
+typedef struct {
+    const char *uri;
+    const char *type;           // Content-Type
+    const uint8_t *gzip;        // the file, gzip compressed
+    size_t gzip_len;
+    size_t len;                 // length of the file
+    const char *etag;           // strong ETag of the compressed body, with its quotes
+} web_asset_t;
+
+extern const web_asset_t web_assets[];
+extern const size_t web_assets_count;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WEB_ASSETS_H_ */
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+"""Generate the web asset table of main/web_assets.h.
+
+Every file is gzip compressed (level 9, no name or time stamp, so the same
+file always gives the same bytes) and gets a strong ETag from the hash of the
+compressed body.
+
+Usage: web_assets.py <output.c> <uri> <content type> <file> [<uri> <type> <file> ...]
+"""
+import gzip
+import hashlib
+import os
+import sys
+
+
+def c_bytes(data, indent='    ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x%02x' % b for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main(argv):
+    if len(argv) < 5 or (len(argv) - 2) % 3:
+        sys.stderr.write(__doc__)
+        return 2
+    output = argv[1]
+    assets = [argv[i:i + 3] for i in range(2, len(argv), 3)]
+
+    out = ['// Generated by web_assets.py, do not edit',
+           '#include "web_assets.h"',
+           '']
+    entries = []
+    for n, (uri, content_type, path) in enumerate(assets):
+        with open(path, 'rb') as f:
+            data = f.read()
+        packed = gzip.compress(data, compresslevel=9, mtime=0)
+        etag = '"%s"' % hashlib.sha256(packed).hexdigest()[:16]
+        name = 'asset_%d' % n
+        out.append('// %s: %d bytes, %d gzip compressed' % (os.path.basename(path), len(data), len(packed)))
+        out.append('static const uint8_t %s[] = {' % name)
+        out.append(c_bytes(packed))
+        out.append('};')
+        out.append('')
+        entries.append('    { "%s", "%s", %s, sizeof(%s), %d, "\\"%s\\"" },'
+                       % (uri, content_type, name, name, len(data), etag.strip('"')))
+
+    out.append('const web_asset_t web_assets[] = {')
+    out.extend(entries)
+    out.append('};')
+    out.append('')
+    out.append('const size_t web_assets_count = sizeof(web_assets) / sizeof(web_assets[0]);')
+    out.append('')
+    with open(output, 'w') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,395 @@
+// ESP32 WiFi Tank - worker of player.html
+//
+// Reads /stream with fetch, cuts the multipart body into JPEG parts, decodes
+// them (WebCodecs ImageDecoder, createImageBitmap where that is missing) and
+// draws each frame with the overlay of its own sequence number on the
+// OffscreenCanvas player.html hands over. The page thread only shows the
+// numbers this worker posts, so a busy page does not hold frames back.
+//
+// MjpegParser has no browser dependencies; host_test/player_parse_test.js
+// runs it under Node on a recorded stream.
+'use strict';
+
+const ASCII_CR = 13;
+const ASCII_DASH = 45;
+
+// Incremental multipart/x-mixed-replace parser. Bytes are appended to one
+// buffer that grows by doubling and is compacted when a part is consumed, so
+// every byte is copied a bounded number of times however the network splits
+// the stream. Parts with a Content-Length are cut without looking at their
+// bytes; parts without one end at the next boundary.
+class MjpegParser {
+    constructor(boundary, onPart) {
+        this.delimiter = new TextEncoder().encode('--' + boundary);
+        this.onPart = onPart;
+        this.decoder = new TextDecoder();
+        this.buf = new Uint8Array(64 * 1024);
+        this.start = 0;
+        this.end = 0;
+        this.headers = null;    // headers of the part being received
+        this.length = -1;       // its Content-Length, -1 for none
+        this.bytes = 0;         // bytes pushed in total
+    }
+
+    push(chunk) {
+        this.bytes += chunk.length;
+        if (this.end + chunk.length > this.buf.length) {
+            const used = this.end - this.start;
+            let size = this.buf.length;
+            while (used + chunk.length > size) {
+                size *= 2;
+            }
+            if (size === this.buf.length) {
+                this.buf.copyWithin(0, this.start, this.end);
+            } else {
+                const buf = new Uint8Array(size);
+                buf.set(this.buf.subarray(this.start, this.end));
+                this.buf = buf;
+            }
+            this.end = used;
+            this.start = 0;
+        }
+        this.buf.set(chunk, this.end);
+        this.end += chunk.length;
+        while (this.next()) {
+        }
+    }
+
+    // Index of the delimiter at or after from, -1 if it is not (all) there yet
+    find(from) {
+        const d = this.delimiter;
+        const b = this.buf.subarray(0, this.end);
+        for (let i = b.indexOf(ASCII_DASH, from); i >= 0 && i + d.length <= this.end; i = b.indexOf(ASCII_DASH, i + 1)) {
+            let j = 1;
+            while (j < d.length && b[i + j] === d[j]) {
+                j++;
+            }
+            if (j === d.length) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Index of the CRLF CRLF ending the part headers, -1 if not there yet
+    findHeaderEnd(from) {
+        const b = this.buf.subarray(0, this.end);
+        for (let i = b.indexOf(ASCII_CR, from); i >= 0 && i + 4 <= this.end; i = b.indexOf(ASCII_CR, i + 1)) {
+            if (b[i + 1] === 10 && b[i + 2] === ASCII_CR && b[i + 3] === 10) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Takes one step: the headers of the next part, or the part; false when it needs more bytes
+    next() {
+        if (!this.headers) {
+            const at = this.find(this.start);
+            const end = at < 0 ? -1 : this.findHeaderEnd(at + this.delimiter.length);
+            if (end < 0) {
+                if (at < 0 && this.end - this.start > this.delimiter.length) {
+                    this.start = this.end - this.delimiter.length;  // junk before the first boundary
+                }
+                return false;
+            }
+            const headers = {};
+            this.decoder.decode(this.buf.subarray(at + this.delimiter.length, end)).split('\r\n').forEach(function(line) {
+                const colon = line.indexOf(':');
+                if (colon > 0) {
+                    headers[line.slice(0, colon).trim().toLowerCase()] = line.slice(colon + 1).trim();
+                }
+            });
+            this.headers = headers;
+            this.length = 'content-length' in headers ? parseInt(headers['content-length'], 10) : -1;
+            this.start = end + 4;
+        }
+        let len = this.length;
+        if (len < 0) {
+            const at = this.find(this.start);
+            if (at < 0) {
+                return false;
+            }
+            len = at - this.start;
+            // the CRLF in front of the delimiter belongs to it
+            len -= len >= 2 && this.buf[this.start + len - 2] === ASCII_CR ? 2 : 0;
+        }
+        if (this.end - this.start < len) {
+            return false;
+        }
+        const data = this.buf.slice(this.start, this.start + len);
+        const headers = this.headers;
+        this.start += len;
+        this.headers = null;
+        if (this.start === this.end) {
+            this.start = this.end = 0;
+        }
+        this.onPart(headers, data);
+        return true;
+    }
+}
+
+// Frame tags of a part, the same values an overlay carries in seq and ts
+function frameOf(headers, data) {
+    return {
+        seq: parseInt(headers['x-frame-sequence'] || '0', 10),
+        ts: Math.round(parseFloat(headers['x-timestamp'] || '0') * 1e6),
+        data: data,
+    };
+}
+
+if (typeof module !== 'undefined') {
+    module.exports = { MjpegParser, frameOf };
+}
+
+if (typeof WorkerGlobalScope !== 'undefined' && self instanceof WorkerGlobalScope) {
+    const MAX_PENDING = 64;             // overlays waiting for their frame
+    const STATS_MS = 500;
+
+    let canvas = null;
+    let ctx = null;
+    let abort = null;
+    let ws = null;
+    let drawOverlays = true;
+    let decoding = false;
+    let queued = null;                  // newest frame that arrived while one was decoding
+    let lastImage = null;               // frame on screen, kept to redraw it under a new overlay
+    let lastFrame = null;
+    let pending = [];
+    let shownOverlay = null;
+    let stats = null;
+
+    function resetStats() {
+        stats = {
+            frames: 0, bytes: 0, decodeMs: 0, showMs: 0, skipped: 0, dropped: 0, overlays: 0,
+            transitMin: Infinity, jitterMs: 0, jitterN: 0, lastSeq: 0, since: performance.now(),
+        };
+    }
+
+    // Newest overlay describing this frame or an earlier one
+    function overlayFor(frame) {
+        while (pending.length && pending[0].seq <= frame.seq) {
+            shownOverlay = pending.shift();
+        }
+        return shownOverlay;
+    }
+
+    function drawOverlay(data) {
+        if (!data || !drawOverlays) {
+            return;
+        }
+        (data.text || []).forEach(function(t) {
+            ctx.font = `${t.size}px Arial`;
+            ctx.fillStyle = t.color;
+            ctx.strokeStyle = 'black';
+            ctx.lineWidth = 2;
+            ctx.strokeText(t.content, t.x, t.y);
+            ctx.fillText(t.content, t.x, t.y);
+        });
+        (data.shapes || []).forEach(function(s) {
+            ctx.strokeStyle = s.color;
+            ctx.fillStyle = s.color;
+            ctx.lineWidth = s.width || 2;
+            if (s.type === 'line') {
+                ctx.beginPath();
+                ctx.moveTo(s.x1, s.y1);
+                ctx.lineTo(s.x2, s.y2);
+                ctx.stroke();
+            } else if (s.type === 'rect') {
+                s.fill ? ctx.fillRect(s.x, s.y, s.w, s.h) : ctx.strokeRect(s.x, s.y, s.w, s.h);
+            } else if (s.type === 'circle') {
+                ctx.beginPath();
+                ctx.arc(s.x, s.y, s.r, 0, 2 * Math.PI);
+                s.fill ? ctx.fill() : ctx.stroke();
+            }
+        });
+    }
+
+    function compose() {
+        if (!lastImage) {
+            return;
+        }
+        const w = lastImage.displayWidth || lastImage.width;
+        const h = lastImage.displayHeight || lastImage.height;
+        if (canvas.width !== w || canvas.height !== h) {
+            canvas.width = w;
+            canvas.height = h;
+        }
+        ctx.drawImage(lastImage, 0, 0);
+        drawOverlay(lastFrame && lastFrame.seq ? overlayFor(lastFrame) : shownOverlay);
+    }
+
+    async function decode(data) {
+        if (typeof ImageDecoder !== 'undefined') {
+            const decoder = new ImageDecoder({ data: data, type: 'image/jpeg' });
+            try {
+                return (await decoder.decode()).image;
+            } finally {
+                decoder.close();
+            }
+        }
+        return createImageBitmap(new Blob([data], { type: 'image/jpeg' }));
+    }
+
+    // One decode at a time; a frame arriving meanwhile replaces the one waiting
+    async function show(frame) {
+        if (decoding) {
+            stats.skipped += queued ? 1 : 0;
+            queued = frame;
+            return;
+        }
+        decoding = true;
+        while (frame) {
+            const t0 = performance.now();
+            try {
+                const image = await decode(frame.data);
+                const t1 = performance.now();
+                if (lastImage) {
+                    lastImage.close();
+                }
+                lastImage = image;
+                lastFrame = frame;
+                compose();
+                stats.frames++;
+                stats.decodeMs += t1 - t0;
+                stats.showMs += performance.now() - frame.arrived;
+            } catch (e) {
+                stats.skipped++;
+            }
+            frame = queued;
+            queued = null;
+        }
+        decoding = false;
+    }
+
+    function receivePart(headers, data) {
+        const frame = frameOf(headers, data);
+        frame.arrived = performance.now();
+        stats.bytes += data.length;
+        if (frame.seq && stats.lastSeq && frame.seq > stats.lastSeq + 1) {
+            stats.dropped += frame.seq - stats.lastSeq - 1;
+        }
+        stats.lastSeq = frame.seq || stats.lastSeq;
+        if (frame.ts) {
+            // device and page clocks differ by a constant: delay beyond the quickest frame so far
+            const transit = frame.arrived - frame.ts / 1000;
+            stats.transitMin = Math.min(stats.transitMin, transit);
+            stats.jitterMs += transit - stats.transitMin;
+            stats.jitterN++;
+        }
+        show(frame);
+    }
+
+    function receiveOverlay(data) {
+        stats.overlays++;
+        if (!data.seq) {
+            shownOverlay = data;
+            compose();
+            return;
+        }
+        pending.push(data);
+        pending.sort(function(a, b) { return a.seq - b.seq; });
+        if (pending.length > MAX_PENDING) {
+            pending.shift();
+        }
+        if (lastFrame && data.seq <= lastFrame.seq) {
+            compose();
+        }
+    }
+
+    function postStats() {
+        if (!stats) {
+            return;
+        }
+        const now = performance.now();
+        const s = (now - stats.since) / 1000;
+        self.postMessage({
+            type: 'stats',
+            fps: stats.frames / s,
+            kbps: stats.bytes * 8 / 1000 / s,
+            decodeMs: stats.frames ? stats.decodeMs / stats.frames : 0,
+            showMs: stats.frames ? stats.showMs / stats.frames : 0,
+            jitterMs: stats.jitterN ? stats.jitterMs / stats.jitterN : 0,
+            skipped: stats.skipped,
+            dropped: stats.dropped,
+            overlays: stats.overlays,
+        });
+        // rates over the last interval, counts since the start
+        Object.assign(stats, { frames: 0, bytes: 0, decodeMs: 0, showMs: 0, jitterMs: 0, jitterN: 0, since: now });
+    }
+
+    async function readStream(url) {
+        abort = new AbortController();
+        const resp = await fetch(url, { signal: abort.signal });
+        const match = (resp.headers.get('Content-Type') || '').match(/boundary=(.+)$/);
+        if (!resp.ok || !match) {
+            throw new Error('Not an MJPEG stream');
+        }
+        const parser = new MjpegParser(match[1], receivePart);
+        const reader = resp.body.getReader();
+        while (true) {
+            const { done, value } = await reader.read();
+            if (done) {
+                break;
+            }
+            parser.push(value);
+        }
+    }
+
+    function start(msg) {
+        resetStats();
+        readStream(msg.streamUrl).then(function() {
+            self.postMessage({ type: 'error', message: 'Stream ended' });
+        }).catch(function(e) {
+            if (e.name !== 'AbortError') {
+                self.postMessage({ type: 'error', message: 'Video stream failed: ' + e.message });
+            }
+        });
+        ws = new WebSocket(msg.wsUrl);
+        ws.onopen = function() { self.postMessage({ type: 'ws', connected: true }); };
+        ws.onclose = function() { self.postMessage({ type: 'ws', connected: false }); };
+        ws.onmessage = function(event) {
+            try {
+                receiveOverlay(JSON.parse(event.data));
+            } catch (e) {
+                console.error('Failed to parse overlay data:', e);
+            }
+        };
+    }
+
+    function stop() {
+        if (abort) {
+            abort.abort();
+            abort = null;
+        }
+        if (ws) {
+            ws.close();
+            ws = null;
+        }
+        if (lastImage) {
+            lastImage.close();
+            lastImage = null;
+        }
+        queued = null;
+        lastFrame = null;
+        pending = [];
+        shownOverlay = null;
+        ctx.clearRect(0, 0, canvas.width, canvas.height);
+    }
+
+    self.onmessage = function(event) {
+        const msg = event.data;
+        if (msg.type === 'canvas') {
+            canvas = msg.canvas;
+            ctx = canvas.getContext('2d');
+            setInterval(postStats, STATS_MS);
+        } else if (msg.type === 'start') {
+            start(msg);
+        } else if (msg.type === 'stop') {
+            stop();
+        } else if (msg.type === 'overlays') {
+            drawOverlays = msg.enabled;
+            compose();
+        }
+    };
+}